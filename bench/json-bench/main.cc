@@ -0,0 +1,207 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+
+/* Compares cJSON_Parse() and cJSON_Print() with the byte-at-a-time parser and
+printer they replaced, on a few kinds of document that the server actually
+handles: a batch of table rows like a ReQL query returns, an indented blob like
+the admin HTTP API's metadata, and rows with lots of escaped strings like a
+bulk import of text. Each one is parsed and printed over and over for the given
+duration, and we report the throughput in megabytes of JSON per second. */
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <string>
+#include <vector>
+
+#include "containers/uuid.hpp"
+#include "http/json.hpp"
+#include "utils.hpp"
+
+struct config_t {
+    config_t() : rows(1000), duration(1.0) { }
+
+    int rows;
+    double duration;  // Seconds
+};
+
+std::string random_word(int min_length, int max_length) {
+    std::string word;
+    int length = min_length + random() % (max_length - min_length + 1);
+    for (int i = 0; i < length; ++i) {
+        word += 'a' + random() % 26;
+    }
+    return word;
+}
+
+cJSON *make_row(int i, bool escapes) {
+    cJSON *row = cJSON_CreateObject();
+    cJSON_AddItemToObject(row, "id", cJSON_CreateString(uuid_to_str(generate_uuid()).c_str()));
+    cJSON_AddItemToObject(row, "name", cJSON_CreateString(random_word(4, 12).c_str()));
+    cJSON_AddItemToObject(row, "age", cJSON_CreateNumber(random() % 100));
+    cJSON_AddItemToObject(row, "score", cJSON_CreateNumber(random() / 1000.0));
+    cJSON_AddItemToObject(row, "active", cJSON_CreateBool(i % 2));
+    cJSON *tags = cJSON_CreateArray();
+    for (int j = random() % 5; j > 0; --j) {
+        cJSON_AddItemToArray(tags, cJSON_CreateString(random_word(3, 8).c_str()));
+    }
+    cJSON_AddItemToObject(row, "tags", tags);
+    cJSON *address = cJSON_CreateObject();
+    cJSON_AddItemToObject(address, "street", cJSON_CreateString((random_word(5, 10) + " street").c_str()));
+    cJSON_AddItemToObject(address, "zip", cJSON_CreateNumber(10000 + random() % 90000));
+    cJSON_AddItemToObject(row, "address", address);
+    if (escapes) {
+        std::string text;
+        for (int j = 0; j < 20; ++j) {
+            text += random_word(2, 8) + (j % 4 == 0 ? "\n" : j % 4 == 1 ? "\t\"" : " ");
+        }
+        cJSON_AddItemToObject(row, "text", cJSON_CreateString(text.c_str()));
+    }
+    return row;
+}
+
+cJSON *make_rows(int rows, bool escapes) {
+    cJSON *array = cJSON_CreateArray();
+    for (int i = 0; i < rows; ++i) {
+        cJSON_AddItemToArray(array, make_row(i, escapes));
+    }
+    return array;
+}
+
+/* Looks like the cluster metadata, which is keyed by uuids all the way down. */
+cJSON *make_metadata(int tables) {
+    cJSON *metadata = cJSON_CreateObject();
+    for (int i = 0; i < tables; ++i) {
+        cJSON *table = cJSON_CreateObject();
+        cJSON_AddItemToObject(table, "name", cJSON_CreateString(random_word(5, 15).c_str()));
+        cJSON_AddItemToObject(table, "primary_key", cJSON_CreateString("id"));
+        cJSON_AddItemToObject(table, "port", cJSON_CreateNumber(random() % 65536));
+        cJSON *shards = cJSON_CreateArray();
+        for (int j = 0; j < 8; ++j) {
+            cJSON_AddItemToArray(shards, cJSON_CreateString(random_word(10, 10).c_str()));
+        }
+        cJSON_AddItemToObject(table, "shards", shards);
+        cJSON *replicas = cJSON_CreateObject();
+        for (int j = 0; j < 3; ++j) {
+            cJSON_AddItemToObject(replicas, uuid_to_str(generate_uuid()).c_str(), cJSON_CreateNumber(1 + random() % 3));
+        }
+        cJSON_AddItemToObject(table, "replica_affinities", replicas);
+        cJSON_AddItemToObject(metadata, uuid_to_str(generate_uuid()).c_str(), table);
+    }
+    return metadata;
+}
+
+class json_benchmark_t {
+public:
+    json_benchmark_t(const std::string &_name, cJSON *json, bool formatted, const config_t &_config)
+        : name(_name), fmt(formatted ? 1 : 0), config(_config) {
+        char *s = cJSON_PrintBytewise(json, fmt);
+        text = s;
+        free(s);
+        cJSON_Delete(json);
+    }
+
+    void run() const {
+        printf("%s (%zu bytes):\n", name.c_str(), text.size());
+        report("  parse, bytewise", time_parse(&cJSON_ParseBytewise));
+        report("  parse, indexed ", time_parse(&cJSON_Parse));
+
+        scoped_cJSON_t json(cJSON_Parse(text.c_str()));
+        report("  print, bytewise", time_print(json.get(), true));
+        report("  print, buffered", time_print(json.get(), false));
+    }
+
+private:
+    double time_parse(cJSON *(*parse)(const char *)) const {
+        int64_t bytes = 0;
+        ticks_t start = get_ticks(), deadline = start + secs_to_ticks(config.duration);
+        while (get_ticks() < deadline) {
+            cJSON *json = parse(text.c_str());
+            guarantee(json);
+            cJSON_Delete(json);
+            bytes += text.size();
+        }
+        return bytes / ticks_to_secs(get_ticks() - start);
+    }
+
+    double time_print(cJSON *json, bool bytewise) const {
+        int64_t bytes = 0;
+        ticks_t start = get_ticks(), deadline = start + secs_to_ticks(config.duration);
+        while (get_ticks() < deadline) {
+            char *s = bytewise ? cJSON_PrintBytewise(json, fmt) : fmt ? cJSON_Print(json) : cJSON_PrintUnformatted(json);
+            guarantee(s);
+            free(s);
+            bytes += text.size();
+        }
+        return bytes / ticks_to_secs(get_ticks() - start);
+    }
+
+    void report(const char *what, double bytes_per_sec) const {
+        printf("%s %10.1f MB/s\n", what, bytes_per_sec / MEGABYTE);
+    }
+
+    const std::string name;
+    const int fmt;
+    const config_t config;
+    std::string text;
+};
+
+void usage(const char *name) {
+    printf("Usage:\n");
+    printf("\t%s [OPTIONS]\n", name);
+    printf("\nOptions:\n");
+    printf("  -r, --rows\t\tRows in each batch of rows. Defaults to 1000.\n");
+    printf("  -d, --duration\tSeconds to run each measurement for. Defaults to 1.\n");
+    exit(-1);
+}
+
+void parse_config(int argc, char *argv[], config_t *config) {
+    optind = 1;  // reinit getopt
+    for (;;) {
+        static const struct option long_options[] = {
+            {"rows", required_argument, 0, 'r'},
+            {"duration", required_argument, 0, 'd'},
+            {"help", no_argument, 0, 'h'},
+            {0, 0, 0, 0}
+        };
+
+        int option_index = 0;
+        int c = getopt_long(argc, argv, "r:d:h", long_options, &option_index);
+
+        if (c == -1) {
+            break;
+        }
+
+        switch (c) {
+        case 'r':
+            config->rows = atoi(optarg);
+            break;
+        case 'd':
+            config->duration = atof(optarg);
+            break;
+        case 'h':
+        default:
+            usage(argv[0]);
+        }
+    }
+
+    if (config->rows < 1 || config->duration <= 0) {
+        usage(argv[0]);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    config_t config;
+    parse_config(argc, argv, &config);
+
+    json_benchmark_t rows("Rows", make_rows(config.rows, false), false, config);
+    rows.run();
+
+    json_benchmark_t escaped("Rows with escaped text", make_rows(config.rows, true), false, config);
+    escaped.run();
+
+    json_benchmark_t metadata("Indented metadata", make_metadata(config.rows / 10 + 1), true, config);
+    metadata.run();
+
+    return 0;
+}
@@ -0,0 +1,144 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+
+/* Measures how many cross-thread messages per second the message hubs can move.
+Each worker thread runs a number of coroutines that hop to some other thread and
+back with `on_thread_t` for as long as the benchmark runs; every hop is one
+`linux_thread_message_t` going through `linux_message_hub_t`. The benchmark is
+repeated for each thread count that's given. */
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <string>
+#include <vector>
+
+#include "errors.hpp"
+#include <boost/bind.hpp>
+
+#include "arch/runtime/runtime.hpp"
+#include "arch/runtime/starter.hpp"
+#include "arch/timing.hpp"
+#include "concurrency/pmap.hpp"
+#include "utils.hpp"
+
+struct config_t {
+    config_t() : coroutines_per_thread(16), duration(2.0) { }
+
+    std::vector<int> thread_counts;
+    int coroutines_per_thread;
+    double duration;  // Seconds
+};
+
+class hop_benchmark_t {
+public:
+    hop_benchmark_t(int _threads, const config_t &_config)
+        : threads(_threads), config(_config), messages(0), elapsed(0) { }
+
+    void run() {
+        ticks_t start = get_ticks();
+        deadline = start + secs_to_ticks(config.duration);
+        pmap(threads * config.coroutines_per_thread, boost::bind(&hop_benchmark_t::hopper, this, _1));
+        elapsed = ticks_to_secs(get_ticks() - start);
+    }
+
+    void print_results() const {
+        printf("%3d threads %12.0f messages/sec\n", threads, messages / elapsed);
+    }
+
+private:
+    void hopper(int i) {
+        on_thread_t home(i % threads);
+        int64_t hops = 0;
+        // Hop to every other thread in turn, so that all pairs of hubs see traffic.
+        for (int j = 1; get_ticks() < deadline; ++j) {
+            on_thread_t away((i + 1 + j % (threads - 1)) % threads);
+            ++hops;
+        }
+        // One message there and one message back.
+        __sync_fetch_and_add(&messages, 2 * hops);
+    }
+
+    const int threads;
+    const config_t config;
+    ticks_t deadline;
+    int64_t messages;
+    double elapsed;
+};
+
+void usage(const char *name) {
+    printf("Usage:\n");
+    printf("\t%s [OPTIONS]\n", name);
+    printf("\nOptions:\n");
+    printf("  -t, --threads\t\tComma-separated thread counts to try. Defaults to 2,4,8,16.\n");
+    printf("  -c, --coroutines\tCoroutines hopping around per thread. Defaults to 16.\n");
+    printf("  -d, --duration\tSeconds to run for at each thread count. Defaults to 2.\n");
+    exit(-1);
+}
+
+void parse_config(int argc, char *argv[], config_t *config) {
+    optind = 1;  // reinit getopt
+    for (;;) {
+        static const struct option long_options[] = {
+            {"threads", required_argument, 0, 't'},
+            {"coroutines", required_argument, 0, 'c'},
+            {"duration", required_argument, 0, 'd'},
+            {"help", no_argument, 0, 'h'},
+            {0, 0, 0, 0}
+        };
+
+        int option_index = 0;
+        int c = getopt_long(argc, argv, "t:c:d:h", long_options, &option_index);
+
+        if (c == -1) {
+            break;
+        }
+
+        switch (c) {
+        case 't': {
+            config->thread_counts.clear();
+            for (char *token = strtok(optarg, ","); token; token = strtok(NULL, ",")) {
+                config->thread_counts.push_back(atoi(token));
+            }
+            break;
+        }
+        case 'c':
+            config->coroutines_per_thread = atoi(optarg);
+            break;
+        case 'd':
+            config->duration = atof(optarg);
+            break;
+        case 'h':
+        default:
+            usage(argv[0]);
+        }
+    }
+
+    if (config->thread_counts.empty()) {
+        for (int threads = 2; threads <= 16; threads *= 2) {
+            config->thread_counts.push_back(threads);
+        }
+    }
+    for (size_t i = 0; i < config->thread_counts.size(); ++i) {
+        // A single thread would have nowhere to hop to.
+        if (config->thread_counts[i] < 2 || config->thread_counts[i] >= MAX_THREADS) {
+            usage(argv[0]);
+        }
+    }
+    if (config->coroutines_per_thread < 1 || config->duration <= 0) {
+        usage(argv[0]);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    config_t config;
+    parse_config(argc, argv, &config);
+
+    for (size_t i = 0; i < config.thread_counts.size(); ++i) {
+        hop_benchmark_t benchmark(config.thread_counts[i], config);
+        run_in_thread_pool(boost::bind(&hop_benchmark_t::run, &benchmark), config.thread_counts[i]);
+        benchmark.print_results();
+    }
+
+    return 0;
+}
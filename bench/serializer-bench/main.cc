@@ -1,4 +1,6 @@
 // Copyright 2010-2012 RethinkDB, all rights reserved.
+#include <sys/resource.h>
+
 #include "errors.hpp"
 #include <boost/bind.hpp>
 
@@ -73,8 +75,37 @@ struct config_t {
     int duration;   /* Seconds */
     unsigned concurrent_txns;
     unsigned inserts_per_txn, updates_per_txn;
+    io_backend_t io_backend;
+    bool compare_backends;
+};
+
+/* Summary of one run, used by --compare-backends to print a table. */
+struct run_result_t {
+    run_result_t() : block_writes(0), seconds(0), cpu_seconds(0) { }
+    uint64_t block_writes;
+    double seconds;
+    double cpu_seconds;
 };
 
+static double get_cpu_seconds() {
+    /* Counts the time spent by all of our threads, including the blocker pool
+    threads that the pool back-end does its IO from. */
+    struct rusage usage;
+    int res = getrusage(RUSAGE_SELF, &usage);
+    guarantee_err(res == 0, "getrusage() failed");
+    return usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1000000.0 +
+        usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1000000.0;
+}
+
+static const char *io_backend_name(io_backend_t backend) {
+    switch (backend) {
+    case aio_native: return "native";
+    case aio_pool: return "pool";
+    case aio_uring: return "uring";
+    default: unreachable();
+    }
+}
+
 struct tester_t :
     public thread_message_t,
     public txn_callback_t
@@ -91,6 +122,9 @@ struct tester_t :
     unsigned txns_last_sec;
     unsigned secs_so_far;
     scoped_ptr_t<io_backender_t> io_backender;
+    run_result_t *result;
+    ticks_t test_start_time;
+    double test_start_cpu;
     
     
     struct interrupt_msg_t :
@@ -105,10 +139,10 @@ struct tester_t :
         }
     } interruptor;
     
-    tester_t(config_t *config, thread_pool_t *pool)
-        : tps_log_fd(NULL), ser(NULL), active_txns(0), total_txns(0), config(config), pool(pool), stop(false), interrupted(false), last_time(0), txns_last_sec(0), secs_so_far(0), interruptor(this)
+    tester_t(config_t *config, thread_pool_t *pool, run_result_t *result)
+        : tps_log_fd(NULL), ser(NULL), active_txns(0), total_txns(0), config(config), pool(pool), stop(false), interrupted(false), last_time(0), txns_last_sec(0), secs_so_far(0), result(result), test_start_time(0), test_start_cpu(0), interruptor(this)
     {
-        make_io_backender(aio_native, &io_backender);
+        make_io_backender(config->io_backend, &io_backender);
         last_time = get_ticks();
         if(config->tps_log_file) {
             tps_log_fd = fopen(config->tps_log_file, "a");
@@ -150,6 +184,8 @@ struct tester_t :
         linux_thread_message_t *prev_interrupt_message = pool->set_interrupt_message(&interruptor);
         guarantee(prev_interrupt_message == NULL);
 
+        test_start_time = get_ticks();
+        test_start_cpu = get_cpu_seconds();
         pump();
     }
 
@@ -199,6 +235,11 @@ struct tester_t :
         fprintf(stderr, "Started %d transactions and completed %d of them\n",
             total_txns, total_txns - active_txns);
 
+        result->block_writes = static_cast<uint64_t>(total_txns - active_txns) *
+            (config->inserts_per_txn + config->updates_per_txn);
+        result->seconds = ticks_to_secs(get_ticks() - test_start_time);
+        result->cpu_seconds = get_cpu_seconds() - test_start_cpu;
+
         if (tps_log_fd)
             fclose(tps_log_fd);
         
@@ -259,6 +300,8 @@ void parse_config(int argc, char *argv[], config_t *config) {
     config->concurrent_txns = 8;
     config->inserts_per_txn = 10;
     config->updates_per_txn = 2;
+    config->io_backend = aio_default;
+    config->compare_backends = false;
     
     read_arg(argc, argv);
     
@@ -290,7 +333,23 @@ void parse_config(int argc, char *argv[], config_t *config) {
             config->inserts_per_txn = atoi(read_arg(argc, argv));
         } else if (strcmp(flag, "--updates-per-txn") == 0) {
             config->updates_per_txn = atoi(read_arg(argc, argv));
-        
+
+        } else if (strcmp(flag, "--io-backend") == 0) {
+            const char *backend = read_arg(argc, argv);
+            if (strcmp(backend, "native") == 0) {
+                config->io_backend = aio_native;
+            } else if (strcmp(backend, "pool") == 0) {
+                config->io_backend = aio_pool;
+            } else if (strcmp(backend, "uring") == 0) {
+                config->io_backend = aio_uring;
+            } else {
+                fail_due_to_user_error("Unknown IO backend \"%s\"; expected native, pool or uring", backend);
+            }
+        } else if (strcmp(flag, "--compare-backends") == 0) {
+            /* Runs the same workload once with each IO backend and prints a table
+            of block writes per second and CPU time per block write. */
+            config->compare_backends = true;
+
         } else {
             fail_due_to_user_error("Don't know how to handle \"%s\"", flag);
         }
@@ -304,14 +363,50 @@ void parse_config(int argc, char *argv[], config_t *config) {
     rassert(config->concurrent_txns > 0);
 }
 
+void run_test(config_t *config, run_result_t *result) {
+    thread_pool_t thread_pool(1, true);
+    tester_t tester(config, &thread_pool, result);
+    thread_pool.run_thread_pool(&tester);
+}
+
 int main(int argc, char *argv[]) {
     
     config_t config;
     parse_config(argc, argv, &config);
-    
-    thread_pool_t thread_pool(1, true);
-    tester_t tester(&config, &thread_pool);
-    thread_pool.run_thread_pool(&tester);
-    
+
+    if (!config.compare_backends) {
+        run_result_t result;
+        run_test(&config, &result);
+        return 0;
+    }
+
+    guarantee(config.duration != RUN_FOREVER, "--compare-backends needs a finite --duration");
+
+    // Only the backends that this build has.
+    const io_backend_t backends[] = {
+#ifdef AIOSUPPORT
+        aio_native,
+#endif
+        aio_pool,
+#ifdef URINGSUPPORT
+        aio_uring,
+#endif
+    };
+    const int num_backends = sizeof(backends) / sizeof(backends[0]);
+    run_result_t results[num_backends];
+    for (int i = 0; i < num_backends; ++i) {
+        fprintf(stderr, "=== Running with the %s IO backend\n", io_backend_name(backends[i]));
+        config.io_backend = backends[i];
+        run_test(&config, &results[i]);
+    }
+
+    printf("%-8s %14s %16s\n", "backend", "writes/sec", "cpu usec/write");
+    for (int i = 0; i < num_backends; ++i) {
+        const run_result_t &r = results[i];
+        printf("%-8s %14.0f %16.2f\n", io_backend_name(backends[i]),
+               r.seconds > 0 ? r.block_writes / r.seconds : 0.0,
+               r.block_writes > 0 ? r.cpu_seconds * 1000000.0 / r.block_writes : 0.0);
+    }
+
     return 0;
 }
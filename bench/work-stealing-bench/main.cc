@@ -0,0 +1,186 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+
+/* Measures how much work stealing helps when all of the load lands on one
+thread, the way it does when one hot table's store lives on a single thread.
+Every request is spawned on thread 0 and spends most of its time parsing and
+printing a JSON document inside an `on_any_thread_t`, just like the request
+parsing that `--work-stealing` lets idle threads take over. The benchmark runs
+the workload once with work stealing off and once with it on, and prints the
+throughput of each. */
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <string>
+
+#include "errors.hpp"
+#include <boost/bind.hpp>
+
+#include "arch/runtime/runtime.hpp"
+#include "arch/runtime/starter.hpp"
+#include "arch/timing.hpp"
+#include "concurrency/cond_var.hpp"
+#include "http/json/cJSON.hpp"
+#include "utils.hpp"
+
+struct config_t {
+    config_t() : threads(4), requests(20000), concurrency(64), fields(200) { }
+
+    int threads;
+    int requests;
+    int concurrency;
+    int fields;
+};
+
+class skewed_workload_t {
+public:
+    skewed_workload_t(const config_t &_config, const std::string &_document)
+        : config(_config), document(_document), started(0), finished(0), done(NULL) {
+        for (int i = 0; i < MAX_THREADS; ++i) {
+            requests_per_thread[i] = 0;
+        }
+    }
+
+    void run() {
+        rassert(get_thread_id() == 0);
+        cond_t finished_all;
+        done = &finished_all;
+        ticks_t start = get_ticks();
+        for (int i = 0; i < config.concurrency && started < config.requests; ++i) {
+            ++started;
+            coro_t::spawn_sometime(boost::bind(&skewed_workload_t::client, this));
+        }
+        finished_all.wait();
+        done = NULL;
+        elapsed = ticks_to_secs(get_ticks() - start);
+    }
+
+    void print_results(const char *name) const {
+        printf("%-16s %8.0f requests/sec    requests handled per thread:", name, config.requests / elapsed);
+        // The thread pool has a utility thread on top of the worker threads.
+        for (int i = 0; i < config.threads + 1; ++i) {
+            printf(" %d", requests_per_thread[i]);
+        }
+        printf("\n");
+    }
+
+private:
+    void client() {
+        // Each client issues requests back to back, like a connection would.
+        for (;;) {
+            handle_request();
+            if (++finished == config.requests) {
+                done->pulse();
+                return;
+            }
+            if (started == config.requests) {
+                return;
+            }
+            ++started;
+        }
+    }
+
+    void handle_request() {
+        on_any_thread_t rethreader;
+        __sync_fetch_and_add(&requests_per_thread[get_thread_id()], 1);
+        cJSON *json = cJSON_Parse(document.c_str());
+        guarantee(json);
+        char *printed = cJSON_PrintUnformatted(json);
+        free(printed);
+        cJSON_Delete(json);
+    }
+
+    const config_t config;
+    const std::string document;
+
+    /* Only touched on thread 0. */
+    int started, finished;
+    cond_t *done;
+    double elapsed;
+
+    int requests_per_thread[MAX_THREADS];
+};
+
+std::string make_document(int fields) {
+    std::string document = "{";
+    for (int i = 0; i < fields; ++i) {
+        document += strprintf("%s\"field%d\": {\"id\": %d, \"name\": \"value number %d\", \"tags\": [1, 2.5, true, null]}",
+                              i == 0 ? "" : ", ", i, i, i);
+    }
+    document += "}";
+    return document;
+}
+
+void usage(const char *name) {
+    printf("Usage:\n");
+    printf("\t%s [OPTIONS]\n", name);
+    printf("\nOptions:\n");
+    printf("  -t, --threads\t\tNumber of threads in the thread pool. Defaults to 4.\n");
+    printf("  -n, --requests\tTotal number of requests. Defaults to 20000.\n");
+    printf("  -c, --concurrency\tNumber of requests in flight at once. Defaults to 64.\n");
+    printf("  -f, --fields\t\tNumber of fields in each request's document. Defaults to 200.\n");
+    exit(-1);
+}
+
+void parse_config(int argc, char *argv[], config_t *config) {
+    optind = 1;  // reinit getopt
+    for (;;) {
+        static const struct option long_options[] = {
+            {"threads", required_argument, 0, 't'},
+            {"requests", required_argument, 0, 'n'},
+            {"concurrency", required_argument, 0, 'c'},
+            {"fields", required_argument, 0, 'f'},
+            {"help", no_argument, 0, 'h'},
+            {0, 0, 0, 0}
+        };
+
+        int option_index = 0;
+        int c = getopt_long(argc, argv, "t:n:c:f:h", long_options, &option_index);
+
+        if (c == -1) {
+            break;
+        }
+
+        switch (c) {
+        case 't':
+            config->threads = atoi(optarg);
+            break;
+        case 'n':
+            config->requests = atoi(optarg);
+            break;
+        case 'c':
+            config->concurrency = atoi(optarg);
+            break;
+        case 'f':
+            config->fields = atoi(optarg);
+            break;
+        case 'h':
+        default:
+            usage(argv[0]);
+        }
+    }
+
+    if (config->threads < 1 || config->requests < 1 || config->concurrency < 1 || config->fields < 0) {
+        usage(argv[0]);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    config_t config;
+    parse_config(argc, argv, &config);
+
+    std::string document = make_document(config.fields);
+    printf("%d requests of %zu bytes each, all arriving on thread 0 of %d\n",
+           config.requests, document.size(), config.threads);
+
+    skewed_workload_t pinned(config, document);
+    run_in_thread_pool(boost::bind(&skewed_workload_t::run, &pinned), config.threads, false);
+    pinned.print_results("pinned");
+
+    skewed_workload_t stealing(config, document);
+    run_in_thread_pool(boost::bind(&skewed_workload_t::run, &stealing), config.threads, true);
+    stealing.print_results("work stealing");
+
+    return 0;
+}
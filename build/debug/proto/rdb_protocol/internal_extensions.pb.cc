@@ -0,0 +1,78 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: rdb_protocol/internal_extensions.proto
+
+#include "rdb_protocol/internal_extensions.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace query_language {
+namespace extension {
+}  // namespace extension
+}  // namespace query_language
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_rdb_5fprotocol_2finternal_5fextensions_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_rdb_5fprotocol_2finternal_5fextensions_2eproto = nullptr;
+const uint32_t TableStruct_rdb_5fprotocol_2finternal_5fextensions_2eproto::offsets[1] = {};
+static constexpr ::_pbi::MigrationSchema* schemas = nullptr;
+static constexpr ::_pb::Message* const* file_default_instances = nullptr;
+
+const char descriptor_table_protodef_rdb_5fprotocol_2finternal_5fextensions_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n&rdb_protocol/internal_extensions.proto"
+  "\022\030query_language.extension\032!rdb_protocol"
+  "/query_language.proto:\035\n\rinferred_type\022\005"
+  ".Term\030\350\007 \001(\005:\035\n\rdeterministic\022\005.Term\030\352\007 "
+  "\001(\010:\'\n\022inferred_read_type\022\n.ReadQuery\030\350\007"
+  " \001(\005"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_rdb_5fprotocol_2finternal_5fextensions_2eproto_deps[1] = {
+  &::descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_rdb_5fprotocol_2finternal_5fextensions_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_rdb_5fprotocol_2finternal_5fextensions_2eproto = {
+    false, false, 204, descriptor_table_protodef_rdb_5fprotocol_2finternal_5fextensions_2eproto,
+    "rdb_protocol/internal_extensions.proto",
+    &descriptor_table_rdb_5fprotocol_2finternal_5fextensions_2eproto_once, descriptor_table_rdb_5fprotocol_2finternal_5fextensions_2eproto_deps, 1, 0,
+    schemas, file_default_instances, TableStruct_rdb_5fprotocol_2finternal_5fextensions_2eproto::offsets,
+    nullptr, file_level_enum_descriptors_rdb_5fprotocol_2finternal_5fextensions_2eproto,
+    file_level_service_descriptors_rdb_5fprotocol_2finternal_5fextensions_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_rdb_5fprotocol_2finternal_5fextensions_2eproto_getter() {
+  return &descriptor_table_rdb_5fprotocol_2finternal_5fextensions_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_rdb_5fprotocol_2finternal_5fextensions_2eproto(&descriptor_table_rdb_5fprotocol_2finternal_5fextensions_2eproto);
+namespace query_language {
+namespace extension {
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::Term,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< int32_t >, 5, false>
+  inferred_type(kInferredTypeFieldNumber, 0, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::Term,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false>
+  deterministic(kDeterministicFieldNumber, false, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::ReadQuery,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< int32_t >, 5, false>
+  inferred_read_type(kInferredReadTypeFieldNumber, 0, nullptr);
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace extension
+}  // namespace query_language
+PROTOBUF_NAMESPACE_OPEN
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,87 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: rdb_protocol/internal_extensions.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_rdb_5fprotocol_2finternal_5fextensions_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_rdb_5fprotocol_2finternal_5fextensions_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include "rdb_protocol/query_language.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_rdb_5fprotocol_2finternal_5fextensions_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_rdb_5fprotocol_2finternal_5fextensions_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_rdb_5fprotocol_2finternal_5fextensions_2eproto;
+PROTOBUF_NAMESPACE_OPEN
+PROTOBUF_NAMESPACE_CLOSE
+namespace query_language {
+namespace extension {
+
+// ===================================================================
+
+
+// ===================================================================
+
+static const int kInferredTypeFieldNumber = 1000;
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::Term,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< int32_t >, 5, false >
+  inferred_type;
+static const int kDeterministicFieldNumber = 1002;
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::Term,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false >
+  deterministic;
+static const int kInferredReadTypeFieldNumber = 1000;
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::ReadQuery,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< int32_t >, 5, false >
+  inferred_read_type;
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace extension
+}  // namespace query_language
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_rdb_5fprotocol_2finternal_5fextensions_2eproto
@@ -0,0 +1,13505 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: rdb_protocol/query_language.proto
+
+#include "rdb_protocol/query_language.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+PROTOBUF_CONSTEXPR TableRef::TableRef(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.db_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.table_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.use_outdated_)*/false} {}
+struct TableRefDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TableRefDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TableRefDefaultTypeInternal() {}
+  union {
+    TableRef _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TableRefDefaultTypeInternal _TableRef_default_instance_;
+PROTOBUF_CONSTEXPR VarTermTuple::VarTermTuple(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.var_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.term_)*/nullptr} {}
+struct VarTermTupleDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VarTermTupleDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VarTermTupleDefaultTypeInternal() {}
+  union {
+    VarTermTuple _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VarTermTupleDefaultTypeInternal _VarTermTuple_default_instance_;
+PROTOBUF_CONSTEXPR Term_Let::Term_Let(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.binds_)*/{}
+  , /*decltype(_impl_.expr_)*/nullptr} {}
+struct Term_LetDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Term_LetDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Term_LetDefaultTypeInternal() {}
+  union {
+    Term_Let _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Term_LetDefaultTypeInternal _Term_Let_default_instance_;
+PROTOBUF_CONSTEXPR Term_Call::Term_Call(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.args_)*/{}
+  , /*decltype(_impl_.builtin_)*/nullptr} {}
+struct Term_CallDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Term_CallDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Term_CallDefaultTypeInternal() {}
+  union {
+    Term_Call _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Term_CallDefaultTypeInternal _Term_Call_default_instance_;
+PROTOBUF_CONSTEXPR Term_If::Term_If(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.test_)*/nullptr
+  , /*decltype(_impl_.true_branch_)*/nullptr
+  , /*decltype(_impl_.false_branch_)*/nullptr} {}
+struct Term_IfDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Term_IfDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Term_IfDefaultTypeInternal() {}
+  union {
+    Term_If _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Term_IfDefaultTypeInternal _Term_If_default_instance_;
+PROTOBUF_CONSTEXPR Term_GetByKey::Term_GetByKey(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.attrname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.table_ref_)*/nullptr
+  , /*decltype(_impl_.key_)*/nullptr} {}
+struct Term_GetByKeyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Term_GetByKeyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Term_GetByKeyDefaultTypeInternal() {}
+  union {
+    Term_GetByKey _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Term_GetByKeyDefaultTypeInternal _Term_GetByKey_default_instance_;
+PROTOBUF_CONSTEXPR Term_Table::Term_Table(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.table_ref_)*/nullptr} {}
+struct Term_TableDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Term_TableDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Term_TableDefaultTypeInternal() {}
+  union {
+    Term_Table _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Term_TableDefaultTypeInternal _Term_Table_default_instance_;
+PROTOBUF_CONSTEXPR Term::Term(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._extensions_)*/{}
+  , /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.array_)*/{}
+  , /*decltype(_impl_.object_)*/{}
+  , /*decltype(_impl_.var_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.valuestring_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.jsonstring_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.javascript_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.let_)*/nullptr
+  , /*decltype(_impl_.call_)*/nullptr
+  , /*decltype(_impl_.if__)*/nullptr
+  , /*decltype(_impl_.get_by_key_)*/nullptr
+  , /*decltype(_impl_.table_)*/nullptr
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.valuebool_)*/false
+  , /*decltype(_impl_.number_)*/0} {}
+struct TermDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TermDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TermDefaultTypeInternal() {}
+  union {
+    Term _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TermDefaultTypeInternal _Term_default_instance_;
+PROTOBUF_CONSTEXPR Builtin_Filter::Builtin_Filter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.predicate_)*/nullptr} {}
+struct Builtin_FilterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Builtin_FilterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Builtin_FilterDefaultTypeInternal() {}
+  union {
+    Builtin_Filter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Builtin_FilterDefaultTypeInternal _Builtin_Filter_default_instance_;
+PROTOBUF_CONSTEXPR Builtin_Map::Builtin_Map(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.mapping_)*/nullptr} {}
+struct Builtin_MapDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Builtin_MapDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Builtin_MapDefaultTypeInternal() {}
+  union {
+    Builtin_Map _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Builtin_MapDefaultTypeInternal _Builtin_Map_default_instance_;
+PROTOBUF_CONSTEXPR Builtin_ConcatMap::Builtin_ConcatMap(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.mapping_)*/nullptr} {}
+struct Builtin_ConcatMapDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Builtin_ConcatMapDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Builtin_ConcatMapDefaultTypeInternal() {}
+  union {
+    Builtin_ConcatMap _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Builtin_ConcatMapDefaultTypeInternal _Builtin_ConcatMap_default_instance_;
+PROTOBUF_CONSTEXPR Builtin_OrderBy::Builtin_OrderBy(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.attr_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ascending_)*/true} {}
+struct Builtin_OrderByDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Builtin_OrderByDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Builtin_OrderByDefaultTypeInternal() {}
+  union {
+    Builtin_OrderBy _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Builtin_OrderByDefaultTypeInternal _Builtin_OrderBy_default_instance_;
+PROTOBUF_CONSTEXPR Builtin_GroupedMapReduce::Builtin_GroupedMapReduce(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.group_mapping_)*/nullptr
+  , /*decltype(_impl_.value_mapping_)*/nullptr
+  , /*decltype(_impl_.reduction_)*/nullptr} {}
+struct Builtin_GroupedMapReduceDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Builtin_GroupedMapReduceDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Builtin_GroupedMapReduceDefaultTypeInternal() {}
+  union {
+    Builtin_GroupedMapReduce _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Builtin_GroupedMapReduceDefaultTypeInternal _Builtin_GroupedMapReduce_default_instance_;
+PROTOBUF_CONSTEXPR Builtin_Range::Builtin_Range(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.attrname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.lowerbound_)*/nullptr
+  , /*decltype(_impl_.upperbound_)*/nullptr} {}
+struct Builtin_RangeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Builtin_RangeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Builtin_RangeDefaultTypeInternal() {}
+  union {
+    Builtin_Range _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Builtin_RangeDefaultTypeInternal _Builtin_Range_default_instance_;
+PROTOBUF_CONSTEXPR Builtin::Builtin(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.attrs_)*/{}
+  , /*decltype(_impl_.order_by_)*/{}
+  , /*decltype(_impl_.attr_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.filter_)*/nullptr
+  , /*decltype(_impl_.map_)*/nullptr
+  , /*decltype(_impl_.concat_map_)*/nullptr
+  , /*decltype(_impl_.reduce_)*/nullptr
+  , /*decltype(_impl_.grouped_map_reduce_)*/nullptr
+  , /*decltype(_impl_.range_)*/nullptr
+  , /*decltype(_impl_.type_)*/1
+  , /*decltype(_impl_.comparison_)*/1} {}
+struct BuiltinDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BuiltinDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BuiltinDefaultTypeInternal() {}
+  union {
+    Builtin _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BuiltinDefaultTypeInternal _Builtin_default_instance_;
+PROTOBUF_CONSTEXPR Reduction::Reduction(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.var1_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.var2_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.base_)*/nullptr
+  , /*decltype(_impl_.body_)*/nullptr} {}
+struct ReductionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReductionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReductionDefaultTypeInternal() {}
+  union {
+    Reduction _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReductionDefaultTypeInternal _Reduction_default_instance_;
+PROTOBUF_CONSTEXPR Mapping::Mapping(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._extensions_)*/{}
+  , /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.arg_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.body_)*/nullptr} {}
+struct MappingDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MappingDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MappingDefaultTypeInternal() {}
+  union {
+    Mapping _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MappingDefaultTypeInternal _Mapping_default_instance_;
+PROTOBUF_CONSTEXPR Predicate::Predicate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.arg_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.body_)*/nullptr} {}
+struct PredicateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PredicateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PredicateDefaultTypeInternal() {}
+  union {
+    Predicate _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PredicateDefaultTypeInternal _Predicate_default_instance_;
+PROTOBUF_CONSTEXPR ReadQuery::ReadQuery(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._extensions_)*/{}
+  , /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.term_)*/nullptr
+  , /*decltype(_impl_.max_chunk_size_)*/int64_t{0}
+  , /*decltype(_impl_.max_age_)*/int64_t{0}} {}
+struct ReadQueryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReadQueryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReadQueryDefaultTypeInternal() {}
+  union {
+    ReadQuery _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReadQueryDefaultTypeInternal _ReadQuery_default_instance_;
+PROTOBUF_CONSTEXPR WriteQuery_Update::WriteQuery_Update(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.view_)*/nullptr
+  , /*decltype(_impl_.mapping_)*/nullptr} {}
+struct WriteQuery_UpdateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteQuery_UpdateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteQuery_UpdateDefaultTypeInternal() {}
+  union {
+    WriteQuery_Update _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteQuery_UpdateDefaultTypeInternal _WriteQuery_Update_default_instance_;
+PROTOBUF_CONSTEXPR WriteQuery_Delete::WriteQuery_Delete(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.view_)*/nullptr} {}
+struct WriteQuery_DeleteDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteQuery_DeleteDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteQuery_DeleteDefaultTypeInternal() {}
+  union {
+    WriteQuery_Delete _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteQuery_DeleteDefaultTypeInternal _WriteQuery_Delete_default_instance_;
+PROTOBUF_CONSTEXPR WriteQuery_Mutate::WriteQuery_Mutate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.view_)*/nullptr
+  , /*decltype(_impl_.mapping_)*/nullptr} {}
+struct WriteQuery_MutateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteQuery_MutateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteQuery_MutateDefaultTypeInternal() {}
+  union {
+    WriteQuery_Mutate _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteQuery_MutateDefaultTypeInternal _WriteQuery_Mutate_default_instance_;
+PROTOBUF_CONSTEXPR WriteQuery_Insert::WriteQuery_Insert(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.terms_)*/{}
+  , /*decltype(_impl_.table_ref_)*/nullptr
+  , /*decltype(_impl_.overwrite_)*/false} {}
+struct WriteQuery_InsertDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteQuery_InsertDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteQuery_InsertDefaultTypeInternal() {}
+  union {
+    WriteQuery_Insert _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteQuery_InsertDefaultTypeInternal _WriteQuery_Insert_default_instance_;
+PROTOBUF_CONSTEXPR WriteQuery_ForEach::WriteQuery_ForEach(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.queries_)*/{}
+  , /*decltype(_impl_.var_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.stream_)*/nullptr} {}
+struct WriteQuery_ForEachDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteQuery_ForEachDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteQuery_ForEachDefaultTypeInternal() {}
+  union {
+    WriteQuery_ForEach _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteQuery_ForEachDefaultTypeInternal _WriteQuery_ForEach_default_instance_;
+PROTOBUF_CONSTEXPR WriteQuery_PointUpdate::WriteQuery_PointUpdate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.attrname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.table_ref_)*/nullptr
+  , /*decltype(_impl_.key_)*/nullptr
+  , /*decltype(_impl_.mapping_)*/nullptr} {}
+struct WriteQuery_PointUpdateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteQuery_PointUpdateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteQuery_PointUpdateDefaultTypeInternal() {}
+  union {
+    WriteQuery_PointUpdate _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteQuery_PointUpdateDefaultTypeInternal _WriteQuery_PointUpdate_default_instance_;
+PROTOBUF_CONSTEXPR WriteQuery_PointDelete::WriteQuery_PointDelete(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.attrname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.table_ref_)*/nullptr
+  , /*decltype(_impl_.key_)*/nullptr} {}
+struct WriteQuery_PointDeleteDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteQuery_PointDeleteDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteQuery_PointDeleteDefaultTypeInternal() {}
+  union {
+    WriteQuery_PointDelete _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteQuery_PointDeleteDefaultTypeInternal _WriteQuery_PointDelete_default_instance_;
+PROTOBUF_CONSTEXPR WriteQuery_PointMutate::WriteQuery_PointMutate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.attrname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.table_ref_)*/nullptr
+  , /*decltype(_impl_.key_)*/nullptr
+  , /*decltype(_impl_.mapping_)*/nullptr} {}
+struct WriteQuery_PointMutateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteQuery_PointMutateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteQuery_PointMutateDefaultTypeInternal() {}
+  union {
+    WriteQuery_PointMutate _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteQuery_PointMutateDefaultTypeInternal _WriteQuery_PointMutate_default_instance_;
+PROTOBUF_CONSTEXPR WriteQuery::WriteQuery(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.update_)*/nullptr
+  , /*decltype(_impl_.delete__)*/nullptr
+  , /*decltype(_impl_.mutate_)*/nullptr
+  , /*decltype(_impl_.insert_)*/nullptr
+  , /*decltype(_impl_.for_each_)*/nullptr
+  , /*decltype(_impl_.point_update_)*/nullptr
+  , /*decltype(_impl_.point_delete_)*/nullptr
+  , /*decltype(_impl_.point_mutate_)*/nullptr
+  , /*decltype(_impl_.type_)*/1
+  , /*decltype(_impl_.atomic_)*/true} {}
+struct WriteQueryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteQueryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteQueryDefaultTypeInternal() {}
+  union {
+    WriteQuery _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteQueryDefaultTypeInternal _WriteQuery_default_instance_;
+PROTOBUF_CONSTEXPR MetaQuery_CreateTable::MetaQuery_CreateTable(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.datacenter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.primary_key_)*/{nullptr, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.table_ref_)*/nullptr
+  , /*decltype(_impl_.cache_size_)*/int64_t{1073741824}} {}
+struct MetaQuery_CreateTableDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetaQuery_CreateTableDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetaQuery_CreateTableDefaultTypeInternal() {}
+  union {
+    MetaQuery_CreateTable _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetaQuery_CreateTableDefaultTypeInternal _MetaQuery_CreateTable_default_instance_;
+PROTOBUF_CONSTEXPR MetaQuery_IndexRef::MetaQuery_IndexRef(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.attrname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.table_ref_)*/nullptr} {}
+struct MetaQuery_IndexRefDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetaQuery_IndexRefDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetaQuery_IndexRefDefaultTypeInternal() {}
+  union {
+    MetaQuery_IndexRef _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetaQuery_IndexRefDefaultTypeInternal _MetaQuery_IndexRef_default_instance_;
+PROTOBUF_CONSTEXPR MetaQuery::MetaQuery(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.db_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.create_table_)*/nullptr
+  , /*decltype(_impl_.drop_table_)*/nullptr
+  , /*decltype(_impl_.create_index_)*/nullptr
+  , /*decltype(_impl_.drop_index_)*/nullptr
+  , /*decltype(_impl_.type_)*/1} {}
+struct MetaQueryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetaQueryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetaQueryDefaultTypeInternal() {}
+  union {
+    MetaQuery _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetaQueryDefaultTypeInternal _MetaQuery_default_instance_;
+PROTOBUF_CONSTEXPR Query::Query(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.read_query_)*/nullptr
+  , /*decltype(_impl_.write_query_)*/nullptr
+  , /*decltype(_impl_.meta_query_)*/nullptr
+  , /*decltype(_impl_.token_)*/int64_t{0}
+  , /*decltype(_impl_.type_)*/1} {}
+struct QueryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR QueryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~QueryDefaultTypeInternal() {}
+  union {
+    Query _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 QueryDefaultTypeInternal _Query_default_instance_;
+PROTOBUF_CONSTEXPR Response_Backtrace::Response_Backtrace(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.frame_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct Response_BacktraceDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Response_BacktraceDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Response_BacktraceDefaultTypeInternal() {}
+  union {
+    Response_Backtrace _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Response_BacktraceDefaultTypeInternal _Response_Backtrace_default_instance_;
+PROTOBUF_CONSTEXPR Response::Response(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.response_)*/{}
+  , /*decltype(_impl_.error_message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.backtrace_)*/nullptr
+  , /*decltype(_impl_.token_)*/int64_t{0}
+  , /*decltype(_impl_.status_code_)*/0} {}
+struct ResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResponseDefaultTypeInternal() {}
+  union {
+    Response _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResponseDefaultTypeInternal _Response_default_instance_;
+static ::_pb::Metadata file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[34];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_rdb_5fprotocol_2fquery_5flanguage_2eproto[7];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_rdb_5fprotocol_2fquery_5flanguage_2eproto = nullptr;
+
+const uint32_t TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::TableRef, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::TableRef, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TableRef, _impl_.db_name_),
+  PROTOBUF_FIELD_OFFSET(::TableRef, _impl_.table_name_),
+  PROTOBUF_FIELD_OFFSET(::TableRef, _impl_.use_outdated_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::VarTermTuple, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::VarTermTuple, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::VarTermTuple, _impl_.var_),
+  PROTOBUF_FIELD_OFFSET(::VarTermTuple, _impl_.term_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::Term_Let, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Term_Let, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Term_Let, _impl_.binds_),
+  PROTOBUF_FIELD_OFFSET(::Term_Let, _impl_.expr_),
+  ~0u,
+  0,
+  PROTOBUF_FIELD_OFFSET(::Term_Call, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Term_Call, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Term_Call, _impl_.builtin_),
+  PROTOBUF_FIELD_OFFSET(::Term_Call, _impl_.args_),
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::Term_If, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Term_If, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Term_If, _impl_.test_),
+  PROTOBUF_FIELD_OFFSET(::Term_If, _impl_.true_branch_),
+  PROTOBUF_FIELD_OFFSET(::Term_If, _impl_.false_branch_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::Term_GetByKey, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Term_GetByKey, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Term_GetByKey, _impl_.table_ref_),
+  PROTOBUF_FIELD_OFFSET(::Term_GetByKey, _impl_.attrname_),
+  PROTOBUF_FIELD_OFFSET(::Term_GetByKey, _impl_.key_),
+  1,
+  0,
+  2,
+  PROTOBUF_FIELD_OFFSET(::Term_Table, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Term_Table, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Term_Table, _impl_.table_ref_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::Term, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Term, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::Term, _impl_._extensions_),
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Term, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::Term, _impl_.var_),
+  PROTOBUF_FIELD_OFFSET(::Term, _impl_.let_),
+  PROTOBUF_FIELD_OFFSET(::Term, _impl_.call_),
+  PROTOBUF_FIELD_OFFSET(::Term, _impl_.if__),
+  PROTOBUF_FIELD_OFFSET(::Term, _impl_.error_),
+  PROTOBUF_FIELD_OFFSET(::Term, _impl_.number_),
+  PROTOBUF_FIELD_OFFSET(::Term, _impl_.valuestring_),
+  PROTOBUF_FIELD_OFFSET(::Term, _impl_.jsonstring_),
+  PROTOBUF_FIELD_OFFSET(::Term, _impl_.valuebool_),
+  PROTOBUF_FIELD_OFFSET(::Term, _impl_.array_),
+  PROTOBUF_FIELD_OFFSET(::Term, _impl_.object_),
+  PROTOBUF_FIELD_OFFSET(::Term, _impl_.get_by_key_),
+  PROTOBUF_FIELD_OFFSET(::Term, _impl_.table_),
+  PROTOBUF_FIELD_OFFSET(::Term, _impl_.javascript_),
+  10,
+  0,
+  5,
+  6,
+  7,
+  1,
+  12,
+  2,
+  3,
+  11,
+  ~0u,
+  ~0u,
+  8,
+  9,
+  4,
+  PROTOBUF_FIELD_OFFSET(::Builtin_Filter, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Builtin_Filter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Builtin_Filter, _impl_.predicate_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::Builtin_Map, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Builtin_Map, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Builtin_Map, _impl_.mapping_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::Builtin_ConcatMap, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Builtin_ConcatMap, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Builtin_ConcatMap, _impl_.mapping_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::Builtin_OrderBy, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Builtin_OrderBy, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Builtin_OrderBy, _impl_.attr_),
+  PROTOBUF_FIELD_OFFSET(::Builtin_OrderBy, _impl_.ascending_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::Builtin_GroupedMapReduce, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Builtin_GroupedMapReduce, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Builtin_GroupedMapReduce, _impl_.group_mapping_),
+  PROTOBUF_FIELD_OFFSET(::Builtin_GroupedMapReduce, _impl_.value_mapping_),
+  PROTOBUF_FIELD_OFFSET(::Builtin_GroupedMapReduce, _impl_.reduction_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::Builtin_Range, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Builtin_Range, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Builtin_Range, _impl_.attrname_),
+  PROTOBUF_FIELD_OFFSET(::Builtin_Range, _impl_.lowerbound_),
+  PROTOBUF_FIELD_OFFSET(::Builtin_Range, _impl_.upperbound_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::Builtin, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Builtin, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Builtin, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::Builtin, _impl_.attr_),
+  PROTOBUF_FIELD_OFFSET(::Builtin, _impl_.attrs_),
+  PROTOBUF_FIELD_OFFSET(::Builtin, _impl_.comparison_),
+  PROTOBUF_FIELD_OFFSET(::Builtin, _impl_.filter_),
+  PROTOBUF_FIELD_OFFSET(::Builtin, _impl_.map_),
+  PROTOBUF_FIELD_OFFSET(::Builtin, _impl_.concat_map_),
+  PROTOBUF_FIELD_OFFSET(::Builtin, _impl_.order_by_),
+  PROTOBUF_FIELD_OFFSET(::Builtin, _impl_.reduce_),
+  PROTOBUF_FIELD_OFFSET(::Builtin, _impl_.grouped_map_reduce_),
+  PROTOBUF_FIELD_OFFSET(::Builtin, _impl_.range_),
+  7,
+  0,
+  ~0u,
+  8,
+  1,
+  2,
+  3,
+  ~0u,
+  4,
+  5,
+  6,
+  PROTOBUF_FIELD_OFFSET(::Reduction, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Reduction, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Reduction, _impl_.base_),
+  PROTOBUF_FIELD_OFFSET(::Reduction, _impl_.var1_),
+  PROTOBUF_FIELD_OFFSET(::Reduction, _impl_.var2_),
+  PROTOBUF_FIELD_OFFSET(::Reduction, _impl_.body_),
+  2,
+  0,
+  1,
+  3,
+  PROTOBUF_FIELD_OFFSET(::Mapping, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Mapping, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::Mapping, _impl_._extensions_),
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Mapping, _impl_.arg_),
+  PROTOBUF_FIELD_OFFSET(::Mapping, _impl_.body_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::Predicate, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Predicate, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Predicate, _impl_.arg_),
+  PROTOBUF_FIELD_OFFSET(::Predicate, _impl_.body_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::ReadQuery, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ReadQuery, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::ReadQuery, _impl_._extensions_),
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ReadQuery, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::ReadQuery, _impl_.max_chunk_size_),
+  PROTOBUF_FIELD_OFFSET(::ReadQuery, _impl_.max_age_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_Update, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_Update, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_Update, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_Update, _impl_.mapping_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_Delete, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_Delete, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_Delete, _impl_.view_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_Mutate, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_Mutate, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_Mutate, _impl_.view_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_Mutate, _impl_.mapping_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_Insert, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_Insert, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_Insert, _impl_.table_ref_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_Insert, _impl_.terms_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_Insert, _impl_.overwrite_),
+  0,
+  ~0u,
+  1,
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_ForEach, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_ForEach, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_ForEach, _impl_.stream_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_ForEach, _impl_.var_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_ForEach, _impl_.queries_),
+  1,
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_PointUpdate, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_PointUpdate, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_PointUpdate, _impl_.table_ref_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_PointUpdate, _impl_.attrname_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_PointUpdate, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_PointUpdate, _impl_.mapping_),
+  1,
+  0,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_PointDelete, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_PointDelete, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_PointDelete, _impl_.table_ref_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_PointDelete, _impl_.attrname_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_PointDelete, _impl_.key_),
+  1,
+  0,
+  2,
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_PointMutate, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_PointMutate, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_PointMutate, _impl_.table_ref_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_PointMutate, _impl_.attrname_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_PointMutate, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery_PointMutate, _impl_.mapping_),
+  1,
+  0,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::WriteQuery, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::WriteQuery, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery, _impl_.atomic_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery, _impl_.update_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery, _impl_.delete__),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery, _impl_.mutate_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery, _impl_.insert_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery, _impl_.for_each_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery, _impl_.point_update_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery, _impl_.point_delete_),
+  PROTOBUF_FIELD_OFFSET(::WriteQuery, _impl_.point_mutate_),
+  8,
+  9,
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  PROTOBUF_FIELD_OFFSET(::MetaQuery_CreateTable, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::MetaQuery_CreateTable, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::MetaQuery_CreateTable, _impl_.datacenter_),
+  PROTOBUF_FIELD_OFFSET(::MetaQuery_CreateTable, _impl_.table_ref_),
+  PROTOBUF_FIELD_OFFSET(::MetaQuery_CreateTable, _impl_.primary_key_),
+  PROTOBUF_FIELD_OFFSET(::MetaQuery_CreateTable, _impl_.cache_size_),
+  0,
+  2,
+  1,
+  3,
+  PROTOBUF_FIELD_OFFSET(::MetaQuery_IndexRef, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::MetaQuery_IndexRef, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::MetaQuery_IndexRef, _impl_.table_ref_),
+  PROTOBUF_FIELD_OFFSET(::MetaQuery_IndexRef, _impl_.attrname_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::MetaQuery, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::MetaQuery, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::MetaQuery, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::MetaQuery, _impl_.db_name_),
+  PROTOBUF_FIELD_OFFSET(::MetaQuery, _impl_.create_table_),
+  PROTOBUF_FIELD_OFFSET(::MetaQuery, _impl_.drop_table_),
+  PROTOBUF_FIELD_OFFSET(::MetaQuery, _impl_.create_index_),
+  PROTOBUF_FIELD_OFFSET(::MetaQuery, _impl_.drop_index_),
+  5,
+  0,
+  1,
+  2,
+  3,
+  4,
+  PROTOBUF_FIELD_OFFSET(::Query, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Query, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Query, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::Query, _impl_.token_),
+  PROTOBUF_FIELD_OFFSET(::Query, _impl_.read_query_),
+  PROTOBUF_FIELD_OFFSET(::Query, _impl_.write_query_),
+  PROTOBUF_FIELD_OFFSET(::Query, _impl_.meta_query_),
+  4,
+  3,
+  0,
+  1,
+  2,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Response_Backtrace, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Response_Backtrace, _impl_.frame_),
+  PROTOBUF_FIELD_OFFSET(::Response, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Response, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Response, _impl_.status_code_),
+  PROTOBUF_FIELD_OFFSET(::Response, _impl_.token_),
+  PROTOBUF_FIELD_OFFSET(::Response, _impl_.response_),
+  PROTOBUF_FIELD_OFFSET(::Response, _impl_.error_message_),
+  PROTOBUF_FIELD_OFFSET(::Response, _impl_.backtrace_),
+  3,
+  2,
+  ~0u,
+  0,
+  1,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 9, -1, sizeof(::TableRef)},
+  { 12, 20, -1, sizeof(::VarTermTuple)},
+  { 22, 30, -1, sizeof(::Term_Let)},
+  { 32, 40, -1, sizeof(::Term_Call)},
+  { 42, 51, -1, sizeof(::Term_If)},
+  { 54, 63, -1, sizeof(::Term_GetByKey)},
+  { 66, 73, -1, sizeof(::Term_Table)},
+  { 74, 95, -1, sizeof(::Term)},
+  { 110, 117, -1, sizeof(::Builtin_Filter)},
+  { 118, 125, -1, sizeof(::Builtin_Map)},
+  { 126, 133, -1, sizeof(::Builtin_ConcatMap)},
+  { 134, 142, -1, sizeof(::Builtin_OrderBy)},
+  { 144, 153, -1, sizeof(::Builtin_GroupedMapReduce)},
+  { 156, 165, -1, sizeof(::Builtin_Range)},
+  { 168, 185, -1, sizeof(::Builtin)},
+  { 196, 206, -1, sizeof(::Reduction)},
+  { 210, 218, -1, sizeof(::Mapping)},
+  { 220, 228, -1, sizeof(::Predicate)},
+  { 230, 239, -1, sizeof(::ReadQuery)},
+  { 242, 250, -1, sizeof(::WriteQuery_Update)},
+  { 252, 259, -1, sizeof(::WriteQuery_Delete)},
+  { 260, 268, -1, sizeof(::WriteQuery_Mutate)},
+  { 270, 279, -1, sizeof(::WriteQuery_Insert)},
+  { 282, 291, -1, sizeof(::WriteQuery_ForEach)},
+  { 294, 304, -1, sizeof(::WriteQuery_PointUpdate)},
+  { 308, 317, -1, sizeof(::WriteQuery_PointDelete)},
+  { 320, 330, -1, sizeof(::WriteQuery_PointMutate)},
+  { 334, 350, -1, sizeof(::WriteQuery)},
+  { 360, 370, -1, sizeof(::MetaQuery_CreateTable)},
+  { 374, 382, -1, sizeof(::MetaQuery_IndexRef)},
+  { 384, 396, -1, sizeof(::MetaQuery)},
+  { 402, 413, -1, sizeof(::Query)},
+  { 418, -1, -1, sizeof(::Response_Backtrace)},
+  { 425, 436, -1, sizeof(::Response)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::_TableRef_default_instance_._instance,
+  &::_VarTermTuple_default_instance_._instance,
+  &::_Term_Let_default_instance_._instance,
+  &::_Term_Call_default_instance_._instance,
+  &::_Term_If_default_instance_._instance,
+  &::_Term_GetByKey_default_instance_._instance,
+  &::_Term_Table_default_instance_._instance,
+  &::_Term_default_instance_._instance,
+  &::_Builtin_Filter_default_instance_._instance,
+  &::_Builtin_Map_default_instance_._instance,
+  &::_Builtin_ConcatMap_default_instance_._instance,
+  &::_Builtin_OrderBy_default_instance_._instance,
+  &::_Builtin_GroupedMapReduce_default_instance_._instance,
+  &::_Builtin_Range_default_instance_._instance,
+  &::_Builtin_default_instance_._instance,
+  &::_Reduction_default_instance_._instance,
+  &::_Mapping_default_instance_._instance,
+  &::_Predicate_default_instance_._instance,
+  &::_ReadQuery_default_instance_._instance,
+  &::_WriteQuery_Update_default_instance_._instance,
+  &::_WriteQuery_Delete_default_instance_._instance,
+  &::_WriteQuery_Mutate_default_instance_._instance,
+  &::_WriteQuery_Insert_default_instance_._instance,
+  &::_WriteQuery_ForEach_default_instance_._instance,
+  &::_WriteQuery_PointUpdate_default_instance_._instance,
+  &::_WriteQuery_PointDelete_default_instance_._instance,
+  &::_WriteQuery_PointMutate_default_instance_._instance,
+  &::_WriteQuery_default_instance_._instance,
+  &::_MetaQuery_CreateTable_default_instance_._instance,
+  &::_MetaQuery_IndexRef_default_instance_._instance,
+  &::_MetaQuery_default_instance_._instance,
+  &::_Query_default_instance_._instance,
+  &::_Response_Backtrace_default_instance_._instance,
+  &::_Response_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_rdb_5fprotocol_2fquery_5flanguage_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n!rdb_protocol/query_language.proto\"L\n\010T"
+  "ableRef\022\017\n\007db_name\030\001 \002(\t\022\022\n\ntable_name\030\002"
+  " \002(\t\022\033\n\014use_outdated\030\003 \001(\010:\005false\"0\n\014Var"
+  "TermTuple\022\013\n\003var\030\001 \002(\t\022\023\n\004term\030\002 \002(\0132\005.T"
+  "erm\"\354\006\n\004Term\022\034\n\004type\030\001 \002(\0162\016.Term.TermTy"
+  "pe\022\013\n\003var\030\002 \001(\t\022\026\n\003let\030\003 \001(\0132\t.Term.Let\022"
+  "\030\n\004call\030\004 \001(\0132\n.Term.Call\022\025\n\003if_\030\005 \001(\0132\010"
+  ".Term.If\022\r\n\005error\030\006 \001(\t\022\016\n\006number\030\007 \001(\001\022"
+  "\023\n\013valuestring\030\010 \001(\t\022\022\n\njsonstring\030\t \001(\t"
+  "\022\021\n\tvaluebool\030\n \001(\010\022\024\n\005array\030\013 \003(\0132\005.Ter"
+  "m\022\035\n\006object\030\014 \003(\0132\r.VarTermTuple\022\"\n\nget_"
+  "by_key\030\016 \001(\0132\016.Term.GetByKey\022\032\n\005table\030\017 "
+  "\001(\0132\013.Term.Table\022\022\n\njavascript\030\020 \001(\t\0328\n\003"
+  "Let\022\034\n\005binds\030\001 \003(\0132\r.VarTermTuple\022\023\n\004exp"
+  "r\030\002 \002(\0132\005.Term\0326\n\004Call\022\031\n\007builtin\030\001 \002(\0132"
+  "\010.Builtin\022\023\n\004args\030\002 \003(\0132\005.Term\032R\n\002If\022\023\n\004"
+  "test\030\001 \002(\0132\005.Term\022\032\n\013true_branch\030\002 \002(\0132\005"
+  ".Term\022\033\n\014false_branch\030\003 \002(\0132\005.Term\032N\n\010Ge"
+  "tByKey\022\034\n\ttable_ref\030\001 \002(\0132\t.TableRef\022\020\n\010"
+  "attrname\030\002 \002(\t\022\022\n\003key\030\003 \002(\0132\005.Term\032%\n\005Ta"
+  "ble\022\034\n\ttable_ref\030\001 \002(\0132\t.TableRef\"\306\001\n\010Te"
+  "rmType\022\r\n\tJSON_NULL\020\000\022\007\n\003VAR\020\001\022\007\n\003LET\020\002\022"
+  "\010\n\004CALL\020\003\022\006\n\002IF\020\004\022\t\n\005ERROR\020\005\022\n\n\006NUMBER\020\006"
+  "\022\n\n\006STRING\020\007\022\010\n\004JSON\020\010\022\010\n\004BOOL\020\t\022\t\n\005ARRA"
+  "Y\020\n\022\n\n\006OBJECT\020\013\022\014\n\010GETBYKEY\020\014\022\t\n\005TABLE\020\r"
+  "\022\016\n\nJAVASCRIPT\020\016\022\020\n\014IMPLICIT_VAR\020\017*\006\010\350\007\020"
+  "\314\010\"\367\t\n\007Builtin\022\"\n\004type\030\001 \002(\0162\024.Builtin.B"
+  "uiltinType\022\014\n\004attr\030\002 \001(\t\022\r\n\005attrs\030\003 \003(\t\022"
+  "\'\n\ncomparison\030\004 \001(\0162\023.Builtin.Comparison"
+  "\022\037\n\006filter\030\005 \001(\0132\017.Builtin.Filter\022\031\n\003map"
+  "\030\006 \001(\0132\014.Builtin.Map\022&\n\nconcat_map\030\007 \001(\013"
+  "2\022.Builtin.ConcatMap\022\"\n\010order_by\030\010 \003(\0132\020"
+  ".Builtin.OrderBy\022\032\n\006reduce\030\t \001(\0132\n.Reduc"
+  "tion\0225\n\022grouped_map_reduce\030\n \001(\0132\031.Built"
+  "in.GroupedMapReduce\022\035\n\005range\030\013 \001(\0132\016.Bui"
+  "ltin.Range\032\'\n\006Filter\022\035\n\tpredicate\030\001 \002(\0132"
+  "\n.Predicate\032 \n\003Map\022\031\n\007mapping\030\001 \002(\0132\010.Ma"
+  "pping\032&\n\tConcatMap\022\031\n\007mapping\030\001 \002(\0132\010.Ma"
+  "pping\0320\n\007OrderBy\022\014\n\004attr\030\001 \002(\t\022\027\n\tascend"
+  "ing\030\002 \001(\010:\004true\032s\n\020GroupedMapReduce\022\037\n\rg"
+  "roup_mapping\030\001 \002(\0132\010.Mapping\022\037\n\rvalue_ma"
+  "pping\030\002 \002(\0132\010.Mapping\022\035\n\treduction\030\003 \002(\013"
+  "2\n.Reduction\032O\n\005Range\022\020\n\010attrname\030\001 \002(\t\022"
+  "\031\n\nlowerbound\030\002 \001(\0132\005.Term\022\031\n\nupperbound"
+  "\030\003 \001(\0132\005.Term\"\336\003\n\013BuiltinType\022\007\n\003NOT\020\001\022\013"
+  "\n\007GETATTR\020\002\022\024\n\020IMPLICIT_GETATTR\020\003\022\013\n\007HAS"
+  "ATTR\020\004\022\024\n\020IMPLICIT_HASATTR\020\005\022\r\n\tPICKATTR"
+  "S\020\006\022\026\n\022IMPLICIT_PICKATTRS\020\007\022\014\n\010MAPMERGE\020"
+  "\010\022\017\n\013ARRAYAPPEND\020\t\022\t\n\005SLICE\020\013\022\007\n\003ADD\020\016\022\014"
+  "\n\010SUBTRACT\020\017\022\014\n\010MULTIPLY\020\020\022\n\n\006DIVIDE\020\021\022\n"
+  "\n\006MODULO\020\022\022\013\n\007COMPARE\020\023\022\n\n\006FILTER\020\024\022\007\n\003M"
+  "AP\020\025\022\r\n\tCONCATMAP\020\026\022\013\n\007ORDERBY\020\027\022\014\n\010DIST"
+  "INCT\020\030\022\n\n\006LENGTH\020\032\022\t\n\005UNION\020\033\022\007\n\003NTH\020\034\022\021"
+  "\n\rSTREAMTOARRAY\020\035\022\021\n\rARRAYTOSTREAM\020\036\022\n\n\006"
+  "REDUCE\020\037\022\024\n\020GROUPEDMAPREDUCE\020 \022\007\n\003ANY\020#\022"
+  "\007\n\003ALL\020$\022\t\n\005RANGE\020%\022\024\n\020IMPLICIT_WITHOUT\020"
+  "&\022\013\n\007WITHOUT\020\'\"<\n\nComparison\022\006\n\002EQ\020\001\022\006\n\002"
+  "NE\020\002\022\006\n\002LT\020\003\022\006\n\002LE\020\004\022\006\n\002GT\020\005\022\006\n\002GE\020\006\"Q\n\t"
+  "Reduction\022\023\n\004base\030\001 \002(\0132\005.Term\022\014\n\004var1\030\002"
+  " \002(\t\022\014\n\004var2\030\003 \002(\t\022\023\n\004body\030\004 \002(\0132\005.Term\""
+  "3\n\007Mapping\022\013\n\003arg\030\001 \002(\t\022\023\n\004body\030\002 \002(\0132\005."
+  "Term*\006\010\350\007\020\314\010\"-\n\tPredicate\022\013\n\003arg\030\001 \002(\t\022\023"
+  "\n\004body\030\002 \002(\0132\005.Term\"Q\n\tReadQuery\022\023\n\004term"
+  "\030\001 \002(\0132\005.Term\022\026\n\016max_chunk_size\030\002 \001(\003\022\017\n"
+  "\007max_age\030\003 \001(\003*\006\010\350\007\020\314\010\"\372\010\n\nWriteQuery\022(\n"
+  "\004type\030\001 \002(\0162\032.WriteQuery.WriteQueryType\022"
+  "\024\n\006atomic\030\013 \001(\010:\004true\022\"\n\006update\030\002 \001(\0132\022."
+  "WriteQuery.Update\022\"\n\006delete\030\003 \001(\0132\022.Writ"
+  "eQuery.Delete\022\"\n\006mutate\030\004 \001(\0132\022.WriteQue"
+  "ry.Mutate\022\"\n\006insert\030\005 \001(\0132\022.WriteQuery.I"
+  "nsert\022%\n\010for_each\030\007 \001(\0132\023.WriteQuery.For"
+  "Each\022-\n\014point_update\030\010 \001(\0132\027.WriteQuery."
+  "PointUpdate\022-\n\014point_delete\030\t \001(\0132\027.Writ"
+  "eQuery.PointDelete\022-\n\014point_mutate\030\n \001(\013"
+  "2\027.WriteQuery.PointMutate\0328\n\006Update\022\023\n\004v"
+  "iew\030\001 \002(\0132\005.Term\022\031\n\007mapping\030\002 \002(\0132\010.Mapp"
+  "ing\032\035\n\006Delete\022\023\n\004view\030\001 \002(\0132\005.Term\0328\n\006Mu"
+  "tate\022\023\n\004view\030\001 \002(\0132\005.Term\022\031\n\007mapping\030\002 \002"
+  "(\0132\010.Mapping\032V\n\006Insert\022\034\n\ttable_ref\030\001 \002("
+  "\0132\t.TableRef\022\024\n\005terms\030\002 \003(\0132\005.Term\022\030\n\tov"
+  "erwrite\030\003 \001(\010:\005false\032K\n\007ForEach\022\025\n\006strea"
+  "m\030\001 \002(\0132\005.Term\022\013\n\003var\030\002 \002(\t\022\034\n\007queries\030\003"
+  " \003(\0132\013.WriteQuery\032l\n\013PointUpdate\022\034\n\ttabl"
+  "e_ref\030\001 \002(\0132\t.TableRef\022\020\n\010attrname\030\002 \002(\t"
+  "\022\022\n\003key\030\003 \002(\0132\005.Term\022\031\n\007mapping\030\004 \002(\0132\010."
+  "Mapping\032Q\n\013PointDelete\022\034\n\ttable_ref\030\001 \002("
+  "\0132\t.TableRef\022\020\n\010attrname\030\002 \002(\t\022\022\n\003key\030\003 "
+  "\002(\0132\005.Term\032l\n\013PointMutate\022\034\n\ttable_ref\030\001"
+  " \002(\0132\t.TableRef\022\020\n\010attrname\030\002 \002(\t\022\022\n\003key"
+  "\030\003 \002(\0132\005.Term\022\031\n\007mapping\030\004 \002(\0132\010.Mapping"
+  "\"\200\001\n\016WriteQueryType\022\n\n\006UPDATE\020\001\022\n\n\006DELET"
+  "E\020\002\022\n\n\006MUTATE\020\003\022\n\n\006INSERT\020\004\022\013\n\007FOREACH\020\006"
+  "\022\017\n\013POINTUPDATE\020\007\022\017\n\013POINTDELETE\020\010\022\017\n\013PO"
+  "INTMUTATE\020\t\"\254\004\n\tMetaQuery\022&\n\004type\030\001 \002(\0162"
+  "\030.MetaQuery.MetaQueryType\022\017\n\007db_name\030\002 \001"
+  "(\t\022,\n\014create_table\030\003 \001(\0132\026.MetaQuery.Cre"
+  "ateTable\022\035\n\ndrop_table\030\004 \001(\0132\t.TableRef\022"
+  ")\n\014create_index\030\005 \001(\0132\023.MetaQuery.IndexR"
+  "ef\022\'\n\ndrop_index\030\006 \001(\0132\023.MetaQuery.Index"
+  "Ref\032x\n\013CreateTable\022\022\n\ndatacenter\030\001 \001(\t\022\034"
+  "\n\ttable_ref\030\003 \002(\0132\t.TableRef\022\027\n\013primary_"
+  "key\030\004 \001(\t:\002id\022\036\n\ncache_size\030\005 \001(\003:\n10737"
+  "41824\032:\n\010IndexRef\022\034\n\ttable_ref\030\001 \002(\0132\t.T"
+  "ableRef\022\020\n\010attrname\030\002 \002(\t\"\216\001\n\rMetaQueryT"
+  "ype\022\r\n\tCREATE_DB\020\001\022\013\n\007DROP_DB\020\002\022\014\n\010LIST_"
+  "DBS\020\003\022\020\n\014CREATE_TABLE\020\004\022\016\n\nDROP_TABLE\020\005\022"
+  "\017\n\013LIST_TABLES\020\006\022\020\n\014CREATE_INDEX\020\007\022\016\n\nDR"
+  "OP_INDEX\020\010\"\334\001\n\005Query\022\036\n\004type\030\001 \002(\0162\020.Que"
+  "ry.QueryType\022\r\n\005token\030\002 \002(\003\022\036\n\nread_quer"
+  "y\030\003 \001(\0132\n.ReadQuery\022 \n\013write_query\030\004 \001(\013"
+  "2\013.WriteQuery\022\036\n\nmeta_query\030\005 \001(\0132\n.Meta"
+  "Query\"B\n\tQueryType\022\010\n\004READ\020\001\022\t\n\005WRITE\020\002\022"
+  "\014\n\010CONTINUE\020\003\022\010\n\004STOP\020\004\022\010\n\004META\020\005\"\303\002\n\010Re"
+  "sponse\022)\n\013status_code\030\001 \002(\0162\024.Response.S"
+  "tatusCode\022\r\n\005token\030\002 \002(\003\022\020\n\010response\030\003 \003"
+  "(\t\022\025\n\rerror_message\030\004 \001(\t\022&\n\tbacktrace\030\005"
+  " \001(\0132\023.Response.Backtrace\032\032\n\tBacktrace\022\r"
+  "\n\005frame\030\001 \003(\t\"\217\001\n\nStatusCode\022\021\n\rSUCCESS_"
+  "EMPTY\020\000\022\020\n\014SUCCESS_JSON\020\001\022\023\n\017SUCCESS_PAR"
+  "TIAL\020\002\022\022\n\016SUCCESS_STREAM\020\003\022\021\n\rBROKEN_CLI"
+  "ENT\020e\022\r\n\tBAD_QUERY\020f\022\021\n\rRUNTIME_ERROR\020g"
+  ;
+static ::_pbi::once_flag descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto = {
+    false, false, 4839, descriptor_table_protodef_rdb_5fprotocol_2fquery_5flanguage_2eproto,
+    "rdb_protocol/query_language.proto",
+    &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once, nullptr, 0, 34,
+    schemas, file_default_instances, TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto::offsets,
+    file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto, file_level_enum_descriptors_rdb_5fprotocol_2fquery_5flanguage_2eproto,
+    file_level_service_descriptors_rdb_5fprotocol_2fquery_5flanguage_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter() {
+  return &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_rdb_5fprotocol_2fquery_5flanguage_2eproto(&descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto);
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Term_TermType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto);
+  return file_level_enum_descriptors_rdb_5fprotocol_2fquery_5flanguage_2eproto[0];
+}
+bool Term_TermType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+    case 15:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Term_TermType Term::JSON_NULL;
+constexpr Term_TermType Term::VAR;
+constexpr Term_TermType Term::LET;
+constexpr Term_TermType Term::CALL;
+constexpr Term_TermType Term::IF;
+constexpr Term_TermType Term::ERROR;
+constexpr Term_TermType Term::NUMBER;
+constexpr Term_TermType Term::STRING;
+constexpr Term_TermType Term::JSON;
+constexpr Term_TermType Term::BOOL;
+constexpr Term_TermType Term::ARRAY;
+constexpr Term_TermType Term::OBJECT;
+constexpr Term_TermType Term::GETBYKEY;
+constexpr Term_TermType Term::TABLE;
+constexpr Term_TermType Term::JAVASCRIPT;
+constexpr Term_TermType Term::IMPLICIT_VAR;
+constexpr Term_TermType Term::TermType_MIN;
+constexpr Term_TermType Term::TermType_MAX;
+constexpr int Term::TermType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Builtin_BuiltinType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto);
+  return file_level_enum_descriptors_rdb_5fprotocol_2fquery_5flanguage_2eproto[1];
+}
+bool Builtin_BuiltinType_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 11:
+    case 14:
+    case 15:
+    case 16:
+    case 17:
+    case 18:
+    case 19:
+    case 20:
+    case 21:
+    case 22:
+    case 23:
+    case 24:
+    case 26:
+    case 27:
+    case 28:
+    case 29:
+    case 30:
+    case 31:
+    case 32:
+    case 35:
+    case 36:
+    case 37:
+    case 38:
+    case 39:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Builtin_BuiltinType Builtin::NOT;
+constexpr Builtin_BuiltinType Builtin::GETATTR;
+constexpr Builtin_BuiltinType Builtin::IMPLICIT_GETATTR;
+constexpr Builtin_BuiltinType Builtin::HASATTR;
+constexpr Builtin_BuiltinType Builtin::IMPLICIT_HASATTR;
+constexpr Builtin_BuiltinType Builtin::PICKATTRS;
+constexpr Builtin_BuiltinType Builtin::IMPLICIT_PICKATTRS;
+constexpr Builtin_BuiltinType Builtin::MAPMERGE;
+constexpr Builtin_BuiltinType Builtin::ARRAYAPPEND;
+constexpr Builtin_BuiltinType Builtin::SLICE;
+constexpr Builtin_BuiltinType Builtin::ADD;
+constexpr Builtin_BuiltinType Builtin::SUBTRACT;
+constexpr Builtin_BuiltinType Builtin::MULTIPLY;
+constexpr Builtin_BuiltinType Builtin::DIVIDE;
+constexpr Builtin_BuiltinType Builtin::MODULO;
+constexpr Builtin_BuiltinType Builtin::COMPARE;
+constexpr Builtin_BuiltinType Builtin::FILTER;
+constexpr Builtin_BuiltinType Builtin::MAP;
+constexpr Builtin_BuiltinType Builtin::CONCATMAP;
+constexpr Builtin_BuiltinType Builtin::ORDERBY;
+constexpr Builtin_BuiltinType Builtin::DISTINCT;
+constexpr Builtin_BuiltinType Builtin::LENGTH;
+constexpr Builtin_BuiltinType Builtin::UNION;
+constexpr Builtin_BuiltinType Builtin::NTH;
+constexpr Builtin_BuiltinType Builtin::STREAMTOARRAY;
+constexpr Builtin_BuiltinType Builtin::ARRAYTOSTREAM;
+constexpr Builtin_BuiltinType Builtin::REDUCE;
+constexpr Builtin_BuiltinType Builtin::GROUPEDMAPREDUCE;
+constexpr Builtin_BuiltinType Builtin::ANY;
+constexpr Builtin_BuiltinType Builtin::ALL;
+constexpr Builtin_BuiltinType Builtin::RANGE;
+constexpr Builtin_BuiltinType Builtin::IMPLICIT_WITHOUT;
+constexpr Builtin_BuiltinType Builtin::WITHOUT;
+constexpr Builtin_BuiltinType Builtin::BuiltinType_MIN;
+constexpr Builtin_BuiltinType Builtin::BuiltinType_MAX;
+constexpr int Builtin::BuiltinType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Builtin_Comparison_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto);
+  return file_level_enum_descriptors_rdb_5fprotocol_2fquery_5flanguage_2eproto[2];
+}
+bool Builtin_Comparison_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Builtin_Comparison Builtin::EQ;
+constexpr Builtin_Comparison Builtin::NE;
+constexpr Builtin_Comparison Builtin::LT;
+constexpr Builtin_Comparison Builtin::LE;
+constexpr Builtin_Comparison Builtin::GT;
+constexpr Builtin_Comparison Builtin::GE;
+constexpr Builtin_Comparison Builtin::Comparison_MIN;
+constexpr Builtin_Comparison Builtin::Comparison_MAX;
+constexpr int Builtin::Comparison_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* WriteQuery_WriteQueryType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto);
+  return file_level_enum_descriptors_rdb_5fprotocol_2fquery_5flanguage_2eproto[3];
+}
+bool WriteQuery_WriteQueryType_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr WriteQuery_WriteQueryType WriteQuery::UPDATE;
+constexpr WriteQuery_WriteQueryType WriteQuery::DELETE;
+constexpr WriteQuery_WriteQueryType WriteQuery::MUTATE;
+constexpr WriteQuery_WriteQueryType WriteQuery::INSERT;
+constexpr WriteQuery_WriteQueryType WriteQuery::FOREACH;
+constexpr WriteQuery_WriteQueryType WriteQuery::POINTUPDATE;
+constexpr WriteQuery_WriteQueryType WriteQuery::POINTDELETE;
+constexpr WriteQuery_WriteQueryType WriteQuery::POINTMUTATE;
+constexpr WriteQuery_WriteQueryType WriteQuery::WriteQueryType_MIN;
+constexpr WriteQuery_WriteQueryType WriteQuery::WriteQueryType_MAX;
+constexpr int WriteQuery::WriteQueryType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MetaQuery_MetaQueryType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto);
+  return file_level_enum_descriptors_rdb_5fprotocol_2fquery_5flanguage_2eproto[4];
+}
+bool MetaQuery_MetaQueryType_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr MetaQuery_MetaQueryType MetaQuery::CREATE_DB;
+constexpr MetaQuery_MetaQueryType MetaQuery::DROP_DB;
+constexpr MetaQuery_MetaQueryType MetaQuery::LIST_DBS;
+constexpr MetaQuery_MetaQueryType MetaQuery::CREATE_TABLE;
+constexpr MetaQuery_MetaQueryType MetaQuery::DROP_TABLE;
+constexpr MetaQuery_MetaQueryType MetaQuery::LIST_TABLES;
+constexpr MetaQuery_MetaQueryType MetaQuery::CREATE_INDEX;
+constexpr MetaQuery_MetaQueryType MetaQuery::DROP_INDEX;
+constexpr MetaQuery_MetaQueryType MetaQuery::MetaQueryType_MIN;
+constexpr MetaQuery_MetaQueryType MetaQuery::MetaQueryType_MAX;
+constexpr int MetaQuery::MetaQueryType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Query_QueryType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto);
+  return file_level_enum_descriptors_rdb_5fprotocol_2fquery_5flanguage_2eproto[5];
+}
+bool Query_QueryType_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Query_QueryType Query::READ;
+constexpr Query_QueryType Query::WRITE;
+constexpr Query_QueryType Query::CONTINUE;
+constexpr Query_QueryType Query::STOP;
+constexpr Query_QueryType Query::META;
+constexpr Query_QueryType Query::QueryType_MIN;
+constexpr Query_QueryType Query::QueryType_MAX;
+constexpr int Query::QueryType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Response_StatusCode_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto);
+  return file_level_enum_descriptors_rdb_5fprotocol_2fquery_5flanguage_2eproto[6];
+}
+bool Response_StatusCode_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 101:
+    case 102:
+    case 103:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Response_StatusCode Response::SUCCESS_EMPTY;
+constexpr Response_StatusCode Response::SUCCESS_JSON;
+constexpr Response_StatusCode Response::SUCCESS_PARTIAL;
+constexpr Response_StatusCode Response::SUCCESS_STREAM;
+constexpr Response_StatusCode Response::BROKEN_CLIENT;
+constexpr Response_StatusCode Response::BAD_QUERY;
+constexpr Response_StatusCode Response::RUNTIME_ERROR;
+constexpr Response_StatusCode Response::StatusCode_MIN;
+constexpr Response_StatusCode Response::StatusCode_MAX;
+constexpr int Response::StatusCode_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class TableRef::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TableRef>()._impl_._has_bits_);
+  static void set_has_db_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_table_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_use_outdated(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+TableRef::TableRef(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:TableRef)
+}
+TableRef::TableRef(const TableRef& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TableRef* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.db_name_){}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.use_outdated_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.db_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.db_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_db_name()) {
+    _this->_impl_.db_name_.Set(from._internal_db_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_table_name()) {
+    _this->_impl_.table_name_.Set(from._internal_table_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.use_outdated_ = from._impl_.use_outdated_;
+  // @@protoc_insertion_point(copy_constructor:TableRef)
+}
+
+inline void TableRef::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.db_name_){}
+    , decltype(_impl_.table_name_){}
+    , decltype(_impl_.use_outdated_){false}
+  };
+  _impl_.db_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.db_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.table_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TableRef::~TableRef() {
+  // @@protoc_insertion_point(destructor:TableRef)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TableRef::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.db_name_.Destroy();
+  _impl_.table_name_.Destroy();
+}
+
+void TableRef::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TableRef::Clear() {
+// @@protoc_insertion_point(message_clear_start:TableRef)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.db_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.table_name_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_.use_outdated_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TableRef::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string db_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_db_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "TableRef.db_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string table_name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_table_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "TableRef.table_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool use_outdated = 3 [default = false];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_use_outdated(&has_bits);
+          _impl_.use_outdated_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TableRef::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:TableRef)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string db_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_db_name().data(), static_cast<int>(this->_internal_db_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "TableRef.db_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_db_name(), target);
+  }
+
+  // required string table_name = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_table_name().data(), static_cast<int>(this->_internal_table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "TableRef.table_name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_table_name(), target);
+  }
+
+  // optional bool use_outdated = 3 [default = false];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_use_outdated(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:TableRef)
+  return target;
+}
+
+size_t TableRef::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:TableRef)
+  size_t total_size = 0;
+
+  if (_internal_has_db_name()) {
+    // required string db_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_db_name());
+  }
+
+  if (_internal_has_table_name()) {
+    // required string table_name = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
+  }
+
+  return total_size;
+}
+size_t TableRef::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:TableRef)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string db_name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_db_name());
+
+    // required string table_name = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_table_name());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional bool use_outdated = 3 [default = false];
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000004u) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TableRef::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TableRef::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TableRef::GetClassData() const { return &_class_data_; }
+
+
+void TableRef::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TableRef*>(&to_msg);
+  auto& from = static_cast<const TableRef&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TableRef)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_db_name(from._internal_db_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_table_name(from._internal_table_name());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.use_outdated_ = from._impl_.use_outdated_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TableRef::CopyFrom(const TableRef& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:TableRef)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TableRef::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void TableRef::InternalSwap(TableRef* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.db_name_, lhs_arena,
+      &other->_impl_.db_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.table_name_, lhs_arena,
+      &other->_impl_.table_name_, rhs_arena
+  );
+  swap(_impl_.use_outdated_, other->_impl_.use_outdated_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TableRef::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[0]);
+}
+
+// ===================================================================
+
+class VarTermTuple::_Internal {
+ public:
+  using HasBits = decltype(std::declval<VarTermTuple>()._impl_._has_bits_);
+  static void set_has_var(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::Term& term(const VarTermTuple* msg);
+  static void set_has_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+const ::Term&
+VarTermTuple::_Internal::term(const VarTermTuple* msg) {
+  return *msg->_impl_.term_;
+}
+VarTermTuple::VarTermTuple(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:VarTermTuple)
+}
+VarTermTuple::VarTermTuple(const VarTermTuple& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  VarTermTuple* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.var_){}
+    , decltype(_impl_.term_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.var_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.var_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_var()) {
+    _this->_impl_.var_.Set(from._internal_var(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_term()) {
+    _this->_impl_.term_ = new ::Term(*from._impl_.term_);
+  }
+  // @@protoc_insertion_point(copy_constructor:VarTermTuple)
+}
+
+inline void VarTermTuple::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.var_){}
+    , decltype(_impl_.term_){nullptr}
+  };
+  _impl_.var_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.var_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+VarTermTuple::~VarTermTuple() {
+  // @@protoc_insertion_point(destructor:VarTermTuple)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void VarTermTuple::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.var_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.term_;
+}
+
+void VarTermTuple::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void VarTermTuple::Clear() {
+// @@protoc_insertion_point(message_clear_start:VarTermTuple)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.var_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.term_ != nullptr);
+      _impl_.term_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* VarTermTuple::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string var = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_var();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "VarTermTuple.var");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required .Term term = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_term(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* VarTermTuple::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:VarTermTuple)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string var = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_var().data(), static_cast<int>(this->_internal_var().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "VarTermTuple.var");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_var(), target);
+  }
+
+  // required .Term term = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::term(this),
+        _Internal::term(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:VarTermTuple)
+  return target;
+}
+
+size_t VarTermTuple::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:VarTermTuple)
+  size_t total_size = 0;
+
+  if (_internal_has_var()) {
+    // required string var = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_var());
+  }
+
+  if (_internal_has_term()) {
+    // required .Term term = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.term_);
+  }
+
+  return total_size;
+}
+size_t VarTermTuple::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:VarTermTuple)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string var = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_var());
+
+    // required .Term term = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.term_);
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData VarTermTuple::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    VarTermTuple::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*VarTermTuple::GetClassData() const { return &_class_data_; }
+
+
+void VarTermTuple::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<VarTermTuple*>(&to_msg);
+  auto& from = static_cast<const VarTermTuple&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:VarTermTuple)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_var(from._internal_var());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_term()->::Term::MergeFrom(
+          from._internal_term());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void VarTermTuple::CopyFrom(const VarTermTuple& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:VarTermTuple)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool VarTermTuple::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_term()) {
+    if (!_impl_.term_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void VarTermTuple::InternalSwap(VarTermTuple* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.var_, lhs_arena,
+      &other->_impl_.var_, rhs_arena
+  );
+  swap(_impl_.term_, other->_impl_.term_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata VarTermTuple::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[1]);
+}
+
+// ===================================================================
+
+class Term_Let::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Term_Let>()._impl_._has_bits_);
+  static const ::Term& expr(const Term_Let* msg);
+  static void set_has_expr(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::Term&
+Term_Let::_Internal::expr(const Term_Let* msg) {
+  return *msg->_impl_.expr_;
+}
+Term_Let::Term_Let(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Term.Let)
+}
+Term_Let::Term_Let(const Term_Let& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Term_Let* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.binds_){from._impl_.binds_}
+    , decltype(_impl_.expr_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_expr()) {
+    _this->_impl_.expr_ = new ::Term(*from._impl_.expr_);
+  }
+  // @@protoc_insertion_point(copy_constructor:Term.Let)
+}
+
+inline void Term_Let::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.binds_){arena}
+    , decltype(_impl_.expr_){nullptr}
+  };
+}
+
+Term_Let::~Term_Let() {
+  // @@protoc_insertion_point(destructor:Term.Let)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Term_Let::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.binds_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.expr_;
+}
+
+void Term_Let::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Term_Let::Clear() {
+// @@protoc_insertion_point(message_clear_start:Term.Let)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.binds_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.expr_ != nullptr);
+    _impl_.expr_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Term_Let::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .VarTermTuple binds = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_binds(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // required .Term expr = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_expr(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Term_Let::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Term.Let)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .VarTermTuple binds = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_binds_size()); i < n; i++) {
+    const auto& repfield = this->_internal_binds(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .Term expr = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::expr(this),
+        _Internal::expr(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Term.Let)
+  return target;
+}
+
+size_t Term_Let::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Term.Let)
+  size_t total_size = 0;
+
+  // required .Term expr = 2;
+  if (_internal_has_expr()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.expr_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .VarTermTuple binds = 1;
+  total_size += 1UL * this->_internal_binds_size();
+  for (const auto& msg : this->_impl_.binds_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Term_Let::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Term_Let::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Term_Let::GetClassData() const { return &_class_data_; }
+
+
+void Term_Let::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Term_Let*>(&to_msg);
+  auto& from = static_cast<const Term_Let&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Term.Let)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.binds_.MergeFrom(from._impl_.binds_);
+  if (from._internal_has_expr()) {
+    _this->_internal_mutable_expr()->::Term::MergeFrom(
+        from._internal_expr());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Term_Let::CopyFrom(const Term_Let& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Term.Let)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Term_Let::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.binds_))
+    return false;
+  if (_internal_has_expr()) {
+    if (!_impl_.expr_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Term_Let::InternalSwap(Term_Let* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.binds_.InternalSwap(&other->_impl_.binds_);
+  swap(_impl_.expr_, other->_impl_.expr_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Term_Let::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[2]);
+}
+
+// ===================================================================
+
+class Term_Call::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Term_Call>()._impl_._has_bits_);
+  static const ::Builtin& builtin(const Term_Call* msg);
+  static void set_has_builtin(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::Builtin&
+Term_Call::_Internal::builtin(const Term_Call* msg) {
+  return *msg->_impl_.builtin_;
+}
+Term_Call::Term_Call(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Term.Call)
+}
+Term_Call::Term_Call(const Term_Call& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Term_Call* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.args_){from._impl_.args_}
+    , decltype(_impl_.builtin_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_builtin()) {
+    _this->_impl_.builtin_ = new ::Builtin(*from._impl_.builtin_);
+  }
+  // @@protoc_insertion_point(copy_constructor:Term.Call)
+}
+
+inline void Term_Call::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.args_){arena}
+    , decltype(_impl_.builtin_){nullptr}
+  };
+}
+
+Term_Call::~Term_Call() {
+  // @@protoc_insertion_point(destructor:Term.Call)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Term_Call::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.args_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.builtin_;
+}
+
+void Term_Call::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Term_Call::Clear() {
+// @@protoc_insertion_point(message_clear_start:Term.Call)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.args_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.builtin_ != nullptr);
+    _impl_.builtin_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Term_Call::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .Builtin builtin = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_builtin(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .Term args = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_args(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Term_Call::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Term.Call)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .Builtin builtin = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::builtin(this),
+        _Internal::builtin(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .Term args = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_args_size()); i < n; i++) {
+    const auto& repfield = this->_internal_args(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Term.Call)
+  return target;
+}
+
+size_t Term_Call::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Term.Call)
+  size_t total_size = 0;
+
+  // required .Builtin builtin = 1;
+  if (_internal_has_builtin()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.builtin_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .Term args = 2;
+  total_size += 1UL * this->_internal_args_size();
+  for (const auto& msg : this->_impl_.args_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Term_Call::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Term_Call::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Term_Call::GetClassData() const { return &_class_data_; }
+
+
+void Term_Call::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Term_Call*>(&to_msg);
+  auto& from = static_cast<const Term_Call&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Term.Call)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.args_.MergeFrom(from._impl_.args_);
+  if (from._internal_has_builtin()) {
+    _this->_internal_mutable_builtin()->::Builtin::MergeFrom(
+        from._internal_builtin());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Term_Call::CopyFrom(const Term_Call& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Term.Call)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Term_Call::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.args_))
+    return false;
+  if (_internal_has_builtin()) {
+    if (!_impl_.builtin_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Term_Call::InternalSwap(Term_Call* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.args_.InternalSwap(&other->_impl_.args_);
+  swap(_impl_.builtin_, other->_impl_.builtin_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Term_Call::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[3]);
+}
+
+// ===================================================================
+
+class Term_If::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Term_If>()._impl_._has_bits_);
+  static const ::Term& test(const Term_If* msg);
+  static void set_has_test(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::Term& true_branch(const Term_If* msg);
+  static void set_has_true_branch(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::Term& false_branch(const Term_If* msg);
+  static void set_has_false_branch(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+const ::Term&
+Term_If::_Internal::test(const Term_If* msg) {
+  return *msg->_impl_.test_;
+}
+const ::Term&
+Term_If::_Internal::true_branch(const Term_If* msg) {
+  return *msg->_impl_.true_branch_;
+}
+const ::Term&
+Term_If::_Internal::false_branch(const Term_If* msg) {
+  return *msg->_impl_.false_branch_;
+}
+Term_If::Term_If(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Term.If)
+}
+Term_If::Term_If(const Term_If& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Term_If* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.test_){nullptr}
+    , decltype(_impl_.true_branch_){nullptr}
+    , decltype(_impl_.false_branch_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_test()) {
+    _this->_impl_.test_ = new ::Term(*from._impl_.test_);
+  }
+  if (from._internal_has_true_branch()) {
+    _this->_impl_.true_branch_ = new ::Term(*from._impl_.true_branch_);
+  }
+  if (from._internal_has_false_branch()) {
+    _this->_impl_.false_branch_ = new ::Term(*from._impl_.false_branch_);
+  }
+  // @@protoc_insertion_point(copy_constructor:Term.If)
+}
+
+inline void Term_If::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.test_){nullptr}
+    , decltype(_impl_.true_branch_){nullptr}
+    , decltype(_impl_.false_branch_){nullptr}
+  };
+}
+
+Term_If::~Term_If() {
+  // @@protoc_insertion_point(destructor:Term.If)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Term_If::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.test_;
+  if (this != internal_default_instance()) delete _impl_.true_branch_;
+  if (this != internal_default_instance()) delete _impl_.false_branch_;
+}
+
+void Term_If::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Term_If::Clear() {
+// @@protoc_insertion_point(message_clear_start:Term.If)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.test_ != nullptr);
+      _impl_.test_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.true_branch_ != nullptr);
+      _impl_.true_branch_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.false_branch_ != nullptr);
+      _impl_.false_branch_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Term_If::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .Term test = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_test(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .Term true_branch = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_true_branch(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .Term false_branch = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_false_branch(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Term_If::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Term.If)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .Term test = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::test(this),
+        _Internal::test(this).GetCachedSize(), target, stream);
+  }
+
+  // required .Term true_branch = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::true_branch(this),
+        _Internal::true_branch(this).GetCachedSize(), target, stream);
+  }
+
+  // required .Term false_branch = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::false_branch(this),
+        _Internal::false_branch(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Term.If)
+  return target;
+}
+
+size_t Term_If::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:Term.If)
+  size_t total_size = 0;
+
+  if (_internal_has_test()) {
+    // required .Term test = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.test_);
+  }
+
+  if (_internal_has_true_branch()) {
+    // required .Term true_branch = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.true_branch_);
+  }
+
+  if (_internal_has_false_branch()) {
+    // required .Term false_branch = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.false_branch_);
+  }
+
+  return total_size;
+}
+size_t Term_If::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Term.If)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required .Term test = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.test_);
+
+    // required .Term true_branch = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.true_branch_);
+
+    // required .Term false_branch = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.false_branch_);
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Term_If::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Term_If::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Term_If::GetClassData() const { return &_class_data_; }
+
+
+void Term_If::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Term_If*>(&to_msg);
+  auto& from = static_cast<const Term_If&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Term.If)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_test()->::Term::MergeFrom(
+          from._internal_test());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_true_branch()->::Term::MergeFrom(
+          from._internal_true_branch());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_false_branch()->::Term::MergeFrom(
+          from._internal_false_branch());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Term_If::CopyFrom(const Term_If& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Term.If)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Term_If::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_test()) {
+    if (!_impl_.test_->IsInitialized()) return false;
+  }
+  if (_internal_has_true_branch()) {
+    if (!_impl_.true_branch_->IsInitialized()) return false;
+  }
+  if (_internal_has_false_branch()) {
+    if (!_impl_.false_branch_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Term_If::InternalSwap(Term_If* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Term_If, _impl_.false_branch_)
+      + sizeof(Term_If::_impl_.false_branch_)
+      - PROTOBUF_FIELD_OFFSET(Term_If, _impl_.test_)>(
+          reinterpret_cast<char*>(&_impl_.test_),
+          reinterpret_cast<char*>(&other->_impl_.test_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Term_If::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[4]);
+}
+
+// ===================================================================
+
+class Term_GetByKey::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Term_GetByKey>()._impl_._has_bits_);
+  static const ::TableRef& table_ref(const Term_GetByKey* msg);
+  static void set_has_table_ref(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_attrname(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::Term& key(const Term_GetByKey* msg);
+  static void set_has_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+const ::TableRef&
+Term_GetByKey::_Internal::table_ref(const Term_GetByKey* msg) {
+  return *msg->_impl_.table_ref_;
+}
+const ::Term&
+Term_GetByKey::_Internal::key(const Term_GetByKey* msg) {
+  return *msg->_impl_.key_;
+}
+Term_GetByKey::Term_GetByKey(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Term.GetByKey)
+}
+Term_GetByKey::Term_GetByKey(const Term_GetByKey& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Term_GetByKey* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.attrname_){}
+    , decltype(_impl_.table_ref_){nullptr}
+    , decltype(_impl_.key_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.attrname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.attrname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_attrname()) {
+    _this->_impl_.attrname_.Set(from._internal_attrname(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_table_ref()) {
+    _this->_impl_.table_ref_ = new ::TableRef(*from._impl_.table_ref_);
+  }
+  if (from._internal_has_key()) {
+    _this->_impl_.key_ = new ::Term(*from._impl_.key_);
+  }
+  // @@protoc_insertion_point(copy_constructor:Term.GetByKey)
+}
+
+inline void Term_GetByKey::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.attrname_){}
+    , decltype(_impl_.table_ref_){nullptr}
+    , decltype(_impl_.key_){nullptr}
+  };
+  _impl_.attrname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.attrname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Term_GetByKey::~Term_GetByKey() {
+  // @@protoc_insertion_point(destructor:Term.GetByKey)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Term_GetByKey::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.attrname_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.table_ref_;
+  if (this != internal_default_instance()) delete _impl_.key_;
+}
+
+void Term_GetByKey::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Term_GetByKey::Clear() {
+// @@protoc_insertion_point(message_clear_start:Term.GetByKey)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.attrname_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.table_ref_ != nullptr);
+      _impl_.table_ref_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.key_ != nullptr);
+      _impl_.key_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Term_GetByKey::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .TableRef table_ref = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_table_ref(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string attrname = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_attrname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "Term.GetByKey.attrname");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required .Term key = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_key(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Term_GetByKey::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Term.GetByKey)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .TableRef table_ref = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::table_ref(this),
+        _Internal::table_ref(this).GetCachedSize(), target, stream);
+  }
+
+  // required string attrname = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_attrname().data(), static_cast<int>(this->_internal_attrname().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "Term.GetByKey.attrname");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_attrname(), target);
+  }
+
+  // required .Term key = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::key(this),
+        _Internal::key(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Term.GetByKey)
+  return target;
+}
+
+size_t Term_GetByKey::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:Term.GetByKey)
+  size_t total_size = 0;
+
+  if (_internal_has_attrname()) {
+    // required string attrname = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_attrname());
+  }
+
+  if (_internal_has_table_ref()) {
+    // required .TableRef table_ref = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.table_ref_);
+  }
+
+  if (_internal_has_key()) {
+    // required .Term key = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.key_);
+  }
+
+  return total_size;
+}
+size_t Term_GetByKey::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Term.GetByKey)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required string attrname = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_attrname());
+
+    // required .TableRef table_ref = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.table_ref_);
+
+    // required .Term key = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.key_);
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Term_GetByKey::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Term_GetByKey::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Term_GetByKey::GetClassData() const { return &_class_data_; }
+
+
+void Term_GetByKey::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Term_GetByKey*>(&to_msg);
+  auto& from = static_cast<const Term_GetByKey&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Term.GetByKey)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_attrname(from._internal_attrname());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_table_ref()->::TableRef::MergeFrom(
+          from._internal_table_ref());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_key()->::Term::MergeFrom(
+          from._internal_key());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Term_GetByKey::CopyFrom(const Term_GetByKey& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Term.GetByKey)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Term_GetByKey::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_table_ref()) {
+    if (!_impl_.table_ref_->IsInitialized()) return false;
+  }
+  if (_internal_has_key()) {
+    if (!_impl_.key_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Term_GetByKey::InternalSwap(Term_GetByKey* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.attrname_, lhs_arena,
+      &other->_impl_.attrname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Term_GetByKey, _impl_.key_)
+      + sizeof(Term_GetByKey::_impl_.key_)
+      - PROTOBUF_FIELD_OFFSET(Term_GetByKey, _impl_.table_ref_)>(
+          reinterpret_cast<char*>(&_impl_.table_ref_),
+          reinterpret_cast<char*>(&other->_impl_.table_ref_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Term_GetByKey::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[5]);
+}
+
+// ===================================================================
+
+class Term_Table::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Term_Table>()._impl_._has_bits_);
+  static const ::TableRef& table_ref(const Term_Table* msg);
+  static void set_has_table_ref(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::TableRef&
+Term_Table::_Internal::table_ref(const Term_Table* msg) {
+  return *msg->_impl_.table_ref_;
+}
+Term_Table::Term_Table(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Term.Table)
+}
+Term_Table::Term_Table(const Term_Table& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Term_Table* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_ref_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_table_ref()) {
+    _this->_impl_.table_ref_ = new ::TableRef(*from._impl_.table_ref_);
+  }
+  // @@protoc_insertion_point(copy_constructor:Term.Table)
+}
+
+inline void Term_Table::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_ref_){nullptr}
+  };
+}
+
+Term_Table::~Term_Table() {
+  // @@protoc_insertion_point(destructor:Term.Table)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Term_Table::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.table_ref_;
+}
+
+void Term_Table::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Term_Table::Clear() {
+// @@protoc_insertion_point(message_clear_start:Term.Table)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.table_ref_ != nullptr);
+    _impl_.table_ref_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Term_Table::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .TableRef table_ref = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_table_ref(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Term_Table::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Term.Table)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .TableRef table_ref = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::table_ref(this),
+        _Internal::table_ref(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Term.Table)
+  return target;
+}
+
+size_t Term_Table::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Term.Table)
+  size_t total_size = 0;
+
+  // required .TableRef table_ref = 1;
+  if (_internal_has_table_ref()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.table_ref_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Term_Table::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Term_Table::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Term_Table::GetClassData() const { return &_class_data_; }
+
+
+void Term_Table::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Term_Table*>(&to_msg);
+  auto& from = static_cast<const Term_Table&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Term.Table)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_table_ref()) {
+    _this->_internal_mutable_table_ref()->::TableRef::MergeFrom(
+        from._internal_table_ref());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Term_Table::CopyFrom(const Term_Table& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Term.Table)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Term_Table::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_table_ref()) {
+    if (!_impl_.table_ref_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Term_Table::InternalSwap(Term_Table* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.table_ref_, other->_impl_.table_ref_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Term_Table::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[6]);
+}
+
+// ===================================================================
+
+class Term::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Term>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_var(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::Term_Let& let(const Term* msg);
+  static void set_has_let(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::Term_Call& call(const Term* msg);
+  static void set_has_call(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::Term_If& if_(const Term* msg);
+  static void set_has_if_(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_error(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_number(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_valuestring(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_jsonstring(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_valuebool(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static const ::Term_GetByKey& get_by_key(const Term* msg);
+  static void set_has_get_by_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static const ::Term_Table& table(const Term* msg);
+  static void set_has_table(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_javascript(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000400) ^ 0x00000400) != 0;
+  }
+};
+
+const ::Term_Let&
+Term::_Internal::let(const Term* msg) {
+  return *msg->_impl_.let_;
+}
+const ::Term_Call&
+Term::_Internal::call(const Term* msg) {
+  return *msg->_impl_.call_;
+}
+const ::Term_If&
+Term::_Internal::if_(const Term* msg) {
+  return *msg->_impl_.if__;
+}
+const ::Term_GetByKey&
+Term::_Internal::get_by_key(const Term* msg) {
+  return *msg->_impl_.get_by_key_;
+}
+const ::Term_Table&
+Term::_Internal::table(const Term* msg) {
+  return *msg->_impl_.table_;
+}
+Term::Term(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Term)
+}
+Term::Term(const Term& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Term* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_._extensions_)*/{}
+    , decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.array_){from._impl_.array_}
+    , decltype(_impl_.object_){from._impl_.object_}
+    , decltype(_impl_.var_){}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.valuestring_){}
+    , decltype(_impl_.jsonstring_){}
+    , decltype(_impl_.javascript_){}
+    , decltype(_impl_.let_){nullptr}
+    , decltype(_impl_.call_){nullptr}
+    , decltype(_impl_.if__){nullptr}
+    , decltype(_impl_.get_by_key_){nullptr}
+    , decltype(_impl_.table_){nullptr}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.valuebool_){}
+    , decltype(_impl_.number_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_._extensions_.MergeFrom(internal_default_instance(), from._impl_._extensions_);
+  _impl_.var_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.var_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_var()) {
+    _this->_impl_.var_.Set(from._internal_var(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.valuestring_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.valuestring_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_valuestring()) {
+    _this->_impl_.valuestring_.Set(from._internal_valuestring(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.jsonstring_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.jsonstring_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_jsonstring()) {
+    _this->_impl_.jsonstring_.Set(from._internal_jsonstring(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.javascript_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.javascript_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_javascript()) {
+    _this->_impl_.javascript_.Set(from._internal_javascript(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_let()) {
+    _this->_impl_.let_ = new ::Term_Let(*from._impl_.let_);
+  }
+  if (from._internal_has_call()) {
+    _this->_impl_.call_ = new ::Term_Call(*from._impl_.call_);
+  }
+  if (from._internal_has_if_()) {
+    _this->_impl_.if__ = new ::Term_If(*from._impl_.if__);
+  }
+  if (from._internal_has_get_by_key()) {
+    _this->_impl_.get_by_key_ = new ::Term_GetByKey(*from._impl_.get_by_key_);
+  }
+  if (from._internal_has_table()) {
+    _this->_impl_.table_ = new ::Term_Table(*from._impl_.table_);
+  }
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.number_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.number_));
+  // @@protoc_insertion_point(copy_constructor:Term)
+}
+
+inline void Term::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_._extensions_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.array_){arena}
+    , decltype(_impl_.object_){arena}
+    , decltype(_impl_.var_){}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.valuestring_){}
+    , decltype(_impl_.jsonstring_){}
+    , decltype(_impl_.javascript_){}
+    , decltype(_impl_.let_){nullptr}
+    , decltype(_impl_.call_){nullptr}
+    , decltype(_impl_.if__){nullptr}
+    , decltype(_impl_.get_by_key_){nullptr}
+    , decltype(_impl_.table_){nullptr}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.valuebool_){false}
+    , decltype(_impl_.number_){0}
+  };
+  _impl_.var_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.var_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.valuestring_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.valuestring_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.jsonstring_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.jsonstring_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.javascript_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.javascript_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Term::~Term() {
+  // @@protoc_insertion_point(destructor:Term)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Term::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_._extensions_.~ExtensionSet();
+  _impl_.array_.~RepeatedPtrField();
+  _impl_.object_.~RepeatedPtrField();
+  _impl_.var_.Destroy();
+  _impl_.error_.Destroy();
+  _impl_.valuestring_.Destroy();
+  _impl_.jsonstring_.Destroy();
+  _impl_.javascript_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.let_;
+  if (this != internal_default_instance()) delete _impl_.call_;
+  if (this != internal_default_instance()) delete _impl_.if__;
+  if (this != internal_default_instance()) delete _impl_.get_by_key_;
+  if (this != internal_default_instance()) delete _impl_.table_;
+}
+
+void Term::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Term::Clear() {
+// @@protoc_insertion_point(message_clear_start:Term)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_._extensions_.Clear();
+  _impl_.array_.Clear();
+  _impl_.object_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.var_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.error_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.valuestring_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _impl_.jsonstring_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _impl_.javascript_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.let_ != nullptr);
+      _impl_.let_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.call_ != nullptr);
+      _impl_.call_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      GOOGLE_DCHECK(_impl_.if__ != nullptr);
+      _impl_.if__->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00000300u) {
+    if (cached_has_bits & 0x00000100u) {
+      GOOGLE_DCHECK(_impl_.get_by_key_ != nullptr);
+      _impl_.get_by_key_->Clear();
+    }
+    if (cached_has_bits & 0x00000200u) {
+      GOOGLE_DCHECK(_impl_.table_ != nullptr);
+      _impl_.table_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00001c00u) {
+    ::memset(&_impl_.type_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.number_) -
+        reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.number_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Term::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .Term.TermType type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::Term_TermType_IsValid(val))) {
+            _internal_set_type(static_cast<::Term_TermType>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string var = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_var();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "Term.var");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Term.Let let = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_let(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Term.Call call = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_call(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Term.If if_ = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_if_(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string error = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_error();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "Term.error");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double number = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_number(&has_bits);
+          _impl_.number_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string valuestring = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_valuestring();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "Term.valuestring");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string jsonstring = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_jsonstring();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "Term.jsonstring");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool valuebool = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_valuebool(&has_bits);
+          _impl_.valuebool_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .Term array = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_array(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<90>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .VarTermTuple object = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_object(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<98>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Term.GetByKey get_by_key = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          ptr = ctx->ParseMessage(_internal_mutable_get_by_key(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Term.Table table = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
+          ptr = ctx->ParseMessage(_internal_mutable_table(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string javascript = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
+          auto str = _internal_mutable_javascript();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "Term.javascript");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    if ((8000u <= tag && tag < 8800u)) {
+      ptr = _impl_._extensions_.ParseField(tag, ptr, internal_default_instance(), &_internal_metadata_, ctx);
+      CHK_(ptr != nullptr);
+      continue;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Term::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Term)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .Term.TermType type = 1;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
+  }
+
+  // optional string var = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_var().data(), static_cast<int>(this->_internal_var().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "Term.var");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_var(), target);
+  }
+
+  // optional .Term.Let let = 3;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::let(this),
+        _Internal::let(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .Term.Call call = 4;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::call(this),
+        _Internal::call(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .Term.If if_ = 5;
+  if (cached_has_bits & 0x00000080u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::if_(this),
+        _Internal::if_(this).GetCachedSize(), target, stream);
+  }
+
+  // optional string error = 6;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "Term.error");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_error(), target);
+  }
+
+  // optional double number = 7;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_number(), target);
+  }
+
+  // optional string valuestring = 8;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_valuestring().data(), static_cast<int>(this->_internal_valuestring().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "Term.valuestring");
+    target = stream->WriteStringMaybeAliased(
+        8, this->_internal_valuestring(), target);
+  }
+
+  // optional string jsonstring = 9;
+  if (cached_has_bits & 0x00000008u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_jsonstring().data(), static_cast<int>(this->_internal_jsonstring().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "Term.jsonstring");
+    target = stream->WriteStringMaybeAliased(
+        9, this->_internal_jsonstring(), target);
+  }
+
+  // optional bool valuebool = 10;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_valuebool(), target);
+  }
+
+  // repeated .Term array = 11;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_array_size()); i < n; i++) {
+    const auto& repfield = this->_internal_array(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(11, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .VarTermTuple object = 12;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_object_size()); i < n; i++) {
+    const auto& repfield = this->_internal_object(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(12, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional .Term.GetByKey get_by_key = 14;
+  if (cached_has_bits & 0x00000100u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(14, _Internal::get_by_key(this),
+        _Internal::get_by_key(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .Term.Table table = 15;
+  if (cached_has_bits & 0x00000200u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(15, _Internal::table(this),
+        _Internal::table(this).GetCachedSize(), target, stream);
+  }
+
+  // optional string javascript = 16;
+  if (cached_has_bits & 0x00000010u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_javascript().data(), static_cast<int>(this->_internal_javascript().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "Term.javascript");
+    target = stream->WriteStringMaybeAliased(
+        16, this->_internal_javascript(), target);
+  }
+
+  // Extension range [1000, 1100)
+  target = _impl_._extensions_._InternalSerialize(
+  internal_default_instance(), 1000, 1100, target, stream);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Term)
+  return target;
+}
+
+size_t Term::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Term)
+  size_t total_size = 0;
+
+  total_size += _impl_._extensions_.ByteSize();
+
+  // required .Term.TermType type = 1;
+  if (_internal_has_type()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .Term array = 11;
+  total_size += 1UL * this->_internal_array_size();
+  for (const auto& msg : this->_impl_.array_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .VarTermTuple object = 12;
+  total_size += 1UL * this->_internal_object_size();
+  for (const auto& msg : this->_impl_.object_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string var = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_var());
+    }
+
+    // optional string error = 6;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_error());
+    }
+
+    // optional string valuestring = 8;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_valuestring());
+    }
+
+    // optional string jsonstring = 9;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_jsonstring());
+    }
+
+    // optional string javascript = 16;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_javascript());
+    }
+
+    // optional .Term.Let let = 3;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.let_);
+    }
+
+    // optional .Term.Call call = 4;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.call_);
+    }
+
+    // optional .Term.If if_ = 5;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.if__);
+    }
+
+  }
+  if (cached_has_bits & 0x00000300u) {
+    // optional .Term.GetByKey get_by_key = 14;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.get_by_key_);
+    }
+
+    // optional .Term.Table table = 15;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.table_);
+    }
+
+  }
+  if (cached_has_bits & 0x00001800u) {
+    // optional bool valuebool = 10;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 1 + 1;
+    }
+
+    // optional double number = 7;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Term::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Term::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Term::GetClassData() const { return &_class_data_; }
+
+
+void Term::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Term*>(&to_msg);
+  auto& from = static_cast<const Term&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Term)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.array_.MergeFrom(from._impl_.array_);
+  _this->_impl_.object_.MergeFrom(from._impl_.object_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_var(from._internal_var());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_error(from._internal_error());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_valuestring(from._internal_valuestring());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_set_jsonstring(from._internal_jsonstring());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_set_javascript(from._internal_javascript());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_let()->::Term_Let::MergeFrom(
+          from._internal_let());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_call()->::Term_Call::MergeFrom(
+          from._internal_call());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_internal_mutable_if_()->::Term_If::MergeFrom(
+          from._internal_if_());
+    }
+  }
+  if (cached_has_bits & 0x00001f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_internal_mutable_get_by_key()->::Term_GetByKey::MergeFrom(
+          from._internal_get_by_key());
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_internal_mutable_table()->::Term_Table::MergeFrom(
+          from._internal_table());
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.valuebool_ = from._impl_.valuebool_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.number_ = from._impl_.number_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_impl_._extensions_.MergeFrom(internal_default_instance(), from._impl_._extensions_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Term::CopyFrom(const Term& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Term)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Term::IsInitialized() const {
+  if (!_impl_._extensions_.IsInitialized()) {
+    return false;
+  }
+
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.array_))
+    return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.object_))
+    return false;
+  if (_internal_has_let()) {
+    if (!_impl_.let_->IsInitialized()) return false;
+  }
+  if (_internal_has_call()) {
+    if (!_impl_.call_->IsInitialized()) return false;
+  }
+  if (_internal_has_if_()) {
+    if (!_impl_.if__->IsInitialized()) return false;
+  }
+  if (_internal_has_get_by_key()) {
+    if (!_impl_.get_by_key_->IsInitialized()) return false;
+  }
+  if (_internal_has_table()) {
+    if (!_impl_.table_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Term::InternalSwap(Term* other) {
+  using std::swap;
+  _impl_._extensions_.InternalSwap(&other->_impl_._extensions_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.array_.InternalSwap(&other->_impl_.array_);
+  _impl_.object_.InternalSwap(&other->_impl_.object_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.var_, lhs_arena,
+      &other->_impl_.var_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_, lhs_arena,
+      &other->_impl_.error_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.valuestring_, lhs_arena,
+      &other->_impl_.valuestring_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.jsonstring_, lhs_arena,
+      &other->_impl_.jsonstring_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.javascript_, lhs_arena,
+      &other->_impl_.javascript_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Term, _impl_.number_)
+      + sizeof(Term::_impl_.number_)
+      - PROTOBUF_FIELD_OFFSET(Term, _impl_.let_)>(
+          reinterpret_cast<char*>(&_impl_.let_),
+          reinterpret_cast<char*>(&other->_impl_.let_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Term::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[7]);
+}
+
+// ===================================================================
+
+class Builtin_Filter::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Builtin_Filter>()._impl_._has_bits_);
+  static const ::Predicate& predicate(const Builtin_Filter* msg);
+  static void set_has_predicate(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::Predicate&
+Builtin_Filter::_Internal::predicate(const Builtin_Filter* msg) {
+  return *msg->_impl_.predicate_;
+}
+Builtin_Filter::Builtin_Filter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Builtin.Filter)
+}
+Builtin_Filter::Builtin_Filter(const Builtin_Filter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Builtin_Filter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.predicate_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_predicate()) {
+    _this->_impl_.predicate_ = new ::Predicate(*from._impl_.predicate_);
+  }
+  // @@protoc_insertion_point(copy_constructor:Builtin.Filter)
+}
+
+inline void Builtin_Filter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.predicate_){nullptr}
+  };
+}
+
+Builtin_Filter::~Builtin_Filter() {
+  // @@protoc_insertion_point(destructor:Builtin.Filter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Builtin_Filter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.predicate_;
+}
+
+void Builtin_Filter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Builtin_Filter::Clear() {
+// @@protoc_insertion_point(message_clear_start:Builtin.Filter)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.predicate_ != nullptr);
+    _impl_.predicate_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Builtin_Filter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .Predicate predicate = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_predicate(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Builtin_Filter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Builtin.Filter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .Predicate predicate = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::predicate(this),
+        _Internal::predicate(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Builtin.Filter)
+  return target;
+}
+
+size_t Builtin_Filter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Builtin.Filter)
+  size_t total_size = 0;
+
+  // required .Predicate predicate = 1;
+  if (_internal_has_predicate()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.predicate_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Builtin_Filter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Builtin_Filter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Builtin_Filter::GetClassData() const { return &_class_data_; }
+
+
+void Builtin_Filter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Builtin_Filter*>(&to_msg);
+  auto& from = static_cast<const Builtin_Filter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Builtin.Filter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_predicate()) {
+    _this->_internal_mutable_predicate()->::Predicate::MergeFrom(
+        from._internal_predicate());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Builtin_Filter::CopyFrom(const Builtin_Filter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Builtin.Filter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Builtin_Filter::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_predicate()) {
+    if (!_impl_.predicate_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Builtin_Filter::InternalSwap(Builtin_Filter* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.predicate_, other->_impl_.predicate_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Builtin_Filter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[8]);
+}
+
+// ===================================================================
+
+class Builtin_Map::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Builtin_Map>()._impl_._has_bits_);
+  static const ::Mapping& mapping(const Builtin_Map* msg);
+  static void set_has_mapping(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::Mapping&
+Builtin_Map::_Internal::mapping(const Builtin_Map* msg) {
+  return *msg->_impl_.mapping_;
+}
+Builtin_Map::Builtin_Map(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Builtin.Map)
+}
+Builtin_Map::Builtin_Map(const Builtin_Map& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Builtin_Map* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.mapping_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_mapping()) {
+    _this->_impl_.mapping_ = new ::Mapping(*from._impl_.mapping_);
+  }
+  // @@protoc_insertion_point(copy_constructor:Builtin.Map)
+}
+
+inline void Builtin_Map::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.mapping_){nullptr}
+  };
+}
+
+Builtin_Map::~Builtin_Map() {
+  // @@protoc_insertion_point(destructor:Builtin.Map)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Builtin_Map::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.mapping_;
+}
+
+void Builtin_Map::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Builtin_Map::Clear() {
+// @@protoc_insertion_point(message_clear_start:Builtin.Map)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.mapping_ != nullptr);
+    _impl_.mapping_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Builtin_Map::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .Mapping mapping = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_mapping(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Builtin_Map::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Builtin.Map)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .Mapping mapping = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::mapping(this),
+        _Internal::mapping(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Builtin.Map)
+  return target;
+}
+
+size_t Builtin_Map::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Builtin.Map)
+  size_t total_size = 0;
+
+  // required .Mapping mapping = 1;
+  if (_internal_has_mapping()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.mapping_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Builtin_Map::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Builtin_Map::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Builtin_Map::GetClassData() const { return &_class_data_; }
+
+
+void Builtin_Map::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Builtin_Map*>(&to_msg);
+  auto& from = static_cast<const Builtin_Map&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Builtin.Map)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_mapping()) {
+    _this->_internal_mutable_mapping()->::Mapping::MergeFrom(
+        from._internal_mapping());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Builtin_Map::CopyFrom(const Builtin_Map& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Builtin.Map)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Builtin_Map::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_mapping()) {
+    if (!_impl_.mapping_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Builtin_Map::InternalSwap(Builtin_Map* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.mapping_, other->_impl_.mapping_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Builtin_Map::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[9]);
+}
+
+// ===================================================================
+
+class Builtin_ConcatMap::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Builtin_ConcatMap>()._impl_._has_bits_);
+  static const ::Mapping& mapping(const Builtin_ConcatMap* msg);
+  static void set_has_mapping(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::Mapping&
+Builtin_ConcatMap::_Internal::mapping(const Builtin_ConcatMap* msg) {
+  return *msg->_impl_.mapping_;
+}
+Builtin_ConcatMap::Builtin_ConcatMap(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Builtin.ConcatMap)
+}
+Builtin_ConcatMap::Builtin_ConcatMap(const Builtin_ConcatMap& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Builtin_ConcatMap* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.mapping_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_mapping()) {
+    _this->_impl_.mapping_ = new ::Mapping(*from._impl_.mapping_);
+  }
+  // @@protoc_insertion_point(copy_constructor:Builtin.ConcatMap)
+}
+
+inline void Builtin_ConcatMap::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.mapping_){nullptr}
+  };
+}
+
+Builtin_ConcatMap::~Builtin_ConcatMap() {
+  // @@protoc_insertion_point(destructor:Builtin.ConcatMap)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Builtin_ConcatMap::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.mapping_;
+}
+
+void Builtin_ConcatMap::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Builtin_ConcatMap::Clear() {
+// @@protoc_insertion_point(message_clear_start:Builtin.ConcatMap)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.mapping_ != nullptr);
+    _impl_.mapping_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Builtin_ConcatMap::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .Mapping mapping = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_mapping(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Builtin_ConcatMap::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Builtin.ConcatMap)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .Mapping mapping = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::mapping(this),
+        _Internal::mapping(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Builtin.ConcatMap)
+  return target;
+}
+
+size_t Builtin_ConcatMap::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Builtin.ConcatMap)
+  size_t total_size = 0;
+
+  // required .Mapping mapping = 1;
+  if (_internal_has_mapping()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.mapping_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Builtin_ConcatMap::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Builtin_ConcatMap::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Builtin_ConcatMap::GetClassData() const { return &_class_data_; }
+
+
+void Builtin_ConcatMap::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Builtin_ConcatMap*>(&to_msg);
+  auto& from = static_cast<const Builtin_ConcatMap&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Builtin.ConcatMap)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_mapping()) {
+    _this->_internal_mutable_mapping()->::Mapping::MergeFrom(
+        from._internal_mapping());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Builtin_ConcatMap::CopyFrom(const Builtin_ConcatMap& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Builtin.ConcatMap)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Builtin_ConcatMap::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_mapping()) {
+    if (!_impl_.mapping_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Builtin_ConcatMap::InternalSwap(Builtin_ConcatMap* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.mapping_, other->_impl_.mapping_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Builtin_ConcatMap::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[10]);
+}
+
+// ===================================================================
+
+class Builtin_OrderBy::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Builtin_OrderBy>()._impl_._has_bits_);
+  static void set_has_attr(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_ascending(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+Builtin_OrderBy::Builtin_OrderBy(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Builtin.OrderBy)
+}
+Builtin_OrderBy::Builtin_OrderBy(const Builtin_OrderBy& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Builtin_OrderBy* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.attr_){}
+    , decltype(_impl_.ascending_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.attr_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.attr_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_attr()) {
+    _this->_impl_.attr_.Set(from._internal_attr(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.ascending_ = from._impl_.ascending_;
+  // @@protoc_insertion_point(copy_constructor:Builtin.OrderBy)
+}
+
+inline void Builtin_OrderBy::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.attr_){}
+    , decltype(_impl_.ascending_){true}
+  };
+  _impl_.attr_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.attr_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Builtin_OrderBy::~Builtin_OrderBy() {
+  // @@protoc_insertion_point(destructor:Builtin.OrderBy)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Builtin_OrderBy::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.attr_.Destroy();
+}
+
+void Builtin_OrderBy::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Builtin_OrderBy::Clear() {
+// @@protoc_insertion_point(message_clear_start:Builtin.OrderBy)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.attr_.ClearNonDefaultToEmpty();
+    }
+    _impl_.ascending_ = true;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Builtin_OrderBy::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string attr = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_attr();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "Builtin.OrderBy.attr");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool ascending = 2 [default = true];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_ascending(&has_bits);
+          _impl_.ascending_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Builtin_OrderBy::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Builtin.OrderBy)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string attr = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_attr().data(), static_cast<int>(this->_internal_attr().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "Builtin.OrderBy.attr");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_attr(), target);
+  }
+
+  // optional bool ascending = 2 [default = true];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_ascending(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Builtin.OrderBy)
+  return target;
+}
+
+size_t Builtin_OrderBy::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Builtin.OrderBy)
+  size_t total_size = 0;
+
+  // required string attr = 1;
+  if (_internal_has_attr()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_attr());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional bool ascending = 2 [default = true];
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Builtin_OrderBy::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Builtin_OrderBy::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Builtin_OrderBy::GetClassData() const { return &_class_data_; }
+
+
+void Builtin_OrderBy::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Builtin_OrderBy*>(&to_msg);
+  auto& from = static_cast<const Builtin_OrderBy&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Builtin.OrderBy)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_attr(from._internal_attr());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.ascending_ = from._impl_.ascending_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Builtin_OrderBy::CopyFrom(const Builtin_OrderBy& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Builtin.OrderBy)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Builtin_OrderBy::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void Builtin_OrderBy::InternalSwap(Builtin_OrderBy* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.attr_, lhs_arena,
+      &other->_impl_.attr_, rhs_arena
+  );
+  swap(_impl_.ascending_, other->_impl_.ascending_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Builtin_OrderBy::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[11]);
+}
+
+// ===================================================================
+
+class Builtin_GroupedMapReduce::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Builtin_GroupedMapReduce>()._impl_._has_bits_);
+  static const ::Mapping& group_mapping(const Builtin_GroupedMapReduce* msg);
+  static void set_has_group_mapping(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::Mapping& value_mapping(const Builtin_GroupedMapReduce* msg);
+  static void set_has_value_mapping(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::Reduction& reduction(const Builtin_GroupedMapReduce* msg);
+  static void set_has_reduction(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+const ::Mapping&
+Builtin_GroupedMapReduce::_Internal::group_mapping(const Builtin_GroupedMapReduce* msg) {
+  return *msg->_impl_.group_mapping_;
+}
+const ::Mapping&
+Builtin_GroupedMapReduce::_Internal::value_mapping(const Builtin_GroupedMapReduce* msg) {
+  return *msg->_impl_.value_mapping_;
+}
+const ::Reduction&
+Builtin_GroupedMapReduce::_Internal::reduction(const Builtin_GroupedMapReduce* msg) {
+  return *msg->_impl_.reduction_;
+}
+Builtin_GroupedMapReduce::Builtin_GroupedMapReduce(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Builtin.GroupedMapReduce)
+}
+Builtin_GroupedMapReduce::Builtin_GroupedMapReduce(const Builtin_GroupedMapReduce& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Builtin_GroupedMapReduce* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.group_mapping_){nullptr}
+    , decltype(_impl_.value_mapping_){nullptr}
+    , decltype(_impl_.reduction_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_group_mapping()) {
+    _this->_impl_.group_mapping_ = new ::Mapping(*from._impl_.group_mapping_);
+  }
+  if (from._internal_has_value_mapping()) {
+    _this->_impl_.value_mapping_ = new ::Mapping(*from._impl_.value_mapping_);
+  }
+  if (from._internal_has_reduction()) {
+    _this->_impl_.reduction_ = new ::Reduction(*from._impl_.reduction_);
+  }
+  // @@protoc_insertion_point(copy_constructor:Builtin.GroupedMapReduce)
+}
+
+inline void Builtin_GroupedMapReduce::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.group_mapping_){nullptr}
+    , decltype(_impl_.value_mapping_){nullptr}
+    , decltype(_impl_.reduction_){nullptr}
+  };
+}
+
+Builtin_GroupedMapReduce::~Builtin_GroupedMapReduce() {
+  // @@protoc_insertion_point(destructor:Builtin.GroupedMapReduce)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Builtin_GroupedMapReduce::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.group_mapping_;
+  if (this != internal_default_instance()) delete _impl_.value_mapping_;
+  if (this != internal_default_instance()) delete _impl_.reduction_;
+}
+
+void Builtin_GroupedMapReduce::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Builtin_GroupedMapReduce::Clear() {
+// @@protoc_insertion_point(message_clear_start:Builtin.GroupedMapReduce)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.group_mapping_ != nullptr);
+      _impl_.group_mapping_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.value_mapping_ != nullptr);
+      _impl_.value_mapping_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.reduction_ != nullptr);
+      _impl_.reduction_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Builtin_GroupedMapReduce::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .Mapping group_mapping = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_group_mapping(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .Mapping value_mapping = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_value_mapping(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .Reduction reduction = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_reduction(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Builtin_GroupedMapReduce::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Builtin.GroupedMapReduce)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .Mapping group_mapping = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::group_mapping(this),
+        _Internal::group_mapping(this).GetCachedSize(), target, stream);
+  }
+
+  // required .Mapping value_mapping = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::value_mapping(this),
+        _Internal::value_mapping(this).GetCachedSize(), target, stream);
+  }
+
+  // required .Reduction reduction = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::reduction(this),
+        _Internal::reduction(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Builtin.GroupedMapReduce)
+  return target;
+}
+
+size_t Builtin_GroupedMapReduce::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:Builtin.GroupedMapReduce)
+  size_t total_size = 0;
+
+  if (_internal_has_group_mapping()) {
+    // required .Mapping group_mapping = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.group_mapping_);
+  }
+
+  if (_internal_has_value_mapping()) {
+    // required .Mapping value_mapping = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.value_mapping_);
+  }
+
+  if (_internal_has_reduction()) {
+    // required .Reduction reduction = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.reduction_);
+  }
+
+  return total_size;
+}
+size_t Builtin_GroupedMapReduce::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Builtin.GroupedMapReduce)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required .Mapping group_mapping = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.group_mapping_);
+
+    // required .Mapping value_mapping = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.value_mapping_);
+
+    // required .Reduction reduction = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.reduction_);
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Builtin_GroupedMapReduce::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Builtin_GroupedMapReduce::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Builtin_GroupedMapReduce::GetClassData() const { return &_class_data_; }
+
+
+void Builtin_GroupedMapReduce::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Builtin_GroupedMapReduce*>(&to_msg);
+  auto& from = static_cast<const Builtin_GroupedMapReduce&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Builtin.GroupedMapReduce)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_group_mapping()->::Mapping::MergeFrom(
+          from._internal_group_mapping());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_value_mapping()->::Mapping::MergeFrom(
+          from._internal_value_mapping());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_reduction()->::Reduction::MergeFrom(
+          from._internal_reduction());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Builtin_GroupedMapReduce::CopyFrom(const Builtin_GroupedMapReduce& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Builtin.GroupedMapReduce)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Builtin_GroupedMapReduce::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_group_mapping()) {
+    if (!_impl_.group_mapping_->IsInitialized()) return false;
+  }
+  if (_internal_has_value_mapping()) {
+    if (!_impl_.value_mapping_->IsInitialized()) return false;
+  }
+  if (_internal_has_reduction()) {
+    if (!_impl_.reduction_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Builtin_GroupedMapReduce::InternalSwap(Builtin_GroupedMapReduce* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Builtin_GroupedMapReduce, _impl_.reduction_)
+      + sizeof(Builtin_GroupedMapReduce::_impl_.reduction_)
+      - PROTOBUF_FIELD_OFFSET(Builtin_GroupedMapReduce, _impl_.group_mapping_)>(
+          reinterpret_cast<char*>(&_impl_.group_mapping_),
+          reinterpret_cast<char*>(&other->_impl_.group_mapping_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Builtin_GroupedMapReduce::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[12]);
+}
+
+// ===================================================================
+
+class Builtin_Range::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Builtin_Range>()._impl_._has_bits_);
+  static void set_has_attrname(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::Term& lowerbound(const Builtin_Range* msg);
+  static void set_has_lowerbound(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::Term& upperbound(const Builtin_Range* msg);
+  static void set_has_upperbound(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::Term&
+Builtin_Range::_Internal::lowerbound(const Builtin_Range* msg) {
+  return *msg->_impl_.lowerbound_;
+}
+const ::Term&
+Builtin_Range::_Internal::upperbound(const Builtin_Range* msg) {
+  return *msg->_impl_.upperbound_;
+}
+Builtin_Range::Builtin_Range(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Builtin.Range)
+}
+Builtin_Range::Builtin_Range(const Builtin_Range& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Builtin_Range* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.attrname_){}
+    , decltype(_impl_.lowerbound_){nullptr}
+    , decltype(_impl_.upperbound_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.attrname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.attrname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_attrname()) {
+    _this->_impl_.attrname_.Set(from._internal_attrname(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_lowerbound()) {
+    _this->_impl_.lowerbound_ = new ::Term(*from._impl_.lowerbound_);
+  }
+  if (from._internal_has_upperbound()) {
+    _this->_impl_.upperbound_ = new ::Term(*from._impl_.upperbound_);
+  }
+  // @@protoc_insertion_point(copy_constructor:Builtin.Range)
+}
+
+inline void Builtin_Range::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.attrname_){}
+    , decltype(_impl_.lowerbound_){nullptr}
+    , decltype(_impl_.upperbound_){nullptr}
+  };
+  _impl_.attrname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.attrname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Builtin_Range::~Builtin_Range() {
+  // @@protoc_insertion_point(destructor:Builtin.Range)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Builtin_Range::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.attrname_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.lowerbound_;
+  if (this != internal_default_instance()) delete _impl_.upperbound_;
+}
+
+void Builtin_Range::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Builtin_Range::Clear() {
+// @@protoc_insertion_point(message_clear_start:Builtin.Range)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.attrname_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.lowerbound_ != nullptr);
+      _impl_.lowerbound_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.upperbound_ != nullptr);
+      _impl_.upperbound_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Builtin_Range::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string attrname = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_attrname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "Builtin.Range.attrname");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Term lowerbound = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_lowerbound(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Term upperbound = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_upperbound(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Builtin_Range::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Builtin.Range)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string attrname = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_attrname().data(), static_cast<int>(this->_internal_attrname().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "Builtin.Range.attrname");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_attrname(), target);
+  }
+
+  // optional .Term lowerbound = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::lowerbound(this),
+        _Internal::lowerbound(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .Term upperbound = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::upperbound(this),
+        _Internal::upperbound(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Builtin.Range)
+  return target;
+}
+
+size_t Builtin_Range::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Builtin.Range)
+  size_t total_size = 0;
+
+  // required string attrname = 1;
+  if (_internal_has_attrname()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_attrname());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000006u) {
+    // optional .Term lowerbound = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.lowerbound_);
+    }
+
+    // optional .Term upperbound = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.upperbound_);
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Builtin_Range::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Builtin_Range::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Builtin_Range::GetClassData() const { return &_class_data_; }
+
+
+void Builtin_Range::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Builtin_Range*>(&to_msg);
+  auto& from = static_cast<const Builtin_Range&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Builtin.Range)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_attrname(from._internal_attrname());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_lowerbound()->::Term::MergeFrom(
+          from._internal_lowerbound());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_upperbound()->::Term::MergeFrom(
+          from._internal_upperbound());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Builtin_Range::CopyFrom(const Builtin_Range& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Builtin.Range)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Builtin_Range::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_lowerbound()) {
+    if (!_impl_.lowerbound_->IsInitialized()) return false;
+  }
+  if (_internal_has_upperbound()) {
+    if (!_impl_.upperbound_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Builtin_Range::InternalSwap(Builtin_Range* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.attrname_, lhs_arena,
+      &other->_impl_.attrname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Builtin_Range, _impl_.upperbound_)
+      + sizeof(Builtin_Range::_impl_.upperbound_)
+      - PROTOBUF_FIELD_OFFSET(Builtin_Range, _impl_.lowerbound_)>(
+          reinterpret_cast<char*>(&_impl_.lowerbound_),
+          reinterpret_cast<char*>(&other->_impl_.lowerbound_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Builtin_Range::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[13]);
+}
+
+// ===================================================================
+
+class Builtin::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Builtin>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_attr(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_comparison(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static const ::Builtin_Filter& filter(const Builtin* msg);
+  static void set_has_filter(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::Builtin_Map& map(const Builtin* msg);
+  static void set_has_map(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::Builtin_ConcatMap& concat_map(const Builtin* msg);
+  static void set_has_concat_map(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::Reduction& reduce(const Builtin* msg);
+  static void set_has_reduce(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::Builtin_GroupedMapReduce& grouped_map_reduce(const Builtin* msg);
+  static void set_has_grouped_map_reduce(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::Builtin_Range& range(const Builtin* msg);
+  static void set_has_range(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000080) ^ 0x00000080) != 0;
+  }
+};
+
+const ::Builtin_Filter&
+Builtin::_Internal::filter(const Builtin* msg) {
+  return *msg->_impl_.filter_;
+}
+const ::Builtin_Map&
+Builtin::_Internal::map(const Builtin* msg) {
+  return *msg->_impl_.map_;
+}
+const ::Builtin_ConcatMap&
+Builtin::_Internal::concat_map(const Builtin* msg) {
+  return *msg->_impl_.concat_map_;
+}
+const ::Reduction&
+Builtin::_Internal::reduce(const Builtin* msg) {
+  return *msg->_impl_.reduce_;
+}
+const ::Builtin_GroupedMapReduce&
+Builtin::_Internal::grouped_map_reduce(const Builtin* msg) {
+  return *msg->_impl_.grouped_map_reduce_;
+}
+const ::Builtin_Range&
+Builtin::_Internal::range(const Builtin* msg) {
+  return *msg->_impl_.range_;
+}
+Builtin::Builtin(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Builtin)
+}
+Builtin::Builtin(const Builtin& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Builtin* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.attrs_){from._impl_.attrs_}
+    , decltype(_impl_.order_by_){from._impl_.order_by_}
+    , decltype(_impl_.attr_){}
+    , decltype(_impl_.filter_){nullptr}
+    , decltype(_impl_.map_){nullptr}
+    , decltype(_impl_.concat_map_){nullptr}
+    , decltype(_impl_.reduce_){nullptr}
+    , decltype(_impl_.grouped_map_reduce_){nullptr}
+    , decltype(_impl_.range_){nullptr}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.comparison_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.attr_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.attr_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_attr()) {
+    _this->_impl_.attr_.Set(from._internal_attr(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_filter()) {
+    _this->_impl_.filter_ = new ::Builtin_Filter(*from._impl_.filter_);
+  }
+  if (from._internal_has_map()) {
+    _this->_impl_.map_ = new ::Builtin_Map(*from._impl_.map_);
+  }
+  if (from._internal_has_concat_map()) {
+    _this->_impl_.concat_map_ = new ::Builtin_ConcatMap(*from._impl_.concat_map_);
+  }
+  if (from._internal_has_reduce()) {
+    _this->_impl_.reduce_ = new ::Reduction(*from._impl_.reduce_);
+  }
+  if (from._internal_has_grouped_map_reduce()) {
+    _this->_impl_.grouped_map_reduce_ = new ::Builtin_GroupedMapReduce(*from._impl_.grouped_map_reduce_);
+  }
+  if (from._internal_has_range()) {
+    _this->_impl_.range_ = new ::Builtin_Range(*from._impl_.range_);
+  }
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.comparison_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.comparison_));
+  // @@protoc_insertion_point(copy_constructor:Builtin)
+}
+
+inline void Builtin::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.attrs_){arena}
+    , decltype(_impl_.order_by_){arena}
+    , decltype(_impl_.attr_){}
+    , decltype(_impl_.filter_){nullptr}
+    , decltype(_impl_.map_){nullptr}
+    , decltype(_impl_.concat_map_){nullptr}
+    , decltype(_impl_.reduce_){nullptr}
+    , decltype(_impl_.grouped_map_reduce_){nullptr}
+    , decltype(_impl_.range_){nullptr}
+    , decltype(_impl_.type_){1}
+    , decltype(_impl_.comparison_){1}
+  };
+  _impl_.attr_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.attr_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Builtin::~Builtin() {
+  // @@protoc_insertion_point(destructor:Builtin)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Builtin::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.attrs_.~RepeatedPtrField();
+  _impl_.order_by_.~RepeatedPtrField();
+  _impl_.attr_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.filter_;
+  if (this != internal_default_instance()) delete _impl_.map_;
+  if (this != internal_default_instance()) delete _impl_.concat_map_;
+  if (this != internal_default_instance()) delete _impl_.reduce_;
+  if (this != internal_default_instance()) delete _impl_.grouped_map_reduce_;
+  if (this != internal_default_instance()) delete _impl_.range_;
+}
+
+void Builtin::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Builtin::Clear() {
+// @@protoc_insertion_point(message_clear_start:Builtin)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.attrs_.Clear();
+  _impl_.order_by_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.attr_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.filter_ != nullptr);
+      _impl_.filter_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.map_ != nullptr);
+      _impl_.map_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.concat_map_ != nullptr);
+      _impl_.concat_map_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.reduce_ != nullptr);
+      _impl_.reduce_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.grouped_map_reduce_ != nullptr);
+      _impl_.grouped_map_reduce_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.range_ != nullptr);
+      _impl_.range_->Clear();
+    }
+    _impl_.type_ = 1;
+  }
+  _impl_.comparison_ = 1;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Builtin::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .Builtin.BuiltinType type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::Builtin_BuiltinType_IsValid(val))) {
+            _internal_set_type(static_cast<::Builtin_BuiltinType>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string attr = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_attr();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "Builtin.attr");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string attrs = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_attrs();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "Builtin.attrs");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Builtin.Comparison comparison = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::Builtin_Comparison_IsValid(val))) {
+            _internal_set_comparison(static_cast<::Builtin_Comparison>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(4, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Builtin.Filter filter = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_filter(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Builtin.Map map = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_map(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Builtin.ConcatMap concat_map = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_concat_map(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .Builtin.OrderBy order_by = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_order_by(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<66>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Reduction reduce = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_reduce(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Builtin.GroupedMapReduce grouped_map_reduce = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_grouped_map_reduce(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Builtin.Range range = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_range(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Builtin::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Builtin)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .Builtin.BuiltinType type = 1;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
+  }
+
+  // optional string attr = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_attr().data(), static_cast<int>(this->_internal_attr().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "Builtin.attr");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_attr(), target);
+  }
+
+  // repeated string attrs = 3;
+  for (int i = 0, n = this->_internal_attrs_size(); i < n; i++) {
+    const auto& s = this->_internal_attrs(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "Builtin.attrs");
+    target = stream->WriteString(3, s, target);
+  }
+
+  // optional .Builtin.Comparison comparison = 4;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_comparison(), target);
+  }
+
+  // optional .Builtin.Filter filter = 5;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::filter(this),
+        _Internal::filter(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .Builtin.Map map = 6;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::map(this),
+        _Internal::map(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .Builtin.ConcatMap concat_map = 7;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::concat_map(this),
+        _Internal::concat_map(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .Builtin.OrderBy order_by = 8;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_order_by_size()); i < n; i++) {
+    const auto& repfield = this->_internal_order_by(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(8, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional .Reduction reduce = 9;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::reduce(this),
+        _Internal::reduce(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .Builtin.GroupedMapReduce grouped_map_reduce = 10;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::grouped_map_reduce(this),
+        _Internal::grouped_map_reduce(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .Builtin.Range range = 11;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::range(this),
+        _Internal::range(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Builtin)
+  return target;
+}
+
+size_t Builtin::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Builtin)
+  size_t total_size = 0;
+
+  // required .Builtin.BuiltinType type = 1;
+  if (_internal_has_type()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string attrs = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.attrs_.size());
+  for (int i = 0, n = _impl_.attrs_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.attrs_.Get(i));
+  }
+
+  // repeated .Builtin.OrderBy order_by = 8;
+  total_size += 1UL * this->_internal_order_by_size();
+  for (const auto& msg : this->_impl_.order_by_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    // optional string attr = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_attr());
+    }
+
+    // optional .Builtin.Filter filter = 5;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.filter_);
+    }
+
+    // optional .Builtin.Map map = 6;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.map_);
+    }
+
+    // optional .Builtin.ConcatMap concat_map = 7;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.concat_map_);
+    }
+
+    // optional .Reduction reduce = 9;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.reduce_);
+    }
+
+    // optional .Builtin.GroupedMapReduce grouped_map_reduce = 10;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.grouped_map_reduce_);
+    }
+
+    // optional .Builtin.Range range = 11;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.range_);
+    }
+
+  }
+  // optional .Builtin.Comparison comparison = 4;
+  if (cached_has_bits & 0x00000100u) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_comparison());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Builtin::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Builtin::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Builtin::GetClassData() const { return &_class_data_; }
+
+
+void Builtin::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Builtin*>(&to_msg);
+  auto& from = static_cast<const Builtin&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Builtin)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.attrs_.MergeFrom(from._impl_.attrs_);
+  _this->_impl_.order_by_.MergeFrom(from._impl_.order_by_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_attr(from._internal_attr());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_filter()->::Builtin_Filter::MergeFrom(
+          from._internal_filter());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_map()->::Builtin_Map::MergeFrom(
+          from._internal_map());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_concat_map()->::Builtin_ConcatMap::MergeFrom(
+          from._internal_concat_map());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_reduce()->::Reduction::MergeFrom(
+          from._internal_reduce());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_grouped_map_reduce()->::Builtin_GroupedMapReduce::MergeFrom(
+          from._internal_grouped_map_reduce());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_range()->::Builtin_Range::MergeFrom(
+          from._internal_range());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_comparison(from._internal_comparison());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Builtin::CopyFrom(const Builtin& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Builtin)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Builtin::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.order_by_))
+    return false;
+  if (_internal_has_filter()) {
+    if (!_impl_.filter_->IsInitialized()) return false;
+  }
+  if (_internal_has_map()) {
+    if (!_impl_.map_->IsInitialized()) return false;
+  }
+  if (_internal_has_concat_map()) {
+    if (!_impl_.concat_map_->IsInitialized()) return false;
+  }
+  if (_internal_has_reduce()) {
+    if (!_impl_.reduce_->IsInitialized()) return false;
+  }
+  if (_internal_has_grouped_map_reduce()) {
+    if (!_impl_.grouped_map_reduce_->IsInitialized()) return false;
+  }
+  if (_internal_has_range()) {
+    if (!_impl_.range_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Builtin::InternalSwap(Builtin* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.attrs_.InternalSwap(&other->_impl_.attrs_);
+  _impl_.order_by_.InternalSwap(&other->_impl_.order_by_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.attr_, lhs_arena,
+      &other->_impl_.attr_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Builtin, _impl_.range_)
+      + sizeof(Builtin::_impl_.range_)
+      - PROTOBUF_FIELD_OFFSET(Builtin, _impl_.filter_)>(
+          reinterpret_cast<char*>(&_impl_.filter_),
+          reinterpret_cast<char*>(&other->_impl_.filter_));
+  swap(_impl_.type_, other->_impl_.type_);
+  swap(_impl_.comparison_, other->_impl_.comparison_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Builtin::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[14]);
+}
+
+// ===================================================================
+
+class Reduction::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Reduction>()._impl_._has_bits_);
+  static const ::Term& base(const Reduction* msg);
+  static void set_has_base(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_var1(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_var2(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::Term& body(const Reduction* msg);
+  static void set_has_body(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+const ::Term&
+Reduction::_Internal::base(const Reduction* msg) {
+  return *msg->_impl_.base_;
+}
+const ::Term&
+Reduction::_Internal::body(const Reduction* msg) {
+  return *msg->_impl_.body_;
+}
+Reduction::Reduction(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Reduction)
+}
+Reduction::Reduction(const Reduction& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Reduction* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.var1_){}
+    , decltype(_impl_.var2_){}
+    , decltype(_impl_.base_){nullptr}
+    , decltype(_impl_.body_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.var1_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.var1_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_var1()) {
+    _this->_impl_.var1_.Set(from._internal_var1(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.var2_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.var2_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_var2()) {
+    _this->_impl_.var2_.Set(from._internal_var2(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_base()) {
+    _this->_impl_.base_ = new ::Term(*from._impl_.base_);
+  }
+  if (from._internal_has_body()) {
+    _this->_impl_.body_ = new ::Term(*from._impl_.body_);
+  }
+  // @@protoc_insertion_point(copy_constructor:Reduction)
+}
+
+inline void Reduction::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.var1_){}
+    , decltype(_impl_.var2_){}
+    , decltype(_impl_.base_){nullptr}
+    , decltype(_impl_.body_){nullptr}
+  };
+  _impl_.var1_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.var1_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.var2_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.var2_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Reduction::~Reduction() {
+  // @@protoc_insertion_point(destructor:Reduction)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Reduction::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.var1_.Destroy();
+  _impl_.var2_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.base_;
+  if (this != internal_default_instance()) delete _impl_.body_;
+}
+
+void Reduction::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Reduction::Clear() {
+// @@protoc_insertion_point(message_clear_start:Reduction)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.var1_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.var2_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.base_ != nullptr);
+      _impl_.base_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.body_ != nullptr);
+      _impl_.body_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Reduction::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .Term base = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_base(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string var1 = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_var1();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "Reduction.var1");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string var2 = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_var2();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "Reduction.var2");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required .Term body = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_body(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Reduction::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Reduction)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .Term base = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::base(this),
+        _Internal::base(this).GetCachedSize(), target, stream);
+  }
+
+  // required string var1 = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_var1().data(), static_cast<int>(this->_internal_var1().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "Reduction.var1");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_var1(), target);
+  }
+
+  // required string var2 = 3;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_var2().data(), static_cast<int>(this->_internal_var2().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "Reduction.var2");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_var2(), target);
+  }
+
+  // required .Term body = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::body(this),
+        _Internal::body(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Reduction)
+  return target;
+}
+
+size_t Reduction::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:Reduction)
+  size_t total_size = 0;
+
+  if (_internal_has_var1()) {
+    // required string var1 = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_var1());
+  }
+
+  if (_internal_has_var2()) {
+    // required string var2 = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_var2());
+  }
+
+  if (_internal_has_base()) {
+    // required .Term base = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.base_);
+  }
+
+  if (_internal_has_body()) {
+    // required .Term body = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.body_);
+  }
+
+  return total_size;
+}
+size_t Reduction::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Reduction)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required string var1 = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_var1());
+
+    // required string var2 = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_var2());
+
+    // required .Term base = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.base_);
+
+    // required .Term body = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.body_);
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Reduction::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Reduction::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Reduction::GetClassData() const { return &_class_data_; }
+
+
+void Reduction::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Reduction*>(&to_msg);
+  auto& from = static_cast<const Reduction&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Reduction)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_var1(from._internal_var1());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_var2(from._internal_var2());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_base()->::Term::MergeFrom(
+          from._internal_base());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_body()->::Term::MergeFrom(
+          from._internal_body());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Reduction::CopyFrom(const Reduction& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Reduction)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Reduction::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_base()) {
+    if (!_impl_.base_->IsInitialized()) return false;
+  }
+  if (_internal_has_body()) {
+    if (!_impl_.body_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Reduction::InternalSwap(Reduction* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.var1_, lhs_arena,
+      &other->_impl_.var1_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.var2_, lhs_arena,
+      &other->_impl_.var2_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Reduction, _impl_.body_)
+      + sizeof(Reduction::_impl_.body_)
+      - PROTOBUF_FIELD_OFFSET(Reduction, _impl_.base_)>(
+          reinterpret_cast<char*>(&_impl_.base_),
+          reinterpret_cast<char*>(&other->_impl_.base_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Reduction::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[15]);
+}
+
+// ===================================================================
+
+class Mapping::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Mapping>()._impl_._has_bits_);
+  static void set_has_arg(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::Term& body(const Mapping* msg);
+  static void set_has_body(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+const ::Term&
+Mapping::_Internal::body(const Mapping* msg) {
+  return *msg->_impl_.body_;
+}
+Mapping::Mapping(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Mapping)
+}
+Mapping::Mapping(const Mapping& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Mapping* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_._extensions_)*/{}
+    , decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.arg_){}
+    , decltype(_impl_.body_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_._extensions_.MergeFrom(internal_default_instance(), from._impl_._extensions_);
+  _impl_.arg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.arg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_arg()) {
+    _this->_impl_.arg_.Set(from._internal_arg(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_body()) {
+    _this->_impl_.body_ = new ::Term(*from._impl_.body_);
+  }
+  // @@protoc_insertion_point(copy_constructor:Mapping)
+}
+
+inline void Mapping::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_._extensions_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.arg_){}
+    , decltype(_impl_.body_){nullptr}
+  };
+  _impl_.arg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.arg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Mapping::~Mapping() {
+  // @@protoc_insertion_point(destructor:Mapping)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Mapping::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_._extensions_.~ExtensionSet();
+  _impl_.arg_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.body_;
+}
+
+void Mapping::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Mapping::Clear() {
+// @@protoc_insertion_point(message_clear_start:Mapping)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_._extensions_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.arg_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.body_ != nullptr);
+      _impl_.body_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Mapping::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string arg = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_arg();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "Mapping.arg");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required .Term body = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_body(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    if ((8000u <= tag && tag < 8800u)) {
+      ptr = _impl_._extensions_.ParseField(tag, ptr, internal_default_instance(), &_internal_metadata_, ctx);
+      CHK_(ptr != nullptr);
+      continue;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Mapping::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Mapping)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string arg = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_arg().data(), static_cast<int>(this->_internal_arg().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "Mapping.arg");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_arg(), target);
+  }
+
+  // required .Term body = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::body(this),
+        _Internal::body(this).GetCachedSize(), target, stream);
+  }
+
+  // Extension range [1000, 1100)
+  target = _impl_._extensions_._InternalSerialize(
+  internal_default_instance(), 1000, 1100, target, stream);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Mapping)
+  return target;
+}
+
+size_t Mapping::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:Mapping)
+  size_t total_size = 0;
+
+  if (_internal_has_arg()) {
+    // required string arg = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_arg());
+  }
+
+  if (_internal_has_body()) {
+    // required .Term body = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.body_);
+  }
+
+  return total_size;
+}
+size_t Mapping::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Mapping)
+  size_t total_size = 0;
+
+  total_size += _impl_._extensions_.ByteSize();
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string arg = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_arg());
+
+    // required .Term body = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.body_);
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Mapping::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Mapping::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Mapping::GetClassData() const { return &_class_data_; }
+
+
+void Mapping::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Mapping*>(&to_msg);
+  auto& from = static_cast<const Mapping&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Mapping)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_arg(from._internal_arg());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_body()->::Term::MergeFrom(
+          from._internal_body());
+    }
+  }
+  _this->_impl_._extensions_.MergeFrom(internal_default_instance(), from._impl_._extensions_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Mapping::CopyFrom(const Mapping& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Mapping)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Mapping::IsInitialized() const {
+  if (!_impl_._extensions_.IsInitialized()) {
+    return false;
+  }
+
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_body()) {
+    if (!_impl_.body_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Mapping::InternalSwap(Mapping* other) {
+  using std::swap;
+  _impl_._extensions_.InternalSwap(&other->_impl_._extensions_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.arg_, lhs_arena,
+      &other->_impl_.arg_, rhs_arena
+  );
+  swap(_impl_.body_, other->_impl_.body_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Mapping::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[16]);
+}
+
+// ===================================================================
+
+class Predicate::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Predicate>()._impl_._has_bits_);
+  static void set_has_arg(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::Term& body(const Predicate* msg);
+  static void set_has_body(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+const ::Term&
+Predicate::_Internal::body(const Predicate* msg) {
+  return *msg->_impl_.body_;
+}
+Predicate::Predicate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Predicate)
+}
+Predicate::Predicate(const Predicate& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Predicate* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.arg_){}
+    , decltype(_impl_.body_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.arg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.arg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_arg()) {
+    _this->_impl_.arg_.Set(from._internal_arg(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_body()) {
+    _this->_impl_.body_ = new ::Term(*from._impl_.body_);
+  }
+  // @@protoc_insertion_point(copy_constructor:Predicate)
+}
+
+inline void Predicate::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.arg_){}
+    , decltype(_impl_.body_){nullptr}
+  };
+  _impl_.arg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.arg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Predicate::~Predicate() {
+  // @@protoc_insertion_point(destructor:Predicate)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Predicate::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.arg_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.body_;
+}
+
+void Predicate::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Predicate::Clear() {
+// @@protoc_insertion_point(message_clear_start:Predicate)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.arg_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.body_ != nullptr);
+      _impl_.body_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Predicate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string arg = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_arg();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "Predicate.arg");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required .Term body = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_body(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Predicate::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Predicate)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string arg = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_arg().data(), static_cast<int>(this->_internal_arg().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "Predicate.arg");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_arg(), target);
+  }
+
+  // required .Term body = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::body(this),
+        _Internal::body(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Predicate)
+  return target;
+}
+
+size_t Predicate::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:Predicate)
+  size_t total_size = 0;
+
+  if (_internal_has_arg()) {
+    // required string arg = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_arg());
+  }
+
+  if (_internal_has_body()) {
+    // required .Term body = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.body_);
+  }
+
+  return total_size;
+}
+size_t Predicate::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Predicate)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string arg = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_arg());
+
+    // required .Term body = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.body_);
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Predicate::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Predicate::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Predicate::GetClassData() const { return &_class_data_; }
+
+
+void Predicate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Predicate*>(&to_msg);
+  auto& from = static_cast<const Predicate&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Predicate)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_arg(from._internal_arg());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_body()->::Term::MergeFrom(
+          from._internal_body());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Predicate::CopyFrom(const Predicate& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Predicate)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Predicate::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_body()) {
+    if (!_impl_.body_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Predicate::InternalSwap(Predicate* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.arg_, lhs_arena,
+      &other->_impl_.arg_, rhs_arena
+  );
+  swap(_impl_.body_, other->_impl_.body_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Predicate::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[17]);
+}
+
+// ===================================================================
+
+class ReadQuery::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ReadQuery>()._impl_._has_bits_);
+  static const ::Term& term(const ReadQuery* msg);
+  static void set_has_term(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_max_chunk_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_max_age(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::Term&
+ReadQuery::_Internal::term(const ReadQuery* msg) {
+  return *msg->_impl_.term_;
+}
+ReadQuery::ReadQuery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ReadQuery)
+}
+ReadQuery::ReadQuery(const ReadQuery& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReadQuery* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_._extensions_)*/{}
+    , decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.term_){nullptr}
+    , decltype(_impl_.max_chunk_size_){}
+    , decltype(_impl_.max_age_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_._extensions_.MergeFrom(internal_default_instance(), from._impl_._extensions_);
+  if (from._internal_has_term()) {
+    _this->_impl_.term_ = new ::Term(*from._impl_.term_);
+  }
+  ::memcpy(&_impl_.max_chunk_size_, &from._impl_.max_chunk_size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_age_) -
+    reinterpret_cast<char*>(&_impl_.max_chunk_size_)) + sizeof(_impl_.max_age_));
+  // @@protoc_insertion_point(copy_constructor:ReadQuery)
+}
+
+inline void ReadQuery::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_._extensions_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.term_){nullptr}
+    , decltype(_impl_.max_chunk_size_){int64_t{0}}
+    , decltype(_impl_.max_age_){int64_t{0}}
+  };
+}
+
+ReadQuery::~ReadQuery() {
+  // @@protoc_insertion_point(destructor:ReadQuery)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReadQuery::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_._extensions_.~ExtensionSet();
+  if (this != internal_default_instance()) delete _impl_.term_;
+}
+
+void ReadQuery::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReadQuery::Clear() {
+// @@protoc_insertion_point(message_clear_start:ReadQuery)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_._extensions_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.term_ != nullptr);
+    _impl_.term_->Clear();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.max_chunk_size_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.max_age_) -
+        reinterpret_cast<char*>(&_impl_.max_chunk_size_)) + sizeof(_impl_.max_age_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReadQuery::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .Term term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_term(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int64 max_chunk_size = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_max_chunk_size(&has_bits);
+          _impl_.max_chunk_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int64 max_age = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_max_age(&has_bits);
+          _impl_.max_age_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    if ((8000u <= tag && tag < 8800u)) {
+      ptr = _impl_._extensions_.ParseField(tag, ptr, internal_default_instance(), &_internal_metadata_, ctx);
+      CHK_(ptr != nullptr);
+      continue;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReadQuery::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ReadQuery)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .Term term = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::term(this),
+        _Internal::term(this).GetCachedSize(), target, stream);
+  }
+
+  // optional int64 max_chunk_size = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_max_chunk_size(), target);
+  }
+
+  // optional int64 max_age = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_max_age(), target);
+  }
+
+  // Extension range [1000, 1100)
+  target = _impl_._extensions_._InternalSerialize(
+  internal_default_instance(), 1000, 1100, target, stream);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ReadQuery)
+  return target;
+}
+
+size_t ReadQuery::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ReadQuery)
+  size_t total_size = 0;
+
+  total_size += _impl_._extensions_.ByteSize();
+
+  // required .Term term = 1;
+  if (_internal_has_term()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.term_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000006u) {
+    // optional int64 max_chunk_size = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_max_chunk_size());
+    }
+
+    // optional int64 max_age = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_max_age());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadQuery::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReadQuery::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadQuery::GetClassData() const { return &_class_data_; }
+
+
+void ReadQuery::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReadQuery*>(&to_msg);
+  auto& from = static_cast<const ReadQuery&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ReadQuery)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_term()->::Term::MergeFrom(
+          from._internal_term());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.max_chunk_size_ = from._impl_.max_chunk_size_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.max_age_ = from._impl_.max_age_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_impl_._extensions_.MergeFrom(internal_default_instance(), from._impl_._extensions_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReadQuery::CopyFrom(const ReadQuery& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ReadQuery)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReadQuery::IsInitialized() const {
+  if (!_impl_._extensions_.IsInitialized()) {
+    return false;
+  }
+
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_term()) {
+    if (!_impl_.term_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void ReadQuery::InternalSwap(ReadQuery* other) {
+  using std::swap;
+  _impl_._extensions_.InternalSwap(&other->_impl_._extensions_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReadQuery, _impl_.max_age_)
+      + sizeof(ReadQuery::_impl_.max_age_)
+      - PROTOBUF_FIELD_OFFSET(ReadQuery, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReadQuery::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[18]);
+}
+
+// ===================================================================
+
+class WriteQuery_Update::_Internal {
+ public:
+  using HasBits = decltype(std::declval<WriteQuery_Update>()._impl_._has_bits_);
+  static const ::Term& view(const WriteQuery_Update* msg);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::Mapping& mapping(const WriteQuery_Update* msg);
+  static void set_has_mapping(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+const ::Term&
+WriteQuery_Update::_Internal::view(const WriteQuery_Update* msg) {
+  return *msg->_impl_.view_;
+}
+const ::Mapping&
+WriteQuery_Update::_Internal::mapping(const WriteQuery_Update* msg) {
+  return *msg->_impl_.mapping_;
+}
+WriteQuery_Update::WriteQuery_Update(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:WriteQuery.Update)
+}
+WriteQuery_Update::WriteQuery_Update(const WriteQuery_Update& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteQuery_Update* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){nullptr}
+    , decltype(_impl_.mapping_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_view()) {
+    _this->_impl_.view_ = new ::Term(*from._impl_.view_);
+  }
+  if (from._internal_has_mapping()) {
+    _this->_impl_.mapping_ = new ::Mapping(*from._impl_.mapping_);
+  }
+  // @@protoc_insertion_point(copy_constructor:WriteQuery.Update)
+}
+
+inline void WriteQuery_Update::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){nullptr}
+    , decltype(_impl_.mapping_){nullptr}
+  };
+}
+
+WriteQuery_Update::~WriteQuery_Update() {
+  // @@protoc_insertion_point(destructor:WriteQuery.Update)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WriteQuery_Update::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.view_;
+  if (this != internal_default_instance()) delete _impl_.mapping_;
+}
+
+void WriteQuery_Update::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WriteQuery_Update::Clear() {
+// @@protoc_insertion_point(message_clear_start:WriteQuery.Update)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.view_ != nullptr);
+      _impl_.view_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.mapping_ != nullptr);
+      _impl_.mapping_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WriteQuery_Update::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .Term view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_view(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .Mapping mapping = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_mapping(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WriteQuery_Update::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:WriteQuery.Update)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .Term view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::view(this),
+        _Internal::view(this).GetCachedSize(), target, stream);
+  }
+
+  // required .Mapping mapping = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::mapping(this),
+        _Internal::mapping(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:WriteQuery.Update)
+  return target;
+}
+
+size_t WriteQuery_Update::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:WriteQuery.Update)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required .Term view = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.view_);
+  }
+
+  if (_internal_has_mapping()) {
+    // required .Mapping mapping = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.mapping_);
+  }
+
+  return total_size;
+}
+size_t WriteQuery_Update::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:WriteQuery.Update)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required .Term view = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.view_);
+
+    // required .Mapping mapping = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.mapping_);
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteQuery_Update::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteQuery_Update::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteQuery_Update::GetClassData() const { return &_class_data_; }
+
+
+void WriteQuery_Update::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteQuery_Update*>(&to_msg);
+  auto& from = static_cast<const WriteQuery_Update&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:WriteQuery.Update)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_view()->::Term::MergeFrom(
+          from._internal_view());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_mapping()->::Mapping::MergeFrom(
+          from._internal_mapping());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WriteQuery_Update::CopyFrom(const WriteQuery_Update& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:WriteQuery.Update)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteQuery_Update::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_view()) {
+    if (!_impl_.view_->IsInitialized()) return false;
+  }
+  if (_internal_has_mapping()) {
+    if (!_impl_.mapping_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void WriteQuery_Update::InternalSwap(WriteQuery_Update* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WriteQuery_Update, _impl_.mapping_)
+      + sizeof(WriteQuery_Update::_impl_.mapping_)
+      - PROTOBUF_FIELD_OFFSET(WriteQuery_Update, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WriteQuery_Update::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[19]);
+}
+
+// ===================================================================
+
+class WriteQuery_Delete::_Internal {
+ public:
+  using HasBits = decltype(std::declval<WriteQuery_Delete>()._impl_._has_bits_);
+  static const ::Term& view(const WriteQuery_Delete* msg);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::Term&
+WriteQuery_Delete::_Internal::view(const WriteQuery_Delete* msg) {
+  return *msg->_impl_.view_;
+}
+WriteQuery_Delete::WriteQuery_Delete(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:WriteQuery.Delete)
+}
+WriteQuery_Delete::WriteQuery_Delete(const WriteQuery_Delete& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteQuery_Delete* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_view()) {
+    _this->_impl_.view_ = new ::Term(*from._impl_.view_);
+  }
+  // @@protoc_insertion_point(copy_constructor:WriteQuery.Delete)
+}
+
+inline void WriteQuery_Delete::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){nullptr}
+  };
+}
+
+WriteQuery_Delete::~WriteQuery_Delete() {
+  // @@protoc_insertion_point(destructor:WriteQuery.Delete)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WriteQuery_Delete::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.view_;
+}
+
+void WriteQuery_Delete::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WriteQuery_Delete::Clear() {
+// @@protoc_insertion_point(message_clear_start:WriteQuery.Delete)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.view_ != nullptr);
+    _impl_.view_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WriteQuery_Delete::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .Term view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_view(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WriteQuery_Delete::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:WriteQuery.Delete)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .Term view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::view(this),
+        _Internal::view(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:WriteQuery.Delete)
+  return target;
+}
+
+size_t WriteQuery_Delete::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:WriteQuery.Delete)
+  size_t total_size = 0;
+
+  // required .Term view = 1;
+  if (_internal_has_view()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.view_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteQuery_Delete::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteQuery_Delete::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteQuery_Delete::GetClassData() const { return &_class_data_; }
+
+
+void WriteQuery_Delete::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteQuery_Delete*>(&to_msg);
+  auto& from = static_cast<const WriteQuery_Delete&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:WriteQuery.Delete)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_view()) {
+    _this->_internal_mutable_view()->::Term::MergeFrom(
+        from._internal_view());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WriteQuery_Delete::CopyFrom(const WriteQuery_Delete& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:WriteQuery.Delete)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteQuery_Delete::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_view()) {
+    if (!_impl_.view_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void WriteQuery_Delete::InternalSwap(WriteQuery_Delete* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.view_, other->_impl_.view_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WriteQuery_Delete::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[20]);
+}
+
+// ===================================================================
+
+class WriteQuery_Mutate::_Internal {
+ public:
+  using HasBits = decltype(std::declval<WriteQuery_Mutate>()._impl_._has_bits_);
+  static const ::Term& view(const WriteQuery_Mutate* msg);
+  static void set_has_view(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::Mapping& mapping(const WriteQuery_Mutate* msg);
+  static void set_has_mapping(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+const ::Term&
+WriteQuery_Mutate::_Internal::view(const WriteQuery_Mutate* msg) {
+  return *msg->_impl_.view_;
+}
+const ::Mapping&
+WriteQuery_Mutate::_Internal::mapping(const WriteQuery_Mutate* msg) {
+  return *msg->_impl_.mapping_;
+}
+WriteQuery_Mutate::WriteQuery_Mutate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:WriteQuery.Mutate)
+}
+WriteQuery_Mutate::WriteQuery_Mutate(const WriteQuery_Mutate& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteQuery_Mutate* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){nullptr}
+    , decltype(_impl_.mapping_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_view()) {
+    _this->_impl_.view_ = new ::Term(*from._impl_.view_);
+  }
+  if (from._internal_has_mapping()) {
+    _this->_impl_.mapping_ = new ::Mapping(*from._impl_.mapping_);
+  }
+  // @@protoc_insertion_point(copy_constructor:WriteQuery.Mutate)
+}
+
+inline void WriteQuery_Mutate::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.view_){nullptr}
+    , decltype(_impl_.mapping_){nullptr}
+  };
+}
+
+WriteQuery_Mutate::~WriteQuery_Mutate() {
+  // @@protoc_insertion_point(destructor:WriteQuery.Mutate)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WriteQuery_Mutate::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.view_;
+  if (this != internal_default_instance()) delete _impl_.mapping_;
+}
+
+void WriteQuery_Mutate::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WriteQuery_Mutate::Clear() {
+// @@protoc_insertion_point(message_clear_start:WriteQuery.Mutate)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.view_ != nullptr);
+      _impl_.view_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.mapping_ != nullptr);
+      _impl_.mapping_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WriteQuery_Mutate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .Term view = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_view(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .Mapping mapping = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_mapping(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WriteQuery_Mutate::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:WriteQuery.Mutate)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .Term view = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::view(this),
+        _Internal::view(this).GetCachedSize(), target, stream);
+  }
+
+  // required .Mapping mapping = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::mapping(this),
+        _Internal::mapping(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:WriteQuery.Mutate)
+  return target;
+}
+
+size_t WriteQuery_Mutate::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:WriteQuery.Mutate)
+  size_t total_size = 0;
+
+  if (_internal_has_view()) {
+    // required .Term view = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.view_);
+  }
+
+  if (_internal_has_mapping()) {
+    // required .Mapping mapping = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.mapping_);
+  }
+
+  return total_size;
+}
+size_t WriteQuery_Mutate::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:WriteQuery.Mutate)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required .Term view = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.view_);
+
+    // required .Mapping mapping = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.mapping_);
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteQuery_Mutate::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteQuery_Mutate::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteQuery_Mutate::GetClassData() const { return &_class_data_; }
+
+
+void WriteQuery_Mutate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteQuery_Mutate*>(&to_msg);
+  auto& from = static_cast<const WriteQuery_Mutate&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:WriteQuery.Mutate)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_view()->::Term::MergeFrom(
+          from._internal_view());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_mapping()->::Mapping::MergeFrom(
+          from._internal_mapping());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WriteQuery_Mutate::CopyFrom(const WriteQuery_Mutate& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:WriteQuery.Mutate)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteQuery_Mutate::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_view()) {
+    if (!_impl_.view_->IsInitialized()) return false;
+  }
+  if (_internal_has_mapping()) {
+    if (!_impl_.mapping_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void WriteQuery_Mutate::InternalSwap(WriteQuery_Mutate* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WriteQuery_Mutate, _impl_.mapping_)
+      + sizeof(WriteQuery_Mutate::_impl_.mapping_)
+      - PROTOBUF_FIELD_OFFSET(WriteQuery_Mutate, _impl_.view_)>(
+          reinterpret_cast<char*>(&_impl_.view_),
+          reinterpret_cast<char*>(&other->_impl_.view_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WriteQuery_Mutate::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[21]);
+}
+
+// ===================================================================
+
+class WriteQuery_Insert::_Internal {
+ public:
+  using HasBits = decltype(std::declval<WriteQuery_Insert>()._impl_._has_bits_);
+  static const ::TableRef& table_ref(const WriteQuery_Insert* msg);
+  static void set_has_table_ref(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_overwrite(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::TableRef&
+WriteQuery_Insert::_Internal::table_ref(const WriteQuery_Insert* msg) {
+  return *msg->_impl_.table_ref_;
+}
+WriteQuery_Insert::WriteQuery_Insert(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:WriteQuery.Insert)
+}
+WriteQuery_Insert::WriteQuery_Insert(const WriteQuery_Insert& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteQuery_Insert* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.terms_){from._impl_.terms_}
+    , decltype(_impl_.table_ref_){nullptr}
+    , decltype(_impl_.overwrite_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_table_ref()) {
+    _this->_impl_.table_ref_ = new ::TableRef(*from._impl_.table_ref_);
+  }
+  _this->_impl_.overwrite_ = from._impl_.overwrite_;
+  // @@protoc_insertion_point(copy_constructor:WriteQuery.Insert)
+}
+
+inline void WriteQuery_Insert::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.terms_){arena}
+    , decltype(_impl_.table_ref_){nullptr}
+    , decltype(_impl_.overwrite_){false}
+  };
+}
+
+WriteQuery_Insert::~WriteQuery_Insert() {
+  // @@protoc_insertion_point(destructor:WriteQuery.Insert)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WriteQuery_Insert::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.terms_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.table_ref_;
+}
+
+void WriteQuery_Insert::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WriteQuery_Insert::Clear() {
+// @@protoc_insertion_point(message_clear_start:WriteQuery.Insert)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.terms_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.table_ref_ != nullptr);
+    _impl_.table_ref_->Clear();
+  }
+  _impl_.overwrite_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WriteQuery_Insert::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .TableRef table_ref = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_table_ref(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .Term terms = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_terms(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool overwrite = 3 [default = false];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_overwrite(&has_bits);
+          _impl_.overwrite_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WriteQuery_Insert::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:WriteQuery.Insert)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .TableRef table_ref = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::table_ref(this),
+        _Internal::table_ref(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .Term terms = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_terms_size()); i < n; i++) {
+    const auto& repfield = this->_internal_terms(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional bool overwrite = 3 [default = false];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_overwrite(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:WriteQuery.Insert)
+  return target;
+}
+
+size_t WriteQuery_Insert::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:WriteQuery.Insert)
+  size_t total_size = 0;
+
+  // required .TableRef table_ref = 1;
+  if (_internal_has_table_ref()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.table_ref_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .Term terms = 2;
+  total_size += 1UL * this->_internal_terms_size();
+  for (const auto& msg : this->_impl_.terms_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional bool overwrite = 3 [default = false];
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteQuery_Insert::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteQuery_Insert::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteQuery_Insert::GetClassData() const { return &_class_data_; }
+
+
+void WriteQuery_Insert::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteQuery_Insert*>(&to_msg);
+  auto& from = static_cast<const WriteQuery_Insert&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:WriteQuery.Insert)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.terms_.MergeFrom(from._impl_.terms_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_table_ref()->::TableRef::MergeFrom(
+          from._internal_table_ref());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.overwrite_ = from._impl_.overwrite_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WriteQuery_Insert::CopyFrom(const WriteQuery_Insert& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:WriteQuery.Insert)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteQuery_Insert::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.terms_))
+    return false;
+  if (_internal_has_table_ref()) {
+    if (!_impl_.table_ref_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void WriteQuery_Insert::InternalSwap(WriteQuery_Insert* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.terms_.InternalSwap(&other->_impl_.terms_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WriteQuery_Insert, _impl_.overwrite_)
+      + sizeof(WriteQuery_Insert::_impl_.overwrite_)
+      - PROTOBUF_FIELD_OFFSET(WriteQuery_Insert, _impl_.table_ref_)>(
+          reinterpret_cast<char*>(&_impl_.table_ref_),
+          reinterpret_cast<char*>(&other->_impl_.table_ref_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WriteQuery_Insert::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[22]);
+}
+
+// ===================================================================
+
+class WriteQuery_ForEach::_Internal {
+ public:
+  using HasBits = decltype(std::declval<WriteQuery_ForEach>()._impl_._has_bits_);
+  static const ::Term& stream(const WriteQuery_ForEach* msg);
+  static void set_has_stream(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_var(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+const ::Term&
+WriteQuery_ForEach::_Internal::stream(const WriteQuery_ForEach* msg) {
+  return *msg->_impl_.stream_;
+}
+WriteQuery_ForEach::WriteQuery_ForEach(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:WriteQuery.ForEach)
+}
+WriteQuery_ForEach::WriteQuery_ForEach(const WriteQuery_ForEach& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteQuery_ForEach* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.queries_){from._impl_.queries_}
+    , decltype(_impl_.var_){}
+    , decltype(_impl_.stream_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.var_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.var_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_var()) {
+    _this->_impl_.var_.Set(from._internal_var(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_stream()) {
+    _this->_impl_.stream_ = new ::Term(*from._impl_.stream_);
+  }
+  // @@protoc_insertion_point(copy_constructor:WriteQuery.ForEach)
+}
+
+inline void WriteQuery_ForEach::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.queries_){arena}
+    , decltype(_impl_.var_){}
+    , decltype(_impl_.stream_){nullptr}
+  };
+  _impl_.var_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.var_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+WriteQuery_ForEach::~WriteQuery_ForEach() {
+  // @@protoc_insertion_point(destructor:WriteQuery.ForEach)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WriteQuery_ForEach::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.queries_.~RepeatedPtrField();
+  _impl_.var_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.stream_;
+}
+
+void WriteQuery_ForEach::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WriteQuery_ForEach::Clear() {
+// @@protoc_insertion_point(message_clear_start:WriteQuery.ForEach)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.queries_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.var_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.stream_ != nullptr);
+      _impl_.stream_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WriteQuery_ForEach::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .Term stream = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_stream(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string var = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_var();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "WriteQuery.ForEach.var");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .WriteQuery queries = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_queries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WriteQuery_ForEach::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:WriteQuery.ForEach)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .Term stream = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::stream(this),
+        _Internal::stream(this).GetCachedSize(), target, stream);
+  }
+
+  // required string var = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_var().data(), static_cast<int>(this->_internal_var().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "WriteQuery.ForEach.var");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_var(), target);
+  }
+
+  // repeated .WriteQuery queries = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_queries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_queries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:WriteQuery.ForEach)
+  return target;
+}
+
+size_t WriteQuery_ForEach::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:WriteQuery.ForEach)
+  size_t total_size = 0;
+
+  if (_internal_has_var()) {
+    // required string var = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_var());
+  }
+
+  if (_internal_has_stream()) {
+    // required .Term stream = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.stream_);
+  }
+
+  return total_size;
+}
+size_t WriteQuery_ForEach::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:WriteQuery.ForEach)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string var = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_var());
+
+    // required .Term stream = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.stream_);
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .WriteQuery queries = 3;
+  total_size += 1UL * this->_internal_queries_size();
+  for (const auto& msg : this->_impl_.queries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteQuery_ForEach::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteQuery_ForEach::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteQuery_ForEach::GetClassData() const { return &_class_data_; }
+
+
+void WriteQuery_ForEach::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteQuery_ForEach*>(&to_msg);
+  auto& from = static_cast<const WriteQuery_ForEach&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:WriteQuery.ForEach)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.queries_.MergeFrom(from._impl_.queries_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_var(from._internal_var());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_stream()->::Term::MergeFrom(
+          from._internal_stream());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WriteQuery_ForEach::CopyFrom(const WriteQuery_ForEach& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:WriteQuery.ForEach)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteQuery_ForEach::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.queries_))
+    return false;
+  if (_internal_has_stream()) {
+    if (!_impl_.stream_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void WriteQuery_ForEach::InternalSwap(WriteQuery_ForEach* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.queries_.InternalSwap(&other->_impl_.queries_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.var_, lhs_arena,
+      &other->_impl_.var_, rhs_arena
+  );
+  swap(_impl_.stream_, other->_impl_.stream_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WriteQuery_ForEach::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[23]);
+}
+
+// ===================================================================
+
+class WriteQuery_PointUpdate::_Internal {
+ public:
+  using HasBits = decltype(std::declval<WriteQuery_PointUpdate>()._impl_._has_bits_);
+  static const ::TableRef& table_ref(const WriteQuery_PointUpdate* msg);
+  static void set_has_table_ref(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_attrname(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::Term& key(const WriteQuery_PointUpdate* msg);
+  static void set_has_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::Mapping& mapping(const WriteQuery_PointUpdate* msg);
+  static void set_has_mapping(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+const ::TableRef&
+WriteQuery_PointUpdate::_Internal::table_ref(const WriteQuery_PointUpdate* msg) {
+  return *msg->_impl_.table_ref_;
+}
+const ::Term&
+WriteQuery_PointUpdate::_Internal::key(const WriteQuery_PointUpdate* msg) {
+  return *msg->_impl_.key_;
+}
+const ::Mapping&
+WriteQuery_PointUpdate::_Internal::mapping(const WriteQuery_PointUpdate* msg) {
+  return *msg->_impl_.mapping_;
+}
+WriteQuery_PointUpdate::WriteQuery_PointUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:WriteQuery.PointUpdate)
+}
+WriteQuery_PointUpdate::WriteQuery_PointUpdate(const WriteQuery_PointUpdate& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteQuery_PointUpdate* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.attrname_){}
+    , decltype(_impl_.table_ref_){nullptr}
+    , decltype(_impl_.key_){nullptr}
+    , decltype(_impl_.mapping_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.attrname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.attrname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_attrname()) {
+    _this->_impl_.attrname_.Set(from._internal_attrname(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_table_ref()) {
+    _this->_impl_.table_ref_ = new ::TableRef(*from._impl_.table_ref_);
+  }
+  if (from._internal_has_key()) {
+    _this->_impl_.key_ = new ::Term(*from._impl_.key_);
+  }
+  if (from._internal_has_mapping()) {
+    _this->_impl_.mapping_ = new ::Mapping(*from._impl_.mapping_);
+  }
+  // @@protoc_insertion_point(copy_constructor:WriteQuery.PointUpdate)
+}
+
+inline void WriteQuery_PointUpdate::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.attrname_){}
+    , decltype(_impl_.table_ref_){nullptr}
+    , decltype(_impl_.key_){nullptr}
+    , decltype(_impl_.mapping_){nullptr}
+  };
+  _impl_.attrname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.attrname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+WriteQuery_PointUpdate::~WriteQuery_PointUpdate() {
+  // @@protoc_insertion_point(destructor:WriteQuery.PointUpdate)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WriteQuery_PointUpdate::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.attrname_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.table_ref_;
+  if (this != internal_default_instance()) delete _impl_.key_;
+  if (this != internal_default_instance()) delete _impl_.mapping_;
+}
+
+void WriteQuery_PointUpdate::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WriteQuery_PointUpdate::Clear() {
+// @@protoc_insertion_point(message_clear_start:WriteQuery.PointUpdate)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.attrname_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.table_ref_ != nullptr);
+      _impl_.table_ref_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.key_ != nullptr);
+      _impl_.key_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.mapping_ != nullptr);
+      _impl_.mapping_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WriteQuery_PointUpdate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .TableRef table_ref = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_table_ref(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string attrname = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_attrname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "WriteQuery.PointUpdate.attrname");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required .Term key = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_key(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .Mapping mapping = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_mapping(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WriteQuery_PointUpdate::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:WriteQuery.PointUpdate)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .TableRef table_ref = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::table_ref(this),
+        _Internal::table_ref(this).GetCachedSize(), target, stream);
+  }
+
+  // required string attrname = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_attrname().data(), static_cast<int>(this->_internal_attrname().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "WriteQuery.PointUpdate.attrname");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_attrname(), target);
+  }
+
+  // required .Term key = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::key(this),
+        _Internal::key(this).GetCachedSize(), target, stream);
+  }
+
+  // required .Mapping mapping = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::mapping(this),
+        _Internal::mapping(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:WriteQuery.PointUpdate)
+  return target;
+}
+
+size_t WriteQuery_PointUpdate::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:WriteQuery.PointUpdate)
+  size_t total_size = 0;
+
+  if (_internal_has_attrname()) {
+    // required string attrname = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_attrname());
+  }
+
+  if (_internal_has_table_ref()) {
+    // required .TableRef table_ref = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.table_ref_);
+  }
+
+  if (_internal_has_key()) {
+    // required .Term key = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.key_);
+  }
+
+  if (_internal_has_mapping()) {
+    // required .Mapping mapping = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.mapping_);
+  }
+
+  return total_size;
+}
+size_t WriteQuery_PointUpdate::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:WriteQuery.PointUpdate)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required string attrname = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_attrname());
+
+    // required .TableRef table_ref = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.table_ref_);
+
+    // required .Term key = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.key_);
+
+    // required .Mapping mapping = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.mapping_);
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteQuery_PointUpdate::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteQuery_PointUpdate::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteQuery_PointUpdate::GetClassData() const { return &_class_data_; }
+
+
+void WriteQuery_PointUpdate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteQuery_PointUpdate*>(&to_msg);
+  auto& from = static_cast<const WriteQuery_PointUpdate&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:WriteQuery.PointUpdate)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_attrname(from._internal_attrname());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_table_ref()->::TableRef::MergeFrom(
+          from._internal_table_ref());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_key()->::Term::MergeFrom(
+          from._internal_key());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_mapping()->::Mapping::MergeFrom(
+          from._internal_mapping());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WriteQuery_PointUpdate::CopyFrom(const WriteQuery_PointUpdate& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:WriteQuery.PointUpdate)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteQuery_PointUpdate::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_table_ref()) {
+    if (!_impl_.table_ref_->IsInitialized()) return false;
+  }
+  if (_internal_has_key()) {
+    if (!_impl_.key_->IsInitialized()) return false;
+  }
+  if (_internal_has_mapping()) {
+    if (!_impl_.mapping_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void WriteQuery_PointUpdate::InternalSwap(WriteQuery_PointUpdate* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.attrname_, lhs_arena,
+      &other->_impl_.attrname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WriteQuery_PointUpdate, _impl_.mapping_)
+      + sizeof(WriteQuery_PointUpdate::_impl_.mapping_)
+      - PROTOBUF_FIELD_OFFSET(WriteQuery_PointUpdate, _impl_.table_ref_)>(
+          reinterpret_cast<char*>(&_impl_.table_ref_),
+          reinterpret_cast<char*>(&other->_impl_.table_ref_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WriteQuery_PointUpdate::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[24]);
+}
+
+// ===================================================================
+
+class WriteQuery_PointDelete::_Internal {
+ public:
+  using HasBits = decltype(std::declval<WriteQuery_PointDelete>()._impl_._has_bits_);
+  static const ::TableRef& table_ref(const WriteQuery_PointDelete* msg);
+  static void set_has_table_ref(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_attrname(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::Term& key(const WriteQuery_PointDelete* msg);
+  static void set_has_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+const ::TableRef&
+WriteQuery_PointDelete::_Internal::table_ref(const WriteQuery_PointDelete* msg) {
+  return *msg->_impl_.table_ref_;
+}
+const ::Term&
+WriteQuery_PointDelete::_Internal::key(const WriteQuery_PointDelete* msg) {
+  return *msg->_impl_.key_;
+}
+WriteQuery_PointDelete::WriteQuery_PointDelete(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:WriteQuery.PointDelete)
+}
+WriteQuery_PointDelete::WriteQuery_PointDelete(const WriteQuery_PointDelete& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteQuery_PointDelete* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.attrname_){}
+    , decltype(_impl_.table_ref_){nullptr}
+    , decltype(_impl_.key_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.attrname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.attrname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_attrname()) {
+    _this->_impl_.attrname_.Set(from._internal_attrname(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_table_ref()) {
+    _this->_impl_.table_ref_ = new ::TableRef(*from._impl_.table_ref_);
+  }
+  if (from._internal_has_key()) {
+    _this->_impl_.key_ = new ::Term(*from._impl_.key_);
+  }
+  // @@protoc_insertion_point(copy_constructor:WriteQuery.PointDelete)
+}
+
+inline void WriteQuery_PointDelete::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.attrname_){}
+    , decltype(_impl_.table_ref_){nullptr}
+    , decltype(_impl_.key_){nullptr}
+  };
+  _impl_.attrname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.attrname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+WriteQuery_PointDelete::~WriteQuery_PointDelete() {
+  // @@protoc_insertion_point(destructor:WriteQuery.PointDelete)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WriteQuery_PointDelete::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.attrname_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.table_ref_;
+  if (this != internal_default_instance()) delete _impl_.key_;
+}
+
+void WriteQuery_PointDelete::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WriteQuery_PointDelete::Clear() {
+// @@protoc_insertion_point(message_clear_start:WriteQuery.PointDelete)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.attrname_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.table_ref_ != nullptr);
+      _impl_.table_ref_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.key_ != nullptr);
+      _impl_.key_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WriteQuery_PointDelete::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .TableRef table_ref = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_table_ref(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string attrname = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_attrname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "WriteQuery.PointDelete.attrname");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required .Term key = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_key(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WriteQuery_PointDelete::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:WriteQuery.PointDelete)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .TableRef table_ref = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::table_ref(this),
+        _Internal::table_ref(this).GetCachedSize(), target, stream);
+  }
+
+  // required string attrname = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_attrname().data(), static_cast<int>(this->_internal_attrname().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "WriteQuery.PointDelete.attrname");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_attrname(), target);
+  }
+
+  // required .Term key = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::key(this),
+        _Internal::key(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:WriteQuery.PointDelete)
+  return target;
+}
+
+size_t WriteQuery_PointDelete::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:WriteQuery.PointDelete)
+  size_t total_size = 0;
+
+  if (_internal_has_attrname()) {
+    // required string attrname = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_attrname());
+  }
+
+  if (_internal_has_table_ref()) {
+    // required .TableRef table_ref = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.table_ref_);
+  }
+
+  if (_internal_has_key()) {
+    // required .Term key = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.key_);
+  }
+
+  return total_size;
+}
+size_t WriteQuery_PointDelete::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:WriteQuery.PointDelete)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required string attrname = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_attrname());
+
+    // required .TableRef table_ref = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.table_ref_);
+
+    // required .Term key = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.key_);
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteQuery_PointDelete::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteQuery_PointDelete::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteQuery_PointDelete::GetClassData() const { return &_class_data_; }
+
+
+void WriteQuery_PointDelete::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteQuery_PointDelete*>(&to_msg);
+  auto& from = static_cast<const WriteQuery_PointDelete&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:WriteQuery.PointDelete)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_attrname(from._internal_attrname());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_table_ref()->::TableRef::MergeFrom(
+          from._internal_table_ref());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_key()->::Term::MergeFrom(
+          from._internal_key());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WriteQuery_PointDelete::CopyFrom(const WriteQuery_PointDelete& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:WriteQuery.PointDelete)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteQuery_PointDelete::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_table_ref()) {
+    if (!_impl_.table_ref_->IsInitialized()) return false;
+  }
+  if (_internal_has_key()) {
+    if (!_impl_.key_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void WriteQuery_PointDelete::InternalSwap(WriteQuery_PointDelete* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.attrname_, lhs_arena,
+      &other->_impl_.attrname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WriteQuery_PointDelete, _impl_.key_)
+      + sizeof(WriteQuery_PointDelete::_impl_.key_)
+      - PROTOBUF_FIELD_OFFSET(WriteQuery_PointDelete, _impl_.table_ref_)>(
+          reinterpret_cast<char*>(&_impl_.table_ref_),
+          reinterpret_cast<char*>(&other->_impl_.table_ref_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WriteQuery_PointDelete::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[25]);
+}
+
+// ===================================================================
+
+class WriteQuery_PointMutate::_Internal {
+ public:
+  using HasBits = decltype(std::declval<WriteQuery_PointMutate>()._impl_._has_bits_);
+  static const ::TableRef& table_ref(const WriteQuery_PointMutate* msg);
+  static void set_has_table_ref(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_attrname(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::Term& key(const WriteQuery_PointMutate* msg);
+  static void set_has_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::Mapping& mapping(const WriteQuery_PointMutate* msg);
+  static void set_has_mapping(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+const ::TableRef&
+WriteQuery_PointMutate::_Internal::table_ref(const WriteQuery_PointMutate* msg) {
+  return *msg->_impl_.table_ref_;
+}
+const ::Term&
+WriteQuery_PointMutate::_Internal::key(const WriteQuery_PointMutate* msg) {
+  return *msg->_impl_.key_;
+}
+const ::Mapping&
+WriteQuery_PointMutate::_Internal::mapping(const WriteQuery_PointMutate* msg) {
+  return *msg->_impl_.mapping_;
+}
+WriteQuery_PointMutate::WriteQuery_PointMutate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:WriteQuery.PointMutate)
+}
+WriteQuery_PointMutate::WriteQuery_PointMutate(const WriteQuery_PointMutate& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteQuery_PointMutate* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.attrname_){}
+    , decltype(_impl_.table_ref_){nullptr}
+    , decltype(_impl_.key_){nullptr}
+    , decltype(_impl_.mapping_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.attrname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.attrname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_attrname()) {
+    _this->_impl_.attrname_.Set(from._internal_attrname(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_table_ref()) {
+    _this->_impl_.table_ref_ = new ::TableRef(*from._impl_.table_ref_);
+  }
+  if (from._internal_has_key()) {
+    _this->_impl_.key_ = new ::Term(*from._impl_.key_);
+  }
+  if (from._internal_has_mapping()) {
+    _this->_impl_.mapping_ = new ::Mapping(*from._impl_.mapping_);
+  }
+  // @@protoc_insertion_point(copy_constructor:WriteQuery.PointMutate)
+}
+
+inline void WriteQuery_PointMutate::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.attrname_){}
+    , decltype(_impl_.table_ref_){nullptr}
+    , decltype(_impl_.key_){nullptr}
+    , decltype(_impl_.mapping_){nullptr}
+  };
+  _impl_.attrname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.attrname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+WriteQuery_PointMutate::~WriteQuery_PointMutate() {
+  // @@protoc_insertion_point(destructor:WriteQuery.PointMutate)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WriteQuery_PointMutate::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.attrname_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.table_ref_;
+  if (this != internal_default_instance()) delete _impl_.key_;
+  if (this != internal_default_instance()) delete _impl_.mapping_;
+}
+
+void WriteQuery_PointMutate::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WriteQuery_PointMutate::Clear() {
+// @@protoc_insertion_point(message_clear_start:WriteQuery.PointMutate)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.attrname_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.table_ref_ != nullptr);
+      _impl_.table_ref_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.key_ != nullptr);
+      _impl_.key_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.mapping_ != nullptr);
+      _impl_.mapping_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WriteQuery_PointMutate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .TableRef table_ref = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_table_ref(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string attrname = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_attrname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "WriteQuery.PointMutate.attrname");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required .Term key = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_key(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .Mapping mapping = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_mapping(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WriteQuery_PointMutate::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:WriteQuery.PointMutate)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .TableRef table_ref = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::table_ref(this),
+        _Internal::table_ref(this).GetCachedSize(), target, stream);
+  }
+
+  // required string attrname = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_attrname().data(), static_cast<int>(this->_internal_attrname().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "WriteQuery.PointMutate.attrname");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_attrname(), target);
+  }
+
+  // required .Term key = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::key(this),
+        _Internal::key(this).GetCachedSize(), target, stream);
+  }
+
+  // required .Mapping mapping = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::mapping(this),
+        _Internal::mapping(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:WriteQuery.PointMutate)
+  return target;
+}
+
+size_t WriteQuery_PointMutate::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:WriteQuery.PointMutate)
+  size_t total_size = 0;
+
+  if (_internal_has_attrname()) {
+    // required string attrname = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_attrname());
+  }
+
+  if (_internal_has_table_ref()) {
+    // required .TableRef table_ref = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.table_ref_);
+  }
+
+  if (_internal_has_key()) {
+    // required .Term key = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.key_);
+  }
+
+  if (_internal_has_mapping()) {
+    // required .Mapping mapping = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.mapping_);
+  }
+
+  return total_size;
+}
+size_t WriteQuery_PointMutate::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:WriteQuery.PointMutate)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required string attrname = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_attrname());
+
+    // required .TableRef table_ref = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.table_ref_);
+
+    // required .Term key = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.key_);
+
+    // required .Mapping mapping = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.mapping_);
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteQuery_PointMutate::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteQuery_PointMutate::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteQuery_PointMutate::GetClassData() const { return &_class_data_; }
+
+
+void WriteQuery_PointMutate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteQuery_PointMutate*>(&to_msg);
+  auto& from = static_cast<const WriteQuery_PointMutate&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:WriteQuery.PointMutate)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_attrname(from._internal_attrname());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_table_ref()->::TableRef::MergeFrom(
+          from._internal_table_ref());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_key()->::Term::MergeFrom(
+          from._internal_key());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_mapping()->::Mapping::MergeFrom(
+          from._internal_mapping());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WriteQuery_PointMutate::CopyFrom(const WriteQuery_PointMutate& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:WriteQuery.PointMutate)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteQuery_PointMutate::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_table_ref()) {
+    if (!_impl_.table_ref_->IsInitialized()) return false;
+  }
+  if (_internal_has_key()) {
+    if (!_impl_.key_->IsInitialized()) return false;
+  }
+  if (_internal_has_mapping()) {
+    if (!_impl_.mapping_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void WriteQuery_PointMutate::InternalSwap(WriteQuery_PointMutate* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.attrname_, lhs_arena,
+      &other->_impl_.attrname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WriteQuery_PointMutate, _impl_.mapping_)
+      + sizeof(WriteQuery_PointMutate::_impl_.mapping_)
+      - PROTOBUF_FIELD_OFFSET(WriteQuery_PointMutate, _impl_.table_ref_)>(
+          reinterpret_cast<char*>(&_impl_.table_ref_),
+          reinterpret_cast<char*>(&other->_impl_.table_ref_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WriteQuery_PointMutate::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[26]);
+}
+
+// ===================================================================
+
+class WriteQuery::_Internal {
+ public:
+  using HasBits = decltype(std::declval<WriteQuery>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_atomic(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static const ::WriteQuery_Update& update(const WriteQuery* msg);
+  static void set_has_update(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::WriteQuery_Delete& delete_(const WriteQuery* msg);
+  static void set_has_delete_(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::WriteQuery_Mutate& mutate(const WriteQuery* msg);
+  static void set_has_mutate(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::WriteQuery_Insert& insert(const WriteQuery* msg);
+  static void set_has_insert(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::WriteQuery_ForEach& for_each(const WriteQuery* msg);
+  static void set_has_for_each(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::WriteQuery_PointUpdate& point_update(const WriteQuery* msg);
+  static void set_has_point_update(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::WriteQuery_PointDelete& point_delete(const WriteQuery* msg);
+  static void set_has_point_delete(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::WriteQuery_PointMutate& point_mutate(const WriteQuery* msg);
+  static void set_has_point_mutate(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000100) ^ 0x00000100) != 0;
+  }
+};
+
+const ::WriteQuery_Update&
+WriteQuery::_Internal::update(const WriteQuery* msg) {
+  return *msg->_impl_.update_;
+}
+const ::WriteQuery_Delete&
+WriteQuery::_Internal::delete_(const WriteQuery* msg) {
+  return *msg->_impl_.delete__;
+}
+const ::WriteQuery_Mutate&
+WriteQuery::_Internal::mutate(const WriteQuery* msg) {
+  return *msg->_impl_.mutate_;
+}
+const ::WriteQuery_Insert&
+WriteQuery::_Internal::insert(const WriteQuery* msg) {
+  return *msg->_impl_.insert_;
+}
+const ::WriteQuery_ForEach&
+WriteQuery::_Internal::for_each(const WriteQuery* msg) {
+  return *msg->_impl_.for_each_;
+}
+const ::WriteQuery_PointUpdate&
+WriteQuery::_Internal::point_update(const WriteQuery* msg) {
+  return *msg->_impl_.point_update_;
+}
+const ::WriteQuery_PointDelete&
+WriteQuery::_Internal::point_delete(const WriteQuery* msg) {
+  return *msg->_impl_.point_delete_;
+}
+const ::WriteQuery_PointMutate&
+WriteQuery::_Internal::point_mutate(const WriteQuery* msg) {
+  return *msg->_impl_.point_mutate_;
+}
+WriteQuery::WriteQuery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:WriteQuery)
+}
+WriteQuery::WriteQuery(const WriteQuery& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteQuery* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.update_){nullptr}
+    , decltype(_impl_.delete__){nullptr}
+    , decltype(_impl_.mutate_){nullptr}
+    , decltype(_impl_.insert_){nullptr}
+    , decltype(_impl_.for_each_){nullptr}
+    , decltype(_impl_.point_update_){nullptr}
+    , decltype(_impl_.point_delete_){nullptr}
+    , decltype(_impl_.point_mutate_){nullptr}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.atomic_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_update()) {
+    _this->_impl_.update_ = new ::WriteQuery_Update(*from._impl_.update_);
+  }
+  if (from._internal_has_delete_()) {
+    _this->_impl_.delete__ = new ::WriteQuery_Delete(*from._impl_.delete__);
+  }
+  if (from._internal_has_mutate()) {
+    _this->_impl_.mutate_ = new ::WriteQuery_Mutate(*from._impl_.mutate_);
+  }
+  if (from._internal_has_insert()) {
+    _this->_impl_.insert_ = new ::WriteQuery_Insert(*from._impl_.insert_);
+  }
+  if (from._internal_has_for_each()) {
+    _this->_impl_.for_each_ = new ::WriteQuery_ForEach(*from._impl_.for_each_);
+  }
+  if (from._internal_has_point_update()) {
+    _this->_impl_.point_update_ = new ::WriteQuery_PointUpdate(*from._impl_.point_update_);
+  }
+  if (from._internal_has_point_delete()) {
+    _this->_impl_.point_delete_ = new ::WriteQuery_PointDelete(*from._impl_.point_delete_);
+  }
+  if (from._internal_has_point_mutate()) {
+    _this->_impl_.point_mutate_ = new ::WriteQuery_PointMutate(*from._impl_.point_mutate_);
+  }
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.atomic_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.atomic_));
+  // @@protoc_insertion_point(copy_constructor:WriteQuery)
+}
+
+inline void WriteQuery::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.update_){nullptr}
+    , decltype(_impl_.delete__){nullptr}
+    , decltype(_impl_.mutate_){nullptr}
+    , decltype(_impl_.insert_){nullptr}
+    , decltype(_impl_.for_each_){nullptr}
+    , decltype(_impl_.point_update_){nullptr}
+    , decltype(_impl_.point_delete_){nullptr}
+    , decltype(_impl_.point_mutate_){nullptr}
+    , decltype(_impl_.type_){1}
+    , decltype(_impl_.atomic_){true}
+  };
+}
+
+WriteQuery::~WriteQuery() {
+  // @@protoc_insertion_point(destructor:WriteQuery)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WriteQuery::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.update_;
+  if (this != internal_default_instance()) delete _impl_.delete__;
+  if (this != internal_default_instance()) delete _impl_.mutate_;
+  if (this != internal_default_instance()) delete _impl_.insert_;
+  if (this != internal_default_instance()) delete _impl_.for_each_;
+  if (this != internal_default_instance()) delete _impl_.point_update_;
+  if (this != internal_default_instance()) delete _impl_.point_delete_;
+  if (this != internal_default_instance()) delete _impl_.point_mutate_;
+}
+
+void WriteQuery::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WriteQuery::Clear() {
+// @@protoc_insertion_point(message_clear_start:WriteQuery)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.update_ != nullptr);
+      _impl_.update_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.delete__ != nullptr);
+      _impl_.delete__->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.mutate_ != nullptr);
+      _impl_.mutate_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.insert_ != nullptr);
+      _impl_.insert_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.for_each_ != nullptr);
+      _impl_.for_each_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.point_update_ != nullptr);
+      _impl_.point_update_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.point_delete_ != nullptr);
+      _impl_.point_delete_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      GOOGLE_DCHECK(_impl_.point_mutate_ != nullptr);
+      _impl_.point_mutate_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00000300u) {
+    _impl_.type_ = 1;
+    _impl_.atomic_ = true;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WriteQuery::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .WriteQuery.WriteQueryType type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::WriteQuery_WriteQueryType_IsValid(val))) {
+            _internal_set_type(static_cast<::WriteQuery_WriteQueryType>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .WriteQuery.Update update = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_update(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .WriteQuery.Delete delete = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_delete_(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .WriteQuery.Mutate mutate = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_mutate(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .WriteQuery.Insert insert = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_insert(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .WriteQuery.ForEach for_each = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_for_each(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .WriteQuery.PointUpdate point_update = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_point_update(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .WriteQuery.PointDelete point_delete = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_point_delete(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .WriteQuery.PointMutate point_mutate = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_point_mutate(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool atomic = 11 [default = true];
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_atomic(&has_bits);
+          _impl_.atomic_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WriteQuery::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:WriteQuery)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .WriteQuery.WriteQueryType type = 1;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
+  }
+
+  // optional .WriteQuery.Update update = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::update(this),
+        _Internal::update(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .WriteQuery.Delete delete = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::delete_(this),
+        _Internal::delete_(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .WriteQuery.Mutate mutate = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::mutate(this),
+        _Internal::mutate(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .WriteQuery.Insert insert = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::insert(this),
+        _Internal::insert(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .WriteQuery.ForEach for_each = 7;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::for_each(this),
+        _Internal::for_each(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .WriteQuery.PointUpdate point_update = 8;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::point_update(this),
+        _Internal::point_update(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .WriteQuery.PointDelete point_delete = 9;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::point_delete(this),
+        _Internal::point_delete(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .WriteQuery.PointMutate point_mutate = 10;
+  if (cached_has_bits & 0x00000080u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::point_mutate(this),
+        _Internal::point_mutate(this).GetCachedSize(), target, stream);
+  }
+
+  // optional bool atomic = 11 [default = true];
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(11, this->_internal_atomic(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:WriteQuery)
+  return target;
+}
+
+size_t WriteQuery::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:WriteQuery)
+  size_t total_size = 0;
+
+  // required .WriteQuery.WriteQueryType type = 1;
+  if (_internal_has_type()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional .WriteQuery.Update update = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.update_);
+    }
+
+    // optional .WriteQuery.Delete delete = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.delete__);
+    }
+
+    // optional .WriteQuery.Mutate mutate = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.mutate_);
+    }
+
+    // optional .WriteQuery.Insert insert = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.insert_);
+    }
+
+    // optional .WriteQuery.ForEach for_each = 7;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.for_each_);
+    }
+
+    // optional .WriteQuery.PointUpdate point_update = 8;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.point_update_);
+    }
+
+    // optional .WriteQuery.PointDelete point_delete = 9;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.point_delete_);
+    }
+
+    // optional .WriteQuery.PointMutate point_mutate = 10;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.point_mutate_);
+    }
+
+  }
+  // optional bool atomic = 11 [default = true];
+  if (cached_has_bits & 0x00000200u) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteQuery::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteQuery::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteQuery::GetClassData() const { return &_class_data_; }
+
+
+void WriteQuery::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteQuery*>(&to_msg);
+  auto& from = static_cast<const WriteQuery&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:WriteQuery)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_update()->::WriteQuery_Update::MergeFrom(
+          from._internal_update());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_delete_()->::WriteQuery_Delete::MergeFrom(
+          from._internal_delete_());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_mutate()->::WriteQuery_Mutate::MergeFrom(
+          from._internal_mutate());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_insert()->::WriteQuery_Insert::MergeFrom(
+          from._internal_insert());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_for_each()->::WriteQuery_ForEach::MergeFrom(
+          from._internal_for_each());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_point_update()->::WriteQuery_PointUpdate::MergeFrom(
+          from._internal_point_update());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_point_delete()->::WriteQuery_PointDelete::MergeFrom(
+          from._internal_point_delete());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_internal_mutable_point_mutate()->::WriteQuery_PointMutate::MergeFrom(
+          from._internal_point_mutate());
+    }
+  }
+  if (cached_has_bits & 0x00000300u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.atomic_ = from._impl_.atomic_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WriteQuery::CopyFrom(const WriteQuery& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:WriteQuery)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteQuery::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_update()) {
+    if (!_impl_.update_->IsInitialized()) return false;
+  }
+  if (_internal_has_delete_()) {
+    if (!_impl_.delete__->IsInitialized()) return false;
+  }
+  if (_internal_has_mutate()) {
+    if (!_impl_.mutate_->IsInitialized()) return false;
+  }
+  if (_internal_has_insert()) {
+    if (!_impl_.insert_->IsInitialized()) return false;
+  }
+  if (_internal_has_for_each()) {
+    if (!_impl_.for_each_->IsInitialized()) return false;
+  }
+  if (_internal_has_point_update()) {
+    if (!_impl_.point_update_->IsInitialized()) return false;
+  }
+  if (_internal_has_point_delete()) {
+    if (!_impl_.point_delete_->IsInitialized()) return false;
+  }
+  if (_internal_has_point_mutate()) {
+    if (!_impl_.point_mutate_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void WriteQuery::InternalSwap(WriteQuery* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WriteQuery, _impl_.point_mutate_)
+      + sizeof(WriteQuery::_impl_.point_mutate_)
+      - PROTOBUF_FIELD_OFFSET(WriteQuery, _impl_.update_)>(
+          reinterpret_cast<char*>(&_impl_.update_),
+          reinterpret_cast<char*>(&other->_impl_.update_));
+  swap(_impl_.type_, other->_impl_.type_);
+  swap(_impl_.atomic_, other->_impl_.atomic_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WriteQuery::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[27]);
+}
+
+// ===================================================================
+
+class MetaQuery_CreateTable::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MetaQuery_CreateTable>()._impl_._has_bits_);
+  static void set_has_datacenter(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::TableRef& table_ref(const MetaQuery_CreateTable* msg);
+  static void set_has_table_ref(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_primary_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_cache_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000004) ^ 0x00000004) != 0;
+  }
+};
+
+const ::TableRef&
+MetaQuery_CreateTable::_Internal::table_ref(const MetaQuery_CreateTable* msg) {
+  return *msg->_impl_.table_ref_;
+}
+const ::PROTOBUF_NAMESPACE_ID::internal::LazyString MetaQuery_CreateTable::Impl_::_i_give_permission_to_break_this_code_default_primary_key_{{{"id", 2}}, {nullptr}};
+MetaQuery_CreateTable::MetaQuery_CreateTable(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:MetaQuery.CreateTable)
+}
+MetaQuery_CreateTable::MetaQuery_CreateTable(const MetaQuery_CreateTable& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetaQuery_CreateTable* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.datacenter_){}
+    , decltype(_impl_.primary_key_){}
+    , decltype(_impl_.table_ref_){nullptr}
+    , decltype(_impl_.cache_size_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.datacenter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.datacenter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_datacenter()) {
+    _this->_impl_.datacenter_.Set(from._internal_datacenter(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.primary_key_.InitDefault();
+  if (from._internal_has_primary_key()) {
+    _this->_impl_.primary_key_.Set(from._internal_primary_key(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_table_ref()) {
+    _this->_impl_.table_ref_ = new ::TableRef(*from._impl_.table_ref_);
+  }
+  _this->_impl_.cache_size_ = from._impl_.cache_size_;
+  // @@protoc_insertion_point(copy_constructor:MetaQuery.CreateTable)
+}
+
+inline void MetaQuery_CreateTable::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.datacenter_){}
+    , decltype(_impl_.primary_key_){}
+    , decltype(_impl_.table_ref_){nullptr}
+    , decltype(_impl_.cache_size_){int64_t{1073741824}}
+  };
+  _impl_.datacenter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.datacenter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.primary_key_.InitDefault();
+}
+
+MetaQuery_CreateTable::~MetaQuery_CreateTable() {
+  // @@protoc_insertion_point(destructor:MetaQuery.CreateTable)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MetaQuery_CreateTable::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.datacenter_.Destroy();
+  _impl_.primary_key_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.table_ref_;
+}
+
+void MetaQuery_CreateTable::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MetaQuery_CreateTable::Clear() {
+// @@protoc_insertion_point(message_clear_start:MetaQuery.CreateTable)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.datacenter_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.primary_key_.ClearToDefault(::MetaQuery_CreateTable::Impl_::_i_give_permission_to_break_this_code_default_primary_key_, GetArenaForAllocation());
+       }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.table_ref_ != nullptr);
+      _impl_.table_ref_->Clear();
+    }
+    _impl_.cache_size_ = int64_t{1073741824};
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetaQuery_CreateTable::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string datacenter = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_datacenter();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "MetaQuery.CreateTable.datacenter");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required .TableRef table_ref = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_table_ref(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string primary_key = 4 [default = "id"];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_primary_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "MetaQuery.CreateTable.primary_key");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int64 cache_size = 5 [default = 1073741824];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_cache_size(&has_bits);
+          _impl_.cache_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetaQuery_CreateTable::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:MetaQuery.CreateTable)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string datacenter = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_datacenter().data(), static_cast<int>(this->_internal_datacenter().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "MetaQuery.CreateTable.datacenter");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_datacenter(), target);
+  }
+
+  // required .TableRef table_ref = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::table_ref(this),
+        _Internal::table_ref(this).GetCachedSize(), target, stream);
+  }
+
+  // optional string primary_key = 4 [default = "id"];
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_primary_key().data(), static_cast<int>(this->_internal_primary_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "MetaQuery.CreateTable.primary_key");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_primary_key(), target);
+  }
+
+  // optional int64 cache_size = 5 [default = 1073741824];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_cache_size(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:MetaQuery.CreateTable)
+  return target;
+}
+
+size_t MetaQuery_CreateTable::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:MetaQuery.CreateTable)
+  size_t total_size = 0;
+
+  // required .TableRef table_ref = 3;
+  if (_internal_has_table_ref()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.table_ref_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string datacenter = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_datacenter());
+    }
+
+    // optional string primary_key = 4 [default = "id"];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_primary_key());
+    }
+
+  }
+  // optional int64 cache_size = 5 [default = 1073741824];
+  if (cached_has_bits & 0x00000008u) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_cache_size());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetaQuery_CreateTable::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetaQuery_CreateTable::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetaQuery_CreateTable::GetClassData() const { return &_class_data_; }
+
+
+void MetaQuery_CreateTable::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetaQuery_CreateTable*>(&to_msg);
+  auto& from = static_cast<const MetaQuery_CreateTable&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MetaQuery.CreateTable)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_datacenter(from._internal_datacenter());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_primary_key(from._internal_primary_key());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_table_ref()->::TableRef::MergeFrom(
+          from._internal_table_ref());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.cache_size_ = from._impl_.cache_size_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MetaQuery_CreateTable::CopyFrom(const MetaQuery_CreateTable& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:MetaQuery.CreateTable)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MetaQuery_CreateTable::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_table_ref()) {
+    if (!_impl_.table_ref_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void MetaQuery_CreateTable::InternalSwap(MetaQuery_CreateTable* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.datacenter_, lhs_arena,
+      &other->_impl_.datacenter_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.primary_key_, lhs_arena,
+      &other->_impl_.primary_key_, rhs_arena
+  );
+  swap(_impl_.table_ref_, other->_impl_.table_ref_);
+  swap(_impl_.cache_size_, other->_impl_.cache_size_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MetaQuery_CreateTable::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[28]);
+}
+
+// ===================================================================
+
+class MetaQuery_IndexRef::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MetaQuery_IndexRef>()._impl_._has_bits_);
+  static const ::TableRef& table_ref(const MetaQuery_IndexRef* msg);
+  static void set_has_table_ref(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_attrname(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+const ::TableRef&
+MetaQuery_IndexRef::_Internal::table_ref(const MetaQuery_IndexRef* msg) {
+  return *msg->_impl_.table_ref_;
+}
+MetaQuery_IndexRef::MetaQuery_IndexRef(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:MetaQuery.IndexRef)
+}
+MetaQuery_IndexRef::MetaQuery_IndexRef(const MetaQuery_IndexRef& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetaQuery_IndexRef* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.attrname_){}
+    , decltype(_impl_.table_ref_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.attrname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.attrname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_attrname()) {
+    _this->_impl_.attrname_.Set(from._internal_attrname(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_table_ref()) {
+    _this->_impl_.table_ref_ = new ::TableRef(*from._impl_.table_ref_);
+  }
+  // @@protoc_insertion_point(copy_constructor:MetaQuery.IndexRef)
+}
+
+inline void MetaQuery_IndexRef::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.attrname_){}
+    , decltype(_impl_.table_ref_){nullptr}
+  };
+  _impl_.attrname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.attrname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MetaQuery_IndexRef::~MetaQuery_IndexRef() {
+  // @@protoc_insertion_point(destructor:MetaQuery.IndexRef)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MetaQuery_IndexRef::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.attrname_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.table_ref_;
+}
+
+void MetaQuery_IndexRef::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MetaQuery_IndexRef::Clear() {
+// @@protoc_insertion_point(message_clear_start:MetaQuery.IndexRef)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.attrname_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.table_ref_ != nullptr);
+      _impl_.table_ref_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetaQuery_IndexRef::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .TableRef table_ref = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_table_ref(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string attrname = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_attrname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "MetaQuery.IndexRef.attrname");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetaQuery_IndexRef::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:MetaQuery.IndexRef)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .TableRef table_ref = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::table_ref(this),
+        _Internal::table_ref(this).GetCachedSize(), target, stream);
+  }
+
+  // required string attrname = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_attrname().data(), static_cast<int>(this->_internal_attrname().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "MetaQuery.IndexRef.attrname");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_attrname(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:MetaQuery.IndexRef)
+  return target;
+}
+
+size_t MetaQuery_IndexRef::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:MetaQuery.IndexRef)
+  size_t total_size = 0;
+
+  if (_internal_has_attrname()) {
+    // required string attrname = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_attrname());
+  }
+
+  if (_internal_has_table_ref()) {
+    // required .TableRef table_ref = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.table_ref_);
+  }
+
+  return total_size;
+}
+size_t MetaQuery_IndexRef::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:MetaQuery.IndexRef)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string attrname = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_attrname());
+
+    // required .TableRef table_ref = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.table_ref_);
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetaQuery_IndexRef::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetaQuery_IndexRef::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetaQuery_IndexRef::GetClassData() const { return &_class_data_; }
+
+
+void MetaQuery_IndexRef::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetaQuery_IndexRef*>(&to_msg);
+  auto& from = static_cast<const MetaQuery_IndexRef&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MetaQuery.IndexRef)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_attrname(from._internal_attrname());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_table_ref()->::TableRef::MergeFrom(
+          from._internal_table_ref());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MetaQuery_IndexRef::CopyFrom(const MetaQuery_IndexRef& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:MetaQuery.IndexRef)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MetaQuery_IndexRef::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_table_ref()) {
+    if (!_impl_.table_ref_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void MetaQuery_IndexRef::InternalSwap(MetaQuery_IndexRef* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.attrname_, lhs_arena,
+      &other->_impl_.attrname_, rhs_arena
+  );
+  swap(_impl_.table_ref_, other->_impl_.table_ref_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MetaQuery_IndexRef::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[29]);
+}
+
+// ===================================================================
+
+class MetaQuery::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MetaQuery>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_db_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::MetaQuery_CreateTable& create_table(const MetaQuery* msg);
+  static void set_has_create_table(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::TableRef& drop_table(const MetaQuery* msg);
+  static void set_has_drop_table(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::MetaQuery_IndexRef& create_index(const MetaQuery* msg);
+  static void set_has_create_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::MetaQuery_IndexRef& drop_index(const MetaQuery* msg);
+  static void set_has_drop_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000020) ^ 0x00000020) != 0;
+  }
+};
+
+const ::MetaQuery_CreateTable&
+MetaQuery::_Internal::create_table(const MetaQuery* msg) {
+  return *msg->_impl_.create_table_;
+}
+const ::TableRef&
+MetaQuery::_Internal::drop_table(const MetaQuery* msg) {
+  return *msg->_impl_.drop_table_;
+}
+const ::MetaQuery_IndexRef&
+MetaQuery::_Internal::create_index(const MetaQuery* msg) {
+  return *msg->_impl_.create_index_;
+}
+const ::MetaQuery_IndexRef&
+MetaQuery::_Internal::drop_index(const MetaQuery* msg) {
+  return *msg->_impl_.drop_index_;
+}
+MetaQuery::MetaQuery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:MetaQuery)
+}
+MetaQuery::MetaQuery(const MetaQuery& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MetaQuery* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.db_name_){}
+    , decltype(_impl_.create_table_){nullptr}
+    , decltype(_impl_.drop_table_){nullptr}
+    , decltype(_impl_.create_index_){nullptr}
+    , decltype(_impl_.drop_index_){nullptr}
+    , decltype(_impl_.type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.db_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.db_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_db_name()) {
+    _this->_impl_.db_name_.Set(from._internal_db_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_create_table()) {
+    _this->_impl_.create_table_ = new ::MetaQuery_CreateTable(*from._impl_.create_table_);
+  }
+  if (from._internal_has_drop_table()) {
+    _this->_impl_.drop_table_ = new ::TableRef(*from._impl_.drop_table_);
+  }
+  if (from._internal_has_create_index()) {
+    _this->_impl_.create_index_ = new ::MetaQuery_IndexRef(*from._impl_.create_index_);
+  }
+  if (from._internal_has_drop_index()) {
+    _this->_impl_.drop_index_ = new ::MetaQuery_IndexRef(*from._impl_.drop_index_);
+  }
+  _this->_impl_.type_ = from._impl_.type_;
+  // @@protoc_insertion_point(copy_constructor:MetaQuery)
+}
+
+inline void MetaQuery::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.db_name_){}
+    , decltype(_impl_.create_table_){nullptr}
+    , decltype(_impl_.drop_table_){nullptr}
+    , decltype(_impl_.create_index_){nullptr}
+    , decltype(_impl_.drop_index_){nullptr}
+    , decltype(_impl_.type_){1}
+  };
+  _impl_.db_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.db_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MetaQuery::~MetaQuery() {
+  // @@protoc_insertion_point(destructor:MetaQuery)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MetaQuery::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.db_name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.create_table_;
+  if (this != internal_default_instance()) delete _impl_.drop_table_;
+  if (this != internal_default_instance()) delete _impl_.create_index_;
+  if (this != internal_default_instance()) delete _impl_.drop_index_;
+}
+
+void MetaQuery::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MetaQuery::Clear() {
+// @@protoc_insertion_point(message_clear_start:MetaQuery)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.db_name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.create_table_ != nullptr);
+      _impl_.create_table_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.drop_table_ != nullptr);
+      _impl_.drop_table_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.create_index_ != nullptr);
+      _impl_.create_index_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.drop_index_ != nullptr);
+      _impl_.drop_index_->Clear();
+    }
+    _impl_.type_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MetaQuery::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .MetaQuery.MetaQueryType type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::MetaQuery_MetaQueryType_IsValid(val))) {
+            _internal_set_type(static_cast<::MetaQuery_MetaQueryType>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string db_name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_db_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "MetaQuery.db_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .MetaQuery.CreateTable create_table = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_create_table(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .TableRef drop_table = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_drop_table(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .MetaQuery.IndexRef create_index = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_create_index(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .MetaQuery.IndexRef drop_index = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_drop_index(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MetaQuery::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:MetaQuery)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .MetaQuery.MetaQueryType type = 1;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
+  }
+
+  // optional string db_name = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_db_name().data(), static_cast<int>(this->_internal_db_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "MetaQuery.db_name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_db_name(), target);
+  }
+
+  // optional .MetaQuery.CreateTable create_table = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::create_table(this),
+        _Internal::create_table(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .TableRef drop_table = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::drop_table(this),
+        _Internal::drop_table(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .MetaQuery.IndexRef create_index = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::create_index(this),
+        _Internal::create_index(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .MetaQuery.IndexRef drop_index = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::drop_index(this),
+        _Internal::drop_index(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:MetaQuery)
+  return target;
+}
+
+size_t MetaQuery::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:MetaQuery)
+  size_t total_size = 0;
+
+  // required .MetaQuery.MetaQueryType type = 1;
+  if (_internal_has_type()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional string db_name = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_db_name());
+    }
+
+    // optional .MetaQuery.CreateTable create_table = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.create_table_);
+    }
+
+    // optional .TableRef drop_table = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.drop_table_);
+    }
+
+    // optional .MetaQuery.IndexRef create_index = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.create_index_);
+    }
+
+    // optional .MetaQuery.IndexRef drop_index = 6;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.drop_index_);
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MetaQuery::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MetaQuery::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MetaQuery::GetClassData() const { return &_class_data_; }
+
+
+void MetaQuery::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MetaQuery*>(&to_msg);
+  auto& from = static_cast<const MetaQuery&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MetaQuery)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_db_name(from._internal_db_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_create_table()->::MetaQuery_CreateTable::MergeFrom(
+          from._internal_create_table());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_drop_table()->::TableRef::MergeFrom(
+          from._internal_drop_table());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_create_index()->::MetaQuery_IndexRef::MergeFrom(
+          from._internal_create_index());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_drop_index()->::MetaQuery_IndexRef::MergeFrom(
+          from._internal_drop_index());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MetaQuery::CopyFrom(const MetaQuery& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:MetaQuery)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MetaQuery::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_create_table()) {
+    if (!_impl_.create_table_->IsInitialized()) return false;
+  }
+  if (_internal_has_drop_table()) {
+    if (!_impl_.drop_table_->IsInitialized()) return false;
+  }
+  if (_internal_has_create_index()) {
+    if (!_impl_.create_index_->IsInitialized()) return false;
+  }
+  if (_internal_has_drop_index()) {
+    if (!_impl_.drop_index_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void MetaQuery::InternalSwap(MetaQuery* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.db_name_, lhs_arena,
+      &other->_impl_.db_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MetaQuery, _impl_.drop_index_)
+      + sizeof(MetaQuery::_impl_.drop_index_)
+      - PROTOBUF_FIELD_OFFSET(MetaQuery, _impl_.create_table_)>(
+          reinterpret_cast<char*>(&_impl_.create_table_),
+          reinterpret_cast<char*>(&other->_impl_.create_table_));
+  swap(_impl_.type_, other->_impl_.type_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MetaQuery::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[30]);
+}
+
+// ===================================================================
+
+class Query::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Query>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_token(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::ReadQuery& read_query(const Query* msg);
+  static void set_has_read_query(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::WriteQuery& write_query(const Query* msg);
+  static void set_has_write_query(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::MetaQuery& meta_query(const Query* msg);
+  static void set_has_meta_query(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000018) ^ 0x00000018) != 0;
+  }
+};
+
+const ::ReadQuery&
+Query::_Internal::read_query(const Query* msg) {
+  return *msg->_impl_.read_query_;
+}
+const ::WriteQuery&
+Query::_Internal::write_query(const Query* msg) {
+  return *msg->_impl_.write_query_;
+}
+const ::MetaQuery&
+Query::_Internal::meta_query(const Query* msg) {
+  return *msg->_impl_.meta_query_;
+}
+Query::Query(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Query)
+}
+Query::Query(const Query& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Query* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.read_query_){nullptr}
+    , decltype(_impl_.write_query_){nullptr}
+    , decltype(_impl_.meta_query_){nullptr}
+    , decltype(_impl_.token_){}
+    , decltype(_impl_.type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_read_query()) {
+    _this->_impl_.read_query_ = new ::ReadQuery(*from._impl_.read_query_);
+  }
+  if (from._internal_has_write_query()) {
+    _this->_impl_.write_query_ = new ::WriteQuery(*from._impl_.write_query_);
+  }
+  if (from._internal_has_meta_query()) {
+    _this->_impl_.meta_query_ = new ::MetaQuery(*from._impl_.meta_query_);
+  }
+  ::memcpy(&_impl_.token_, &from._impl_.token_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_) -
+    reinterpret_cast<char*>(&_impl_.token_)) + sizeof(_impl_.type_));
+  // @@protoc_insertion_point(copy_constructor:Query)
+}
+
+inline void Query::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.read_query_){nullptr}
+    , decltype(_impl_.write_query_){nullptr}
+    , decltype(_impl_.meta_query_){nullptr}
+    , decltype(_impl_.token_){int64_t{0}}
+    , decltype(_impl_.type_){1}
+  };
+}
+
+Query::~Query() {
+  // @@protoc_insertion_point(destructor:Query)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Query::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.read_query_;
+  if (this != internal_default_instance()) delete _impl_.write_query_;
+  if (this != internal_default_instance()) delete _impl_.meta_query_;
+}
+
+void Query::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Query::Clear() {
+// @@protoc_insertion_point(message_clear_start:Query)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.read_query_ != nullptr);
+      _impl_.read_query_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.write_query_ != nullptr);
+      _impl_.write_query_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.meta_query_ != nullptr);
+      _impl_.meta_query_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00000018u) {
+    _impl_.token_ = int64_t{0};
+    _impl_.type_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Query::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .Query.QueryType type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::Query_QueryType_IsValid(val))) {
+            _internal_set_type(static_cast<::Query_QueryType>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // required int64 token = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_token(&has_bits);
+          _impl_.token_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .ReadQuery read_query = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_read_query(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .WriteQuery write_query = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_write_query(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .MetaQuery meta_query = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_meta_query(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Query::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Query)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .Query.QueryType type = 1;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
+  }
+
+  // required int64 token = 2;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_token(), target);
+  }
+
+  // optional .ReadQuery read_query = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::read_query(this),
+        _Internal::read_query(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .WriteQuery write_query = 4;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::write_query(this),
+        _Internal::write_query(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .MetaQuery meta_query = 5;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::meta_query(this),
+        _Internal::meta_query(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Query)
+  return target;
+}
+
+size_t Query::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:Query)
+  size_t total_size = 0;
+
+  if (_internal_has_token()) {
+    // required int64 token = 2;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_token());
+  }
+
+  if (_internal_has_type()) {
+    // required .Query.QueryType type = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  return total_size;
+}
+size_t Query::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Query)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000018) ^ 0x00000018) == 0) {  // All required fields are present.
+    // required int64 token = 2;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_token());
+
+    // required .Query.QueryType type = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional .ReadQuery read_query = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.read_query_);
+    }
+
+    // optional .WriteQuery write_query = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.write_query_);
+    }
+
+    // optional .MetaQuery meta_query = 5;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.meta_query_);
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Query::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Query::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Query::GetClassData() const { return &_class_data_; }
+
+
+void Query::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Query*>(&to_msg);
+  auto& from = static_cast<const Query&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Query)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_read_query()->::ReadQuery::MergeFrom(
+          from._internal_read_query());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_write_query()->::WriteQuery::MergeFrom(
+          from._internal_write_query());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_meta_query()->::MetaQuery::MergeFrom(
+          from._internal_meta_query());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.token_ = from._impl_.token_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Query::CopyFrom(const Query& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Query)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Query::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_read_query()) {
+    if (!_impl_.read_query_->IsInitialized()) return false;
+  }
+  if (_internal_has_write_query()) {
+    if (!_impl_.write_query_->IsInitialized()) return false;
+  }
+  if (_internal_has_meta_query()) {
+    if (!_impl_.meta_query_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Query::InternalSwap(Query* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Query, _impl_.token_)
+      + sizeof(Query::_impl_.token_)
+      - PROTOBUF_FIELD_OFFSET(Query, _impl_.read_query_)>(
+          reinterpret_cast<char*>(&_impl_.read_query_),
+          reinterpret_cast<char*>(&other->_impl_.read_query_));
+  swap(_impl_.type_, other->_impl_.type_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Query::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[31]);
+}
+
+// ===================================================================
+
+class Response_Backtrace::_Internal {
+ public:
+};
+
+Response_Backtrace::Response_Backtrace(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Response.Backtrace)
+}
+Response_Backtrace::Response_Backtrace(const Response_Backtrace& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Response_Backtrace* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frame_){from._impl_.frame_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:Response.Backtrace)
+}
+
+inline void Response_Backtrace::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frame_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Response_Backtrace::~Response_Backtrace() {
+  // @@protoc_insertion_point(destructor:Response.Backtrace)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Response_Backtrace::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.frame_.~RepeatedPtrField();
+}
+
+void Response_Backtrace::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Response_Backtrace::Clear() {
+// @@protoc_insertion_point(message_clear_start:Response.Backtrace)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.frame_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Response_Backtrace::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string frame = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_frame();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "Response.Backtrace.frame");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Response_Backtrace::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Response.Backtrace)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string frame = 1;
+  for (int i = 0, n = this->_internal_frame_size(); i < n; i++) {
+    const auto& s = this->_internal_frame(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "Response.Backtrace.frame");
+    target = stream->WriteString(1, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Response.Backtrace)
+  return target;
+}
+
+size_t Response_Backtrace::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Response.Backtrace)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string frame = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.frame_.size());
+  for (int i = 0, n = _impl_.frame_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.frame_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Response_Backtrace::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Response_Backtrace::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Response_Backtrace::GetClassData() const { return &_class_data_; }
+
+
+void Response_Backtrace::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Response_Backtrace*>(&to_msg);
+  auto& from = static_cast<const Response_Backtrace&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Response.Backtrace)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.frame_.MergeFrom(from._impl_.frame_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Response_Backtrace::CopyFrom(const Response_Backtrace& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Response.Backtrace)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Response_Backtrace::IsInitialized() const {
+  return true;
+}
+
+void Response_Backtrace::InternalSwap(Response_Backtrace* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.frame_.InternalSwap(&other->_impl_.frame_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Response_Backtrace::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[32]);
+}
+
+// ===================================================================
+
+class Response::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Response>()._impl_._has_bits_);
+  static void set_has_status_code(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_token(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_error_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::Response_Backtrace& backtrace(const Response* msg);
+  static void set_has_backtrace(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000c) ^ 0x0000000c) != 0;
+  }
+};
+
+const ::Response_Backtrace&
+Response::_Internal::backtrace(const Response* msg) {
+  return *msg->_impl_.backtrace_;
+}
+Response::Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Response)
+}
+Response::Response(const Response& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Response* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.response_){from._impl_.response_}
+    , decltype(_impl_.error_message_){}
+    , decltype(_impl_.backtrace_){nullptr}
+    , decltype(_impl_.token_){}
+    , decltype(_impl_.status_code_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error_message()) {
+    _this->_impl_.error_message_.Set(from._internal_error_message(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_backtrace()) {
+    _this->_impl_.backtrace_ = new ::Response_Backtrace(*from._impl_.backtrace_);
+  }
+  ::memcpy(&_impl_.token_, &from._impl_.token_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.status_code_) -
+    reinterpret_cast<char*>(&_impl_.token_)) + sizeof(_impl_.status_code_));
+  // @@protoc_insertion_point(copy_constructor:Response)
+}
+
+inline void Response::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.response_){arena}
+    , decltype(_impl_.error_message_){}
+    , decltype(_impl_.backtrace_){nullptr}
+    , decltype(_impl_.token_){int64_t{0}}
+    , decltype(_impl_.status_code_){0}
+  };
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Response::~Response() {
+  // @@protoc_insertion_point(destructor:Response)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Response::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.response_.~RepeatedPtrField();
+  _impl_.error_message_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.backtrace_;
+}
+
+void Response::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Response::Clear() {
+// @@protoc_insertion_point(message_clear_start:Response)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.response_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.error_message_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.backtrace_ != nullptr);
+      _impl_.backtrace_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x0000000cu) {
+    ::memset(&_impl_.token_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.status_code_) -
+        reinterpret_cast<char*>(&_impl_.token_)) + sizeof(_impl_.status_code_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .Response.StatusCode status_code = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::Response_StatusCode_IsValid(val))) {
+            _internal_set_status_code(static_cast<::Response_StatusCode>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // required int64 token = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_token(&has_bits);
+          _impl_.token_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string response = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_response();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "Response.response");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string error_message = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_error_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "Response.error_message");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .Response.Backtrace backtrace = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_backtrace(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Response::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Response)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .Response.StatusCode status_code = 1;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_status_code(), target);
+  }
+
+  // required int64 token = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_token(), target);
+  }
+
+  // repeated string response = 3;
+  for (int i = 0, n = this->_internal_response_size(); i < n; i++) {
+    const auto& s = this->_internal_response(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "Response.response");
+    target = stream->WriteString(3, s, target);
+  }
+
+  // optional string error_message = 4;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_error_message().data(), static_cast<int>(this->_internal_error_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "Response.error_message");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_error_message(), target);
+  }
+
+  // optional .Response.Backtrace backtrace = 5;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::backtrace(this),
+        _Internal::backtrace(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Response)
+  return target;
+}
+
+size_t Response::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:Response)
+  size_t total_size = 0;
+
+  if (_internal_has_token()) {
+    // required int64 token = 2;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_token());
+  }
+
+  if (_internal_has_status_code()) {
+    // required .Response.StatusCode status_code = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status_code());
+  }
+
+  return total_size;
+}
+size_t Response::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Response)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000c) ^ 0x0000000c) == 0) {  // All required fields are present.
+    // required int64 token = 2;
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_token());
+
+    // required .Response.StatusCode status_code = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status_code());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string response = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.response_.size());
+  for (int i = 0, n = _impl_.response_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.response_.Get(i));
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string error_message = 4;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_error_message());
+    }
+
+    // optional .Response.Backtrace backtrace = 5;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.backtrace_);
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Response::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Response::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Response::GetClassData() const { return &_class_data_; }
+
+
+void Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Response*>(&to_msg);
+  auto& from = static_cast<const Response&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Response)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.response_.MergeFrom(from._impl_.response_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_error_message(from._internal_error_message());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_backtrace()->::Response_Backtrace::MergeFrom(
+          from._internal_backtrace());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.token_ = from._impl_.token_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.status_code_ = from._impl_.status_code_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Response::CopyFrom(const Response& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Response)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Response::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void Response::InternalSwap(Response* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.response_.InternalSwap(&other->_impl_.response_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_message_, lhs_arena,
+      &other->_impl_.error_message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Response, _impl_.status_code_)
+      + sizeof(Response::_impl_.status_code_)
+      - PROTOBUF_FIELD_OFFSET(Response, _impl_.backtrace_)>(
+          reinterpret_cast<char*>(&_impl_.backtrace_),
+          reinterpret_cast<char*>(&other->_impl_.backtrace_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Response::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_getter, &descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto_once,
+      file_level_metadata_rdb_5fprotocol_2fquery_5flanguage_2eproto[33]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::TableRef*
+Arena::CreateMaybeMessage< ::TableRef >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TableRef >(arena);
+}
+template<> PROTOBUF_NOINLINE ::VarTermTuple*
+Arena::CreateMaybeMessage< ::VarTermTuple >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::VarTermTuple >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Term_Let*
+Arena::CreateMaybeMessage< ::Term_Let >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Term_Let >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Term_Call*
+Arena::CreateMaybeMessage< ::Term_Call >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Term_Call >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Term_If*
+Arena::CreateMaybeMessage< ::Term_If >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Term_If >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Term_GetByKey*
+Arena::CreateMaybeMessage< ::Term_GetByKey >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Term_GetByKey >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Term_Table*
+Arena::CreateMaybeMessage< ::Term_Table >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Term_Table >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Term*
+Arena::CreateMaybeMessage< ::Term >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Term >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Builtin_Filter*
+Arena::CreateMaybeMessage< ::Builtin_Filter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Builtin_Filter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Builtin_Map*
+Arena::CreateMaybeMessage< ::Builtin_Map >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Builtin_Map >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Builtin_ConcatMap*
+Arena::CreateMaybeMessage< ::Builtin_ConcatMap >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Builtin_ConcatMap >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Builtin_OrderBy*
+Arena::CreateMaybeMessage< ::Builtin_OrderBy >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Builtin_OrderBy >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Builtin_GroupedMapReduce*
+Arena::CreateMaybeMessage< ::Builtin_GroupedMapReduce >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Builtin_GroupedMapReduce >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Builtin_Range*
+Arena::CreateMaybeMessage< ::Builtin_Range >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Builtin_Range >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Builtin*
+Arena::CreateMaybeMessage< ::Builtin >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Builtin >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Reduction*
+Arena::CreateMaybeMessage< ::Reduction >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Reduction >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Mapping*
+Arena::CreateMaybeMessage< ::Mapping >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Mapping >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Predicate*
+Arena::CreateMaybeMessage< ::Predicate >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Predicate >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ReadQuery*
+Arena::CreateMaybeMessage< ::ReadQuery >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ReadQuery >(arena);
+}
+template<> PROTOBUF_NOINLINE ::WriteQuery_Update*
+Arena::CreateMaybeMessage< ::WriteQuery_Update >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::WriteQuery_Update >(arena);
+}
+template<> PROTOBUF_NOINLINE ::WriteQuery_Delete*
+Arena::CreateMaybeMessage< ::WriteQuery_Delete >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::WriteQuery_Delete >(arena);
+}
+template<> PROTOBUF_NOINLINE ::WriteQuery_Mutate*
+Arena::CreateMaybeMessage< ::WriteQuery_Mutate >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::WriteQuery_Mutate >(arena);
+}
+template<> PROTOBUF_NOINLINE ::WriteQuery_Insert*
+Arena::CreateMaybeMessage< ::WriteQuery_Insert >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::WriteQuery_Insert >(arena);
+}
+template<> PROTOBUF_NOINLINE ::WriteQuery_ForEach*
+Arena::CreateMaybeMessage< ::WriteQuery_ForEach >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::WriteQuery_ForEach >(arena);
+}
+template<> PROTOBUF_NOINLINE ::WriteQuery_PointUpdate*
+Arena::CreateMaybeMessage< ::WriteQuery_PointUpdate >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::WriteQuery_PointUpdate >(arena);
+}
+template<> PROTOBUF_NOINLINE ::WriteQuery_PointDelete*
+Arena::CreateMaybeMessage< ::WriteQuery_PointDelete >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::WriteQuery_PointDelete >(arena);
+}
+template<> PROTOBUF_NOINLINE ::WriteQuery_PointMutate*
+Arena::CreateMaybeMessage< ::WriteQuery_PointMutate >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::WriteQuery_PointMutate >(arena);
+}
+template<> PROTOBUF_NOINLINE ::WriteQuery*
+Arena::CreateMaybeMessage< ::WriteQuery >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::WriteQuery >(arena);
+}
+template<> PROTOBUF_NOINLINE ::MetaQuery_CreateTable*
+Arena::CreateMaybeMessage< ::MetaQuery_CreateTable >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::MetaQuery_CreateTable >(arena);
+}
+template<> PROTOBUF_NOINLINE ::MetaQuery_IndexRef*
+Arena::CreateMaybeMessage< ::MetaQuery_IndexRef >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::MetaQuery_IndexRef >(arena);
+}
+template<> PROTOBUF_NOINLINE ::MetaQuery*
+Arena::CreateMaybeMessage< ::MetaQuery >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::MetaQuery >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Query*
+Arena::CreateMaybeMessage< ::Query >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Query >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Response_Backtrace*
+Arena::CreateMaybeMessage< ::Response_Backtrace >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Response_Backtrace >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Response*
+Arena::CreateMaybeMessage< ::Response >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Response >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
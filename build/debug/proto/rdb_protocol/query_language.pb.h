@@ -0,0 +1,17563 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: rdb_protocol/query_language.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_rdb_5fprotocol_2fquery_5flanguage_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_rdb_5fprotocol_2fquery_5flanguage_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_rdb_5fprotocol_2fquery_5flanguage_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+class Builtin;
+struct BuiltinDefaultTypeInternal;
+extern BuiltinDefaultTypeInternal _Builtin_default_instance_;
+class Builtin_ConcatMap;
+struct Builtin_ConcatMapDefaultTypeInternal;
+extern Builtin_ConcatMapDefaultTypeInternal _Builtin_ConcatMap_default_instance_;
+class Builtin_Filter;
+struct Builtin_FilterDefaultTypeInternal;
+extern Builtin_FilterDefaultTypeInternal _Builtin_Filter_default_instance_;
+class Builtin_GroupedMapReduce;
+struct Builtin_GroupedMapReduceDefaultTypeInternal;
+extern Builtin_GroupedMapReduceDefaultTypeInternal _Builtin_GroupedMapReduce_default_instance_;
+class Builtin_Map;
+struct Builtin_MapDefaultTypeInternal;
+extern Builtin_MapDefaultTypeInternal _Builtin_Map_default_instance_;
+class Builtin_OrderBy;
+struct Builtin_OrderByDefaultTypeInternal;
+extern Builtin_OrderByDefaultTypeInternal _Builtin_OrderBy_default_instance_;
+class Builtin_Range;
+struct Builtin_RangeDefaultTypeInternal;
+extern Builtin_RangeDefaultTypeInternal _Builtin_Range_default_instance_;
+class Mapping;
+struct MappingDefaultTypeInternal;
+extern MappingDefaultTypeInternal _Mapping_default_instance_;
+class MetaQuery;
+struct MetaQueryDefaultTypeInternal;
+extern MetaQueryDefaultTypeInternal _MetaQuery_default_instance_;
+class MetaQuery_CreateTable;
+struct MetaQuery_CreateTableDefaultTypeInternal;
+extern MetaQuery_CreateTableDefaultTypeInternal _MetaQuery_CreateTable_default_instance_;
+class MetaQuery_IndexRef;
+struct MetaQuery_IndexRefDefaultTypeInternal;
+extern MetaQuery_IndexRefDefaultTypeInternal _MetaQuery_IndexRef_default_instance_;
+class Predicate;
+struct PredicateDefaultTypeInternal;
+extern PredicateDefaultTypeInternal _Predicate_default_instance_;
+class Query;
+struct QueryDefaultTypeInternal;
+extern QueryDefaultTypeInternal _Query_default_instance_;
+class ReadQuery;
+struct ReadQueryDefaultTypeInternal;
+extern ReadQueryDefaultTypeInternal _ReadQuery_default_instance_;
+class Reduction;
+struct ReductionDefaultTypeInternal;
+extern ReductionDefaultTypeInternal _Reduction_default_instance_;
+class Response;
+struct ResponseDefaultTypeInternal;
+extern ResponseDefaultTypeInternal _Response_default_instance_;
+class Response_Backtrace;
+struct Response_BacktraceDefaultTypeInternal;
+extern Response_BacktraceDefaultTypeInternal _Response_Backtrace_default_instance_;
+class TableRef;
+struct TableRefDefaultTypeInternal;
+extern TableRefDefaultTypeInternal _TableRef_default_instance_;
+class Term;
+struct TermDefaultTypeInternal;
+extern TermDefaultTypeInternal _Term_default_instance_;
+class Term_Call;
+struct Term_CallDefaultTypeInternal;
+extern Term_CallDefaultTypeInternal _Term_Call_default_instance_;
+class Term_GetByKey;
+struct Term_GetByKeyDefaultTypeInternal;
+extern Term_GetByKeyDefaultTypeInternal _Term_GetByKey_default_instance_;
+class Term_If;
+struct Term_IfDefaultTypeInternal;
+extern Term_IfDefaultTypeInternal _Term_If_default_instance_;
+class Term_Let;
+struct Term_LetDefaultTypeInternal;
+extern Term_LetDefaultTypeInternal _Term_Let_default_instance_;
+class Term_Table;
+struct Term_TableDefaultTypeInternal;
+extern Term_TableDefaultTypeInternal _Term_Table_default_instance_;
+class VarTermTuple;
+struct VarTermTupleDefaultTypeInternal;
+extern VarTermTupleDefaultTypeInternal _VarTermTuple_default_instance_;
+class WriteQuery;
+struct WriteQueryDefaultTypeInternal;
+extern WriteQueryDefaultTypeInternal _WriteQuery_default_instance_;
+class WriteQuery_Delete;
+struct WriteQuery_DeleteDefaultTypeInternal;
+extern WriteQuery_DeleteDefaultTypeInternal _WriteQuery_Delete_default_instance_;
+class WriteQuery_ForEach;
+struct WriteQuery_ForEachDefaultTypeInternal;
+extern WriteQuery_ForEachDefaultTypeInternal _WriteQuery_ForEach_default_instance_;
+class WriteQuery_Insert;
+struct WriteQuery_InsertDefaultTypeInternal;
+extern WriteQuery_InsertDefaultTypeInternal _WriteQuery_Insert_default_instance_;
+class WriteQuery_Mutate;
+struct WriteQuery_MutateDefaultTypeInternal;
+extern WriteQuery_MutateDefaultTypeInternal _WriteQuery_Mutate_default_instance_;
+class WriteQuery_PointDelete;
+struct WriteQuery_PointDeleteDefaultTypeInternal;
+extern WriteQuery_PointDeleteDefaultTypeInternal _WriteQuery_PointDelete_default_instance_;
+class WriteQuery_PointMutate;
+struct WriteQuery_PointMutateDefaultTypeInternal;
+extern WriteQuery_PointMutateDefaultTypeInternal _WriteQuery_PointMutate_default_instance_;
+class WriteQuery_PointUpdate;
+struct WriteQuery_PointUpdateDefaultTypeInternal;
+extern WriteQuery_PointUpdateDefaultTypeInternal _WriteQuery_PointUpdate_default_instance_;
+class WriteQuery_Update;
+struct WriteQuery_UpdateDefaultTypeInternal;
+extern WriteQuery_UpdateDefaultTypeInternal _WriteQuery_Update_default_instance_;
+PROTOBUF_NAMESPACE_OPEN
+template<> ::Builtin* Arena::CreateMaybeMessage<::Builtin>(Arena*);
+template<> ::Builtin_ConcatMap* Arena::CreateMaybeMessage<::Builtin_ConcatMap>(Arena*);
+template<> ::Builtin_Filter* Arena::CreateMaybeMessage<::Builtin_Filter>(Arena*);
+template<> ::Builtin_GroupedMapReduce* Arena::CreateMaybeMessage<::Builtin_GroupedMapReduce>(Arena*);
+template<> ::Builtin_Map* Arena::CreateMaybeMessage<::Builtin_Map>(Arena*);
+template<> ::Builtin_OrderBy* Arena::CreateMaybeMessage<::Builtin_OrderBy>(Arena*);
+template<> ::Builtin_Range* Arena::CreateMaybeMessage<::Builtin_Range>(Arena*);
+template<> ::Mapping* Arena::CreateMaybeMessage<::Mapping>(Arena*);
+template<> ::MetaQuery* Arena::CreateMaybeMessage<::MetaQuery>(Arena*);
+template<> ::MetaQuery_CreateTable* Arena::CreateMaybeMessage<::MetaQuery_CreateTable>(Arena*);
+template<> ::MetaQuery_IndexRef* Arena::CreateMaybeMessage<::MetaQuery_IndexRef>(Arena*);
+template<> ::Predicate* Arena::CreateMaybeMessage<::Predicate>(Arena*);
+template<> ::Query* Arena::CreateMaybeMessage<::Query>(Arena*);
+template<> ::ReadQuery* Arena::CreateMaybeMessage<::ReadQuery>(Arena*);
+template<> ::Reduction* Arena::CreateMaybeMessage<::Reduction>(Arena*);
+template<> ::Response* Arena::CreateMaybeMessage<::Response>(Arena*);
+template<> ::Response_Backtrace* Arena::CreateMaybeMessage<::Response_Backtrace>(Arena*);
+template<> ::TableRef* Arena::CreateMaybeMessage<::TableRef>(Arena*);
+template<> ::Term* Arena::CreateMaybeMessage<::Term>(Arena*);
+template<> ::Term_Call* Arena::CreateMaybeMessage<::Term_Call>(Arena*);
+template<> ::Term_GetByKey* Arena::CreateMaybeMessage<::Term_GetByKey>(Arena*);
+template<> ::Term_If* Arena::CreateMaybeMessage<::Term_If>(Arena*);
+template<> ::Term_Let* Arena::CreateMaybeMessage<::Term_Let>(Arena*);
+template<> ::Term_Table* Arena::CreateMaybeMessage<::Term_Table>(Arena*);
+template<> ::VarTermTuple* Arena::CreateMaybeMessage<::VarTermTuple>(Arena*);
+template<> ::WriteQuery* Arena::CreateMaybeMessage<::WriteQuery>(Arena*);
+template<> ::WriteQuery_Delete* Arena::CreateMaybeMessage<::WriteQuery_Delete>(Arena*);
+template<> ::WriteQuery_ForEach* Arena::CreateMaybeMessage<::WriteQuery_ForEach>(Arena*);
+template<> ::WriteQuery_Insert* Arena::CreateMaybeMessage<::WriteQuery_Insert>(Arena*);
+template<> ::WriteQuery_Mutate* Arena::CreateMaybeMessage<::WriteQuery_Mutate>(Arena*);
+template<> ::WriteQuery_PointDelete* Arena::CreateMaybeMessage<::WriteQuery_PointDelete>(Arena*);
+template<> ::WriteQuery_PointMutate* Arena::CreateMaybeMessage<::WriteQuery_PointMutate>(Arena*);
+template<> ::WriteQuery_PointUpdate* Arena::CreateMaybeMessage<::WriteQuery_PointUpdate>(Arena*);
+template<> ::WriteQuery_Update* Arena::CreateMaybeMessage<::WriteQuery_Update>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+
+enum Term_TermType : int {
+  Term_TermType_JSON_NULL = 0,
+  Term_TermType_VAR = 1,
+  Term_TermType_LET = 2,
+  Term_TermType_CALL = 3,
+  Term_TermType_IF = 4,
+  Term_TermType_ERROR = 5,
+  Term_TermType_NUMBER = 6,
+  Term_TermType_STRING = 7,
+  Term_TermType_JSON = 8,
+  Term_TermType_BOOL = 9,
+  Term_TermType_ARRAY = 10,
+  Term_TermType_OBJECT = 11,
+  Term_TermType_GETBYKEY = 12,
+  Term_TermType_TABLE = 13,
+  Term_TermType_JAVASCRIPT = 14,
+  Term_TermType_IMPLICIT_VAR = 15
+};
+bool Term_TermType_IsValid(int value);
+constexpr Term_TermType Term_TermType_TermType_MIN = Term_TermType_JSON_NULL;
+constexpr Term_TermType Term_TermType_TermType_MAX = Term_TermType_IMPLICIT_VAR;
+constexpr int Term_TermType_TermType_ARRAYSIZE = Term_TermType_TermType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Term_TermType_descriptor();
+template<typename T>
+inline const std::string& Term_TermType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Term_TermType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Term_TermType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Term_TermType_descriptor(), enum_t_value);
+}
+inline bool Term_TermType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Term_TermType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Term_TermType>(
+    Term_TermType_descriptor(), name, value);
+}
+enum Builtin_BuiltinType : int {
+  Builtin_BuiltinType_NOT = 1,
+  Builtin_BuiltinType_GETATTR = 2,
+  Builtin_BuiltinType_IMPLICIT_GETATTR = 3,
+  Builtin_BuiltinType_HASATTR = 4,
+  Builtin_BuiltinType_IMPLICIT_HASATTR = 5,
+  Builtin_BuiltinType_PICKATTRS = 6,
+  Builtin_BuiltinType_IMPLICIT_PICKATTRS = 7,
+  Builtin_BuiltinType_MAPMERGE = 8,
+  Builtin_BuiltinType_ARRAYAPPEND = 9,
+  Builtin_BuiltinType_SLICE = 11,
+  Builtin_BuiltinType_ADD = 14,
+  Builtin_BuiltinType_SUBTRACT = 15,
+  Builtin_BuiltinType_MULTIPLY = 16,
+  Builtin_BuiltinType_DIVIDE = 17,
+  Builtin_BuiltinType_MODULO = 18,
+  Builtin_BuiltinType_COMPARE = 19,
+  Builtin_BuiltinType_FILTER = 20,
+  Builtin_BuiltinType_MAP = 21,
+  Builtin_BuiltinType_CONCATMAP = 22,
+  Builtin_BuiltinType_ORDERBY = 23,
+  Builtin_BuiltinType_DISTINCT = 24,
+  Builtin_BuiltinType_LENGTH = 26,
+  Builtin_BuiltinType_UNION = 27,
+  Builtin_BuiltinType_NTH = 28,
+  Builtin_BuiltinType_STREAMTOARRAY = 29,
+  Builtin_BuiltinType_ARRAYTOSTREAM = 30,
+  Builtin_BuiltinType_REDUCE = 31,
+  Builtin_BuiltinType_GROUPEDMAPREDUCE = 32,
+  Builtin_BuiltinType_ANY = 35,
+  Builtin_BuiltinType_ALL = 36,
+  Builtin_BuiltinType_RANGE = 37,
+  Builtin_BuiltinType_IMPLICIT_WITHOUT = 38,
+  Builtin_BuiltinType_WITHOUT = 39
+};
+bool Builtin_BuiltinType_IsValid(int value);
+constexpr Builtin_BuiltinType Builtin_BuiltinType_BuiltinType_MIN = Builtin_BuiltinType_NOT;
+constexpr Builtin_BuiltinType Builtin_BuiltinType_BuiltinType_MAX = Builtin_BuiltinType_WITHOUT;
+constexpr int Builtin_BuiltinType_BuiltinType_ARRAYSIZE = Builtin_BuiltinType_BuiltinType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Builtin_BuiltinType_descriptor();
+template<typename T>
+inline const std::string& Builtin_BuiltinType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Builtin_BuiltinType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Builtin_BuiltinType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Builtin_BuiltinType_descriptor(), enum_t_value);
+}
+inline bool Builtin_BuiltinType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Builtin_BuiltinType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Builtin_BuiltinType>(
+    Builtin_BuiltinType_descriptor(), name, value);
+}
+enum Builtin_Comparison : int {
+  Builtin_Comparison_EQ = 1,
+  Builtin_Comparison_NE = 2,
+  Builtin_Comparison_LT = 3,
+  Builtin_Comparison_LE = 4,
+  Builtin_Comparison_GT = 5,
+  Builtin_Comparison_GE = 6
+};
+bool Builtin_Comparison_IsValid(int value);
+constexpr Builtin_Comparison Builtin_Comparison_Comparison_MIN = Builtin_Comparison_EQ;
+constexpr Builtin_Comparison Builtin_Comparison_Comparison_MAX = Builtin_Comparison_GE;
+constexpr int Builtin_Comparison_Comparison_ARRAYSIZE = Builtin_Comparison_Comparison_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Builtin_Comparison_descriptor();
+template<typename T>
+inline const std::string& Builtin_Comparison_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Builtin_Comparison>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Builtin_Comparison_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Builtin_Comparison_descriptor(), enum_t_value);
+}
+inline bool Builtin_Comparison_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Builtin_Comparison* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Builtin_Comparison>(
+    Builtin_Comparison_descriptor(), name, value);
+}
+enum WriteQuery_WriteQueryType : int {
+  WriteQuery_WriteQueryType_UPDATE = 1,
+  WriteQuery_WriteQueryType_DELETE = 2,
+  WriteQuery_WriteQueryType_MUTATE = 3,
+  WriteQuery_WriteQueryType_INSERT = 4,
+  WriteQuery_WriteQueryType_FOREACH = 6,
+  WriteQuery_WriteQueryType_POINTUPDATE = 7,
+  WriteQuery_WriteQueryType_POINTDELETE = 8,
+  WriteQuery_WriteQueryType_POINTMUTATE = 9
+};
+bool WriteQuery_WriteQueryType_IsValid(int value);
+constexpr WriteQuery_WriteQueryType WriteQuery_WriteQueryType_WriteQueryType_MIN = WriteQuery_WriteQueryType_UPDATE;
+constexpr WriteQuery_WriteQueryType WriteQuery_WriteQueryType_WriteQueryType_MAX = WriteQuery_WriteQueryType_POINTMUTATE;
+constexpr int WriteQuery_WriteQueryType_WriteQueryType_ARRAYSIZE = WriteQuery_WriteQueryType_WriteQueryType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* WriteQuery_WriteQueryType_descriptor();
+template<typename T>
+inline const std::string& WriteQuery_WriteQueryType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, WriteQuery_WriteQueryType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function WriteQuery_WriteQueryType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    WriteQuery_WriteQueryType_descriptor(), enum_t_value);
+}
+inline bool WriteQuery_WriteQueryType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, WriteQuery_WriteQueryType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<WriteQuery_WriteQueryType>(
+    WriteQuery_WriteQueryType_descriptor(), name, value);
+}
+enum MetaQuery_MetaQueryType : int {
+  MetaQuery_MetaQueryType_CREATE_DB = 1,
+  MetaQuery_MetaQueryType_DROP_DB = 2,
+  MetaQuery_MetaQueryType_LIST_DBS = 3,
+  MetaQuery_MetaQueryType_CREATE_TABLE = 4,
+  MetaQuery_MetaQueryType_DROP_TABLE = 5,
+  MetaQuery_MetaQueryType_LIST_TABLES = 6,
+  MetaQuery_MetaQueryType_CREATE_INDEX = 7,
+  MetaQuery_MetaQueryType_DROP_INDEX = 8
+};
+bool MetaQuery_MetaQueryType_IsValid(int value);
+constexpr MetaQuery_MetaQueryType MetaQuery_MetaQueryType_MetaQueryType_MIN = MetaQuery_MetaQueryType_CREATE_DB;
+constexpr MetaQuery_MetaQueryType MetaQuery_MetaQueryType_MetaQueryType_MAX = MetaQuery_MetaQueryType_DROP_INDEX;
+constexpr int MetaQuery_MetaQueryType_MetaQueryType_ARRAYSIZE = MetaQuery_MetaQueryType_MetaQueryType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MetaQuery_MetaQueryType_descriptor();
+template<typename T>
+inline const std::string& MetaQuery_MetaQueryType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MetaQuery_MetaQueryType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MetaQuery_MetaQueryType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MetaQuery_MetaQueryType_descriptor(), enum_t_value);
+}
+inline bool MetaQuery_MetaQueryType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MetaQuery_MetaQueryType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MetaQuery_MetaQueryType>(
+    MetaQuery_MetaQueryType_descriptor(), name, value);
+}
+enum Query_QueryType : int {
+  Query_QueryType_READ = 1,
+  Query_QueryType_WRITE = 2,
+  Query_QueryType_CONTINUE = 3,
+  Query_QueryType_STOP = 4,
+  Query_QueryType_META = 5
+};
+bool Query_QueryType_IsValid(int value);
+constexpr Query_QueryType Query_QueryType_QueryType_MIN = Query_QueryType_READ;
+constexpr Query_QueryType Query_QueryType_QueryType_MAX = Query_QueryType_META;
+constexpr int Query_QueryType_QueryType_ARRAYSIZE = Query_QueryType_QueryType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Query_QueryType_descriptor();
+template<typename T>
+inline const std::string& Query_QueryType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Query_QueryType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Query_QueryType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Query_QueryType_descriptor(), enum_t_value);
+}
+inline bool Query_QueryType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Query_QueryType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Query_QueryType>(
+    Query_QueryType_descriptor(), name, value);
+}
+enum Response_StatusCode : int {
+  Response_StatusCode_SUCCESS_EMPTY = 0,
+  Response_StatusCode_SUCCESS_JSON = 1,
+  Response_StatusCode_SUCCESS_PARTIAL = 2,
+  Response_StatusCode_SUCCESS_STREAM = 3,
+  Response_StatusCode_BROKEN_CLIENT = 101,
+  Response_StatusCode_BAD_QUERY = 102,
+  Response_StatusCode_RUNTIME_ERROR = 103
+};
+bool Response_StatusCode_IsValid(int value);
+constexpr Response_StatusCode Response_StatusCode_StatusCode_MIN = Response_StatusCode_SUCCESS_EMPTY;
+constexpr Response_StatusCode Response_StatusCode_StatusCode_MAX = Response_StatusCode_RUNTIME_ERROR;
+constexpr int Response_StatusCode_StatusCode_ARRAYSIZE = Response_StatusCode_StatusCode_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Response_StatusCode_descriptor();
+template<typename T>
+inline const std::string& Response_StatusCode_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Response_StatusCode>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Response_StatusCode_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Response_StatusCode_descriptor(), enum_t_value);
+}
+inline bool Response_StatusCode_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Response_StatusCode* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Response_StatusCode>(
+    Response_StatusCode_descriptor(), name, value);
+}
+// ===================================================================
+
+class TableRef final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TableRef) */ {
+ public:
+  inline TableRef() : TableRef(nullptr) {}
+  ~TableRef() override;
+  explicit PROTOBUF_CONSTEXPR TableRef(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TableRef(const TableRef& from);
+  TableRef(TableRef&& from) noexcept
+    : TableRef() {
+    *this = ::std::move(from);
+  }
+
+  inline TableRef& operator=(const TableRef& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TableRef& operator=(TableRef&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TableRef& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TableRef* internal_default_instance() {
+    return reinterpret_cast<const TableRef*>(
+               &_TableRef_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(TableRef& a, TableRef& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TableRef* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TableRef* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TableRef* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TableRef>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TableRef& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TableRef& from) {
+    TableRef::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TableRef* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "TableRef";
+  }
+  protected:
+  explicit TableRef(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDbNameFieldNumber = 1,
+    kTableNameFieldNumber = 2,
+    kUseOutdatedFieldNumber = 3,
+  };
+  // required string db_name = 1;
+  bool has_db_name() const;
+  private:
+  bool _internal_has_db_name() const;
+  public:
+  void clear_db_name();
+  const std::string& db_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_db_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_db_name();
+  PROTOBUF_NODISCARD std::string* release_db_name();
+  void set_allocated_db_name(std::string* db_name);
+  private:
+  const std::string& _internal_db_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_db_name(const std::string& value);
+  std::string* _internal_mutable_db_name();
+  public:
+
+  // required string table_name = 2;
+  bool has_table_name() const;
+  private:
+  bool _internal_has_table_name() const;
+  public:
+  void clear_table_name();
+  const std::string& table_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_table_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_table_name();
+  PROTOBUF_NODISCARD std::string* release_table_name();
+  void set_allocated_table_name(std::string* table_name);
+  private:
+  const std::string& _internal_table_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_table_name(const std::string& value);
+  std::string* _internal_mutable_table_name();
+  public:
+
+  // optional bool use_outdated = 3 [default = false];
+  bool has_use_outdated() const;
+  private:
+  bool _internal_has_use_outdated() const;
+  public:
+  void clear_use_outdated();
+  bool use_outdated() const;
+  void set_use_outdated(bool value);
+  private:
+  bool _internal_use_outdated() const;
+  void _internal_set_use_outdated(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:TableRef)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr db_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+    bool use_outdated_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class VarTermTuple final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:VarTermTuple) */ {
+ public:
+  inline VarTermTuple() : VarTermTuple(nullptr) {}
+  ~VarTermTuple() override;
+  explicit PROTOBUF_CONSTEXPR VarTermTuple(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  VarTermTuple(const VarTermTuple& from);
+  VarTermTuple(VarTermTuple&& from) noexcept
+    : VarTermTuple() {
+    *this = ::std::move(from);
+  }
+
+  inline VarTermTuple& operator=(const VarTermTuple& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline VarTermTuple& operator=(VarTermTuple&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const VarTermTuple& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VarTermTuple* internal_default_instance() {
+    return reinterpret_cast<const VarTermTuple*>(
+               &_VarTermTuple_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(VarTermTuple& a, VarTermTuple& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(VarTermTuple* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VarTermTuple* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  VarTermTuple* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VarTermTuple>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const VarTermTuple& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const VarTermTuple& from) {
+    VarTermTuple::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(VarTermTuple* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "VarTermTuple";
+  }
+  protected:
+  explicit VarTermTuple(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVarFieldNumber = 1,
+    kTermFieldNumber = 2,
+  };
+  // required string var = 1;
+  bool has_var() const;
+  private:
+  bool _internal_has_var() const;
+  public:
+  void clear_var();
+  const std::string& var() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_var(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_var();
+  PROTOBUF_NODISCARD std::string* release_var();
+  void set_allocated_var(std::string* var);
+  private:
+  const std::string& _internal_var() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_var(const std::string& value);
+  std::string* _internal_mutable_var();
+  public:
+
+  // required .Term term = 2;
+  bool has_term() const;
+  private:
+  bool _internal_has_term() const;
+  public:
+  void clear_term();
+  const ::Term& term() const;
+  PROTOBUF_NODISCARD ::Term* release_term();
+  ::Term* mutable_term();
+  void set_allocated_term(::Term* term);
+  private:
+  const ::Term& _internal_term() const;
+  ::Term* _internal_mutable_term();
+  public:
+  void unsafe_arena_set_allocated_term(
+      ::Term* term);
+  ::Term* unsafe_arena_release_term();
+
+  // @@protoc_insertion_point(class_scope:VarTermTuple)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr var_;
+    ::Term* term_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Term_Let final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Term.Let) */ {
+ public:
+  inline Term_Let() : Term_Let(nullptr) {}
+  ~Term_Let() override;
+  explicit PROTOBUF_CONSTEXPR Term_Let(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Term_Let(const Term_Let& from);
+  Term_Let(Term_Let&& from) noexcept
+    : Term_Let() {
+    *this = ::std::move(from);
+  }
+
+  inline Term_Let& operator=(const Term_Let& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Term_Let& operator=(Term_Let&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Term_Let& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Term_Let* internal_default_instance() {
+    return reinterpret_cast<const Term_Let*>(
+               &_Term_Let_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(Term_Let& a, Term_Let& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Term_Let* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Term_Let* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Term_Let* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Term_Let>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Term_Let& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Term_Let& from) {
+    Term_Let::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Term_Let* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Term.Let";
+  }
+  protected:
+  explicit Term_Let(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBindsFieldNumber = 1,
+    kExprFieldNumber = 2,
+  };
+  // repeated .VarTermTuple binds = 1;
+  int binds_size() const;
+  private:
+  int _internal_binds_size() const;
+  public:
+  void clear_binds();
+  ::VarTermTuple* mutable_binds(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::VarTermTuple >*
+      mutable_binds();
+  private:
+  const ::VarTermTuple& _internal_binds(int index) const;
+  ::VarTermTuple* _internal_add_binds();
+  public:
+  const ::VarTermTuple& binds(int index) const;
+  ::VarTermTuple* add_binds();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::VarTermTuple >&
+      binds() const;
+
+  // required .Term expr = 2;
+  bool has_expr() const;
+  private:
+  bool _internal_has_expr() const;
+  public:
+  void clear_expr();
+  const ::Term& expr() const;
+  PROTOBUF_NODISCARD ::Term* release_expr();
+  ::Term* mutable_expr();
+  void set_allocated_expr(::Term* expr);
+  private:
+  const ::Term& _internal_expr() const;
+  ::Term* _internal_mutable_expr();
+  public:
+  void unsafe_arena_set_allocated_expr(
+      ::Term* expr);
+  ::Term* unsafe_arena_release_expr();
+
+  // @@protoc_insertion_point(class_scope:Term.Let)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::VarTermTuple > binds_;
+    ::Term* expr_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Term_Call final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Term.Call) */ {
+ public:
+  inline Term_Call() : Term_Call(nullptr) {}
+  ~Term_Call() override;
+  explicit PROTOBUF_CONSTEXPR Term_Call(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Term_Call(const Term_Call& from);
+  Term_Call(Term_Call&& from) noexcept
+    : Term_Call() {
+    *this = ::std::move(from);
+  }
+
+  inline Term_Call& operator=(const Term_Call& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Term_Call& operator=(Term_Call&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Term_Call& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Term_Call* internal_default_instance() {
+    return reinterpret_cast<const Term_Call*>(
+               &_Term_Call_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(Term_Call& a, Term_Call& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Term_Call* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Term_Call* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Term_Call* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Term_Call>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Term_Call& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Term_Call& from) {
+    Term_Call::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Term_Call* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Term.Call";
+  }
+  protected:
+  explicit Term_Call(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kArgsFieldNumber = 2,
+    kBuiltinFieldNumber = 1,
+  };
+  // repeated .Term args = 2;
+  int args_size() const;
+  private:
+  int _internal_args_size() const;
+  public:
+  void clear_args();
+  ::Term* mutable_args(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Term >*
+      mutable_args();
+  private:
+  const ::Term& _internal_args(int index) const;
+  ::Term* _internal_add_args();
+  public:
+  const ::Term& args(int index) const;
+  ::Term* add_args();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Term >&
+      args() const;
+
+  // required .Builtin builtin = 1;
+  bool has_builtin() const;
+  private:
+  bool _internal_has_builtin() const;
+  public:
+  void clear_builtin();
+  const ::Builtin& builtin() const;
+  PROTOBUF_NODISCARD ::Builtin* release_builtin();
+  ::Builtin* mutable_builtin();
+  void set_allocated_builtin(::Builtin* builtin);
+  private:
+  const ::Builtin& _internal_builtin() const;
+  ::Builtin* _internal_mutable_builtin();
+  public:
+  void unsafe_arena_set_allocated_builtin(
+      ::Builtin* builtin);
+  ::Builtin* unsafe_arena_release_builtin();
+
+  // @@protoc_insertion_point(class_scope:Term.Call)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Term > args_;
+    ::Builtin* builtin_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Term_If final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Term.If) */ {
+ public:
+  inline Term_If() : Term_If(nullptr) {}
+  ~Term_If() override;
+  explicit PROTOBUF_CONSTEXPR Term_If(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Term_If(const Term_If& from);
+  Term_If(Term_If&& from) noexcept
+    : Term_If() {
+    *this = ::std::move(from);
+  }
+
+  inline Term_If& operator=(const Term_If& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Term_If& operator=(Term_If&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Term_If& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Term_If* internal_default_instance() {
+    return reinterpret_cast<const Term_If*>(
+               &_Term_If_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(Term_If& a, Term_If& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Term_If* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Term_If* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Term_If* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Term_If>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Term_If& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Term_If& from) {
+    Term_If::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Term_If* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Term.If";
+  }
+  protected:
+  explicit Term_If(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTestFieldNumber = 1,
+    kTrueBranchFieldNumber = 2,
+    kFalseBranchFieldNumber = 3,
+  };
+  // required .Term test = 1;
+  bool has_test() const;
+  private:
+  bool _internal_has_test() const;
+  public:
+  void clear_test();
+  const ::Term& test() const;
+  PROTOBUF_NODISCARD ::Term* release_test();
+  ::Term* mutable_test();
+  void set_allocated_test(::Term* test);
+  private:
+  const ::Term& _internal_test() const;
+  ::Term* _internal_mutable_test();
+  public:
+  void unsafe_arena_set_allocated_test(
+      ::Term* test);
+  ::Term* unsafe_arena_release_test();
+
+  // required .Term true_branch = 2;
+  bool has_true_branch() const;
+  private:
+  bool _internal_has_true_branch() const;
+  public:
+  void clear_true_branch();
+  const ::Term& true_branch() const;
+  PROTOBUF_NODISCARD ::Term* release_true_branch();
+  ::Term* mutable_true_branch();
+  void set_allocated_true_branch(::Term* true_branch);
+  private:
+  const ::Term& _internal_true_branch() const;
+  ::Term* _internal_mutable_true_branch();
+  public:
+  void unsafe_arena_set_allocated_true_branch(
+      ::Term* true_branch);
+  ::Term* unsafe_arena_release_true_branch();
+
+  // required .Term false_branch = 3;
+  bool has_false_branch() const;
+  private:
+  bool _internal_has_false_branch() const;
+  public:
+  void clear_false_branch();
+  const ::Term& false_branch() const;
+  PROTOBUF_NODISCARD ::Term* release_false_branch();
+  ::Term* mutable_false_branch();
+  void set_allocated_false_branch(::Term* false_branch);
+  private:
+  const ::Term& _internal_false_branch() const;
+  ::Term* _internal_mutable_false_branch();
+  public:
+  void unsafe_arena_set_allocated_false_branch(
+      ::Term* false_branch);
+  ::Term* unsafe_arena_release_false_branch();
+
+  // @@protoc_insertion_point(class_scope:Term.If)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::Term* test_;
+    ::Term* true_branch_;
+    ::Term* false_branch_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Term_GetByKey final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Term.GetByKey) */ {
+ public:
+  inline Term_GetByKey() : Term_GetByKey(nullptr) {}
+  ~Term_GetByKey() override;
+  explicit PROTOBUF_CONSTEXPR Term_GetByKey(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Term_GetByKey(const Term_GetByKey& from);
+  Term_GetByKey(Term_GetByKey&& from) noexcept
+    : Term_GetByKey() {
+    *this = ::std::move(from);
+  }
+
+  inline Term_GetByKey& operator=(const Term_GetByKey& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Term_GetByKey& operator=(Term_GetByKey&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Term_GetByKey& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Term_GetByKey* internal_default_instance() {
+    return reinterpret_cast<const Term_GetByKey*>(
+               &_Term_GetByKey_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(Term_GetByKey& a, Term_GetByKey& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Term_GetByKey* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Term_GetByKey* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Term_GetByKey* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Term_GetByKey>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Term_GetByKey& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Term_GetByKey& from) {
+    Term_GetByKey::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Term_GetByKey* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Term.GetByKey";
+  }
+  protected:
+  explicit Term_GetByKey(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAttrnameFieldNumber = 2,
+    kTableRefFieldNumber = 1,
+    kKeyFieldNumber = 3,
+  };
+  // required string attrname = 2;
+  bool has_attrname() const;
+  private:
+  bool _internal_has_attrname() const;
+  public:
+  void clear_attrname();
+  const std::string& attrname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_attrname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_attrname();
+  PROTOBUF_NODISCARD std::string* release_attrname();
+  void set_allocated_attrname(std::string* attrname);
+  private:
+  const std::string& _internal_attrname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_attrname(const std::string& value);
+  std::string* _internal_mutable_attrname();
+  public:
+
+  // required .TableRef table_ref = 1;
+  bool has_table_ref() const;
+  private:
+  bool _internal_has_table_ref() const;
+  public:
+  void clear_table_ref();
+  const ::TableRef& table_ref() const;
+  PROTOBUF_NODISCARD ::TableRef* release_table_ref();
+  ::TableRef* mutable_table_ref();
+  void set_allocated_table_ref(::TableRef* table_ref);
+  private:
+  const ::TableRef& _internal_table_ref() const;
+  ::TableRef* _internal_mutable_table_ref();
+  public:
+  void unsafe_arena_set_allocated_table_ref(
+      ::TableRef* table_ref);
+  ::TableRef* unsafe_arena_release_table_ref();
+
+  // required .Term key = 3;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const ::Term& key() const;
+  PROTOBUF_NODISCARD ::Term* release_key();
+  ::Term* mutable_key();
+  void set_allocated_key(::Term* key);
+  private:
+  const ::Term& _internal_key() const;
+  ::Term* _internal_mutable_key();
+  public:
+  void unsafe_arena_set_allocated_key(
+      ::Term* key);
+  ::Term* unsafe_arena_release_key();
+
+  // @@protoc_insertion_point(class_scope:Term.GetByKey)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr attrname_;
+    ::TableRef* table_ref_;
+    ::Term* key_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Term_Table final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Term.Table) */ {
+ public:
+  inline Term_Table() : Term_Table(nullptr) {}
+  ~Term_Table() override;
+  explicit PROTOBUF_CONSTEXPR Term_Table(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Term_Table(const Term_Table& from);
+  Term_Table(Term_Table&& from) noexcept
+    : Term_Table() {
+    *this = ::std::move(from);
+  }
+
+  inline Term_Table& operator=(const Term_Table& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Term_Table& operator=(Term_Table&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Term_Table& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Term_Table* internal_default_instance() {
+    return reinterpret_cast<const Term_Table*>(
+               &_Term_Table_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(Term_Table& a, Term_Table& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Term_Table* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Term_Table* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Term_Table* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Term_Table>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Term_Table& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Term_Table& from) {
+    Term_Table::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Term_Table* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Term.Table";
+  }
+  protected:
+  explicit Term_Table(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTableRefFieldNumber = 1,
+  };
+  // required .TableRef table_ref = 1;
+  bool has_table_ref() const;
+  private:
+  bool _internal_has_table_ref() const;
+  public:
+  void clear_table_ref();
+  const ::TableRef& table_ref() const;
+  PROTOBUF_NODISCARD ::TableRef* release_table_ref();
+  ::TableRef* mutable_table_ref();
+  void set_allocated_table_ref(::TableRef* table_ref);
+  private:
+  const ::TableRef& _internal_table_ref() const;
+  ::TableRef* _internal_mutable_table_ref();
+  public:
+  void unsafe_arena_set_allocated_table_ref(
+      ::TableRef* table_ref);
+  ::TableRef* unsafe_arena_release_table_ref();
+
+  // @@protoc_insertion_point(class_scope:Term.Table)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::TableRef* table_ref_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Term final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Term) */ {
+ public:
+  inline Term() : Term(nullptr) {}
+  ~Term() override;
+  explicit PROTOBUF_CONSTEXPR Term(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Term(const Term& from);
+  Term(Term&& from) noexcept
+    : Term() {
+    *this = ::std::move(from);
+  }
+
+  inline Term& operator=(const Term& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Term& operator=(Term&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Term& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Term* internal_default_instance() {
+    return reinterpret_cast<const Term*>(
+               &_Term_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(Term& a, Term& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Term* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Term* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Term* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Term>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Term& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Term& from) {
+    Term::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Term* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Term";
+  }
+  protected:
+  explicit Term(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Term_Let Let;
+  typedef Term_Call Call;
+  typedef Term_If If;
+  typedef Term_GetByKey GetByKey;
+  typedef Term_Table Table;
+
+  typedef Term_TermType TermType;
+  static constexpr TermType JSON_NULL =
+    Term_TermType_JSON_NULL;
+  static constexpr TermType VAR =
+    Term_TermType_VAR;
+  static constexpr TermType LET =
+    Term_TermType_LET;
+  static constexpr TermType CALL =
+    Term_TermType_CALL;
+  static constexpr TermType IF =
+    Term_TermType_IF;
+  static constexpr TermType ERROR =
+    Term_TermType_ERROR;
+  static constexpr TermType NUMBER =
+    Term_TermType_NUMBER;
+  static constexpr TermType STRING =
+    Term_TermType_STRING;
+  static constexpr TermType JSON =
+    Term_TermType_JSON;
+  static constexpr TermType BOOL =
+    Term_TermType_BOOL;
+  static constexpr TermType ARRAY =
+    Term_TermType_ARRAY;
+  static constexpr TermType OBJECT =
+    Term_TermType_OBJECT;
+  static constexpr TermType GETBYKEY =
+    Term_TermType_GETBYKEY;
+  static constexpr TermType TABLE =
+    Term_TermType_TABLE;
+  static constexpr TermType JAVASCRIPT =
+    Term_TermType_JAVASCRIPT;
+  static constexpr TermType IMPLICIT_VAR =
+    Term_TermType_IMPLICIT_VAR;
+  static inline bool TermType_IsValid(int value) {
+    return Term_TermType_IsValid(value);
+  }
+  static constexpr TermType TermType_MIN =
+    Term_TermType_TermType_MIN;
+  static constexpr TermType TermType_MAX =
+    Term_TermType_TermType_MAX;
+  static constexpr int TermType_ARRAYSIZE =
+    Term_TermType_TermType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  TermType_descriptor() {
+    return Term_TermType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& TermType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, TermType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function TermType_Name.");
+    return Term_TermType_Name(enum_t_value);
+  }
+  static inline bool TermType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      TermType* value) {
+    return Term_TermType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kArrayFieldNumber = 11,
+    kObjectFieldNumber = 12,
+    kVarFieldNumber = 2,
+    kErrorFieldNumber = 6,
+    kValuestringFieldNumber = 8,
+    kJsonstringFieldNumber = 9,
+    kJavascriptFieldNumber = 16,
+    kLetFieldNumber = 3,
+    kCallFieldNumber = 4,
+    kIfFieldNumber = 5,
+    kGetByKeyFieldNumber = 14,
+    kTableFieldNumber = 15,
+    kTypeFieldNumber = 1,
+    kValueboolFieldNumber = 10,
+    kNumberFieldNumber = 7,
+  };
+  // repeated .Term array = 11;
+  int array_size() const;
+  private:
+  int _internal_array_size() const;
+  public:
+  void clear_array();
+  ::Term* mutable_array(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Term >*
+      mutable_array();
+  private:
+  const ::Term& _internal_array(int index) const;
+  ::Term* _internal_add_array();
+  public:
+  const ::Term& array(int index) const;
+  ::Term* add_array();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Term >&
+      array() const;
+
+  // repeated .VarTermTuple object = 12;
+  int object_size() const;
+  private:
+  int _internal_object_size() const;
+  public:
+  void clear_object();
+  ::VarTermTuple* mutable_object(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::VarTermTuple >*
+      mutable_object();
+  private:
+  const ::VarTermTuple& _internal_object(int index) const;
+  ::VarTermTuple* _internal_add_object();
+  public:
+  const ::VarTermTuple& object(int index) const;
+  ::VarTermTuple* add_object();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::VarTermTuple >&
+      object() const;
+
+  // optional string var = 2;
+  bool has_var() const;
+  private:
+  bool _internal_has_var() const;
+  public:
+  void clear_var();
+  const std::string& var() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_var(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_var();
+  PROTOBUF_NODISCARD std::string* release_var();
+  void set_allocated_var(std::string* var);
+  private:
+  const std::string& _internal_var() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_var(const std::string& value);
+  std::string* _internal_mutable_var();
+  public:
+
+  // optional string error = 6;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // optional string valuestring = 8;
+  bool has_valuestring() const;
+  private:
+  bool _internal_has_valuestring() const;
+  public:
+  void clear_valuestring();
+  const std::string& valuestring() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_valuestring(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_valuestring();
+  PROTOBUF_NODISCARD std::string* release_valuestring();
+  void set_allocated_valuestring(std::string* valuestring);
+  private:
+  const std::string& _internal_valuestring() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_valuestring(const std::string& value);
+  std::string* _internal_mutable_valuestring();
+  public:
+
+  // optional string jsonstring = 9;
+  bool has_jsonstring() const;
+  private:
+  bool _internal_has_jsonstring() const;
+  public:
+  void clear_jsonstring();
+  const std::string& jsonstring() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_jsonstring(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_jsonstring();
+  PROTOBUF_NODISCARD std::string* release_jsonstring();
+  void set_allocated_jsonstring(std::string* jsonstring);
+  private:
+  const std::string& _internal_jsonstring() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_jsonstring(const std::string& value);
+  std::string* _internal_mutable_jsonstring();
+  public:
+
+  // optional string javascript = 16;
+  bool has_javascript() const;
+  private:
+  bool _internal_has_javascript() const;
+  public:
+  void clear_javascript();
+  const std::string& javascript() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_javascript(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_javascript();
+  PROTOBUF_NODISCARD std::string* release_javascript();
+  void set_allocated_javascript(std::string* javascript);
+  private:
+  const std::string& _internal_javascript() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_javascript(const std::string& value);
+  std::string* _internal_mutable_javascript();
+  public:
+
+  // optional .Term.Let let = 3;
+  bool has_let() const;
+  private:
+  bool _internal_has_let() const;
+  public:
+  void clear_let();
+  const ::Term_Let& let() const;
+  PROTOBUF_NODISCARD ::Term_Let* release_let();
+  ::Term_Let* mutable_let();
+  void set_allocated_let(::Term_Let* let);
+  private:
+  const ::Term_Let& _internal_let() const;
+  ::Term_Let* _internal_mutable_let();
+  public:
+  void unsafe_arena_set_allocated_let(
+      ::Term_Let* let);
+  ::Term_Let* unsafe_arena_release_let();
+
+  // optional .Term.Call call = 4;
+  bool has_call() const;
+  private:
+  bool _internal_has_call() const;
+  public:
+  void clear_call();
+  const ::Term_Call& call() const;
+  PROTOBUF_NODISCARD ::Term_Call* release_call();
+  ::Term_Call* mutable_call();
+  void set_allocated_call(::Term_Call* call);
+  private:
+  const ::Term_Call& _internal_call() const;
+  ::Term_Call* _internal_mutable_call();
+  public:
+  void unsafe_arena_set_allocated_call(
+      ::Term_Call* call);
+  ::Term_Call* unsafe_arena_release_call();
+
+  // optional .Term.If if_ = 5;
+  bool has_if_() const;
+  private:
+  bool _internal_has_if_() const;
+  public:
+  void clear_if_();
+  const ::Term_If& if_() const;
+  PROTOBUF_NODISCARD ::Term_If* release_if_();
+  ::Term_If* mutable_if_();
+  void set_allocated_if_(::Term_If* if_);
+  private:
+  const ::Term_If& _internal_if_() const;
+  ::Term_If* _internal_mutable_if_();
+  public:
+  void unsafe_arena_set_allocated_if_(
+      ::Term_If* if_);
+  ::Term_If* unsafe_arena_release_if_();
+
+  // optional .Term.GetByKey get_by_key = 14;
+  bool has_get_by_key() const;
+  private:
+  bool _internal_has_get_by_key() const;
+  public:
+  void clear_get_by_key();
+  const ::Term_GetByKey& get_by_key() const;
+  PROTOBUF_NODISCARD ::Term_GetByKey* release_get_by_key();
+  ::Term_GetByKey* mutable_get_by_key();
+  void set_allocated_get_by_key(::Term_GetByKey* get_by_key);
+  private:
+  const ::Term_GetByKey& _internal_get_by_key() const;
+  ::Term_GetByKey* _internal_mutable_get_by_key();
+  public:
+  void unsafe_arena_set_allocated_get_by_key(
+      ::Term_GetByKey* get_by_key);
+  ::Term_GetByKey* unsafe_arena_release_get_by_key();
+
+  // optional .Term.Table table = 15;
+  bool has_table() const;
+  private:
+  bool _internal_has_table() const;
+  public:
+  void clear_table();
+  const ::Term_Table& table() const;
+  PROTOBUF_NODISCARD ::Term_Table* release_table();
+  ::Term_Table* mutable_table();
+  void set_allocated_table(::Term_Table* table);
+  private:
+  const ::Term_Table& _internal_table() const;
+  ::Term_Table* _internal_mutable_table();
+  public:
+  void unsafe_arena_set_allocated_table(
+      ::Term_Table* table);
+  ::Term_Table* unsafe_arena_release_table();
+
+  // required .Term.TermType type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::Term_TermType type() const;
+  void set_type(::Term_TermType value);
+  private:
+  ::Term_TermType _internal_type() const;
+  void _internal_set_type(::Term_TermType value);
+  public:
+
+  // optional bool valuebool = 10;
+  bool has_valuebool() const;
+  private:
+  bool _internal_has_valuebool() const;
+  public:
+  void clear_valuebool();
+  bool valuebool() const;
+  void set_valuebool(bool value);
+  private:
+  bool _internal_valuebool() const;
+  void _internal_set_valuebool(bool value);
+  public:
+
+  // optional double number = 7;
+  bool has_number() const;
+  private:
+  bool _internal_has_number() const;
+  public:
+  void clear_number();
+  double number() const;
+  void set_number(double value);
+  private:
+  double _internal_number() const;
+  void _internal_set_number(double value);
+  public:
+
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline bool HasExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Term, _proto_TypeTraits, _field_type, _is_packed>& id) const {
+
+    return _impl_._extensions_.Has(id.number());
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void ClearExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Term, _proto_TypeTraits, _field_type, _is_packed>& id) {
+    _impl_._extensions_.ClearExtension(id.number());
+
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline int ExtensionSize(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Term, _proto_TypeTraits, _field_type, _is_packed>& id) const {
+
+    return _impl_._extensions_.ExtensionSize(id.number());
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Term, _proto_TypeTraits, _field_type, _is_packed>& id) const {
+
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_,
+                                  id.default_value());
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType MutableExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Term, _proto_TypeTraits, _field_type, _is_packed>& id) {
+
+    return _proto_TypeTraits::Mutable(id.number(), _field_type,
+                                      &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Term, _proto_TypeTraits, _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), _field_type, value, &_impl_._extensions_);
+
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetAllocatedExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Term, _proto_TypeTraits, _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::SetAllocated(id.number(), _field_type, value,
+                                    &_impl_._extensions_);
+
+  }
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void UnsafeArenaSetAllocatedExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Term, _proto_TypeTraits, _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::UnsafeArenaSetAllocated(id.number(), _field_type,
+                                               value, &_impl_._extensions_);
+
+  }
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  PROTOBUF_NODISCARD inline
+      typename _proto_TypeTraits::Singular::MutableType
+      ReleaseExtension(
+          const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+              Term, _proto_TypeTraits, _field_type, _is_packed>& id) {
+
+    return _proto_TypeTraits::Release(id.number(), _field_type,
+                                      &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType
+  UnsafeArenaReleaseExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Term, _proto_TypeTraits, _field_type, _is_packed>& id) {
+
+    return _proto_TypeTraits::UnsafeArenaRelease(id.number(), _field_type,
+                                                 &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Term, _proto_TypeTraits, _field_type, _is_packed>& id,
+      int index) const {
+
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType MutableExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Term, _proto_TypeTraits, _field_type, _is_packed>& id,
+      int index) {
+
+    return _proto_TypeTraits::Mutable(id.number(), index, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Term, _proto_TypeTraits, _field_type, _is_packed>& id,
+      int index, typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), index, value, &_impl_._extensions_);
+
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType AddExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Term, _proto_TypeTraits, _field_type, _is_packed>& id) {
+    typename _proto_TypeTraits::Repeated::MutableType to_add =
+        _proto_TypeTraits::Add(id.number(), _field_type, &_impl_._extensions_);
+
+    return to_add;
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void AddExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Term, _proto_TypeTraits, _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Add(id.number(), _field_type, _is_packed, value,
+                           &_impl_._extensions_);
+
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline const typename _proto_TypeTraits::Repeated::RepeatedFieldType&
+  GetRepeatedExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Term, _proto_TypeTraits, _field_type, _is_packed>& id) const {
+
+    return _proto_TypeTraits::GetRepeated(id.number(), _impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::RepeatedFieldType*
+  MutableRepeatedExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Term, _proto_TypeTraits, _field_type, _is_packed>& id) {
+
+    return _proto_TypeTraits::MutableRepeated(id.number(), _field_type,
+                                              _is_packed, &_impl_._extensions_);
+  }
+
+  // @@protoc_insertion_point(class_scope:Term)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ExtensionSet _extensions_;
+
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Term > array_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::VarTermTuple > object_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr var_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr valuestring_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr jsonstring_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr javascript_;
+    ::Term_Let* let_;
+    ::Term_Call* call_;
+    ::Term_If* if__;
+    ::Term_GetByKey* get_by_key_;
+    ::Term_Table* table_;
+    int type_;
+    bool valuebool_;
+    double number_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Builtin_Filter final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Builtin.Filter) */ {
+ public:
+  inline Builtin_Filter() : Builtin_Filter(nullptr) {}
+  ~Builtin_Filter() override;
+  explicit PROTOBUF_CONSTEXPR Builtin_Filter(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Builtin_Filter(const Builtin_Filter& from);
+  Builtin_Filter(Builtin_Filter&& from) noexcept
+    : Builtin_Filter() {
+    *this = ::std::move(from);
+  }
+
+  inline Builtin_Filter& operator=(const Builtin_Filter& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Builtin_Filter& operator=(Builtin_Filter&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Builtin_Filter& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Builtin_Filter* internal_default_instance() {
+    return reinterpret_cast<const Builtin_Filter*>(
+               &_Builtin_Filter_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(Builtin_Filter& a, Builtin_Filter& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Builtin_Filter* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Builtin_Filter* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Builtin_Filter* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Builtin_Filter>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Builtin_Filter& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Builtin_Filter& from) {
+    Builtin_Filter::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Builtin_Filter* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Builtin.Filter";
+  }
+  protected:
+  explicit Builtin_Filter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPredicateFieldNumber = 1,
+  };
+  // required .Predicate predicate = 1;
+  bool has_predicate() const;
+  private:
+  bool _internal_has_predicate() const;
+  public:
+  void clear_predicate();
+  const ::Predicate& predicate() const;
+  PROTOBUF_NODISCARD ::Predicate* release_predicate();
+  ::Predicate* mutable_predicate();
+  void set_allocated_predicate(::Predicate* predicate);
+  private:
+  const ::Predicate& _internal_predicate() const;
+  ::Predicate* _internal_mutable_predicate();
+  public:
+  void unsafe_arena_set_allocated_predicate(
+      ::Predicate* predicate);
+  ::Predicate* unsafe_arena_release_predicate();
+
+  // @@protoc_insertion_point(class_scope:Builtin.Filter)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::Predicate* predicate_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Builtin_Map final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Builtin.Map) */ {
+ public:
+  inline Builtin_Map() : Builtin_Map(nullptr) {}
+  ~Builtin_Map() override;
+  explicit PROTOBUF_CONSTEXPR Builtin_Map(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Builtin_Map(const Builtin_Map& from);
+  Builtin_Map(Builtin_Map&& from) noexcept
+    : Builtin_Map() {
+    *this = ::std::move(from);
+  }
+
+  inline Builtin_Map& operator=(const Builtin_Map& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Builtin_Map& operator=(Builtin_Map&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Builtin_Map& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Builtin_Map* internal_default_instance() {
+    return reinterpret_cast<const Builtin_Map*>(
+               &_Builtin_Map_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(Builtin_Map& a, Builtin_Map& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Builtin_Map* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Builtin_Map* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Builtin_Map* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Builtin_Map>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Builtin_Map& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Builtin_Map& from) {
+    Builtin_Map::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Builtin_Map* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Builtin.Map";
+  }
+  protected:
+  explicit Builtin_Map(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMappingFieldNumber = 1,
+  };
+  // required .Mapping mapping = 1;
+  bool has_mapping() const;
+  private:
+  bool _internal_has_mapping() const;
+  public:
+  void clear_mapping();
+  const ::Mapping& mapping() const;
+  PROTOBUF_NODISCARD ::Mapping* release_mapping();
+  ::Mapping* mutable_mapping();
+  void set_allocated_mapping(::Mapping* mapping);
+  private:
+  const ::Mapping& _internal_mapping() const;
+  ::Mapping* _internal_mutable_mapping();
+  public:
+  void unsafe_arena_set_allocated_mapping(
+      ::Mapping* mapping);
+  ::Mapping* unsafe_arena_release_mapping();
+
+  // @@protoc_insertion_point(class_scope:Builtin.Map)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::Mapping* mapping_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Builtin_ConcatMap final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Builtin.ConcatMap) */ {
+ public:
+  inline Builtin_ConcatMap() : Builtin_ConcatMap(nullptr) {}
+  ~Builtin_ConcatMap() override;
+  explicit PROTOBUF_CONSTEXPR Builtin_ConcatMap(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Builtin_ConcatMap(const Builtin_ConcatMap& from);
+  Builtin_ConcatMap(Builtin_ConcatMap&& from) noexcept
+    : Builtin_ConcatMap() {
+    *this = ::std::move(from);
+  }
+
+  inline Builtin_ConcatMap& operator=(const Builtin_ConcatMap& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Builtin_ConcatMap& operator=(Builtin_ConcatMap&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Builtin_ConcatMap& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Builtin_ConcatMap* internal_default_instance() {
+    return reinterpret_cast<const Builtin_ConcatMap*>(
+               &_Builtin_ConcatMap_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(Builtin_ConcatMap& a, Builtin_ConcatMap& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Builtin_ConcatMap* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Builtin_ConcatMap* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Builtin_ConcatMap* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Builtin_ConcatMap>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Builtin_ConcatMap& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Builtin_ConcatMap& from) {
+    Builtin_ConcatMap::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Builtin_ConcatMap* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Builtin.ConcatMap";
+  }
+  protected:
+  explicit Builtin_ConcatMap(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMappingFieldNumber = 1,
+  };
+  // required .Mapping mapping = 1;
+  bool has_mapping() const;
+  private:
+  bool _internal_has_mapping() const;
+  public:
+  void clear_mapping();
+  const ::Mapping& mapping() const;
+  PROTOBUF_NODISCARD ::Mapping* release_mapping();
+  ::Mapping* mutable_mapping();
+  void set_allocated_mapping(::Mapping* mapping);
+  private:
+  const ::Mapping& _internal_mapping() const;
+  ::Mapping* _internal_mutable_mapping();
+  public:
+  void unsafe_arena_set_allocated_mapping(
+      ::Mapping* mapping);
+  ::Mapping* unsafe_arena_release_mapping();
+
+  // @@protoc_insertion_point(class_scope:Builtin.ConcatMap)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::Mapping* mapping_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Builtin_OrderBy final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Builtin.OrderBy) */ {
+ public:
+  inline Builtin_OrderBy() : Builtin_OrderBy(nullptr) {}
+  ~Builtin_OrderBy() override;
+  explicit PROTOBUF_CONSTEXPR Builtin_OrderBy(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Builtin_OrderBy(const Builtin_OrderBy& from);
+  Builtin_OrderBy(Builtin_OrderBy&& from) noexcept
+    : Builtin_OrderBy() {
+    *this = ::std::move(from);
+  }
+
+  inline Builtin_OrderBy& operator=(const Builtin_OrderBy& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Builtin_OrderBy& operator=(Builtin_OrderBy&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Builtin_OrderBy& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Builtin_OrderBy* internal_default_instance() {
+    return reinterpret_cast<const Builtin_OrderBy*>(
+               &_Builtin_OrderBy_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(Builtin_OrderBy& a, Builtin_OrderBy& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Builtin_OrderBy* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Builtin_OrderBy* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Builtin_OrderBy* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Builtin_OrderBy>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Builtin_OrderBy& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Builtin_OrderBy& from) {
+    Builtin_OrderBy::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Builtin_OrderBy* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Builtin.OrderBy";
+  }
+  protected:
+  explicit Builtin_OrderBy(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAttrFieldNumber = 1,
+    kAscendingFieldNumber = 2,
+  };
+  // required string attr = 1;
+  bool has_attr() const;
+  private:
+  bool _internal_has_attr() const;
+  public:
+  void clear_attr();
+  const std::string& attr() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_attr(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_attr();
+  PROTOBUF_NODISCARD std::string* release_attr();
+  void set_allocated_attr(std::string* attr);
+  private:
+  const std::string& _internal_attr() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_attr(const std::string& value);
+  std::string* _internal_mutable_attr();
+  public:
+
+  // optional bool ascending = 2 [default = true];
+  bool has_ascending() const;
+  private:
+  bool _internal_has_ascending() const;
+  public:
+  void clear_ascending();
+  bool ascending() const;
+  void set_ascending(bool value);
+  private:
+  bool _internal_ascending() const;
+  void _internal_set_ascending(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Builtin.OrderBy)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr attr_;
+    bool ascending_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Builtin_GroupedMapReduce final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Builtin.GroupedMapReduce) */ {
+ public:
+  inline Builtin_GroupedMapReduce() : Builtin_GroupedMapReduce(nullptr) {}
+  ~Builtin_GroupedMapReduce() override;
+  explicit PROTOBUF_CONSTEXPR Builtin_GroupedMapReduce(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Builtin_GroupedMapReduce(const Builtin_GroupedMapReduce& from);
+  Builtin_GroupedMapReduce(Builtin_GroupedMapReduce&& from) noexcept
+    : Builtin_GroupedMapReduce() {
+    *this = ::std::move(from);
+  }
+
+  inline Builtin_GroupedMapReduce& operator=(const Builtin_GroupedMapReduce& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Builtin_GroupedMapReduce& operator=(Builtin_GroupedMapReduce&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Builtin_GroupedMapReduce& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Builtin_GroupedMapReduce* internal_default_instance() {
+    return reinterpret_cast<const Builtin_GroupedMapReduce*>(
+               &_Builtin_GroupedMapReduce_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(Builtin_GroupedMapReduce& a, Builtin_GroupedMapReduce& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Builtin_GroupedMapReduce* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Builtin_GroupedMapReduce* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Builtin_GroupedMapReduce* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Builtin_GroupedMapReduce>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Builtin_GroupedMapReduce& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Builtin_GroupedMapReduce& from) {
+    Builtin_GroupedMapReduce::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Builtin_GroupedMapReduce* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Builtin.GroupedMapReduce";
+  }
+  protected:
+  explicit Builtin_GroupedMapReduce(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kGroupMappingFieldNumber = 1,
+    kValueMappingFieldNumber = 2,
+    kReductionFieldNumber = 3,
+  };
+  // required .Mapping group_mapping = 1;
+  bool has_group_mapping() const;
+  private:
+  bool _internal_has_group_mapping() const;
+  public:
+  void clear_group_mapping();
+  const ::Mapping& group_mapping() const;
+  PROTOBUF_NODISCARD ::Mapping* release_group_mapping();
+  ::Mapping* mutable_group_mapping();
+  void set_allocated_group_mapping(::Mapping* group_mapping);
+  private:
+  const ::Mapping& _internal_group_mapping() const;
+  ::Mapping* _internal_mutable_group_mapping();
+  public:
+  void unsafe_arena_set_allocated_group_mapping(
+      ::Mapping* group_mapping);
+  ::Mapping* unsafe_arena_release_group_mapping();
+
+  // required .Mapping value_mapping = 2;
+  bool has_value_mapping() const;
+  private:
+  bool _internal_has_value_mapping() const;
+  public:
+  void clear_value_mapping();
+  const ::Mapping& value_mapping() const;
+  PROTOBUF_NODISCARD ::Mapping* release_value_mapping();
+  ::Mapping* mutable_value_mapping();
+  void set_allocated_value_mapping(::Mapping* value_mapping);
+  private:
+  const ::Mapping& _internal_value_mapping() const;
+  ::Mapping* _internal_mutable_value_mapping();
+  public:
+  void unsafe_arena_set_allocated_value_mapping(
+      ::Mapping* value_mapping);
+  ::Mapping* unsafe_arena_release_value_mapping();
+
+  // required .Reduction reduction = 3;
+  bool has_reduction() const;
+  private:
+  bool _internal_has_reduction() const;
+  public:
+  void clear_reduction();
+  const ::Reduction& reduction() const;
+  PROTOBUF_NODISCARD ::Reduction* release_reduction();
+  ::Reduction* mutable_reduction();
+  void set_allocated_reduction(::Reduction* reduction);
+  private:
+  const ::Reduction& _internal_reduction() const;
+  ::Reduction* _internal_mutable_reduction();
+  public:
+  void unsafe_arena_set_allocated_reduction(
+      ::Reduction* reduction);
+  ::Reduction* unsafe_arena_release_reduction();
+
+  // @@protoc_insertion_point(class_scope:Builtin.GroupedMapReduce)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::Mapping* group_mapping_;
+    ::Mapping* value_mapping_;
+    ::Reduction* reduction_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Builtin_Range final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Builtin.Range) */ {
+ public:
+  inline Builtin_Range() : Builtin_Range(nullptr) {}
+  ~Builtin_Range() override;
+  explicit PROTOBUF_CONSTEXPR Builtin_Range(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Builtin_Range(const Builtin_Range& from);
+  Builtin_Range(Builtin_Range&& from) noexcept
+    : Builtin_Range() {
+    *this = ::std::move(from);
+  }
+
+  inline Builtin_Range& operator=(const Builtin_Range& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Builtin_Range& operator=(Builtin_Range&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Builtin_Range& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Builtin_Range* internal_default_instance() {
+    return reinterpret_cast<const Builtin_Range*>(
+               &_Builtin_Range_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(Builtin_Range& a, Builtin_Range& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Builtin_Range* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Builtin_Range* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Builtin_Range* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Builtin_Range>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Builtin_Range& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Builtin_Range& from) {
+    Builtin_Range::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Builtin_Range* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Builtin.Range";
+  }
+  protected:
+  explicit Builtin_Range(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAttrnameFieldNumber = 1,
+    kLowerboundFieldNumber = 2,
+    kUpperboundFieldNumber = 3,
+  };
+  // required string attrname = 1;
+  bool has_attrname() const;
+  private:
+  bool _internal_has_attrname() const;
+  public:
+  void clear_attrname();
+  const std::string& attrname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_attrname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_attrname();
+  PROTOBUF_NODISCARD std::string* release_attrname();
+  void set_allocated_attrname(std::string* attrname);
+  private:
+  const std::string& _internal_attrname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_attrname(const std::string& value);
+  std::string* _internal_mutable_attrname();
+  public:
+
+  // optional .Term lowerbound = 2;
+  bool has_lowerbound() const;
+  private:
+  bool _internal_has_lowerbound() const;
+  public:
+  void clear_lowerbound();
+  const ::Term& lowerbound() const;
+  PROTOBUF_NODISCARD ::Term* release_lowerbound();
+  ::Term* mutable_lowerbound();
+  void set_allocated_lowerbound(::Term* lowerbound);
+  private:
+  const ::Term& _internal_lowerbound() const;
+  ::Term* _internal_mutable_lowerbound();
+  public:
+  void unsafe_arena_set_allocated_lowerbound(
+      ::Term* lowerbound);
+  ::Term* unsafe_arena_release_lowerbound();
+
+  // optional .Term upperbound = 3;
+  bool has_upperbound() const;
+  private:
+  bool _internal_has_upperbound() const;
+  public:
+  void clear_upperbound();
+  const ::Term& upperbound() const;
+  PROTOBUF_NODISCARD ::Term* release_upperbound();
+  ::Term* mutable_upperbound();
+  void set_allocated_upperbound(::Term* upperbound);
+  private:
+  const ::Term& _internal_upperbound() const;
+  ::Term* _internal_mutable_upperbound();
+  public:
+  void unsafe_arena_set_allocated_upperbound(
+      ::Term* upperbound);
+  ::Term* unsafe_arena_release_upperbound();
+
+  // @@protoc_insertion_point(class_scope:Builtin.Range)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr attrname_;
+    ::Term* lowerbound_;
+    ::Term* upperbound_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Builtin final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Builtin) */ {
+ public:
+  inline Builtin() : Builtin(nullptr) {}
+  ~Builtin() override;
+  explicit PROTOBUF_CONSTEXPR Builtin(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Builtin(const Builtin& from);
+  Builtin(Builtin&& from) noexcept
+    : Builtin() {
+    *this = ::std::move(from);
+  }
+
+  inline Builtin& operator=(const Builtin& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Builtin& operator=(Builtin&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Builtin& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Builtin* internal_default_instance() {
+    return reinterpret_cast<const Builtin*>(
+               &_Builtin_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(Builtin& a, Builtin& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Builtin* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Builtin* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Builtin* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Builtin>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Builtin& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Builtin& from) {
+    Builtin::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Builtin* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Builtin";
+  }
+  protected:
+  explicit Builtin(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Builtin_Filter Filter;
+  typedef Builtin_Map Map;
+  typedef Builtin_ConcatMap ConcatMap;
+  typedef Builtin_OrderBy OrderBy;
+  typedef Builtin_GroupedMapReduce GroupedMapReduce;
+  typedef Builtin_Range Range;
+
+  typedef Builtin_BuiltinType BuiltinType;
+  static constexpr BuiltinType NOT =
+    Builtin_BuiltinType_NOT;
+  static constexpr BuiltinType GETATTR =
+    Builtin_BuiltinType_GETATTR;
+  static constexpr BuiltinType IMPLICIT_GETATTR =
+    Builtin_BuiltinType_IMPLICIT_GETATTR;
+  static constexpr BuiltinType HASATTR =
+    Builtin_BuiltinType_HASATTR;
+  static constexpr BuiltinType IMPLICIT_HASATTR =
+    Builtin_BuiltinType_IMPLICIT_HASATTR;
+  static constexpr BuiltinType PICKATTRS =
+    Builtin_BuiltinType_PICKATTRS;
+  static constexpr BuiltinType IMPLICIT_PICKATTRS =
+    Builtin_BuiltinType_IMPLICIT_PICKATTRS;
+  static constexpr BuiltinType MAPMERGE =
+    Builtin_BuiltinType_MAPMERGE;
+  static constexpr BuiltinType ARRAYAPPEND =
+    Builtin_BuiltinType_ARRAYAPPEND;
+  static constexpr BuiltinType SLICE =
+    Builtin_BuiltinType_SLICE;
+  static constexpr BuiltinType ADD =
+    Builtin_BuiltinType_ADD;
+  static constexpr BuiltinType SUBTRACT =
+    Builtin_BuiltinType_SUBTRACT;
+  static constexpr BuiltinType MULTIPLY =
+    Builtin_BuiltinType_MULTIPLY;
+  static constexpr BuiltinType DIVIDE =
+    Builtin_BuiltinType_DIVIDE;
+  static constexpr BuiltinType MODULO =
+    Builtin_BuiltinType_MODULO;
+  static constexpr BuiltinType COMPARE =
+    Builtin_BuiltinType_COMPARE;
+  static constexpr BuiltinType FILTER =
+    Builtin_BuiltinType_FILTER;
+  static constexpr BuiltinType MAP =
+    Builtin_BuiltinType_MAP;
+  static constexpr BuiltinType CONCATMAP =
+    Builtin_BuiltinType_CONCATMAP;
+  static constexpr BuiltinType ORDERBY =
+    Builtin_BuiltinType_ORDERBY;
+  static constexpr BuiltinType DISTINCT =
+    Builtin_BuiltinType_DISTINCT;
+  static constexpr BuiltinType LENGTH =
+    Builtin_BuiltinType_LENGTH;
+  static constexpr BuiltinType UNION =
+    Builtin_BuiltinType_UNION;
+  static constexpr BuiltinType NTH =
+    Builtin_BuiltinType_NTH;
+  static constexpr BuiltinType STREAMTOARRAY =
+    Builtin_BuiltinType_STREAMTOARRAY;
+  static constexpr BuiltinType ARRAYTOSTREAM =
+    Builtin_BuiltinType_ARRAYTOSTREAM;
+  static constexpr BuiltinType REDUCE =
+    Builtin_BuiltinType_REDUCE;
+  static constexpr BuiltinType GROUPEDMAPREDUCE =
+    Builtin_BuiltinType_GROUPEDMAPREDUCE;
+  static constexpr BuiltinType ANY =
+    Builtin_BuiltinType_ANY;
+  static constexpr BuiltinType ALL =
+    Builtin_BuiltinType_ALL;
+  static constexpr BuiltinType RANGE =
+    Builtin_BuiltinType_RANGE;
+  static constexpr BuiltinType IMPLICIT_WITHOUT =
+    Builtin_BuiltinType_IMPLICIT_WITHOUT;
+  static constexpr BuiltinType WITHOUT =
+    Builtin_BuiltinType_WITHOUT;
+  static inline bool BuiltinType_IsValid(int value) {
+    return Builtin_BuiltinType_IsValid(value);
+  }
+  static constexpr BuiltinType BuiltinType_MIN =
+    Builtin_BuiltinType_BuiltinType_MIN;
+  static constexpr BuiltinType BuiltinType_MAX =
+    Builtin_BuiltinType_BuiltinType_MAX;
+  static constexpr int BuiltinType_ARRAYSIZE =
+    Builtin_BuiltinType_BuiltinType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  BuiltinType_descriptor() {
+    return Builtin_BuiltinType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& BuiltinType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, BuiltinType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function BuiltinType_Name.");
+    return Builtin_BuiltinType_Name(enum_t_value);
+  }
+  static inline bool BuiltinType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      BuiltinType* value) {
+    return Builtin_BuiltinType_Parse(name, value);
+  }
+
+  typedef Builtin_Comparison Comparison;
+  static constexpr Comparison EQ =
+    Builtin_Comparison_EQ;
+  static constexpr Comparison NE =
+    Builtin_Comparison_NE;
+  static constexpr Comparison LT =
+    Builtin_Comparison_LT;
+  static constexpr Comparison LE =
+    Builtin_Comparison_LE;
+  static constexpr Comparison GT =
+    Builtin_Comparison_GT;
+  static constexpr Comparison GE =
+    Builtin_Comparison_GE;
+  static inline bool Comparison_IsValid(int value) {
+    return Builtin_Comparison_IsValid(value);
+  }
+  static constexpr Comparison Comparison_MIN =
+    Builtin_Comparison_Comparison_MIN;
+  static constexpr Comparison Comparison_MAX =
+    Builtin_Comparison_Comparison_MAX;
+  static constexpr int Comparison_ARRAYSIZE =
+    Builtin_Comparison_Comparison_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Comparison_descriptor() {
+    return Builtin_Comparison_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Comparison_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Comparison>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Comparison_Name.");
+    return Builtin_Comparison_Name(enum_t_value);
+  }
+  static inline bool Comparison_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Comparison* value) {
+    return Builtin_Comparison_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAttrsFieldNumber = 3,
+    kOrderByFieldNumber = 8,
+    kAttrFieldNumber = 2,
+    kFilterFieldNumber = 5,
+    kMapFieldNumber = 6,
+    kConcatMapFieldNumber = 7,
+    kReduceFieldNumber = 9,
+    kGroupedMapReduceFieldNumber = 10,
+    kRangeFieldNumber = 11,
+    kTypeFieldNumber = 1,
+    kComparisonFieldNumber = 4,
+  };
+  // repeated string attrs = 3;
+  int attrs_size() const;
+  private:
+  int _internal_attrs_size() const;
+  public:
+  void clear_attrs();
+  const std::string& attrs(int index) const;
+  std::string* mutable_attrs(int index);
+  void set_attrs(int index, const std::string& value);
+  void set_attrs(int index, std::string&& value);
+  void set_attrs(int index, const char* value);
+  void set_attrs(int index, const char* value, size_t size);
+  std::string* add_attrs();
+  void add_attrs(const std::string& value);
+  void add_attrs(std::string&& value);
+  void add_attrs(const char* value);
+  void add_attrs(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& attrs() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_attrs();
+  private:
+  const std::string& _internal_attrs(int index) const;
+  std::string* _internal_add_attrs();
+  public:
+
+  // repeated .Builtin.OrderBy order_by = 8;
+  int order_by_size() const;
+  private:
+  int _internal_order_by_size() const;
+  public:
+  void clear_order_by();
+  ::Builtin_OrderBy* mutable_order_by(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Builtin_OrderBy >*
+      mutable_order_by();
+  private:
+  const ::Builtin_OrderBy& _internal_order_by(int index) const;
+  ::Builtin_OrderBy* _internal_add_order_by();
+  public:
+  const ::Builtin_OrderBy& order_by(int index) const;
+  ::Builtin_OrderBy* add_order_by();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Builtin_OrderBy >&
+      order_by() const;
+
+  // optional string attr = 2;
+  bool has_attr() const;
+  private:
+  bool _internal_has_attr() const;
+  public:
+  void clear_attr();
+  const std::string& attr() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_attr(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_attr();
+  PROTOBUF_NODISCARD std::string* release_attr();
+  void set_allocated_attr(std::string* attr);
+  private:
+  const std::string& _internal_attr() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_attr(const std::string& value);
+  std::string* _internal_mutable_attr();
+  public:
+
+  // optional .Builtin.Filter filter = 5;
+  bool has_filter() const;
+  private:
+  bool _internal_has_filter() const;
+  public:
+  void clear_filter();
+  const ::Builtin_Filter& filter() const;
+  PROTOBUF_NODISCARD ::Builtin_Filter* release_filter();
+  ::Builtin_Filter* mutable_filter();
+  void set_allocated_filter(::Builtin_Filter* filter);
+  private:
+  const ::Builtin_Filter& _internal_filter() const;
+  ::Builtin_Filter* _internal_mutable_filter();
+  public:
+  void unsafe_arena_set_allocated_filter(
+      ::Builtin_Filter* filter);
+  ::Builtin_Filter* unsafe_arena_release_filter();
+
+  // optional .Builtin.Map map = 6;
+  bool has_map() const;
+  private:
+  bool _internal_has_map() const;
+  public:
+  void clear_map();
+  const ::Builtin_Map& map() const;
+  PROTOBUF_NODISCARD ::Builtin_Map* release_map();
+  ::Builtin_Map* mutable_map();
+  void set_allocated_map(::Builtin_Map* map);
+  private:
+  const ::Builtin_Map& _internal_map() const;
+  ::Builtin_Map* _internal_mutable_map();
+  public:
+  void unsafe_arena_set_allocated_map(
+      ::Builtin_Map* map);
+  ::Builtin_Map* unsafe_arena_release_map();
+
+  // optional .Builtin.ConcatMap concat_map = 7;
+  bool has_concat_map() const;
+  private:
+  bool _internal_has_concat_map() const;
+  public:
+  void clear_concat_map();
+  const ::Builtin_ConcatMap& concat_map() const;
+  PROTOBUF_NODISCARD ::Builtin_ConcatMap* release_concat_map();
+  ::Builtin_ConcatMap* mutable_concat_map();
+  void set_allocated_concat_map(::Builtin_ConcatMap* concat_map);
+  private:
+  const ::Builtin_ConcatMap& _internal_concat_map() const;
+  ::Builtin_ConcatMap* _internal_mutable_concat_map();
+  public:
+  void unsafe_arena_set_allocated_concat_map(
+      ::Builtin_ConcatMap* concat_map);
+  ::Builtin_ConcatMap* unsafe_arena_release_concat_map();
+
+  // optional .Reduction reduce = 9;
+  bool has_reduce() const;
+  private:
+  bool _internal_has_reduce() const;
+  public:
+  void clear_reduce();
+  const ::Reduction& reduce() const;
+  PROTOBUF_NODISCARD ::Reduction* release_reduce();
+  ::Reduction* mutable_reduce();
+  void set_allocated_reduce(::Reduction* reduce);
+  private:
+  const ::Reduction& _internal_reduce() const;
+  ::Reduction* _internal_mutable_reduce();
+  public:
+  void unsafe_arena_set_allocated_reduce(
+      ::Reduction* reduce);
+  ::Reduction* unsafe_arena_release_reduce();
+
+  // optional .Builtin.GroupedMapReduce grouped_map_reduce = 10;
+  bool has_grouped_map_reduce() const;
+  private:
+  bool _internal_has_grouped_map_reduce() const;
+  public:
+  void clear_grouped_map_reduce();
+  const ::Builtin_GroupedMapReduce& grouped_map_reduce() const;
+  PROTOBUF_NODISCARD ::Builtin_GroupedMapReduce* release_grouped_map_reduce();
+  ::Builtin_GroupedMapReduce* mutable_grouped_map_reduce();
+  void set_allocated_grouped_map_reduce(::Builtin_GroupedMapReduce* grouped_map_reduce);
+  private:
+  const ::Builtin_GroupedMapReduce& _internal_grouped_map_reduce() const;
+  ::Builtin_GroupedMapReduce* _internal_mutable_grouped_map_reduce();
+  public:
+  void unsafe_arena_set_allocated_grouped_map_reduce(
+      ::Builtin_GroupedMapReduce* grouped_map_reduce);
+  ::Builtin_GroupedMapReduce* unsafe_arena_release_grouped_map_reduce();
+
+  // optional .Builtin.Range range = 11;
+  bool has_range() const;
+  private:
+  bool _internal_has_range() const;
+  public:
+  void clear_range();
+  const ::Builtin_Range& range() const;
+  PROTOBUF_NODISCARD ::Builtin_Range* release_range();
+  ::Builtin_Range* mutable_range();
+  void set_allocated_range(::Builtin_Range* range);
+  private:
+  const ::Builtin_Range& _internal_range() const;
+  ::Builtin_Range* _internal_mutable_range();
+  public:
+  void unsafe_arena_set_allocated_range(
+      ::Builtin_Range* range);
+  ::Builtin_Range* unsafe_arena_release_range();
+
+  // required .Builtin.BuiltinType type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::Builtin_BuiltinType type() const;
+  void set_type(::Builtin_BuiltinType value);
+  private:
+  ::Builtin_BuiltinType _internal_type() const;
+  void _internal_set_type(::Builtin_BuiltinType value);
+  public:
+
+  // optional .Builtin.Comparison comparison = 4;
+  bool has_comparison() const;
+  private:
+  bool _internal_has_comparison() const;
+  public:
+  void clear_comparison();
+  ::Builtin_Comparison comparison() const;
+  void set_comparison(::Builtin_Comparison value);
+  private:
+  ::Builtin_Comparison _internal_comparison() const;
+  void _internal_set_comparison(::Builtin_Comparison value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Builtin)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> attrs_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Builtin_OrderBy > order_by_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr attr_;
+    ::Builtin_Filter* filter_;
+    ::Builtin_Map* map_;
+    ::Builtin_ConcatMap* concat_map_;
+    ::Reduction* reduce_;
+    ::Builtin_GroupedMapReduce* grouped_map_reduce_;
+    ::Builtin_Range* range_;
+    int type_;
+    int comparison_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Reduction final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Reduction) */ {
+ public:
+  inline Reduction() : Reduction(nullptr) {}
+  ~Reduction() override;
+  explicit PROTOBUF_CONSTEXPR Reduction(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Reduction(const Reduction& from);
+  Reduction(Reduction&& from) noexcept
+    : Reduction() {
+    *this = ::std::move(from);
+  }
+
+  inline Reduction& operator=(const Reduction& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Reduction& operator=(Reduction&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Reduction& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Reduction* internal_default_instance() {
+    return reinterpret_cast<const Reduction*>(
+               &_Reduction_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(Reduction& a, Reduction& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Reduction* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Reduction* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Reduction* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Reduction>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Reduction& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Reduction& from) {
+    Reduction::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Reduction* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Reduction";
+  }
+  protected:
+  explicit Reduction(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVar1FieldNumber = 2,
+    kVar2FieldNumber = 3,
+    kBaseFieldNumber = 1,
+    kBodyFieldNumber = 4,
+  };
+  // required string var1 = 2;
+  bool has_var1() const;
+  private:
+  bool _internal_has_var1() const;
+  public:
+  void clear_var1();
+  const std::string& var1() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_var1(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_var1();
+  PROTOBUF_NODISCARD std::string* release_var1();
+  void set_allocated_var1(std::string* var1);
+  private:
+  const std::string& _internal_var1() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_var1(const std::string& value);
+  std::string* _internal_mutable_var1();
+  public:
+
+  // required string var2 = 3;
+  bool has_var2() const;
+  private:
+  bool _internal_has_var2() const;
+  public:
+  void clear_var2();
+  const std::string& var2() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_var2(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_var2();
+  PROTOBUF_NODISCARD std::string* release_var2();
+  void set_allocated_var2(std::string* var2);
+  private:
+  const std::string& _internal_var2() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_var2(const std::string& value);
+  std::string* _internal_mutable_var2();
+  public:
+
+  // required .Term base = 1;
+  bool has_base() const;
+  private:
+  bool _internal_has_base() const;
+  public:
+  void clear_base();
+  const ::Term& base() const;
+  PROTOBUF_NODISCARD ::Term* release_base();
+  ::Term* mutable_base();
+  void set_allocated_base(::Term* base);
+  private:
+  const ::Term& _internal_base() const;
+  ::Term* _internal_mutable_base();
+  public:
+  void unsafe_arena_set_allocated_base(
+      ::Term* base);
+  ::Term* unsafe_arena_release_base();
+
+  // required .Term body = 4;
+  bool has_body() const;
+  private:
+  bool _internal_has_body() const;
+  public:
+  void clear_body();
+  const ::Term& body() const;
+  PROTOBUF_NODISCARD ::Term* release_body();
+  ::Term* mutable_body();
+  void set_allocated_body(::Term* body);
+  private:
+  const ::Term& _internal_body() const;
+  ::Term* _internal_mutable_body();
+  public:
+  void unsafe_arena_set_allocated_body(
+      ::Term* body);
+  ::Term* unsafe_arena_release_body();
+
+  // @@protoc_insertion_point(class_scope:Reduction)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr var1_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr var2_;
+    ::Term* base_;
+    ::Term* body_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Mapping final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Mapping) */ {
+ public:
+  inline Mapping() : Mapping(nullptr) {}
+  ~Mapping() override;
+  explicit PROTOBUF_CONSTEXPR Mapping(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Mapping(const Mapping& from);
+  Mapping(Mapping&& from) noexcept
+    : Mapping() {
+    *this = ::std::move(from);
+  }
+
+  inline Mapping& operator=(const Mapping& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Mapping& operator=(Mapping&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Mapping& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Mapping* internal_default_instance() {
+    return reinterpret_cast<const Mapping*>(
+               &_Mapping_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(Mapping& a, Mapping& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Mapping* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Mapping* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Mapping* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Mapping>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Mapping& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Mapping& from) {
+    Mapping::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Mapping* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Mapping";
+  }
+  protected:
+  explicit Mapping(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kArgFieldNumber = 1,
+    kBodyFieldNumber = 2,
+  };
+  // required string arg = 1;
+  bool has_arg() const;
+  private:
+  bool _internal_has_arg() const;
+  public:
+  void clear_arg();
+  const std::string& arg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_arg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_arg();
+  PROTOBUF_NODISCARD std::string* release_arg();
+  void set_allocated_arg(std::string* arg);
+  private:
+  const std::string& _internal_arg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_arg(const std::string& value);
+  std::string* _internal_mutable_arg();
+  public:
+
+  // required .Term body = 2;
+  bool has_body() const;
+  private:
+  bool _internal_has_body() const;
+  public:
+  void clear_body();
+  const ::Term& body() const;
+  PROTOBUF_NODISCARD ::Term* release_body();
+  ::Term* mutable_body();
+  void set_allocated_body(::Term* body);
+  private:
+  const ::Term& _internal_body() const;
+  ::Term* _internal_mutable_body();
+  public:
+  void unsafe_arena_set_allocated_body(
+      ::Term* body);
+  ::Term* unsafe_arena_release_body();
+
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline bool HasExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Mapping, _proto_TypeTraits, _field_type, _is_packed>& id) const {
+
+    return _impl_._extensions_.Has(id.number());
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void ClearExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Mapping, _proto_TypeTraits, _field_type, _is_packed>& id) {
+    _impl_._extensions_.ClearExtension(id.number());
+
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline int ExtensionSize(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Mapping, _proto_TypeTraits, _field_type, _is_packed>& id) const {
+
+    return _impl_._extensions_.ExtensionSize(id.number());
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Mapping, _proto_TypeTraits, _field_type, _is_packed>& id) const {
+
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_,
+                                  id.default_value());
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType MutableExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Mapping, _proto_TypeTraits, _field_type, _is_packed>& id) {
+
+    return _proto_TypeTraits::Mutable(id.number(), _field_type,
+                                      &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Mapping, _proto_TypeTraits, _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), _field_type, value, &_impl_._extensions_);
+
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetAllocatedExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Mapping, _proto_TypeTraits, _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::SetAllocated(id.number(), _field_type, value,
+                                    &_impl_._extensions_);
+
+  }
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void UnsafeArenaSetAllocatedExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Mapping, _proto_TypeTraits, _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::UnsafeArenaSetAllocated(id.number(), _field_type,
+                                               value, &_impl_._extensions_);
+
+  }
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  PROTOBUF_NODISCARD inline
+      typename _proto_TypeTraits::Singular::MutableType
+      ReleaseExtension(
+          const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+              Mapping, _proto_TypeTraits, _field_type, _is_packed>& id) {
+
+    return _proto_TypeTraits::Release(id.number(), _field_type,
+                                      &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType
+  UnsafeArenaReleaseExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Mapping, _proto_TypeTraits, _field_type, _is_packed>& id) {
+
+    return _proto_TypeTraits::UnsafeArenaRelease(id.number(), _field_type,
+                                                 &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Mapping, _proto_TypeTraits, _field_type, _is_packed>& id,
+      int index) const {
+
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType MutableExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Mapping, _proto_TypeTraits, _field_type, _is_packed>& id,
+      int index) {
+
+    return _proto_TypeTraits::Mutable(id.number(), index, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Mapping, _proto_TypeTraits, _field_type, _is_packed>& id,
+      int index, typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), index, value, &_impl_._extensions_);
+
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType AddExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Mapping, _proto_TypeTraits, _field_type, _is_packed>& id) {
+    typename _proto_TypeTraits::Repeated::MutableType to_add =
+        _proto_TypeTraits::Add(id.number(), _field_type, &_impl_._extensions_);
+
+    return to_add;
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void AddExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Mapping, _proto_TypeTraits, _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Add(id.number(), _field_type, _is_packed, value,
+                           &_impl_._extensions_);
+
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline const typename _proto_TypeTraits::Repeated::RepeatedFieldType&
+  GetRepeatedExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Mapping, _proto_TypeTraits, _field_type, _is_packed>& id) const {
+
+    return _proto_TypeTraits::GetRepeated(id.number(), _impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::RepeatedFieldType*
+  MutableRepeatedExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Mapping, _proto_TypeTraits, _field_type, _is_packed>& id) {
+
+    return _proto_TypeTraits::MutableRepeated(id.number(), _field_type,
+                                              _is_packed, &_impl_._extensions_);
+  }
+
+  // @@protoc_insertion_point(class_scope:Mapping)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ExtensionSet _extensions_;
+
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr arg_;
+    ::Term* body_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Predicate final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Predicate) */ {
+ public:
+  inline Predicate() : Predicate(nullptr) {}
+  ~Predicate() override;
+  explicit PROTOBUF_CONSTEXPR Predicate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Predicate(const Predicate& from);
+  Predicate(Predicate&& from) noexcept
+    : Predicate() {
+    *this = ::std::move(from);
+  }
+
+  inline Predicate& operator=(const Predicate& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Predicate& operator=(Predicate&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Predicate& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Predicate* internal_default_instance() {
+    return reinterpret_cast<const Predicate*>(
+               &_Predicate_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(Predicate& a, Predicate& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Predicate* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Predicate* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Predicate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Predicate>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Predicate& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Predicate& from) {
+    Predicate::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Predicate* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Predicate";
+  }
+  protected:
+  explicit Predicate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kArgFieldNumber = 1,
+    kBodyFieldNumber = 2,
+  };
+  // required string arg = 1;
+  bool has_arg() const;
+  private:
+  bool _internal_has_arg() const;
+  public:
+  void clear_arg();
+  const std::string& arg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_arg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_arg();
+  PROTOBUF_NODISCARD std::string* release_arg();
+  void set_allocated_arg(std::string* arg);
+  private:
+  const std::string& _internal_arg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_arg(const std::string& value);
+  std::string* _internal_mutable_arg();
+  public:
+
+  // required .Term body = 2;
+  bool has_body() const;
+  private:
+  bool _internal_has_body() const;
+  public:
+  void clear_body();
+  const ::Term& body() const;
+  PROTOBUF_NODISCARD ::Term* release_body();
+  ::Term* mutable_body();
+  void set_allocated_body(::Term* body);
+  private:
+  const ::Term& _internal_body() const;
+  ::Term* _internal_mutable_body();
+  public:
+  void unsafe_arena_set_allocated_body(
+      ::Term* body);
+  ::Term* unsafe_arena_release_body();
+
+  // @@protoc_insertion_point(class_scope:Predicate)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr arg_;
+    ::Term* body_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReadQuery final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ReadQuery) */ {
+ public:
+  inline ReadQuery() : ReadQuery(nullptr) {}
+  ~ReadQuery() override;
+  explicit PROTOBUF_CONSTEXPR ReadQuery(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReadQuery(const ReadQuery& from);
+  ReadQuery(ReadQuery&& from) noexcept
+    : ReadQuery() {
+    *this = ::std::move(from);
+  }
+
+  inline ReadQuery& operator=(const ReadQuery& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadQuery& operator=(ReadQuery&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadQuery& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadQuery* internal_default_instance() {
+    return reinterpret_cast<const ReadQuery*>(
+               &_ReadQuery_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(ReadQuery& a, ReadQuery& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadQuery* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadQuery* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReadQuery* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadQuery>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadQuery& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadQuery& from) {
+    ReadQuery::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadQuery* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ReadQuery";
+  }
+  protected:
+  explicit ReadQuery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTermFieldNumber = 1,
+    kMaxChunkSizeFieldNumber = 2,
+    kMaxAgeFieldNumber = 3,
+  };
+  // required .Term term = 1;
+  bool has_term() const;
+  private:
+  bool _internal_has_term() const;
+  public:
+  void clear_term();
+  const ::Term& term() const;
+  PROTOBUF_NODISCARD ::Term* release_term();
+  ::Term* mutable_term();
+  void set_allocated_term(::Term* term);
+  private:
+  const ::Term& _internal_term() const;
+  ::Term* _internal_mutable_term();
+  public:
+  void unsafe_arena_set_allocated_term(
+      ::Term* term);
+  ::Term* unsafe_arena_release_term();
+
+  // optional int64 max_chunk_size = 2;
+  bool has_max_chunk_size() const;
+  private:
+  bool _internal_has_max_chunk_size() const;
+  public:
+  void clear_max_chunk_size();
+  int64_t max_chunk_size() const;
+  void set_max_chunk_size(int64_t value);
+  private:
+  int64_t _internal_max_chunk_size() const;
+  void _internal_set_max_chunk_size(int64_t value);
+  public:
+
+  // optional int64 max_age = 3;
+  bool has_max_age() const;
+  private:
+  bool _internal_has_max_age() const;
+  public:
+  void clear_max_age();
+  int64_t max_age() const;
+  void set_max_age(int64_t value);
+  private:
+  int64_t _internal_max_age() const;
+  void _internal_set_max_age(int64_t value);
+  public:
+
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline bool HasExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          ReadQuery, _proto_TypeTraits, _field_type, _is_packed>& id) const {
+
+    return _impl_._extensions_.Has(id.number());
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void ClearExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          ReadQuery, _proto_TypeTraits, _field_type, _is_packed>& id) {
+    _impl_._extensions_.ClearExtension(id.number());
+
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline int ExtensionSize(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          ReadQuery, _proto_TypeTraits, _field_type, _is_packed>& id) const {
+
+    return _impl_._extensions_.ExtensionSize(id.number());
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          ReadQuery, _proto_TypeTraits, _field_type, _is_packed>& id) const {
+
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_,
+                                  id.default_value());
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType MutableExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          ReadQuery, _proto_TypeTraits, _field_type, _is_packed>& id) {
+
+    return _proto_TypeTraits::Mutable(id.number(), _field_type,
+                                      &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          ReadQuery, _proto_TypeTraits, _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), _field_type, value, &_impl_._extensions_);
+
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetAllocatedExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          ReadQuery, _proto_TypeTraits, _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::SetAllocated(id.number(), _field_type, value,
+                                    &_impl_._extensions_);
+
+  }
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void UnsafeArenaSetAllocatedExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          ReadQuery, _proto_TypeTraits, _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::UnsafeArenaSetAllocated(id.number(), _field_type,
+                                               value, &_impl_._extensions_);
+
+  }
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  PROTOBUF_NODISCARD inline
+      typename _proto_TypeTraits::Singular::MutableType
+      ReleaseExtension(
+          const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+              ReadQuery, _proto_TypeTraits, _field_type, _is_packed>& id) {
+
+    return _proto_TypeTraits::Release(id.number(), _field_type,
+                                      &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType
+  UnsafeArenaReleaseExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          ReadQuery, _proto_TypeTraits, _field_type, _is_packed>& id) {
+
+    return _proto_TypeTraits::UnsafeArenaRelease(id.number(), _field_type,
+                                                 &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          ReadQuery, _proto_TypeTraits, _field_type, _is_packed>& id,
+      int index) const {
+
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType MutableExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          ReadQuery, _proto_TypeTraits, _field_type, _is_packed>& id,
+      int index) {
+
+    return _proto_TypeTraits::Mutable(id.number(), index, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          ReadQuery, _proto_TypeTraits, _field_type, _is_packed>& id,
+      int index, typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), index, value, &_impl_._extensions_);
+
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType AddExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          ReadQuery, _proto_TypeTraits, _field_type, _is_packed>& id) {
+    typename _proto_TypeTraits::Repeated::MutableType to_add =
+        _proto_TypeTraits::Add(id.number(), _field_type, &_impl_._extensions_);
+
+    return to_add;
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void AddExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          ReadQuery, _proto_TypeTraits, _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Add(id.number(), _field_type, _is_packed, value,
+                           &_impl_._extensions_);
+
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline const typename _proto_TypeTraits::Repeated::RepeatedFieldType&
+  GetRepeatedExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          ReadQuery, _proto_TypeTraits, _field_type, _is_packed>& id) const {
+
+    return _proto_TypeTraits::GetRepeated(id.number(), _impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::RepeatedFieldType*
+  MutableRepeatedExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          ReadQuery, _proto_TypeTraits, _field_type, _is_packed>& id) {
+
+    return _proto_TypeTraits::MutableRepeated(id.number(), _field_type,
+                                              _is_packed, &_impl_._extensions_);
+  }
+
+  // @@protoc_insertion_point(class_scope:ReadQuery)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ExtensionSet _extensions_;
+
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::Term* term_;
+    int64_t max_chunk_size_;
+    int64_t max_age_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WriteQuery_Update final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:WriteQuery.Update) */ {
+ public:
+  inline WriteQuery_Update() : WriteQuery_Update(nullptr) {}
+  ~WriteQuery_Update() override;
+  explicit PROTOBUF_CONSTEXPR WriteQuery_Update(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteQuery_Update(const WriteQuery_Update& from);
+  WriteQuery_Update(WriteQuery_Update&& from) noexcept
+    : WriteQuery_Update() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteQuery_Update& operator=(const WriteQuery_Update& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteQuery_Update& operator=(WriteQuery_Update&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteQuery_Update& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteQuery_Update* internal_default_instance() {
+    return reinterpret_cast<const WriteQuery_Update*>(
+               &_WriteQuery_Update_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(WriteQuery_Update& a, WriteQuery_Update& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteQuery_Update* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteQuery_Update* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteQuery_Update* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteQuery_Update>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteQuery_Update& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteQuery_Update& from) {
+    WriteQuery_Update::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteQuery_Update* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "WriteQuery.Update";
+  }
+  protected:
+  explicit WriteQuery_Update(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+    kMappingFieldNumber = 2,
+  };
+  // required .Term view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  const ::Term& view() const;
+  PROTOBUF_NODISCARD ::Term* release_view();
+  ::Term* mutable_view();
+  void set_allocated_view(::Term* view);
+  private:
+  const ::Term& _internal_view() const;
+  ::Term* _internal_mutable_view();
+  public:
+  void unsafe_arena_set_allocated_view(
+      ::Term* view);
+  ::Term* unsafe_arena_release_view();
+
+  // required .Mapping mapping = 2;
+  bool has_mapping() const;
+  private:
+  bool _internal_has_mapping() const;
+  public:
+  void clear_mapping();
+  const ::Mapping& mapping() const;
+  PROTOBUF_NODISCARD ::Mapping* release_mapping();
+  ::Mapping* mutable_mapping();
+  void set_allocated_mapping(::Mapping* mapping);
+  private:
+  const ::Mapping& _internal_mapping() const;
+  ::Mapping* _internal_mutable_mapping();
+  public:
+  void unsafe_arena_set_allocated_mapping(
+      ::Mapping* mapping);
+  ::Mapping* unsafe_arena_release_mapping();
+
+  // @@protoc_insertion_point(class_scope:WriteQuery.Update)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::Term* view_;
+    ::Mapping* mapping_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WriteQuery_Delete final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:WriteQuery.Delete) */ {
+ public:
+  inline WriteQuery_Delete() : WriteQuery_Delete(nullptr) {}
+  ~WriteQuery_Delete() override;
+  explicit PROTOBUF_CONSTEXPR WriteQuery_Delete(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteQuery_Delete(const WriteQuery_Delete& from);
+  WriteQuery_Delete(WriteQuery_Delete&& from) noexcept
+    : WriteQuery_Delete() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteQuery_Delete& operator=(const WriteQuery_Delete& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteQuery_Delete& operator=(WriteQuery_Delete&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteQuery_Delete& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteQuery_Delete* internal_default_instance() {
+    return reinterpret_cast<const WriteQuery_Delete*>(
+               &_WriteQuery_Delete_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(WriteQuery_Delete& a, WriteQuery_Delete& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteQuery_Delete* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteQuery_Delete* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteQuery_Delete* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteQuery_Delete>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteQuery_Delete& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteQuery_Delete& from) {
+    WriteQuery_Delete::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteQuery_Delete* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "WriteQuery.Delete";
+  }
+  protected:
+  explicit WriteQuery_Delete(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+  };
+  // required .Term view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  const ::Term& view() const;
+  PROTOBUF_NODISCARD ::Term* release_view();
+  ::Term* mutable_view();
+  void set_allocated_view(::Term* view);
+  private:
+  const ::Term& _internal_view() const;
+  ::Term* _internal_mutable_view();
+  public:
+  void unsafe_arena_set_allocated_view(
+      ::Term* view);
+  ::Term* unsafe_arena_release_view();
+
+  // @@protoc_insertion_point(class_scope:WriteQuery.Delete)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::Term* view_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WriteQuery_Mutate final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:WriteQuery.Mutate) */ {
+ public:
+  inline WriteQuery_Mutate() : WriteQuery_Mutate(nullptr) {}
+  ~WriteQuery_Mutate() override;
+  explicit PROTOBUF_CONSTEXPR WriteQuery_Mutate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteQuery_Mutate(const WriteQuery_Mutate& from);
+  WriteQuery_Mutate(WriteQuery_Mutate&& from) noexcept
+    : WriteQuery_Mutate() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteQuery_Mutate& operator=(const WriteQuery_Mutate& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteQuery_Mutate& operator=(WriteQuery_Mutate&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteQuery_Mutate& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteQuery_Mutate* internal_default_instance() {
+    return reinterpret_cast<const WriteQuery_Mutate*>(
+               &_WriteQuery_Mutate_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(WriteQuery_Mutate& a, WriteQuery_Mutate& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteQuery_Mutate* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteQuery_Mutate* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteQuery_Mutate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteQuery_Mutate>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteQuery_Mutate& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteQuery_Mutate& from) {
+    WriteQuery_Mutate::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteQuery_Mutate* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "WriteQuery.Mutate";
+  }
+  protected:
+  explicit WriteQuery_Mutate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kViewFieldNumber = 1,
+    kMappingFieldNumber = 2,
+  };
+  // required .Term view = 1;
+  bool has_view() const;
+  private:
+  bool _internal_has_view() const;
+  public:
+  void clear_view();
+  const ::Term& view() const;
+  PROTOBUF_NODISCARD ::Term* release_view();
+  ::Term* mutable_view();
+  void set_allocated_view(::Term* view);
+  private:
+  const ::Term& _internal_view() const;
+  ::Term* _internal_mutable_view();
+  public:
+  void unsafe_arena_set_allocated_view(
+      ::Term* view);
+  ::Term* unsafe_arena_release_view();
+
+  // required .Mapping mapping = 2;
+  bool has_mapping() const;
+  private:
+  bool _internal_has_mapping() const;
+  public:
+  void clear_mapping();
+  const ::Mapping& mapping() const;
+  PROTOBUF_NODISCARD ::Mapping* release_mapping();
+  ::Mapping* mutable_mapping();
+  void set_allocated_mapping(::Mapping* mapping);
+  private:
+  const ::Mapping& _internal_mapping() const;
+  ::Mapping* _internal_mutable_mapping();
+  public:
+  void unsafe_arena_set_allocated_mapping(
+      ::Mapping* mapping);
+  ::Mapping* unsafe_arena_release_mapping();
+
+  // @@protoc_insertion_point(class_scope:WriteQuery.Mutate)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::Term* view_;
+    ::Mapping* mapping_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WriteQuery_Insert final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:WriteQuery.Insert) */ {
+ public:
+  inline WriteQuery_Insert() : WriteQuery_Insert(nullptr) {}
+  ~WriteQuery_Insert() override;
+  explicit PROTOBUF_CONSTEXPR WriteQuery_Insert(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteQuery_Insert(const WriteQuery_Insert& from);
+  WriteQuery_Insert(WriteQuery_Insert&& from) noexcept
+    : WriteQuery_Insert() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteQuery_Insert& operator=(const WriteQuery_Insert& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteQuery_Insert& operator=(WriteQuery_Insert&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteQuery_Insert& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteQuery_Insert* internal_default_instance() {
+    return reinterpret_cast<const WriteQuery_Insert*>(
+               &_WriteQuery_Insert_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(WriteQuery_Insert& a, WriteQuery_Insert& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteQuery_Insert* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteQuery_Insert* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteQuery_Insert* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteQuery_Insert>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteQuery_Insert& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteQuery_Insert& from) {
+    WriteQuery_Insert::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteQuery_Insert* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "WriteQuery.Insert";
+  }
+  protected:
+  explicit WriteQuery_Insert(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTermsFieldNumber = 2,
+    kTableRefFieldNumber = 1,
+    kOverwriteFieldNumber = 3,
+  };
+  // repeated .Term terms = 2;
+  int terms_size() const;
+  private:
+  int _internal_terms_size() const;
+  public:
+  void clear_terms();
+  ::Term* mutable_terms(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Term >*
+      mutable_terms();
+  private:
+  const ::Term& _internal_terms(int index) const;
+  ::Term* _internal_add_terms();
+  public:
+  const ::Term& terms(int index) const;
+  ::Term* add_terms();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Term >&
+      terms() const;
+
+  // required .TableRef table_ref = 1;
+  bool has_table_ref() const;
+  private:
+  bool _internal_has_table_ref() const;
+  public:
+  void clear_table_ref();
+  const ::TableRef& table_ref() const;
+  PROTOBUF_NODISCARD ::TableRef* release_table_ref();
+  ::TableRef* mutable_table_ref();
+  void set_allocated_table_ref(::TableRef* table_ref);
+  private:
+  const ::TableRef& _internal_table_ref() const;
+  ::TableRef* _internal_mutable_table_ref();
+  public:
+  void unsafe_arena_set_allocated_table_ref(
+      ::TableRef* table_ref);
+  ::TableRef* unsafe_arena_release_table_ref();
+
+  // optional bool overwrite = 3 [default = false];
+  bool has_overwrite() const;
+  private:
+  bool _internal_has_overwrite() const;
+  public:
+  void clear_overwrite();
+  bool overwrite() const;
+  void set_overwrite(bool value);
+  private:
+  bool _internal_overwrite() const;
+  void _internal_set_overwrite(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:WriteQuery.Insert)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Term > terms_;
+    ::TableRef* table_ref_;
+    bool overwrite_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WriteQuery_ForEach final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:WriteQuery.ForEach) */ {
+ public:
+  inline WriteQuery_ForEach() : WriteQuery_ForEach(nullptr) {}
+  ~WriteQuery_ForEach() override;
+  explicit PROTOBUF_CONSTEXPR WriteQuery_ForEach(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteQuery_ForEach(const WriteQuery_ForEach& from);
+  WriteQuery_ForEach(WriteQuery_ForEach&& from) noexcept
+    : WriteQuery_ForEach() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteQuery_ForEach& operator=(const WriteQuery_ForEach& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteQuery_ForEach& operator=(WriteQuery_ForEach&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteQuery_ForEach& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteQuery_ForEach* internal_default_instance() {
+    return reinterpret_cast<const WriteQuery_ForEach*>(
+               &_WriteQuery_ForEach_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(WriteQuery_ForEach& a, WriteQuery_ForEach& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteQuery_ForEach* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteQuery_ForEach* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteQuery_ForEach* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteQuery_ForEach>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteQuery_ForEach& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteQuery_ForEach& from) {
+    WriteQuery_ForEach::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteQuery_ForEach* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "WriteQuery.ForEach";
+  }
+  protected:
+  explicit WriteQuery_ForEach(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kQueriesFieldNumber = 3,
+    kVarFieldNumber = 2,
+    kStreamFieldNumber = 1,
+  };
+  // repeated .WriteQuery queries = 3;
+  int queries_size() const;
+  private:
+  int _internal_queries_size() const;
+  public:
+  void clear_queries();
+  ::WriteQuery* mutable_queries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::WriteQuery >*
+      mutable_queries();
+  private:
+  const ::WriteQuery& _internal_queries(int index) const;
+  ::WriteQuery* _internal_add_queries();
+  public:
+  const ::WriteQuery& queries(int index) const;
+  ::WriteQuery* add_queries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::WriteQuery >&
+      queries() const;
+
+  // required string var = 2;
+  bool has_var() const;
+  private:
+  bool _internal_has_var() const;
+  public:
+  void clear_var();
+  const std::string& var() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_var(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_var();
+  PROTOBUF_NODISCARD std::string* release_var();
+  void set_allocated_var(std::string* var);
+  private:
+  const std::string& _internal_var() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_var(const std::string& value);
+  std::string* _internal_mutable_var();
+  public:
+
+  // required .Term stream = 1;
+  bool has_stream() const;
+  private:
+  bool _internal_has_stream() const;
+  public:
+  void clear_stream();
+  const ::Term& stream() const;
+  PROTOBUF_NODISCARD ::Term* release_stream();
+  ::Term* mutable_stream();
+  void set_allocated_stream(::Term* stream);
+  private:
+  const ::Term& _internal_stream() const;
+  ::Term* _internal_mutable_stream();
+  public:
+  void unsafe_arena_set_allocated_stream(
+      ::Term* stream);
+  ::Term* unsafe_arena_release_stream();
+
+  // @@protoc_insertion_point(class_scope:WriteQuery.ForEach)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::WriteQuery > queries_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr var_;
+    ::Term* stream_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WriteQuery_PointUpdate final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:WriteQuery.PointUpdate) */ {
+ public:
+  inline WriteQuery_PointUpdate() : WriteQuery_PointUpdate(nullptr) {}
+  ~WriteQuery_PointUpdate() override;
+  explicit PROTOBUF_CONSTEXPR WriteQuery_PointUpdate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteQuery_PointUpdate(const WriteQuery_PointUpdate& from);
+  WriteQuery_PointUpdate(WriteQuery_PointUpdate&& from) noexcept
+    : WriteQuery_PointUpdate() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteQuery_PointUpdate& operator=(const WriteQuery_PointUpdate& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteQuery_PointUpdate& operator=(WriteQuery_PointUpdate&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteQuery_PointUpdate& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteQuery_PointUpdate* internal_default_instance() {
+    return reinterpret_cast<const WriteQuery_PointUpdate*>(
+               &_WriteQuery_PointUpdate_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(WriteQuery_PointUpdate& a, WriteQuery_PointUpdate& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteQuery_PointUpdate* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteQuery_PointUpdate* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteQuery_PointUpdate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteQuery_PointUpdate>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteQuery_PointUpdate& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteQuery_PointUpdate& from) {
+    WriteQuery_PointUpdate::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteQuery_PointUpdate* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "WriteQuery.PointUpdate";
+  }
+  protected:
+  explicit WriteQuery_PointUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAttrnameFieldNumber = 2,
+    kTableRefFieldNumber = 1,
+    kKeyFieldNumber = 3,
+    kMappingFieldNumber = 4,
+  };
+  // required string attrname = 2;
+  bool has_attrname() const;
+  private:
+  bool _internal_has_attrname() const;
+  public:
+  void clear_attrname();
+  const std::string& attrname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_attrname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_attrname();
+  PROTOBUF_NODISCARD std::string* release_attrname();
+  void set_allocated_attrname(std::string* attrname);
+  private:
+  const std::string& _internal_attrname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_attrname(const std::string& value);
+  std::string* _internal_mutable_attrname();
+  public:
+
+  // required .TableRef table_ref = 1;
+  bool has_table_ref() const;
+  private:
+  bool _internal_has_table_ref() const;
+  public:
+  void clear_table_ref();
+  const ::TableRef& table_ref() const;
+  PROTOBUF_NODISCARD ::TableRef* release_table_ref();
+  ::TableRef* mutable_table_ref();
+  void set_allocated_table_ref(::TableRef* table_ref);
+  private:
+  const ::TableRef& _internal_table_ref() const;
+  ::TableRef* _internal_mutable_table_ref();
+  public:
+  void unsafe_arena_set_allocated_table_ref(
+      ::TableRef* table_ref);
+  ::TableRef* unsafe_arena_release_table_ref();
+
+  // required .Term key = 3;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const ::Term& key() const;
+  PROTOBUF_NODISCARD ::Term* release_key();
+  ::Term* mutable_key();
+  void set_allocated_key(::Term* key);
+  private:
+  const ::Term& _internal_key() const;
+  ::Term* _internal_mutable_key();
+  public:
+  void unsafe_arena_set_allocated_key(
+      ::Term* key);
+  ::Term* unsafe_arena_release_key();
+
+  // required .Mapping mapping = 4;
+  bool has_mapping() const;
+  private:
+  bool _internal_has_mapping() const;
+  public:
+  void clear_mapping();
+  const ::Mapping& mapping() const;
+  PROTOBUF_NODISCARD ::Mapping* release_mapping();
+  ::Mapping* mutable_mapping();
+  void set_allocated_mapping(::Mapping* mapping);
+  private:
+  const ::Mapping& _internal_mapping() const;
+  ::Mapping* _internal_mutable_mapping();
+  public:
+  void unsafe_arena_set_allocated_mapping(
+      ::Mapping* mapping);
+  ::Mapping* unsafe_arena_release_mapping();
+
+  // @@protoc_insertion_point(class_scope:WriteQuery.PointUpdate)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr attrname_;
+    ::TableRef* table_ref_;
+    ::Term* key_;
+    ::Mapping* mapping_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WriteQuery_PointDelete final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:WriteQuery.PointDelete) */ {
+ public:
+  inline WriteQuery_PointDelete() : WriteQuery_PointDelete(nullptr) {}
+  ~WriteQuery_PointDelete() override;
+  explicit PROTOBUF_CONSTEXPR WriteQuery_PointDelete(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteQuery_PointDelete(const WriteQuery_PointDelete& from);
+  WriteQuery_PointDelete(WriteQuery_PointDelete&& from) noexcept
+    : WriteQuery_PointDelete() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteQuery_PointDelete& operator=(const WriteQuery_PointDelete& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteQuery_PointDelete& operator=(WriteQuery_PointDelete&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteQuery_PointDelete& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteQuery_PointDelete* internal_default_instance() {
+    return reinterpret_cast<const WriteQuery_PointDelete*>(
+               &_WriteQuery_PointDelete_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(WriteQuery_PointDelete& a, WriteQuery_PointDelete& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteQuery_PointDelete* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteQuery_PointDelete* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteQuery_PointDelete* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteQuery_PointDelete>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteQuery_PointDelete& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteQuery_PointDelete& from) {
+    WriteQuery_PointDelete::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteQuery_PointDelete* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "WriteQuery.PointDelete";
+  }
+  protected:
+  explicit WriteQuery_PointDelete(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAttrnameFieldNumber = 2,
+    kTableRefFieldNumber = 1,
+    kKeyFieldNumber = 3,
+  };
+  // required string attrname = 2;
+  bool has_attrname() const;
+  private:
+  bool _internal_has_attrname() const;
+  public:
+  void clear_attrname();
+  const std::string& attrname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_attrname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_attrname();
+  PROTOBUF_NODISCARD std::string* release_attrname();
+  void set_allocated_attrname(std::string* attrname);
+  private:
+  const std::string& _internal_attrname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_attrname(const std::string& value);
+  std::string* _internal_mutable_attrname();
+  public:
+
+  // required .TableRef table_ref = 1;
+  bool has_table_ref() const;
+  private:
+  bool _internal_has_table_ref() const;
+  public:
+  void clear_table_ref();
+  const ::TableRef& table_ref() const;
+  PROTOBUF_NODISCARD ::TableRef* release_table_ref();
+  ::TableRef* mutable_table_ref();
+  void set_allocated_table_ref(::TableRef* table_ref);
+  private:
+  const ::TableRef& _internal_table_ref() const;
+  ::TableRef* _internal_mutable_table_ref();
+  public:
+  void unsafe_arena_set_allocated_table_ref(
+      ::TableRef* table_ref);
+  ::TableRef* unsafe_arena_release_table_ref();
+
+  // required .Term key = 3;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const ::Term& key() const;
+  PROTOBUF_NODISCARD ::Term* release_key();
+  ::Term* mutable_key();
+  void set_allocated_key(::Term* key);
+  private:
+  const ::Term& _internal_key() const;
+  ::Term* _internal_mutable_key();
+  public:
+  void unsafe_arena_set_allocated_key(
+      ::Term* key);
+  ::Term* unsafe_arena_release_key();
+
+  // @@protoc_insertion_point(class_scope:WriteQuery.PointDelete)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr attrname_;
+    ::TableRef* table_ref_;
+    ::Term* key_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WriteQuery_PointMutate final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:WriteQuery.PointMutate) */ {
+ public:
+  inline WriteQuery_PointMutate() : WriteQuery_PointMutate(nullptr) {}
+  ~WriteQuery_PointMutate() override;
+  explicit PROTOBUF_CONSTEXPR WriteQuery_PointMutate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteQuery_PointMutate(const WriteQuery_PointMutate& from);
+  WriteQuery_PointMutate(WriteQuery_PointMutate&& from) noexcept
+    : WriteQuery_PointMutate() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteQuery_PointMutate& operator=(const WriteQuery_PointMutate& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteQuery_PointMutate& operator=(WriteQuery_PointMutate&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteQuery_PointMutate& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteQuery_PointMutate* internal_default_instance() {
+    return reinterpret_cast<const WriteQuery_PointMutate*>(
+               &_WriteQuery_PointMutate_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(WriteQuery_PointMutate& a, WriteQuery_PointMutate& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteQuery_PointMutate* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteQuery_PointMutate* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteQuery_PointMutate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteQuery_PointMutate>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteQuery_PointMutate& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteQuery_PointMutate& from) {
+    WriteQuery_PointMutate::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteQuery_PointMutate* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "WriteQuery.PointMutate";
+  }
+  protected:
+  explicit WriteQuery_PointMutate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAttrnameFieldNumber = 2,
+    kTableRefFieldNumber = 1,
+    kKeyFieldNumber = 3,
+    kMappingFieldNumber = 4,
+  };
+  // required string attrname = 2;
+  bool has_attrname() const;
+  private:
+  bool _internal_has_attrname() const;
+  public:
+  void clear_attrname();
+  const std::string& attrname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_attrname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_attrname();
+  PROTOBUF_NODISCARD std::string* release_attrname();
+  void set_allocated_attrname(std::string* attrname);
+  private:
+  const std::string& _internal_attrname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_attrname(const std::string& value);
+  std::string* _internal_mutable_attrname();
+  public:
+
+  // required .TableRef table_ref = 1;
+  bool has_table_ref() const;
+  private:
+  bool _internal_has_table_ref() const;
+  public:
+  void clear_table_ref();
+  const ::TableRef& table_ref() const;
+  PROTOBUF_NODISCARD ::TableRef* release_table_ref();
+  ::TableRef* mutable_table_ref();
+  void set_allocated_table_ref(::TableRef* table_ref);
+  private:
+  const ::TableRef& _internal_table_ref() const;
+  ::TableRef* _internal_mutable_table_ref();
+  public:
+  void unsafe_arena_set_allocated_table_ref(
+      ::TableRef* table_ref);
+  ::TableRef* unsafe_arena_release_table_ref();
+
+  // required .Term key = 3;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const ::Term& key() const;
+  PROTOBUF_NODISCARD ::Term* release_key();
+  ::Term* mutable_key();
+  void set_allocated_key(::Term* key);
+  private:
+  const ::Term& _internal_key() const;
+  ::Term* _internal_mutable_key();
+  public:
+  void unsafe_arena_set_allocated_key(
+      ::Term* key);
+  ::Term* unsafe_arena_release_key();
+
+  // required .Mapping mapping = 4;
+  bool has_mapping() const;
+  private:
+  bool _internal_has_mapping() const;
+  public:
+  void clear_mapping();
+  const ::Mapping& mapping() const;
+  PROTOBUF_NODISCARD ::Mapping* release_mapping();
+  ::Mapping* mutable_mapping();
+  void set_allocated_mapping(::Mapping* mapping);
+  private:
+  const ::Mapping& _internal_mapping() const;
+  ::Mapping* _internal_mutable_mapping();
+  public:
+  void unsafe_arena_set_allocated_mapping(
+      ::Mapping* mapping);
+  ::Mapping* unsafe_arena_release_mapping();
+
+  // @@protoc_insertion_point(class_scope:WriteQuery.PointMutate)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr attrname_;
+    ::TableRef* table_ref_;
+    ::Term* key_;
+    ::Mapping* mapping_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WriteQuery final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:WriteQuery) */ {
+ public:
+  inline WriteQuery() : WriteQuery(nullptr) {}
+  ~WriteQuery() override;
+  explicit PROTOBUF_CONSTEXPR WriteQuery(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteQuery(const WriteQuery& from);
+  WriteQuery(WriteQuery&& from) noexcept
+    : WriteQuery() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteQuery& operator=(const WriteQuery& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteQuery& operator=(WriteQuery&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteQuery& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteQuery* internal_default_instance() {
+    return reinterpret_cast<const WriteQuery*>(
+               &_WriteQuery_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(WriteQuery& a, WriteQuery& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteQuery* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteQuery* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteQuery* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteQuery>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteQuery& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteQuery& from) {
+    WriteQuery::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteQuery* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "WriteQuery";
+  }
+  protected:
+  explicit WriteQuery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef WriteQuery_Update Update;
+  typedef WriteQuery_Delete Delete;
+  typedef WriteQuery_Mutate Mutate;
+  typedef WriteQuery_Insert Insert;
+  typedef WriteQuery_ForEach ForEach;
+  typedef WriteQuery_PointUpdate PointUpdate;
+  typedef WriteQuery_PointDelete PointDelete;
+  typedef WriteQuery_PointMutate PointMutate;
+
+  typedef WriteQuery_WriteQueryType WriteQueryType;
+  static constexpr WriteQueryType UPDATE =
+    WriteQuery_WriteQueryType_UPDATE;
+  static constexpr WriteQueryType DELETE =
+    WriteQuery_WriteQueryType_DELETE;
+  static constexpr WriteQueryType MUTATE =
+    WriteQuery_WriteQueryType_MUTATE;
+  static constexpr WriteQueryType INSERT =
+    WriteQuery_WriteQueryType_INSERT;
+  static constexpr WriteQueryType FOREACH =
+    WriteQuery_WriteQueryType_FOREACH;
+  static constexpr WriteQueryType POINTUPDATE =
+    WriteQuery_WriteQueryType_POINTUPDATE;
+  static constexpr WriteQueryType POINTDELETE =
+    WriteQuery_WriteQueryType_POINTDELETE;
+  static constexpr WriteQueryType POINTMUTATE =
+    WriteQuery_WriteQueryType_POINTMUTATE;
+  static inline bool WriteQueryType_IsValid(int value) {
+    return WriteQuery_WriteQueryType_IsValid(value);
+  }
+  static constexpr WriteQueryType WriteQueryType_MIN =
+    WriteQuery_WriteQueryType_WriteQueryType_MIN;
+  static constexpr WriteQueryType WriteQueryType_MAX =
+    WriteQuery_WriteQueryType_WriteQueryType_MAX;
+  static constexpr int WriteQueryType_ARRAYSIZE =
+    WriteQuery_WriteQueryType_WriteQueryType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  WriteQueryType_descriptor() {
+    return WriteQuery_WriteQueryType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& WriteQueryType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, WriteQueryType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function WriteQueryType_Name.");
+    return WriteQuery_WriteQueryType_Name(enum_t_value);
+  }
+  static inline bool WriteQueryType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      WriteQueryType* value) {
+    return WriteQuery_WriteQueryType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUpdateFieldNumber = 2,
+    kDeleteFieldNumber = 3,
+    kMutateFieldNumber = 4,
+    kInsertFieldNumber = 5,
+    kForEachFieldNumber = 7,
+    kPointUpdateFieldNumber = 8,
+    kPointDeleteFieldNumber = 9,
+    kPointMutateFieldNumber = 10,
+    kTypeFieldNumber = 1,
+    kAtomicFieldNumber = 11,
+  };
+  // optional .WriteQuery.Update update = 2;
+  bool has_update() const;
+  private:
+  bool _internal_has_update() const;
+  public:
+  void clear_update();
+  const ::WriteQuery_Update& update() const;
+  PROTOBUF_NODISCARD ::WriteQuery_Update* release_update();
+  ::WriteQuery_Update* mutable_update();
+  void set_allocated_update(::WriteQuery_Update* update);
+  private:
+  const ::WriteQuery_Update& _internal_update() const;
+  ::WriteQuery_Update* _internal_mutable_update();
+  public:
+  void unsafe_arena_set_allocated_update(
+      ::WriteQuery_Update* update);
+  ::WriteQuery_Update* unsafe_arena_release_update();
+
+  // optional .WriteQuery.Delete delete = 3;
+  bool has_delete_() const;
+  private:
+  bool _internal_has_delete_() const;
+  public:
+  void clear_delete_();
+  const ::WriteQuery_Delete& delete_() const;
+  PROTOBUF_NODISCARD ::WriteQuery_Delete* release_delete_();
+  ::WriteQuery_Delete* mutable_delete_();
+  void set_allocated_delete_(::WriteQuery_Delete* delete_);
+  private:
+  const ::WriteQuery_Delete& _internal_delete_() const;
+  ::WriteQuery_Delete* _internal_mutable_delete_();
+  public:
+  void unsafe_arena_set_allocated_delete_(
+      ::WriteQuery_Delete* delete_);
+  ::WriteQuery_Delete* unsafe_arena_release_delete_();
+
+  // optional .WriteQuery.Mutate mutate = 4;
+  bool has_mutate() const;
+  private:
+  bool _internal_has_mutate() const;
+  public:
+  void clear_mutate();
+  const ::WriteQuery_Mutate& mutate() const;
+  PROTOBUF_NODISCARD ::WriteQuery_Mutate* release_mutate();
+  ::WriteQuery_Mutate* mutable_mutate();
+  void set_allocated_mutate(::WriteQuery_Mutate* mutate);
+  private:
+  const ::WriteQuery_Mutate& _internal_mutate() const;
+  ::WriteQuery_Mutate* _internal_mutable_mutate();
+  public:
+  void unsafe_arena_set_allocated_mutate(
+      ::WriteQuery_Mutate* mutate);
+  ::WriteQuery_Mutate* unsafe_arena_release_mutate();
+
+  // optional .WriteQuery.Insert insert = 5;
+  bool has_insert() const;
+  private:
+  bool _internal_has_insert() const;
+  public:
+  void clear_insert();
+  const ::WriteQuery_Insert& insert() const;
+  PROTOBUF_NODISCARD ::WriteQuery_Insert* release_insert();
+  ::WriteQuery_Insert* mutable_insert();
+  void set_allocated_insert(::WriteQuery_Insert* insert);
+  private:
+  const ::WriteQuery_Insert& _internal_insert() const;
+  ::WriteQuery_Insert* _internal_mutable_insert();
+  public:
+  void unsafe_arena_set_allocated_insert(
+      ::WriteQuery_Insert* insert);
+  ::WriteQuery_Insert* unsafe_arena_release_insert();
+
+  // optional .WriteQuery.ForEach for_each = 7;
+  bool has_for_each() const;
+  private:
+  bool _internal_has_for_each() const;
+  public:
+  void clear_for_each();
+  const ::WriteQuery_ForEach& for_each() const;
+  PROTOBUF_NODISCARD ::WriteQuery_ForEach* release_for_each();
+  ::WriteQuery_ForEach* mutable_for_each();
+  void set_allocated_for_each(::WriteQuery_ForEach* for_each);
+  private:
+  const ::WriteQuery_ForEach& _internal_for_each() const;
+  ::WriteQuery_ForEach* _internal_mutable_for_each();
+  public:
+  void unsafe_arena_set_allocated_for_each(
+      ::WriteQuery_ForEach* for_each);
+  ::WriteQuery_ForEach* unsafe_arena_release_for_each();
+
+  // optional .WriteQuery.PointUpdate point_update = 8;
+  bool has_point_update() const;
+  private:
+  bool _internal_has_point_update() const;
+  public:
+  void clear_point_update();
+  const ::WriteQuery_PointUpdate& point_update() const;
+  PROTOBUF_NODISCARD ::WriteQuery_PointUpdate* release_point_update();
+  ::WriteQuery_PointUpdate* mutable_point_update();
+  void set_allocated_point_update(::WriteQuery_PointUpdate* point_update);
+  private:
+  const ::WriteQuery_PointUpdate& _internal_point_update() const;
+  ::WriteQuery_PointUpdate* _internal_mutable_point_update();
+  public:
+  void unsafe_arena_set_allocated_point_update(
+      ::WriteQuery_PointUpdate* point_update);
+  ::WriteQuery_PointUpdate* unsafe_arena_release_point_update();
+
+  // optional .WriteQuery.PointDelete point_delete = 9;
+  bool has_point_delete() const;
+  private:
+  bool _internal_has_point_delete() const;
+  public:
+  void clear_point_delete();
+  const ::WriteQuery_PointDelete& point_delete() const;
+  PROTOBUF_NODISCARD ::WriteQuery_PointDelete* release_point_delete();
+  ::WriteQuery_PointDelete* mutable_point_delete();
+  void set_allocated_point_delete(::WriteQuery_PointDelete* point_delete);
+  private:
+  const ::WriteQuery_PointDelete& _internal_point_delete() const;
+  ::WriteQuery_PointDelete* _internal_mutable_point_delete();
+  public:
+  void unsafe_arena_set_allocated_point_delete(
+      ::WriteQuery_PointDelete* point_delete);
+  ::WriteQuery_PointDelete* unsafe_arena_release_point_delete();
+
+  // optional .WriteQuery.PointMutate point_mutate = 10;
+  bool has_point_mutate() const;
+  private:
+  bool _internal_has_point_mutate() const;
+  public:
+  void clear_point_mutate();
+  const ::WriteQuery_PointMutate& point_mutate() const;
+  PROTOBUF_NODISCARD ::WriteQuery_PointMutate* release_point_mutate();
+  ::WriteQuery_PointMutate* mutable_point_mutate();
+  void set_allocated_point_mutate(::WriteQuery_PointMutate* point_mutate);
+  private:
+  const ::WriteQuery_PointMutate& _internal_point_mutate() const;
+  ::WriteQuery_PointMutate* _internal_mutable_point_mutate();
+  public:
+  void unsafe_arena_set_allocated_point_mutate(
+      ::WriteQuery_PointMutate* point_mutate);
+  ::WriteQuery_PointMutate* unsafe_arena_release_point_mutate();
+
+  // required .WriteQuery.WriteQueryType type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::WriteQuery_WriteQueryType type() const;
+  void set_type(::WriteQuery_WriteQueryType value);
+  private:
+  ::WriteQuery_WriteQueryType _internal_type() const;
+  void _internal_set_type(::WriteQuery_WriteQueryType value);
+  public:
+
+  // optional bool atomic = 11 [default = true];
+  bool has_atomic() const;
+  private:
+  bool _internal_has_atomic() const;
+  public:
+  void clear_atomic();
+  bool atomic() const;
+  void set_atomic(bool value);
+  private:
+  bool _internal_atomic() const;
+  void _internal_set_atomic(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:WriteQuery)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::WriteQuery_Update* update_;
+    ::WriteQuery_Delete* delete__;
+    ::WriteQuery_Mutate* mutate_;
+    ::WriteQuery_Insert* insert_;
+    ::WriteQuery_ForEach* for_each_;
+    ::WriteQuery_PointUpdate* point_update_;
+    ::WriteQuery_PointDelete* point_delete_;
+    ::WriteQuery_PointMutate* point_mutate_;
+    int type_;
+    bool atomic_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MetaQuery_CreateTable final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MetaQuery.CreateTable) */ {
+ public:
+  inline MetaQuery_CreateTable() : MetaQuery_CreateTable(nullptr) {}
+  ~MetaQuery_CreateTable() override;
+  explicit PROTOBUF_CONSTEXPR MetaQuery_CreateTable(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MetaQuery_CreateTable(const MetaQuery_CreateTable& from);
+  MetaQuery_CreateTable(MetaQuery_CreateTable&& from) noexcept
+    : MetaQuery_CreateTable() {
+    *this = ::std::move(from);
+  }
+
+  inline MetaQuery_CreateTable& operator=(const MetaQuery_CreateTable& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MetaQuery_CreateTable& operator=(MetaQuery_CreateTable&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetaQuery_CreateTable& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetaQuery_CreateTable* internal_default_instance() {
+    return reinterpret_cast<const MetaQuery_CreateTable*>(
+               &_MetaQuery_CreateTable_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
+
+  friend void swap(MetaQuery_CreateTable& a, MetaQuery_CreateTable& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetaQuery_CreateTable* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetaQuery_CreateTable* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MetaQuery_CreateTable* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetaQuery_CreateTable>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MetaQuery_CreateTable& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetaQuery_CreateTable& from) {
+    MetaQuery_CreateTable::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetaQuery_CreateTable* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "MetaQuery.CreateTable";
+  }
+  protected:
+  explicit MetaQuery_CreateTable(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDatacenterFieldNumber = 1,
+    kPrimaryKeyFieldNumber = 4,
+    kTableRefFieldNumber = 3,
+    kCacheSizeFieldNumber = 5,
+  };
+  // optional string datacenter = 1;
+  bool has_datacenter() const;
+  private:
+  bool _internal_has_datacenter() const;
+  public:
+  void clear_datacenter();
+  const std::string& datacenter() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_datacenter(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_datacenter();
+  PROTOBUF_NODISCARD std::string* release_datacenter();
+  void set_allocated_datacenter(std::string* datacenter);
+  private:
+  const std::string& _internal_datacenter() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_datacenter(const std::string& value);
+  std::string* _internal_mutable_datacenter();
+  public:
+
+  // optional string primary_key = 4 [default = "id"];
+  bool has_primary_key() const;
+  private:
+  bool _internal_has_primary_key() const;
+  public:
+  void clear_primary_key();
+  const std::string& primary_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_primary_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_primary_key();
+  PROTOBUF_NODISCARD std::string* release_primary_key();
+  void set_allocated_primary_key(std::string* primary_key);
+  private:
+  const std::string& _internal_primary_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_primary_key(const std::string& value);
+  std::string* _internal_mutable_primary_key();
+  public:
+
+  // required .TableRef table_ref = 3;
+  bool has_table_ref() const;
+  private:
+  bool _internal_has_table_ref() const;
+  public:
+  void clear_table_ref();
+  const ::TableRef& table_ref() const;
+  PROTOBUF_NODISCARD ::TableRef* release_table_ref();
+  ::TableRef* mutable_table_ref();
+  void set_allocated_table_ref(::TableRef* table_ref);
+  private:
+  const ::TableRef& _internal_table_ref() const;
+  ::TableRef* _internal_mutable_table_ref();
+  public:
+  void unsafe_arena_set_allocated_table_ref(
+      ::TableRef* table_ref);
+  ::TableRef* unsafe_arena_release_table_ref();
+
+  // optional int64 cache_size = 5 [default = 1073741824];
+  bool has_cache_size() const;
+  private:
+  bool _internal_has_cache_size() const;
+  public:
+  void clear_cache_size();
+  int64_t cache_size() const;
+  void set_cache_size(int64_t value);
+  private:
+  int64_t _internal_cache_size() const;
+  void _internal_set_cache_size(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:MetaQuery.CreateTable)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr datacenter_;
+    static const ::PROTOBUF_NAMESPACE_ID::internal::LazyString _i_give_permission_to_break_this_code_default_primary_key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr primary_key_;
+    ::TableRef* table_ref_;
+    int64_t cache_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MetaQuery_IndexRef final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MetaQuery.IndexRef) */ {
+ public:
+  inline MetaQuery_IndexRef() : MetaQuery_IndexRef(nullptr) {}
+  ~MetaQuery_IndexRef() override;
+  explicit PROTOBUF_CONSTEXPR MetaQuery_IndexRef(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MetaQuery_IndexRef(const MetaQuery_IndexRef& from);
+  MetaQuery_IndexRef(MetaQuery_IndexRef&& from) noexcept
+    : MetaQuery_IndexRef() {
+    *this = ::std::move(from);
+  }
+
+  inline MetaQuery_IndexRef& operator=(const MetaQuery_IndexRef& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MetaQuery_IndexRef& operator=(MetaQuery_IndexRef&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetaQuery_IndexRef& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetaQuery_IndexRef* internal_default_instance() {
+    return reinterpret_cast<const MetaQuery_IndexRef*>(
+               &_MetaQuery_IndexRef_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(MetaQuery_IndexRef& a, MetaQuery_IndexRef& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetaQuery_IndexRef* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetaQuery_IndexRef* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MetaQuery_IndexRef* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetaQuery_IndexRef>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MetaQuery_IndexRef& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetaQuery_IndexRef& from) {
+    MetaQuery_IndexRef::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetaQuery_IndexRef* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "MetaQuery.IndexRef";
+  }
+  protected:
+  explicit MetaQuery_IndexRef(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAttrnameFieldNumber = 2,
+    kTableRefFieldNumber = 1,
+  };
+  // required string attrname = 2;
+  bool has_attrname() const;
+  private:
+  bool _internal_has_attrname() const;
+  public:
+  void clear_attrname();
+  const std::string& attrname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_attrname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_attrname();
+  PROTOBUF_NODISCARD std::string* release_attrname();
+  void set_allocated_attrname(std::string* attrname);
+  private:
+  const std::string& _internal_attrname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_attrname(const std::string& value);
+  std::string* _internal_mutable_attrname();
+  public:
+
+  // required .TableRef table_ref = 1;
+  bool has_table_ref() const;
+  private:
+  bool _internal_has_table_ref() const;
+  public:
+  void clear_table_ref();
+  const ::TableRef& table_ref() const;
+  PROTOBUF_NODISCARD ::TableRef* release_table_ref();
+  ::TableRef* mutable_table_ref();
+  void set_allocated_table_ref(::TableRef* table_ref);
+  private:
+  const ::TableRef& _internal_table_ref() const;
+  ::TableRef* _internal_mutable_table_ref();
+  public:
+  void unsafe_arena_set_allocated_table_ref(
+      ::TableRef* table_ref);
+  ::TableRef* unsafe_arena_release_table_ref();
+
+  // @@protoc_insertion_point(class_scope:MetaQuery.IndexRef)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr attrname_;
+    ::TableRef* table_ref_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MetaQuery final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MetaQuery) */ {
+ public:
+  inline MetaQuery() : MetaQuery(nullptr) {}
+  ~MetaQuery() override;
+  explicit PROTOBUF_CONSTEXPR MetaQuery(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MetaQuery(const MetaQuery& from);
+  MetaQuery(MetaQuery&& from) noexcept
+    : MetaQuery() {
+    *this = ::std::move(from);
+  }
+
+  inline MetaQuery& operator=(const MetaQuery& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MetaQuery& operator=(MetaQuery&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MetaQuery& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MetaQuery* internal_default_instance() {
+    return reinterpret_cast<const MetaQuery*>(
+               &_MetaQuery_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
+
+  friend void swap(MetaQuery& a, MetaQuery& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MetaQuery* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MetaQuery* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MetaQuery* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MetaQuery>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MetaQuery& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MetaQuery& from) {
+    MetaQuery::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MetaQuery* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "MetaQuery";
+  }
+  protected:
+  explicit MetaQuery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef MetaQuery_CreateTable CreateTable;
+  typedef MetaQuery_IndexRef IndexRef;
+
+  typedef MetaQuery_MetaQueryType MetaQueryType;
+  static constexpr MetaQueryType CREATE_DB =
+    MetaQuery_MetaQueryType_CREATE_DB;
+  static constexpr MetaQueryType DROP_DB =
+    MetaQuery_MetaQueryType_DROP_DB;
+  static constexpr MetaQueryType LIST_DBS =
+    MetaQuery_MetaQueryType_LIST_DBS;
+  static constexpr MetaQueryType CREATE_TABLE =
+    MetaQuery_MetaQueryType_CREATE_TABLE;
+  static constexpr MetaQueryType DROP_TABLE =
+    MetaQuery_MetaQueryType_DROP_TABLE;
+  static constexpr MetaQueryType LIST_TABLES =
+    MetaQuery_MetaQueryType_LIST_TABLES;
+  static constexpr MetaQueryType CREATE_INDEX =
+    MetaQuery_MetaQueryType_CREATE_INDEX;
+  static constexpr MetaQueryType DROP_INDEX =
+    MetaQuery_MetaQueryType_DROP_INDEX;
+  static inline bool MetaQueryType_IsValid(int value) {
+    return MetaQuery_MetaQueryType_IsValid(value);
+  }
+  static constexpr MetaQueryType MetaQueryType_MIN =
+    MetaQuery_MetaQueryType_MetaQueryType_MIN;
+  static constexpr MetaQueryType MetaQueryType_MAX =
+    MetaQuery_MetaQueryType_MetaQueryType_MAX;
+  static constexpr int MetaQueryType_ARRAYSIZE =
+    MetaQuery_MetaQueryType_MetaQueryType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  MetaQueryType_descriptor() {
+    return MetaQuery_MetaQueryType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& MetaQueryType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, MetaQueryType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function MetaQueryType_Name.");
+    return MetaQuery_MetaQueryType_Name(enum_t_value);
+  }
+  static inline bool MetaQueryType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      MetaQueryType* value) {
+    return MetaQuery_MetaQueryType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDbNameFieldNumber = 2,
+    kCreateTableFieldNumber = 3,
+    kDropTableFieldNumber = 4,
+    kCreateIndexFieldNumber = 5,
+    kDropIndexFieldNumber = 6,
+    kTypeFieldNumber = 1,
+  };
+  // optional string db_name = 2;
+  bool has_db_name() const;
+  private:
+  bool _internal_has_db_name() const;
+  public:
+  void clear_db_name();
+  const std::string& db_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_db_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_db_name();
+  PROTOBUF_NODISCARD std::string* release_db_name();
+  void set_allocated_db_name(std::string* db_name);
+  private:
+  const std::string& _internal_db_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_db_name(const std::string& value);
+  std::string* _internal_mutable_db_name();
+  public:
+
+  // optional .MetaQuery.CreateTable create_table = 3;
+  bool has_create_table() const;
+  private:
+  bool _internal_has_create_table() const;
+  public:
+  void clear_create_table();
+  const ::MetaQuery_CreateTable& create_table() const;
+  PROTOBUF_NODISCARD ::MetaQuery_CreateTable* release_create_table();
+  ::MetaQuery_CreateTable* mutable_create_table();
+  void set_allocated_create_table(::MetaQuery_CreateTable* create_table);
+  private:
+  const ::MetaQuery_CreateTable& _internal_create_table() const;
+  ::MetaQuery_CreateTable* _internal_mutable_create_table();
+  public:
+  void unsafe_arena_set_allocated_create_table(
+      ::MetaQuery_CreateTable* create_table);
+  ::MetaQuery_CreateTable* unsafe_arena_release_create_table();
+
+  // optional .TableRef drop_table = 4;
+  bool has_drop_table() const;
+  private:
+  bool _internal_has_drop_table() const;
+  public:
+  void clear_drop_table();
+  const ::TableRef& drop_table() const;
+  PROTOBUF_NODISCARD ::TableRef* release_drop_table();
+  ::TableRef* mutable_drop_table();
+  void set_allocated_drop_table(::TableRef* drop_table);
+  private:
+  const ::TableRef& _internal_drop_table() const;
+  ::TableRef* _internal_mutable_drop_table();
+  public:
+  void unsafe_arena_set_allocated_drop_table(
+      ::TableRef* drop_table);
+  ::TableRef* unsafe_arena_release_drop_table();
+
+  // optional .MetaQuery.IndexRef create_index = 5;
+  bool has_create_index() const;
+  private:
+  bool _internal_has_create_index() const;
+  public:
+  void clear_create_index();
+  const ::MetaQuery_IndexRef& create_index() const;
+  PROTOBUF_NODISCARD ::MetaQuery_IndexRef* release_create_index();
+  ::MetaQuery_IndexRef* mutable_create_index();
+  void set_allocated_create_index(::MetaQuery_IndexRef* create_index);
+  private:
+  const ::MetaQuery_IndexRef& _internal_create_index() const;
+  ::MetaQuery_IndexRef* _internal_mutable_create_index();
+  public:
+  void unsafe_arena_set_allocated_create_index(
+      ::MetaQuery_IndexRef* create_index);
+  ::MetaQuery_IndexRef* unsafe_arena_release_create_index();
+
+  // optional .MetaQuery.IndexRef drop_index = 6;
+  bool has_drop_index() const;
+  private:
+  bool _internal_has_drop_index() const;
+  public:
+  void clear_drop_index();
+  const ::MetaQuery_IndexRef& drop_index() const;
+  PROTOBUF_NODISCARD ::MetaQuery_IndexRef* release_drop_index();
+  ::MetaQuery_IndexRef* mutable_drop_index();
+  void set_allocated_drop_index(::MetaQuery_IndexRef* drop_index);
+  private:
+  const ::MetaQuery_IndexRef& _internal_drop_index() const;
+  ::MetaQuery_IndexRef* _internal_mutable_drop_index();
+  public:
+  void unsafe_arena_set_allocated_drop_index(
+      ::MetaQuery_IndexRef* drop_index);
+  ::MetaQuery_IndexRef* unsafe_arena_release_drop_index();
+
+  // required .MetaQuery.MetaQueryType type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::MetaQuery_MetaQueryType type() const;
+  void set_type(::MetaQuery_MetaQueryType value);
+  private:
+  ::MetaQuery_MetaQueryType _internal_type() const;
+  void _internal_set_type(::MetaQuery_MetaQueryType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:MetaQuery)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr db_name_;
+    ::MetaQuery_CreateTable* create_table_;
+    ::TableRef* drop_table_;
+    ::MetaQuery_IndexRef* create_index_;
+    ::MetaQuery_IndexRef* drop_index_;
+    int type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Query final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Query) */ {
+ public:
+  inline Query() : Query(nullptr) {}
+  ~Query() override;
+  explicit PROTOBUF_CONSTEXPR Query(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Query(const Query& from);
+  Query(Query&& from) noexcept
+    : Query() {
+    *this = ::std::move(from);
+  }
+
+  inline Query& operator=(const Query& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Query& operator=(Query&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Query& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Query* internal_default_instance() {
+    return reinterpret_cast<const Query*>(
+               &_Query_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    31;
+
+  friend void swap(Query& a, Query& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Query* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Query* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Query* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Query>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Query& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Query& from) {
+    Query::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Query* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Query";
+  }
+  protected:
+  explicit Query(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Query_QueryType QueryType;
+  static constexpr QueryType READ =
+    Query_QueryType_READ;
+  static constexpr QueryType WRITE =
+    Query_QueryType_WRITE;
+  static constexpr QueryType CONTINUE =
+    Query_QueryType_CONTINUE;
+  static constexpr QueryType STOP =
+    Query_QueryType_STOP;
+  static constexpr QueryType META =
+    Query_QueryType_META;
+  static inline bool QueryType_IsValid(int value) {
+    return Query_QueryType_IsValid(value);
+  }
+  static constexpr QueryType QueryType_MIN =
+    Query_QueryType_QueryType_MIN;
+  static constexpr QueryType QueryType_MAX =
+    Query_QueryType_QueryType_MAX;
+  static constexpr int QueryType_ARRAYSIZE =
+    Query_QueryType_QueryType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  QueryType_descriptor() {
+    return Query_QueryType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& QueryType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, QueryType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function QueryType_Name.");
+    return Query_QueryType_Name(enum_t_value);
+  }
+  static inline bool QueryType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      QueryType* value) {
+    return Query_QueryType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReadQueryFieldNumber = 3,
+    kWriteQueryFieldNumber = 4,
+    kMetaQueryFieldNumber = 5,
+    kTokenFieldNumber = 2,
+    kTypeFieldNumber = 1,
+  };
+  // optional .ReadQuery read_query = 3;
+  bool has_read_query() const;
+  private:
+  bool _internal_has_read_query() const;
+  public:
+  void clear_read_query();
+  const ::ReadQuery& read_query() const;
+  PROTOBUF_NODISCARD ::ReadQuery* release_read_query();
+  ::ReadQuery* mutable_read_query();
+  void set_allocated_read_query(::ReadQuery* read_query);
+  private:
+  const ::ReadQuery& _internal_read_query() const;
+  ::ReadQuery* _internal_mutable_read_query();
+  public:
+  void unsafe_arena_set_allocated_read_query(
+      ::ReadQuery* read_query);
+  ::ReadQuery* unsafe_arena_release_read_query();
+
+  // optional .WriteQuery write_query = 4;
+  bool has_write_query() const;
+  private:
+  bool _internal_has_write_query() const;
+  public:
+  void clear_write_query();
+  const ::WriteQuery& write_query() const;
+  PROTOBUF_NODISCARD ::WriteQuery* release_write_query();
+  ::WriteQuery* mutable_write_query();
+  void set_allocated_write_query(::WriteQuery* write_query);
+  private:
+  const ::WriteQuery& _internal_write_query() const;
+  ::WriteQuery* _internal_mutable_write_query();
+  public:
+  void unsafe_arena_set_allocated_write_query(
+      ::WriteQuery* write_query);
+  ::WriteQuery* unsafe_arena_release_write_query();
+
+  // optional .MetaQuery meta_query = 5;
+  bool has_meta_query() const;
+  private:
+  bool _internal_has_meta_query() const;
+  public:
+  void clear_meta_query();
+  const ::MetaQuery& meta_query() const;
+  PROTOBUF_NODISCARD ::MetaQuery* release_meta_query();
+  ::MetaQuery* mutable_meta_query();
+  void set_allocated_meta_query(::MetaQuery* meta_query);
+  private:
+  const ::MetaQuery& _internal_meta_query() const;
+  ::MetaQuery* _internal_mutable_meta_query();
+  public:
+  void unsafe_arena_set_allocated_meta_query(
+      ::MetaQuery* meta_query);
+  ::MetaQuery* unsafe_arena_release_meta_query();
+
+  // required int64 token = 2;
+  bool has_token() const;
+  private:
+  bool _internal_has_token() const;
+  public:
+  void clear_token();
+  int64_t token() const;
+  void set_token(int64_t value);
+  private:
+  int64_t _internal_token() const;
+  void _internal_set_token(int64_t value);
+  public:
+
+  // required .Query.QueryType type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::Query_QueryType type() const;
+  void set_type(::Query_QueryType value);
+  private:
+  ::Query_QueryType _internal_type() const;
+  void _internal_set_type(::Query_QueryType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Query)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::ReadQuery* read_query_;
+    ::WriteQuery* write_query_;
+    ::MetaQuery* meta_query_;
+    int64_t token_;
+    int type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Response_Backtrace final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Response.Backtrace) */ {
+ public:
+  inline Response_Backtrace() : Response_Backtrace(nullptr) {}
+  ~Response_Backtrace() override;
+  explicit PROTOBUF_CONSTEXPR Response_Backtrace(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Response_Backtrace(const Response_Backtrace& from);
+  Response_Backtrace(Response_Backtrace&& from) noexcept
+    : Response_Backtrace() {
+    *this = ::std::move(from);
+  }
+
+  inline Response_Backtrace& operator=(const Response_Backtrace& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Response_Backtrace& operator=(Response_Backtrace&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Response_Backtrace& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Response_Backtrace* internal_default_instance() {
+    return reinterpret_cast<const Response_Backtrace*>(
+               &_Response_Backtrace_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    32;
+
+  friend void swap(Response_Backtrace& a, Response_Backtrace& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Response_Backtrace* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Response_Backtrace* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Response_Backtrace* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Response_Backtrace>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Response_Backtrace& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Response_Backtrace& from) {
+    Response_Backtrace::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Response_Backtrace* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Response.Backtrace";
+  }
+  protected:
+  explicit Response_Backtrace(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFrameFieldNumber = 1,
+  };
+  // repeated string frame = 1;
+  int frame_size() const;
+  private:
+  int _internal_frame_size() const;
+  public:
+  void clear_frame();
+  const std::string& frame(int index) const;
+  std::string* mutable_frame(int index);
+  void set_frame(int index, const std::string& value);
+  void set_frame(int index, std::string&& value);
+  void set_frame(int index, const char* value);
+  void set_frame(int index, const char* value, size_t size);
+  std::string* add_frame();
+  void add_frame(const std::string& value);
+  void add_frame(std::string&& value);
+  void add_frame(const char* value);
+  void add_frame(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& frame() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_frame();
+  private:
+  const std::string& _internal_frame(int index) const;
+  std::string* _internal_add_frame();
+  public:
+
+  // @@protoc_insertion_point(class_scope:Response.Backtrace)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> frame_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Response) */ {
+ public:
+  inline Response() : Response(nullptr) {}
+  ~Response() override;
+  explicit PROTOBUF_CONSTEXPR Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Response(const Response& from);
+  Response(Response&& from) noexcept
+    : Response() {
+    *this = ::std::move(from);
+  }
+
+  inline Response& operator=(const Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Response& operator=(Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Response* internal_default_instance() {
+    return reinterpret_cast<const Response*>(
+               &_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    33;
+
+  friend void swap(Response& a, Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Response& from) {
+    Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Response";
+  }
+  protected:
+  explicit Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Response_Backtrace Backtrace;
+
+  typedef Response_StatusCode StatusCode;
+  static constexpr StatusCode SUCCESS_EMPTY =
+    Response_StatusCode_SUCCESS_EMPTY;
+  static constexpr StatusCode SUCCESS_JSON =
+    Response_StatusCode_SUCCESS_JSON;
+  static constexpr StatusCode SUCCESS_PARTIAL =
+    Response_StatusCode_SUCCESS_PARTIAL;
+  static constexpr StatusCode SUCCESS_STREAM =
+    Response_StatusCode_SUCCESS_STREAM;
+  static constexpr StatusCode BROKEN_CLIENT =
+    Response_StatusCode_BROKEN_CLIENT;
+  static constexpr StatusCode BAD_QUERY =
+    Response_StatusCode_BAD_QUERY;
+  static constexpr StatusCode RUNTIME_ERROR =
+    Response_StatusCode_RUNTIME_ERROR;
+  static inline bool StatusCode_IsValid(int value) {
+    return Response_StatusCode_IsValid(value);
+  }
+  static constexpr StatusCode StatusCode_MIN =
+    Response_StatusCode_StatusCode_MIN;
+  static constexpr StatusCode StatusCode_MAX =
+    Response_StatusCode_StatusCode_MAX;
+  static constexpr int StatusCode_ARRAYSIZE =
+    Response_StatusCode_StatusCode_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  StatusCode_descriptor() {
+    return Response_StatusCode_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& StatusCode_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, StatusCode>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function StatusCode_Name.");
+    return Response_StatusCode_Name(enum_t_value);
+  }
+  static inline bool StatusCode_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      StatusCode* value) {
+    return Response_StatusCode_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResponseFieldNumber = 3,
+    kErrorMessageFieldNumber = 4,
+    kBacktraceFieldNumber = 5,
+    kTokenFieldNumber = 2,
+    kStatusCodeFieldNumber = 1,
+  };
+  // repeated string response = 3;
+  int response_size() const;
+  private:
+  int _internal_response_size() const;
+  public:
+  void clear_response();
+  const std::string& response(int index) const;
+  std::string* mutable_response(int index);
+  void set_response(int index, const std::string& value);
+  void set_response(int index, std::string&& value);
+  void set_response(int index, const char* value);
+  void set_response(int index, const char* value, size_t size);
+  std::string* add_response();
+  void add_response(const std::string& value);
+  void add_response(std::string&& value);
+  void add_response(const char* value);
+  void add_response(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& response() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_response();
+  private:
+  const std::string& _internal_response(int index) const;
+  std::string* _internal_add_response();
+  public:
+
+  // optional string error_message = 4;
+  bool has_error_message() const;
+  private:
+  bool _internal_has_error_message() const;
+  public:
+  void clear_error_message();
+  const std::string& error_message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
+  void set_allocated_error_message(std::string* error_message);
+  private:
+  const std::string& _internal_error_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
+  std::string* _internal_mutable_error_message();
+  public:
+
+  // optional .Response.Backtrace backtrace = 5;
+  bool has_backtrace() const;
+  private:
+  bool _internal_has_backtrace() const;
+  public:
+  void clear_backtrace();
+  const ::Response_Backtrace& backtrace() const;
+  PROTOBUF_NODISCARD ::Response_Backtrace* release_backtrace();
+  ::Response_Backtrace* mutable_backtrace();
+  void set_allocated_backtrace(::Response_Backtrace* backtrace);
+  private:
+  const ::Response_Backtrace& _internal_backtrace() const;
+  ::Response_Backtrace* _internal_mutable_backtrace();
+  public:
+  void unsafe_arena_set_allocated_backtrace(
+      ::Response_Backtrace* backtrace);
+  ::Response_Backtrace* unsafe_arena_release_backtrace();
+
+  // required int64 token = 2;
+  bool has_token() const;
+  private:
+  bool _internal_has_token() const;
+  public:
+  void clear_token();
+  int64_t token() const;
+  void set_token(int64_t value);
+  private:
+  int64_t _internal_token() const;
+  void _internal_set_token(int64_t value);
+  public:
+
+  // required .Response.StatusCode status_code = 1;
+  bool has_status_code() const;
+  private:
+  bool _internal_has_status_code() const;
+  public:
+  void clear_status_code();
+  ::Response_StatusCode status_code() const;
+  void set_status_code(::Response_StatusCode value);
+  private:
+  ::Response_StatusCode _internal_status_code() const;
+  void _internal_set_status_code(::Response_StatusCode value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Response)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> response_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    ::Response_Backtrace* backtrace_;
+    int64_t token_;
+    int status_code_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rdb_5fprotocol_2fquery_5flanguage_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// TableRef
+
+// required string db_name = 1;
+inline bool TableRef::_internal_has_db_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TableRef::has_db_name() const {
+  return _internal_has_db_name();
+}
+inline void TableRef::clear_db_name() {
+  _impl_.db_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& TableRef::db_name() const {
+  // @@protoc_insertion_point(field_get:TableRef.db_name)
+  return _internal_db_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TableRef::set_db_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.db_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:TableRef.db_name)
+}
+inline std::string* TableRef::mutable_db_name() {
+  std::string* _s = _internal_mutable_db_name();
+  // @@protoc_insertion_point(field_mutable:TableRef.db_name)
+  return _s;
+}
+inline const std::string& TableRef::_internal_db_name() const {
+  return _impl_.db_name_.Get();
+}
+inline void TableRef::_internal_set_db_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.db_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TableRef::_internal_mutable_db_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.db_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TableRef::release_db_name() {
+  // @@protoc_insertion_point(field_release:TableRef.db_name)
+  if (!_internal_has_db_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.db_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.db_name_.IsDefault()) {
+    _impl_.db_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void TableRef::set_allocated_db_name(std::string* db_name) {
+  if (db_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.db_name_.SetAllocated(db_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.db_name_.IsDefault()) {
+    _impl_.db_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:TableRef.db_name)
+}
+
+// required string table_name = 2;
+inline bool TableRef::_internal_has_table_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool TableRef::has_table_name() const {
+  return _internal_has_table_name();
+}
+inline void TableRef::clear_table_name() {
+  _impl_.table_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& TableRef::table_name() const {
+  // @@protoc_insertion_point(field_get:TableRef.table_name)
+  return _internal_table_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TableRef::set_table_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.table_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:TableRef.table_name)
+}
+inline std::string* TableRef::mutable_table_name() {
+  std::string* _s = _internal_mutable_table_name();
+  // @@protoc_insertion_point(field_mutable:TableRef.table_name)
+  return _s;
+}
+inline const std::string& TableRef::_internal_table_name() const {
+  return _impl_.table_name_.Get();
+}
+inline void TableRef::_internal_set_table_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.table_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TableRef::_internal_mutable_table_name() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.table_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TableRef::release_table_name() {
+  // @@protoc_insertion_point(field_release:TableRef.table_name)
+  if (!_internal_has_table_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.table_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void TableRef::set_allocated_table_name(std::string* table_name) {
+  if (table_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.table_name_.SetAllocated(table_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.table_name_.IsDefault()) {
+    _impl_.table_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:TableRef.table_name)
+}
+
+// optional bool use_outdated = 3 [default = false];
+inline bool TableRef::_internal_has_use_outdated() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool TableRef::has_use_outdated() const {
+  return _internal_has_use_outdated();
+}
+inline void TableRef::clear_use_outdated() {
+  _impl_.use_outdated_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool TableRef::_internal_use_outdated() const {
+  return _impl_.use_outdated_;
+}
+inline bool TableRef::use_outdated() const {
+  // @@protoc_insertion_point(field_get:TableRef.use_outdated)
+  return _internal_use_outdated();
+}
+inline void TableRef::_internal_set_use_outdated(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.use_outdated_ = value;
+}
+inline void TableRef::set_use_outdated(bool value) {
+  _internal_set_use_outdated(value);
+  // @@protoc_insertion_point(field_set:TableRef.use_outdated)
+}
+
+// -------------------------------------------------------------------
+
+// VarTermTuple
+
+// required string var = 1;
+inline bool VarTermTuple::_internal_has_var() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool VarTermTuple::has_var() const {
+  return _internal_has_var();
+}
+inline void VarTermTuple::clear_var() {
+  _impl_.var_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& VarTermTuple::var() const {
+  // @@protoc_insertion_point(field_get:VarTermTuple.var)
+  return _internal_var();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void VarTermTuple::set_var(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.var_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:VarTermTuple.var)
+}
+inline std::string* VarTermTuple::mutable_var() {
+  std::string* _s = _internal_mutable_var();
+  // @@protoc_insertion_point(field_mutable:VarTermTuple.var)
+  return _s;
+}
+inline const std::string& VarTermTuple::_internal_var() const {
+  return _impl_.var_.Get();
+}
+inline void VarTermTuple::_internal_set_var(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.var_.Set(value, GetArenaForAllocation());
+}
+inline std::string* VarTermTuple::_internal_mutable_var() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.var_.Mutable(GetArenaForAllocation());
+}
+inline std::string* VarTermTuple::release_var() {
+  // @@protoc_insertion_point(field_release:VarTermTuple.var)
+  if (!_internal_has_var()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.var_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.var_.IsDefault()) {
+    _impl_.var_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void VarTermTuple::set_allocated_var(std::string* var) {
+  if (var != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.var_.SetAllocated(var, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.var_.IsDefault()) {
+    _impl_.var_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:VarTermTuple.var)
+}
+
+// required .Term term = 2;
+inline bool VarTermTuple::_internal_has_term() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.term_ != nullptr);
+  return value;
+}
+inline bool VarTermTuple::has_term() const {
+  return _internal_has_term();
+}
+inline void VarTermTuple::clear_term() {
+  if (_impl_.term_ != nullptr) _impl_.term_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::Term& VarTermTuple::_internal_term() const {
+  const ::Term* p = _impl_.term_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Term&>(
+      ::_Term_default_instance_);
+}
+inline const ::Term& VarTermTuple::term() const {
+  // @@protoc_insertion_point(field_get:VarTermTuple.term)
+  return _internal_term();
+}
+inline void VarTermTuple::unsafe_arena_set_allocated_term(
+    ::Term* term) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.term_);
+  }
+  _impl_.term_ = term;
+  if (term) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:VarTermTuple.term)
+}
+inline ::Term* VarTermTuple::release_term() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Term* temp = _impl_.term_;
+  _impl_.term_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Term* VarTermTuple::unsafe_arena_release_term() {
+  // @@protoc_insertion_point(field_release:VarTermTuple.term)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Term* temp = _impl_.term_;
+  _impl_.term_ = nullptr;
+  return temp;
+}
+inline ::Term* VarTermTuple::_internal_mutable_term() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.term_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Term>(GetArenaForAllocation());
+    _impl_.term_ = p;
+  }
+  return _impl_.term_;
+}
+inline ::Term* VarTermTuple::mutable_term() {
+  ::Term* _msg = _internal_mutable_term();
+  // @@protoc_insertion_point(field_mutable:VarTermTuple.term)
+  return _msg;
+}
+inline void VarTermTuple::set_allocated_term(::Term* term) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.term_;
+  }
+  if (term) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(term);
+    if (message_arena != submessage_arena) {
+      term = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, term, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.term_ = term;
+  // @@protoc_insertion_point(field_set_allocated:VarTermTuple.term)
+}
+
+// -------------------------------------------------------------------
+
+// Term_Let
+
+// repeated .VarTermTuple binds = 1;
+inline int Term_Let::_internal_binds_size() const {
+  return _impl_.binds_.size();
+}
+inline int Term_Let::binds_size() const {
+  return _internal_binds_size();
+}
+inline void Term_Let::clear_binds() {
+  _impl_.binds_.Clear();
+}
+inline ::VarTermTuple* Term_Let::mutable_binds(int index) {
+  // @@protoc_insertion_point(field_mutable:Term.Let.binds)
+  return _impl_.binds_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::VarTermTuple >*
+Term_Let::mutable_binds() {
+  // @@protoc_insertion_point(field_mutable_list:Term.Let.binds)
+  return &_impl_.binds_;
+}
+inline const ::VarTermTuple& Term_Let::_internal_binds(int index) const {
+  return _impl_.binds_.Get(index);
+}
+inline const ::VarTermTuple& Term_Let::binds(int index) const {
+  // @@protoc_insertion_point(field_get:Term.Let.binds)
+  return _internal_binds(index);
+}
+inline ::VarTermTuple* Term_Let::_internal_add_binds() {
+  return _impl_.binds_.Add();
+}
+inline ::VarTermTuple* Term_Let::add_binds() {
+  ::VarTermTuple* _add = _internal_add_binds();
+  // @@protoc_insertion_point(field_add:Term.Let.binds)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::VarTermTuple >&
+Term_Let::binds() const {
+  // @@protoc_insertion_point(field_list:Term.Let.binds)
+  return _impl_.binds_;
+}
+
+// required .Term expr = 2;
+inline bool Term_Let::_internal_has_expr() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.expr_ != nullptr);
+  return value;
+}
+inline bool Term_Let::has_expr() const {
+  return _internal_has_expr();
+}
+inline void Term_Let::clear_expr() {
+  if (_impl_.expr_ != nullptr) _impl_.expr_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::Term& Term_Let::_internal_expr() const {
+  const ::Term* p = _impl_.expr_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Term&>(
+      ::_Term_default_instance_);
+}
+inline const ::Term& Term_Let::expr() const {
+  // @@protoc_insertion_point(field_get:Term.Let.expr)
+  return _internal_expr();
+}
+inline void Term_Let::unsafe_arena_set_allocated_expr(
+    ::Term* expr) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.expr_);
+  }
+  _impl_.expr_ = expr;
+  if (expr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Term.Let.expr)
+}
+inline ::Term* Term_Let::release_expr() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Term* temp = _impl_.expr_;
+  _impl_.expr_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Term* Term_Let::unsafe_arena_release_expr() {
+  // @@protoc_insertion_point(field_release:Term.Let.expr)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Term* temp = _impl_.expr_;
+  _impl_.expr_ = nullptr;
+  return temp;
+}
+inline ::Term* Term_Let::_internal_mutable_expr() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.expr_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Term>(GetArenaForAllocation());
+    _impl_.expr_ = p;
+  }
+  return _impl_.expr_;
+}
+inline ::Term* Term_Let::mutable_expr() {
+  ::Term* _msg = _internal_mutable_expr();
+  // @@protoc_insertion_point(field_mutable:Term.Let.expr)
+  return _msg;
+}
+inline void Term_Let::set_allocated_expr(::Term* expr) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.expr_;
+  }
+  if (expr) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(expr);
+    if (message_arena != submessage_arena) {
+      expr = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, expr, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.expr_ = expr;
+  // @@protoc_insertion_point(field_set_allocated:Term.Let.expr)
+}
+
+// -------------------------------------------------------------------
+
+// Term_Call
+
+// required .Builtin builtin = 1;
+inline bool Term_Call::_internal_has_builtin() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.builtin_ != nullptr);
+  return value;
+}
+inline bool Term_Call::has_builtin() const {
+  return _internal_has_builtin();
+}
+inline void Term_Call::clear_builtin() {
+  if (_impl_.builtin_ != nullptr) _impl_.builtin_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::Builtin& Term_Call::_internal_builtin() const {
+  const ::Builtin* p = _impl_.builtin_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Builtin&>(
+      ::_Builtin_default_instance_);
+}
+inline const ::Builtin& Term_Call::builtin() const {
+  // @@protoc_insertion_point(field_get:Term.Call.builtin)
+  return _internal_builtin();
+}
+inline void Term_Call::unsafe_arena_set_allocated_builtin(
+    ::Builtin* builtin) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.builtin_);
+  }
+  _impl_.builtin_ = builtin;
+  if (builtin) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Term.Call.builtin)
+}
+inline ::Builtin* Term_Call::release_builtin() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Builtin* temp = _impl_.builtin_;
+  _impl_.builtin_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Builtin* Term_Call::unsafe_arena_release_builtin() {
+  // @@protoc_insertion_point(field_release:Term.Call.builtin)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Builtin* temp = _impl_.builtin_;
+  _impl_.builtin_ = nullptr;
+  return temp;
+}
+inline ::Builtin* Term_Call::_internal_mutable_builtin() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.builtin_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Builtin>(GetArenaForAllocation());
+    _impl_.builtin_ = p;
+  }
+  return _impl_.builtin_;
+}
+inline ::Builtin* Term_Call::mutable_builtin() {
+  ::Builtin* _msg = _internal_mutable_builtin();
+  // @@protoc_insertion_point(field_mutable:Term.Call.builtin)
+  return _msg;
+}
+inline void Term_Call::set_allocated_builtin(::Builtin* builtin) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.builtin_;
+  }
+  if (builtin) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(builtin);
+    if (message_arena != submessage_arena) {
+      builtin = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, builtin, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.builtin_ = builtin;
+  // @@protoc_insertion_point(field_set_allocated:Term.Call.builtin)
+}
+
+// repeated .Term args = 2;
+inline int Term_Call::_internal_args_size() const {
+  return _impl_.args_.size();
+}
+inline int Term_Call::args_size() const {
+  return _internal_args_size();
+}
+inline void Term_Call::clear_args() {
+  _impl_.args_.Clear();
+}
+inline ::Term* Term_Call::mutable_args(int index) {
+  // @@protoc_insertion_point(field_mutable:Term.Call.args)
+  return _impl_.args_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Term >*
+Term_Call::mutable_args() {
+  // @@protoc_insertion_point(field_mutable_list:Term.Call.args)
+  return &_impl_.args_;
+}
+inline const ::Term& Term_Call::_internal_args(int index) const {
+  return _impl_.args_.Get(index);
+}
+inline const ::Term& Term_Call::args(int index) const {
+  // @@protoc_insertion_point(field_get:Term.Call.args)
+  return _internal_args(index);
+}
+inline ::Term* Term_Call::_internal_add_args() {
+  return _impl_.args_.Add();
+}
+inline ::Term* Term_Call::add_args() {
+  ::Term* _add = _internal_add_args();
+  // @@protoc_insertion_point(field_add:Term.Call.args)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Term >&
+Term_Call::args() const {
+  // @@protoc_insertion_point(field_list:Term.Call.args)
+  return _impl_.args_;
+}
+
+// -------------------------------------------------------------------
+
+// Term_If
+
+// required .Term test = 1;
+inline bool Term_If::_internal_has_test() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.test_ != nullptr);
+  return value;
+}
+inline bool Term_If::has_test() const {
+  return _internal_has_test();
+}
+inline void Term_If::clear_test() {
+  if (_impl_.test_ != nullptr) _impl_.test_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::Term& Term_If::_internal_test() const {
+  const ::Term* p = _impl_.test_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Term&>(
+      ::_Term_default_instance_);
+}
+inline const ::Term& Term_If::test() const {
+  // @@protoc_insertion_point(field_get:Term.If.test)
+  return _internal_test();
+}
+inline void Term_If::unsafe_arena_set_allocated_test(
+    ::Term* test) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.test_);
+  }
+  _impl_.test_ = test;
+  if (test) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Term.If.test)
+}
+inline ::Term* Term_If::release_test() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Term* temp = _impl_.test_;
+  _impl_.test_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Term* Term_If::unsafe_arena_release_test() {
+  // @@protoc_insertion_point(field_release:Term.If.test)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Term* temp = _impl_.test_;
+  _impl_.test_ = nullptr;
+  return temp;
+}
+inline ::Term* Term_If::_internal_mutable_test() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.test_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Term>(GetArenaForAllocation());
+    _impl_.test_ = p;
+  }
+  return _impl_.test_;
+}
+inline ::Term* Term_If::mutable_test() {
+  ::Term* _msg = _internal_mutable_test();
+  // @@protoc_insertion_point(field_mutable:Term.If.test)
+  return _msg;
+}
+inline void Term_If::set_allocated_test(::Term* test) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.test_;
+  }
+  if (test) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(test);
+    if (message_arena != submessage_arena) {
+      test = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, test, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.test_ = test;
+  // @@protoc_insertion_point(field_set_allocated:Term.If.test)
+}
+
+// required .Term true_branch = 2;
+inline bool Term_If::_internal_has_true_branch() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.true_branch_ != nullptr);
+  return value;
+}
+inline bool Term_If::has_true_branch() const {
+  return _internal_has_true_branch();
+}
+inline void Term_If::clear_true_branch() {
+  if (_impl_.true_branch_ != nullptr) _impl_.true_branch_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::Term& Term_If::_internal_true_branch() const {
+  const ::Term* p = _impl_.true_branch_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Term&>(
+      ::_Term_default_instance_);
+}
+inline const ::Term& Term_If::true_branch() const {
+  // @@protoc_insertion_point(field_get:Term.If.true_branch)
+  return _internal_true_branch();
+}
+inline void Term_If::unsafe_arena_set_allocated_true_branch(
+    ::Term* true_branch) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.true_branch_);
+  }
+  _impl_.true_branch_ = true_branch;
+  if (true_branch) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Term.If.true_branch)
+}
+inline ::Term* Term_If::release_true_branch() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Term* temp = _impl_.true_branch_;
+  _impl_.true_branch_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Term* Term_If::unsafe_arena_release_true_branch() {
+  // @@protoc_insertion_point(field_release:Term.If.true_branch)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Term* temp = _impl_.true_branch_;
+  _impl_.true_branch_ = nullptr;
+  return temp;
+}
+inline ::Term* Term_If::_internal_mutable_true_branch() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.true_branch_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Term>(GetArenaForAllocation());
+    _impl_.true_branch_ = p;
+  }
+  return _impl_.true_branch_;
+}
+inline ::Term* Term_If::mutable_true_branch() {
+  ::Term* _msg = _internal_mutable_true_branch();
+  // @@protoc_insertion_point(field_mutable:Term.If.true_branch)
+  return _msg;
+}
+inline void Term_If::set_allocated_true_branch(::Term* true_branch) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.true_branch_;
+  }
+  if (true_branch) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(true_branch);
+    if (message_arena != submessage_arena) {
+      true_branch = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, true_branch, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.true_branch_ = true_branch;
+  // @@protoc_insertion_point(field_set_allocated:Term.If.true_branch)
+}
+
+// required .Term false_branch = 3;
+inline bool Term_If::_internal_has_false_branch() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.false_branch_ != nullptr);
+  return value;
+}
+inline bool Term_If::has_false_branch() const {
+  return _internal_has_false_branch();
+}
+inline void Term_If::clear_false_branch() {
+  if (_impl_.false_branch_ != nullptr) _impl_.false_branch_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::Term& Term_If::_internal_false_branch() const {
+  const ::Term* p = _impl_.false_branch_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Term&>(
+      ::_Term_default_instance_);
+}
+inline const ::Term& Term_If::false_branch() const {
+  // @@protoc_insertion_point(field_get:Term.If.false_branch)
+  return _internal_false_branch();
+}
+inline void Term_If::unsafe_arena_set_allocated_false_branch(
+    ::Term* false_branch) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.false_branch_);
+  }
+  _impl_.false_branch_ = false_branch;
+  if (false_branch) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Term.If.false_branch)
+}
+inline ::Term* Term_If::release_false_branch() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Term* temp = _impl_.false_branch_;
+  _impl_.false_branch_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Term* Term_If::unsafe_arena_release_false_branch() {
+  // @@protoc_insertion_point(field_release:Term.If.false_branch)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Term* temp = _impl_.false_branch_;
+  _impl_.false_branch_ = nullptr;
+  return temp;
+}
+inline ::Term* Term_If::_internal_mutable_false_branch() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.false_branch_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Term>(GetArenaForAllocation());
+    _impl_.false_branch_ = p;
+  }
+  return _impl_.false_branch_;
+}
+inline ::Term* Term_If::mutable_false_branch() {
+  ::Term* _msg = _internal_mutable_false_branch();
+  // @@protoc_insertion_point(field_mutable:Term.If.false_branch)
+  return _msg;
+}
+inline void Term_If::set_allocated_false_branch(::Term* false_branch) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.false_branch_;
+  }
+  if (false_branch) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(false_branch);
+    if (message_arena != submessage_arena) {
+      false_branch = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, false_branch, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.false_branch_ = false_branch;
+  // @@protoc_insertion_point(field_set_allocated:Term.If.false_branch)
+}
+
+// -------------------------------------------------------------------
+
+// Term_GetByKey
+
+// required .TableRef table_ref = 1;
+inline bool Term_GetByKey::_internal_has_table_ref() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.table_ref_ != nullptr);
+  return value;
+}
+inline bool Term_GetByKey::has_table_ref() const {
+  return _internal_has_table_ref();
+}
+inline void Term_GetByKey::clear_table_ref() {
+  if (_impl_.table_ref_ != nullptr) _impl_.table_ref_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::TableRef& Term_GetByKey::_internal_table_ref() const {
+  const ::TableRef* p = _impl_.table_ref_;
+  return p != nullptr ? *p : reinterpret_cast<const ::TableRef&>(
+      ::_TableRef_default_instance_);
+}
+inline const ::TableRef& Term_GetByKey::table_ref() const {
+  // @@protoc_insertion_point(field_get:Term.GetByKey.table_ref)
+  return _internal_table_ref();
+}
+inline void Term_GetByKey::unsafe_arena_set_allocated_table_ref(
+    ::TableRef* table_ref) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.table_ref_);
+  }
+  _impl_.table_ref_ = table_ref;
+  if (table_ref) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Term.GetByKey.table_ref)
+}
+inline ::TableRef* Term_GetByKey::release_table_ref() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::TableRef* temp = _impl_.table_ref_;
+  _impl_.table_ref_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::TableRef* Term_GetByKey::unsafe_arena_release_table_ref() {
+  // @@protoc_insertion_point(field_release:Term.GetByKey.table_ref)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::TableRef* temp = _impl_.table_ref_;
+  _impl_.table_ref_ = nullptr;
+  return temp;
+}
+inline ::TableRef* Term_GetByKey::_internal_mutable_table_ref() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.table_ref_ == nullptr) {
+    auto* p = CreateMaybeMessage<::TableRef>(GetArenaForAllocation());
+    _impl_.table_ref_ = p;
+  }
+  return _impl_.table_ref_;
+}
+inline ::TableRef* Term_GetByKey::mutable_table_ref() {
+  ::TableRef* _msg = _internal_mutable_table_ref();
+  // @@protoc_insertion_point(field_mutable:Term.GetByKey.table_ref)
+  return _msg;
+}
+inline void Term_GetByKey::set_allocated_table_ref(::TableRef* table_ref) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.table_ref_;
+  }
+  if (table_ref) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(table_ref);
+    if (message_arena != submessage_arena) {
+      table_ref = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, table_ref, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.table_ref_ = table_ref;
+  // @@protoc_insertion_point(field_set_allocated:Term.GetByKey.table_ref)
+}
+
+// required string attrname = 2;
+inline bool Term_GetByKey::_internal_has_attrname() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Term_GetByKey::has_attrname() const {
+  return _internal_has_attrname();
+}
+inline void Term_GetByKey::clear_attrname() {
+  _impl_.attrname_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Term_GetByKey::attrname() const {
+  // @@protoc_insertion_point(field_get:Term.GetByKey.attrname)
+  return _internal_attrname();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Term_GetByKey::set_attrname(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.attrname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Term.GetByKey.attrname)
+}
+inline std::string* Term_GetByKey::mutable_attrname() {
+  std::string* _s = _internal_mutable_attrname();
+  // @@protoc_insertion_point(field_mutable:Term.GetByKey.attrname)
+  return _s;
+}
+inline const std::string& Term_GetByKey::_internal_attrname() const {
+  return _impl_.attrname_.Get();
+}
+inline void Term_GetByKey::_internal_set_attrname(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.attrname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Term_GetByKey::_internal_mutable_attrname() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.attrname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Term_GetByKey::release_attrname() {
+  // @@protoc_insertion_point(field_release:Term.GetByKey.attrname)
+  if (!_internal_has_attrname()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.attrname_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.attrname_.IsDefault()) {
+    _impl_.attrname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Term_GetByKey::set_allocated_attrname(std::string* attrname) {
+  if (attrname != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.attrname_.SetAllocated(attrname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.attrname_.IsDefault()) {
+    _impl_.attrname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Term.GetByKey.attrname)
+}
+
+// required .Term key = 3;
+inline bool Term_GetByKey::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.key_ != nullptr);
+  return value;
+}
+inline bool Term_GetByKey::has_key() const {
+  return _internal_has_key();
+}
+inline void Term_GetByKey::clear_key() {
+  if (_impl_.key_ != nullptr) _impl_.key_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::Term& Term_GetByKey::_internal_key() const {
+  const ::Term* p = _impl_.key_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Term&>(
+      ::_Term_default_instance_);
+}
+inline const ::Term& Term_GetByKey::key() const {
+  // @@protoc_insertion_point(field_get:Term.GetByKey.key)
+  return _internal_key();
+}
+inline void Term_GetByKey::unsafe_arena_set_allocated_key(
+    ::Term* key) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.key_);
+  }
+  _impl_.key_ = key;
+  if (key) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Term.GetByKey.key)
+}
+inline ::Term* Term_GetByKey::release_key() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Term* temp = _impl_.key_;
+  _impl_.key_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Term* Term_GetByKey::unsafe_arena_release_key() {
+  // @@protoc_insertion_point(field_release:Term.GetByKey.key)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Term* temp = _impl_.key_;
+  _impl_.key_ = nullptr;
+  return temp;
+}
+inline ::Term* Term_GetByKey::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.key_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Term>(GetArenaForAllocation());
+    _impl_.key_ = p;
+  }
+  return _impl_.key_;
+}
+inline ::Term* Term_GetByKey::mutable_key() {
+  ::Term* _msg = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:Term.GetByKey.key)
+  return _msg;
+}
+inline void Term_GetByKey::set_allocated_key(::Term* key) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.key_;
+  }
+  if (key) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(key);
+    if (message_arena != submessage_arena) {
+      key = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, key, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.key_ = key;
+  // @@protoc_insertion_point(field_set_allocated:Term.GetByKey.key)
+}
+
+// -------------------------------------------------------------------
+
+// Term_Table
+
+// required .TableRef table_ref = 1;
+inline bool Term_Table::_internal_has_table_ref() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.table_ref_ != nullptr);
+  return value;
+}
+inline bool Term_Table::has_table_ref() const {
+  return _internal_has_table_ref();
+}
+inline void Term_Table::clear_table_ref() {
+  if (_impl_.table_ref_ != nullptr) _impl_.table_ref_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::TableRef& Term_Table::_internal_table_ref() const {
+  const ::TableRef* p = _impl_.table_ref_;
+  return p != nullptr ? *p : reinterpret_cast<const ::TableRef&>(
+      ::_TableRef_default_instance_);
+}
+inline const ::TableRef& Term_Table::table_ref() const {
+  // @@protoc_insertion_point(field_get:Term.Table.table_ref)
+  return _internal_table_ref();
+}
+inline void Term_Table::unsafe_arena_set_allocated_table_ref(
+    ::TableRef* table_ref) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.table_ref_);
+  }
+  _impl_.table_ref_ = table_ref;
+  if (table_ref) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Term.Table.table_ref)
+}
+inline ::TableRef* Term_Table::release_table_ref() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::TableRef* temp = _impl_.table_ref_;
+  _impl_.table_ref_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::TableRef* Term_Table::unsafe_arena_release_table_ref() {
+  // @@protoc_insertion_point(field_release:Term.Table.table_ref)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::TableRef* temp = _impl_.table_ref_;
+  _impl_.table_ref_ = nullptr;
+  return temp;
+}
+inline ::TableRef* Term_Table::_internal_mutable_table_ref() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.table_ref_ == nullptr) {
+    auto* p = CreateMaybeMessage<::TableRef>(GetArenaForAllocation());
+    _impl_.table_ref_ = p;
+  }
+  return _impl_.table_ref_;
+}
+inline ::TableRef* Term_Table::mutable_table_ref() {
+  ::TableRef* _msg = _internal_mutable_table_ref();
+  // @@protoc_insertion_point(field_mutable:Term.Table.table_ref)
+  return _msg;
+}
+inline void Term_Table::set_allocated_table_ref(::TableRef* table_ref) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.table_ref_;
+  }
+  if (table_ref) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(table_ref);
+    if (message_arena != submessage_arena) {
+      table_ref = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, table_ref, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.table_ref_ = table_ref;
+  // @@protoc_insertion_point(field_set_allocated:Term.Table.table_ref)
+}
+
+// -------------------------------------------------------------------
+
+// Term
+
+// required .Term.TermType type = 1;
+inline bool Term::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool Term::has_type() const {
+  return _internal_has_type();
+}
+inline void Term::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline ::Term_TermType Term::_internal_type() const {
+  return static_cast< ::Term_TermType >(_impl_.type_);
+}
+inline ::Term_TermType Term::type() const {
+  // @@protoc_insertion_point(field_get:Term.type)
+  return _internal_type();
+}
+inline void Term::_internal_set_type(::Term_TermType value) {
+  assert(::Term_TermType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.type_ = value;
+}
+inline void Term::set_type(::Term_TermType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:Term.type)
+}
+
+// optional string var = 2;
+inline bool Term::_internal_has_var() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Term::has_var() const {
+  return _internal_has_var();
+}
+inline void Term::clear_var() {
+  _impl_.var_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Term::var() const {
+  // @@protoc_insertion_point(field_get:Term.var)
+  return _internal_var();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Term::set_var(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.var_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Term.var)
+}
+inline std::string* Term::mutable_var() {
+  std::string* _s = _internal_mutable_var();
+  // @@protoc_insertion_point(field_mutable:Term.var)
+  return _s;
+}
+inline const std::string& Term::_internal_var() const {
+  return _impl_.var_.Get();
+}
+inline void Term::_internal_set_var(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.var_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Term::_internal_mutable_var() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.var_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Term::release_var() {
+  // @@protoc_insertion_point(field_release:Term.var)
+  if (!_internal_has_var()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.var_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.var_.IsDefault()) {
+    _impl_.var_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Term::set_allocated_var(std::string* var) {
+  if (var != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.var_.SetAllocated(var, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.var_.IsDefault()) {
+    _impl_.var_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Term.var)
+}
+
+// optional .Term.Let let = 3;
+inline bool Term::_internal_has_let() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.let_ != nullptr);
+  return value;
+}
+inline bool Term::has_let() const {
+  return _internal_has_let();
+}
+inline void Term::clear_let() {
+  if (_impl_.let_ != nullptr) _impl_.let_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::Term_Let& Term::_internal_let() const {
+  const ::Term_Let* p = _impl_.let_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Term_Let&>(
+      ::_Term_Let_default_instance_);
+}
+inline const ::Term_Let& Term::let() const {
+  // @@protoc_insertion_point(field_get:Term.let)
+  return _internal_let();
+}
+inline void Term::unsafe_arena_set_allocated_let(
+    ::Term_Let* let) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.let_);
+  }
+  _impl_.let_ = let;
+  if (let) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Term.let)
+}
+inline ::Term_Let* Term::release_let() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::Term_Let* temp = _impl_.let_;
+  _impl_.let_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Term_Let* Term::unsafe_arena_release_let() {
+  // @@protoc_insertion_point(field_release:Term.let)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::Term_Let* temp = _impl_.let_;
+  _impl_.let_ = nullptr;
+  return temp;
+}
+inline ::Term_Let* Term::_internal_mutable_let() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.let_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Term_Let>(GetArenaForAllocation());
+    _impl_.let_ = p;
+  }
+  return _impl_.let_;
+}
+inline ::Term_Let* Term::mutable_let() {
+  ::Term_Let* _msg = _internal_mutable_let();
+  // @@protoc_insertion_point(field_mutable:Term.let)
+  return _msg;
+}
+inline void Term::set_allocated_let(::Term_Let* let) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.let_;
+  }
+  if (let) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(let);
+    if (message_arena != submessage_arena) {
+      let = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, let, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.let_ = let;
+  // @@protoc_insertion_point(field_set_allocated:Term.let)
+}
+
+// optional .Term.Call call = 4;
+inline bool Term::_internal_has_call() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.call_ != nullptr);
+  return value;
+}
+inline bool Term::has_call() const {
+  return _internal_has_call();
+}
+inline void Term::clear_call() {
+  if (_impl_.call_ != nullptr) _impl_.call_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::Term_Call& Term::_internal_call() const {
+  const ::Term_Call* p = _impl_.call_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Term_Call&>(
+      ::_Term_Call_default_instance_);
+}
+inline const ::Term_Call& Term::call() const {
+  // @@protoc_insertion_point(field_get:Term.call)
+  return _internal_call();
+}
+inline void Term::unsafe_arena_set_allocated_call(
+    ::Term_Call* call) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.call_);
+  }
+  _impl_.call_ = call;
+  if (call) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Term.call)
+}
+inline ::Term_Call* Term::release_call() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::Term_Call* temp = _impl_.call_;
+  _impl_.call_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Term_Call* Term::unsafe_arena_release_call() {
+  // @@protoc_insertion_point(field_release:Term.call)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::Term_Call* temp = _impl_.call_;
+  _impl_.call_ = nullptr;
+  return temp;
+}
+inline ::Term_Call* Term::_internal_mutable_call() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.call_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Term_Call>(GetArenaForAllocation());
+    _impl_.call_ = p;
+  }
+  return _impl_.call_;
+}
+inline ::Term_Call* Term::mutable_call() {
+  ::Term_Call* _msg = _internal_mutable_call();
+  // @@protoc_insertion_point(field_mutable:Term.call)
+  return _msg;
+}
+inline void Term::set_allocated_call(::Term_Call* call) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.call_;
+  }
+  if (call) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(call);
+    if (message_arena != submessage_arena) {
+      call = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, call, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  _impl_.call_ = call;
+  // @@protoc_insertion_point(field_set_allocated:Term.call)
+}
+
+// optional .Term.If if_ = 5;
+inline bool Term::_internal_has_if_() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.if__ != nullptr);
+  return value;
+}
+inline bool Term::has_if_() const {
+  return _internal_has_if_();
+}
+inline void Term::clear_if_() {
+  if (_impl_.if__ != nullptr) _impl_.if__->Clear();
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline const ::Term_If& Term::_internal_if_() const {
+  const ::Term_If* p = _impl_.if__;
+  return p != nullptr ? *p : reinterpret_cast<const ::Term_If&>(
+      ::_Term_If_default_instance_);
+}
+inline const ::Term_If& Term::if_() const {
+  // @@protoc_insertion_point(field_get:Term.if_)
+  return _internal_if_();
+}
+inline void Term::unsafe_arena_set_allocated_if_(
+    ::Term_If* if_) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.if__);
+  }
+  _impl_.if__ = if_;
+  if (if_) {
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Term.if_)
+}
+inline ::Term_If* Term::release_if_() {
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::Term_If* temp = _impl_.if__;
+  _impl_.if__ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Term_If* Term::unsafe_arena_release_if_() {
+  // @@protoc_insertion_point(field_release:Term.if_)
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::Term_If* temp = _impl_.if__;
+  _impl_.if__ = nullptr;
+  return temp;
+}
+inline ::Term_If* Term::_internal_mutable_if_() {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  if (_impl_.if__ == nullptr) {
+    auto* p = CreateMaybeMessage<::Term_If>(GetArenaForAllocation());
+    _impl_.if__ = p;
+  }
+  return _impl_.if__;
+}
+inline ::Term_If* Term::mutable_if_() {
+  ::Term_If* _msg = _internal_mutable_if_();
+  // @@protoc_insertion_point(field_mutable:Term.if_)
+  return _msg;
+}
+inline void Term::set_allocated_if_(::Term_If* if_) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.if__;
+  }
+  if (if_) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(if_);
+    if (message_arena != submessage_arena) {
+      if_ = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, if_, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  _impl_.if__ = if_;
+  // @@protoc_insertion_point(field_set_allocated:Term.if_)
+}
+
+// optional string error = 6;
+inline bool Term::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Term::has_error() const {
+  return _internal_has_error();
+}
+inline void Term::clear_error() {
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Term::error() const {
+  // @@protoc_insertion_point(field_get:Term.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Term::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Term.error)
+}
+inline std::string* Term::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:Term.error)
+  return _s;
+}
+inline const std::string& Term::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void Term::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Term::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Term::release_error() {
+  // @@protoc_insertion_point(field_release:Term.error)
+  if (!_internal_has_error()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Term::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Term.error)
+}
+
+// optional double number = 7;
+inline bool Term::_internal_has_number() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool Term::has_number() const {
+  return _internal_has_number();
+}
+inline void Term::clear_number() {
+  _impl_.number_ = 0;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline double Term::_internal_number() const {
+  return _impl_.number_;
+}
+inline double Term::number() const {
+  // @@protoc_insertion_point(field_get:Term.number)
+  return _internal_number();
+}
+inline void Term::_internal_set_number(double value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.number_ = value;
+}
+inline void Term::set_number(double value) {
+  _internal_set_number(value);
+  // @@protoc_insertion_point(field_set:Term.number)
+}
+
+// optional string valuestring = 8;
+inline bool Term::_internal_has_valuestring() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Term::has_valuestring() const {
+  return _internal_has_valuestring();
+}
+inline void Term::clear_valuestring() {
+  _impl_.valuestring_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& Term::valuestring() const {
+  // @@protoc_insertion_point(field_get:Term.valuestring)
+  return _internal_valuestring();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Term::set_valuestring(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.valuestring_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Term.valuestring)
+}
+inline std::string* Term::mutable_valuestring() {
+  std::string* _s = _internal_mutable_valuestring();
+  // @@protoc_insertion_point(field_mutable:Term.valuestring)
+  return _s;
+}
+inline const std::string& Term::_internal_valuestring() const {
+  return _impl_.valuestring_.Get();
+}
+inline void Term::_internal_set_valuestring(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.valuestring_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Term::_internal_mutable_valuestring() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.valuestring_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Term::release_valuestring() {
+  // @@protoc_insertion_point(field_release:Term.valuestring)
+  if (!_internal_has_valuestring()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.valuestring_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.valuestring_.IsDefault()) {
+    _impl_.valuestring_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Term::set_allocated_valuestring(std::string* valuestring) {
+  if (valuestring != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.valuestring_.SetAllocated(valuestring, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.valuestring_.IsDefault()) {
+    _impl_.valuestring_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Term.valuestring)
+}
+
+// optional string jsonstring = 9;
+inline bool Term::_internal_has_jsonstring() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Term::has_jsonstring() const {
+  return _internal_has_jsonstring();
+}
+inline void Term::clear_jsonstring() {
+  _impl_.jsonstring_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const std::string& Term::jsonstring() const {
+  // @@protoc_insertion_point(field_get:Term.jsonstring)
+  return _internal_jsonstring();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Term::set_jsonstring(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.jsonstring_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Term.jsonstring)
+}
+inline std::string* Term::mutable_jsonstring() {
+  std::string* _s = _internal_mutable_jsonstring();
+  // @@protoc_insertion_point(field_mutable:Term.jsonstring)
+  return _s;
+}
+inline const std::string& Term::_internal_jsonstring() const {
+  return _impl_.jsonstring_.Get();
+}
+inline void Term::_internal_set_jsonstring(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.jsonstring_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Term::_internal_mutable_jsonstring() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.jsonstring_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Term::release_jsonstring() {
+  // @@protoc_insertion_point(field_release:Term.jsonstring)
+  if (!_internal_has_jsonstring()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.jsonstring_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.jsonstring_.IsDefault()) {
+    _impl_.jsonstring_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Term::set_allocated_jsonstring(std::string* jsonstring) {
+  if (jsonstring != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.jsonstring_.SetAllocated(jsonstring, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.jsonstring_.IsDefault()) {
+    _impl_.jsonstring_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Term.jsonstring)
+}
+
+// optional bool valuebool = 10;
+inline bool Term::_internal_has_valuebool() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool Term::has_valuebool() const {
+  return _internal_has_valuebool();
+}
+inline void Term::clear_valuebool() {
+  _impl_.valuebool_ = false;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline bool Term::_internal_valuebool() const {
+  return _impl_.valuebool_;
+}
+inline bool Term::valuebool() const {
+  // @@protoc_insertion_point(field_get:Term.valuebool)
+  return _internal_valuebool();
+}
+inline void Term::_internal_set_valuebool(bool value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.valuebool_ = value;
+}
+inline void Term::set_valuebool(bool value) {
+  _internal_set_valuebool(value);
+  // @@protoc_insertion_point(field_set:Term.valuebool)
+}
+
+// repeated .Term array = 11;
+inline int Term::_internal_array_size() const {
+  return _impl_.array_.size();
+}
+inline int Term::array_size() const {
+  return _internal_array_size();
+}
+inline void Term::clear_array() {
+  _impl_.array_.Clear();
+}
+inline ::Term* Term::mutable_array(int index) {
+  // @@protoc_insertion_point(field_mutable:Term.array)
+  return _impl_.array_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Term >*
+Term::mutable_array() {
+  // @@protoc_insertion_point(field_mutable_list:Term.array)
+  return &_impl_.array_;
+}
+inline const ::Term& Term::_internal_array(int index) const {
+  return _impl_.array_.Get(index);
+}
+inline const ::Term& Term::array(int index) const {
+  // @@protoc_insertion_point(field_get:Term.array)
+  return _internal_array(index);
+}
+inline ::Term* Term::_internal_add_array() {
+  return _impl_.array_.Add();
+}
+inline ::Term* Term::add_array() {
+  ::Term* _add = _internal_add_array();
+  // @@protoc_insertion_point(field_add:Term.array)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Term >&
+Term::array() const {
+  // @@protoc_insertion_point(field_list:Term.array)
+  return _impl_.array_;
+}
+
+// repeated .VarTermTuple object = 12;
+inline int Term::_internal_object_size() const {
+  return _impl_.object_.size();
+}
+inline int Term::object_size() const {
+  return _internal_object_size();
+}
+inline void Term::clear_object() {
+  _impl_.object_.Clear();
+}
+inline ::VarTermTuple* Term::mutable_object(int index) {
+  // @@protoc_insertion_point(field_mutable:Term.object)
+  return _impl_.object_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::VarTermTuple >*
+Term::mutable_object() {
+  // @@protoc_insertion_point(field_mutable_list:Term.object)
+  return &_impl_.object_;
+}
+inline const ::VarTermTuple& Term::_internal_object(int index) const {
+  return _impl_.object_.Get(index);
+}
+inline const ::VarTermTuple& Term::object(int index) const {
+  // @@protoc_insertion_point(field_get:Term.object)
+  return _internal_object(index);
+}
+inline ::VarTermTuple* Term::_internal_add_object() {
+  return _impl_.object_.Add();
+}
+inline ::VarTermTuple* Term::add_object() {
+  ::VarTermTuple* _add = _internal_add_object();
+  // @@protoc_insertion_point(field_add:Term.object)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::VarTermTuple >&
+Term::object() const {
+  // @@protoc_insertion_point(field_list:Term.object)
+  return _impl_.object_;
+}
+
+// optional .Term.GetByKey get_by_key = 14;
+inline bool Term::_internal_has_get_by_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.get_by_key_ != nullptr);
+  return value;
+}
+inline bool Term::has_get_by_key() const {
+  return _internal_has_get_by_key();
+}
+inline void Term::clear_get_by_key() {
+  if (_impl_.get_by_key_ != nullptr) _impl_.get_by_key_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline const ::Term_GetByKey& Term::_internal_get_by_key() const {
+  const ::Term_GetByKey* p = _impl_.get_by_key_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Term_GetByKey&>(
+      ::_Term_GetByKey_default_instance_);
+}
+inline const ::Term_GetByKey& Term::get_by_key() const {
+  // @@protoc_insertion_point(field_get:Term.get_by_key)
+  return _internal_get_by_key();
+}
+inline void Term::unsafe_arena_set_allocated_get_by_key(
+    ::Term_GetByKey* get_by_key) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.get_by_key_);
+  }
+  _impl_.get_by_key_ = get_by_key;
+  if (get_by_key) {
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Term.get_by_key)
+}
+inline ::Term_GetByKey* Term::release_get_by_key() {
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::Term_GetByKey* temp = _impl_.get_by_key_;
+  _impl_.get_by_key_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Term_GetByKey* Term::unsafe_arena_release_get_by_key() {
+  // @@protoc_insertion_point(field_release:Term.get_by_key)
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::Term_GetByKey* temp = _impl_.get_by_key_;
+  _impl_.get_by_key_ = nullptr;
+  return temp;
+}
+inline ::Term_GetByKey* Term::_internal_mutable_get_by_key() {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  if (_impl_.get_by_key_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Term_GetByKey>(GetArenaForAllocation());
+    _impl_.get_by_key_ = p;
+  }
+  return _impl_.get_by_key_;
+}
+inline ::Term_GetByKey* Term::mutable_get_by_key() {
+  ::Term_GetByKey* _msg = _internal_mutable_get_by_key();
+  // @@protoc_insertion_point(field_mutable:Term.get_by_key)
+  return _msg;
+}
+inline void Term::set_allocated_get_by_key(::Term_GetByKey* get_by_key) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.get_by_key_;
+  }
+  if (get_by_key) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(get_by_key);
+    if (message_arena != submessage_arena) {
+      get_by_key = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, get_by_key, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+  _impl_.get_by_key_ = get_by_key;
+  // @@protoc_insertion_point(field_set_allocated:Term.get_by_key)
+}
+
+// optional .Term.Table table = 15;
+inline bool Term::_internal_has_table() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.table_ != nullptr);
+  return value;
+}
+inline bool Term::has_table() const {
+  return _internal_has_table();
+}
+inline void Term::clear_table() {
+  if (_impl_.table_ != nullptr) _impl_.table_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline const ::Term_Table& Term::_internal_table() const {
+  const ::Term_Table* p = _impl_.table_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Term_Table&>(
+      ::_Term_Table_default_instance_);
+}
+inline const ::Term_Table& Term::table() const {
+  // @@protoc_insertion_point(field_get:Term.table)
+  return _internal_table();
+}
+inline void Term::unsafe_arena_set_allocated_table(
+    ::Term_Table* table) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.table_);
+  }
+  _impl_.table_ = table;
+  if (table) {
+    _impl_._has_bits_[0] |= 0x00000200u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000200u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Term.table)
+}
+inline ::Term_Table* Term::release_table() {
+  _impl_._has_bits_[0] &= ~0x00000200u;
+  ::Term_Table* temp = _impl_.table_;
+  _impl_.table_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Term_Table* Term::unsafe_arena_release_table() {
+  // @@protoc_insertion_point(field_release:Term.table)
+  _impl_._has_bits_[0] &= ~0x00000200u;
+  ::Term_Table* temp = _impl_.table_;
+  _impl_.table_ = nullptr;
+  return temp;
+}
+inline ::Term_Table* Term::_internal_mutable_table() {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  if (_impl_.table_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Term_Table>(GetArenaForAllocation());
+    _impl_.table_ = p;
+  }
+  return _impl_.table_;
+}
+inline ::Term_Table* Term::mutable_table() {
+  ::Term_Table* _msg = _internal_mutable_table();
+  // @@protoc_insertion_point(field_mutable:Term.table)
+  return _msg;
+}
+inline void Term::set_allocated_table(::Term_Table* table) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.table_;
+  }
+  if (table) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(table);
+    if (message_arena != submessage_arena) {
+      table = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, table, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000200u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000200u;
+  }
+  _impl_.table_ = table;
+  // @@protoc_insertion_point(field_set_allocated:Term.table)
+}
+
+// optional string javascript = 16;
+inline bool Term::_internal_has_javascript() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Term::has_javascript() const {
+  return _internal_has_javascript();
+}
+inline void Term::clear_javascript() {
+  _impl_.javascript_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const std::string& Term::javascript() const {
+  // @@protoc_insertion_point(field_get:Term.javascript)
+  return _internal_javascript();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Term::set_javascript(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000010u;
+ _impl_.javascript_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Term.javascript)
+}
+inline std::string* Term::mutable_javascript() {
+  std::string* _s = _internal_mutable_javascript();
+  // @@protoc_insertion_point(field_mutable:Term.javascript)
+  return _s;
+}
+inline const std::string& Term::_internal_javascript() const {
+  return _impl_.javascript_.Get();
+}
+inline void Term::_internal_set_javascript(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.javascript_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Term::_internal_mutable_javascript() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  return _impl_.javascript_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Term::release_javascript() {
+  // @@protoc_insertion_point(field_release:Term.javascript)
+  if (!_internal_has_javascript()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  auto* p = _impl_.javascript_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.javascript_.IsDefault()) {
+    _impl_.javascript_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Term::set_allocated_javascript(std::string* javascript) {
+  if (javascript != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.javascript_.SetAllocated(javascript, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.javascript_.IsDefault()) {
+    _impl_.javascript_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Term.javascript)
+}
+
+// -------------------------------------------------------------------
+
+// Builtin_Filter
+
+// required .Predicate predicate = 1;
+inline bool Builtin_Filter::_internal_has_predicate() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.predicate_ != nullptr);
+  return value;
+}
+inline bool Builtin_Filter::has_predicate() const {
+  return _internal_has_predicate();
+}
+inline void Builtin_Filter::clear_predicate() {
+  if (_impl_.predicate_ != nullptr) _impl_.predicate_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::Predicate& Builtin_Filter::_internal_predicate() const {
+  const ::Predicate* p = _impl_.predicate_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Predicate&>(
+      ::_Predicate_default_instance_);
+}
+inline const ::Predicate& Builtin_Filter::predicate() const {
+  // @@protoc_insertion_point(field_get:Builtin.Filter.predicate)
+  return _internal_predicate();
+}
+inline void Builtin_Filter::unsafe_arena_set_allocated_predicate(
+    ::Predicate* predicate) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.predicate_);
+  }
+  _impl_.predicate_ = predicate;
+  if (predicate) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Builtin.Filter.predicate)
+}
+inline ::Predicate* Builtin_Filter::release_predicate() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Predicate* temp = _impl_.predicate_;
+  _impl_.predicate_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Predicate* Builtin_Filter::unsafe_arena_release_predicate() {
+  // @@protoc_insertion_point(field_release:Builtin.Filter.predicate)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Predicate* temp = _impl_.predicate_;
+  _impl_.predicate_ = nullptr;
+  return temp;
+}
+inline ::Predicate* Builtin_Filter::_internal_mutable_predicate() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.predicate_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Predicate>(GetArenaForAllocation());
+    _impl_.predicate_ = p;
+  }
+  return _impl_.predicate_;
+}
+inline ::Predicate* Builtin_Filter::mutable_predicate() {
+  ::Predicate* _msg = _internal_mutable_predicate();
+  // @@protoc_insertion_point(field_mutable:Builtin.Filter.predicate)
+  return _msg;
+}
+inline void Builtin_Filter::set_allocated_predicate(::Predicate* predicate) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.predicate_;
+  }
+  if (predicate) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(predicate);
+    if (message_arena != submessage_arena) {
+      predicate = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, predicate, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.predicate_ = predicate;
+  // @@protoc_insertion_point(field_set_allocated:Builtin.Filter.predicate)
+}
+
+// -------------------------------------------------------------------
+
+// Builtin_Map
+
+// required .Mapping mapping = 1;
+inline bool Builtin_Map::_internal_has_mapping() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.mapping_ != nullptr);
+  return value;
+}
+inline bool Builtin_Map::has_mapping() const {
+  return _internal_has_mapping();
+}
+inline void Builtin_Map::clear_mapping() {
+  if (_impl_.mapping_ != nullptr) _impl_.mapping_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::Mapping& Builtin_Map::_internal_mapping() const {
+  const ::Mapping* p = _impl_.mapping_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Mapping&>(
+      ::_Mapping_default_instance_);
+}
+inline const ::Mapping& Builtin_Map::mapping() const {
+  // @@protoc_insertion_point(field_get:Builtin.Map.mapping)
+  return _internal_mapping();
+}
+inline void Builtin_Map::unsafe_arena_set_allocated_mapping(
+    ::Mapping* mapping) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.mapping_);
+  }
+  _impl_.mapping_ = mapping;
+  if (mapping) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Builtin.Map.mapping)
+}
+inline ::Mapping* Builtin_Map::release_mapping() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Mapping* temp = _impl_.mapping_;
+  _impl_.mapping_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Mapping* Builtin_Map::unsafe_arena_release_mapping() {
+  // @@protoc_insertion_point(field_release:Builtin.Map.mapping)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Mapping* temp = _impl_.mapping_;
+  _impl_.mapping_ = nullptr;
+  return temp;
+}
+inline ::Mapping* Builtin_Map::_internal_mutable_mapping() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.mapping_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Mapping>(GetArenaForAllocation());
+    _impl_.mapping_ = p;
+  }
+  return _impl_.mapping_;
+}
+inline ::Mapping* Builtin_Map::mutable_mapping() {
+  ::Mapping* _msg = _internal_mutable_mapping();
+  // @@protoc_insertion_point(field_mutable:Builtin.Map.mapping)
+  return _msg;
+}
+inline void Builtin_Map::set_allocated_mapping(::Mapping* mapping) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.mapping_;
+  }
+  if (mapping) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(mapping);
+    if (message_arena != submessage_arena) {
+      mapping = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mapping, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.mapping_ = mapping;
+  // @@protoc_insertion_point(field_set_allocated:Builtin.Map.mapping)
+}
+
+// -------------------------------------------------------------------
+
+// Builtin_ConcatMap
+
+// required .Mapping mapping = 1;
+inline bool Builtin_ConcatMap::_internal_has_mapping() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.mapping_ != nullptr);
+  return value;
+}
+inline bool Builtin_ConcatMap::has_mapping() const {
+  return _internal_has_mapping();
+}
+inline void Builtin_ConcatMap::clear_mapping() {
+  if (_impl_.mapping_ != nullptr) _impl_.mapping_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::Mapping& Builtin_ConcatMap::_internal_mapping() const {
+  const ::Mapping* p = _impl_.mapping_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Mapping&>(
+      ::_Mapping_default_instance_);
+}
+inline const ::Mapping& Builtin_ConcatMap::mapping() const {
+  // @@protoc_insertion_point(field_get:Builtin.ConcatMap.mapping)
+  return _internal_mapping();
+}
+inline void Builtin_ConcatMap::unsafe_arena_set_allocated_mapping(
+    ::Mapping* mapping) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.mapping_);
+  }
+  _impl_.mapping_ = mapping;
+  if (mapping) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Builtin.ConcatMap.mapping)
+}
+inline ::Mapping* Builtin_ConcatMap::release_mapping() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Mapping* temp = _impl_.mapping_;
+  _impl_.mapping_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Mapping* Builtin_ConcatMap::unsafe_arena_release_mapping() {
+  // @@protoc_insertion_point(field_release:Builtin.ConcatMap.mapping)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Mapping* temp = _impl_.mapping_;
+  _impl_.mapping_ = nullptr;
+  return temp;
+}
+inline ::Mapping* Builtin_ConcatMap::_internal_mutable_mapping() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.mapping_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Mapping>(GetArenaForAllocation());
+    _impl_.mapping_ = p;
+  }
+  return _impl_.mapping_;
+}
+inline ::Mapping* Builtin_ConcatMap::mutable_mapping() {
+  ::Mapping* _msg = _internal_mutable_mapping();
+  // @@protoc_insertion_point(field_mutable:Builtin.ConcatMap.mapping)
+  return _msg;
+}
+inline void Builtin_ConcatMap::set_allocated_mapping(::Mapping* mapping) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.mapping_;
+  }
+  if (mapping) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(mapping);
+    if (message_arena != submessage_arena) {
+      mapping = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mapping, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.mapping_ = mapping;
+  // @@protoc_insertion_point(field_set_allocated:Builtin.ConcatMap.mapping)
+}
+
+// -------------------------------------------------------------------
+
+// Builtin_OrderBy
+
+// required string attr = 1;
+inline bool Builtin_OrderBy::_internal_has_attr() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Builtin_OrderBy::has_attr() const {
+  return _internal_has_attr();
+}
+inline void Builtin_OrderBy::clear_attr() {
+  _impl_.attr_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Builtin_OrderBy::attr() const {
+  // @@protoc_insertion_point(field_get:Builtin.OrderBy.attr)
+  return _internal_attr();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Builtin_OrderBy::set_attr(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.attr_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Builtin.OrderBy.attr)
+}
+inline std::string* Builtin_OrderBy::mutable_attr() {
+  std::string* _s = _internal_mutable_attr();
+  // @@protoc_insertion_point(field_mutable:Builtin.OrderBy.attr)
+  return _s;
+}
+inline const std::string& Builtin_OrderBy::_internal_attr() const {
+  return _impl_.attr_.Get();
+}
+inline void Builtin_OrderBy::_internal_set_attr(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.attr_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Builtin_OrderBy::_internal_mutable_attr() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.attr_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Builtin_OrderBy::release_attr() {
+  // @@protoc_insertion_point(field_release:Builtin.OrderBy.attr)
+  if (!_internal_has_attr()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.attr_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.attr_.IsDefault()) {
+    _impl_.attr_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Builtin_OrderBy::set_allocated_attr(std::string* attr) {
+  if (attr != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.attr_.SetAllocated(attr, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.attr_.IsDefault()) {
+    _impl_.attr_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Builtin.OrderBy.attr)
+}
+
+// optional bool ascending = 2 [default = true];
+inline bool Builtin_OrderBy::_internal_has_ascending() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Builtin_OrderBy::has_ascending() const {
+  return _internal_has_ascending();
+}
+inline void Builtin_OrderBy::clear_ascending() {
+  _impl_.ascending_ = true;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool Builtin_OrderBy::_internal_ascending() const {
+  return _impl_.ascending_;
+}
+inline bool Builtin_OrderBy::ascending() const {
+  // @@protoc_insertion_point(field_get:Builtin.OrderBy.ascending)
+  return _internal_ascending();
+}
+inline void Builtin_OrderBy::_internal_set_ascending(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.ascending_ = value;
+}
+inline void Builtin_OrderBy::set_ascending(bool value) {
+  _internal_set_ascending(value);
+  // @@protoc_insertion_point(field_set:Builtin.OrderBy.ascending)
+}
+
+// -------------------------------------------------------------------
+
+// Builtin_GroupedMapReduce
+
+// required .Mapping group_mapping = 1;
+inline bool Builtin_GroupedMapReduce::_internal_has_group_mapping() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.group_mapping_ != nullptr);
+  return value;
+}
+inline bool Builtin_GroupedMapReduce::has_group_mapping() const {
+  return _internal_has_group_mapping();
+}
+inline void Builtin_GroupedMapReduce::clear_group_mapping() {
+  if (_impl_.group_mapping_ != nullptr) _impl_.group_mapping_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::Mapping& Builtin_GroupedMapReduce::_internal_group_mapping() const {
+  const ::Mapping* p = _impl_.group_mapping_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Mapping&>(
+      ::_Mapping_default_instance_);
+}
+inline const ::Mapping& Builtin_GroupedMapReduce::group_mapping() const {
+  // @@protoc_insertion_point(field_get:Builtin.GroupedMapReduce.group_mapping)
+  return _internal_group_mapping();
+}
+inline void Builtin_GroupedMapReduce::unsafe_arena_set_allocated_group_mapping(
+    ::Mapping* group_mapping) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.group_mapping_);
+  }
+  _impl_.group_mapping_ = group_mapping;
+  if (group_mapping) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Builtin.GroupedMapReduce.group_mapping)
+}
+inline ::Mapping* Builtin_GroupedMapReduce::release_group_mapping() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Mapping* temp = _impl_.group_mapping_;
+  _impl_.group_mapping_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Mapping* Builtin_GroupedMapReduce::unsafe_arena_release_group_mapping() {
+  // @@protoc_insertion_point(field_release:Builtin.GroupedMapReduce.group_mapping)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Mapping* temp = _impl_.group_mapping_;
+  _impl_.group_mapping_ = nullptr;
+  return temp;
+}
+inline ::Mapping* Builtin_GroupedMapReduce::_internal_mutable_group_mapping() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.group_mapping_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Mapping>(GetArenaForAllocation());
+    _impl_.group_mapping_ = p;
+  }
+  return _impl_.group_mapping_;
+}
+inline ::Mapping* Builtin_GroupedMapReduce::mutable_group_mapping() {
+  ::Mapping* _msg = _internal_mutable_group_mapping();
+  // @@protoc_insertion_point(field_mutable:Builtin.GroupedMapReduce.group_mapping)
+  return _msg;
+}
+inline void Builtin_GroupedMapReduce::set_allocated_group_mapping(::Mapping* group_mapping) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.group_mapping_;
+  }
+  if (group_mapping) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(group_mapping);
+    if (message_arena != submessage_arena) {
+      group_mapping = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, group_mapping, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.group_mapping_ = group_mapping;
+  // @@protoc_insertion_point(field_set_allocated:Builtin.GroupedMapReduce.group_mapping)
+}
+
+// required .Mapping value_mapping = 2;
+inline bool Builtin_GroupedMapReduce::_internal_has_value_mapping() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.value_mapping_ != nullptr);
+  return value;
+}
+inline bool Builtin_GroupedMapReduce::has_value_mapping() const {
+  return _internal_has_value_mapping();
+}
+inline void Builtin_GroupedMapReduce::clear_value_mapping() {
+  if (_impl_.value_mapping_ != nullptr) _impl_.value_mapping_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::Mapping& Builtin_GroupedMapReduce::_internal_value_mapping() const {
+  const ::Mapping* p = _impl_.value_mapping_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Mapping&>(
+      ::_Mapping_default_instance_);
+}
+inline const ::Mapping& Builtin_GroupedMapReduce::value_mapping() const {
+  // @@protoc_insertion_point(field_get:Builtin.GroupedMapReduce.value_mapping)
+  return _internal_value_mapping();
+}
+inline void Builtin_GroupedMapReduce::unsafe_arena_set_allocated_value_mapping(
+    ::Mapping* value_mapping) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.value_mapping_);
+  }
+  _impl_.value_mapping_ = value_mapping;
+  if (value_mapping) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Builtin.GroupedMapReduce.value_mapping)
+}
+inline ::Mapping* Builtin_GroupedMapReduce::release_value_mapping() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Mapping* temp = _impl_.value_mapping_;
+  _impl_.value_mapping_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Mapping* Builtin_GroupedMapReduce::unsafe_arena_release_value_mapping() {
+  // @@protoc_insertion_point(field_release:Builtin.GroupedMapReduce.value_mapping)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Mapping* temp = _impl_.value_mapping_;
+  _impl_.value_mapping_ = nullptr;
+  return temp;
+}
+inline ::Mapping* Builtin_GroupedMapReduce::_internal_mutable_value_mapping() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.value_mapping_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Mapping>(GetArenaForAllocation());
+    _impl_.value_mapping_ = p;
+  }
+  return _impl_.value_mapping_;
+}
+inline ::Mapping* Builtin_GroupedMapReduce::mutable_value_mapping() {
+  ::Mapping* _msg = _internal_mutable_value_mapping();
+  // @@protoc_insertion_point(field_mutable:Builtin.GroupedMapReduce.value_mapping)
+  return _msg;
+}
+inline void Builtin_GroupedMapReduce::set_allocated_value_mapping(::Mapping* value_mapping) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.value_mapping_;
+  }
+  if (value_mapping) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(value_mapping);
+    if (message_arena != submessage_arena) {
+      value_mapping = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, value_mapping, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.value_mapping_ = value_mapping;
+  // @@protoc_insertion_point(field_set_allocated:Builtin.GroupedMapReduce.value_mapping)
+}
+
+// required .Reduction reduction = 3;
+inline bool Builtin_GroupedMapReduce::_internal_has_reduction() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.reduction_ != nullptr);
+  return value;
+}
+inline bool Builtin_GroupedMapReduce::has_reduction() const {
+  return _internal_has_reduction();
+}
+inline void Builtin_GroupedMapReduce::clear_reduction() {
+  if (_impl_.reduction_ != nullptr) _impl_.reduction_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::Reduction& Builtin_GroupedMapReduce::_internal_reduction() const {
+  const ::Reduction* p = _impl_.reduction_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Reduction&>(
+      ::_Reduction_default_instance_);
+}
+inline const ::Reduction& Builtin_GroupedMapReduce::reduction() const {
+  // @@protoc_insertion_point(field_get:Builtin.GroupedMapReduce.reduction)
+  return _internal_reduction();
+}
+inline void Builtin_GroupedMapReduce::unsafe_arena_set_allocated_reduction(
+    ::Reduction* reduction) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.reduction_);
+  }
+  _impl_.reduction_ = reduction;
+  if (reduction) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Builtin.GroupedMapReduce.reduction)
+}
+inline ::Reduction* Builtin_GroupedMapReduce::release_reduction() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Reduction* temp = _impl_.reduction_;
+  _impl_.reduction_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Reduction* Builtin_GroupedMapReduce::unsafe_arena_release_reduction() {
+  // @@protoc_insertion_point(field_release:Builtin.GroupedMapReduce.reduction)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Reduction* temp = _impl_.reduction_;
+  _impl_.reduction_ = nullptr;
+  return temp;
+}
+inline ::Reduction* Builtin_GroupedMapReduce::_internal_mutable_reduction() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.reduction_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Reduction>(GetArenaForAllocation());
+    _impl_.reduction_ = p;
+  }
+  return _impl_.reduction_;
+}
+inline ::Reduction* Builtin_GroupedMapReduce::mutable_reduction() {
+  ::Reduction* _msg = _internal_mutable_reduction();
+  // @@protoc_insertion_point(field_mutable:Builtin.GroupedMapReduce.reduction)
+  return _msg;
+}
+inline void Builtin_GroupedMapReduce::set_allocated_reduction(::Reduction* reduction) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.reduction_;
+  }
+  if (reduction) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(reduction);
+    if (message_arena != submessage_arena) {
+      reduction = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, reduction, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.reduction_ = reduction;
+  // @@protoc_insertion_point(field_set_allocated:Builtin.GroupedMapReduce.reduction)
+}
+
+// -------------------------------------------------------------------
+
+// Builtin_Range
+
+// required string attrname = 1;
+inline bool Builtin_Range::_internal_has_attrname() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Builtin_Range::has_attrname() const {
+  return _internal_has_attrname();
+}
+inline void Builtin_Range::clear_attrname() {
+  _impl_.attrname_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Builtin_Range::attrname() const {
+  // @@protoc_insertion_point(field_get:Builtin.Range.attrname)
+  return _internal_attrname();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Builtin_Range::set_attrname(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.attrname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Builtin.Range.attrname)
+}
+inline std::string* Builtin_Range::mutable_attrname() {
+  std::string* _s = _internal_mutable_attrname();
+  // @@protoc_insertion_point(field_mutable:Builtin.Range.attrname)
+  return _s;
+}
+inline const std::string& Builtin_Range::_internal_attrname() const {
+  return _impl_.attrname_.Get();
+}
+inline void Builtin_Range::_internal_set_attrname(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.attrname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Builtin_Range::_internal_mutable_attrname() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.attrname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Builtin_Range::release_attrname() {
+  // @@protoc_insertion_point(field_release:Builtin.Range.attrname)
+  if (!_internal_has_attrname()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.attrname_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.attrname_.IsDefault()) {
+    _impl_.attrname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Builtin_Range::set_allocated_attrname(std::string* attrname) {
+  if (attrname != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.attrname_.SetAllocated(attrname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.attrname_.IsDefault()) {
+    _impl_.attrname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Builtin.Range.attrname)
+}
+
+// optional .Term lowerbound = 2;
+inline bool Builtin_Range::_internal_has_lowerbound() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.lowerbound_ != nullptr);
+  return value;
+}
+inline bool Builtin_Range::has_lowerbound() const {
+  return _internal_has_lowerbound();
+}
+inline void Builtin_Range::clear_lowerbound() {
+  if (_impl_.lowerbound_ != nullptr) _impl_.lowerbound_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::Term& Builtin_Range::_internal_lowerbound() const {
+  const ::Term* p = _impl_.lowerbound_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Term&>(
+      ::_Term_default_instance_);
+}
+inline const ::Term& Builtin_Range::lowerbound() const {
+  // @@protoc_insertion_point(field_get:Builtin.Range.lowerbound)
+  return _internal_lowerbound();
+}
+inline void Builtin_Range::unsafe_arena_set_allocated_lowerbound(
+    ::Term* lowerbound) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.lowerbound_);
+  }
+  _impl_.lowerbound_ = lowerbound;
+  if (lowerbound) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Builtin.Range.lowerbound)
+}
+inline ::Term* Builtin_Range::release_lowerbound() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Term* temp = _impl_.lowerbound_;
+  _impl_.lowerbound_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Term* Builtin_Range::unsafe_arena_release_lowerbound() {
+  // @@protoc_insertion_point(field_release:Builtin.Range.lowerbound)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Term* temp = _impl_.lowerbound_;
+  _impl_.lowerbound_ = nullptr;
+  return temp;
+}
+inline ::Term* Builtin_Range::_internal_mutable_lowerbound() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.lowerbound_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Term>(GetArenaForAllocation());
+    _impl_.lowerbound_ = p;
+  }
+  return _impl_.lowerbound_;
+}
+inline ::Term* Builtin_Range::mutable_lowerbound() {
+  ::Term* _msg = _internal_mutable_lowerbound();
+  // @@protoc_insertion_point(field_mutable:Builtin.Range.lowerbound)
+  return _msg;
+}
+inline void Builtin_Range::set_allocated_lowerbound(::Term* lowerbound) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.lowerbound_;
+  }
+  if (lowerbound) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(lowerbound);
+    if (message_arena != submessage_arena) {
+      lowerbound = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, lowerbound, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.lowerbound_ = lowerbound;
+  // @@protoc_insertion_point(field_set_allocated:Builtin.Range.lowerbound)
+}
+
+// optional .Term upperbound = 3;
+inline bool Builtin_Range::_internal_has_upperbound() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.upperbound_ != nullptr);
+  return value;
+}
+inline bool Builtin_Range::has_upperbound() const {
+  return _internal_has_upperbound();
+}
+inline void Builtin_Range::clear_upperbound() {
+  if (_impl_.upperbound_ != nullptr) _impl_.upperbound_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::Term& Builtin_Range::_internal_upperbound() const {
+  const ::Term* p = _impl_.upperbound_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Term&>(
+      ::_Term_default_instance_);
+}
+inline const ::Term& Builtin_Range::upperbound() const {
+  // @@protoc_insertion_point(field_get:Builtin.Range.upperbound)
+  return _internal_upperbound();
+}
+inline void Builtin_Range::unsafe_arena_set_allocated_upperbound(
+    ::Term* upperbound) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.upperbound_);
+  }
+  _impl_.upperbound_ = upperbound;
+  if (upperbound) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Builtin.Range.upperbound)
+}
+inline ::Term* Builtin_Range::release_upperbound() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Term* temp = _impl_.upperbound_;
+  _impl_.upperbound_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Term* Builtin_Range::unsafe_arena_release_upperbound() {
+  // @@protoc_insertion_point(field_release:Builtin.Range.upperbound)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Term* temp = _impl_.upperbound_;
+  _impl_.upperbound_ = nullptr;
+  return temp;
+}
+inline ::Term* Builtin_Range::_internal_mutable_upperbound() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.upperbound_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Term>(GetArenaForAllocation());
+    _impl_.upperbound_ = p;
+  }
+  return _impl_.upperbound_;
+}
+inline ::Term* Builtin_Range::mutable_upperbound() {
+  ::Term* _msg = _internal_mutable_upperbound();
+  // @@protoc_insertion_point(field_mutable:Builtin.Range.upperbound)
+  return _msg;
+}
+inline void Builtin_Range::set_allocated_upperbound(::Term* upperbound) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.upperbound_;
+  }
+  if (upperbound) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(upperbound);
+    if (message_arena != submessage_arena) {
+      upperbound = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, upperbound, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.upperbound_ = upperbound;
+  // @@protoc_insertion_point(field_set_allocated:Builtin.Range.upperbound)
+}
+
+// -------------------------------------------------------------------
+
+// Builtin
+
+// required .Builtin.BuiltinType type = 1;
+inline bool Builtin::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Builtin::has_type() const {
+  return _internal_has_type();
+}
+inline void Builtin::clear_type() {
+  _impl_.type_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline ::Builtin_BuiltinType Builtin::_internal_type() const {
+  return static_cast< ::Builtin_BuiltinType >(_impl_.type_);
+}
+inline ::Builtin_BuiltinType Builtin::type() const {
+  // @@protoc_insertion_point(field_get:Builtin.type)
+  return _internal_type();
+}
+inline void Builtin::_internal_set_type(::Builtin_BuiltinType value) {
+  assert(::Builtin_BuiltinType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.type_ = value;
+}
+inline void Builtin::set_type(::Builtin_BuiltinType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:Builtin.type)
+}
+
+// optional string attr = 2;
+inline bool Builtin::_internal_has_attr() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Builtin::has_attr() const {
+  return _internal_has_attr();
+}
+inline void Builtin::clear_attr() {
+  _impl_.attr_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Builtin::attr() const {
+  // @@protoc_insertion_point(field_get:Builtin.attr)
+  return _internal_attr();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Builtin::set_attr(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.attr_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Builtin.attr)
+}
+inline std::string* Builtin::mutable_attr() {
+  std::string* _s = _internal_mutable_attr();
+  // @@protoc_insertion_point(field_mutable:Builtin.attr)
+  return _s;
+}
+inline const std::string& Builtin::_internal_attr() const {
+  return _impl_.attr_.Get();
+}
+inline void Builtin::_internal_set_attr(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.attr_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Builtin::_internal_mutable_attr() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.attr_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Builtin::release_attr() {
+  // @@protoc_insertion_point(field_release:Builtin.attr)
+  if (!_internal_has_attr()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.attr_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.attr_.IsDefault()) {
+    _impl_.attr_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Builtin::set_allocated_attr(std::string* attr) {
+  if (attr != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.attr_.SetAllocated(attr, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.attr_.IsDefault()) {
+    _impl_.attr_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Builtin.attr)
+}
+
+// repeated string attrs = 3;
+inline int Builtin::_internal_attrs_size() const {
+  return _impl_.attrs_.size();
+}
+inline int Builtin::attrs_size() const {
+  return _internal_attrs_size();
+}
+inline void Builtin::clear_attrs() {
+  _impl_.attrs_.Clear();
+}
+inline std::string* Builtin::add_attrs() {
+  std::string* _s = _internal_add_attrs();
+  // @@protoc_insertion_point(field_add_mutable:Builtin.attrs)
+  return _s;
+}
+inline const std::string& Builtin::_internal_attrs(int index) const {
+  return _impl_.attrs_.Get(index);
+}
+inline const std::string& Builtin::attrs(int index) const {
+  // @@protoc_insertion_point(field_get:Builtin.attrs)
+  return _internal_attrs(index);
+}
+inline std::string* Builtin::mutable_attrs(int index) {
+  // @@protoc_insertion_point(field_mutable:Builtin.attrs)
+  return _impl_.attrs_.Mutable(index);
+}
+inline void Builtin::set_attrs(int index, const std::string& value) {
+  _impl_.attrs_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:Builtin.attrs)
+}
+inline void Builtin::set_attrs(int index, std::string&& value) {
+  _impl_.attrs_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:Builtin.attrs)
+}
+inline void Builtin::set_attrs(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.attrs_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:Builtin.attrs)
+}
+inline void Builtin::set_attrs(int index, const char* value, size_t size) {
+  _impl_.attrs_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:Builtin.attrs)
+}
+inline std::string* Builtin::_internal_add_attrs() {
+  return _impl_.attrs_.Add();
+}
+inline void Builtin::add_attrs(const std::string& value) {
+  _impl_.attrs_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:Builtin.attrs)
+}
+inline void Builtin::add_attrs(std::string&& value) {
+  _impl_.attrs_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:Builtin.attrs)
+}
+inline void Builtin::add_attrs(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.attrs_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:Builtin.attrs)
+}
+inline void Builtin::add_attrs(const char* value, size_t size) {
+  _impl_.attrs_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:Builtin.attrs)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Builtin::attrs() const {
+  // @@protoc_insertion_point(field_list:Builtin.attrs)
+  return _impl_.attrs_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Builtin::mutable_attrs() {
+  // @@protoc_insertion_point(field_mutable_list:Builtin.attrs)
+  return &_impl_.attrs_;
+}
+
+// optional .Builtin.Comparison comparison = 4;
+inline bool Builtin::_internal_has_comparison() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool Builtin::has_comparison() const {
+  return _internal_has_comparison();
+}
+inline void Builtin::clear_comparison() {
+  _impl_.comparison_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline ::Builtin_Comparison Builtin::_internal_comparison() const {
+  return static_cast< ::Builtin_Comparison >(_impl_.comparison_);
+}
+inline ::Builtin_Comparison Builtin::comparison() const {
+  // @@protoc_insertion_point(field_get:Builtin.comparison)
+  return _internal_comparison();
+}
+inline void Builtin::_internal_set_comparison(::Builtin_Comparison value) {
+  assert(::Builtin_Comparison_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.comparison_ = value;
+}
+inline void Builtin::set_comparison(::Builtin_Comparison value) {
+  _internal_set_comparison(value);
+  // @@protoc_insertion_point(field_set:Builtin.comparison)
+}
+
+// optional .Builtin.Filter filter = 5;
+inline bool Builtin::_internal_has_filter() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.filter_ != nullptr);
+  return value;
+}
+inline bool Builtin::has_filter() const {
+  return _internal_has_filter();
+}
+inline void Builtin::clear_filter() {
+  if (_impl_.filter_ != nullptr) _impl_.filter_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::Builtin_Filter& Builtin::_internal_filter() const {
+  const ::Builtin_Filter* p = _impl_.filter_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Builtin_Filter&>(
+      ::_Builtin_Filter_default_instance_);
+}
+inline const ::Builtin_Filter& Builtin::filter() const {
+  // @@protoc_insertion_point(field_get:Builtin.filter)
+  return _internal_filter();
+}
+inline void Builtin::unsafe_arena_set_allocated_filter(
+    ::Builtin_Filter* filter) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.filter_);
+  }
+  _impl_.filter_ = filter;
+  if (filter) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Builtin.filter)
+}
+inline ::Builtin_Filter* Builtin::release_filter() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Builtin_Filter* temp = _impl_.filter_;
+  _impl_.filter_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Builtin_Filter* Builtin::unsafe_arena_release_filter() {
+  // @@protoc_insertion_point(field_release:Builtin.filter)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Builtin_Filter* temp = _impl_.filter_;
+  _impl_.filter_ = nullptr;
+  return temp;
+}
+inline ::Builtin_Filter* Builtin::_internal_mutable_filter() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.filter_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Builtin_Filter>(GetArenaForAllocation());
+    _impl_.filter_ = p;
+  }
+  return _impl_.filter_;
+}
+inline ::Builtin_Filter* Builtin::mutable_filter() {
+  ::Builtin_Filter* _msg = _internal_mutable_filter();
+  // @@protoc_insertion_point(field_mutable:Builtin.filter)
+  return _msg;
+}
+inline void Builtin::set_allocated_filter(::Builtin_Filter* filter) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.filter_;
+  }
+  if (filter) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(filter);
+    if (message_arena != submessage_arena) {
+      filter = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, filter, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.filter_ = filter;
+  // @@protoc_insertion_point(field_set_allocated:Builtin.filter)
+}
+
+// optional .Builtin.Map map = 6;
+inline bool Builtin::_internal_has_map() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.map_ != nullptr);
+  return value;
+}
+inline bool Builtin::has_map() const {
+  return _internal_has_map();
+}
+inline void Builtin::clear_map() {
+  if (_impl_.map_ != nullptr) _impl_.map_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::Builtin_Map& Builtin::_internal_map() const {
+  const ::Builtin_Map* p = _impl_.map_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Builtin_Map&>(
+      ::_Builtin_Map_default_instance_);
+}
+inline const ::Builtin_Map& Builtin::map() const {
+  // @@protoc_insertion_point(field_get:Builtin.map)
+  return _internal_map();
+}
+inline void Builtin::unsafe_arena_set_allocated_map(
+    ::Builtin_Map* map) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.map_);
+  }
+  _impl_.map_ = map;
+  if (map) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Builtin.map)
+}
+inline ::Builtin_Map* Builtin::release_map() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Builtin_Map* temp = _impl_.map_;
+  _impl_.map_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Builtin_Map* Builtin::unsafe_arena_release_map() {
+  // @@protoc_insertion_point(field_release:Builtin.map)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Builtin_Map* temp = _impl_.map_;
+  _impl_.map_ = nullptr;
+  return temp;
+}
+inline ::Builtin_Map* Builtin::_internal_mutable_map() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.map_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Builtin_Map>(GetArenaForAllocation());
+    _impl_.map_ = p;
+  }
+  return _impl_.map_;
+}
+inline ::Builtin_Map* Builtin::mutable_map() {
+  ::Builtin_Map* _msg = _internal_mutable_map();
+  // @@protoc_insertion_point(field_mutable:Builtin.map)
+  return _msg;
+}
+inline void Builtin::set_allocated_map(::Builtin_Map* map) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.map_;
+  }
+  if (map) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(map);
+    if (message_arena != submessage_arena) {
+      map = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, map, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.map_ = map;
+  // @@protoc_insertion_point(field_set_allocated:Builtin.map)
+}
+
+// optional .Builtin.ConcatMap concat_map = 7;
+inline bool Builtin::_internal_has_concat_map() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.concat_map_ != nullptr);
+  return value;
+}
+inline bool Builtin::has_concat_map() const {
+  return _internal_has_concat_map();
+}
+inline void Builtin::clear_concat_map() {
+  if (_impl_.concat_map_ != nullptr) _impl_.concat_map_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::Builtin_ConcatMap& Builtin::_internal_concat_map() const {
+  const ::Builtin_ConcatMap* p = _impl_.concat_map_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Builtin_ConcatMap&>(
+      ::_Builtin_ConcatMap_default_instance_);
+}
+inline const ::Builtin_ConcatMap& Builtin::concat_map() const {
+  // @@protoc_insertion_point(field_get:Builtin.concat_map)
+  return _internal_concat_map();
+}
+inline void Builtin::unsafe_arena_set_allocated_concat_map(
+    ::Builtin_ConcatMap* concat_map) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.concat_map_);
+  }
+  _impl_.concat_map_ = concat_map;
+  if (concat_map) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Builtin.concat_map)
+}
+inline ::Builtin_ConcatMap* Builtin::release_concat_map() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::Builtin_ConcatMap* temp = _impl_.concat_map_;
+  _impl_.concat_map_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Builtin_ConcatMap* Builtin::unsafe_arena_release_concat_map() {
+  // @@protoc_insertion_point(field_release:Builtin.concat_map)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::Builtin_ConcatMap* temp = _impl_.concat_map_;
+  _impl_.concat_map_ = nullptr;
+  return temp;
+}
+inline ::Builtin_ConcatMap* Builtin::_internal_mutable_concat_map() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.concat_map_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Builtin_ConcatMap>(GetArenaForAllocation());
+    _impl_.concat_map_ = p;
+  }
+  return _impl_.concat_map_;
+}
+inline ::Builtin_ConcatMap* Builtin::mutable_concat_map() {
+  ::Builtin_ConcatMap* _msg = _internal_mutable_concat_map();
+  // @@protoc_insertion_point(field_mutable:Builtin.concat_map)
+  return _msg;
+}
+inline void Builtin::set_allocated_concat_map(::Builtin_ConcatMap* concat_map) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.concat_map_;
+  }
+  if (concat_map) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(concat_map);
+    if (message_arena != submessage_arena) {
+      concat_map = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, concat_map, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.concat_map_ = concat_map;
+  // @@protoc_insertion_point(field_set_allocated:Builtin.concat_map)
+}
+
+// repeated .Builtin.OrderBy order_by = 8;
+inline int Builtin::_internal_order_by_size() const {
+  return _impl_.order_by_.size();
+}
+inline int Builtin::order_by_size() const {
+  return _internal_order_by_size();
+}
+inline void Builtin::clear_order_by() {
+  _impl_.order_by_.Clear();
+}
+inline ::Builtin_OrderBy* Builtin::mutable_order_by(int index) {
+  // @@protoc_insertion_point(field_mutable:Builtin.order_by)
+  return _impl_.order_by_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Builtin_OrderBy >*
+Builtin::mutable_order_by() {
+  // @@protoc_insertion_point(field_mutable_list:Builtin.order_by)
+  return &_impl_.order_by_;
+}
+inline const ::Builtin_OrderBy& Builtin::_internal_order_by(int index) const {
+  return _impl_.order_by_.Get(index);
+}
+inline const ::Builtin_OrderBy& Builtin::order_by(int index) const {
+  // @@protoc_insertion_point(field_get:Builtin.order_by)
+  return _internal_order_by(index);
+}
+inline ::Builtin_OrderBy* Builtin::_internal_add_order_by() {
+  return _impl_.order_by_.Add();
+}
+inline ::Builtin_OrderBy* Builtin::add_order_by() {
+  ::Builtin_OrderBy* _add = _internal_add_order_by();
+  // @@protoc_insertion_point(field_add:Builtin.order_by)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Builtin_OrderBy >&
+Builtin::order_by() const {
+  // @@protoc_insertion_point(field_list:Builtin.order_by)
+  return _impl_.order_by_;
+}
+
+// optional .Reduction reduce = 9;
+inline bool Builtin::_internal_has_reduce() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.reduce_ != nullptr);
+  return value;
+}
+inline bool Builtin::has_reduce() const {
+  return _internal_has_reduce();
+}
+inline void Builtin::clear_reduce() {
+  if (_impl_.reduce_ != nullptr) _impl_.reduce_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::Reduction& Builtin::_internal_reduce() const {
+  const ::Reduction* p = _impl_.reduce_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Reduction&>(
+      ::_Reduction_default_instance_);
+}
+inline const ::Reduction& Builtin::reduce() const {
+  // @@protoc_insertion_point(field_get:Builtin.reduce)
+  return _internal_reduce();
+}
+inline void Builtin::unsafe_arena_set_allocated_reduce(
+    ::Reduction* reduce) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.reduce_);
+  }
+  _impl_.reduce_ = reduce;
+  if (reduce) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Builtin.reduce)
+}
+inline ::Reduction* Builtin::release_reduce() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::Reduction* temp = _impl_.reduce_;
+  _impl_.reduce_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Reduction* Builtin::unsafe_arena_release_reduce() {
+  // @@protoc_insertion_point(field_release:Builtin.reduce)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::Reduction* temp = _impl_.reduce_;
+  _impl_.reduce_ = nullptr;
+  return temp;
+}
+inline ::Reduction* Builtin::_internal_mutable_reduce() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.reduce_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Reduction>(GetArenaForAllocation());
+    _impl_.reduce_ = p;
+  }
+  return _impl_.reduce_;
+}
+inline ::Reduction* Builtin::mutable_reduce() {
+  ::Reduction* _msg = _internal_mutable_reduce();
+  // @@protoc_insertion_point(field_mutable:Builtin.reduce)
+  return _msg;
+}
+inline void Builtin::set_allocated_reduce(::Reduction* reduce) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.reduce_;
+  }
+  if (reduce) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(reduce);
+    if (message_arena != submessage_arena) {
+      reduce = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, reduce, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.reduce_ = reduce;
+  // @@protoc_insertion_point(field_set_allocated:Builtin.reduce)
+}
+
+// optional .Builtin.GroupedMapReduce grouped_map_reduce = 10;
+inline bool Builtin::_internal_has_grouped_map_reduce() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.grouped_map_reduce_ != nullptr);
+  return value;
+}
+inline bool Builtin::has_grouped_map_reduce() const {
+  return _internal_has_grouped_map_reduce();
+}
+inline void Builtin::clear_grouped_map_reduce() {
+  if (_impl_.grouped_map_reduce_ != nullptr) _impl_.grouped_map_reduce_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::Builtin_GroupedMapReduce& Builtin::_internal_grouped_map_reduce() const {
+  const ::Builtin_GroupedMapReduce* p = _impl_.grouped_map_reduce_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Builtin_GroupedMapReduce&>(
+      ::_Builtin_GroupedMapReduce_default_instance_);
+}
+inline const ::Builtin_GroupedMapReduce& Builtin::grouped_map_reduce() const {
+  // @@protoc_insertion_point(field_get:Builtin.grouped_map_reduce)
+  return _internal_grouped_map_reduce();
+}
+inline void Builtin::unsafe_arena_set_allocated_grouped_map_reduce(
+    ::Builtin_GroupedMapReduce* grouped_map_reduce) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.grouped_map_reduce_);
+  }
+  _impl_.grouped_map_reduce_ = grouped_map_reduce;
+  if (grouped_map_reduce) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Builtin.grouped_map_reduce)
+}
+inline ::Builtin_GroupedMapReduce* Builtin::release_grouped_map_reduce() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::Builtin_GroupedMapReduce* temp = _impl_.grouped_map_reduce_;
+  _impl_.grouped_map_reduce_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Builtin_GroupedMapReduce* Builtin::unsafe_arena_release_grouped_map_reduce() {
+  // @@protoc_insertion_point(field_release:Builtin.grouped_map_reduce)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::Builtin_GroupedMapReduce* temp = _impl_.grouped_map_reduce_;
+  _impl_.grouped_map_reduce_ = nullptr;
+  return temp;
+}
+inline ::Builtin_GroupedMapReduce* Builtin::_internal_mutable_grouped_map_reduce() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.grouped_map_reduce_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Builtin_GroupedMapReduce>(GetArenaForAllocation());
+    _impl_.grouped_map_reduce_ = p;
+  }
+  return _impl_.grouped_map_reduce_;
+}
+inline ::Builtin_GroupedMapReduce* Builtin::mutable_grouped_map_reduce() {
+  ::Builtin_GroupedMapReduce* _msg = _internal_mutable_grouped_map_reduce();
+  // @@protoc_insertion_point(field_mutable:Builtin.grouped_map_reduce)
+  return _msg;
+}
+inline void Builtin::set_allocated_grouped_map_reduce(::Builtin_GroupedMapReduce* grouped_map_reduce) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.grouped_map_reduce_;
+  }
+  if (grouped_map_reduce) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(grouped_map_reduce);
+    if (message_arena != submessage_arena) {
+      grouped_map_reduce = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, grouped_map_reduce, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.grouped_map_reduce_ = grouped_map_reduce;
+  // @@protoc_insertion_point(field_set_allocated:Builtin.grouped_map_reduce)
+}
+
+// optional .Builtin.Range range = 11;
+inline bool Builtin::_internal_has_range() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.range_ != nullptr);
+  return value;
+}
+inline bool Builtin::has_range() const {
+  return _internal_has_range();
+}
+inline void Builtin::clear_range() {
+  if (_impl_.range_ != nullptr) _impl_.range_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::Builtin_Range& Builtin::_internal_range() const {
+  const ::Builtin_Range* p = _impl_.range_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Builtin_Range&>(
+      ::_Builtin_Range_default_instance_);
+}
+inline const ::Builtin_Range& Builtin::range() const {
+  // @@protoc_insertion_point(field_get:Builtin.range)
+  return _internal_range();
+}
+inline void Builtin::unsafe_arena_set_allocated_range(
+    ::Builtin_Range* range) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.range_);
+  }
+  _impl_.range_ = range;
+  if (range) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Builtin.range)
+}
+inline ::Builtin_Range* Builtin::release_range() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::Builtin_Range* temp = _impl_.range_;
+  _impl_.range_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Builtin_Range* Builtin::unsafe_arena_release_range() {
+  // @@protoc_insertion_point(field_release:Builtin.range)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::Builtin_Range* temp = _impl_.range_;
+  _impl_.range_ = nullptr;
+  return temp;
+}
+inline ::Builtin_Range* Builtin::_internal_mutable_range() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.range_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Builtin_Range>(GetArenaForAllocation());
+    _impl_.range_ = p;
+  }
+  return _impl_.range_;
+}
+inline ::Builtin_Range* Builtin::mutable_range() {
+  ::Builtin_Range* _msg = _internal_mutable_range();
+  // @@protoc_insertion_point(field_mutable:Builtin.range)
+  return _msg;
+}
+inline void Builtin::set_allocated_range(::Builtin_Range* range) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.range_;
+  }
+  if (range) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(range);
+    if (message_arena != submessage_arena) {
+      range = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, range, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  _impl_.range_ = range;
+  // @@protoc_insertion_point(field_set_allocated:Builtin.range)
+}
+
+// -------------------------------------------------------------------
+
+// Reduction
+
+// required .Term base = 1;
+inline bool Reduction::_internal_has_base() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.base_ != nullptr);
+  return value;
+}
+inline bool Reduction::has_base() const {
+  return _internal_has_base();
+}
+inline void Reduction::clear_base() {
+  if (_impl_.base_ != nullptr) _impl_.base_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::Term& Reduction::_internal_base() const {
+  const ::Term* p = _impl_.base_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Term&>(
+      ::_Term_default_instance_);
+}
+inline const ::Term& Reduction::base() const {
+  // @@protoc_insertion_point(field_get:Reduction.base)
+  return _internal_base();
+}
+inline void Reduction::unsafe_arena_set_allocated_base(
+    ::Term* base) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.base_);
+  }
+  _impl_.base_ = base;
+  if (base) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Reduction.base)
+}
+inline ::Term* Reduction::release_base() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Term* temp = _impl_.base_;
+  _impl_.base_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Term* Reduction::unsafe_arena_release_base() {
+  // @@protoc_insertion_point(field_release:Reduction.base)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Term* temp = _impl_.base_;
+  _impl_.base_ = nullptr;
+  return temp;
+}
+inline ::Term* Reduction::_internal_mutable_base() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.base_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Term>(GetArenaForAllocation());
+    _impl_.base_ = p;
+  }
+  return _impl_.base_;
+}
+inline ::Term* Reduction::mutable_base() {
+  ::Term* _msg = _internal_mutable_base();
+  // @@protoc_insertion_point(field_mutable:Reduction.base)
+  return _msg;
+}
+inline void Reduction::set_allocated_base(::Term* base) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.base_;
+  }
+  if (base) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(base);
+    if (message_arena != submessage_arena) {
+      base = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, base, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.base_ = base;
+  // @@protoc_insertion_point(field_set_allocated:Reduction.base)
+}
+
+// required string var1 = 2;
+inline bool Reduction::_internal_has_var1() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Reduction::has_var1() const {
+  return _internal_has_var1();
+}
+inline void Reduction::clear_var1() {
+  _impl_.var1_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Reduction::var1() const {
+  // @@protoc_insertion_point(field_get:Reduction.var1)
+  return _internal_var1();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Reduction::set_var1(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.var1_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Reduction.var1)
+}
+inline std::string* Reduction::mutable_var1() {
+  std::string* _s = _internal_mutable_var1();
+  // @@protoc_insertion_point(field_mutable:Reduction.var1)
+  return _s;
+}
+inline const std::string& Reduction::_internal_var1() const {
+  return _impl_.var1_.Get();
+}
+inline void Reduction::_internal_set_var1(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.var1_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Reduction::_internal_mutable_var1() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.var1_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Reduction::release_var1() {
+  // @@protoc_insertion_point(field_release:Reduction.var1)
+  if (!_internal_has_var1()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.var1_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.var1_.IsDefault()) {
+    _impl_.var1_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Reduction::set_allocated_var1(std::string* var1) {
+  if (var1 != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.var1_.SetAllocated(var1, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.var1_.IsDefault()) {
+    _impl_.var1_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Reduction.var1)
+}
+
+// required string var2 = 3;
+inline bool Reduction::_internal_has_var2() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Reduction::has_var2() const {
+  return _internal_has_var2();
+}
+inline void Reduction::clear_var2() {
+  _impl_.var2_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Reduction::var2() const {
+  // @@protoc_insertion_point(field_get:Reduction.var2)
+  return _internal_var2();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Reduction::set_var2(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.var2_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Reduction.var2)
+}
+inline std::string* Reduction::mutable_var2() {
+  std::string* _s = _internal_mutable_var2();
+  // @@protoc_insertion_point(field_mutable:Reduction.var2)
+  return _s;
+}
+inline const std::string& Reduction::_internal_var2() const {
+  return _impl_.var2_.Get();
+}
+inline void Reduction::_internal_set_var2(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.var2_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Reduction::_internal_mutable_var2() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.var2_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Reduction::release_var2() {
+  // @@protoc_insertion_point(field_release:Reduction.var2)
+  if (!_internal_has_var2()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.var2_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.var2_.IsDefault()) {
+    _impl_.var2_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Reduction::set_allocated_var2(std::string* var2) {
+  if (var2 != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.var2_.SetAllocated(var2, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.var2_.IsDefault()) {
+    _impl_.var2_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Reduction.var2)
+}
+
+// required .Term body = 4;
+inline bool Reduction::_internal_has_body() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.body_ != nullptr);
+  return value;
+}
+inline bool Reduction::has_body() const {
+  return _internal_has_body();
+}
+inline void Reduction::clear_body() {
+  if (_impl_.body_ != nullptr) _impl_.body_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::Term& Reduction::_internal_body() const {
+  const ::Term* p = _impl_.body_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Term&>(
+      ::_Term_default_instance_);
+}
+inline const ::Term& Reduction::body() const {
+  // @@protoc_insertion_point(field_get:Reduction.body)
+  return _internal_body();
+}
+inline void Reduction::unsafe_arena_set_allocated_body(
+    ::Term* body) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.body_);
+  }
+  _impl_.body_ = body;
+  if (body) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Reduction.body)
+}
+inline ::Term* Reduction::release_body() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::Term* temp = _impl_.body_;
+  _impl_.body_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Term* Reduction::unsafe_arena_release_body() {
+  // @@protoc_insertion_point(field_release:Reduction.body)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::Term* temp = _impl_.body_;
+  _impl_.body_ = nullptr;
+  return temp;
+}
+inline ::Term* Reduction::_internal_mutable_body() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.body_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Term>(GetArenaForAllocation());
+    _impl_.body_ = p;
+  }
+  return _impl_.body_;
+}
+inline ::Term* Reduction::mutable_body() {
+  ::Term* _msg = _internal_mutable_body();
+  // @@protoc_insertion_point(field_mutable:Reduction.body)
+  return _msg;
+}
+inline void Reduction::set_allocated_body(::Term* body) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.body_;
+  }
+  if (body) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(body);
+    if (message_arena != submessage_arena) {
+      body = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, body, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.body_ = body;
+  // @@protoc_insertion_point(field_set_allocated:Reduction.body)
+}
+
+// -------------------------------------------------------------------
+
+// Mapping
+
+// required string arg = 1;
+inline bool Mapping::_internal_has_arg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Mapping::has_arg() const {
+  return _internal_has_arg();
+}
+inline void Mapping::clear_arg() {
+  _impl_.arg_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Mapping::arg() const {
+  // @@protoc_insertion_point(field_get:Mapping.arg)
+  return _internal_arg();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Mapping::set_arg(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.arg_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Mapping.arg)
+}
+inline std::string* Mapping::mutable_arg() {
+  std::string* _s = _internal_mutable_arg();
+  // @@protoc_insertion_point(field_mutable:Mapping.arg)
+  return _s;
+}
+inline const std::string& Mapping::_internal_arg() const {
+  return _impl_.arg_.Get();
+}
+inline void Mapping::_internal_set_arg(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.arg_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Mapping::_internal_mutable_arg() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.arg_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Mapping::release_arg() {
+  // @@protoc_insertion_point(field_release:Mapping.arg)
+  if (!_internal_has_arg()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.arg_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.arg_.IsDefault()) {
+    _impl_.arg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Mapping::set_allocated_arg(std::string* arg) {
+  if (arg != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.arg_.SetAllocated(arg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.arg_.IsDefault()) {
+    _impl_.arg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Mapping.arg)
+}
+
+// required .Term body = 2;
+inline bool Mapping::_internal_has_body() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.body_ != nullptr);
+  return value;
+}
+inline bool Mapping::has_body() const {
+  return _internal_has_body();
+}
+inline void Mapping::clear_body() {
+  if (_impl_.body_ != nullptr) _impl_.body_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::Term& Mapping::_internal_body() const {
+  const ::Term* p = _impl_.body_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Term&>(
+      ::_Term_default_instance_);
+}
+inline const ::Term& Mapping::body() const {
+  // @@protoc_insertion_point(field_get:Mapping.body)
+  return _internal_body();
+}
+inline void Mapping::unsafe_arena_set_allocated_body(
+    ::Term* body) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.body_);
+  }
+  _impl_.body_ = body;
+  if (body) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Mapping.body)
+}
+inline ::Term* Mapping::release_body() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Term* temp = _impl_.body_;
+  _impl_.body_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Term* Mapping::unsafe_arena_release_body() {
+  // @@protoc_insertion_point(field_release:Mapping.body)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Term* temp = _impl_.body_;
+  _impl_.body_ = nullptr;
+  return temp;
+}
+inline ::Term* Mapping::_internal_mutable_body() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.body_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Term>(GetArenaForAllocation());
+    _impl_.body_ = p;
+  }
+  return _impl_.body_;
+}
+inline ::Term* Mapping::mutable_body() {
+  ::Term* _msg = _internal_mutable_body();
+  // @@protoc_insertion_point(field_mutable:Mapping.body)
+  return _msg;
+}
+inline void Mapping::set_allocated_body(::Term* body) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.body_;
+  }
+  if (body) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(body);
+    if (message_arena != submessage_arena) {
+      body = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, body, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.body_ = body;
+  // @@protoc_insertion_point(field_set_allocated:Mapping.body)
+}
+
+// -------------------------------------------------------------------
+
+// Predicate
+
+// required string arg = 1;
+inline bool Predicate::_internal_has_arg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Predicate::has_arg() const {
+  return _internal_has_arg();
+}
+inline void Predicate::clear_arg() {
+  _impl_.arg_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Predicate::arg() const {
+  // @@protoc_insertion_point(field_get:Predicate.arg)
+  return _internal_arg();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Predicate::set_arg(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.arg_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Predicate.arg)
+}
+inline std::string* Predicate::mutable_arg() {
+  std::string* _s = _internal_mutable_arg();
+  // @@protoc_insertion_point(field_mutable:Predicate.arg)
+  return _s;
+}
+inline const std::string& Predicate::_internal_arg() const {
+  return _impl_.arg_.Get();
+}
+inline void Predicate::_internal_set_arg(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.arg_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Predicate::_internal_mutable_arg() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.arg_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Predicate::release_arg() {
+  // @@protoc_insertion_point(field_release:Predicate.arg)
+  if (!_internal_has_arg()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.arg_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.arg_.IsDefault()) {
+    _impl_.arg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Predicate::set_allocated_arg(std::string* arg) {
+  if (arg != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.arg_.SetAllocated(arg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.arg_.IsDefault()) {
+    _impl_.arg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Predicate.arg)
+}
+
+// required .Term body = 2;
+inline bool Predicate::_internal_has_body() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.body_ != nullptr);
+  return value;
+}
+inline bool Predicate::has_body() const {
+  return _internal_has_body();
+}
+inline void Predicate::clear_body() {
+  if (_impl_.body_ != nullptr) _impl_.body_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::Term& Predicate::_internal_body() const {
+  const ::Term* p = _impl_.body_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Term&>(
+      ::_Term_default_instance_);
+}
+inline const ::Term& Predicate::body() const {
+  // @@protoc_insertion_point(field_get:Predicate.body)
+  return _internal_body();
+}
+inline void Predicate::unsafe_arena_set_allocated_body(
+    ::Term* body) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.body_);
+  }
+  _impl_.body_ = body;
+  if (body) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Predicate.body)
+}
+inline ::Term* Predicate::release_body() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Term* temp = _impl_.body_;
+  _impl_.body_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Term* Predicate::unsafe_arena_release_body() {
+  // @@protoc_insertion_point(field_release:Predicate.body)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Term* temp = _impl_.body_;
+  _impl_.body_ = nullptr;
+  return temp;
+}
+inline ::Term* Predicate::_internal_mutable_body() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.body_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Term>(GetArenaForAllocation());
+    _impl_.body_ = p;
+  }
+  return _impl_.body_;
+}
+inline ::Term* Predicate::mutable_body() {
+  ::Term* _msg = _internal_mutable_body();
+  // @@protoc_insertion_point(field_mutable:Predicate.body)
+  return _msg;
+}
+inline void Predicate::set_allocated_body(::Term* body) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.body_;
+  }
+  if (body) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(body);
+    if (message_arena != submessage_arena) {
+      body = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, body, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.body_ = body;
+  // @@protoc_insertion_point(field_set_allocated:Predicate.body)
+}
+
+// -------------------------------------------------------------------
+
+// ReadQuery
+
+// required .Term term = 1;
+inline bool ReadQuery::_internal_has_term() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.term_ != nullptr);
+  return value;
+}
+inline bool ReadQuery::has_term() const {
+  return _internal_has_term();
+}
+inline void ReadQuery::clear_term() {
+  if (_impl_.term_ != nullptr) _impl_.term_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::Term& ReadQuery::_internal_term() const {
+  const ::Term* p = _impl_.term_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Term&>(
+      ::_Term_default_instance_);
+}
+inline const ::Term& ReadQuery::term() const {
+  // @@protoc_insertion_point(field_get:ReadQuery.term)
+  return _internal_term();
+}
+inline void ReadQuery::unsafe_arena_set_allocated_term(
+    ::Term* term) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.term_);
+  }
+  _impl_.term_ = term;
+  if (term) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ReadQuery.term)
+}
+inline ::Term* ReadQuery::release_term() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Term* temp = _impl_.term_;
+  _impl_.term_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Term* ReadQuery::unsafe_arena_release_term() {
+  // @@protoc_insertion_point(field_release:ReadQuery.term)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Term* temp = _impl_.term_;
+  _impl_.term_ = nullptr;
+  return temp;
+}
+inline ::Term* ReadQuery::_internal_mutable_term() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.term_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Term>(GetArenaForAllocation());
+    _impl_.term_ = p;
+  }
+  return _impl_.term_;
+}
+inline ::Term* ReadQuery::mutable_term() {
+  ::Term* _msg = _internal_mutable_term();
+  // @@protoc_insertion_point(field_mutable:ReadQuery.term)
+  return _msg;
+}
+inline void ReadQuery::set_allocated_term(::Term* term) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.term_;
+  }
+  if (term) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(term);
+    if (message_arena != submessage_arena) {
+      term = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, term, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.term_ = term;
+  // @@protoc_insertion_point(field_set_allocated:ReadQuery.term)
+}
+
+// optional int64 max_chunk_size = 2;
+inline bool ReadQuery::_internal_has_max_chunk_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ReadQuery::has_max_chunk_size() const {
+  return _internal_has_max_chunk_size();
+}
+inline void ReadQuery::clear_max_chunk_size() {
+  _impl_.max_chunk_size_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int64_t ReadQuery::_internal_max_chunk_size() const {
+  return _impl_.max_chunk_size_;
+}
+inline int64_t ReadQuery::max_chunk_size() const {
+  // @@protoc_insertion_point(field_get:ReadQuery.max_chunk_size)
+  return _internal_max_chunk_size();
+}
+inline void ReadQuery::_internal_set_max_chunk_size(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.max_chunk_size_ = value;
+}
+inline void ReadQuery::set_max_chunk_size(int64_t value) {
+  _internal_set_max_chunk_size(value);
+  // @@protoc_insertion_point(field_set:ReadQuery.max_chunk_size)
+}
+
+// optional int64 max_age = 3;
+inline bool ReadQuery::_internal_has_max_age() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ReadQuery::has_max_age() const {
+  return _internal_has_max_age();
+}
+inline void ReadQuery::clear_max_age() {
+  _impl_.max_age_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int64_t ReadQuery::_internal_max_age() const {
+  return _impl_.max_age_;
+}
+inline int64_t ReadQuery::max_age() const {
+  // @@protoc_insertion_point(field_get:ReadQuery.max_age)
+  return _internal_max_age();
+}
+inline void ReadQuery::_internal_set_max_age(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.max_age_ = value;
+}
+inline void ReadQuery::set_max_age(int64_t value) {
+  _internal_set_max_age(value);
+  // @@protoc_insertion_point(field_set:ReadQuery.max_age)
+}
+
+// -------------------------------------------------------------------
+
+// WriteQuery_Update
+
+// required .Term view = 1;
+inline bool WriteQuery_Update::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.view_ != nullptr);
+  return value;
+}
+inline bool WriteQuery_Update::has_view() const {
+  return _internal_has_view();
+}
+inline void WriteQuery_Update::clear_view() {
+  if (_impl_.view_ != nullptr) _impl_.view_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::Term& WriteQuery_Update::_internal_view() const {
+  const ::Term* p = _impl_.view_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Term&>(
+      ::_Term_default_instance_);
+}
+inline const ::Term& WriteQuery_Update::view() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.Update.view)
+  return _internal_view();
+}
+inline void WriteQuery_Update::unsafe_arena_set_allocated_view(
+    ::Term* view) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.view_);
+  }
+  _impl_.view_ = view;
+  if (view) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WriteQuery.Update.view)
+}
+inline ::Term* WriteQuery_Update::release_view() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Term* temp = _impl_.view_;
+  _impl_.view_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Term* WriteQuery_Update::unsafe_arena_release_view() {
+  // @@protoc_insertion_point(field_release:WriteQuery.Update.view)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Term* temp = _impl_.view_;
+  _impl_.view_ = nullptr;
+  return temp;
+}
+inline ::Term* WriteQuery_Update::_internal_mutable_view() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.view_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Term>(GetArenaForAllocation());
+    _impl_.view_ = p;
+  }
+  return _impl_.view_;
+}
+inline ::Term* WriteQuery_Update::mutable_view() {
+  ::Term* _msg = _internal_mutable_view();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.Update.view)
+  return _msg;
+}
+inline void WriteQuery_Update::set_allocated_view(::Term* view) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.view_;
+  }
+  if (view) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(view);
+    if (message_arena != submessage_arena) {
+      view = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, view, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.view_ = view;
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.Update.view)
+}
+
+// required .Mapping mapping = 2;
+inline bool WriteQuery_Update::_internal_has_mapping() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.mapping_ != nullptr);
+  return value;
+}
+inline bool WriteQuery_Update::has_mapping() const {
+  return _internal_has_mapping();
+}
+inline void WriteQuery_Update::clear_mapping() {
+  if (_impl_.mapping_ != nullptr) _impl_.mapping_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::Mapping& WriteQuery_Update::_internal_mapping() const {
+  const ::Mapping* p = _impl_.mapping_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Mapping&>(
+      ::_Mapping_default_instance_);
+}
+inline const ::Mapping& WriteQuery_Update::mapping() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.Update.mapping)
+  return _internal_mapping();
+}
+inline void WriteQuery_Update::unsafe_arena_set_allocated_mapping(
+    ::Mapping* mapping) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.mapping_);
+  }
+  _impl_.mapping_ = mapping;
+  if (mapping) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WriteQuery.Update.mapping)
+}
+inline ::Mapping* WriteQuery_Update::release_mapping() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Mapping* temp = _impl_.mapping_;
+  _impl_.mapping_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Mapping* WriteQuery_Update::unsafe_arena_release_mapping() {
+  // @@protoc_insertion_point(field_release:WriteQuery.Update.mapping)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Mapping* temp = _impl_.mapping_;
+  _impl_.mapping_ = nullptr;
+  return temp;
+}
+inline ::Mapping* WriteQuery_Update::_internal_mutable_mapping() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.mapping_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Mapping>(GetArenaForAllocation());
+    _impl_.mapping_ = p;
+  }
+  return _impl_.mapping_;
+}
+inline ::Mapping* WriteQuery_Update::mutable_mapping() {
+  ::Mapping* _msg = _internal_mutable_mapping();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.Update.mapping)
+  return _msg;
+}
+inline void WriteQuery_Update::set_allocated_mapping(::Mapping* mapping) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.mapping_;
+  }
+  if (mapping) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(mapping);
+    if (message_arena != submessage_arena) {
+      mapping = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mapping, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.mapping_ = mapping;
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.Update.mapping)
+}
+
+// -------------------------------------------------------------------
+
+// WriteQuery_Delete
+
+// required .Term view = 1;
+inline bool WriteQuery_Delete::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.view_ != nullptr);
+  return value;
+}
+inline bool WriteQuery_Delete::has_view() const {
+  return _internal_has_view();
+}
+inline void WriteQuery_Delete::clear_view() {
+  if (_impl_.view_ != nullptr) _impl_.view_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::Term& WriteQuery_Delete::_internal_view() const {
+  const ::Term* p = _impl_.view_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Term&>(
+      ::_Term_default_instance_);
+}
+inline const ::Term& WriteQuery_Delete::view() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.Delete.view)
+  return _internal_view();
+}
+inline void WriteQuery_Delete::unsafe_arena_set_allocated_view(
+    ::Term* view) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.view_);
+  }
+  _impl_.view_ = view;
+  if (view) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WriteQuery.Delete.view)
+}
+inline ::Term* WriteQuery_Delete::release_view() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Term* temp = _impl_.view_;
+  _impl_.view_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Term* WriteQuery_Delete::unsafe_arena_release_view() {
+  // @@protoc_insertion_point(field_release:WriteQuery.Delete.view)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Term* temp = _impl_.view_;
+  _impl_.view_ = nullptr;
+  return temp;
+}
+inline ::Term* WriteQuery_Delete::_internal_mutable_view() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.view_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Term>(GetArenaForAllocation());
+    _impl_.view_ = p;
+  }
+  return _impl_.view_;
+}
+inline ::Term* WriteQuery_Delete::mutable_view() {
+  ::Term* _msg = _internal_mutable_view();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.Delete.view)
+  return _msg;
+}
+inline void WriteQuery_Delete::set_allocated_view(::Term* view) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.view_;
+  }
+  if (view) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(view);
+    if (message_arena != submessage_arena) {
+      view = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, view, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.view_ = view;
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.Delete.view)
+}
+
+// -------------------------------------------------------------------
+
+// WriteQuery_Mutate
+
+// required .Term view = 1;
+inline bool WriteQuery_Mutate::_internal_has_view() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.view_ != nullptr);
+  return value;
+}
+inline bool WriteQuery_Mutate::has_view() const {
+  return _internal_has_view();
+}
+inline void WriteQuery_Mutate::clear_view() {
+  if (_impl_.view_ != nullptr) _impl_.view_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::Term& WriteQuery_Mutate::_internal_view() const {
+  const ::Term* p = _impl_.view_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Term&>(
+      ::_Term_default_instance_);
+}
+inline const ::Term& WriteQuery_Mutate::view() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.Mutate.view)
+  return _internal_view();
+}
+inline void WriteQuery_Mutate::unsafe_arena_set_allocated_view(
+    ::Term* view) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.view_);
+  }
+  _impl_.view_ = view;
+  if (view) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WriteQuery.Mutate.view)
+}
+inline ::Term* WriteQuery_Mutate::release_view() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Term* temp = _impl_.view_;
+  _impl_.view_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Term* WriteQuery_Mutate::unsafe_arena_release_view() {
+  // @@protoc_insertion_point(field_release:WriteQuery.Mutate.view)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::Term* temp = _impl_.view_;
+  _impl_.view_ = nullptr;
+  return temp;
+}
+inline ::Term* WriteQuery_Mutate::_internal_mutable_view() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.view_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Term>(GetArenaForAllocation());
+    _impl_.view_ = p;
+  }
+  return _impl_.view_;
+}
+inline ::Term* WriteQuery_Mutate::mutable_view() {
+  ::Term* _msg = _internal_mutable_view();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.Mutate.view)
+  return _msg;
+}
+inline void WriteQuery_Mutate::set_allocated_view(::Term* view) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.view_;
+  }
+  if (view) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(view);
+    if (message_arena != submessage_arena) {
+      view = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, view, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.view_ = view;
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.Mutate.view)
+}
+
+// required .Mapping mapping = 2;
+inline bool WriteQuery_Mutate::_internal_has_mapping() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.mapping_ != nullptr);
+  return value;
+}
+inline bool WriteQuery_Mutate::has_mapping() const {
+  return _internal_has_mapping();
+}
+inline void WriteQuery_Mutate::clear_mapping() {
+  if (_impl_.mapping_ != nullptr) _impl_.mapping_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::Mapping& WriteQuery_Mutate::_internal_mapping() const {
+  const ::Mapping* p = _impl_.mapping_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Mapping&>(
+      ::_Mapping_default_instance_);
+}
+inline const ::Mapping& WriteQuery_Mutate::mapping() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.Mutate.mapping)
+  return _internal_mapping();
+}
+inline void WriteQuery_Mutate::unsafe_arena_set_allocated_mapping(
+    ::Mapping* mapping) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.mapping_);
+  }
+  _impl_.mapping_ = mapping;
+  if (mapping) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WriteQuery.Mutate.mapping)
+}
+inline ::Mapping* WriteQuery_Mutate::release_mapping() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Mapping* temp = _impl_.mapping_;
+  _impl_.mapping_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Mapping* WriteQuery_Mutate::unsafe_arena_release_mapping() {
+  // @@protoc_insertion_point(field_release:WriteQuery.Mutate.mapping)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Mapping* temp = _impl_.mapping_;
+  _impl_.mapping_ = nullptr;
+  return temp;
+}
+inline ::Mapping* WriteQuery_Mutate::_internal_mutable_mapping() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.mapping_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Mapping>(GetArenaForAllocation());
+    _impl_.mapping_ = p;
+  }
+  return _impl_.mapping_;
+}
+inline ::Mapping* WriteQuery_Mutate::mutable_mapping() {
+  ::Mapping* _msg = _internal_mutable_mapping();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.Mutate.mapping)
+  return _msg;
+}
+inline void WriteQuery_Mutate::set_allocated_mapping(::Mapping* mapping) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.mapping_;
+  }
+  if (mapping) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(mapping);
+    if (message_arena != submessage_arena) {
+      mapping = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mapping, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.mapping_ = mapping;
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.Mutate.mapping)
+}
+
+// -------------------------------------------------------------------
+
+// WriteQuery_Insert
+
+// required .TableRef table_ref = 1;
+inline bool WriteQuery_Insert::_internal_has_table_ref() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.table_ref_ != nullptr);
+  return value;
+}
+inline bool WriteQuery_Insert::has_table_ref() const {
+  return _internal_has_table_ref();
+}
+inline void WriteQuery_Insert::clear_table_ref() {
+  if (_impl_.table_ref_ != nullptr) _impl_.table_ref_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::TableRef& WriteQuery_Insert::_internal_table_ref() const {
+  const ::TableRef* p = _impl_.table_ref_;
+  return p != nullptr ? *p : reinterpret_cast<const ::TableRef&>(
+      ::_TableRef_default_instance_);
+}
+inline const ::TableRef& WriteQuery_Insert::table_ref() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.Insert.table_ref)
+  return _internal_table_ref();
+}
+inline void WriteQuery_Insert::unsafe_arena_set_allocated_table_ref(
+    ::TableRef* table_ref) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.table_ref_);
+  }
+  _impl_.table_ref_ = table_ref;
+  if (table_ref) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WriteQuery.Insert.table_ref)
+}
+inline ::TableRef* WriteQuery_Insert::release_table_ref() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::TableRef* temp = _impl_.table_ref_;
+  _impl_.table_ref_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::TableRef* WriteQuery_Insert::unsafe_arena_release_table_ref() {
+  // @@protoc_insertion_point(field_release:WriteQuery.Insert.table_ref)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::TableRef* temp = _impl_.table_ref_;
+  _impl_.table_ref_ = nullptr;
+  return temp;
+}
+inline ::TableRef* WriteQuery_Insert::_internal_mutable_table_ref() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.table_ref_ == nullptr) {
+    auto* p = CreateMaybeMessage<::TableRef>(GetArenaForAllocation());
+    _impl_.table_ref_ = p;
+  }
+  return _impl_.table_ref_;
+}
+inline ::TableRef* WriteQuery_Insert::mutable_table_ref() {
+  ::TableRef* _msg = _internal_mutable_table_ref();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.Insert.table_ref)
+  return _msg;
+}
+inline void WriteQuery_Insert::set_allocated_table_ref(::TableRef* table_ref) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.table_ref_;
+  }
+  if (table_ref) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(table_ref);
+    if (message_arena != submessage_arena) {
+      table_ref = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, table_ref, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.table_ref_ = table_ref;
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.Insert.table_ref)
+}
+
+// repeated .Term terms = 2;
+inline int WriteQuery_Insert::_internal_terms_size() const {
+  return _impl_.terms_.size();
+}
+inline int WriteQuery_Insert::terms_size() const {
+  return _internal_terms_size();
+}
+inline void WriteQuery_Insert::clear_terms() {
+  _impl_.terms_.Clear();
+}
+inline ::Term* WriteQuery_Insert::mutable_terms(int index) {
+  // @@protoc_insertion_point(field_mutable:WriteQuery.Insert.terms)
+  return _impl_.terms_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Term >*
+WriteQuery_Insert::mutable_terms() {
+  // @@protoc_insertion_point(field_mutable_list:WriteQuery.Insert.terms)
+  return &_impl_.terms_;
+}
+inline const ::Term& WriteQuery_Insert::_internal_terms(int index) const {
+  return _impl_.terms_.Get(index);
+}
+inline const ::Term& WriteQuery_Insert::terms(int index) const {
+  // @@protoc_insertion_point(field_get:WriteQuery.Insert.terms)
+  return _internal_terms(index);
+}
+inline ::Term* WriteQuery_Insert::_internal_add_terms() {
+  return _impl_.terms_.Add();
+}
+inline ::Term* WriteQuery_Insert::add_terms() {
+  ::Term* _add = _internal_add_terms();
+  // @@protoc_insertion_point(field_add:WriteQuery.Insert.terms)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Term >&
+WriteQuery_Insert::terms() const {
+  // @@protoc_insertion_point(field_list:WriteQuery.Insert.terms)
+  return _impl_.terms_;
+}
+
+// optional bool overwrite = 3 [default = false];
+inline bool WriteQuery_Insert::_internal_has_overwrite() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool WriteQuery_Insert::has_overwrite() const {
+  return _internal_has_overwrite();
+}
+inline void WriteQuery_Insert::clear_overwrite() {
+  _impl_.overwrite_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool WriteQuery_Insert::_internal_overwrite() const {
+  return _impl_.overwrite_;
+}
+inline bool WriteQuery_Insert::overwrite() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.Insert.overwrite)
+  return _internal_overwrite();
+}
+inline void WriteQuery_Insert::_internal_set_overwrite(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.overwrite_ = value;
+}
+inline void WriteQuery_Insert::set_overwrite(bool value) {
+  _internal_set_overwrite(value);
+  // @@protoc_insertion_point(field_set:WriteQuery.Insert.overwrite)
+}
+
+// -------------------------------------------------------------------
+
+// WriteQuery_ForEach
+
+// required .Term stream = 1;
+inline bool WriteQuery_ForEach::_internal_has_stream() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.stream_ != nullptr);
+  return value;
+}
+inline bool WriteQuery_ForEach::has_stream() const {
+  return _internal_has_stream();
+}
+inline void WriteQuery_ForEach::clear_stream() {
+  if (_impl_.stream_ != nullptr) _impl_.stream_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::Term& WriteQuery_ForEach::_internal_stream() const {
+  const ::Term* p = _impl_.stream_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Term&>(
+      ::_Term_default_instance_);
+}
+inline const ::Term& WriteQuery_ForEach::stream() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.ForEach.stream)
+  return _internal_stream();
+}
+inline void WriteQuery_ForEach::unsafe_arena_set_allocated_stream(
+    ::Term* stream) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stream_);
+  }
+  _impl_.stream_ = stream;
+  if (stream) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WriteQuery.ForEach.stream)
+}
+inline ::Term* WriteQuery_ForEach::release_stream() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Term* temp = _impl_.stream_;
+  _impl_.stream_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Term* WriteQuery_ForEach::unsafe_arena_release_stream() {
+  // @@protoc_insertion_point(field_release:WriteQuery.ForEach.stream)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Term* temp = _impl_.stream_;
+  _impl_.stream_ = nullptr;
+  return temp;
+}
+inline ::Term* WriteQuery_ForEach::_internal_mutable_stream() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.stream_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Term>(GetArenaForAllocation());
+    _impl_.stream_ = p;
+  }
+  return _impl_.stream_;
+}
+inline ::Term* WriteQuery_ForEach::mutable_stream() {
+  ::Term* _msg = _internal_mutable_stream();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.ForEach.stream)
+  return _msg;
+}
+inline void WriteQuery_ForEach::set_allocated_stream(::Term* stream) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.stream_;
+  }
+  if (stream) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stream);
+    if (message_arena != submessage_arena) {
+      stream = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, stream, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.stream_ = stream;
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.ForEach.stream)
+}
+
+// required string var = 2;
+inline bool WriteQuery_ForEach::_internal_has_var() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool WriteQuery_ForEach::has_var() const {
+  return _internal_has_var();
+}
+inline void WriteQuery_ForEach::clear_var() {
+  _impl_.var_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& WriteQuery_ForEach::var() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.ForEach.var)
+  return _internal_var();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WriteQuery_ForEach::set_var(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.var_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:WriteQuery.ForEach.var)
+}
+inline std::string* WriteQuery_ForEach::mutable_var() {
+  std::string* _s = _internal_mutable_var();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.ForEach.var)
+  return _s;
+}
+inline const std::string& WriteQuery_ForEach::_internal_var() const {
+  return _impl_.var_.Get();
+}
+inline void WriteQuery_ForEach::_internal_set_var(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.var_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WriteQuery_ForEach::_internal_mutable_var() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.var_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WriteQuery_ForEach::release_var() {
+  // @@protoc_insertion_point(field_release:WriteQuery.ForEach.var)
+  if (!_internal_has_var()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.var_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.var_.IsDefault()) {
+    _impl_.var_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void WriteQuery_ForEach::set_allocated_var(std::string* var) {
+  if (var != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.var_.SetAllocated(var, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.var_.IsDefault()) {
+    _impl_.var_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.ForEach.var)
+}
+
+// repeated .WriteQuery queries = 3;
+inline int WriteQuery_ForEach::_internal_queries_size() const {
+  return _impl_.queries_.size();
+}
+inline int WriteQuery_ForEach::queries_size() const {
+  return _internal_queries_size();
+}
+inline void WriteQuery_ForEach::clear_queries() {
+  _impl_.queries_.Clear();
+}
+inline ::WriteQuery* WriteQuery_ForEach::mutable_queries(int index) {
+  // @@protoc_insertion_point(field_mutable:WriteQuery.ForEach.queries)
+  return _impl_.queries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::WriteQuery >*
+WriteQuery_ForEach::mutable_queries() {
+  // @@protoc_insertion_point(field_mutable_list:WriteQuery.ForEach.queries)
+  return &_impl_.queries_;
+}
+inline const ::WriteQuery& WriteQuery_ForEach::_internal_queries(int index) const {
+  return _impl_.queries_.Get(index);
+}
+inline const ::WriteQuery& WriteQuery_ForEach::queries(int index) const {
+  // @@protoc_insertion_point(field_get:WriteQuery.ForEach.queries)
+  return _internal_queries(index);
+}
+inline ::WriteQuery* WriteQuery_ForEach::_internal_add_queries() {
+  return _impl_.queries_.Add();
+}
+inline ::WriteQuery* WriteQuery_ForEach::add_queries() {
+  ::WriteQuery* _add = _internal_add_queries();
+  // @@protoc_insertion_point(field_add:WriteQuery.ForEach.queries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::WriteQuery >&
+WriteQuery_ForEach::queries() const {
+  // @@protoc_insertion_point(field_list:WriteQuery.ForEach.queries)
+  return _impl_.queries_;
+}
+
+// -------------------------------------------------------------------
+
+// WriteQuery_PointUpdate
+
+// required .TableRef table_ref = 1;
+inline bool WriteQuery_PointUpdate::_internal_has_table_ref() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.table_ref_ != nullptr);
+  return value;
+}
+inline bool WriteQuery_PointUpdate::has_table_ref() const {
+  return _internal_has_table_ref();
+}
+inline void WriteQuery_PointUpdate::clear_table_ref() {
+  if (_impl_.table_ref_ != nullptr) _impl_.table_ref_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::TableRef& WriteQuery_PointUpdate::_internal_table_ref() const {
+  const ::TableRef* p = _impl_.table_ref_;
+  return p != nullptr ? *p : reinterpret_cast<const ::TableRef&>(
+      ::_TableRef_default_instance_);
+}
+inline const ::TableRef& WriteQuery_PointUpdate::table_ref() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.PointUpdate.table_ref)
+  return _internal_table_ref();
+}
+inline void WriteQuery_PointUpdate::unsafe_arena_set_allocated_table_ref(
+    ::TableRef* table_ref) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.table_ref_);
+  }
+  _impl_.table_ref_ = table_ref;
+  if (table_ref) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WriteQuery.PointUpdate.table_ref)
+}
+inline ::TableRef* WriteQuery_PointUpdate::release_table_ref() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::TableRef* temp = _impl_.table_ref_;
+  _impl_.table_ref_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::TableRef* WriteQuery_PointUpdate::unsafe_arena_release_table_ref() {
+  // @@protoc_insertion_point(field_release:WriteQuery.PointUpdate.table_ref)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::TableRef* temp = _impl_.table_ref_;
+  _impl_.table_ref_ = nullptr;
+  return temp;
+}
+inline ::TableRef* WriteQuery_PointUpdate::_internal_mutable_table_ref() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.table_ref_ == nullptr) {
+    auto* p = CreateMaybeMessage<::TableRef>(GetArenaForAllocation());
+    _impl_.table_ref_ = p;
+  }
+  return _impl_.table_ref_;
+}
+inline ::TableRef* WriteQuery_PointUpdate::mutable_table_ref() {
+  ::TableRef* _msg = _internal_mutable_table_ref();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.PointUpdate.table_ref)
+  return _msg;
+}
+inline void WriteQuery_PointUpdate::set_allocated_table_ref(::TableRef* table_ref) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.table_ref_;
+  }
+  if (table_ref) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(table_ref);
+    if (message_arena != submessage_arena) {
+      table_ref = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, table_ref, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.table_ref_ = table_ref;
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.PointUpdate.table_ref)
+}
+
+// required string attrname = 2;
+inline bool WriteQuery_PointUpdate::_internal_has_attrname() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool WriteQuery_PointUpdate::has_attrname() const {
+  return _internal_has_attrname();
+}
+inline void WriteQuery_PointUpdate::clear_attrname() {
+  _impl_.attrname_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& WriteQuery_PointUpdate::attrname() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.PointUpdate.attrname)
+  return _internal_attrname();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WriteQuery_PointUpdate::set_attrname(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.attrname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:WriteQuery.PointUpdate.attrname)
+}
+inline std::string* WriteQuery_PointUpdate::mutable_attrname() {
+  std::string* _s = _internal_mutable_attrname();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.PointUpdate.attrname)
+  return _s;
+}
+inline const std::string& WriteQuery_PointUpdate::_internal_attrname() const {
+  return _impl_.attrname_.Get();
+}
+inline void WriteQuery_PointUpdate::_internal_set_attrname(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.attrname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WriteQuery_PointUpdate::_internal_mutable_attrname() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.attrname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WriteQuery_PointUpdate::release_attrname() {
+  // @@protoc_insertion_point(field_release:WriteQuery.PointUpdate.attrname)
+  if (!_internal_has_attrname()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.attrname_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.attrname_.IsDefault()) {
+    _impl_.attrname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void WriteQuery_PointUpdate::set_allocated_attrname(std::string* attrname) {
+  if (attrname != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.attrname_.SetAllocated(attrname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.attrname_.IsDefault()) {
+    _impl_.attrname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.PointUpdate.attrname)
+}
+
+// required .Term key = 3;
+inline bool WriteQuery_PointUpdate::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.key_ != nullptr);
+  return value;
+}
+inline bool WriteQuery_PointUpdate::has_key() const {
+  return _internal_has_key();
+}
+inline void WriteQuery_PointUpdate::clear_key() {
+  if (_impl_.key_ != nullptr) _impl_.key_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::Term& WriteQuery_PointUpdate::_internal_key() const {
+  const ::Term* p = _impl_.key_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Term&>(
+      ::_Term_default_instance_);
+}
+inline const ::Term& WriteQuery_PointUpdate::key() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.PointUpdate.key)
+  return _internal_key();
+}
+inline void WriteQuery_PointUpdate::unsafe_arena_set_allocated_key(
+    ::Term* key) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.key_);
+  }
+  _impl_.key_ = key;
+  if (key) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WriteQuery.PointUpdate.key)
+}
+inline ::Term* WriteQuery_PointUpdate::release_key() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Term* temp = _impl_.key_;
+  _impl_.key_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Term* WriteQuery_PointUpdate::unsafe_arena_release_key() {
+  // @@protoc_insertion_point(field_release:WriteQuery.PointUpdate.key)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Term* temp = _impl_.key_;
+  _impl_.key_ = nullptr;
+  return temp;
+}
+inline ::Term* WriteQuery_PointUpdate::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.key_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Term>(GetArenaForAllocation());
+    _impl_.key_ = p;
+  }
+  return _impl_.key_;
+}
+inline ::Term* WriteQuery_PointUpdate::mutable_key() {
+  ::Term* _msg = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.PointUpdate.key)
+  return _msg;
+}
+inline void WriteQuery_PointUpdate::set_allocated_key(::Term* key) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.key_;
+  }
+  if (key) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(key);
+    if (message_arena != submessage_arena) {
+      key = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, key, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.key_ = key;
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.PointUpdate.key)
+}
+
+// required .Mapping mapping = 4;
+inline bool WriteQuery_PointUpdate::_internal_has_mapping() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.mapping_ != nullptr);
+  return value;
+}
+inline bool WriteQuery_PointUpdate::has_mapping() const {
+  return _internal_has_mapping();
+}
+inline void WriteQuery_PointUpdate::clear_mapping() {
+  if (_impl_.mapping_ != nullptr) _impl_.mapping_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::Mapping& WriteQuery_PointUpdate::_internal_mapping() const {
+  const ::Mapping* p = _impl_.mapping_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Mapping&>(
+      ::_Mapping_default_instance_);
+}
+inline const ::Mapping& WriteQuery_PointUpdate::mapping() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.PointUpdate.mapping)
+  return _internal_mapping();
+}
+inline void WriteQuery_PointUpdate::unsafe_arena_set_allocated_mapping(
+    ::Mapping* mapping) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.mapping_);
+  }
+  _impl_.mapping_ = mapping;
+  if (mapping) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WriteQuery.PointUpdate.mapping)
+}
+inline ::Mapping* WriteQuery_PointUpdate::release_mapping() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::Mapping* temp = _impl_.mapping_;
+  _impl_.mapping_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Mapping* WriteQuery_PointUpdate::unsafe_arena_release_mapping() {
+  // @@protoc_insertion_point(field_release:WriteQuery.PointUpdate.mapping)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::Mapping* temp = _impl_.mapping_;
+  _impl_.mapping_ = nullptr;
+  return temp;
+}
+inline ::Mapping* WriteQuery_PointUpdate::_internal_mutable_mapping() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.mapping_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Mapping>(GetArenaForAllocation());
+    _impl_.mapping_ = p;
+  }
+  return _impl_.mapping_;
+}
+inline ::Mapping* WriteQuery_PointUpdate::mutable_mapping() {
+  ::Mapping* _msg = _internal_mutable_mapping();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.PointUpdate.mapping)
+  return _msg;
+}
+inline void WriteQuery_PointUpdate::set_allocated_mapping(::Mapping* mapping) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.mapping_;
+  }
+  if (mapping) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(mapping);
+    if (message_arena != submessage_arena) {
+      mapping = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mapping, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.mapping_ = mapping;
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.PointUpdate.mapping)
+}
+
+// -------------------------------------------------------------------
+
+// WriteQuery_PointDelete
+
+// required .TableRef table_ref = 1;
+inline bool WriteQuery_PointDelete::_internal_has_table_ref() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.table_ref_ != nullptr);
+  return value;
+}
+inline bool WriteQuery_PointDelete::has_table_ref() const {
+  return _internal_has_table_ref();
+}
+inline void WriteQuery_PointDelete::clear_table_ref() {
+  if (_impl_.table_ref_ != nullptr) _impl_.table_ref_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::TableRef& WriteQuery_PointDelete::_internal_table_ref() const {
+  const ::TableRef* p = _impl_.table_ref_;
+  return p != nullptr ? *p : reinterpret_cast<const ::TableRef&>(
+      ::_TableRef_default_instance_);
+}
+inline const ::TableRef& WriteQuery_PointDelete::table_ref() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.PointDelete.table_ref)
+  return _internal_table_ref();
+}
+inline void WriteQuery_PointDelete::unsafe_arena_set_allocated_table_ref(
+    ::TableRef* table_ref) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.table_ref_);
+  }
+  _impl_.table_ref_ = table_ref;
+  if (table_ref) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WriteQuery.PointDelete.table_ref)
+}
+inline ::TableRef* WriteQuery_PointDelete::release_table_ref() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::TableRef* temp = _impl_.table_ref_;
+  _impl_.table_ref_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::TableRef* WriteQuery_PointDelete::unsafe_arena_release_table_ref() {
+  // @@protoc_insertion_point(field_release:WriteQuery.PointDelete.table_ref)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::TableRef* temp = _impl_.table_ref_;
+  _impl_.table_ref_ = nullptr;
+  return temp;
+}
+inline ::TableRef* WriteQuery_PointDelete::_internal_mutable_table_ref() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.table_ref_ == nullptr) {
+    auto* p = CreateMaybeMessage<::TableRef>(GetArenaForAllocation());
+    _impl_.table_ref_ = p;
+  }
+  return _impl_.table_ref_;
+}
+inline ::TableRef* WriteQuery_PointDelete::mutable_table_ref() {
+  ::TableRef* _msg = _internal_mutable_table_ref();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.PointDelete.table_ref)
+  return _msg;
+}
+inline void WriteQuery_PointDelete::set_allocated_table_ref(::TableRef* table_ref) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.table_ref_;
+  }
+  if (table_ref) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(table_ref);
+    if (message_arena != submessage_arena) {
+      table_ref = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, table_ref, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.table_ref_ = table_ref;
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.PointDelete.table_ref)
+}
+
+// required string attrname = 2;
+inline bool WriteQuery_PointDelete::_internal_has_attrname() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool WriteQuery_PointDelete::has_attrname() const {
+  return _internal_has_attrname();
+}
+inline void WriteQuery_PointDelete::clear_attrname() {
+  _impl_.attrname_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& WriteQuery_PointDelete::attrname() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.PointDelete.attrname)
+  return _internal_attrname();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WriteQuery_PointDelete::set_attrname(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.attrname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:WriteQuery.PointDelete.attrname)
+}
+inline std::string* WriteQuery_PointDelete::mutable_attrname() {
+  std::string* _s = _internal_mutable_attrname();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.PointDelete.attrname)
+  return _s;
+}
+inline const std::string& WriteQuery_PointDelete::_internal_attrname() const {
+  return _impl_.attrname_.Get();
+}
+inline void WriteQuery_PointDelete::_internal_set_attrname(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.attrname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WriteQuery_PointDelete::_internal_mutable_attrname() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.attrname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WriteQuery_PointDelete::release_attrname() {
+  // @@protoc_insertion_point(field_release:WriteQuery.PointDelete.attrname)
+  if (!_internal_has_attrname()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.attrname_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.attrname_.IsDefault()) {
+    _impl_.attrname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void WriteQuery_PointDelete::set_allocated_attrname(std::string* attrname) {
+  if (attrname != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.attrname_.SetAllocated(attrname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.attrname_.IsDefault()) {
+    _impl_.attrname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.PointDelete.attrname)
+}
+
+// required .Term key = 3;
+inline bool WriteQuery_PointDelete::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.key_ != nullptr);
+  return value;
+}
+inline bool WriteQuery_PointDelete::has_key() const {
+  return _internal_has_key();
+}
+inline void WriteQuery_PointDelete::clear_key() {
+  if (_impl_.key_ != nullptr) _impl_.key_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::Term& WriteQuery_PointDelete::_internal_key() const {
+  const ::Term* p = _impl_.key_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Term&>(
+      ::_Term_default_instance_);
+}
+inline const ::Term& WriteQuery_PointDelete::key() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.PointDelete.key)
+  return _internal_key();
+}
+inline void WriteQuery_PointDelete::unsafe_arena_set_allocated_key(
+    ::Term* key) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.key_);
+  }
+  _impl_.key_ = key;
+  if (key) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WriteQuery.PointDelete.key)
+}
+inline ::Term* WriteQuery_PointDelete::release_key() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Term* temp = _impl_.key_;
+  _impl_.key_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Term* WriteQuery_PointDelete::unsafe_arena_release_key() {
+  // @@protoc_insertion_point(field_release:WriteQuery.PointDelete.key)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Term* temp = _impl_.key_;
+  _impl_.key_ = nullptr;
+  return temp;
+}
+inline ::Term* WriteQuery_PointDelete::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.key_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Term>(GetArenaForAllocation());
+    _impl_.key_ = p;
+  }
+  return _impl_.key_;
+}
+inline ::Term* WriteQuery_PointDelete::mutable_key() {
+  ::Term* _msg = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.PointDelete.key)
+  return _msg;
+}
+inline void WriteQuery_PointDelete::set_allocated_key(::Term* key) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.key_;
+  }
+  if (key) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(key);
+    if (message_arena != submessage_arena) {
+      key = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, key, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.key_ = key;
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.PointDelete.key)
+}
+
+// -------------------------------------------------------------------
+
+// WriteQuery_PointMutate
+
+// required .TableRef table_ref = 1;
+inline bool WriteQuery_PointMutate::_internal_has_table_ref() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.table_ref_ != nullptr);
+  return value;
+}
+inline bool WriteQuery_PointMutate::has_table_ref() const {
+  return _internal_has_table_ref();
+}
+inline void WriteQuery_PointMutate::clear_table_ref() {
+  if (_impl_.table_ref_ != nullptr) _impl_.table_ref_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::TableRef& WriteQuery_PointMutate::_internal_table_ref() const {
+  const ::TableRef* p = _impl_.table_ref_;
+  return p != nullptr ? *p : reinterpret_cast<const ::TableRef&>(
+      ::_TableRef_default_instance_);
+}
+inline const ::TableRef& WriteQuery_PointMutate::table_ref() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.PointMutate.table_ref)
+  return _internal_table_ref();
+}
+inline void WriteQuery_PointMutate::unsafe_arena_set_allocated_table_ref(
+    ::TableRef* table_ref) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.table_ref_);
+  }
+  _impl_.table_ref_ = table_ref;
+  if (table_ref) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WriteQuery.PointMutate.table_ref)
+}
+inline ::TableRef* WriteQuery_PointMutate::release_table_ref() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::TableRef* temp = _impl_.table_ref_;
+  _impl_.table_ref_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::TableRef* WriteQuery_PointMutate::unsafe_arena_release_table_ref() {
+  // @@protoc_insertion_point(field_release:WriteQuery.PointMutate.table_ref)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::TableRef* temp = _impl_.table_ref_;
+  _impl_.table_ref_ = nullptr;
+  return temp;
+}
+inline ::TableRef* WriteQuery_PointMutate::_internal_mutable_table_ref() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.table_ref_ == nullptr) {
+    auto* p = CreateMaybeMessage<::TableRef>(GetArenaForAllocation());
+    _impl_.table_ref_ = p;
+  }
+  return _impl_.table_ref_;
+}
+inline ::TableRef* WriteQuery_PointMutate::mutable_table_ref() {
+  ::TableRef* _msg = _internal_mutable_table_ref();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.PointMutate.table_ref)
+  return _msg;
+}
+inline void WriteQuery_PointMutate::set_allocated_table_ref(::TableRef* table_ref) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.table_ref_;
+  }
+  if (table_ref) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(table_ref);
+    if (message_arena != submessage_arena) {
+      table_ref = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, table_ref, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.table_ref_ = table_ref;
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.PointMutate.table_ref)
+}
+
+// required string attrname = 2;
+inline bool WriteQuery_PointMutate::_internal_has_attrname() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool WriteQuery_PointMutate::has_attrname() const {
+  return _internal_has_attrname();
+}
+inline void WriteQuery_PointMutate::clear_attrname() {
+  _impl_.attrname_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& WriteQuery_PointMutate::attrname() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.PointMutate.attrname)
+  return _internal_attrname();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WriteQuery_PointMutate::set_attrname(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.attrname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:WriteQuery.PointMutate.attrname)
+}
+inline std::string* WriteQuery_PointMutate::mutable_attrname() {
+  std::string* _s = _internal_mutable_attrname();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.PointMutate.attrname)
+  return _s;
+}
+inline const std::string& WriteQuery_PointMutate::_internal_attrname() const {
+  return _impl_.attrname_.Get();
+}
+inline void WriteQuery_PointMutate::_internal_set_attrname(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.attrname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WriteQuery_PointMutate::_internal_mutable_attrname() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.attrname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WriteQuery_PointMutate::release_attrname() {
+  // @@protoc_insertion_point(field_release:WriteQuery.PointMutate.attrname)
+  if (!_internal_has_attrname()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.attrname_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.attrname_.IsDefault()) {
+    _impl_.attrname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void WriteQuery_PointMutate::set_allocated_attrname(std::string* attrname) {
+  if (attrname != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.attrname_.SetAllocated(attrname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.attrname_.IsDefault()) {
+    _impl_.attrname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.PointMutate.attrname)
+}
+
+// required .Term key = 3;
+inline bool WriteQuery_PointMutate::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.key_ != nullptr);
+  return value;
+}
+inline bool WriteQuery_PointMutate::has_key() const {
+  return _internal_has_key();
+}
+inline void WriteQuery_PointMutate::clear_key() {
+  if (_impl_.key_ != nullptr) _impl_.key_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::Term& WriteQuery_PointMutate::_internal_key() const {
+  const ::Term* p = _impl_.key_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Term&>(
+      ::_Term_default_instance_);
+}
+inline const ::Term& WriteQuery_PointMutate::key() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.PointMutate.key)
+  return _internal_key();
+}
+inline void WriteQuery_PointMutate::unsafe_arena_set_allocated_key(
+    ::Term* key) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.key_);
+  }
+  _impl_.key_ = key;
+  if (key) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WriteQuery.PointMutate.key)
+}
+inline ::Term* WriteQuery_PointMutate::release_key() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Term* temp = _impl_.key_;
+  _impl_.key_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Term* WriteQuery_PointMutate::unsafe_arena_release_key() {
+  // @@protoc_insertion_point(field_release:WriteQuery.PointMutate.key)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::Term* temp = _impl_.key_;
+  _impl_.key_ = nullptr;
+  return temp;
+}
+inline ::Term* WriteQuery_PointMutate::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.key_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Term>(GetArenaForAllocation());
+    _impl_.key_ = p;
+  }
+  return _impl_.key_;
+}
+inline ::Term* WriteQuery_PointMutate::mutable_key() {
+  ::Term* _msg = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.PointMutate.key)
+  return _msg;
+}
+inline void WriteQuery_PointMutate::set_allocated_key(::Term* key) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.key_;
+  }
+  if (key) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(key);
+    if (message_arena != submessage_arena) {
+      key = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, key, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.key_ = key;
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.PointMutate.key)
+}
+
+// required .Mapping mapping = 4;
+inline bool WriteQuery_PointMutate::_internal_has_mapping() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.mapping_ != nullptr);
+  return value;
+}
+inline bool WriteQuery_PointMutate::has_mapping() const {
+  return _internal_has_mapping();
+}
+inline void WriteQuery_PointMutate::clear_mapping() {
+  if (_impl_.mapping_ != nullptr) _impl_.mapping_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::Mapping& WriteQuery_PointMutate::_internal_mapping() const {
+  const ::Mapping* p = _impl_.mapping_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Mapping&>(
+      ::_Mapping_default_instance_);
+}
+inline const ::Mapping& WriteQuery_PointMutate::mapping() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.PointMutate.mapping)
+  return _internal_mapping();
+}
+inline void WriteQuery_PointMutate::unsafe_arena_set_allocated_mapping(
+    ::Mapping* mapping) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.mapping_);
+  }
+  _impl_.mapping_ = mapping;
+  if (mapping) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WriteQuery.PointMutate.mapping)
+}
+inline ::Mapping* WriteQuery_PointMutate::release_mapping() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::Mapping* temp = _impl_.mapping_;
+  _impl_.mapping_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Mapping* WriteQuery_PointMutate::unsafe_arena_release_mapping() {
+  // @@protoc_insertion_point(field_release:WriteQuery.PointMutate.mapping)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::Mapping* temp = _impl_.mapping_;
+  _impl_.mapping_ = nullptr;
+  return temp;
+}
+inline ::Mapping* WriteQuery_PointMutate::_internal_mutable_mapping() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.mapping_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Mapping>(GetArenaForAllocation());
+    _impl_.mapping_ = p;
+  }
+  return _impl_.mapping_;
+}
+inline ::Mapping* WriteQuery_PointMutate::mutable_mapping() {
+  ::Mapping* _msg = _internal_mutable_mapping();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.PointMutate.mapping)
+  return _msg;
+}
+inline void WriteQuery_PointMutate::set_allocated_mapping(::Mapping* mapping) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.mapping_;
+  }
+  if (mapping) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(mapping);
+    if (message_arena != submessage_arena) {
+      mapping = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mapping, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.mapping_ = mapping;
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.PointMutate.mapping)
+}
+
+// -------------------------------------------------------------------
+
+// WriteQuery
+
+// required .WriteQuery.WriteQueryType type = 1;
+inline bool WriteQuery::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool WriteQuery::has_type() const {
+  return _internal_has_type();
+}
+inline void WriteQuery::clear_type() {
+  _impl_.type_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline ::WriteQuery_WriteQueryType WriteQuery::_internal_type() const {
+  return static_cast< ::WriteQuery_WriteQueryType >(_impl_.type_);
+}
+inline ::WriteQuery_WriteQueryType WriteQuery::type() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.type)
+  return _internal_type();
+}
+inline void WriteQuery::_internal_set_type(::WriteQuery_WriteQueryType value) {
+  assert(::WriteQuery_WriteQueryType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.type_ = value;
+}
+inline void WriteQuery::set_type(::WriteQuery_WriteQueryType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:WriteQuery.type)
+}
+
+// optional bool atomic = 11 [default = true];
+inline bool WriteQuery::_internal_has_atomic() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool WriteQuery::has_atomic() const {
+  return _internal_has_atomic();
+}
+inline void WriteQuery::clear_atomic() {
+  _impl_.atomic_ = true;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline bool WriteQuery::_internal_atomic() const {
+  return _impl_.atomic_;
+}
+inline bool WriteQuery::atomic() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.atomic)
+  return _internal_atomic();
+}
+inline void WriteQuery::_internal_set_atomic(bool value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.atomic_ = value;
+}
+inline void WriteQuery::set_atomic(bool value) {
+  _internal_set_atomic(value);
+  // @@protoc_insertion_point(field_set:WriteQuery.atomic)
+}
+
+// optional .WriteQuery.Update update = 2;
+inline bool WriteQuery::_internal_has_update() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.update_ != nullptr);
+  return value;
+}
+inline bool WriteQuery::has_update() const {
+  return _internal_has_update();
+}
+inline void WriteQuery::clear_update() {
+  if (_impl_.update_ != nullptr) _impl_.update_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::WriteQuery_Update& WriteQuery::_internal_update() const {
+  const ::WriteQuery_Update* p = _impl_.update_;
+  return p != nullptr ? *p : reinterpret_cast<const ::WriteQuery_Update&>(
+      ::_WriteQuery_Update_default_instance_);
+}
+inline const ::WriteQuery_Update& WriteQuery::update() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.update)
+  return _internal_update();
+}
+inline void WriteQuery::unsafe_arena_set_allocated_update(
+    ::WriteQuery_Update* update) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.update_);
+  }
+  _impl_.update_ = update;
+  if (update) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WriteQuery.update)
+}
+inline ::WriteQuery_Update* WriteQuery::release_update() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::WriteQuery_Update* temp = _impl_.update_;
+  _impl_.update_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::WriteQuery_Update* WriteQuery::unsafe_arena_release_update() {
+  // @@protoc_insertion_point(field_release:WriteQuery.update)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::WriteQuery_Update* temp = _impl_.update_;
+  _impl_.update_ = nullptr;
+  return temp;
+}
+inline ::WriteQuery_Update* WriteQuery::_internal_mutable_update() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.update_ == nullptr) {
+    auto* p = CreateMaybeMessage<::WriteQuery_Update>(GetArenaForAllocation());
+    _impl_.update_ = p;
+  }
+  return _impl_.update_;
+}
+inline ::WriteQuery_Update* WriteQuery::mutable_update() {
+  ::WriteQuery_Update* _msg = _internal_mutable_update();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.update)
+  return _msg;
+}
+inline void WriteQuery::set_allocated_update(::WriteQuery_Update* update) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.update_;
+  }
+  if (update) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(update);
+    if (message_arena != submessage_arena) {
+      update = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, update, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.update_ = update;
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.update)
+}
+
+// optional .WriteQuery.Delete delete = 3;
+inline bool WriteQuery::_internal_has_delete_() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.delete__ != nullptr);
+  return value;
+}
+inline bool WriteQuery::has_delete_() const {
+  return _internal_has_delete_();
+}
+inline void WriteQuery::clear_delete_() {
+  if (_impl_.delete__ != nullptr) _impl_.delete__->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::WriteQuery_Delete& WriteQuery::_internal_delete_() const {
+  const ::WriteQuery_Delete* p = _impl_.delete__;
+  return p != nullptr ? *p : reinterpret_cast<const ::WriteQuery_Delete&>(
+      ::_WriteQuery_Delete_default_instance_);
+}
+inline const ::WriteQuery_Delete& WriteQuery::delete_() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.delete)
+  return _internal_delete_();
+}
+inline void WriteQuery::unsafe_arena_set_allocated_delete_(
+    ::WriteQuery_Delete* delete_) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.delete__);
+  }
+  _impl_.delete__ = delete_;
+  if (delete_) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WriteQuery.delete)
+}
+inline ::WriteQuery_Delete* WriteQuery::release_delete_() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::WriteQuery_Delete* temp = _impl_.delete__;
+  _impl_.delete__ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::WriteQuery_Delete* WriteQuery::unsafe_arena_release_delete_() {
+  // @@protoc_insertion_point(field_release:WriteQuery.delete)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::WriteQuery_Delete* temp = _impl_.delete__;
+  _impl_.delete__ = nullptr;
+  return temp;
+}
+inline ::WriteQuery_Delete* WriteQuery::_internal_mutable_delete_() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.delete__ == nullptr) {
+    auto* p = CreateMaybeMessage<::WriteQuery_Delete>(GetArenaForAllocation());
+    _impl_.delete__ = p;
+  }
+  return _impl_.delete__;
+}
+inline ::WriteQuery_Delete* WriteQuery::mutable_delete_() {
+  ::WriteQuery_Delete* _msg = _internal_mutable_delete_();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.delete)
+  return _msg;
+}
+inline void WriteQuery::set_allocated_delete_(::WriteQuery_Delete* delete_) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.delete__;
+  }
+  if (delete_) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(delete_);
+    if (message_arena != submessage_arena) {
+      delete_ = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, delete_, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.delete__ = delete_;
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.delete)
+}
+
+// optional .WriteQuery.Mutate mutate = 4;
+inline bool WriteQuery::_internal_has_mutate() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.mutate_ != nullptr);
+  return value;
+}
+inline bool WriteQuery::has_mutate() const {
+  return _internal_has_mutate();
+}
+inline void WriteQuery::clear_mutate() {
+  if (_impl_.mutate_ != nullptr) _impl_.mutate_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::WriteQuery_Mutate& WriteQuery::_internal_mutate() const {
+  const ::WriteQuery_Mutate* p = _impl_.mutate_;
+  return p != nullptr ? *p : reinterpret_cast<const ::WriteQuery_Mutate&>(
+      ::_WriteQuery_Mutate_default_instance_);
+}
+inline const ::WriteQuery_Mutate& WriteQuery::mutate() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.mutate)
+  return _internal_mutate();
+}
+inline void WriteQuery::unsafe_arena_set_allocated_mutate(
+    ::WriteQuery_Mutate* mutate) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.mutate_);
+  }
+  _impl_.mutate_ = mutate;
+  if (mutate) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WriteQuery.mutate)
+}
+inline ::WriteQuery_Mutate* WriteQuery::release_mutate() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::WriteQuery_Mutate* temp = _impl_.mutate_;
+  _impl_.mutate_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::WriteQuery_Mutate* WriteQuery::unsafe_arena_release_mutate() {
+  // @@protoc_insertion_point(field_release:WriteQuery.mutate)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::WriteQuery_Mutate* temp = _impl_.mutate_;
+  _impl_.mutate_ = nullptr;
+  return temp;
+}
+inline ::WriteQuery_Mutate* WriteQuery::_internal_mutable_mutate() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.mutate_ == nullptr) {
+    auto* p = CreateMaybeMessage<::WriteQuery_Mutate>(GetArenaForAllocation());
+    _impl_.mutate_ = p;
+  }
+  return _impl_.mutate_;
+}
+inline ::WriteQuery_Mutate* WriteQuery::mutable_mutate() {
+  ::WriteQuery_Mutate* _msg = _internal_mutable_mutate();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.mutate)
+  return _msg;
+}
+inline void WriteQuery::set_allocated_mutate(::WriteQuery_Mutate* mutate) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.mutate_;
+  }
+  if (mutate) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(mutate);
+    if (message_arena != submessage_arena) {
+      mutate = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mutate, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.mutate_ = mutate;
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.mutate)
+}
+
+// optional .WriteQuery.Insert insert = 5;
+inline bool WriteQuery::_internal_has_insert() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.insert_ != nullptr);
+  return value;
+}
+inline bool WriteQuery::has_insert() const {
+  return _internal_has_insert();
+}
+inline void WriteQuery::clear_insert() {
+  if (_impl_.insert_ != nullptr) _impl_.insert_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::WriteQuery_Insert& WriteQuery::_internal_insert() const {
+  const ::WriteQuery_Insert* p = _impl_.insert_;
+  return p != nullptr ? *p : reinterpret_cast<const ::WriteQuery_Insert&>(
+      ::_WriteQuery_Insert_default_instance_);
+}
+inline const ::WriteQuery_Insert& WriteQuery::insert() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.insert)
+  return _internal_insert();
+}
+inline void WriteQuery::unsafe_arena_set_allocated_insert(
+    ::WriteQuery_Insert* insert) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.insert_);
+  }
+  _impl_.insert_ = insert;
+  if (insert) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WriteQuery.insert)
+}
+inline ::WriteQuery_Insert* WriteQuery::release_insert() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::WriteQuery_Insert* temp = _impl_.insert_;
+  _impl_.insert_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::WriteQuery_Insert* WriteQuery::unsafe_arena_release_insert() {
+  // @@protoc_insertion_point(field_release:WriteQuery.insert)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::WriteQuery_Insert* temp = _impl_.insert_;
+  _impl_.insert_ = nullptr;
+  return temp;
+}
+inline ::WriteQuery_Insert* WriteQuery::_internal_mutable_insert() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.insert_ == nullptr) {
+    auto* p = CreateMaybeMessage<::WriteQuery_Insert>(GetArenaForAllocation());
+    _impl_.insert_ = p;
+  }
+  return _impl_.insert_;
+}
+inline ::WriteQuery_Insert* WriteQuery::mutable_insert() {
+  ::WriteQuery_Insert* _msg = _internal_mutable_insert();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.insert)
+  return _msg;
+}
+inline void WriteQuery::set_allocated_insert(::WriteQuery_Insert* insert) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.insert_;
+  }
+  if (insert) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(insert);
+    if (message_arena != submessage_arena) {
+      insert = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, insert, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.insert_ = insert;
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.insert)
+}
+
+// optional .WriteQuery.ForEach for_each = 7;
+inline bool WriteQuery::_internal_has_for_each() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.for_each_ != nullptr);
+  return value;
+}
+inline bool WriteQuery::has_for_each() const {
+  return _internal_has_for_each();
+}
+inline void WriteQuery::clear_for_each() {
+  if (_impl_.for_each_ != nullptr) _impl_.for_each_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::WriteQuery_ForEach& WriteQuery::_internal_for_each() const {
+  const ::WriteQuery_ForEach* p = _impl_.for_each_;
+  return p != nullptr ? *p : reinterpret_cast<const ::WriteQuery_ForEach&>(
+      ::_WriteQuery_ForEach_default_instance_);
+}
+inline const ::WriteQuery_ForEach& WriteQuery::for_each() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.for_each)
+  return _internal_for_each();
+}
+inline void WriteQuery::unsafe_arena_set_allocated_for_each(
+    ::WriteQuery_ForEach* for_each) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.for_each_);
+  }
+  _impl_.for_each_ = for_each;
+  if (for_each) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WriteQuery.for_each)
+}
+inline ::WriteQuery_ForEach* WriteQuery::release_for_each() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::WriteQuery_ForEach* temp = _impl_.for_each_;
+  _impl_.for_each_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::WriteQuery_ForEach* WriteQuery::unsafe_arena_release_for_each() {
+  // @@protoc_insertion_point(field_release:WriteQuery.for_each)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::WriteQuery_ForEach* temp = _impl_.for_each_;
+  _impl_.for_each_ = nullptr;
+  return temp;
+}
+inline ::WriteQuery_ForEach* WriteQuery::_internal_mutable_for_each() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.for_each_ == nullptr) {
+    auto* p = CreateMaybeMessage<::WriteQuery_ForEach>(GetArenaForAllocation());
+    _impl_.for_each_ = p;
+  }
+  return _impl_.for_each_;
+}
+inline ::WriteQuery_ForEach* WriteQuery::mutable_for_each() {
+  ::WriteQuery_ForEach* _msg = _internal_mutable_for_each();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.for_each)
+  return _msg;
+}
+inline void WriteQuery::set_allocated_for_each(::WriteQuery_ForEach* for_each) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.for_each_;
+  }
+  if (for_each) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(for_each);
+    if (message_arena != submessage_arena) {
+      for_each = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, for_each, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.for_each_ = for_each;
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.for_each)
+}
+
+// optional .WriteQuery.PointUpdate point_update = 8;
+inline bool WriteQuery::_internal_has_point_update() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.point_update_ != nullptr);
+  return value;
+}
+inline bool WriteQuery::has_point_update() const {
+  return _internal_has_point_update();
+}
+inline void WriteQuery::clear_point_update() {
+  if (_impl_.point_update_ != nullptr) _impl_.point_update_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::WriteQuery_PointUpdate& WriteQuery::_internal_point_update() const {
+  const ::WriteQuery_PointUpdate* p = _impl_.point_update_;
+  return p != nullptr ? *p : reinterpret_cast<const ::WriteQuery_PointUpdate&>(
+      ::_WriteQuery_PointUpdate_default_instance_);
+}
+inline const ::WriteQuery_PointUpdate& WriteQuery::point_update() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.point_update)
+  return _internal_point_update();
+}
+inline void WriteQuery::unsafe_arena_set_allocated_point_update(
+    ::WriteQuery_PointUpdate* point_update) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.point_update_);
+  }
+  _impl_.point_update_ = point_update;
+  if (point_update) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WriteQuery.point_update)
+}
+inline ::WriteQuery_PointUpdate* WriteQuery::release_point_update() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::WriteQuery_PointUpdate* temp = _impl_.point_update_;
+  _impl_.point_update_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::WriteQuery_PointUpdate* WriteQuery::unsafe_arena_release_point_update() {
+  // @@protoc_insertion_point(field_release:WriteQuery.point_update)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::WriteQuery_PointUpdate* temp = _impl_.point_update_;
+  _impl_.point_update_ = nullptr;
+  return temp;
+}
+inline ::WriteQuery_PointUpdate* WriteQuery::_internal_mutable_point_update() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.point_update_ == nullptr) {
+    auto* p = CreateMaybeMessage<::WriteQuery_PointUpdate>(GetArenaForAllocation());
+    _impl_.point_update_ = p;
+  }
+  return _impl_.point_update_;
+}
+inline ::WriteQuery_PointUpdate* WriteQuery::mutable_point_update() {
+  ::WriteQuery_PointUpdate* _msg = _internal_mutable_point_update();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.point_update)
+  return _msg;
+}
+inline void WriteQuery::set_allocated_point_update(::WriteQuery_PointUpdate* point_update) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.point_update_;
+  }
+  if (point_update) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(point_update);
+    if (message_arena != submessage_arena) {
+      point_update = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, point_update, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.point_update_ = point_update;
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.point_update)
+}
+
+// optional .WriteQuery.PointDelete point_delete = 9;
+inline bool WriteQuery::_internal_has_point_delete() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.point_delete_ != nullptr);
+  return value;
+}
+inline bool WriteQuery::has_point_delete() const {
+  return _internal_has_point_delete();
+}
+inline void WriteQuery::clear_point_delete() {
+  if (_impl_.point_delete_ != nullptr) _impl_.point_delete_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::WriteQuery_PointDelete& WriteQuery::_internal_point_delete() const {
+  const ::WriteQuery_PointDelete* p = _impl_.point_delete_;
+  return p != nullptr ? *p : reinterpret_cast<const ::WriteQuery_PointDelete&>(
+      ::_WriteQuery_PointDelete_default_instance_);
+}
+inline const ::WriteQuery_PointDelete& WriteQuery::point_delete() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.point_delete)
+  return _internal_point_delete();
+}
+inline void WriteQuery::unsafe_arena_set_allocated_point_delete(
+    ::WriteQuery_PointDelete* point_delete) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.point_delete_);
+  }
+  _impl_.point_delete_ = point_delete;
+  if (point_delete) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WriteQuery.point_delete)
+}
+inline ::WriteQuery_PointDelete* WriteQuery::release_point_delete() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::WriteQuery_PointDelete* temp = _impl_.point_delete_;
+  _impl_.point_delete_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::WriteQuery_PointDelete* WriteQuery::unsafe_arena_release_point_delete() {
+  // @@protoc_insertion_point(field_release:WriteQuery.point_delete)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::WriteQuery_PointDelete* temp = _impl_.point_delete_;
+  _impl_.point_delete_ = nullptr;
+  return temp;
+}
+inline ::WriteQuery_PointDelete* WriteQuery::_internal_mutable_point_delete() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.point_delete_ == nullptr) {
+    auto* p = CreateMaybeMessage<::WriteQuery_PointDelete>(GetArenaForAllocation());
+    _impl_.point_delete_ = p;
+  }
+  return _impl_.point_delete_;
+}
+inline ::WriteQuery_PointDelete* WriteQuery::mutable_point_delete() {
+  ::WriteQuery_PointDelete* _msg = _internal_mutable_point_delete();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.point_delete)
+  return _msg;
+}
+inline void WriteQuery::set_allocated_point_delete(::WriteQuery_PointDelete* point_delete) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.point_delete_;
+  }
+  if (point_delete) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(point_delete);
+    if (message_arena != submessage_arena) {
+      point_delete = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, point_delete, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  _impl_.point_delete_ = point_delete;
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.point_delete)
+}
+
+// optional .WriteQuery.PointMutate point_mutate = 10;
+inline bool WriteQuery::_internal_has_point_mutate() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.point_mutate_ != nullptr);
+  return value;
+}
+inline bool WriteQuery::has_point_mutate() const {
+  return _internal_has_point_mutate();
+}
+inline void WriteQuery::clear_point_mutate() {
+  if (_impl_.point_mutate_ != nullptr) _impl_.point_mutate_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline const ::WriteQuery_PointMutate& WriteQuery::_internal_point_mutate() const {
+  const ::WriteQuery_PointMutate* p = _impl_.point_mutate_;
+  return p != nullptr ? *p : reinterpret_cast<const ::WriteQuery_PointMutate&>(
+      ::_WriteQuery_PointMutate_default_instance_);
+}
+inline const ::WriteQuery_PointMutate& WriteQuery::point_mutate() const {
+  // @@protoc_insertion_point(field_get:WriteQuery.point_mutate)
+  return _internal_point_mutate();
+}
+inline void WriteQuery::unsafe_arena_set_allocated_point_mutate(
+    ::WriteQuery_PointMutate* point_mutate) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.point_mutate_);
+  }
+  _impl_.point_mutate_ = point_mutate;
+  if (point_mutate) {
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WriteQuery.point_mutate)
+}
+inline ::WriteQuery_PointMutate* WriteQuery::release_point_mutate() {
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::WriteQuery_PointMutate* temp = _impl_.point_mutate_;
+  _impl_.point_mutate_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::WriteQuery_PointMutate* WriteQuery::unsafe_arena_release_point_mutate() {
+  // @@protoc_insertion_point(field_release:WriteQuery.point_mutate)
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::WriteQuery_PointMutate* temp = _impl_.point_mutate_;
+  _impl_.point_mutate_ = nullptr;
+  return temp;
+}
+inline ::WriteQuery_PointMutate* WriteQuery::_internal_mutable_point_mutate() {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  if (_impl_.point_mutate_ == nullptr) {
+    auto* p = CreateMaybeMessage<::WriteQuery_PointMutate>(GetArenaForAllocation());
+    _impl_.point_mutate_ = p;
+  }
+  return _impl_.point_mutate_;
+}
+inline ::WriteQuery_PointMutate* WriteQuery::mutable_point_mutate() {
+  ::WriteQuery_PointMutate* _msg = _internal_mutable_point_mutate();
+  // @@protoc_insertion_point(field_mutable:WriteQuery.point_mutate)
+  return _msg;
+}
+inline void WriteQuery::set_allocated_point_mutate(::WriteQuery_PointMutate* point_mutate) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.point_mutate_;
+  }
+  if (point_mutate) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(point_mutate);
+    if (message_arena != submessage_arena) {
+      point_mutate = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, point_mutate, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  _impl_.point_mutate_ = point_mutate;
+  // @@protoc_insertion_point(field_set_allocated:WriteQuery.point_mutate)
+}
+
+// -------------------------------------------------------------------
+
+// MetaQuery_CreateTable
+
+// optional string datacenter = 1;
+inline bool MetaQuery_CreateTable::_internal_has_datacenter() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool MetaQuery_CreateTable::has_datacenter() const {
+  return _internal_has_datacenter();
+}
+inline void MetaQuery_CreateTable::clear_datacenter() {
+  _impl_.datacenter_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& MetaQuery_CreateTable::datacenter() const {
+  // @@protoc_insertion_point(field_get:MetaQuery.CreateTable.datacenter)
+  return _internal_datacenter();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MetaQuery_CreateTable::set_datacenter(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.datacenter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MetaQuery.CreateTable.datacenter)
+}
+inline std::string* MetaQuery_CreateTable::mutable_datacenter() {
+  std::string* _s = _internal_mutable_datacenter();
+  // @@protoc_insertion_point(field_mutable:MetaQuery.CreateTable.datacenter)
+  return _s;
+}
+inline const std::string& MetaQuery_CreateTable::_internal_datacenter() const {
+  return _impl_.datacenter_.Get();
+}
+inline void MetaQuery_CreateTable::_internal_set_datacenter(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.datacenter_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MetaQuery_CreateTable::_internal_mutable_datacenter() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.datacenter_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MetaQuery_CreateTable::release_datacenter() {
+  // @@protoc_insertion_point(field_release:MetaQuery.CreateTable.datacenter)
+  if (!_internal_has_datacenter()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.datacenter_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.datacenter_.IsDefault()) {
+    _impl_.datacenter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void MetaQuery_CreateTable::set_allocated_datacenter(std::string* datacenter) {
+  if (datacenter != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.datacenter_.SetAllocated(datacenter, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.datacenter_.IsDefault()) {
+    _impl_.datacenter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:MetaQuery.CreateTable.datacenter)
+}
+
+// required .TableRef table_ref = 3;
+inline bool MetaQuery_CreateTable::_internal_has_table_ref() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.table_ref_ != nullptr);
+  return value;
+}
+inline bool MetaQuery_CreateTable::has_table_ref() const {
+  return _internal_has_table_ref();
+}
+inline void MetaQuery_CreateTable::clear_table_ref() {
+  if (_impl_.table_ref_ != nullptr) _impl_.table_ref_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::TableRef& MetaQuery_CreateTable::_internal_table_ref() const {
+  const ::TableRef* p = _impl_.table_ref_;
+  return p != nullptr ? *p : reinterpret_cast<const ::TableRef&>(
+      ::_TableRef_default_instance_);
+}
+inline const ::TableRef& MetaQuery_CreateTable::table_ref() const {
+  // @@protoc_insertion_point(field_get:MetaQuery.CreateTable.table_ref)
+  return _internal_table_ref();
+}
+inline void MetaQuery_CreateTable::unsafe_arena_set_allocated_table_ref(
+    ::TableRef* table_ref) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.table_ref_);
+  }
+  _impl_.table_ref_ = table_ref;
+  if (table_ref) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:MetaQuery.CreateTable.table_ref)
+}
+inline ::TableRef* MetaQuery_CreateTable::release_table_ref() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::TableRef* temp = _impl_.table_ref_;
+  _impl_.table_ref_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::TableRef* MetaQuery_CreateTable::unsafe_arena_release_table_ref() {
+  // @@protoc_insertion_point(field_release:MetaQuery.CreateTable.table_ref)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::TableRef* temp = _impl_.table_ref_;
+  _impl_.table_ref_ = nullptr;
+  return temp;
+}
+inline ::TableRef* MetaQuery_CreateTable::_internal_mutable_table_ref() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.table_ref_ == nullptr) {
+    auto* p = CreateMaybeMessage<::TableRef>(GetArenaForAllocation());
+    _impl_.table_ref_ = p;
+  }
+  return _impl_.table_ref_;
+}
+inline ::TableRef* MetaQuery_CreateTable::mutable_table_ref() {
+  ::TableRef* _msg = _internal_mutable_table_ref();
+  // @@protoc_insertion_point(field_mutable:MetaQuery.CreateTable.table_ref)
+  return _msg;
+}
+inline void MetaQuery_CreateTable::set_allocated_table_ref(::TableRef* table_ref) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.table_ref_;
+  }
+  if (table_ref) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(table_ref);
+    if (message_arena != submessage_arena) {
+      table_ref = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, table_ref, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.table_ref_ = table_ref;
+  // @@protoc_insertion_point(field_set_allocated:MetaQuery.CreateTable.table_ref)
+}
+
+// optional string primary_key = 4 [default = "id"];
+inline bool MetaQuery_CreateTable::_internal_has_primary_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool MetaQuery_CreateTable::has_primary_key() const {
+  return _internal_has_primary_key();
+}
+inline void MetaQuery_CreateTable::clear_primary_key() {
+  _impl_.primary_key_.ClearToDefault(::MetaQuery_CreateTable::Impl_::_i_give_permission_to_break_this_code_default_primary_key_, GetArenaForAllocation());
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& MetaQuery_CreateTable::primary_key() const {
+  // @@protoc_insertion_point(field_get:MetaQuery.CreateTable.primary_key)
+  if (_impl_.primary_key_.IsDefault()) return Impl_::_i_give_permission_to_break_this_code_default_primary_key_.get();
+  return _internal_primary_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MetaQuery_CreateTable::set_primary_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.primary_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MetaQuery.CreateTable.primary_key)
+}
+inline std::string* MetaQuery_CreateTable::mutable_primary_key() {
+  std::string* _s = _internal_mutable_primary_key();
+  // @@protoc_insertion_point(field_mutable:MetaQuery.CreateTable.primary_key)
+  return _s;
+}
+inline const std::string& MetaQuery_CreateTable::_internal_primary_key() const {
+  return _impl_.primary_key_.Get();
+}
+inline void MetaQuery_CreateTable::_internal_set_primary_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.primary_key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MetaQuery_CreateTable::_internal_mutable_primary_key() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.primary_key_.Mutable(::MetaQuery_CreateTable::Impl_::_i_give_permission_to_break_this_code_default_primary_key_, GetArenaForAllocation());
+}
+inline std::string* MetaQuery_CreateTable::release_primary_key() {
+  // @@protoc_insertion_point(field_release:MetaQuery.CreateTable.primary_key)
+  if (!_internal_has_primary_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.primary_key_.Release();
+  return p;
+}
+inline void MetaQuery_CreateTable::set_allocated_primary_key(std::string* primary_key) {
+  if (primary_key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.primary_key_.SetAllocated(primary_key, GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set_allocated:MetaQuery.CreateTable.primary_key)
+}
+
+// optional int64 cache_size = 5 [default = 1073741824];
+inline bool MetaQuery_CreateTable::_internal_has_cache_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool MetaQuery_CreateTable::has_cache_size() const {
+  return _internal_has_cache_size();
+}
+inline void MetaQuery_CreateTable::clear_cache_size() {
+  _impl_.cache_size_ = int64_t{1073741824};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int64_t MetaQuery_CreateTable::_internal_cache_size() const {
+  return _impl_.cache_size_;
+}
+inline int64_t MetaQuery_CreateTable::cache_size() const {
+  // @@protoc_insertion_point(field_get:MetaQuery.CreateTable.cache_size)
+  return _internal_cache_size();
+}
+inline void MetaQuery_CreateTable::_internal_set_cache_size(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.cache_size_ = value;
+}
+inline void MetaQuery_CreateTable::set_cache_size(int64_t value) {
+  _internal_set_cache_size(value);
+  // @@protoc_insertion_point(field_set:MetaQuery.CreateTable.cache_size)
+}
+
+// -------------------------------------------------------------------
+
+// MetaQuery_IndexRef
+
+// required .TableRef table_ref = 1;
+inline bool MetaQuery_IndexRef::_internal_has_table_ref() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.table_ref_ != nullptr);
+  return value;
+}
+inline bool MetaQuery_IndexRef::has_table_ref() const {
+  return _internal_has_table_ref();
+}
+inline void MetaQuery_IndexRef::clear_table_ref() {
+  if (_impl_.table_ref_ != nullptr) _impl_.table_ref_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::TableRef& MetaQuery_IndexRef::_internal_table_ref() const {
+  const ::TableRef* p = _impl_.table_ref_;
+  return p != nullptr ? *p : reinterpret_cast<const ::TableRef&>(
+      ::_TableRef_default_instance_);
+}
+inline const ::TableRef& MetaQuery_IndexRef::table_ref() const {
+  // @@protoc_insertion_point(field_get:MetaQuery.IndexRef.table_ref)
+  return _internal_table_ref();
+}
+inline void MetaQuery_IndexRef::unsafe_arena_set_allocated_table_ref(
+    ::TableRef* table_ref) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.table_ref_);
+  }
+  _impl_.table_ref_ = table_ref;
+  if (table_ref) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:MetaQuery.IndexRef.table_ref)
+}
+inline ::TableRef* MetaQuery_IndexRef::release_table_ref() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::TableRef* temp = _impl_.table_ref_;
+  _impl_.table_ref_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::TableRef* MetaQuery_IndexRef::unsafe_arena_release_table_ref() {
+  // @@protoc_insertion_point(field_release:MetaQuery.IndexRef.table_ref)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::TableRef* temp = _impl_.table_ref_;
+  _impl_.table_ref_ = nullptr;
+  return temp;
+}
+inline ::TableRef* MetaQuery_IndexRef::_internal_mutable_table_ref() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.table_ref_ == nullptr) {
+    auto* p = CreateMaybeMessage<::TableRef>(GetArenaForAllocation());
+    _impl_.table_ref_ = p;
+  }
+  return _impl_.table_ref_;
+}
+inline ::TableRef* MetaQuery_IndexRef::mutable_table_ref() {
+  ::TableRef* _msg = _internal_mutable_table_ref();
+  // @@protoc_insertion_point(field_mutable:MetaQuery.IndexRef.table_ref)
+  return _msg;
+}
+inline void MetaQuery_IndexRef::set_allocated_table_ref(::TableRef* table_ref) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.table_ref_;
+  }
+  if (table_ref) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(table_ref);
+    if (message_arena != submessage_arena) {
+      table_ref = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, table_ref, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.table_ref_ = table_ref;
+  // @@protoc_insertion_point(field_set_allocated:MetaQuery.IndexRef.table_ref)
+}
+
+// required string attrname = 2;
+inline bool MetaQuery_IndexRef::_internal_has_attrname() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool MetaQuery_IndexRef::has_attrname() const {
+  return _internal_has_attrname();
+}
+inline void MetaQuery_IndexRef::clear_attrname() {
+  _impl_.attrname_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& MetaQuery_IndexRef::attrname() const {
+  // @@protoc_insertion_point(field_get:MetaQuery.IndexRef.attrname)
+  return _internal_attrname();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MetaQuery_IndexRef::set_attrname(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.attrname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MetaQuery.IndexRef.attrname)
+}
+inline std::string* MetaQuery_IndexRef::mutable_attrname() {
+  std::string* _s = _internal_mutable_attrname();
+  // @@protoc_insertion_point(field_mutable:MetaQuery.IndexRef.attrname)
+  return _s;
+}
+inline const std::string& MetaQuery_IndexRef::_internal_attrname() const {
+  return _impl_.attrname_.Get();
+}
+inline void MetaQuery_IndexRef::_internal_set_attrname(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.attrname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MetaQuery_IndexRef::_internal_mutable_attrname() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.attrname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MetaQuery_IndexRef::release_attrname() {
+  // @@protoc_insertion_point(field_release:MetaQuery.IndexRef.attrname)
+  if (!_internal_has_attrname()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.attrname_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.attrname_.IsDefault()) {
+    _impl_.attrname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void MetaQuery_IndexRef::set_allocated_attrname(std::string* attrname) {
+  if (attrname != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.attrname_.SetAllocated(attrname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.attrname_.IsDefault()) {
+    _impl_.attrname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:MetaQuery.IndexRef.attrname)
+}
+
+// -------------------------------------------------------------------
+
+// MetaQuery
+
+// required .MetaQuery.MetaQueryType type = 1;
+inline bool MetaQuery::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool MetaQuery::has_type() const {
+  return _internal_has_type();
+}
+inline void MetaQuery::clear_type() {
+  _impl_.type_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline ::MetaQuery_MetaQueryType MetaQuery::_internal_type() const {
+  return static_cast< ::MetaQuery_MetaQueryType >(_impl_.type_);
+}
+inline ::MetaQuery_MetaQueryType MetaQuery::type() const {
+  // @@protoc_insertion_point(field_get:MetaQuery.type)
+  return _internal_type();
+}
+inline void MetaQuery::_internal_set_type(::MetaQuery_MetaQueryType value) {
+  assert(::MetaQuery_MetaQueryType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.type_ = value;
+}
+inline void MetaQuery::set_type(::MetaQuery_MetaQueryType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:MetaQuery.type)
+}
+
+// optional string db_name = 2;
+inline bool MetaQuery::_internal_has_db_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool MetaQuery::has_db_name() const {
+  return _internal_has_db_name();
+}
+inline void MetaQuery::clear_db_name() {
+  _impl_.db_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& MetaQuery::db_name() const {
+  // @@protoc_insertion_point(field_get:MetaQuery.db_name)
+  return _internal_db_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MetaQuery::set_db_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.db_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MetaQuery.db_name)
+}
+inline std::string* MetaQuery::mutable_db_name() {
+  std::string* _s = _internal_mutable_db_name();
+  // @@protoc_insertion_point(field_mutable:MetaQuery.db_name)
+  return _s;
+}
+inline const std::string& MetaQuery::_internal_db_name() const {
+  return _impl_.db_name_.Get();
+}
+inline void MetaQuery::_internal_set_db_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.db_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MetaQuery::_internal_mutable_db_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.db_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MetaQuery::release_db_name() {
+  // @@protoc_insertion_point(field_release:MetaQuery.db_name)
+  if (!_internal_has_db_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.db_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.db_name_.IsDefault()) {
+    _impl_.db_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void MetaQuery::set_allocated_db_name(std::string* db_name) {
+  if (db_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.db_name_.SetAllocated(db_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.db_name_.IsDefault()) {
+    _impl_.db_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:MetaQuery.db_name)
+}
+
+// optional .MetaQuery.CreateTable create_table = 3;
+inline bool MetaQuery::_internal_has_create_table() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.create_table_ != nullptr);
+  return value;
+}
+inline bool MetaQuery::has_create_table() const {
+  return _internal_has_create_table();
+}
+inline void MetaQuery::clear_create_table() {
+  if (_impl_.create_table_ != nullptr) _impl_.create_table_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::MetaQuery_CreateTable& MetaQuery::_internal_create_table() const {
+  const ::MetaQuery_CreateTable* p = _impl_.create_table_;
+  return p != nullptr ? *p : reinterpret_cast<const ::MetaQuery_CreateTable&>(
+      ::_MetaQuery_CreateTable_default_instance_);
+}
+inline const ::MetaQuery_CreateTable& MetaQuery::create_table() const {
+  // @@protoc_insertion_point(field_get:MetaQuery.create_table)
+  return _internal_create_table();
+}
+inline void MetaQuery::unsafe_arena_set_allocated_create_table(
+    ::MetaQuery_CreateTable* create_table) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.create_table_);
+  }
+  _impl_.create_table_ = create_table;
+  if (create_table) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:MetaQuery.create_table)
+}
+inline ::MetaQuery_CreateTable* MetaQuery::release_create_table() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::MetaQuery_CreateTable* temp = _impl_.create_table_;
+  _impl_.create_table_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::MetaQuery_CreateTable* MetaQuery::unsafe_arena_release_create_table() {
+  // @@protoc_insertion_point(field_release:MetaQuery.create_table)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::MetaQuery_CreateTable* temp = _impl_.create_table_;
+  _impl_.create_table_ = nullptr;
+  return temp;
+}
+inline ::MetaQuery_CreateTable* MetaQuery::_internal_mutable_create_table() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.create_table_ == nullptr) {
+    auto* p = CreateMaybeMessage<::MetaQuery_CreateTable>(GetArenaForAllocation());
+    _impl_.create_table_ = p;
+  }
+  return _impl_.create_table_;
+}
+inline ::MetaQuery_CreateTable* MetaQuery::mutable_create_table() {
+  ::MetaQuery_CreateTable* _msg = _internal_mutable_create_table();
+  // @@protoc_insertion_point(field_mutable:MetaQuery.create_table)
+  return _msg;
+}
+inline void MetaQuery::set_allocated_create_table(::MetaQuery_CreateTable* create_table) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.create_table_;
+  }
+  if (create_table) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(create_table);
+    if (message_arena != submessage_arena) {
+      create_table = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, create_table, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.create_table_ = create_table;
+  // @@protoc_insertion_point(field_set_allocated:MetaQuery.create_table)
+}
+
+// optional .TableRef drop_table = 4;
+inline bool MetaQuery::_internal_has_drop_table() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.drop_table_ != nullptr);
+  return value;
+}
+inline bool MetaQuery::has_drop_table() const {
+  return _internal_has_drop_table();
+}
+inline void MetaQuery::clear_drop_table() {
+  if (_impl_.drop_table_ != nullptr) _impl_.drop_table_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::TableRef& MetaQuery::_internal_drop_table() const {
+  const ::TableRef* p = _impl_.drop_table_;
+  return p != nullptr ? *p : reinterpret_cast<const ::TableRef&>(
+      ::_TableRef_default_instance_);
+}
+inline const ::TableRef& MetaQuery::drop_table() const {
+  // @@protoc_insertion_point(field_get:MetaQuery.drop_table)
+  return _internal_drop_table();
+}
+inline void MetaQuery::unsafe_arena_set_allocated_drop_table(
+    ::TableRef* drop_table) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.drop_table_);
+  }
+  _impl_.drop_table_ = drop_table;
+  if (drop_table) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:MetaQuery.drop_table)
+}
+inline ::TableRef* MetaQuery::release_drop_table() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::TableRef* temp = _impl_.drop_table_;
+  _impl_.drop_table_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::TableRef* MetaQuery::unsafe_arena_release_drop_table() {
+  // @@protoc_insertion_point(field_release:MetaQuery.drop_table)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::TableRef* temp = _impl_.drop_table_;
+  _impl_.drop_table_ = nullptr;
+  return temp;
+}
+inline ::TableRef* MetaQuery::_internal_mutable_drop_table() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.drop_table_ == nullptr) {
+    auto* p = CreateMaybeMessage<::TableRef>(GetArenaForAllocation());
+    _impl_.drop_table_ = p;
+  }
+  return _impl_.drop_table_;
+}
+inline ::TableRef* MetaQuery::mutable_drop_table() {
+  ::TableRef* _msg = _internal_mutable_drop_table();
+  // @@protoc_insertion_point(field_mutable:MetaQuery.drop_table)
+  return _msg;
+}
+inline void MetaQuery::set_allocated_drop_table(::TableRef* drop_table) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.drop_table_;
+  }
+  if (drop_table) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(drop_table);
+    if (message_arena != submessage_arena) {
+      drop_table = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, drop_table, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.drop_table_ = drop_table;
+  // @@protoc_insertion_point(field_set_allocated:MetaQuery.drop_table)
+}
+
+// optional .MetaQuery.IndexRef create_index = 5;
+inline bool MetaQuery::_internal_has_create_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.create_index_ != nullptr);
+  return value;
+}
+inline bool MetaQuery::has_create_index() const {
+  return _internal_has_create_index();
+}
+inline void MetaQuery::clear_create_index() {
+  if (_impl_.create_index_ != nullptr) _impl_.create_index_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::MetaQuery_IndexRef& MetaQuery::_internal_create_index() const {
+  const ::MetaQuery_IndexRef* p = _impl_.create_index_;
+  return p != nullptr ? *p : reinterpret_cast<const ::MetaQuery_IndexRef&>(
+      ::_MetaQuery_IndexRef_default_instance_);
+}
+inline const ::MetaQuery_IndexRef& MetaQuery::create_index() const {
+  // @@protoc_insertion_point(field_get:MetaQuery.create_index)
+  return _internal_create_index();
+}
+inline void MetaQuery::unsafe_arena_set_allocated_create_index(
+    ::MetaQuery_IndexRef* create_index) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.create_index_);
+  }
+  _impl_.create_index_ = create_index;
+  if (create_index) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:MetaQuery.create_index)
+}
+inline ::MetaQuery_IndexRef* MetaQuery::release_create_index() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::MetaQuery_IndexRef* temp = _impl_.create_index_;
+  _impl_.create_index_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::MetaQuery_IndexRef* MetaQuery::unsafe_arena_release_create_index() {
+  // @@protoc_insertion_point(field_release:MetaQuery.create_index)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::MetaQuery_IndexRef* temp = _impl_.create_index_;
+  _impl_.create_index_ = nullptr;
+  return temp;
+}
+inline ::MetaQuery_IndexRef* MetaQuery::_internal_mutable_create_index() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.create_index_ == nullptr) {
+    auto* p = CreateMaybeMessage<::MetaQuery_IndexRef>(GetArenaForAllocation());
+    _impl_.create_index_ = p;
+  }
+  return _impl_.create_index_;
+}
+inline ::MetaQuery_IndexRef* MetaQuery::mutable_create_index() {
+  ::MetaQuery_IndexRef* _msg = _internal_mutable_create_index();
+  // @@protoc_insertion_point(field_mutable:MetaQuery.create_index)
+  return _msg;
+}
+inline void MetaQuery::set_allocated_create_index(::MetaQuery_IndexRef* create_index) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.create_index_;
+  }
+  if (create_index) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(create_index);
+    if (message_arena != submessage_arena) {
+      create_index = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, create_index, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.create_index_ = create_index;
+  // @@protoc_insertion_point(field_set_allocated:MetaQuery.create_index)
+}
+
+// optional .MetaQuery.IndexRef drop_index = 6;
+inline bool MetaQuery::_internal_has_drop_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.drop_index_ != nullptr);
+  return value;
+}
+inline bool MetaQuery::has_drop_index() const {
+  return _internal_has_drop_index();
+}
+inline void MetaQuery::clear_drop_index() {
+  if (_impl_.drop_index_ != nullptr) _impl_.drop_index_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::MetaQuery_IndexRef& MetaQuery::_internal_drop_index() const {
+  const ::MetaQuery_IndexRef* p = _impl_.drop_index_;
+  return p != nullptr ? *p : reinterpret_cast<const ::MetaQuery_IndexRef&>(
+      ::_MetaQuery_IndexRef_default_instance_);
+}
+inline const ::MetaQuery_IndexRef& MetaQuery::drop_index() const {
+  // @@protoc_insertion_point(field_get:MetaQuery.drop_index)
+  return _internal_drop_index();
+}
+inline void MetaQuery::unsafe_arena_set_allocated_drop_index(
+    ::MetaQuery_IndexRef* drop_index) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.drop_index_);
+  }
+  _impl_.drop_index_ = drop_index;
+  if (drop_index) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:MetaQuery.drop_index)
+}
+inline ::MetaQuery_IndexRef* MetaQuery::release_drop_index() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::MetaQuery_IndexRef* temp = _impl_.drop_index_;
+  _impl_.drop_index_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::MetaQuery_IndexRef* MetaQuery::unsafe_arena_release_drop_index() {
+  // @@protoc_insertion_point(field_release:MetaQuery.drop_index)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::MetaQuery_IndexRef* temp = _impl_.drop_index_;
+  _impl_.drop_index_ = nullptr;
+  return temp;
+}
+inline ::MetaQuery_IndexRef* MetaQuery::_internal_mutable_drop_index() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.drop_index_ == nullptr) {
+    auto* p = CreateMaybeMessage<::MetaQuery_IndexRef>(GetArenaForAllocation());
+    _impl_.drop_index_ = p;
+  }
+  return _impl_.drop_index_;
+}
+inline ::MetaQuery_IndexRef* MetaQuery::mutable_drop_index() {
+  ::MetaQuery_IndexRef* _msg = _internal_mutable_drop_index();
+  // @@protoc_insertion_point(field_mutable:MetaQuery.drop_index)
+  return _msg;
+}
+inline void MetaQuery::set_allocated_drop_index(::MetaQuery_IndexRef* drop_index) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.drop_index_;
+  }
+  if (drop_index) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(drop_index);
+    if (message_arena != submessage_arena) {
+      drop_index = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, drop_index, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.drop_index_ = drop_index;
+  // @@protoc_insertion_point(field_set_allocated:MetaQuery.drop_index)
+}
+
+// -------------------------------------------------------------------
+
+// Query
+
+// required .Query.QueryType type = 1;
+inline bool Query::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Query::has_type() const {
+  return _internal_has_type();
+}
+inline void Query::clear_type() {
+  _impl_.type_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline ::Query_QueryType Query::_internal_type() const {
+  return static_cast< ::Query_QueryType >(_impl_.type_);
+}
+inline ::Query_QueryType Query::type() const {
+  // @@protoc_insertion_point(field_get:Query.type)
+  return _internal_type();
+}
+inline void Query::_internal_set_type(::Query_QueryType value) {
+  assert(::Query_QueryType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.type_ = value;
+}
+inline void Query::set_type(::Query_QueryType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:Query.type)
+}
+
+// required int64 token = 2;
+inline bool Query::_internal_has_token() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Query::has_token() const {
+  return _internal_has_token();
+}
+inline void Query::clear_token() {
+  _impl_.token_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int64_t Query::_internal_token() const {
+  return _impl_.token_;
+}
+inline int64_t Query::token() const {
+  // @@protoc_insertion_point(field_get:Query.token)
+  return _internal_token();
+}
+inline void Query::_internal_set_token(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.token_ = value;
+}
+inline void Query::set_token(int64_t value) {
+  _internal_set_token(value);
+  // @@protoc_insertion_point(field_set:Query.token)
+}
+
+// optional .ReadQuery read_query = 3;
+inline bool Query::_internal_has_read_query() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.read_query_ != nullptr);
+  return value;
+}
+inline bool Query::has_read_query() const {
+  return _internal_has_read_query();
+}
+inline void Query::clear_read_query() {
+  if (_impl_.read_query_ != nullptr) _impl_.read_query_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::ReadQuery& Query::_internal_read_query() const {
+  const ::ReadQuery* p = _impl_.read_query_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ReadQuery&>(
+      ::_ReadQuery_default_instance_);
+}
+inline const ::ReadQuery& Query::read_query() const {
+  // @@protoc_insertion_point(field_get:Query.read_query)
+  return _internal_read_query();
+}
+inline void Query::unsafe_arena_set_allocated_read_query(
+    ::ReadQuery* read_query) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.read_query_);
+  }
+  _impl_.read_query_ = read_query;
+  if (read_query) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Query.read_query)
+}
+inline ::ReadQuery* Query::release_read_query() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ReadQuery* temp = _impl_.read_query_;
+  _impl_.read_query_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ReadQuery* Query::unsafe_arena_release_read_query() {
+  // @@protoc_insertion_point(field_release:Query.read_query)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::ReadQuery* temp = _impl_.read_query_;
+  _impl_.read_query_ = nullptr;
+  return temp;
+}
+inline ::ReadQuery* Query::_internal_mutable_read_query() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.read_query_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ReadQuery>(GetArenaForAllocation());
+    _impl_.read_query_ = p;
+  }
+  return _impl_.read_query_;
+}
+inline ::ReadQuery* Query::mutable_read_query() {
+  ::ReadQuery* _msg = _internal_mutable_read_query();
+  // @@protoc_insertion_point(field_mutable:Query.read_query)
+  return _msg;
+}
+inline void Query::set_allocated_read_query(::ReadQuery* read_query) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.read_query_;
+  }
+  if (read_query) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(read_query);
+    if (message_arena != submessage_arena) {
+      read_query = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, read_query, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.read_query_ = read_query;
+  // @@protoc_insertion_point(field_set_allocated:Query.read_query)
+}
+
+// optional .WriteQuery write_query = 4;
+inline bool Query::_internal_has_write_query() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.write_query_ != nullptr);
+  return value;
+}
+inline bool Query::has_write_query() const {
+  return _internal_has_write_query();
+}
+inline void Query::clear_write_query() {
+  if (_impl_.write_query_ != nullptr) _impl_.write_query_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::WriteQuery& Query::_internal_write_query() const {
+  const ::WriteQuery* p = _impl_.write_query_;
+  return p != nullptr ? *p : reinterpret_cast<const ::WriteQuery&>(
+      ::_WriteQuery_default_instance_);
+}
+inline const ::WriteQuery& Query::write_query() const {
+  // @@protoc_insertion_point(field_get:Query.write_query)
+  return _internal_write_query();
+}
+inline void Query::unsafe_arena_set_allocated_write_query(
+    ::WriteQuery* write_query) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.write_query_);
+  }
+  _impl_.write_query_ = write_query;
+  if (write_query) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Query.write_query)
+}
+inline ::WriteQuery* Query::release_write_query() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::WriteQuery* temp = _impl_.write_query_;
+  _impl_.write_query_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::WriteQuery* Query::unsafe_arena_release_write_query() {
+  // @@protoc_insertion_point(field_release:Query.write_query)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::WriteQuery* temp = _impl_.write_query_;
+  _impl_.write_query_ = nullptr;
+  return temp;
+}
+inline ::WriteQuery* Query::_internal_mutable_write_query() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.write_query_ == nullptr) {
+    auto* p = CreateMaybeMessage<::WriteQuery>(GetArenaForAllocation());
+    _impl_.write_query_ = p;
+  }
+  return _impl_.write_query_;
+}
+inline ::WriteQuery* Query::mutable_write_query() {
+  ::WriteQuery* _msg = _internal_mutable_write_query();
+  // @@protoc_insertion_point(field_mutable:Query.write_query)
+  return _msg;
+}
+inline void Query::set_allocated_write_query(::WriteQuery* write_query) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.write_query_;
+  }
+  if (write_query) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(write_query);
+    if (message_arena != submessage_arena) {
+      write_query = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, write_query, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.write_query_ = write_query;
+  // @@protoc_insertion_point(field_set_allocated:Query.write_query)
+}
+
+// optional .MetaQuery meta_query = 5;
+inline bool Query::_internal_has_meta_query() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.meta_query_ != nullptr);
+  return value;
+}
+inline bool Query::has_meta_query() const {
+  return _internal_has_meta_query();
+}
+inline void Query::clear_meta_query() {
+  if (_impl_.meta_query_ != nullptr) _impl_.meta_query_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::MetaQuery& Query::_internal_meta_query() const {
+  const ::MetaQuery* p = _impl_.meta_query_;
+  return p != nullptr ? *p : reinterpret_cast<const ::MetaQuery&>(
+      ::_MetaQuery_default_instance_);
+}
+inline const ::MetaQuery& Query::meta_query() const {
+  // @@protoc_insertion_point(field_get:Query.meta_query)
+  return _internal_meta_query();
+}
+inline void Query::unsafe_arena_set_allocated_meta_query(
+    ::MetaQuery* meta_query) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.meta_query_);
+  }
+  _impl_.meta_query_ = meta_query;
+  if (meta_query) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Query.meta_query)
+}
+inline ::MetaQuery* Query::release_meta_query() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::MetaQuery* temp = _impl_.meta_query_;
+  _impl_.meta_query_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::MetaQuery* Query::unsafe_arena_release_meta_query() {
+  // @@protoc_insertion_point(field_release:Query.meta_query)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::MetaQuery* temp = _impl_.meta_query_;
+  _impl_.meta_query_ = nullptr;
+  return temp;
+}
+inline ::MetaQuery* Query::_internal_mutable_meta_query() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.meta_query_ == nullptr) {
+    auto* p = CreateMaybeMessage<::MetaQuery>(GetArenaForAllocation());
+    _impl_.meta_query_ = p;
+  }
+  return _impl_.meta_query_;
+}
+inline ::MetaQuery* Query::mutable_meta_query() {
+  ::MetaQuery* _msg = _internal_mutable_meta_query();
+  // @@protoc_insertion_point(field_mutable:Query.meta_query)
+  return _msg;
+}
+inline void Query::set_allocated_meta_query(::MetaQuery* meta_query) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.meta_query_;
+  }
+  if (meta_query) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(meta_query);
+    if (message_arena != submessage_arena) {
+      meta_query = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, meta_query, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.meta_query_ = meta_query;
+  // @@protoc_insertion_point(field_set_allocated:Query.meta_query)
+}
+
+// -------------------------------------------------------------------
+
+// Response_Backtrace
+
+// repeated string frame = 1;
+inline int Response_Backtrace::_internal_frame_size() const {
+  return _impl_.frame_.size();
+}
+inline int Response_Backtrace::frame_size() const {
+  return _internal_frame_size();
+}
+inline void Response_Backtrace::clear_frame() {
+  _impl_.frame_.Clear();
+}
+inline std::string* Response_Backtrace::add_frame() {
+  std::string* _s = _internal_add_frame();
+  // @@protoc_insertion_point(field_add_mutable:Response.Backtrace.frame)
+  return _s;
+}
+inline const std::string& Response_Backtrace::_internal_frame(int index) const {
+  return _impl_.frame_.Get(index);
+}
+inline const std::string& Response_Backtrace::frame(int index) const {
+  // @@protoc_insertion_point(field_get:Response.Backtrace.frame)
+  return _internal_frame(index);
+}
+inline std::string* Response_Backtrace::mutable_frame(int index) {
+  // @@protoc_insertion_point(field_mutable:Response.Backtrace.frame)
+  return _impl_.frame_.Mutable(index);
+}
+inline void Response_Backtrace::set_frame(int index, const std::string& value) {
+  _impl_.frame_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:Response.Backtrace.frame)
+}
+inline void Response_Backtrace::set_frame(int index, std::string&& value) {
+  _impl_.frame_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:Response.Backtrace.frame)
+}
+inline void Response_Backtrace::set_frame(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.frame_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:Response.Backtrace.frame)
+}
+inline void Response_Backtrace::set_frame(int index, const char* value, size_t size) {
+  _impl_.frame_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:Response.Backtrace.frame)
+}
+inline std::string* Response_Backtrace::_internal_add_frame() {
+  return _impl_.frame_.Add();
+}
+inline void Response_Backtrace::add_frame(const std::string& value) {
+  _impl_.frame_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:Response.Backtrace.frame)
+}
+inline void Response_Backtrace::add_frame(std::string&& value) {
+  _impl_.frame_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:Response.Backtrace.frame)
+}
+inline void Response_Backtrace::add_frame(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.frame_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:Response.Backtrace.frame)
+}
+inline void Response_Backtrace::add_frame(const char* value, size_t size) {
+  _impl_.frame_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:Response.Backtrace.frame)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Response_Backtrace::frame() const {
+  // @@protoc_insertion_point(field_list:Response.Backtrace.frame)
+  return _impl_.frame_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Response_Backtrace::mutable_frame() {
+  // @@protoc_insertion_point(field_mutable_list:Response.Backtrace.frame)
+  return &_impl_.frame_;
+}
+
+// -------------------------------------------------------------------
+
+// Response
+
+// required .Response.StatusCode status_code = 1;
+inline bool Response::_internal_has_status_code() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Response::has_status_code() const {
+  return _internal_has_status_code();
+}
+inline void Response::clear_status_code() {
+  _impl_.status_code_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline ::Response_StatusCode Response::_internal_status_code() const {
+  return static_cast< ::Response_StatusCode >(_impl_.status_code_);
+}
+inline ::Response_StatusCode Response::status_code() const {
+  // @@protoc_insertion_point(field_get:Response.status_code)
+  return _internal_status_code();
+}
+inline void Response::_internal_set_status_code(::Response_StatusCode value) {
+  assert(::Response_StatusCode_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.status_code_ = value;
+}
+inline void Response::set_status_code(::Response_StatusCode value) {
+  _internal_set_status_code(value);
+  // @@protoc_insertion_point(field_set:Response.status_code)
+}
+
+// required int64 token = 2;
+inline bool Response::_internal_has_token() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Response::has_token() const {
+  return _internal_has_token();
+}
+inline void Response::clear_token() {
+  _impl_.token_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int64_t Response::_internal_token() const {
+  return _impl_.token_;
+}
+inline int64_t Response::token() const {
+  // @@protoc_insertion_point(field_get:Response.token)
+  return _internal_token();
+}
+inline void Response::_internal_set_token(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.token_ = value;
+}
+inline void Response::set_token(int64_t value) {
+  _internal_set_token(value);
+  // @@protoc_insertion_point(field_set:Response.token)
+}
+
+// repeated string response = 3;
+inline int Response::_internal_response_size() const {
+  return _impl_.response_.size();
+}
+inline int Response::response_size() const {
+  return _internal_response_size();
+}
+inline void Response::clear_response() {
+  _impl_.response_.Clear();
+}
+inline std::string* Response::add_response() {
+  std::string* _s = _internal_add_response();
+  // @@protoc_insertion_point(field_add_mutable:Response.response)
+  return _s;
+}
+inline const std::string& Response::_internal_response(int index) const {
+  return _impl_.response_.Get(index);
+}
+inline const std::string& Response::response(int index) const {
+  // @@protoc_insertion_point(field_get:Response.response)
+  return _internal_response(index);
+}
+inline std::string* Response::mutable_response(int index) {
+  // @@protoc_insertion_point(field_mutable:Response.response)
+  return _impl_.response_.Mutable(index);
+}
+inline void Response::set_response(int index, const std::string& value) {
+  _impl_.response_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:Response.response)
+}
+inline void Response::set_response(int index, std::string&& value) {
+  _impl_.response_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:Response.response)
+}
+inline void Response::set_response(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.response_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:Response.response)
+}
+inline void Response::set_response(int index, const char* value, size_t size) {
+  _impl_.response_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:Response.response)
+}
+inline std::string* Response::_internal_add_response() {
+  return _impl_.response_.Add();
+}
+inline void Response::add_response(const std::string& value) {
+  _impl_.response_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:Response.response)
+}
+inline void Response::add_response(std::string&& value) {
+  _impl_.response_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:Response.response)
+}
+inline void Response::add_response(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.response_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:Response.response)
+}
+inline void Response::add_response(const char* value, size_t size) {
+  _impl_.response_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:Response.response)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Response::response() const {
+  // @@protoc_insertion_point(field_list:Response.response)
+  return _impl_.response_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Response::mutable_response() {
+  // @@protoc_insertion_point(field_mutable_list:Response.response)
+  return &_impl_.response_;
+}
+
+// optional string error_message = 4;
+inline bool Response::_internal_has_error_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Response::has_error_message() const {
+  return _internal_has_error_message();
+}
+inline void Response::clear_error_message() {
+  _impl_.error_message_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Response::error_message() const {
+  // @@protoc_insertion_point(field_get:Response.error_message)
+  return _internal_error_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Response::set_error_message(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Response.error_message)
+}
+inline std::string* Response::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
+  // @@protoc_insertion_point(field_mutable:Response.error_message)
+  return _s;
+}
+inline const std::string& Response::_internal_error_message() const {
+  return _impl_.error_message_.Get();
+}
+inline void Response::_internal_set_error_message(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Response::_internal_mutable_error_message() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Response::release_error_message() {
+  // @@protoc_insertion_point(field_release:Response.error_message)
+  if (!_internal_has_error_message()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_message_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Response::set_allocated_error_message(std::string* error_message) {
+  if (error_message != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Response.error_message)
+}
+
+// optional .Response.Backtrace backtrace = 5;
+inline bool Response::_internal_has_backtrace() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.backtrace_ != nullptr);
+  return value;
+}
+inline bool Response::has_backtrace() const {
+  return _internal_has_backtrace();
+}
+inline void Response::clear_backtrace() {
+  if (_impl_.backtrace_ != nullptr) _impl_.backtrace_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::Response_Backtrace& Response::_internal_backtrace() const {
+  const ::Response_Backtrace* p = _impl_.backtrace_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Response_Backtrace&>(
+      ::_Response_Backtrace_default_instance_);
+}
+inline const ::Response_Backtrace& Response::backtrace() const {
+  // @@protoc_insertion_point(field_get:Response.backtrace)
+  return _internal_backtrace();
+}
+inline void Response::unsafe_arena_set_allocated_backtrace(
+    ::Response_Backtrace* backtrace) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.backtrace_);
+  }
+  _impl_.backtrace_ = backtrace;
+  if (backtrace) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Response.backtrace)
+}
+inline ::Response_Backtrace* Response::release_backtrace() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Response_Backtrace* temp = _impl_.backtrace_;
+  _impl_.backtrace_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Response_Backtrace* Response::unsafe_arena_release_backtrace() {
+  // @@protoc_insertion_point(field_release:Response.backtrace)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::Response_Backtrace* temp = _impl_.backtrace_;
+  _impl_.backtrace_ = nullptr;
+  return temp;
+}
+inline ::Response_Backtrace* Response::_internal_mutable_backtrace() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.backtrace_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Response_Backtrace>(GetArenaForAllocation());
+    _impl_.backtrace_ = p;
+  }
+  return _impl_.backtrace_;
+}
+inline ::Response_Backtrace* Response::mutable_backtrace() {
+  ::Response_Backtrace* _msg = _internal_mutable_backtrace();
+  // @@protoc_insertion_point(field_mutable:Response.backtrace)
+  return _msg;
+}
+inline void Response::set_allocated_backtrace(::Response_Backtrace* backtrace) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.backtrace_;
+  }
+  if (backtrace) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(backtrace);
+    if (message_arena != submessage_arena) {
+      backtrace = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, backtrace, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.backtrace_ = backtrace;
+  // @@protoc_insertion_point(field_set_allocated:Response.backtrace)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::Term_TermType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::Term_TermType>() {
+  return ::Term_TermType_descriptor();
+}
+template <> struct is_proto_enum< ::Builtin_BuiltinType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::Builtin_BuiltinType>() {
+  return ::Builtin_BuiltinType_descriptor();
+}
+template <> struct is_proto_enum< ::Builtin_Comparison> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::Builtin_Comparison>() {
+  return ::Builtin_Comparison_descriptor();
+}
+template <> struct is_proto_enum< ::WriteQuery_WriteQueryType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::WriteQuery_WriteQueryType>() {
+  return ::WriteQuery_WriteQueryType_descriptor();
+}
+template <> struct is_proto_enum< ::MetaQuery_MetaQueryType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::MetaQuery_MetaQueryType>() {
+  return ::MetaQuery_MetaQueryType_descriptor();
+}
+template <> struct is_proto_enum< ::Query_QueryType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::Query_QueryType>() {
+  return ::Query_QueryType_descriptor();
+}
+template <> struct is_proto_enum< ::Response_StatusCode> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::Response_StatusCode>() {
+  return ::Response_StatusCode_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_rdb_5fprotocol_2fquery_5flanguage_2eproto
@@ -142,6 +142,38 @@ class TableDrop(MetaQueryInner):
             printer.simple_string(repr(self.table_name), ["table_name"])
             )
 
+class IndexCreate(MetaQueryInner):
+    def __init__(self, table, attrname):
+        assert isinstance(table, query.Table)
+        assert isinstance(attrname, types.StringTypes)
+        self.table = table
+        self.attrname = attrname
+    def _write_meta_query(self, parent, opts):
+        parent.type = p.MetaQuery.CREATE_INDEX
+        self.table._write_ref_ast(parent.create_index.table_ref, opts)
+        parent.create_index.attrname = self.attrname
+    def pretty_print(self, printer):
+        return "%s.index_create(%s)" % (
+            printer.expr_wrapped(self.table, ["table_ref"]),
+            printer.simple_string(repr(self.attrname), ["attrname"])
+            )
+
+class IndexDrop(MetaQueryInner):
+    def __init__(self, table, attrname):
+        assert isinstance(table, query.Table)
+        assert isinstance(attrname, types.StringTypes)
+        self.table = table
+        self.attrname = attrname
+    def _write_meta_query(self, parent, opts):
+        parent.type = p.MetaQuery.DROP_INDEX
+        self.table._write_ref_ast(parent.drop_index.table_ref, opts)
+        parent.drop_index.attrname = self.attrname
+    def pretty_print(self, printer):
+        return "%s.index_drop(%s)" % (
+            printer.expr_wrapped(self.table, ["table_ref"]),
+            printer.simple_string(repr(self.attrname), ["attrname"])
+            )
+
 class TableList(MetaQueryInner):
     def __init__(self, db_expr):
         assert isinstance(db_expr, query.Database)
@@ -1667,6 +1667,48 @@ class Table(MultiRowSelection):
         """
         return RowSelection(internal.Get(self, key, attr_name))
 
+    def index_create(self, attr_name):
+        """Create a ReQL expression that creates a secondary index on
+        the attribute `attr_name`. Once it exists, `range` queries on
+        that attribute over the whole table read just the rows they
+        need instead of scanning the table.
+
+        When run via :func:`rethinkdb.net.Connection.run` or
+        :func:`Expression.run`, `run` has no return value in case of
+        success, and raises :class:`rethinkdb.net.QueryError` in case
+        of failure.
+
+        :param attr_name: The attribute to index.
+        :type attr_name: str
+        :returns: :class:`MetaQuery` -- a ReQL expression that
+          encodes the index creation operation.
+
+        :Example:
+
+        >>> q = table('users').index_create('age')
+        """
+        return MetaQuery(internal.IndexCreate(self, attr_name))
+
+    def index_drop(self, attr_name):
+        """Create a ReQL expression that drops the secondary index on
+        the attribute `attr_name`.
+
+        When run via :func:`rethinkdb.net.Connection.run` or
+        :func:`Expression.run`, `run` has no return value in case of
+        success, and raises :class:`rethinkdb.net.QueryError` in case
+        of failure.
+
+        :param attr_name: The indexed attribute.
+        :type attr_name: str
+        :returns: :class:`MetaQuery` -- a ReQL expression that
+          encodes the index drop operation.
+
+        :Example:
+
+        >>> q = table('users').index_drop('age')
+        """
+        return MetaQuery(internal.IndexDrop(self, attr_name))
+
     def _write_ref_ast(self, parent, opts):
         if self.db_expr:
             parent.db_name = self.db_expr.db_name
@@ -22,6 +22,7 @@
 #include "arch/runtime/runtime.hpp"
 #include "arch/io/disk/aio.hpp"
 #include "arch/io/disk/pool.hpp"
+#include "arch/io/disk/uring.hpp"
 #include "arch/io/disk/conflict_resolving.hpp"
 #include "arch/io/disk/stats.hpp"
 #include "arch/io/disk/accounting.hpp"
@@ -133,8 +134,8 @@ private:
     the conflict resolver, which enforces ordering constraints between IO operations by
     holding back operations that must be run after other, currently-running, operations.
     Then it goes to the account manager, which queues up running IO operations according
-    to which account they are part of. Finally the backend (which may be either AIO-based
-    or thread-pool-based) pops the IO operations from the queue.
+    to which account they are part of. Finally the backend (which may be AIO-based,
+    io_uring-based, or thread-pool-based) pops the IO operations from the queue.
 
     At two points in the process--once as soon as it is submitted, and again right
     as the backend pops it off the queue--its statistics are recorded. The "stack stats"
@@ -173,6 +174,17 @@ void pool_io_backender_t::make_disk_manager(linux_event_queue_t *queue, const in
     out->init(new linux_templated_disk_manager_t<pool_diskmgr_t>(queue, batch_factor, stats));
 }
 
+void uring_io_backender_t::make_disk_manager(linux_event_queue_t *queue, const int batch_factor,
+                                             perfmon_collection_t *stats,
+                                             scoped_ptr_t<linux_disk_manager_t> *out) {
+#ifdef URINGSUPPORT
+    out->init(new linux_templated_disk_manager_t<linux_diskmgr_uring_t>(queue, batch_factor, stats));
+#else
+    if ( queue || batch_factor || stats || out ) { }
+    crash("This version has no io_uring support. Consider using the pool back-end.\n");
+#endif //URINGSUPPORT
+}
+
 
 void make_io_backender(io_backend_t backend, scoped_ptr_t<io_backender_t> *out) {
     if (backend == aio_native) {
@@ -183,6 +195,12 @@ void make_io_backender(io_backend_t backend, scoped_ptr_t<io_backender_t> *out)
         #endif
     } else if (backend == aio_pool) {
         out->init(new pool_io_backender_t);
+    } else if (backend == aio_uring) {
+        #ifdef URINGSUPPORT
+        out->init(new uring_io_backender_t);
+        #else
+        crash("This version has no io_uring support. Consider using the pool back-end.\n");
+        #endif
     } else {
         crash("impossible io_backend_t value: %d\n", backend);
     }
@@ -73,6 +73,14 @@ public:
                            scoped_ptr_t<linux_disk_manager_t> *out);
 };
 
+class uring_io_backender_t : public io_backender_t {
+public:
+    uring_io_backender_t() { make_disk_manager(queue, batch_factor, &stats, &diskmgr); }
+    void make_disk_manager(linux_event_queue_t *queue, const int batch_factor,
+                           perfmon_collection_t *stats,
+                           scoped_ptr_t<linux_disk_manager_t> *out);
+};
+
 void make_io_backender(io_backend_t backend, scoped_ptr_t<io_backender_t> *out);
 
 class linux_file_t : public file_t {
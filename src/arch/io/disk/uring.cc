@@ -0,0 +1,237 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#ifdef URINGSUPPORT
+
+#include "arch/io/disk/uring.hpp"
+
+#include <errno.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+#include "arch/io/arch.hpp"
+#include "config/args.hpp"
+#include "logger.hpp"
+#include "utils.hpp"
+
+/* linux_uring_t */
+
+linux_uring_t::linux_uring_t(unsigned int entries)
+    : sqe_local_tail(0), sqes_to_submit(0) {
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+
+    fd = syscall(__NR_io_uring_setup, entries, &params);
+    guarantee_err(fd >= 0, "Could not set up io_uring");
+
+    sq_ptr_size = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+    cq_ptr_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap) {
+        sq_ptr_size = cq_ptr_size = std::max(sq_ptr_size, cq_ptr_size);
+    }
+
+    sq_ptr = mmap(NULL, sq_ptr_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                  fd, IORING_OFF_SQ_RING);
+    guarantee_err(sq_ptr != MAP_FAILED, "Could not map io_uring submission ring");
+
+    if (single_mmap) {
+        cq_ptr = sq_ptr;
+    } else {
+        cq_ptr = mmap(NULL, cq_ptr_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      fd, IORING_OFF_CQ_RING);
+        guarantee_err(cq_ptr != MAP_FAILED, "Could not map io_uring completion ring");
+    }
+
+    sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+    void *sqes_ptr = mmap(NULL, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                          fd, IORING_OFF_SQES);
+    guarantee_err(sqes_ptr != MAP_FAILED, "Could not map io_uring submission entries");
+    sqes = static_cast<io_uring_sqe *>(sqes_ptr);
+
+    char *sq = static_cast<char *>(sq_ptr);
+    sq_head = reinterpret_cast<unsigned int *>(sq + params.sq_off.head);
+    sq_tail = reinterpret_cast<unsigned int *>(sq + params.sq_off.tail);
+    sq_ring_mask = reinterpret_cast<unsigned int *>(sq + params.sq_off.ring_mask);
+    sq_array = reinterpret_cast<unsigned int *>(sq + params.sq_off.array);
+
+    char *cq = static_cast<char *>(cq_ptr);
+    cq_head = reinterpret_cast<unsigned int *>(cq + params.cq_off.head);
+    cq_tail = reinterpret_cast<unsigned int *>(cq + params.cq_off.tail);
+    cq_ring_mask = reinterpret_cast<unsigned int *>(cq + params.cq_off.ring_mask);
+    cqes = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+
+    sqe_local_tail = *sq_tail;
+}
+
+linux_uring_t::~linux_uring_t() {
+    int res = munmap(sqes, sqes_size);
+    guarantee_err(res == 0, "Could not unmap io_uring submission entries");
+    if (cq_ptr != sq_ptr) {
+        res = munmap(cq_ptr, cq_ptr_size);
+        guarantee_err(res == 0, "Could not unmap io_uring completion ring");
+    }
+    res = munmap(sq_ptr, sq_ptr_size);
+    guarantee_err(res == 0, "Could not unmap io_uring submission ring");
+
+    res = close(fd);
+    guarantee_err(res == 0, "Could not close io_uring fd");
+}
+
+io_uring_sqe *linux_uring_t::get_sqe() {
+    // The kernel advances the head as it consumes entries.
+    unsigned int head = __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+    if (sqe_local_tail - head > *sq_ring_mask) {
+        return NULL;
+    }
+    unsigned int index = sqe_local_tail & *sq_ring_mask;
+    sq_array[index] = index;
+    ++sqe_local_tail;
+
+    io_uring_sqe *sqe = &sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    return sqe;
+}
+
+int linux_uring_t::submit() {
+    // Make the entries we filled in visible to the kernel before telling it about them.
+    sqes_to_submit += sqe_local_tail - *sq_tail;
+    __atomic_store_n(sq_tail, sqe_local_tail, __ATOMIC_RELEASE);
+
+    if (sqes_to_submit == 0) {
+        return 0;
+    }
+
+    int res;
+    do {
+        res = syscall(__NR_io_uring_enter, fd, sqes_to_submit, 0, 0, NULL, 0);
+    } while (res == -1 && errno == EINTR);
+
+    if (res < 0) {
+        return -errno;
+    }
+    sqes_to_submit -= res;
+    return res;
+}
+
+io_uring_cqe *linux_uring_t::peek_cqe() {
+    // We are the only one who advances the head, so it needs no barrier.
+    unsigned int head = *cq_head;
+    if (head == __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE)) {
+        return NULL;
+    }
+    return &cqes[head & *cq_ring_mask];
+}
+
+void linux_uring_t::advance_cq() {
+    __atomic_store_n(cq_head, *cq_head + 1, __ATOMIC_RELEASE);
+}
+
+/* linux_diskmgr_uring_t */
+
+linux_diskmgr_uring_t::linux_diskmgr_uring_t(
+        linux_event_queue_t *_queue,
+        passive_producer_t<action_t *> *_source)
+    : queue(_queue),
+      source(_source),
+      ring(MAX_CONCURRENT_IO_REQUESTS),
+      n_pending(0),
+      retry_timer(NULL) {
+    /* The ring fd polls readable whenever there are completions waiting, so the event
+    queue wakes us up directly. */
+    queue->watch_resource(ring.fd, poll_event_in, this);
+
+    /* If there are already operations waiting to go, start processing them. */
+    if (source->available->get()) pump();
+
+    /* Register so we get notified when requests come in */
+    source->available->set_callback(this);
+}
+
+linux_diskmgr_uring_t::~linux_diskmgr_uring_t() {
+    assert_thread();
+    rassert(n_pending == 0);
+    if (retry_timer != NULL) {
+        cancel_timer(retry_timer);
+    }
+    source->available->unset_callback();
+    queue->forget_resource(ring.fd, this);
+}
+
+void linux_diskmgr_uring_t::on_source_availability_changed() {
+    assert_thread();
+    /* This is called when the queue used to be empty but now has requests on
+    it, and also when the queue's last request is consumed. */
+    if (source->available->get()) pump();
+}
+
+void linux_diskmgr_uring_t::pump() {
+    assert_thread();
+
+    // Fill up the batch
+    while (source->available->get() && n_pending < TARGET_IO_QUEUE_DEPTH) {
+        io_uring_sqe *sqe = ring.get_sqe();
+        if (sqe == NULL) {
+            break;
+        }
+
+        action_t *a = source->pop();
+        sqe->opcode = a->is_read ? IORING_OP_READ : IORING_OP_WRITE;
+        sqe->fd = a->fd;
+        sqe->addr = reinterpret_cast<uintptr_t>(a->buf);
+        sqe->len = a->count;
+        sqe->off = a->offset;
+        sqe->user_data = reinterpret_cast<uintptr_t>(a);
+        ++n_pending;
+    }
+
+    // One syscall for the whole batch.
+    int res = ring.submit();
+    if (res == -EAGAIN || res == -EBUSY) {
+        /* The kernel is short on resources or its completion ring is full. The
+        entries stay on the submission ring, and we try again once some operation
+        completes. If none of ours are in flight, nothing will complete, so we
+        try again after a while instead. */
+        const int in_flight = n_pending - static_cast<int>(ring.unsubmitted());
+        if (in_flight == 0 && retry_timer == NULL) {
+            retry_timer = fire_timer_once(URING_SUBMIT_RETRY_MS, &linux_diskmgr_uring_t::on_retry_timer, this);
+        }
+    } else {
+        guarantee_xerr(res >= 0, -res, "io_uring_enter() failed");
+    }
+}
+
+void linux_diskmgr_uring_t::on_retry_timer(void *ctx) {
+    linux_diskmgr_uring_t *self = static_cast<linux_diskmgr_uring_t *>(ctx);
+    self->assert_thread();
+    self->retry_timer = NULL;
+    self->pump();
+}
+
+void linux_diskmgr_uring_t::on_event(int event_mask) {
+    assert_thread();
+
+    if (event_mask != poll_event_in) {
+        logERR("Unexpected event mask: %d", event_mask);
+    }
+
+    /* The event queue is edge-triggered, so we must drain the completion ring
+    completely. */
+    while (io_uring_cqe *cqe = ring.peek_cqe()) {
+        action_t *a = reinterpret_cast<action_t *>(cqe->user_data);
+        a->io_result = cqe->res;
+        ring.advance_cq();
+
+        --n_pending;
+
+        // Pass the notification on up
+        done_fun(a);
+    }
+
+    // Keep the OS's IO queue at the target depth.
+    pump();
+}
+
+#endif // URINGSUPPORT
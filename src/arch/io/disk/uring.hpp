@@ -0,0 +1,154 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#ifndef ARCH_IO_DISK_URING_HPP_
+#define ARCH_IO_DISK_URING_HPP_
+#ifdef URINGSUPPORT
+
+#include <linux/io_uring.h>
+
+#include "utils.hpp"
+#include <boost/function.hpp>
+
+#include "arch/runtime/event_queue.hpp"
+#include "config/args.hpp"
+#include "concurrency/queue/passive_producer.hpp"
+
+class timer_token_t;
+
+/* Simple wrapper around an io_uring instance: the ring file descriptor and the
+three shared memory regions (submission ring, completion ring, and the array of
+submission queue entries) that the kernel maps for us. We talk to the kernel
+through raw syscalls rather than liburing so that we don't pick up another
+dependency. */
+
+struct linux_uring_t {
+    explicit linux_uring_t(unsigned int entries);
+    ~linux_uring_t();
+
+    // Returns a free submission queue entry, or NULL if the submission ring is full.
+    // The entry is not visible to the kernel until `submit()` is called.
+    io_uring_sqe *get_sqe();
+
+    // Publishes all entries handed out by `get_sqe()` and hands them to the kernel
+    // with a single io_uring_enter() call. Returns the number of entries the kernel
+    // consumed, or -errno.
+    int submit();
+
+    // How many entries are on the ring that the kernel hasn't consumed yet.
+    unsigned int unsubmitted() const { return sqes_to_submit + (sqe_local_tail - *sq_tail); }
+
+    // Returns the next completion, or NULL if there is none. The completion must be
+    // released with `advance_cq()` before calling `peek_cqe()` again.
+    io_uring_cqe *peek_cqe();
+    void advance_cq();
+
+    fd_t fd;
+
+private:
+    unsigned int *sq_head, *sq_tail, *sq_ring_mask, *sq_array;
+    unsigned int *cq_head, *cq_tail, *cq_ring_mask;
+    io_uring_sqe *sqes;
+    io_uring_cqe *cqes;
+
+    // The submission queue tail as we see it, including entries that we have
+    // filled in but not yet published.
+    unsigned int sqe_local_tail;
+    // Entries that are published on the ring but that the kernel hasn't consumed.
+    unsigned int sqes_to_submit;
+
+    void *sq_ptr, *cq_ptr;
+    size_t sq_ptr_size, cq_ptr_size, sqes_size;
+
+    DISABLE_COPYING(linux_uring_t);
+};
+
+/* Disk manager that uses io_uring. It pulls as many operations off of its
+source as fit in the ring, submits them with one syscall, and reaps completions
+straight from the completion ring when the event queue reports that the ring fd
+is readable; there is no separate eventfd to read as there is with
+`linux_diskmgr_aio_t`. */
+
+class linux_diskmgr_uring_t :
+    private availability_callback_t,
+    private linux_event_callback_t,
+    public home_thread_mixin_debug_only_t
+{
+public:
+    /* Has the same interface as `linux_diskmgr_aio_t::action_t` and
+    `pool_diskmgr_t::action_t`. */
+    struct action_t {
+        action_t() { }
+
+        void make_write(fd_t f, const void *b, size_t c, off_t o) {
+            is_read = false;
+            fd = f;
+            buf = const_cast<void*>(b);
+            count = c;
+            offset = o;
+        }
+        void make_read(fd_t f, void *b, size_t c, off_t o) {
+            is_read = true;
+            fd = f;
+            buf = b;
+            count = c;
+            offset = o;
+        }
+
+        bool get_is_write() const { return !is_read; }
+        bool get_is_read() const { return is_read; }
+        fd_t get_fd() const { return fd; }
+        void *get_buf() const { return buf; }
+        size_t get_count() const { return count; }
+        off_t get_offset() const { return offset; }
+
+        void set_successful_due_to_conflict() { io_result = count; }
+        bool get_succeeded() const { return io_result == static_cast<int64_t>(count); }
+        int get_errno() const {
+            rassert(io_result < 0);
+            return -io_result;
+        }
+
+    private:
+        friend class linux_diskmgr_uring_t;
+
+        bool is_read;
+        fd_t fd;
+        void *buf;
+        size_t count;
+        off_t offset;
+
+        // Only valid on return. Can be used to determine success or failure.
+        int64_t io_result;
+
+        DISABLE_COPYING(action_t);
+    };
+
+    linux_diskmgr_uring_t(linux_event_queue_t *queue, passive_producer_t<action_t *> *source);
+    ~linux_diskmgr_uring_t();
+
+    boost::function<void(action_t *)> done_fun;
+
+private:
+    void on_source_availability_changed();
+    void on_event(int events);
+
+    // Moves operations from `source` into the submission ring and submits them.
+    void pump();
+
+    static void on_retry_timer(void *ctx);
+
+    linux_event_queue_t *queue;
+    passive_producer_t<action_t *> *source;
+
+    linux_uring_t ring;
+
+    // Operations that are in the ring (submitted or not) but not completed.
+    int n_pending;
+
+    // Set while we wait to try a submission that the kernel turned away again.
+    timer_token_t *retry_timer;
+
+    DISABLE_COPYING(linux_diskmgr_uring_t);
+};
+
+#endif // URINGSUPPORT
+#endif // ARCH_IO_DISK_URING_HPP_
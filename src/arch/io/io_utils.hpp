@@ -6,7 +6,7 @@
 
 /* Types of IO backends */
 enum linux_io_backend_t {
-    AIO_BACKEND_MIN_BOUND = 0, aio_native = 0, aio_default = 1, aio_pool = 1, AIO_BACKEND_MAX_BOUND = 1
+    AIO_BACKEND_MIN_BOUND = 0, aio_native = 0, aio_default = 1, aio_pool = 1, aio_uring = 2, AIO_BACKEND_MAX_BOUND = 2
 };
 typedef linux_io_backend_t io_backend_t;
 
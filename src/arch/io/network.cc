@@ -147,6 +147,7 @@ size_t linux_tcp_conn_t::read_internal(void *buffer, size_t size) THROWS_ONLY(tc
 
             linux_event_watcher_t::watch_t watch(event_watcher.get(), poll_event_in);
             wait_any_t waiter(&watch, &read_closed);
+            coro_wait_reason_tag_t wait_reason(coro_wait_reason_network);
             waiter.wait_lazily_unordered();
 
             if (read_closed.is_pulsed()) {
@@ -328,6 +329,7 @@ void linux_tcp_conn_t::perform_write(const void *buf, size_t size) {
             shut down */
             linux_event_watcher_t::watch_t watch(event_watcher.get(), poll_event_out);
             wait_any_t waiter(&watch, &write_closed);
+            coro_wait_reason_tag_t wait_reason(coro_wait_reason_network);
             waiter.wait_lazily_unordered();
 
             if (write_closed.is_pulsed()) {
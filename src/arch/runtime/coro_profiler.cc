@@ -0,0 +1,283 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#include "arch/runtime/coro_profiler.hpp"
+
+#include <algorithm>
+
+#include "config/args.hpp"
+#include "perfmon/perfmon.hpp"
+
+/* These three are shared by every thread, and any thread may change them, so
+they're only ever accessed atomically. */
+static bool profiler_enabled = false;
+
+/* Incremented every time the profiler is turned on, so that coroutines don't
+account for time that passed while it was off. */
+static int profiler_enable_epoch = 0;
+
+/* Incremented by `reset_coro_profiler()`. Each thread notices that it changed
+and clears its own data, so we never touch another thread's data. */
+static int profiler_reset_epoch = 0;
+
+static int current_enable_epoch() {
+    return __atomic_load_n(&profiler_enable_epoch, __ATOMIC_ACQUIRE);
+}
+
+struct thread_profile_data_t {
+    thread_profile_data_t() : reset_epoch(0) { }
+
+    int reset_epoch;
+    coro_profile_t total;
+    /* Keyed by `__PRETTY_FUNCTION__` pointer, so that recording doesn't have to
+    look at the string. */
+    std::map<const char *, coro_profile_t> by_type;
+};
+
+static thread_profile_data_t thread_profiles[MAX_THREADS];
+
+static thread_profile_data_t *get_thread_profile_data() {
+    rassert(get_thread_id() >= 0);
+    thread_profile_data_t *data = &thread_profiles[get_thread_id()];
+    const int reset_epoch = __atomic_load_n(&profiler_reset_epoch, __ATOMIC_ACQUIRE);
+    if (data->reset_epoch != reset_epoch) {
+        data->reset_epoch = reset_epoch;
+        data->total = coro_profile_t();
+        data->by_type.clear();
+    }
+    return data;
+}
+
+const char *coro_wait_reason_name(coro_wait_reason_t reason) {
+    switch (reason) {
+    case coro_wait_reason_other: return "other";
+    case coro_wait_reason_disk: return "disk";
+    case coro_wait_reason_network: return "network";
+    case coro_wait_reason_mutex: return "mutex";
+    case coro_wait_reason_fifo_enforcer: return "fifo_enforcer";
+    case coro_wait_reason_count:
+    default:
+        unreachable();
+    }
+}
+
+coro_profile_t::coro_profile_t()
+    : running(0), runnable(0), blocked(0), resumes(0) {
+    std::fill(blocked_by_reason, blocked_by_reason + coro_wait_reason_count, 0);
+}
+
+void coro_profile_t::add(const coro_profile_t &other) {
+    running += other.running;
+    runnable += other.runnable;
+    blocked += other.blocked;
+    for (int i = 0; i < coro_wait_reason_count; ++i) {
+        blocked_by_reason[i] += other.blocked_by_reason[i];
+    }
+    resumes += other.resumes;
+}
+
+bool coro_profiler_enabled() {
+    return __atomic_load_n(&profiler_enabled, __ATOMIC_ACQUIRE);
+}
+
+void set_coro_profiler_enabled(bool enabled) {
+    /* The new epoch has to be visible by the time a thread sees that the
+    profiler is on, or it could account for time from before. */
+    if (enabled && !coro_profiler_enabled()) {
+        __sync_add_and_fetch(&profiler_enable_epoch, 1);
+    }
+    __atomic_store_n(&profiler_enabled, enabled, __ATOMIC_RELEASE);
+}
+
+void reset_coro_profiler() {
+    __sync_add_and_fetch(&profiler_reset_epoch, 1);
+}
+
+void get_coro_thread_profile(coro_thread_profile_t *out) {
+    thread_profile_data_t *data = get_thread_profile_data();
+    out->total = data->total;
+    out->by_type.clear();
+    for (std::map<const char *, coro_profile_t>::const_iterator it = data->by_type.begin();
+         it != data->by_type.end(); ++it) {
+        out->by_type[coro_type_name(it->first)].add(it->second);
+    }
+}
+
+std::string coro_type_name(const char *pretty_function) {
+    // GCC formats it as "static coro_t* coro_t::get_and_init_coro(const Callable&)
+    // [with Callable = <type>]", possibly with more "; <name> = <type>" bindings
+    // after the one we care about.
+    std::string pretty(pretty_function);
+    const std::string marker = "Callable = ";
+    size_t begin = pretty.find(marker);
+    if (begin == std::string::npos) {
+        return pretty;
+    }
+    begin += marker.size();
+    size_t end = pretty.find("; ", begin);
+    if (end == std::string::npos) {
+        end = pretty.rfind(']');
+        if (end == std::string::npos || end < begin) {
+            end = pretty.size();
+        }
+    }
+    return pretty.substr(begin, end - begin);
+}
+
+/* coro_profile_state_t */
+
+coro_profile_state_t::coro_profile_state_t()
+    : wait_reason(coro_wait_reason_other), type(NULL), epoch(0),
+      running_since(0), suspended_at(0), notified_at(0),
+      suspended_reason(coro_wait_reason_other) { }
+
+void coro_profile_state_t::on_spawn(const char *pretty_function) {
+    type = pretty_function;
+    wait_reason = coro_wait_reason_other;
+    epoch = current_enable_epoch();
+    running_since = notified_at = 0;
+    // Time between being spawned and first running counts as runnable.
+    suspended_at = coro_profiler_enabled() ? get_ticks() : 0;
+    suspended_reason = coro_wait_reason_other;
+}
+
+bool coro_profile_state_t::refresh_epoch() {
+    const int current = current_enable_epoch();
+    if (epoch == current) {
+        return true;
+    }
+    epoch = current;
+    running_since = suspended_at = notified_at = 0;
+    return false;
+}
+
+void coro_profile_state_t::record_wait() {
+    ticks_t now = get_ticks();
+    if (refresh_epoch() && running_since != 0) {
+        account_running(now);
+    }
+    running_since = 0;
+    suspended_at = now;
+    suspended_reason = wait_reason;
+}
+
+void coro_profile_state_t::record_notify() {
+    refresh_epoch();
+    notified_at = get_ticks();
+}
+
+void coro_profile_state_t::record_resume() {
+    ticks_t now = get_ticks();
+    refresh_epoch();
+
+    thread_profile_data_t *data = get_thread_profile_data();
+    coro_profile_t *profile = &data->by_type[type];
+    ++profile->resumes;
+    ++data->total.resumes;
+
+    if (suspended_at != 0) {
+        /* `notified_at` is earlier than `suspended_at` when the coroutine
+        notified itself before waiting, as in `coro_t::yield()`, and zero when
+        `notify_now_deprecated()` was called directly. */
+        ticks_t notified = notified_at == 0 ? now : std::max(notified_at, suspended_at);
+        ticks_t blocked = notified - suspended_at;
+        ticks_t runnable = now - notified;
+
+        profile->blocked += blocked;
+        profile->blocked_by_reason[suspended_reason] += blocked;
+        profile->runnable += runnable;
+        data->total.blocked += blocked;
+        data->total.blocked_by_reason[suspended_reason] += blocked;
+        data->total.runnable += runnable;
+    }
+
+    running_since = now;
+    suspended_at = notified_at = 0;
+}
+
+void coro_profile_state_t::record_finish() {
+    if (refresh_epoch() && running_since != 0) {
+        account_running(get_ticks());
+    }
+    running_since = 0;
+}
+
+void coro_profile_state_t::account_running(ticks_t now) {
+    thread_profile_data_t *data = get_thread_profile_data();
+    ticks_t running = now - running_since;
+    data->by_type[type].running += running;
+    data->total.running += running;
+}
+
+/* The perfmon stats. "total" adds up every thread; "threads" has the totals
+and the per-coroutine-type breakdown for each thread. */
+
+static perfmon_result_t *output_coro_profile(const coro_profile_t &profile) {
+    perfmon_result_t *result;
+    perfmon_result_t::alloc_map_result(&result);
+    result->insert("running_secs", new perfmon_result_t(strprintf("%.6f", ticks_to_secs(profile.running))));
+    result->insert("runnable_secs", new perfmon_result_t(strprintf("%.6f", ticks_to_secs(profile.runnable))));
+    result->insert("blocked_secs", new perfmon_result_t(strprintf("%.6f", ticks_to_secs(profile.blocked))));
+    result->insert("resumes", new perfmon_result_t(strprintf("%" PRIi64, profile.resumes)));
+
+    perfmon_result_t *blocked_on;
+    perfmon_result_t::alloc_map_result(&blocked_on);
+    for (int i = 0; i < coro_wait_reason_count; ++i) {
+        blocked_on->insert(coro_wait_reason_name(static_cast<coro_wait_reason_t>(i)),
+                           new perfmon_result_t(strprintf("%.6f", ticks_to_secs(profile.blocked_by_reason[i]))));
+    }
+    result->insert("blocked_secs_by_reason", blocked_on);
+    return result;
+}
+
+class perfmon_coro_profile_t : public perfmon_t {
+public:
+    explicit perfmon_coro_profile_t(bool _per_thread) : per_thread(_per_thread) { }
+
+    void *begin_stats() {
+        return new coro_thread_profile_t[get_num_threads()];
+    }
+    void visit_stats(void *data) {
+        get_coro_thread_profile(&static_cast<coro_thread_profile_t *>(data)[get_thread_id()]);
+    }
+    perfmon_result_t *end_stats(void *v_data) {
+        coro_thread_profile_t *data = static_cast<coro_thread_profile_t *>(v_data);
+        perfmon_result_t *result;
+        if (per_thread) {
+            perfmon_result_t::alloc_map_result(&result);
+            for (int i = 0; i < get_num_threads(); ++i) {
+                perfmon_result_t *thread = output_coro_profile(data[i].total);
+                perfmon_result_t *types;
+                perfmon_result_t::alloc_map_result(&types);
+                for (std::map<std::string, coro_profile_t>::const_iterator it = data[i].by_type.begin();
+                     it != data[i].by_type.end(); ++it) {
+                    types->insert(it->first, output_coro_profile(it->second));
+                }
+                thread->insert("coroutine_types", types);
+                result->insert(strprintf("%d", i), thread);
+            }
+        } else {
+            coro_profile_t total;
+            for (int i = 0; i < get_num_threads(); ++i) {
+                total.add(data[i].total);
+            }
+            result = output_coro_profile(total);
+            result->insert("enabled", new perfmon_result_t(coro_profiler_enabled() ? "true" : "false"));
+        }
+        delete[] data;
+        return result;
+    }
+
+private:
+    bool per_thread;
+
+    DISABLE_COPYING(perfmon_coro_profile_t);
+};
+
+static perfmon_collection_t pm_coro_profiler_collection;
+static perfmon_membership_t pm_coro_profiler_membership(&get_global_perfmon_collection(),
+    &pm_coro_profiler_collection, "coroutine_profiler");
+
+static perfmon_coro_profile_t pm_coro_profile_total(false), pm_coro_profile_threads(true);
+static perfmon_multi_membership_t pm_coro_profile_membership(&pm_coro_profiler_collection,
+    &pm_coro_profile_total, "total",
+    &pm_coro_profile_threads, "threads",
+    NULLPTR);
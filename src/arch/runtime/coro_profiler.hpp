@@ -0,0 +1,129 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#ifndef ARCH_RUNTIME_CORO_PROFILER_HPP_
+#define ARCH_RUNTIME_CORO_PROFILER_HPP_
+
+#include <map>
+#include <string>
+
+#include "utils.hpp"
+
+/* The coroutine profiler records, for each thread and for each type of
+coroutine (the `Callable` type that was passed to `coro_t::spawn_*()`), how much
+time coroutines spend running, runnable (notified, but waiting for the thread to
+get around to them), and blocked in `coro_t::wait()`. Blocked time is further
+broken down by the reason the coroutine was waiting; see
+`coro_wait_reason_tag_t`.
+
+Rather than sampling, the profiler takes a timestamp whenever a coroutine is
+suspended, notified, or resumed; every interesting event in a coroutine's life
+happens at one of those points anyway. It is off by default, in which case it
+costs one branch per context switch. The results show up in the perfmon stats
+under "coroutine_profiler", and the admin HTTP server can render them as a flame
+graph. */
+
+enum coro_wait_reason_t {
+    coro_wait_reason_other = 0,
+    coro_wait_reason_disk,
+    coro_wait_reason_network,
+    coro_wait_reason_mutex,
+    coro_wait_reason_fifo_enforcer,
+
+    coro_wait_reason_count
+};
+
+const char *coro_wait_reason_name(coro_wait_reason_t reason);
+
+/* If a `coro_wait_reason_tag_t` is alive in a coroutine, any time that the
+coroutine spends blocked is attributed to the given reason. Tags nest; the
+innermost one wins. Outside of a coroutine they do nothing. */
+class coro_wait_reason_tag_t {
+public:
+    explicit coro_wait_reason_tag_t(coro_wait_reason_t reason);
+    ~coro_wait_reason_tag_t();
+
+private:
+    coro_wait_reason_t old_reason;
+
+    DISABLE_COPYING(coro_wait_reason_tag_t);
+};
+
+/* All of the times are in ticks. */
+struct coro_profile_t {
+    coro_profile_t();
+    void add(const coro_profile_t &other);
+
+    ticks_t running, runnable, blocked;
+    ticks_t blocked_by_reason[coro_wait_reason_count];
+
+    /* The number of times a coroutine was switched into. */
+    int64_t resumes;
+};
+
+/* What the profiler recorded on one thread. Coroutine types are keyed by the
+name that `coro_type_name()` returns. */
+struct coro_thread_profile_t {
+    coro_profile_t total;
+    std::map<std::string, coro_profile_t> by_type;
+};
+
+bool coro_profiler_enabled();
+void set_coro_profiler_enabled(bool enabled);
+
+/* Throws away everything that has been recorded so far, on every thread. */
+void reset_coro_profiler();
+
+/* Copies out what has been recorded on the current thread. */
+void get_coro_thread_profile(coro_thread_profile_t *out);
+
+/* Turns the `__PRETTY_FUNCTION__` of `coro_t::get_and_init_coro()` into the name
+of the coroutine's `Callable` type. */
+std::string coro_type_name(const char *pretty_function);
+
+/* The bookkeeping that the profiler does for each `coro_t`. The `on_*()`
+methods are called by `coro_t` as the coroutine changes state. */
+class coro_profile_state_t {
+public:
+    coro_profile_state_t();
+
+    void on_spawn(const char *pretty_function);
+    void on_wait() {
+        if (coro_profiler_enabled()) record_wait();
+    }
+    void on_notify() {
+        if (coro_profiler_enabled()) record_notify();
+    }
+    void on_resume() {
+        if (coro_profiler_enabled()) record_resume();
+    }
+    void on_finish() {
+        if (coro_profiler_enabled()) record_finish();
+    }
+
+    coro_wait_reason_t wait_reason;
+
+private:
+    void record_wait();
+    void record_notify();
+    void record_resume();
+    void record_finish();
+
+    /* Returns false, and forgets the timestamps, if they were taken before
+    the profiler was last turned on. */
+    bool refresh_epoch();
+    void account_running(ticks_t now);
+
+    /* Points into the text segment; it's the `__PRETTY_FUNCTION__` of the
+    `get_and_init_coro()` instantiation that made the coroutine. */
+    const char *type;
+
+    /* Timestamps are only meaningful if `epoch` matches the profiler's current
+    epoch, which changes every time the profiler is turned on. Zero means that
+    the event hasn't happened. */
+    int epoch;
+    ticks_t running_since, suspended_at, notified_at;
+    coro_wait_reason_t suspended_reason;
+
+    DISABLE_COPYING(coro_profile_state_t);
+};
+
+#endif  // ARCH_RUNTIME_CORO_PROFILER_HPP_
@@ -122,7 +122,8 @@ coro_t::coro_t() :
     stack(&coro_t::run, coro_stack_size),
     current_thread_(linux_thread_pool_t::thread_id),
     notified_(false),
-    waiting_(false)
+    waiting_(false),
+    stealable_(false)
 #ifndef NDEBUG
     , selfname_number(get_thread_id() + MAX_THREADS * ++coro_selfname_counter)
 #endif
@@ -165,6 +166,7 @@ void coro_t::run() {
         rassert(coro->notified_ == false);
         rassert(coro->waiting_ == true);
         coro->waiting_ = false;
+        coro->profile_state_.on_resume();
 
 #ifndef NDEBUG
         // Keep track of how many coroutines of each type ran
@@ -173,6 +175,7 @@ void coro_t::run() {
         cglobals->active_coroutines.insert(coro);
 #endif
         coro->action_wrapper.run();
+        coro->profile_state_.on_finish();
 #ifndef NDEBUG
         // Pet the watchdog to reset it before execution moves
         pet_watchdog();
@@ -225,6 +228,7 @@ void coro_t::wait() {   /* class method */
 
     rassert(!self()->waiting_);
     self()->waiting_ = true;
+    self()->profile_state_.on_wait();
 
 #ifndef NDEBUG
         // Pet the watchdog to reset it before execution moves
@@ -240,6 +244,7 @@ void coro_t::wait() {   /* class method */
     rassert(self());
     rassert(self()->waiting_);
     self()->waiting_ = false;
+    self()->profile_state_.on_resume();
 }
 
 void coro_t::yield() {  /* class method */
@@ -264,6 +269,12 @@ void coro_t::notify_now_deprecated() {
     cglobals->assert_finite_coro_waiting_counter = 0;
 #endif
 
+    /* The coroutine that is transferring control, if any, can't run again
+    until `this` waits, so as far as the profiler is concerned it's blocked. */
+    if (cglobals->current_coro) {
+        cglobals->current_coro->profile_state_.on_wait();
+    }
+
     coro_t *prev_prev_coro = cglobals->prev_coro;
     cglobals->prev_coro = cglobals->current_coro;
     cglobals->current_coro = this;
@@ -283,6 +294,10 @@ void coro_t::notify_now_deprecated() {
     cglobals->current_coro = cglobals->prev_coro;
     cglobals->prev_coro = prev_prev_coro;
 
+    if (cglobals->current_coro) {
+        cglobals->current_coro->profile_state_.on_resume();
+    }
+
 #ifndef NDEBUG
     /* Restore old value of `assert_finite_coro_waiting_counter`. */
     cglobals->assert_finite_coro_waiting_counter = old_assert_finite_coro_waiting_counter;
@@ -295,12 +310,14 @@ void coro_t::notify_sometime() {
 
     rassert(!notified_);
     notified_ = true;
+    profile_state_.on_notify();
     linux_thread_pool_t::thread->message_hub.store_message_sometime(current_thread_, this);
 }
 
 void coro_t::notify_later_ordered() {
     rassert(!notified_);
     notified_ = true;
+    profile_state_.on_notify();
 
     /* `current_thread` is the thread that the coroutine lives on, which may or may not be the
     same as `get_thread_id()`.  (In a call to move_to_thread, it won't be.) */
@@ -319,10 +336,32 @@ void coro_t::move_to_thread(int thread) {
     wait();
 }
 
+void coro_t::move_to_any_thread() {
+    rassert(coro_t::self(), "coro_t::move_to_any_thread() called when not in a coroutine.");
+    if (!linux_thread_pool_t::thread_pool->work_stealing ||
+        !linux_thread_pool_t::thread->message_hub.other_thread_is_idle()) {
+        // Nobody could steal us, so there's no point in going through the queue.
+        return;
+    }
+    coro_t *coro = self();
+    rassert(!coro->notified_);
+    coro->notified_ = true;
+    coro->stealable_ = true;
+    coro->profile_state_.on_notify();
+    linux_thread_pool_t::thread->message_hub.store_stealable_message(coro);
+    wait();
+}
+
 void coro_t::on_thread_switch() {
     rassert(notified_);
     notified_ = false;
 
+    if (stealable_) {
+        // Whichever thread delivered us is now our thread.
+        stealable_ = false;
+        current_thread_ = linux_thread_pool_t::thread_id;
+    }
+
     /* TODO: When `notify_now_deprecated()` is finally removed, just fold it
     into this function. */
     notify_now_deprecated();
@@ -336,6 +375,20 @@ artificial_stack_t* coro_t::get_stack() {
     return &stack;
 }
 
+coro_wait_reason_tag_t::coro_wait_reason_tag_t(coro_wait_reason_t reason)
+    : old_reason(coro_wait_reason_other) {
+    if (coro_t *self = coro_t::self()) {
+        old_reason = self->profile_state_.wait_reason;
+        self->profile_state_.wait_reason = reason;
+    }
+}
+
+coro_wait_reason_tag_t::~coro_wait_reason_tag_t() {
+    if (coro_t *self = coro_t::self()) {
+        self->profile_state_.wait_reason = old_reason;
+    }
+}
+
 /* Called by SIGSEGV handler to identify segfaults that come from overflowing a coroutine's
 stack. Could also in theory be used by a function to check if it's about to overflow
 the stack. */
@@ -364,6 +417,7 @@ coro_t * coro_t::get_coro() {
     coro->current_thread_ = get_thread_id();
     coro->notified_ = false;
     coro->waiting_ = true;
+    coro->stealable_ = false;
 
     ++pm_active_coroutines;
     return coro;
@@ -8,6 +8,7 @@
 
 #include "arch/runtime/runtime_utils.hpp"
 #include "arch/runtime/context_switching.hpp"
+#include "arch/runtime/coro_profiler.hpp"
 #include "utils.hpp"
 
 const size_t MAX_COROUTINE_STACK_SIZE = 8*1024*1024;
@@ -113,8 +114,14 @@ private:
     the given thread and then suspends the coroutine until that other thread
     picks it up again. Do not call this directly; use `on_thread_t` instead. */
     friend class on_thread_t;
+    friend class on_any_thread_t;
     static void move_to_thread(int thread);
 
+    /* If work stealing is on and some other thread is idle, offers the current
+    coroutine to be stolen and suspends it until some thread (possibly this
+    one) picks it up. Otherwise does nothing. Use `on_any_thread_t`. */
+    static void move_to_any_thread();
+
     // Contructor sets up the stack, get_and_init_coro will load a function to be run
     //  at which point the coroutine can be notified
     coro_t();
@@ -126,6 +133,7 @@ private:
 #ifndef NDEBUG
         coro->parse_coroutine_type(__PRETTY_FUNCTION__);
 #endif
+        coro->profile_state_.on_spawn(__PRETTY_FUNCTION__);
         coro->action_wrapper.reset(action);
         return coro;
     }
@@ -137,6 +145,7 @@ private:
     static void run() NORETURN;
 
     friend struct coro_globals_t;
+    friend class coro_wait_reason_tag_t;
     ~coro_t();
 
     virtual void on_thread_switch();
@@ -149,8 +158,14 @@ private:
     bool notified_;
     bool waiting_;
 
+    // True while the coroutine is queued as a stealable message, and so may be
+    // delivered on a thread other than `current_thread_`.
+    bool stealable_;
+
     callable_action_wrapper_t action_wrapper;
 
+    coro_profile_state_t profile_state_;
+
 #ifndef NDEBUG
     int64_t selfname_number;
     std::string coroutine_type;
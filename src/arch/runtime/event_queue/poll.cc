@@ -91,6 +91,8 @@ void poll_event_queue_t::run() {
         // have no way of handling, and it's probably fatal.
         guarantee_err(res != -1, "Waiting for poll events failed");
 
+        parent->on_wake_up();
+
         block_pm_duration event_loop_timer(&pm_eventloop);
 
         int count = 0;
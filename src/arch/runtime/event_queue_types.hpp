@@ -23,7 +23,10 @@ private:
 };
 
 struct linux_queue_parent_t {
+    // Called after every batch of events, right before the queue blocks again.
     virtual void pump() = 0;
+    // Called whenever the queue stops blocking.
+    virtual void on_wake_up() = 0;
     virtual bool should_shut_down() = 0;
     virtual ~linux_queue_parent_t() {}
 };
@@ -15,24 +15,16 @@
 #endif
 
 linux_message_hub_t::linux_message_hub_t(linux_event_queue_t *queue, linux_thread_pool_t *thread_pool, int current_thread)
-    : queue_(queue), thread_pool_(thread_pool), current_thread_(current_thread) {
+    : queue_(queue), thread_pool_(thread_pool), incoming_head_(NULL), sleeping_(1),
+      n_stealable_messages_(0), idle_(0), current_thread_(current_thread) {
 
-    // We have to do this through dynamically, otherwise we might
-    // allocate far too many file descriptors since this is what the
-    // constructor of the system_event_t object (which is a member of
-    // notify_t) does.
-    notify_ = new notify_t[thread_pool_->n_threads];
+    // Create notify fd for other cores that send work to us
+    notify_.parent = this;
+    queue_->watch_resource(notify_.event.get_notify_fd(), poll_event_in, &notify_);
 
-    for (int i = 0; i < thread_pool_->n_threads; i++) {
-        int res = pthread_spin_init(&incoming_messages_lock_, PTHREAD_PROCESS_PRIVATE);
-        guarantee(res == 0, "Could not initialize spin lock");
-
-        // Create notify fd for other cores that send work to us
-        notify_[i].notifier_thread = i;
-        notify_[i].parent = this;
-
-        queue_->watch_resource(notify_[i].event.get_notify_fd(), poll_event_in, &notify_[i]);
-    }
+    int res = pthread_spin_init(&stealable_messages_lock_, PTHREAD_PROCESS_PRIVATE);
+    guarantee(res == 0, "Could not initialize spin lock");
+    queue_->watch_resource(steal_notify_.event.get_notify_fd(), poll_event_in, &steal_notify_);
 }
 
 linux_message_hub_t::~linux_message_hub_t() {
@@ -40,14 +32,14 @@ linux_message_hub_t::~linux_message_hub_t() {
 
     for (int i = 0; i < thread_pool_->n_threads; i++) {
         rassert(queues_[i].msg_local_list.empty());
-
-        res = pthread_spin_destroy(&incoming_messages_lock_);
-        guarantee(res == 0, "Could not destroy spin lock");
     }
 
-    rassert(incoming_messages_.empty());
+    rassert(incoming_head_ == NULL);
 
-    delete[] notify_;
+    rassert(pending_stealable_messages_.empty());
+    rassert(stealable_messages_.empty());
+    res = pthread_spin_destroy(&stealable_messages_lock_);
+    guarantee(res == 0, "Could not destroy spin lock");
 }
 
 void linux_message_hub_t::do_store_message(unsigned int nthread, linux_thread_message_t *msg) {
@@ -90,12 +82,54 @@ void linux_message_hub_t::store_message_sometime(unsigned int nthread, linux_thr
 
 
 void linux_message_hub_t::insert_external_message(linux_thread_message_t *msg) {
-    pthread_spin_lock(&incoming_messages_lock_);
-    incoming_messages_.push_back(msg);
-    pthread_spin_unlock(&incoming_messages_lock_);
+    msg->next_incoming_ = NULL;
+    push_incoming(msg, msg);
+}
+
+void linux_message_hub_t::push_incoming(linux_thread_message_t *first, linux_thread_message_t *last) {
+    // Chain the batch onto whatever is already there. The CAS is a full barrier,
+    // so the receiver sees the links once it sees the batch.
+    linux_thread_message_t *old_head;
+    do {
+        old_head = incoming_head_;
+        first->next_incoming_ = old_head;
+    } while (!__sync_bool_compare_and_swap(&incoming_head_, old_head, last));
+
+    // If the receiver is running, it will check its queue before it goes back to
+    // sleep (see `prepare_to_sleep()`), so there's no need to signal it. Whoever
+    // flips `sleeping_` gets to do the one wake up.
+    if (sleeping_ && __sync_bool_compare_and_swap(&sleeping_, 1, 0)) {
+        // Wakey wakey eggs and bakey
+        notify_.event.write(1);
+    }
+}
+
+void linux_message_hub_t::pop_all_incoming(msg_list_t *out) {
+    linux_thread_message_t *m = __sync_lock_test_and_set(&incoming_head_, static_cast<linux_thread_message_t *>(NULL));
+
+    // The stack has the newest message on top; turn it back around.
+    msg_list_t reversed;
+    while (m) {
+        linux_thread_message_t *next = m->next_incoming_;
+        m->next_incoming_ = NULL;
+        reversed.push_front(m);
+        m = next;
+    }
+    out->append_and_clear(&reversed);
+}
+
+void linux_message_hub_t::prepare_to_sleep() {
+    __sync_lock_test_and_set(&sleeping_, 1);
+    // This pairs with the CAS in `push_incoming()`: either the sender sees that
+    // we're asleep, or we see its messages here.
+    __sync_synchronize();
+    if (incoming_head_ != NULL && __sync_bool_compare_and_swap(&sleeping_, 1, 0)) {
+        notify_.event.write(1);
+    }
+}
 
-    // Wakey wakey eggs and bakey
-    notify_[current_thread_].event.write(1);
+void linux_message_hub_t::on_wake_up() {
+    sleeping_ = 0;
 }
 
 void linux_message_hub_t::notify_t::on_event(int events) {
@@ -108,13 +142,12 @@ void linux_message_hub_t::notify_t::on_event(int events) {
     // don't pester us and use 100% cpu
     event.read();
 
-    msg_list_t msg_list;
+    parent->deliver_incoming();
+}
 
-    pthread_spin_lock(&parent->incoming_messages_lock_);
-    // Pull the messages
-    //msg_list.append_and_clear(parent->thread_pool_->threads[parent->current_thread_]->message_hub);
-    msg_list.append_and_clear(&parent->incoming_messages_);
-    pthread_spin_unlock(&parent->incoming_messages_lock_);
+void linux_message_hub_t::deliver_incoming() {
+    msg_list_t msg_list;
+    pop_all_incoming(&msg_list);
 
 #ifndef NDEBUG
     start_watchdog(); // Initialize watchdog before handling messages
@@ -125,7 +158,7 @@ void linux_message_hub_t::notify_t::on_event(int events) {
 #ifndef NDEBUG
         if (m->reloop_count_ > 0) {
             --m->reloop_count_;
-            parent->do_store_message(parent->current_thread_, m);
+            do_store_message(current_thread_, m);
             continue;
         }
 #endif
@@ -138,32 +171,134 @@ void linux_message_hub_t::notify_t::on_event(int events) {
     }
 }
 
-// Pushes messages collected locally global lists available to all
-// threads.
+// Pushes messages collected locally onto the incoming queues of the threads
+// they are going to.
 void linux_message_hub_t::push_messages() {
     for (int i = 0; i < thread_pool_->n_threads; i++) {
-        // Append the local list for ith thread to that thread's global
-        // message list.
         thread_queue_t *queue = &queues_[i];
         if (!queue->msg_local_list.empty()) {
+            // Link the messages up oldest first, so that the whole batch goes
+            // over with a single CAS.
+            linux_thread_message_t *first = queue->msg_local_list.head();
+            linux_thread_message_t *last = NULL;
+            while (linux_thread_message_t *m = queue->msg_local_list.head()) {
+                queue->msg_local_list.remove(m);
+                m->next_incoming_ = last;
+                last = m;
+            }
+
             // Transfer messages to the other core
+            thread_pool_->threads[i]->message_hub.push_incoming(first, last);
+        }
+    }
+}
+
+bool linux_message_hub_t::other_thread_is_idle() const {
+    for (int i = 0; i < thread_pool_->n_threads; i++) {
+        if (i != static_cast<int>(current_thread_) && thread_pool_->threads[i]->message_hub.idle_) {
+            return true;
+        }
+    }
+    return false;
+}
 
-            pthread_spin_lock(&thread_pool_->threads[i]->message_hub.incoming_messages_lock_);
+void linux_message_hub_t::store_stealable_message(linux_thread_message_t *msg) {
+    rassert(thread_pool_->work_stealing);
+    pending_stealable_messages_.push_back(msg);
+}
 
-            //We only need to do a wake up if the global
-            bool do_wake_up = thread_pool_->threads[i]->message_hub.incoming_messages_.empty();
+linux_thread_message_t *linux_message_hub_t::pop_stealable_message() {
+    pthread_spin_lock(&stealable_messages_lock_);
+    linux_thread_message_t *m = stealable_messages_.head();
+    if (m) {
+        stealable_messages_.remove(m);
+        --n_stealable_messages_;
+    }
+    pthread_spin_unlock(&stealable_messages_lock_);
+    return m;
+}
+
+linux_message_hub_t *linux_message_hub_t::find_busiest_hub() {
+    linux_message_hub_t *busiest = NULL;
+    int most = 0;
+    for (int i = 0; i < thread_pool_->n_threads; i++) {
+        linux_message_hub_t *hub = &thread_pool_->threads[i]->message_hub;
+        if (hub != this && hub->n_stealable_messages_ > most) {
+            busiest = hub;
+            most = hub->n_stealable_messages_;
+        }
+    }
+    return busiest;
+}
 
-            thread_pool_->threads[i]->message_hub.incoming_messages_.append_and_clear(&queue->msg_local_list);
+void linux_message_hub_t::wake_idle_threads(int count) {
+    for (int j = 1; j < thread_pool_->n_threads && count > 0; j++) {
+        linux_message_hub_t *hub = &thread_pool_->threads[(current_thread_ + j) % thread_pool_->n_threads]->message_hub;
+        if (hub->idle_ && __sync_bool_compare_and_swap(&hub->idle_, 1, 0)) {
+            hub->steal_notify_.event.write(1);
+            --count;
+        }
+    }
+}
 
-            pthread_spin_unlock(&thread_pool_->threads[i]->message_hub.incoming_messages_lock_);
+void linux_message_hub_t::balance_work() {
+    idle_ = 0;
+
+    // Publish what was queued since last time. We don't deliver any of our own
+    // messages on this pass, so that the threads we wake get a fair shot at them;
+    // we come right back around to deliver whatever they leave.
+    if (!pending_stealable_messages_.empty()) {
+        int count = pending_stealable_messages_.size();
+        pthread_spin_lock(&stealable_messages_lock_);
+        stealable_messages_.append_and_clear(&pending_stealable_messages_);
+        n_stealable_messages_ += count;
+        pthread_spin_unlock(&stealable_messages_lock_);
+
+        wake_idle_threads(count);
+        steal_notify_.event.write(1);
+        return;
+    }
 
-            // Wakey wakey, perhaps eggs and bakey
-            if (do_wake_up) {
-                thread_pool_->threads[i]->message_hub.notify_[current_thread_].event.write(1);
-            }
+    // Deliver our own messages, taking them one at a time so other threads can
+    // still steal the rest in the meantime.
+    for (int count = n_stealable_messages_; count > 0; --count) {
+        linux_thread_message_t *m = pop_stealable_message();
+        if (!m) {
+            break;
         }
+        m->on_thread_switch();
+    }
+
+    if (!pending_stealable_messages_.empty()) {
+        steal_notify_.event.write(1);
+        return;
+    }
+
+    // Help out another thread. Only take one message per pass so we don't
+    // starve our own event queue.
+    if (linux_message_hub_t *victim = find_busiest_hub()) {
+        if (linux_thread_message_t *m = victim->pop_stealable_message()) {
+            m->on_thread_switch();
+            steal_notify_.event.write(1);
+            return;
+        }
+    }
 
-        // TODO: we should use regular mutexes on single core CPU
-        // instead of spinlocks
+    // We have nothing to do. Whoever publishes stealable messages after this
+    // point will see that we are idle; in case somebody published them before
+    // then but after we looked, look again.
+    __sync_lock_test_and_set(&idle_, 1);
+    if (find_busiest_hub() != NULL && __sync_bool_compare_and_swap(&idle_, 1, 0)) {
+        steal_notify_.event.write(1);
     }
 }
+
+void linux_message_hub_t::steal_notify_t::on_event(int events) {
+    if (events != poll_event_in) {
+        logERR("Unexpected event mask: %d", events);
+    }
+
+    // There's nothing else to do here; the event queue calls `balance_work()` (by
+    // way of `linux_thread_t::pump()`) after every batch of events.
+    event.read();
+}
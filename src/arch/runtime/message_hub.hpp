@@ -19,7 +19,12 @@ class linux_thread_pool_t;
 /* There is one message hub per thread, NOT one message hub for the entire program.
 
 Each message hub stores messages that are going from that message hub's home thread to
-other threads. It keeps a separate queue for messages destined for each other thread. */
+other threads. It keeps a separate queue for messages destined for each other thread.
+
+Messages going into a thread land in its hub's incoming queue, which any thread can
+push onto without taking a lock. The hub's thread only has to be woken up through its
+eventfd if it is blocked waiting for events; while it's running, it will find the
+messages on its own before it goes back to sleep. */
 
 class linux_message_hub_t {
 public:
@@ -27,10 +32,16 @@ public:
 
     linux_message_hub_t(linux_event_queue_t *queue, linux_thread_pool_t *thread_pool, int current_thread);
 
-    /* For each thread, transfer messages from our msg_local_list for that thread to our
-    msg_global_list for that thread */
+    /* For each thread, transfer messages from our msg_local_list for that thread to
+    that thread's incoming queue */
     void push_messages();
 
+    /* Called by the thread right before it blocks waiting for events, and right
+    after it wakes up, respectively. Other threads only bother to signal us while
+    we are between the two. */
+    void prepare_to_sleep();
+    void on_wake_up();
+
     /* Schedules the given message to be sent to the given thread by pushing it onto our
     msg_local_list for that thread */
     void store_message(unsigned int nthread, linux_thread_message_t *msg);
@@ -43,6 +54,25 @@ public:
     // (which does not have an event queue)
     void insert_external_message(linux_thread_message_t *msg);
 
+    /* The rest of the public interface is for work stealing (see
+    `linux_thread_pool_t::work_stealing`). A stealable message is one that may be
+    delivered on any thread at all; `coro_t` uses them for coroutines that are
+    inside an `on_any_thread_t`. */
+
+    // True if some other thread has run out of work. It's only a hint.
+    bool other_thread_is_idle() const;
+
+    // Schedules the given message to be delivered on this thread or on whichever
+    // idle thread gets to it first. The message isn't visible to other threads until
+    // the next `balance_work()`, so a coroutine can pass itself in before waiting.
+    void store_stealable_message(linux_thread_message_t *msg);
+
+    // Called by the thread after every pass through its event loop. Publishes new
+    // stealable messages and delivers our own; if we don't have any, steals one
+    // from the busiest other thread; if there's nothing to steal either, marks this
+    // thread idle so that the next thread to publish stealable messages wakes it.
+    void balance_work();
+
     ~linux_message_hub_t();
 
 private:
@@ -51,11 +81,17 @@ private:
     void do_store_message(unsigned int nthread, linux_thread_message_t *msg);
 
 
-    /* pull_messages should be called on thread N with N as its argument. (The argument is
-    partially redundant.) It will cause the actual delivery of messages that originated
-    on this->current_thread and are destined for thread N. It is (almost) the only method on
-    linux_message_hub_t that is not called on the thread that the message hub belongs to. */
-    void pull_messages(int thread);
+    /* Pushes the chain of messages from `first` to `last` (linked through
+    `next_incoming_`, oldest first) onto our incoming queue, and wakes us up if
+    we're asleep. Can be called from any thread. */
+    void push_incoming(linux_thread_message_t *first, linux_thread_message_t *last);
+
+    /* Takes everything off of our incoming queue and appends it to `out` in the
+    order it was pushed. */
+    void pop_all_incoming(msg_list_t *out);
+
+    /* Delivers everything that's on our incoming queue. */
+    void deliver_incoming();
 
     linux_event_queue_t *const queue_;
     linux_thread_pool_t *const thread_pool_;
@@ -64,34 +100,60 @@ private:
     struct thread_queue_t {
         //TODO this doesn't need to be a class anymore
 
-        /* Messages are cached here before being pushed to the global list so that we don't
-        have to acquire the spinlock as often */
+        /* Messages are cached here before being pushed to the other thread's incoming
+        queue so that we touch shared memory less often */
         msg_list_t msg_local_list;
     } queues_[MAX_THREADS];
 
-    msg_list_t incoming_messages_;
-    pthread_spinlock_t incoming_messages_lock_;
+    /* The newest message that other threads (or we) pushed for us; each message
+    links to the one that was pushed before it. It's a Treiber stack that the
+    consumer empties all at once, so there's no ABA problem. */
+    linux_thread_message_t *volatile incoming_head_;
+
+    /* 1 if we are (or are about to be) blocked waiting for events. Whoever flips
+    it back to 0 has to wake us up through `notify_`. */
+    volatile int sleeping_;
 
-    /* We keep one notify_t for each other message hub that we interact with. When it has
-    messages for us, it signals the appropriate notify_t from our set of notify_ts. We get
-    the notification and call push_messages on the sender in reply. */
+    /* Other threads signal this when they push messages for us while we're asleep. */
     struct notify_t : public linux_event_callback_t
     {
     public:
-        /* message_hubs[i]->notify[j].on_event() is called when thread #j has messages for
-        thread #i. */
         void on_event(int events);
 
     public:
-        /* hub->notify[j].notifier_thread == j */
-        int notifier_thread;
-
         system_event_t event;                    // the eventfd to notify
 
-        /* hub->notify[i].parent = hub */
         linux_message_hub_t *parent;
-    };
-    notify_t *notify_;
+    } notify_;
+
+    // Takes the oldest message off of `stealable_messages_`, or returns NULL. Can be
+    // called from any thread.
+    linux_thread_message_t *pop_stealable_message();
+
+    // Returns the other thread with the most stealable messages, or NULL.
+    linux_message_hub_t *find_busiest_hub();
+
+    // Wakes up to `count` idle threads so they can come and steal work.
+    void wake_idle_threads(int count);
+
+    /* Stealable messages that we haven't published yet. */
+    msg_list_t pending_stealable_messages_;
+
+    /* Stealable messages that any thread may take. `n_stealable_messages_` is
+    only written with the lock held, but other threads read it without the lock
+    to decide whom to steal from. */
+    msg_list_t stealable_messages_;
+    pthread_spinlock_t stealable_messages_lock_;
+    volatile int n_stealable_messages_;
+
+    /* 1 if this thread ran out of work and is probably sleeping in the event
+    queue. Whoever flips it back to 0 has to wake us up through `steal_notify_`. */
+    volatile int idle_;
+
+    struct steal_notify_t : public linux_event_callback_t {
+        void on_event(int events);
+        system_event_t event;
+    } steal_notify_;
 
     /* The thread that we queue messages originating from. (Recall that there is one
     message_hub_t per thread.) */
@@ -56,8 +56,9 @@ private:
 };
 
 // Runs the action 'fun()' on thread zero.
-void run_in_thread_pool(const boost::function<void()>& fun, int worker_threads) {
+void run_in_thread_pool(const boost::function<void()>& fun, int worker_threads, bool work_stealing) {
     linux_thread_pool_t thread_pool(worker_threads, false);
+    thread_pool.work_stealing = work_stealing;
     starter_t starter(&thread_pool, fun);
     thread_pool.run_thread_pool(&starter);
 }
@@ -13,9 +13,10 @@ typedef int fd_t;
 
 class linux_thread_message_t : public intrusive_list_node_t<linux_thread_message_t> {
 public:
-    linux_thread_message_t() 
+    linux_thread_message_t()
+        : next_incoming_(NULL)
 #ifndef NDEBUG
-        : reloop_count_(0) 
+        , reloop_count_(0)
 #endif
         { }
     virtual void on_thread_switch() = 0;
@@ -23,6 +24,9 @@ protected:
     virtual ~linux_thread_message_t() {}
 private:
     friend class linux_message_hub_t;
+    /* Links the message into the receiving hub's incoming queue, which is
+    singly-linked so that it can be pushed onto without a lock. */
+    linux_thread_message_t *next_incoming_;
 #ifndef NDEBUG
     int reloop_count_;
 #endif
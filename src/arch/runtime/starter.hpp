@@ -9,8 +9,9 @@
 
 /* `run_in_thread_pool()` starts a RethinkDB thread pool, runs the given
 function in a coroutine inside of it, waits for the function to return, and then
-shuts down the thread pool. */
+shuts down the thread pool. `work_stealing` turns on
+`linux_thread_pool_t::work_stealing`. */
 
-void run_in_thread_pool(const boost::function<void()>& fun, int worker_threads);
+void run_in_thread_pool(const boost::function<void()>& fun, int worker_threads, bool work_stealing = false);
 
 #endif  // ARCH_RUNTIME_STARTER_HPP_
@@ -24,7 +24,8 @@ linux_thread_pool_t::linux_thread_pool_t(int worker_threads, bool _do_set_affini
       interrupt_message(NULL),
       generic_blocker_pool(NULL),
       n_threads(worker_threads + 1),    // we create an extra utility thread
-      do_set_affinity(_do_set_affinity)
+      do_set_affinity(_do_set_affinity),
+      work_stealing(false)
 {
     rassert(n_threads > 1);             // we want at least one non-utility thread
     rassert(n_threads <= MAX_THREADS);
@@ -388,6 +389,14 @@ linux_thread_t::~linux_thread_t() {
 
 void linux_thread_t::pump() {
     message_hub.push_messages();
+    if (linux_thread_pool_t::thread_pool->work_stealing) {
+        message_hub.balance_work();
+    }
+    message_hub.prepare_to_sleep();
+}
+
+void linux_thread_t::on_wake_up() {
+    message_hub.on_wake_up();
 }
 
 void linux_thread_t::on_event(int events) {
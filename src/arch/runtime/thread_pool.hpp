@@ -90,6 +90,10 @@ public:
 
     int n_threads;
     bool do_set_affinity;
+    // If true, threads that run out of work take coroutines that are inside an
+    // `on_any_thread_t` from threads that have a backlog. Set it before
+    // `run_thread_pool()`.
+    bool work_stealing;
     // The thread_pool that started the thread we are currently in
     static __thread linux_thread_pool_t *thread_pool;
     // The ID of the thread we are currently in
@@ -160,6 +164,7 @@ public:
     coro_runtime_t coro_runtime;
 
     void pump();   // Called by the event queue
+    void on_wake_up();   // Called by the event queue
     bool should_shut_down();   // Called by the event queue
 #ifndef NDEBUG
     void initiate_shut_down(std::map<std::string, size_t> *coroutine_counts); // Can be called from any thread
@@ -80,11 +80,7 @@ void btree_store_t<protocol_t>::read(
 
     check_metainfo(DEBUG_ONLY(metainfo_checker, ) txn.get(), superblock.get());
 
-    // Ugly hack
-    scoped_ptr_t<superblock_t> superblock2;
-    superblock2.init(superblock.release());
-
-    protocol_read(read, response, btree.get(), txn.get(), superblock2.get(), interruptor);
+    protocol_read(read, response, btree.get(), txn.get(), superblock.get(), interruptor);
 }
 
 template <class protocol_t>
@@ -109,6 +105,43 @@ void btree_store_t<protocol_t>::write(
     protocol_write(write, response, timestamp, btree.get(), txn.get(), superblock.get(), interruptor);
 }
 
+template <class protocol_t>
+void btree_store_t<protocol_t>::write_batch(
+        DEBUG_ONLY(const metainfo_checker_t<protocol_t>& metainfo_checker, )
+        const metainfo_t& new_metainfo,
+        const std::vector<typename protocol_t::write_t> &writes,
+        const std::vector<transition_timestamp_t> &timestamps,
+        std::vector<typename protocol_t::write_response_t> *responses,
+        UNUSED order_token_t order_token,
+        object_buffer_t<fifo_enforcer_sink_t::exit_write_t> *token,
+        signal_t *interruptor)
+        THROWS_ONLY(interrupted_exc_t) {
+    assert_thread();
+    guarantee(!writes.empty());
+    guarantee(writes.size() == timestamps.size());
+
+    /* The blocks the batch touches get the last write's timestamp. That's later
+    than the earlier writes' own timestamps, which only means a backfill may
+    send their keys again; the leaf entries still get their own timestamps. */
+    scoped_ptr_t<transaction_t> txn;
+    scoped_ptr_t<real_superblock_t> superblock;
+    const int expected_change_count = 2 * writes.size(); // FIXME: as in write(), this is a guess
+    acquire_superblock_for_write(rwi_write, timestamps.back().to_repli_timestamp(), expected_change_count, token, &txn, &superblock, interruptor);
+
+    check_and_update_metainfo(DEBUG_ONLY(metainfo_checker, ) new_metainfo, txn.get(), superblock.get());
+
+    /* Each write would normally let go of the superblock as soon as it has the
+    root. Holding on to it until the end keeps writes that come after the batch
+    from getting in between the writes in it. */
+    superblock->set_release_deferred(true);
+    responses->resize(writes.size());
+    for (size_t i = 0; i < writes.size(); ++i) {
+        rassert(i == 0 || timestamps[i - 1].timestamp_after() == timestamps[i].timestamp_before());
+        protocol_write(writes[i], &(*responses)[i], timestamps[i], btree.get(), txn.get(), superblock.get(), interruptor);
+    }
+    superblock->set_release_deferred(false);
+}
+
 // TODO: Figure out wtf does the backfill filtering, figure out wtf constricts delete range operations to hit only a certain hash-interval, figure out what filters keys.
 template <class protocol_t>
 bool btree_store_t<protocol_t>::send_backfill(
@@ -136,19 +169,39 @@ bool btree_store_t<protocol_t>::send_backfill(
 
 template <class protocol_t>
 void btree_store_t<protocol_t>::receive_backfill(
-        const typename protocol_t::backfill_chunk_t &chunk,
+        const std::vector<typename protocol_t::backfill_chunk_t> &chunks,
         object_buffer_t<fifo_enforcer_sink_t::exit_write_t> *token,
         signal_t *interruptor)
         THROWS_ONLY(interrupted_exc_t) {
     assert_thread();
+    guarantee(!chunks.empty());
+
+    /* The chunks aren't in timestamp order, so the blocks they touch get the
+    latest of their timestamps. As in `write_batch()`, that at worst means a
+    later backfill from here sends some keys again. Chunks that don't carry a
+    timestamp (deleted ranges) don't count. */
+    repli_timestamp_t timestamp = repli_timestamp_t::invalid;
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        const repli_timestamp_t chunk_timestamp = chunks[i].get_btree_repli_timestamp();
+        if (chunk_timestamp != repli_timestamp_t::invalid &&
+            (timestamp == repli_timestamp_t::invalid || timestamp < chunk_timestamp)) {
+            timestamp = chunk_timestamp;
+        }
+    }
 
     scoped_ptr_t<transaction_t> txn;
     scoped_ptr_t<real_superblock_t> superblock;
-    const int expected_change_count = 1; // FIXME: this is probably not correct
+    const int expected_change_count = chunks.size(); // FIXME: this is probably not correct
 
-    acquire_superblock_for_write(rwi_write, chunk.get_btree_repli_timestamp(), expected_change_count, token, &txn, &superblock, interruptor);
+    acquire_superblock_for_write(rwi_write, timestamp, expected_change_count, token, &txn, &superblock, interruptor);
 
-    protocol_receive_backfill(btree.get(), txn.get(), superblock.get(), interruptor, chunk);
+    /* Hold on to the superblock until the last chunk is in, so that the whole
+    batch goes in one transaction. */
+    superblock->set_release_deferred(true);
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        protocol_receive_backfill(btree.get(), txn.get(), superblock.get(), interruptor, chunks[i]);
+    }
+    superblock->set_release_deferred(false);
 }
 
 template <class protocol_t>
@@ -297,7 +350,10 @@ void btree_store_t<protocol_t>::acquire_superblock_for_read(
     btree->assert_thread();
 
     object_buffer_t<fifo_enforcer_sink_t::exit_read_t>::destruction_sentinel_t destroyer(token);
-    wait_interruptible(token->get(), interruptor);
+    {
+        coro_wait_reason_tag_t wait_reason(coro_wait_reason_fifo_enforcer);
+        wait_interruptible(token->get(), interruptor);
+    }
 
     order_token_t order_token = order_source.check_in("btree_store_t<" + protocol_t::protocol_name + ">::acquire_superblock_for_read").with_read_mode();
     order_token = btree->pre_begin_txn_checkpoint_.check_through(order_token);
@@ -320,7 +376,10 @@ void btree_store_t<protocol_t>::acquire_superblock_for_backfill(
     btree->assert_thread();
 
     object_buffer_t<fifo_enforcer_sink_t::exit_read_t>::destruction_sentinel_t destroyer(token);
-    wait_interruptible(token->get(), interruptor);
+    {
+        coro_wait_reason_tag_t wait_reason(coro_wait_reason_fifo_enforcer);
+        wait_interruptible(token->get(), interruptor);
+    }
 
     order_token_t order_token = order_source.check_in("btree_store_t<" + protocol_t::protocol_name + ">::acquire_superblock_for_backfill");
     order_token = btree->pre_begin_txn_checkpoint_.check_through(order_token);
@@ -343,7 +402,10 @@ void btree_store_t<protocol_t>::acquire_superblock_for_write(
     btree->assert_thread();
 
     object_buffer_t<fifo_enforcer_sink_t::exit_write_t>::destruction_sentinel_t destroyer(token);
-    wait_interruptible(token->get(), interruptor);
+    {
+        coro_wait_reason_tag_t wait_reason(coro_wait_reason_fifo_enforcer);
+        wait_interruptible(token->get(), interruptor);
+    }
 
     order_token_t order_token = order_source.check_in("btree_store_t<" + protocol_t::protocol_name + ">::acquire_superblock_for_write");
     order_token = btree->pre_begin_txn_checkpoint_.check_through(order_token);
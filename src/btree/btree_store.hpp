@@ -67,6 +67,17 @@ public:
             signal_t *interruptor)
         THROWS_ONLY(interrupted_exc_t);
 
+    void write_batch(
+            DEBUG_ONLY(const metainfo_checker_t<protocol_t>& metainfo_checker, )
+            const metainfo_t& new_metainfo,
+            const std::vector<typename protocol_t::write_t> &writes,
+            const std::vector<transition_timestamp_t> &timestamps,
+            std::vector<typename protocol_t::write_response_t> *responses,
+            order_token_t order_token,
+            object_buffer_t<fifo_enforcer_sink_t::exit_write_t> *token,
+            signal_t *interruptor)
+        THROWS_ONLY(interrupted_exc_t);
+
     bool send_backfill(
             const region_map_t<protocol_t, state_timestamp_t> &start_point,
             send_backfill_callback_t<protocol_t> *send_backfill_cb,
@@ -76,7 +87,7 @@ public:
         THROWS_ONLY(interrupted_exc_t);
 
     void receive_backfill(
-            const typename protocol_t::backfill_chunk_t &chunk,
+            const std::vector<typename protocol_t::backfill_chunk_t> &chunks,
             object_buffer_t<fifo_enforcer_sink_t::exit_write_t> *token,
             signal_t *interruptor)
         THROWS_ONLY(interrupted_exc_t);
@@ -89,12 +100,14 @@ public:
         THROWS_ONLY(interrupted_exc_t);
 
 protected:
-    // Functions to be implemented by derived (protocol-specific) store_t classes
+    // Functions to be implemented by derived (protocol-specific) store_t classes.
+    // They get the real superblock, rather than just a `superblock_t`, so
+    // that they can get at the secondary indexes stored in it.
     virtual void protocol_read(const typename protocol_t::read_t &read,
                                typename protocol_t::read_response_t *response,
                                btree_slice_t *btree,
                                transaction_t *txn,
-                               superblock_t *superblock,
+                               real_superblock_t *superblock,
                                signal_t *interruptor) = 0;
 
     virtual void protocol_write(const typename protocol_t::write_t &write,
@@ -102,12 +115,12 @@ protected:
                                 transition_timestamp_t timestamp,
                                 btree_slice_t *btree,
                                 transaction_t *txn,
-                                superblock_t *superblock,
+                                real_superblock_t *superblock,
                                 signal_t *interruptor) = 0;
 
     virtual void protocol_send_backfill(const region_map_t<protocol_t, state_timestamp_t> &start_point,
                                         chunk_fun_callback_t<protocol_t> *chunk_fun_cb,
-                                        superblock_t *superblock,
+                                        real_superblock_t *superblock,
                                         btree_slice_t *btree,
                                         transaction_t *txn,
                                         typename protocol_t::backfill_progress_t *progress,
@@ -116,17 +129,18 @@ protected:
 
     virtual void protocol_receive_backfill(btree_slice_t *btree,
                                            transaction_t *txn,
-                                           superblock_t *superblock,
+                                           real_superblock_t *superblock,
                                            signal_t *interruptor,
                                            const typename protocol_t::backfill_chunk_t &chunk) = 0;
 
     virtual void protocol_reset_data(const typename protocol_t::region_t& subregion,
                                      btree_slice_t *btree,
                                      transaction_t *txn,
-                                     superblock_t *superblock) = 0;
+                                     real_superblock_t *superblock) = 0;
 
-private:
-    void get_metainfo_internal(transaction_t* txn, buf_lock_t* sb_buf, region_map_t<protocol_t, binary_blob_t> *out) const THROWS_NOTHING;
+    // For derived store_t classes that run transactions of their own, outside
+    // of any read or write that comes through the store_view_t interface.
+    btree_slice_t *get_btree() { return btree.get(); }
 
     void acquire_superblock_for_read(
             access_t access,
@@ -137,13 +151,6 @@ private:
             bool use_snapshot)
             THROWS_ONLY(interrupted_exc_t);
 
-    void acquire_superblock_for_backfill(
-            object_buffer_t<fifo_enforcer_sink_t::exit_read_t> *token,
-            scoped_ptr_t<transaction_t> *txn_out,
-            scoped_ptr_t<real_superblock_t> *sb_out,
-            signal_t *interruptor)
-            THROWS_ONLY(interrupted_exc_t);
-
     void acquire_superblock_for_write(
             access_t access,
             repli_timestamp_t timestamp,
@@ -154,6 +161,16 @@ private:
             signal_t *interruptor)
             THROWS_ONLY(interrupted_exc_t);
 
+private:
+    void get_metainfo_internal(transaction_t* txn, buf_lock_t* sb_buf, region_map_t<protocol_t, binary_blob_t> *out) const THROWS_NOTHING;
+
+    void acquire_superblock_for_backfill(
+            object_buffer_t<fifo_enforcer_sink_t::exit_read_t> *token,
+            scoped_ptr_t<transaction_t> *txn_out,
+            scoped_ptr_t<real_superblock_t> *sb_out,
+            signal_t *interruptor)
+            THROWS_ONLY(interrupted_exc_t);
+
     void check_and_update_metainfo(
         DEBUG_ONLY(const metainfo_checker_t<protocol_t>& metainfo_checker, )
         const metainfo_t &new_metainfo,
@@ -38,9 +38,10 @@ bool btree_depth_first_traversal(btree_slice_t *slice, transaction_t *transactio
         return true;
     } else {
         const leaf_node_t *lnode = reinterpret_cast<const leaf_node_t *>(node);
+        store_key_t key_buf;
         const btree_key_t *key;
         for (leaf::live_iter_t it = leaf::iter_for_inclusive_lower_bound(lnode, range.left.btree_key());
-                (key = it.get_key(lnode)) && (range.right.unbounded || sized_strcmp(key->contents, key->size, range.right.key.contents(), range.right.key.size()) < 0);
+                (key = it.get_key(lnode, &key_buf)) && (range.right.unbounded || sized_strcmp(key->contents, key->size, range.right.key.contents(), range.right.key.size()) < 0);
                 it.step(lnode)) {
             if (!cb->handle_pair(key, it.get_value(lnode))) {
                 return false;
@@ -19,10 +19,10 @@
  */
 #define DETEMPLATIZE_LEAF_NODE_OP(op_name, leaf_node, sizer_argument, ...) \
     do {                                                                \
-        if (leaf_node->magic == value_sizer_t<memcached_value_t>::leaf_magic()) { \
+        if (leaf::matches_leaf_magic(leaf_node->magic, value_sizer_t<memcached_value_t>::leaf_magic())) { \
             value_sizer_t<memcached_value_t> sizer(sizer_argument);     \
             op_name(&sizer, __VA_ARGS__);            \
-        } else if (leaf_node->magic == value_sizer_t<rdb_value_t>::leaf_magic()) { \
+        } else if (leaf::matches_leaf_magic(leaf_node->magic, value_sizer_t<rdb_value_t>::leaf_magic())) { \
             value_sizer_t<rdb_value_t> sizer(sizer_argument);     \
             op_name(&sizer, __VA_ARGS__);            \
         } else {                                                        \
@@ -28,7 +28,8 @@ public:
         std::vector<store_key_t> keys_to_delete;
 
         for (leaf::live_iter_t iter = leaf::iter_for_whole_leaf(node); /* no test */; iter.step(node)) {
-            const btree_key_t *k = iter.get_key(node);
+            store_key_t key_buf;
+            const btree_key_t *k = iter.get_key(node, &key_buf);
             if (!k) {
                 break;
             }
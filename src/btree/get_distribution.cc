@@ -31,8 +31,9 @@ public:
 
         leaf::live_iter_t it = iter_for_whole_leaf(node);
 
+        store_key_t key_buf;
         const btree_key_t *key;
-        while ((key = it.get_key(node))) {
+        while ((key = it.get_key(node, &key_buf))) {
             keys->push_back(store_key_t(key->size, key->contents));
             it.step(node);
         }
@@ -4,6 +4,7 @@
 #include <algorithm>
 
 #include "buffer_cache/buffer_cache.hpp"
+#include "btree/key_prefix_index.hpp"
 #include "btree/node.hpp"
 
 //In this tree, less than or equal takes the left-hand branch and greater than takes the right hand branch
@@ -388,6 +389,27 @@ int get_offset_index(const internal_node_t *node, const btree_key_t *key) {
     return std::lower_bound(node->pair_offsets, node->pair_offsets+node->npairs-1, (uint16_t) internal_key_comp::faux_offset, internal_key_comp(node, key)) - node->pair_offsets;
 }
 
+int get_offset_index(const internal_node_t *node, const key_prefix_index_t *prefix_index, const btree_key_t *key) {
+    rassert(prefix_index->size() == node->npairs - 1);
+    int beg, end;
+    prefix_index->narrow(key, &beg, &end);
+    return std::lower_bound(node->pair_offsets+beg, node->pair_offsets+end, (uint16_t) internal_key_comp::faux_offset, internal_key_comp(node, key)) - node->pair_offsets;
+}
+
+block_id_t lookup(const internal_node_t *node, const key_prefix_index_t *prefix_index, const btree_key_t *key) {
+    int index = get_offset_index(node, prefix_index, key);
+    return get_pair_by_index(node, index)->lnode;
+}
+
+key_prefix_index_t *make_key_prefix_index(const internal_node_t *node) {
+    std::vector<const btree_key_t *> keys;
+    keys.reserve(node->npairs - 1);
+    for (int i = 0; i < node->npairs - 1; ++i) {
+        keys.push_back(&get_pair_by_index(node, i)->key);
+    }
+    return new key_prefix_index_t(keys);
+}
+
 int nodecmp(const internal_node_t *node1, const internal_node_t *node2) {
     const btree_key_t *key1 = &get_pair_by_index(node1, 0)->key;
     const btree_key_t *key2 = &get_pair_by_index(node2, 0)->key;
@@ -21,6 +21,7 @@ struct btree_internal_pair {
 
 
 class internal_key_comp;
+class key_prefix_index_t;
 
 // In a perfect world, this namespace would be 'branch'.
 namespace internal_node {
@@ -55,6 +56,15 @@ btree_internal_pair *get_pair_by_index(internal_node_t *node, int index);
 
 int get_offset_index(const internal_node_t *node, const btree_key_t *key);
 
+// Builds a key prefix index over the node's keys (all but the last, special, pair), for
+// use with the functions below.
+key_prefix_index_t *make_key_prefix_index(const internal_node_t *node);
+
+// Like lookup and get_offset_index, but they use `prefix_index` (which must have been
+// built from `node`) to narrow down the search.
+block_id_t lookup(const internal_node_t *node, const key_prefix_index_t *prefix_index, const btree_key_t *key);
+int get_offset_index(const internal_node_t *node, const key_prefix_index_t *prefix_index, const btree_key_t *key);
+
 }  // namespace internal_node
 
 class internal_key_comp {
@@ -0,0 +1,154 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#include "btree/key_prefix_index.hpp"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "btree/keys.hpp"
+
+// GCC lets us compile single functions for instruction sets beyond what the rest of the
+// build targets, starting with 4.9.
+#if defined(__x86_64__) && !defined(__clang__) && \
+    (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define KEY_PREFIX_INDEX_SIMD 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+int64_t to_prefix(const uint8_t *contents, int size) {
+    uint64_t prefix = 0;
+    for (int i = 0; i < key_prefix_index_t::prefix_size; ++i) {
+        prefix = (prefix << 8) | (i < size ? contents[i] : 0);
+    }
+    return static_cast<int64_t>(prefix ^ (static_cast<uint64_t>(1) << 63));
+}
+
+// Counts the values that are less than and greater than `needle`.  `values` is sorted.
+typedef void (*count_around_fun_t)(const int64_t *values, int n, int64_t needle, int *less_out, int *greater_out);
+
+void count_around_scalar(const int64_t *values, int n, int64_t needle, int *less_out, int *greater_out) {
+    *less_out = std::lower_bound(values, values + n, needle) - values;
+    *greater_out = (values + n) - std::upper_bound(values + *less_out, values + n, needle);
+}
+
+#ifdef KEY_PREFIX_INDEX_SIMD
+
+__attribute__((target("avx2")))
+void count_around_avx2(const int64_t *values, int n, int64_t needle, int *less_out, int *greater_out) {
+    const __m256i needles = _mm256_set1_epi64x(needle);
+    int less = 0, greater = 0;
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i));
+        int less_mask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(needles, v)));
+        int greater_mask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(v, needles)));
+        less += __builtin_popcount(less_mask);
+        if (greater_mask == 0xf) {
+            // The values are sorted, so everything from here on is greater.
+            greater += n - i;
+            i = n;
+            break;
+        }
+        greater += __builtin_popcount(greater_mask);
+    }
+    for (; i < n; ++i) {
+        less += values[i] < needle;
+        greater += values[i] > needle;
+    }
+    *less_out = less;
+    *greater_out = greater;
+}
+
+__attribute__((target("sse4.2")))
+void count_around_sse42(const int64_t *values, int n, int64_t needle, int *less_out, int *greater_out) {
+    const __m128i needles = _mm_set1_epi64x(needle);
+    int less = 0, greater = 0;
+    int i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(values + i));
+        int less_mask = _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(needles, v)));
+        int greater_mask = _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(v, needles)));
+        less += __builtin_popcount(less_mask);
+        if (greater_mask == 0x3) {
+            greater += n - i;
+            i = n;
+            break;
+        }
+        greater += __builtin_popcount(greater_mask);
+    }
+    for (; i < n; ++i) {
+        less += values[i] < needle;
+        greater += values[i] > needle;
+    }
+    *less_out = less;
+    *greater_out = greater;
+}
+
+#endif  // KEY_PREFIX_INDEX_SIMD
+
+count_around_fun_t choose_count_around() {
+#ifdef KEY_PREFIX_INDEX_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return &count_around_avx2;
+    }
+    if (__builtin_cpu_supports("sse4.2")) {
+        return &count_around_sse42;
+    }
+#endif
+    return &count_around_scalar;
+}
+
+const count_around_fun_t count_around = choose_count_around();
+
+}  // namespace
+
+key_prefix_index_t::key_prefix_index_t(const std::vector<const btree_key_t *> &keys) {
+    if (keys.empty()) {
+        return;
+    }
+
+    // The keys are sorted, so the prefix that the first and the last key share is shared by all
+    // of them.
+    const btree_key_t *first = keys.front();
+    const btree_key_t *last = keys.back();
+    int common_size = 0;
+    while (common_size < first->size && common_size < last->size &&
+           first->contents[common_size] == last->contents[common_size]) {
+        ++common_size;
+    }
+    common_prefix.assign(reinterpret_cast<const char *>(first->contents), common_size);
+
+    prefixes.reserve(keys.size());
+    for (std::vector<const btree_key_t *>::const_iterator it = keys.begin(); it != keys.end(); ++it) {
+        rassert((*it)->size >= common_size);
+        prefixes.push_back(to_prefix((*it)->contents + common_size, (*it)->size - common_size));
+    }
+}
+
+void key_prefix_index_t::narrow(const btree_key_t *key, int *beg_out, int *end_out) const {
+    if (prefixes.empty()) {
+        *beg_out = *end_out = 0;
+        return;
+    }
+
+    const int common_size = common_prefix.size();
+    int res = memcmp(key->contents, common_prefix.data(), std::min<int>(key->size, common_size));
+    if (res < 0 || (res == 0 && key->size < common_size)) {
+        // `key` is less than the common prefix, and thus less than every key.
+        *beg_out = *end_out = 0;
+        return;
+    }
+    if (res > 0) {
+        *beg_out = *end_out = prefixes.size();
+        return;
+    }
+
+    int less, greater;
+    count_around(&prefixes[0], prefixes.size(), to_prefix(key->contents + common_size, key->size - common_size),
+                 &less, &greater);
+    *beg_out = less;
+    *end_out = prefixes.size() - greater;
+}
@@ -0,0 +1,55 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#ifndef BTREE_KEY_PREFIX_INDEX_HPP_
+#define BTREE_KEY_PREFIX_INDEX_HPP_
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "buffer_cache/types.hpp"
+#include "errors.hpp"
+
+struct btree_key_t;
+
+/* A search index over the sorted keys of a btree node.
+
+Binary search over a node's `pair_offsets` touches a different part of the block on every
+probe.  This index keeps a fixed-width prefix of every key in one contiguous array, so that
+most of the search is a linear scan over that array with SSE4.2 or AVX2 compares (picked at
+runtime, so it works with the default compiler flags), and the full keys only have to be
+compared among the few keys whose prefixes tie with the key we look for.
+
+Keys in a node often share a long common prefix (think "user:1234:..."), which would make
+every prefix tie.  So we store the node's common prefix once and take each key's
+`prefix_size` bytes after it, zero padded and in big-endian order, so that comparing prefixes
+as integers agrees with `sized_strcmp()`.
+
+The index only lives in memory: it is attached to the cached block as derived data, which the
+cache drops whenever the block changes. */
+class key_prefix_index_t : public buf_derived_data_t {
+public:
+    // `keys` must be sorted.
+    explicit key_prefix_index_t(const std::vector<const btree_key_t *> &keys);
+
+    // Narrows down the position of `key` among the indexed keys to [*beg_out, *end_out).
+    // All keys before *beg_out are less than `key` and all keys from *end_out on are
+    // greater, so only the keys in between need a full comparison.
+    void narrow(const btree_key_t *key, int *beg_out, int *end_out) const;
+
+    int size() const { return prefixes.size(); }
+
+    static const int prefix_size = sizeof(int64_t);
+
+private:
+    std::string common_prefix;
+
+    // Each prefix is stored as a big-endian unsigned integer with the top bit flipped, so
+    // that signed comparisons (which is all SSE and AVX2 have for 64-bit lanes) order them
+    // correctly.
+    std::vector<int64_t> prefixes;
+
+    DISABLE_COPYING(key_prefix_index_t);
+};
+
+#endif  // BTREE_KEY_PREFIX_INDEX_HPP_
@@ -9,6 +9,7 @@
 
 #include "buffer_cache/buffer_cache.hpp"
 #include "btree/buf_patches.hpp"
+#include "btree/key_prefix_index.hpp"
 #include "btree/node.hpp"
 
 namespace leaf {
@@ -80,6 +81,24 @@ const int SKIP_ENTRY_RESERVED = 251;
 // itself three bytes, so it can't fit in a slot of size one or two. We don't
 // expect to actually see many entries of size one or two, but it pays to be
 // thorough.
+//
+// A prefix-compressed leaf node (see `compressed_leaf_magic()`) stores a
+// node-wide key prefix between the header and the pair offsets, padded to an
+// even number of bytes:
+//
+// [magic][num_pairs][live_size][frontmost][tstamp_cutpoint][prefix][pad?][off0][off1]...
+//
+// and its entries store each key as the number of leading bytes it shares
+// with the prefix, followed by the rest of the key:
+//
+//   [shared][btree key suffix][btree value]        -- a live entry
+//   [255][shared][btree key suffix]                -- a deletion entry
+//
+// `shared` is always the full length of the common prefix of the key and the
+// node prefix, so every key has exactly one encoding.  Since the prefix is no
+// longer than `MAX_KEY_SIZE`, live entries still start with a byte of at most
+// `MAX_KEY_SIZE`.  Keys that don't start with the prefix are fine, they're just
+// stored with a smaller `shared`.
 
 
 struct entry_t;
@@ -102,27 +121,164 @@ bool entry_is_skip(const entry_t *p) {
     return !entry_is_deletion(p) && !entry_is_live(p);
 }
 
-const btree_key_t *entry_key(const entry_t *p) {
-    if (entry_is_deletion(p)) {
-        return reinterpret_cast<const btree_key_t *>(1 + reinterpret_cast<const char *>(p));
-    } else {
-        return reinterpret_cast<const btree_key_t *>(p);
+const uint8_t COMPRESSED_MAGIC_BIT = 0x80;
+
+bool is_compressed(const leaf_node_t *node) {
+    return node->magic.bytes[sizeof(block_magic_t) - 1] & COMPRESSED_MAGIC_BIT;
+}
+
+// The node prefix of a compressed node.  Uncompressed nodes don't have one.
+const btree_key_t *get_prefix(const leaf_node_t *node) {
+    rassert(is_compressed(node));
+    return reinterpret_cast<const btree_key_t *>(node->pair_offsets);
+}
+
+// The number of bytes taken up by the node prefix.
+int prefix_storage_size(const leaf_node_t *node) {
+    if (!is_compressed(node)) {
+        return 0;
+    }
+    // Keep the pair offsets aligned.
+    return (get_prefix(node)->full_size() + 1) & ~1;
+}
+
+int pair_offsets_offset(const leaf_node_t *node) {
+    return offsetof(leaf_node_t, pair_offsets) + prefix_storage_size(node);
+}
+
+const uint16_t *get_pair_offsets(const leaf_node_t *node) {
+    return reinterpret_cast<const uint16_t *>(reinterpret_cast<const char *>(node) + pair_offsets_offset(node));
+}
+
+uint16_t *get_pair_offsets(leaf_node_t *node) {
+    return reinterpret_cast<uint16_t *>(reinterpret_cast<char *>(node) + pair_offsets_offset(node));
+}
+
+// Returns the length of the common prefix of `key` and `prefix`.
+int shared_prefix_size(const btree_key_t *key, const btree_key_t *prefix) {
+    int n = std::min(key->size, prefix->size);
+    int i = 0;
+    while (i < n && key->contents[i] == prefix->contents[i]) {
+        ++i;
+    }
+    return i;
+}
+
+// The number of leading bytes of the entry's key that are stored in the node
+// prefix rather than in the entry.
+int entry_shared(const leaf_node_t *node, const entry_t *p) {
+    if (!is_compressed(node)) {
+        return 0;
+    }
+    return reinterpret_cast<const uint8_t *>(p)[entry_is_deletion(p) ? 1 : 0];
+}
+
+// The part of the entry's key that is stored in the entry.  In uncompressed
+// nodes that's the whole key.
+const btree_key_t *entry_key(const leaf_node_t *node, const entry_t *p) {
+    int skip = (entry_is_deletion(p) ? 1 : 0) + (is_compressed(node) ? 1 : 0);
+    return reinterpret_cast<const btree_key_t *>(skip + reinterpret_cast<const char *>(p));
+}
+
+// Returns the node's prefix, or NULL if its keys are stored in full.
+const btree_key_t *get_prefix_or_null(const leaf_node_t *node) {
+    return is_compressed(node) ? get_prefix(node) : NULL;
+}
+
+// The size of the key part of an entry for `key` in a node with the
+// given prefix (or none).
+int encoded_key_size(const btree_key_t *prefix_or_null, const btree_key_t *key) {
+    if (prefix_or_null == NULL) {
+        return key->full_size();
+    }
+    return 1 + key->full_size() - shared_prefix_size(key, prefix_or_null);
+}
+
+int encoded_key_size(const leaf_node_t *node, const btree_key_t *key) {
+    return encoded_key_size(get_prefix_or_null(node), key);
+}
+
+int prefix_storage_size(const btree_key_t *prefix_or_null) {
+    return prefix_or_null == NULL ? 0 : (prefix_or_null->full_size() + 1) & ~1;
+}
+
+// Writes the key part of an entry for `key` in `node` to `p`, and returns a
+// pointer past it.
+char *write_encoded_key(const leaf_node_t *node, const btree_key_t *key, char *p) {
+    if (!is_compressed(node)) {
+        keycpy(reinterpret_cast<btree_key_t *>(p), key);
+        return p + key->full_size();
+    }
+    uint8_t shared = shared_prefix_size(key, get_prefix(node));
+    *reinterpret_cast<uint8_t *>(p) = shared;
+    btree_key_t *suffix = reinterpret_cast<btree_key_t *>(p + 1);
+    suffix->size = key->size - shared;
+    memcpy(suffix->contents, key->contents + shared, suffix->size);
+    return p + 1 + suffix->full_size();
+}
+
+// Copies the entry's full key into `*buf`.
+void entry_full_key(const leaf_node_t *node, const entry_t *p, btree_key_t *buf) {
+    int shared = entry_shared(node, p);
+    const btree_key_t *suffix = entry_key(node, p);
+    buf->size = shared + suffix->size;
+    if (shared > 0) {
+        memcpy(buf->contents, get_prefix(node)->contents, shared);
+    }
+    memcpy(buf->contents + shared, suffix->contents, suffix->size);
+}
+
+// Returns the entry's full key, which is either stored in the node or in `*buf`.
+const btree_key_t *entry_full_key(const leaf_node_t *node, const entry_t *p, store_key_t *buf) {
+    if (!is_compressed(node)) {
+        return entry_key(node, p);
+    }
+    entry_full_key(node, p, buf->btree_key());
+    return buf->btree_key();
+}
+
+// Returns true if `a` and `b` store their keys the same way, so that
+// entries can be copied from one to the other as they are.
+bool same_key_encoding(const leaf_node_t *a, const leaf_node_t *b) {
+    if (!is_compressed(a) || !is_compressed(b)) {
+        return is_compressed(a) == is_compressed(b);
+    }
+    const btree_key_t *pa = get_prefix(a);
+    const btree_key_t *pb = get_prefix(b);
+    return sized_strcmp(pa->contents, pa->size, pb->contents, pb->size) == 0;
+}
+
+// Compares `key` with the entry's full key.  `key_shared` must be
+// `shared_prefix_size(key, get_prefix(node))` (or zero, for uncompressed
+// nodes).
+int entry_key_cmp(const leaf_node_t *node, const btree_key_t *key, int key_shared, const entry_t *p) {
+    int shared = entry_shared(node, p);
+    if (key_shared < shared) {
+        // The entry's key matches the node prefix for longer than `key` does,
+        // so they differ at index `key_shared`.
+        if (key_shared == key->size) {
+            return -1;
+        }
+        return key->contents[key_shared] < get_prefix(node)->contents[key_shared] ? -1 : 1;
     }
+    const btree_key_t *suffix = entry_key(node, p);
+    return sized_strcmp(key->contents + shared, key->size - shared, suffix->contents, suffix->size);
 }
 
-const void *entry_value(const entry_t *p) {
+const void *entry_value(const leaf_node_t *node, const entry_t *p) {
     if (entry_is_deletion(p)) {
         return NULL;
     } else {
-        return reinterpret_cast<const char *>(p) + entry_key(p)->full_size();
+        return reinterpret_cast<const char *>(entry_key(node, p)) + entry_key(node, p)->full_size();
     }
 }
 
-int entry_size(value_sizer_t<void> *sizer, const entry_t *p) {
+int entry_size(value_sizer_t<void> *sizer, const leaf_node_t *node, const entry_t *p) {
     uint8_t code = *reinterpret_cast<const uint8_t *>(p);
+    int shared_size = is_compressed(node) ? 1 : 0;
     switch (code) {
     case DELETE_ENTRY_CODE:
-        return 1 + entry_key(p)->full_size();
+        return 1 + shared_size + entry_key(node, p)->full_size();
     case SKIP_ENTRY_CODE_ONE:
         return 1;
     case SKIP_ENTRY_CODE_TWO:
@@ -131,7 +287,7 @@ int entry_size(value_sizer_t<void> *sizer, const entry_t *p) {
         return 3 + *reinterpret_cast<const uint16_t *>(1 + reinterpret_cast<const char *>(p));
     default:
         rassert(code <= MAX_KEY_SIZE);
-        return entry_key(p)->full_size() + sizer->size(entry_value(p));
+        return shared_size + entry_key(node, p)->full_size() + sizer->size(entry_value(node, p));
     }
 }
 
@@ -157,7 +313,7 @@ struct entry_iter_t {
     void step(value_sizer_t<void> *sizer, const leaf_node_t *node) {
         rassert(!done(sizer));
 
-        offset += entry_size(sizer, get_entry(node, offset)) + (offset < node->tstamp_cutpoint ? sizeof(repli_timestamp_t) : 0);
+        offset += entry_size(sizer, node, get_entry(node, offset)) + (offset < node->tstamp_cutpoint ? sizeof(repli_timestamp_t) : 0);
     }
 
     bool done(value_sizer_t<void> *sizer) const {
@@ -173,17 +329,18 @@ struct entry_iter_t {
     }
 };
 
-void strprint_entry(std::string *out, value_sizer_t<void> *sizer, const entry_t *entry) {
+void strprint_entry(std::string *out, value_sizer_t<void> *sizer, const leaf_node_t *node, const entry_t *entry) {
+    store_key_t buf;
     if (entry_is_live(entry)) {
-        const btree_key_t *key = entry_key(entry);
+        const btree_key_t *key = entry_full_key(node, entry, &buf);
         *out += strprintf("%.*s:", static_cast<int>(key->size), key->contents);
-        *out += strprintf("[entry size=%d]", entry_size(sizer, entry));
-        *out += strprintf("[value size=%d]", sizer->size(entry_value(entry)));
+        *out += strprintf("[entry size=%d]", entry_size(sizer, node, entry));
+        *out += strprintf("[value size=%d]", sizer->size(entry_value(node, entry)));
     } else if (entry_is_deletion(entry)) {
-        const btree_key_t *key = entry_key(entry);
+        const btree_key_t *key = entry_full_key(node, entry, &buf);
         *out += strprintf("%.*s:[deletion]", static_cast<int>(key->size), key->contents);
     } else if (entry_is_skip(entry)) {
-        *out += strprintf("[skip %d]", entry_size(sizer, entry));
+        *out += strprintf("[skip %d]", entry_size(sizer, node, entry));
     } else {
         *out += strprintf("[code %d]", *reinterpret_cast<const uint8_t *>(entry));
     }
@@ -195,16 +352,21 @@ std::string strprint_leaf(value_sizer_t<void> *sizer, const leaf_node_t *node) {
     out += strprintf("Leaf(magic='%4.4s', num_pairs=%u, live_size=%u, frontmost=%u, tstamp_cutpoint=%u)\n",
             node->magic.bytes, node->num_pairs, node->live_size, node->frontmost, node->tstamp_cutpoint);
 
+    if (is_compressed(node)) {
+        const btree_key_t *prefix = get_prefix(node);
+        out += strprintf("  Prefix: %.*s\n", static_cast<int>(prefix->size), prefix->contents);
+    }
+
     out += strprintf("  Offsets:");
     for (int i = 0; i < node->num_pairs; ++i) {
-        out += strprintf(" %d", node->pair_offsets[i]);
+        out += strprintf(" %d", get_pair_offsets(node)[i]);
     }
     out += strprintf("\n");
 
     out += strprintf("  By Key:");
     for (int i = 0; i < node->num_pairs; ++i) {
-        out += strprintf(" %d:", node->pair_offsets[i]);
-        strprint_entry(&out, sizer, get_entry(node, node->pair_offsets[i]));
+        out += strprintf(" %d:", get_pair_offsets(node)[i]);
+        strprint_entry(&out, sizer, node, get_entry(node, get_pair_offsets(node)[i]));
     }
     out += strprintf("\n");
 
@@ -217,7 +379,7 @@ std::string strprint_leaf(value_sizer_t<void> *sizer, const leaf_node_t *node) {
             repli_timestamp_t tstamp = get_timestamp(node, iter.offset);
             out += strprintf("[t=%" PRIu64 "]", tstamp.longtime);
         }
-        strprint_entry(&out, sizer, get_entry(node, iter.offset));
+        strprint_entry(&out, sizer, node, get_entry(node, iter.offset));
         iter.step(sizer, node);
     }
     out += strprintf("\n");
@@ -226,17 +388,18 @@ std::string strprint_leaf(value_sizer_t<void> *sizer, const leaf_node_t *node) {
 }
 
 
-void print_entry(FILE *fp, value_sizer_t<void> *sizer, const entry_t *entry) {
+void print_entry(FILE *fp, value_sizer_t<void> *sizer, const leaf_node_t *node, const entry_t *entry) {
+    store_key_t buf;
     if (entry_is_live(entry)) {
-        const btree_key_t *key = entry_key(entry);
+        const btree_key_t *key = entry_full_key(node, entry, &buf);
         fprintf(fp, "%.*s:", static_cast<int>(key->size), key->contents);
-        fprintf(fp, "[entry size=%d]", entry_size(sizer, entry));
-        fprintf(fp, "[value size=%d]", sizer->size(entry_value(entry)));
+        fprintf(fp, "[entry size=%d]", entry_size(sizer, node, entry));
+        fprintf(fp, "[value size=%d]", sizer->size(entry_value(node, entry)));
     } else if (entry_is_deletion(entry)) {
-        const btree_key_t *key = entry_key(entry);
+        const btree_key_t *key = entry_full_key(node, entry, &buf);
         fprintf(fp, "%.*s:[deletion]", static_cast<int>(key->size), key->contents);
     } else if (entry_is_skip(entry)) {
-        fprintf(fp, "[skip %d]", entry_size(sizer, entry));
+        fprintf(fp, "[skip %d]", entry_size(sizer, node, entry));
     } else {
         fprintf(fp, "[code %d]", *reinterpret_cast<const uint8_t *>(entry));
     }
@@ -248,17 +411,22 @@ void print(FILE *fp, value_sizer_t<void> *sizer, const leaf_node_t *node) {
     fprintf(fp, "Leaf(magic='%4.4s', num_pairs=%u, live_size=%u, frontmost=%u, tstamp_cutpoint=%u)\n",
             node->magic.bytes, node->num_pairs, node->live_size, node->frontmost, node->tstamp_cutpoint);
 
+    if (is_compressed(node)) {
+        const btree_key_t *prefix = get_prefix(node);
+        fprintf(fp, "  Prefix: %.*s\n", static_cast<int>(prefix->size), prefix->contents);
+    }
+
     fprintf(fp, "  Offsets:");
     for (int i = 0; i < node->num_pairs; ++i) {
-        fprintf(fp, " %d", node->pair_offsets[i]);
+        fprintf(fp, " %d", get_pair_offsets(node)[i]);
     }
     fprintf(fp, "\n");
     fflush(fp);
 
     fprintf(fp, "  By Key:");
     for (int i = 0; i < node->num_pairs; ++i) {
-        fprintf(fp, " %d:", node->pair_offsets[i]);
-        print_entry(fp, sizer, get_entry(node, node->pair_offsets[i]));
+        fprintf(fp, " %d:", get_pair_offsets(node)[i]);
+        print_entry(fp, sizer, node, get_entry(node, get_pair_offsets(node)[i]));
     }
     fprintf(fp, "\n");
 
@@ -274,7 +442,7 @@ void print(FILE *fp, value_sizer_t<void> *sizer, const leaf_node_t *node) {
             fprintf(fp, "[t=%" PRIu64 "]", tstamp.longtime);
             fflush(fp);
         }
-        print_entry(fp, sizer, get_entry(node, iter.offset));
+        print_entry(fp, sizer, node, get_entry(node, iter.offset));
         iter.step(sizer, node);
     }
     fprintf(fp, "\n");
@@ -310,9 +478,11 @@ bool fsck(value_sizer_t<void> *sizer, const btree_key_t *left_exclusive_or_null,
     // is not before the end of pair_offsets
 
     // Basic sanity checks on fields' values.
-    if (failed(node->magic == sizer->btree_leaf_magic(),
+    if (failed(matches_leaf_magic(node->magic, sizer->btree_leaf_magic()),
                "bad leaf magic")
-        || failed(node->frontmost >= offsetof(leaf_node_t, pair_offsets) + node->num_pairs * sizeof(uint16_t),
+        || failed(!is_compressed(node) || get_prefix(node)->size <= MAX_KEY_SIZE,
+                  "node prefix is too long")
+        || failed(node->frontmost >= pair_offsets_offset(node) + node->num_pairs * sizeof(uint16_t),
                   "frontmost offset is before the end of pair_offsets")
         || failed(node->live_size <= (sizer->block_size().value() - node->frontmost) + sizeof(uint16_t) * node->num_pairs,
                   "live_size is impossibly large")
@@ -326,7 +496,7 @@ bool fsck(value_sizer_t<void> *sizer, const btree_key_t *left_exclusive_or_null,
 
     // sizeof(offs) is guaranteed to be less than the block_size() thanks to assertions above.
     scoped_array_t<uint16_t> offs(node->num_pairs);
-    memcpy(offs.data(), node->pair_offsets, node->num_pairs * sizeof(uint16_t));
+    memcpy(offs.data(), get_pair_offsets(node), node->num_pairs * sizeof(uint16_t));
 
     std::sort(offs.data(), offs.data() + node->num_pairs);
 
@@ -371,21 +541,31 @@ bool fsck(value_sizer_t<void> *sizer, const btree_key_t *left_exclusive_or_null,
         }
 
         const entry_t *ent = get_entry(node, offset);
+        if ((entry_is_live(ent) || entry_is_deletion(ent)) && is_compressed(node)) {
+            int shared = entry_shared(node, ent);
+            if (failed(shared <= get_prefix(node)->size, "entry shares more than the node prefix")
+                || failed(shared + entry_key(node, ent)->size <= MAX_KEY_SIZE, "entry key is too long")) {
+                return false;
+            }
+        }
+
         if (entry_is_live(ent)) {
-            const void *value = entry_value(ent);
+            const void *value = entry_value(node, ent);
+            store_key_t key_buf;
+            const btree_key_t *key = entry_full_key(node, ent, &key_buf);
             int space = sizer->block_size().value() - (reinterpret_cast<const char *>(value) - reinterpret_cast<const char *>(node));
             if (!sizer->fits(value, space)) {
-                *msg_out = strprintf("problem with key %.*s: value does not fit\n", entry_key(ent)->size, entry_key(ent)->contents);
+                *msg_out = strprintf("problem with key %.*s: value does not fit\n", key->size, key->contents);
                 return false;
             }
 
             std::string fscker_msg;
-            if (!fscker->fsck(sizer, entry_key(ent), value, &fscker_msg)) {
-                *msg_out = strprintf("Problem with key %.*s: %s\n", entry_key(ent)->size, entry_key(ent)->contents, fscker_msg.c_str());
+            if (!fscker->fsck(sizer, key, value, &fscker_msg)) {
+                *msg_out = strprintf("Problem with key %.*s: %s\n", key->size, key->contents, fscker_msg.c_str());
                 return false;
             }
 
-            observed_live_size += sizeof(uint16_t) + entry_size(sizer, ent);
+            observed_live_size += sizeof(uint16_t) + entry_size(sizer, node, ent);
             if (failed(i < node->num_pairs, "missing entry offsets")
                 || failed(offset == offs[i], "missing live entries or entry offsets")) {
                 return false;
@@ -413,14 +593,21 @@ bool fsck(value_sizer_t<void> *sizer, const btree_key_t *left_exclusive_or_null,
 
     // Entries look valid, check key ordering.
 
+    store_key_t last_buf;
     const btree_key_t *last = left_exclusive_or_null;
     for (int k = 0; k < node->num_pairs; ++k) {
-        const btree_key_t *key = entry_key(get_entry(node, node->pair_offsets[k]));
-        if (failed(last == NULL || sized_strcmp(last->contents, last->size, key->contents, key->size) < 0,
-                   "keys out of order")) {
+        const entry_t *ent = get_entry(node, get_pair_offsets(node)[k]);
+        store_key_t key_buf;
+        const btree_key_t *key = entry_full_key(node, ent, &key_buf);
+        // Every key has exactly one encoding.
+        if (failed(!is_compressed(node) || entry_shared(node, ent) == shared_prefix_size(key, get_prefix(node)),
+                   "entry does not share all it can with the node prefix")
+            || failed(last == NULL || sized_strcmp(last->contents, last->size, key->contents, key->size) < 0,
+                      "keys out of order")) {
             return false;
         }
-        last = key;
+        last_buf.assign(key);
+        last = last_buf.btree_key();
     }
 
     if (failed(last == NULL || right_inclusive_or_null == NULL
@@ -443,6 +630,15 @@ void validate(DEBUG_VAR value_sizer_t<void> *sizer, DEBUG_VAR const leaf_node_t
 #endif
 }
 
+block_magic_t compressed_leaf_magic(block_magic_t leaf_magic) {
+    leaf_magic.bytes[sizeof(block_magic_t) - 1] |= COMPRESSED_MAGIC_BIT;
+    return leaf_magic;
+}
+
+bool matches_leaf_magic(block_magic_t magic, block_magic_t leaf_magic) {
+    return magic == leaf_magic || magic == compressed_leaf_magic(leaf_magic);
+}
+
 void init(value_sizer_t<void> *sizer, leaf_node_t *node) {
     node->magic = sizer->btree_leaf_magic();
     node->num_pairs = 0;
@@ -451,6 +647,16 @@ void init(value_sizer_t<void> *sizer, leaf_node_t *node) {
     node->tstamp_cutpoint = node->frontmost;
 }
 
+// Initializes a node whose keys are stored relative to `prefix`, or
+// in full if `prefix` is NULL.
+void init(value_sizer_t<void> *sizer, leaf_node_t *node, const btree_key_t *prefix) {
+    init(sizer, node);
+    if (prefix != NULL) {
+        node->magic = compressed_leaf_magic(node->magic);
+        keycpy(reinterpret_cast<btree_key_t *>(node->pair_offsets), prefix);
+    }
+}
+
 int free_space(value_sizer_t<void> *sizer) {
     return sizer->block_size().value() - offsetof(leaf_node_t, pair_offsets);
 }
@@ -459,7 +665,7 @@ int free_space(value_sizer_t<void> *sizer) {
 // in the closed interval [0, free_space(sizer)].  Outputs the offset
 // of the first entry for which storing a timestamp is not mandatory.
 int mandatory_cost(value_sizer_t<void> *sizer, const leaf_node_t *node, int required_timestamps, int *tstamp_back_offset_out) {
-    int size = node->live_size;
+    int size = prefix_storage_size(node) + node->live_size;
 
     // node->live_size does not include deletion entries, deletion
     // entries' timestamps, and live entries' timestamps.  We add that
@@ -476,7 +682,7 @@ int mandatory_cost(value_sizer_t<void> *sizer, const leaf_node_t *node, int requ
                 break;
             }
 
-            int this_entry_cost = sizeof(uint16_t) + sizeof(repli_timestamp_t) + entry_size(sizer, ent);
+            int this_entry_cost = sizeof(uint16_t) + sizeof(repli_timestamp_t) + entry_size(sizer, node, ent);
             deletions_cost += this_entry_cost;
             size += this_entry_cost;
             ++count;
@@ -498,11 +704,13 @@ int mandatory_cost(value_sizer_t<void> *sizer, const leaf_node_t *node, int requ
     return mandatory_cost(sizer, node, required_timestamps, &ignored);
 }
 
-int leaf_epsilon(value_sizer_t<void> *sizer) {
+int leaf_epsilon(value_sizer_t<void> *sizer, bool compressed) {
     // Returns the maximum possible entry size, i.e. the key cost plus
     // the value cost plus pair_offsets plus timestamp cost.
 
-    int key_cost = sizeof(uint8_t) + MAX_KEY_SIZE;
+    // Compressed nodes might have to store a whole key plus the shared
+    // prefix length.
+    int key_cost = sizeof(uint8_t) + MAX_KEY_SIZE + (compressed ? sizeof(uint8_t) : 0);
 
     // If the value is always empty, the DELETE_ENTRY_CODE byte needs to be considered.
     int n = std::max(sizer->max_possible_size(), 1);
@@ -512,6 +720,15 @@ int leaf_epsilon(value_sizer_t<void> *sizer) {
     return key_cost + n + pair_offsets_cost + timestamp_cost;
 }
 
+int leaf_epsilon(value_sizer_t<void> *sizer, const leaf_node_t *node) {
+    return leaf_epsilon(sizer, is_compressed(node));
+}
+
+// Nodes whose mandatory cost is below this are underfull.
+int underfull_threshold(value_sizer_t<void> *sizer, bool compressed) {
+    return free_space(sizer) / 2 - leaf_epsilon(sizer, compressed);
+}
+
 bool is_empty(const leaf_node_t *node) {
     return node->num_pairs == 0;
 }
@@ -526,7 +743,7 @@ bool is_full(value_sizer_t<void> *sizer, const leaf_node_t *node, const btree_ke
     // insert.  We conservatively assume the key is not already
     // contained in the node.
 
-    size += sizeof(uint16_t) + sizeof(repli_timestamp_t) + key->full_size() + sizer->size(value);
+    size += sizeof(uint16_t) + sizeof(repli_timestamp_t) + encoded_key_size(node, key) + sizer->size(value);
 
     // The node is full if we can't fit all that data within the free space.
     return size > free_space(sizer);
@@ -548,7 +765,7 @@ bool is_underfull(value_sizer_t<void> *sizer, const leaf_node_t *node) {
     // free_space / 2 - leaf_epsilon.  We don't want an immediately
     // split node to be underfull, hence the threshold used below.
 
-    return mandatory_cost(sizer, node, MANDATORY_TIMESTAMPS) < free_space(sizer) / 2 - leaf_epsilon(sizer);
+    return mandatory_cost(sizer, node, MANDATORY_TIMESTAMPS) < underfull_threshold(sizer, is_compressed(node));
 }
 
 
@@ -573,7 +790,7 @@ void garbage_collect(value_sizer_t<void> *sizer, leaf_node_t *node, int num_tsta
         indices[i] = i;
     }
 
-    std::sort(indices.data(), indices.data() + node->num_pairs, indirect_index_comparator_t(node->pair_offsets));
+    std::sort(indices.data(), indices.data() + node->num_pairs, indirect_index_comparator_t(get_pair_offsets(node)));
 
     int mand_offset;
     UNUSED int cost = mandatory_cost(sizer, node, num_tstamped, &mand_offset);
@@ -581,7 +798,7 @@ void garbage_collect(value_sizer_t<void> *sizer, leaf_node_t *node, int num_tsta
     int w = sizer->block_size().value();
     int i = node->num_pairs - 1;
     for (; i >= 0; --i) {
-        int offset = node->pair_offsets[indices[i]];
+        int offset = get_pair_offsets(node)[indices[i]];
 
         if (offset < mand_offset) {
             break;
@@ -589,29 +806,29 @@ void garbage_collect(value_sizer_t<void> *sizer, leaf_node_t *node, int num_tsta
 
         entry_t *ent = get_entry(node, offset);
         if (entry_is_live(ent)) {
-            int sz = entry_size(sizer, ent);
+            int sz = entry_size(sizer, node, ent);
             w -= sz;
             memmove(get_at_offset(node, w), ent, sz);
-            node->pair_offsets[indices[i]] = w;
+            get_pair_offsets(node)[indices[i]] = w;
         } else {
-            node->pair_offsets[indices[i]] = 0;
+            get_pair_offsets(node)[indices[i]] = 0;
         }
     }
 
-    // Either i < 0 or node->pair_offsets[indices[i]] < mand_offset.
+    // Either i < 0 or get_pair_offsets(node)[indices[i]] < mand_offset.
 
     node->tstamp_cutpoint = w;
 
     for (; i >= 0; --i) {
-        int offset = node->pair_offsets[indices[i]];
+        int offset = get_pair_offsets(node)[indices[i]];
 
         // Preserve the timestamp.
-        int sz = sizeof(repli_timestamp_t) + entry_size(sizer, get_entry(node, offset));
+        int sz = sizeof(repli_timestamp_t) + entry_size(sizer, node, get_entry(node, offset));
 
         w -= sz;
 
         memmove(get_at_offset(node, w), get_at_offset(node, offset), sz);
-        node->pair_offsets[indices[i]] = w;
+        get_pair_offsets(node)[indices[i]] = w;
     }
 
     node->frontmost = w;
@@ -623,8 +840,8 @@ void garbage_collect(value_sizer_t<void> *sizer, leaf_node_t *node, int num_tsta
             *preserved_index = j;
         }
 
-        if (node->pair_offsets[k] != 0) {
-            node->pair_offsets[j] = node->pair_offsets[k];
+        if (get_pair_offsets(node)[k] != 0) {
+            get_pair_offsets(node)[j] = get_pair_offsets(node)[k];
 
             j += 1;
         }
@@ -645,6 +862,142 @@ void garbage_collect(value_sizer_t<void> *sizer, leaf_node_t *node, int num_tsta
     rassert(ignore == 0);
 }
 
+// Returns the size `ent`, an entry of `node`, would have in a node
+// with the given prefix (or none).
+int reencoded_entry_size(value_sizer_t<void> *sizer, const leaf_node_t *node, const entry_t *ent, const btree_key_t *prefix_or_null) {
+    store_key_t buf;
+    int key_size = encoded_key_size(prefix_or_null, entry_full_key(node, ent, &buf));
+    if (entry_is_deletion(ent)) {
+        return 1 + key_size;
+    }
+    rassert(entry_is_live(ent));
+    return key_size + sizer->size(entry_value(node, ent));
+}
+
+// Returns what `mandatory_cost(sizer, node, num_tstamped)` would be if
+// the node's keys were stored relative to `prefix_or_null` (or in
+// full, if it's NULL).
+int reencoded_cost(value_sizer_t<void> *sizer, const leaf_node_t *node, const btree_key_t *prefix_or_null, int num_tstamped) {
+    int mand_offset;
+    UNUSED int cost = mandatory_cost(sizer, node, num_tstamped, &mand_offset);
+
+    int size = prefix_storage_size(prefix_or_null);
+    for (int i = 0; i < node->num_pairs; ++i) {
+        int offset = get_pair_offsets(node)[i];
+        const entry_t *ent = get_entry(node, offset);
+        if (offset < mand_offset) {
+            size += sizeof(uint16_t) + sizeof(repli_timestamp_t) + reencoded_entry_size(sizer, node, ent, prefix_or_null);
+        } else if (entry_is_live(ent)) {
+            size += sizeof(uint16_t) + reencoded_entry_size(sizer, node, ent, prefix_or_null);
+        }
+    }
+    return size;
+}
+
+// Writes `ent`, an entry of `node`, to `p` as an entry of `out`.
+void write_reencoded_entry(value_sizer_t<void> *sizer, const leaf_node_t *node, const entry_t *ent, const leaf_node_t *out, char *p) {
+    store_key_t buf;
+    const btree_key_t *key = entry_full_key(node, ent, &buf);
+    if (entry_is_deletion(ent)) {
+        *reinterpret_cast<uint8_t *>(p) = DELETE_ENTRY_CODE;
+        write_encoded_key(out, key, p + 1);
+    } else {
+        const void *value = entry_value(node, ent);
+        memcpy(write_encoded_key(out, key, p), value, sizer->size(value));
+    }
+}
+
+// Writes a copy of `node` to `out` whose keys are stored relative to
+// `prefix_or_null` (or in full, if it's NULL), garbage collecting it
+// the way `garbage_collect(sizer, node, num_tstamped)` would.  The copy
+// must fit, i.e. `reencoded_cost` must be at most `free_space`.
+void reencode(value_sizer_t<void> *sizer, const leaf_node_t *node, const btree_key_t *prefix_or_null, int num_tstamped, leaf_node_t *out) {
+    rassert(reencoded_cost(sizer, node, prefix_or_null, num_tstamped) <= free_space(sizer));
+
+    scoped_array_t<uint16_t> indices(node->num_pairs);
+    for (int i = 0; i < node->num_pairs; ++i) {
+        indices[i] = i;
+    }
+    std::sort(indices.data(), indices.data() + node->num_pairs, indirect_index_comparator_t(get_pair_offsets(node)));
+
+    int mand_offset;
+    UNUSED int cost = mandatory_cost(sizer, node, num_tstamped, &mand_offset);
+
+    init(sizer, out, prefix_or_null);
+    uint16_t *out_offsets = get_pair_offsets(out);
+
+    int w = sizer->block_size().value();
+    int i = node->num_pairs - 1;
+    for (; i >= 0; --i) {
+        int offset = get_pair_offsets(node)[indices[i]];
+
+        if (offset < mand_offset) {
+            break;
+        }
+
+        const entry_t *ent = get_entry(node, offset);
+        if (entry_is_live(ent)) {
+            int sz = reencoded_entry_size(sizer, node, ent, prefix_or_null);
+            w -= sz;
+            write_reencoded_entry(sizer, node, ent, out, get_at_offset(out, w));
+            out_offsets[indices[i]] = w;
+            out->live_size += sizeof(uint16_t) + sz;
+        } else {
+            out_offsets[indices[i]] = 0;
+        }
+    }
+
+    out->tstamp_cutpoint = w;
+
+    for (; i >= 0; --i) {
+        int offset = get_pair_offsets(node)[indices[i]];
+        const entry_t *ent = get_entry(node, offset);
+
+        // Preserve the timestamp.
+        int sz = reencoded_entry_size(sizer, node, ent, prefix_or_null);
+        w -= sizeof(repli_timestamp_t) + sz;
+        *reinterpret_cast<repli_timestamp_t *>(get_at_offset(out, w)) = get_timestamp(node, offset);
+        write_reencoded_entry(sizer, node, ent, out, get_at_offset(out, w + sizeof(repli_timestamp_t)));
+        out_offsets[indices[i]] = w;
+        if (entry_is_live(ent)) {
+            out->live_size += sizeof(uint16_t) + sz;
+        }
+    }
+
+    out->frontmost = w;
+
+    // Now squash dead indices.
+    int j = 0;
+    for (int k = 0; k < node->num_pairs; ++k) {
+        if (out_offsets[k] != 0) {
+            out_offsets[j] = out_offsets[k];
+            ++j;
+        }
+    }
+    out->num_pairs = j;
+
+    validate(sizer, out);
+}
+
+void reencode(value_sizer_t<void> *sizer, leaf_node_t *node, const btree_key_t *prefix_or_null, int num_tstamped) {
+    scoped_malloc_t<leaf_node_t> tmp(sizer->block_size().value());
+    reencode(sizer, node, prefix_or_null, num_tstamped, tmp.get());
+    memcpy(node, tmp.get(), sizer->block_size().value());
+}
+
+// Returns the longest prefix shared by all the keys in `node`, which
+// is what a compressed copy of `node` would best use as its prefix.
+void common_key_prefix(const leaf_node_t *node, store_key_t *out) {
+    if (node->num_pairs == 0) {
+        out->set_size(0);
+        return;
+    }
+    store_key_t first_buf, last_buf;
+    const btree_key_t *first = entry_full_key(node, get_entry(node, get_pair_offsets(node)[0]), &first_buf);
+    const btree_key_t *last = entry_full_key(node, get_entry(node, get_pair_offsets(node)[node->num_pairs - 1]), &last_buf);
+    out->assign(shared_prefix_size(first, last), first->contents);
+}
+
 void clean_entry(void *p, int sz) {
     rassert(sz > 0);
 
@@ -669,6 +1022,7 @@ void clean_entry(void *p, int sz) {
 // Moves entries with pair_offsets indices in the clopen range [beg,
 // end) from fro to tow.
 void move_elements(value_sizer_t<void> *sizer, leaf_node_t *fro, int beg, int end, int wpoint, leaf_node_t *tow, int fro_copysize, int fro_mand_offset) {
+    rassert(same_key_encoding(fro, tow));
     rassert(is_underfull(sizer, tow));
 
     // This assertion is a bit loose.
@@ -679,7 +1033,7 @@ void move_elements(value_sizer_t<void> *sizer, leaf_node_t *fro, int beg, int en
     garbage_collect(sizer, tow, MANDATORY_TIMESTAMPS, &wpoint);
 
     // Now resize and move tow's pair_offsets.
-    memmove(tow->pair_offsets + wpoint + (end - beg), tow->pair_offsets + wpoint, sizeof(uint16_t) * (tow->num_pairs - wpoint));
+    memmove(get_pair_offsets(tow) + wpoint + (end - beg), get_pair_offsets(tow) + wpoint, sizeof(uint16_t) * (tow->num_pairs - wpoint));
 
     tow->num_pairs += end - beg;
 
@@ -688,18 +1042,18 @@ void move_elements(value_sizer_t<void> *sizer, leaf_node_t *fro, int beg, int en
     // Now we're going to do something crazy.  Fill the new hole in
     // the pair offsets with the numbers in [0, end - beg).
     for (int i = 0; i < end - beg; ++i) {
-        tow->pair_offsets[wpoint + i] = i;
+        get_pair_offsets(tow)[wpoint + i] = i;
     }
 
     // We treat these numbers as indices into [beg, end) in fro, and
     // sort them so that we can access [beg, end) in order by
     // increasing offset.
-    std::sort(tow->pair_offsets + wpoint, tow->pair_offsets + wpoint + (end - beg), indirect_index_comparator_t(fro->pair_offsets + beg));
+    std::sort(get_pair_offsets(tow) + wpoint, get_pair_offsets(tow) + wpoint + (end - beg), indirect_index_comparator_t(get_pair_offsets(fro) + beg));
 
     int tow_offset = tow->frontmost;
 
     // The offset we read from (indirectly pointing to fro's [beg,
-    // end)) in tow->pair_offsets, and the offset at which we stop.
+    // end)) in get_pair_offsets(tow), and the offset at which we stop.
     int fro_index = wpoint;
     int fro_index_end = wpoint + (end - beg);
 
@@ -714,7 +1068,7 @@ void move_elements(value_sizer_t<void> *sizer, leaf_node_t *fro, int beg, int en
     int livesize = tow->live_size;
 
     for (int i = 0; i < wpoint; ++i) {
-        if (tow->pair_offsets[i] < tow->tstamp_cutpoint) {
+        if (get_pair_offsets(tow)[i] < tow->tstamp_cutpoint) {
             rassert(num_adjustable_tow_offsets < MANDATORY_TIMESTAMPS);
             adjustable_tow_offsets[num_adjustable_tow_offsets] = i;
             ++num_adjustable_tow_offsets;
@@ -722,7 +1076,7 @@ void move_elements(value_sizer_t<void> *sizer, leaf_node_t *fro, int beg, int en
     }
 
     for (int i = wpoint + (end - beg); i < tow->num_pairs; ++i) {
-        if (tow->pair_offsets[i] < tow->tstamp_cutpoint) {
+        if (get_pair_offsets(tow)[i] < tow->tstamp_cutpoint) {
             rassert(num_adjustable_tow_offsets < MANDATORY_TIMESTAMPS);
             adjustable_tow_offsets[num_adjustable_tow_offsets] = i;
             ++num_adjustable_tow_offsets;
@@ -739,7 +1093,7 @@ void move_elements(value_sizer_t<void> *sizer, leaf_node_t *fro, int beg, int en
             break;
         }
 
-        int fro_offset = fro->pair_offsets[beg + tow->pair_offsets[fro_index]];
+        int fro_offset = get_pair_offsets(fro)[beg + get_pair_offsets(tow)[fro_index]];
 
         if (fro_offset >= fro_mand_offset) {
             // We have no more timestamped information to push.
@@ -752,7 +1106,7 @@ void move_elements(value_sizer_t<void> *sizer, leaf_node_t *fro, int beg, int en
         // Greater timestamps go first.
         if (tow_tstamp < fro_tstamp) {
             entry_t *ent = get_entry(fro, fro_offset);
-            int entsz = entry_size(sizer, ent);
+            int entsz = entry_size(sizer, fro, ent);
             int sz = sizeof(repli_timestamp_t) + entsz;
             memmove(get_at_offset(tow, wri_offset), get_at_offset(fro, fro_offset), sz);
 
@@ -766,22 +1120,22 @@ void move_elements(value_sizer_t<void> *sizer, leaf_node_t *fro, int beg, int en
             // Update the pair offset in fro to be the offset in tow
             // -- we'll never use the old value again and we'll copy
             // the newer values to tow later.
-            fro->pair_offsets[beg + tow->pair_offsets[fro_index]] = wri_offset;
+            get_pair_offsets(fro)[beg + get_pair_offsets(tow)[fro_index]] = wri_offset;
 
             fro_copyage += sz;
             wri_offset += sz;
             fro_index++;
 
         } else {
-            int sz = sizeof(repli_timestamp_t) + entry_size(sizer, get_entry(tow, tow_offset));
+            int sz = sizeof(repli_timestamp_t) + entry_size(sizer, tow, get_entry(tow, tow_offset));
             memmove(get_at_offset(tow, wri_offset), get_at_offset(tow, tow_offset), sz);
 
             // Update the pair offset of the entry we've moved.
             int i;
             for (i = 0; i < num_adjustable_tow_offsets; ++i) {
                 int j = adjustable_tow_offsets[i];
-                if (tow->pair_offsets[j] == tow_offset) {
-                    tow->pair_offsets[j] = wri_offset;
+                if (get_pair_offsets(tow)[j] == tow_offset) {
+                    get_pair_offsets(tow)[j] = wri_offset;
                     break;
                 }
             }
@@ -798,15 +1152,15 @@ void move_elements(value_sizer_t<void> *sizer, leaf_node_t *fro, int beg, int en
 
     // Now we have some untimestamped entries to write.
     for (; fro_index < fro_index_end; ++fro_index) {
-        int fro_offset = fro->pair_offsets[beg + tow->pair_offsets[fro_index]];
+        int fro_offset = get_pair_offsets(fro)[beg + get_pair_offsets(tow)[fro_index]];
         entry_t *ent = get_entry(fro, fro_offset);
         if (entry_is_live(ent)) {
-            int sz = entry_size(sizer, ent);
+            int sz = entry_size(sizer, fro, ent);
             memmove(get_at_offset(tow, wri_offset), ent, sz);
             clean_entry(ent, sz);
             fro_live_size_adjustment -= sz + sizeof(uint16_t);
 
-            fro->pair_offsets[beg + tow->pair_offsets[fro_index]] = wri_offset;
+            get_pair_offsets(fro)[beg + get_pair_offsets(tow)[fro_index]] = wri_offset;
             wri_offset += sz;
             fro_copyage += sz;
             livesize += sz + sizeof(uint16_t);
@@ -814,9 +1168,9 @@ void move_elements(value_sizer_t<void> *sizer, leaf_node_t *fro, int beg, int en
             rassert(entry_is_deletion(ent));
 
             // This is a dead entry.  We'll need to squash this dead entry later.
-            fro->pair_offsets[beg + tow->pair_offsets[fro_index]] = 0;
+            get_pair_offsets(fro)[beg + get_pair_offsets(tow)[fro_index]] = 0;
 
-            int sz = entry_size(sizer, ent);
+            int sz = entry_size(sizer, fro, ent);
             clean_entry(ent, sz);
         }
     }
@@ -829,7 +1183,7 @@ void move_elements(value_sizer_t<void> *sizer, leaf_node_t *fro, int beg, int en
         rassert(wri_offset <= tow_offset);
 
         entry_t *ent = get_entry(tow, tow_offset);
-        int sz = entry_size(sizer, ent);
+        int sz = entry_size(sizer, tow, ent);
         if (entry_is_live(ent)) {
             memmove(get_at_offset(tow, wri_offset), ent, sz);
 
@@ -837,8 +1191,8 @@ void move_elements(value_sizer_t<void> *sizer, leaf_node_t *fro, int beg, int en
             int i;
             for (i = 0; i < num_adjustable_tow_offsets; ++i) {
                 int j = adjustable_tow_offsets[i];
-                if (tow->pair_offsets[j] == tow_offset) {
-                    tow->pair_offsets[j] = wri_offset;
+                if (get_pair_offsets(tow)[j] == tow_offset) {
+                    get_pair_offsets(tow)[j] = wri_offset;
                     break;
                 }
             }
@@ -854,8 +1208,8 @@ void move_elements(value_sizer_t<void> *sizer, leaf_node_t *fro, int beg, int en
             int i;
             for (i = 0; i < num_adjustable_tow_offsets; ++i) {
                 int j = adjustable_tow_offsets[i];
-                if (tow->pair_offsets[j] == tow_offset) {
-                    tow->pair_offsets[j] = 0;
+                if (get_pair_offsets(tow)[j] == tow_offset) {
+                    get_pair_offsets(tow)[j] = 0;
                 }
             }
         }
@@ -877,9 +1231,9 @@ void move_elements(value_sizer_t<void> *sizer, leaf_node_t *fro, int beg, int en
 
     // Copy the valid tow offsets from [beg, end) to the wpoint point
     // in tow, and move fro entries.
-    memcpy(tow->pair_offsets + wpoint, fro->pair_offsets + beg,
+    memcpy(get_pair_offsets(tow) + wpoint, get_pair_offsets(fro) + beg,
            sizeof(uint16_t) * (end - beg));
-    memmove(fro->pair_offsets + beg, fro->pair_offsets + end, sizeof(uint16_t) * (fro->num_pairs - end));
+    memmove(get_pair_offsets(fro) + beg, get_pair_offsets(fro) + end, sizeof(uint16_t) * (fro->num_pairs - end));
     fro->num_pairs -= end - beg;
 
     tow->frontmost = new_frontmost;
@@ -895,8 +1249,8 @@ void move_elements(value_sizer_t<void> *sizer, leaf_node_t *fro, int beg, int en
         // for, and that we removed from tow, as well.
         int j, k;
         for (j = 0, k = 0; k < tow->num_pairs; ++k) {
-            if (tow->pair_offsets[k] != 0) {
-                tow->pair_offsets[j] = tow->pair_offsets[k];
+            if (get_pair_offsets(tow)[k] != 0) {
+                get_pair_offsets(tow)[j] = get_pair_offsets(tow)[k];
 
                 j += 1;
             }
@@ -908,11 +1262,26 @@ void move_elements(value_sizer_t<void> *sizer, leaf_node_t *fro, int beg, int en
     validate(sizer, tow);
 }
 
+// Gives a compressed node the longest prefix that its keys share, if
+// that saves space without making the node underfull.
+void tighten_prefix(value_sizer_t<void> *sizer, leaf_node_t *node) {
+    if (!is_compressed(node)) {
+        return;
+    }
+    store_key_t prefix;
+    common_key_prefix(node, &prefix);
+    int cost = reencoded_cost(sizer, node, prefix.btree_key(), MANDATORY_TIMESTAMPS);
+    if (cost < mandatory_cost(sizer, node, MANDATORY_TIMESTAMPS)
+        && cost >= underfull_threshold(sizer, true)) {
+        reencode(sizer, node, prefix.btree_key(), MANDATORY_TIMESTAMPS);
+    }
+}
+
 void split(value_sizer_t<void> *sizer, leaf_node_t *node, leaf_node_t *rnode, btree_key_t *median_out) {
     int tstamp_back_offset;
     int mandatory = mandatory_cost(sizer, node, MANDATORY_TIMESTAMPS, &tstamp_back_offset);
 
-    rassert(mandatory >= free_space(sizer) - leaf_epsilon(sizer));
+    rassert(mandatory >= free_space(sizer) - leaf_epsilon(sizer, node));
 
     // We shall split the mandatory cost of this node as evenly as possible.
 
@@ -921,7 +1290,7 @@ void split(value_sizer_t<void> *sizer, leaf_node_t *node, leaf_node_t *rnode, bt
     int prev_rcost = 0;
     int rcost = 0;
     while (i >= 0 && rcost < mandatory / 2) {
-        int offset = node->pair_offsets[i];
+        int offset = get_pair_offsets(node)[i];
         entry_t *ent = get_entry(node, offset);
 
         // We only take mandatory entries' costs into consideration,
@@ -932,7 +1301,7 @@ void split(value_sizer_t<void> *sizer, leaf_node_t *node, leaf_node_t *rnode, bt
 
         if (entry_is_live(ent)) {
             prev_rcost = rcost;
-            rcost += entry_size(sizer, ent) + sizeof(uint16_t) + (offset < tstamp_back_offset ? sizeof(repli_timestamp_t) : 0);
+            rcost += entry_size(sizer, node, ent) + sizeof(uint16_t) + (offset < tstamp_back_offset ? sizeof(repli_timestamp_t) : 0);
 
             ++num_mandatories;
         } else {
@@ -940,7 +1309,7 @@ void split(value_sizer_t<void> *sizer, leaf_node_t *node, leaf_node_t *rnode, bt
 
             if (offset < tstamp_back_offset) {
                 prev_rcost = rcost;
-                rcost += entry_size(sizer, ent) + sizeof(uint16_t) + sizeof(repli_timestamp_t);
+                rcost += entry_size(sizer, node, ent) + sizeof(uint16_t) + sizeof(repli_timestamp_t);
 
                 ++num_mandatories;
             }
@@ -970,32 +1339,78 @@ void split(value_sizer_t<void> *sizer, leaf_node_t *node, leaf_node_t *rnode, bt
 
     // If our math was right, neither node can be underfull just
     // considering the split of the mandatory costs.
-    rassert(end_rcost >= free_space(sizer) / 2 - leaf_epsilon(sizer));
-    rassert(mandatory - end_rcost >= free_space(sizer) / 2 - leaf_epsilon(sizer));
+    rassert(end_rcost >= free_space(sizer) / 2 - leaf_epsilon(sizer, node));
+    rassert(mandatory - end_rcost >= free_space(sizer) / 2 - leaf_epsilon(sizer, node));
 
     // Now we wish to move the elements at indices [s, num_pairs) to rnode.
 
-    init(sizer, rnode);
+    // rnode stores its keys the same way, so that we can copy entries
+    // over as they are.
+    init(sizer, rnode, get_prefix_or_null(node));
 
     int node_copysize = end_rcost - num_mandatories * sizeof(uint16_t);
     move_elements(sizer, node, s, node->num_pairs, 0, rnode, node_copysize, tstamp_back_offset);
 
-    keycpy(median_out, entry_key(get_entry(node, node->pair_offsets[s - 1])));
+    store_key_t median;
+    keycpy(median_out, entry_full_key(node, get_entry(node, get_pair_offsets(node)[s - 1]), &median));
+
+    tighten_prefix(sizer, node);
+    tighten_prefix(sizer, rnode);
+}
+
+// Picks the way a merge of `a` and `b` stores its keys: relative to
+// `*prefix_out` if this returns true, or in full otherwise.
+bool merged_key_encoding(value_sizer_t<void> *sizer, const leaf_node_t *a, const leaf_node_t *b, store_key_t *prefix_out) {
+    if (same_key_encoding(a, b)) {
+        if (is_compressed(a)) {
+            prefix_out->assign(get_prefix(a));
+        }
+        return is_compressed(a);
+    }
+
+    if (a->num_pairs == 0) {
+        common_key_prefix(b, prefix_out);
+    } else if (b->num_pairs == 0) {
+        common_key_prefix(a, prefix_out);
+    } else {
+        store_key_t a_prefix, b_prefix;
+        common_key_prefix(a, &a_prefix);
+        common_key_prefix(b, &b_prefix);
+        prefix_out->assign(shared_prefix_size(a_prefix.btree_key(), b_prefix.btree_key()), a_prefix.contents());
+    }
+
+    if (prefix_out->size() == 0) {
+        return false;
+    }
+
+    int plain_cost = reencoded_cost(sizer, a, NULL, MANDATORY_TIMESTAMPS) + reencoded_cost(sizer, b, NULL, MANDATORY_TIMESTAMPS);
+    const btree_key_t *prefix = prefix_out->btree_key();
+    // The merged node stores the prefix only once.
+    int compressed_cost = reencoded_cost(sizer, a, prefix, MANDATORY_TIMESTAMPS) + reencoded_cost(sizer, b, prefix, MANDATORY_TIMESTAMPS) - prefix_storage_size(prefix);
+    return compressed_cost < plain_cost;
 }
 
 void merge(value_sizer_t<void> *sizer, leaf_node_t *left, leaf_node_t *right) {
     rassert(left != right);
 
+    if (!same_key_encoding(left, right)) {
+        store_key_t prefix;
+        bool compressed = merged_key_encoding(sizer, left, right, &prefix);
+        reencode(sizer, left, compressed ? prefix.btree_key() : NULL, MANDATORY_TIMESTAMPS);
+        reencode(sizer, right, compressed ? prefix.btree_key() : NULL, MANDATORY_TIMESTAMPS);
+    }
+
     rassert(is_underfull(sizer, left));
     rassert(is_underfull(sizer, right));
 
     int tstamp_back_offset;
     int mandatory = mandatory_cost(sizer, left, MANDATORY_TIMESTAMPS, &tstamp_back_offset);
 
-    int left_copysize = mandatory;
+    // right already stores the prefix.
+    int left_copysize = mandatory - prefix_storage_size(left);
     // Uncount the uint16_t cost of mandatory  entries.  Sigh.
     for (int i = 0; i < left->num_pairs; ++i) {
-        if (left->pair_offsets[i] < tstamp_back_offset || entry_is_deletion(get_entry(left, left->pair_offsets[i]))) {
+        if (get_pair_offsets(left)[i] < tstamp_back_offset || entry_is_deletion(get_entry(left, get_pair_offsets(left)[i]))) {
             left_copysize -= sizeof(uint16_t);
         }
     }
@@ -1007,6 +1422,22 @@ void merge(value_sizer_t<void> *sizer, leaf_node_t *left, leaf_node_t *right) {
 bool level(value_sizer_t<void> *sizer, int nodecmp_node_with_sib, leaf_node_t *node, leaf_node_t *sibling, btree_key_t *replacement_key_out) {
     rassert(node != sibling);
 
+    if (!same_key_encoding(node, sibling)) {
+        // We copy entries from sibling to node as they are, so node has
+        // to store its keys the way sibling does.  If it can't do that
+        // and stay lighter than sibling, we leave both alone.  (The
+        // sibling might be underfull too, if the nodes weren't mergable
+        // because of their encodings.)
+        const btree_key_t *prefix = get_prefix_or_null(sibling);
+        int node_weight = reencoded_cost(sizer, node, prefix, MANDATORY_TIMESTAMPS);
+        if (is_underfull(sizer, sibling)
+            || node_weight >= underfull_threshold(sizer, is_compressed(sibling))
+            || node_weight >= mandatory_cost(sizer, sibling, MANDATORY_TIMESTAMPS)) {
+            return false;
+        }
+        reencode(sizer, node, prefix, MANDATORY_TIMESTAMPS);
+    }
+
     // If sibling were underfull, we'd just merge the nodes.
     rassert(is_underfull(sizer, node));
     rassert(!is_underfull(sizer, sibling));
@@ -1045,12 +1476,12 @@ bool level(value_sizer_t<void> *sizer, int nodecmp_node_with_sib, leaf_node_t *n
     int num_mandatories = 0;
     int prev_diff = sizer->block_size().value();  // some impossibly large value
     for (;;) {
-        int offset = sibling->pair_offsets[*w];
+        int offset = get_pair_offsets(sibling)[*w];
         entry_t *ent = get_entry(sibling, offset);
 
         // We only take mandatory entries' costs into consideration.
         if (entry_is_live(ent)) {
-            int sz = entry_size(sizer, ent) + sizeof(uint16_t) + (offset < tstamp_back_offset ? sizeof(repli_timestamp_t) : 0);
+            int sz = entry_size(sizer, sibling, ent) + sizeof(uint16_t) + (offset < tstamp_back_offset ? sizeof(repli_timestamp_t) : 0);
             prev_diff = sibling_weight - node_weight;
             prev_weight_movement = weight_movement;
             weight_movement += sz;
@@ -1062,7 +1493,7 @@ bool level(value_sizer_t<void> *sizer, int nodecmp_node_with_sib, leaf_node_t *n
             rassert(entry_is_deletion(ent));
 
             if (offset < tstamp_back_offset) {
-                int sz = entry_size(sizer, ent) + sizeof(uint16_t) + sizeof(repli_timestamp_t);
+                int sz = entry_size(sizer, sibling, ent) + sizeof(uint16_t) + sizeof(repli_timestamp_t);
                 prev_diff = sibling_weight - node_weight;
                 prev_weight_movement = weight_movement;
                 weight_movement += sz;
@@ -1100,36 +1531,43 @@ bool level(value_sizer_t<void> *sizer, int nodecmp_node_with_sib, leaf_node_t *n
     guarantee(node->num_pairs > 0);
     guarantee(sibling->num_pairs > 0);
 
+    store_key_t replacement;
     if (nodecmp_node_with_sib < 0) {
-        keycpy(replacement_key_out, entry_key(get_entry(node, node->pair_offsets[node->num_pairs - 1])));
+        keycpy(replacement_key_out, entry_full_key(node, get_entry(node, get_pair_offsets(node)[node->num_pairs - 1]), &replacement));
     } else {
-        keycpy(replacement_key_out, entry_key(get_entry(sibling, sibling->pair_offsets[sibling->num_pairs - 1])));
+        keycpy(replacement_key_out, entry_full_key(sibling, get_entry(sibling, get_pair_offsets(sibling)[sibling->num_pairs - 1]), &replacement));
     }
 
     return true;
 }
 
 bool is_mergable(value_sizer_t<void> *sizer, const leaf_node_t *node, const leaf_node_t *sibling) {
-    return is_underfull(sizer, node) && is_underfull(sizer, sibling);
-}
+    if (same_key_encoding(node, sibling)) {
+        return is_underfull(sizer, node) && is_underfull(sizer, sibling);
+    }
 
-// Sets *index_out to the index for the live entry or deletion entry
-// for the key, or to the index the key would have if it were
-// inserted.  Returns true if the key at said index is actually equal.
-bool find_key(const leaf_node_t *node, const btree_key_t *key, int *index_out) {
-    int beg = 0;
-    int end = node->num_pairs;
+    // merge() will convert both nodes to a common encoding first.
+    store_key_t prefix;
+    bool compressed = merged_key_encoding(sizer, node, sibling, &prefix);
+    const btree_key_t *prefix_or_null = compressed ? prefix.btree_key() : NULL;
+    int threshold = underfull_threshold(sizer, compressed);
+    return reencoded_cost(sizer, node, prefix_or_null, MANDATORY_TIMESTAMPS) < threshold
+        && reencoded_cost(sizer, sibling, prefix_or_null, MANDATORY_TIMESTAMPS) < threshold;
+}
 
+// Does the work of find_key, given that key > *(beg - 1) (unless beg == 0)
+// and key < *end (unless end == num_pairs).
+bool find_key_in_range(const leaf_node_t *node, const btree_key_t *key, int beg, int end, int *index_out) {
     // beg == 0 or key > *(beg - 1).
     // end == num_pairs or key < *end.
 
+    int key_shared = is_compressed(node) ? shared_prefix_size(key, get_prefix(node)) : 0;
+
     while (beg < end) {
         // when (end - beg) > 0, (end - beg) / 2 is always less than (end - beg).  So beg <= test_point < end.
         int test_point = beg + (end - beg) / 2;
 
-        const btree_key_t *ek = entry_key(get_entry(node, node->pair_offsets[test_point]));
-
-        int res = sized_strcmp(key->contents, key->size, ek->contents, ek->size);
+        int res = entry_key_cmp(node, key, key_shared, get_entry(node, get_pair_offsets(node)[test_point]));
 
         if (res < 0) {
             // key < *test_point.
@@ -1151,18 +1589,51 @@ bool find_key(const leaf_node_t *node, const btree_key_t *key, int *index_out) {
     return false;
 }
 
+// Sets *index_out to the index for the live entry or deletion entry
+// for the key, or to the index the key would have if it were
+// inserted.  Returns true if the key at said index is actually equal.
+bool find_key(const leaf_node_t *node, const btree_key_t *key, int *index_out) {
+    return find_key_in_range(node, key, 0, node->num_pairs, index_out);
+}
+
+bool find_key(const leaf_node_t *node, const key_prefix_index_t *prefix_index, const btree_key_t *key, int *index_out) {
+    rassert(prefix_index->size() == node->num_pairs);
+    int beg, end;
+    prefix_index->narrow(key, &beg, &end);
+    return find_key_in_range(node, key, beg, end, index_out);
+}
+
+// Copies the value at index into value_out, if it's a live entry.
+bool lookup_value_at(value_sizer_t<void> *sizer, const leaf_node_t *node, int index, void *value_out) {
+    const entry_t *ent = get_entry(node, get_pair_offsets(node)[index]);
+    if (entry_is_live(ent)) {
+        const void *val = entry_value(node, ent);
+        memcpy(value_out, val, sizer->size(val));
+        return true;
+    }
+    return false;
+}
+
 bool lookup(value_sizer_t<void> *sizer, const leaf_node_t *node, const btree_key_t *key, void *value_out) {
     int index;
-    if (find_key(node, key, &index)) {
-        const entry_t *ent = get_entry(node, node->pair_offsets[index]);
-        if (entry_is_live(ent)) {
-            const void *val = entry_value(ent);
-            memcpy(value_out, val, sizer->size(val));
-            return true;
-        }
-    }
+    return find_key(node, key, &index) && lookup_value_at(sizer, node, index, value_out);
+}
 
-    return false;
+bool lookup(value_sizer_t<void> *sizer, const leaf_node_t *node, const key_prefix_index_t *prefix_index, const btree_key_t *key, void *value_out) {
+    int index;
+    return find_key(node, prefix_index, key, &index) && lookup_value_at(sizer, node, index, value_out);
+}
+
+key_prefix_index_t *make_key_prefix_index(const leaf_node_t *node) {
+    // Compressed nodes don't store their keys in full.
+    std::vector<store_key_t> full_keys(is_compressed(node) ? node->num_pairs : 0);
+    std::vector<const btree_key_t *> keys;
+    keys.reserve(node->num_pairs);
+    for (int i = 0; i < node->num_pairs; ++i) {
+        const entry_t *ent = get_entry(node, get_pair_offsets(node)[i]);
+        keys.push_back(is_compressed(node) ? entry_full_key(node, ent, &full_keys[i]) : entry_key(node, ent));
+    }
+    return new key_prefix_index_t(keys);
 }
 
 /* `insert()` and `remove()` call this to insert a new entry into the leaf node.
@@ -1200,10 +1671,10 @@ MUST_USE bool prepare_space_for_new_entry(value_sizer_t<void> *sizer, leaf_node_
     bool found = find_key(node, key, &index);
 
     if (found) {
-        int offset = node->pair_offsets[index];
+        int offset = get_pair_offsets(node)[index];
         entry_t *ent = get_entry(node, offset);
 
-        int sz = entry_size(sizer, ent);
+        int sz = entry_size(sizer, node, ent);
 
         if (entry_is_live(ent)) {
             node->live_size -= sizeof(uint16_t) + sz;
@@ -1224,7 +1695,7 @@ MUST_USE bool prepare_space_for_new_entry(value_sizer_t<void> *sizer, leaf_node_
     /* Garbage collect if appropriate. We do it after cleaning up any existing
     entry so that deletion always works no matter how full the node is. */
 
-    if (offsetof(leaf_node_t, pair_offsets) +
+    if (pair_offsets_offset(node) +
             sizeof(uint16_t) * (node->num_pairs + (found ? 0 : 1)) +
             sizeof(repli_timestamp_t) +
             new_entry_size >
@@ -1234,8 +1705,8 @@ MUST_USE bool prepare_space_for_new_entry(value_sizer_t<void> *sizer, leaf_node_
             /* We can't re-use an existing index if we're garbage collecting. */
             found = false;
             memmove(
-                node->pair_offsets + index,
-                node->pair_offsets + index + 1,
+                get_pair_offsets(node) + index,
+                get_pair_offsets(node) + index + 1,
                 sizeof(uint16_t) * (node->num_pairs - index - 1));
             --node->num_pairs;
         }
@@ -1297,8 +1768,8 @@ MUST_USE bool prepare_space_for_new_entry(value_sizer_t<void> *sizer, leaf_node_
             a new one; close the gap in `pair_offsets`. `index` is the location
             of the open slot. */
             memmove(
-                node->pair_offsets + index,
-                node->pair_offsets + index + 1,
+                get_pair_offsets(node) + index,
+                get_pair_offsets(node) + index + 1,
                 sizeof(uint16_t) * (node->num_pairs - index - 1));
             --node->num_pairs;
         }
@@ -1313,8 +1784,8 @@ MUST_USE bool prepare_space_for_new_entry(value_sizer_t<void> *sizer, leaf_node_
 
     if (!found) {
         memmove(
-            node->pair_offsets + index + 1,
-            node->pair_offsets + index,
+            get_pair_offsets(node) + index + 1,
+            get_pair_offsets(node) + index,
             sizeof(uint16_t) * (node->num_pairs - index));
         ++node->num_pairs;
     }
@@ -1339,14 +1810,14 @@ MUST_USE bool prepare_space_for_new_entry(value_sizer_t<void> *sizer, leaf_node_
         the entries */
         for (int i = 0; i < node->num_pairs; ++i) {
             if (i == index) continue;
-            if (node->pair_offsets[i] < end_of_where_new_entry_should_go) {
-                node->pair_offsets[i] -= total_space_for_new_entry;
+            if (get_pair_offsets(node)[i] < end_of_where_new_entry_should_go) {
+                get_pair_offsets(node)[i] -= total_space_for_new_entry;
             }
         }
     }
 
     node->frontmost -= total_space_for_new_entry;
-    rassert(offsetof(leaf_node_t, pair_offsets) + sizeof(uint16_t) * node->num_pairs <= node->frontmost);
+    rassert(pair_offsets_offset(node) + sizeof(uint16_t) * node->num_pairs <= node->frontmost);
 
     /* Write the timestamp if we need one, and update `node->tstamp_cutpoint` if
     we don't. */
@@ -1361,7 +1832,7 @@ MUST_USE bool prepare_space_for_new_entry(value_sizer_t<void> *sizer, leaf_node_
 
     /* Record the offset in `pair_offsets` */
 
-    node->pair_offsets[index] = start_of_where_new_entry_should_go;
+    get_pair_offsets(node)[index] = start_of_where_new_entry_should_go;
 
     /* Fill output variable */
 
@@ -1374,28 +1845,59 @@ MUST_USE bool prepare_space_for_new_entry(value_sizer_t<void> *sizer, leaf_node_
     return true;
 }
 
+// Converts an uncompressed node to the compressed format if that
+// leaves more room, counting the entry for `key` that's about to be
+// inserted.  Nodes only get converted when they're modified anyway,
+// which is how nodes written before the compressed format existed
+// get upgraded.
+void maybe_compress(value_sizer_t<void> *sizer, leaf_node_t *node, const btree_key_t *key) {
+    if (is_compressed(node) || node->num_pairs < 2) {
+        return;
+    }
+
+    store_key_t prefix;
+    common_key_prefix(node, &prefix);
+
+    // Every entry pays one byte for its shared prefix length, so we
+    // can't save anything unless the prefix saves more than that.
+    if (node->num_pairs * (prefix.size() - 1) <= prefix_storage_size(prefix.btree_key())) {
+        return;
+    }
+
+    // These are the costs that is_full considers.
+    int plain_cost = mandatory_cost(sizer, node, MANDATORY_TIMESTAMPS - 1) + key->full_size();
+    int compressed_cost = reencoded_cost(sizer, node, prefix.btree_key(), MANDATORY_TIMESTAMPS - 1)
+        + encoded_key_size(prefix.btree_key(), key);
+    if (compressed_cost < plain_cost) {
+        reencode(sizer, node, prefix.btree_key(), MANDATORY_TIMESTAMPS - 1);
+    }
+}
+
 // Inserts a key/value pair into the node.  Hopefully you've already
 // cleaned up the old value, if there is one.
 void insert(value_sizer_t<void> *sizer, leaf_node_t *node, const btree_key_t *key, const void *value, repli_timestamp_t tstamp, DEBUG_VAR key_modification_proof_t km_proof) {
     rassert(!is_full(sizer, node, key, value));
     rassert(!km_proof.is_fake());
 
+    maybe_compress(sizer, node, key);
+
     /* Make space for the entry itself */
 
+    int key_size = encoded_key_size(node, key);
+
     char *location_to_write_data;
     DEBUG_VAR bool should_write = prepare_space_for_new_entry(sizer, node,
-        key, key->full_size() + sizer->size(value), tstamp,
+        key, key_size + sizer->size(value), tstamp,
         true,
         &location_to_write_data);
     rassert(should_write);
 
     /* Now copy the data into the node itself */
 
-    memcpy(location_to_write_data, key, key->full_size());
-    location_to_write_data += key->full_size();
+    location_to_write_data = write_encoded_key(node, key, location_to_write_data);
     memcpy(location_to_write_data, value, sizer->size(value));
 
-    node->live_size += sizeof(uint16_t) + key->full_size() + sizer->size(value);
+    node->live_size += sizeof(uint16_t) + key_size + sizer->size(value);
 
     validate(sizer, node);
 }
@@ -1409,7 +1911,7 @@ void remove(value_sizer_t<void> *sizer, leaf_node_t *node, const btree_key_t *ke
     /* Confirm that the key is already in the node */
     DEBUG_VAR int index;
     rassert(find_key(node, key, &index), "remove() called on key that's not in node");
-    rassert(entry_is_live(get_entry(node, node->pair_offsets[index])), "remove() called on key with dead entry");
+    rassert(entry_is_live(get_entry(node, get_pair_offsets(node)[index])), "remove() called on key with dead entry");
 
     /* If the deletion entry would fall after `tstamp_cutpoint`, then it
     shouldn't be written at all. If that's the case, then
@@ -1419,13 +1921,13 @@ void remove(value_sizer_t<void> *sizer, leaf_node_t *node, const btree_key_t *ke
     char *location_to_write_data;
     if (prepare_space_for_new_entry(sizer, node,
             key,
-            1 + key->full_size(),   /* 1 for `DELETE_ENTRY_CODE` */
+            1 + encoded_key_size(node, key),   /* 1 for `DELETE_ENTRY_CODE` */
             tstamp,
             false,
             &location_to_write_data)) {
         *location_to_write_data = static_cast<char>(DELETE_ENTRY_CODE);
         ++location_to_write_data;
-        memcpy(location_to_write_data, key, key->full_size());
+        write_encoded_key(node, key, location_to_write_data);
     }
 
     validate(sizer, node);
@@ -1440,17 +1942,17 @@ void erase_presence(value_sizer_t<void> *sizer, leaf_node_t *node, const btree_k
 
     rassert(found);
     if (found) {
-        int offset = node->pair_offsets[index];
+        int offset = get_pair_offsets(node)[index];
         entry_t *ent = get_entry(node, offset);
 
-        int sz = entry_size(sizer, ent);
+        int sz = entry_size(sizer, node, ent);
         if (entry_is_live(ent)) {
             node->live_size -= sizeof(uint16_t) + sz;
         }
 
         clean_entry(ent, sz);
 
-        memmove(node->pair_offsets + index, node->pair_offsets + index + 1, (node->num_pairs - (index + 1)) * sizeof(uint16_t));
+        memmove(get_pair_offsets(node) + index, get_pair_offsets(node) + index + 1, (node->num_pairs - (index + 1)) * sizeof(uint16_t));
         node->num_pairs -= 1;
     }
 
@@ -1507,9 +2009,11 @@ void dump_entries_since_time(value_sizer_t<void> *sizer, const leaf_node_t *node
             const entry_t *ent = get_entry(node, iter.offset);
 
             if (entry_is_live(ent)) {
-                cb->key_value(entry_key(ent), entry_value(ent), tstamp);
+                store_key_t key;
+                cb->key_value(entry_full_key(node, ent, &key), entry_value(node, ent), tstamp);
             } else if (entry_is_deletion(ent) && include_deletions) {
-                cb->deletion(entry_key(ent), tstamp);
+                store_key_t key;
+                cb->deletion(entry_full_key(node, ent, &key), tstamp);
             }
 
             iter.step(sizer, node);
@@ -1520,17 +2024,17 @@ void dump_entries_since_time(value_sizer_t<void> *sizer, const leaf_node_t *node
 bool live_iter_t::step(const leaf_node_t *node) {
     do {
         ++index_;
-    } while (index_ < node->num_pairs && !entry_is_live(get_entry(node, node->pair_offsets[index_])));
+    } while (index_ < node->num_pairs && !entry_is_live(get_entry(node, get_pair_offsets(node)[index_])));
 
     return index_ < node->num_pairs;
 }
 
-const btree_key_t *live_iter_t::get_key(const leaf_node_t *node) const {
+const btree_key_t *live_iter_t::get_key(const leaf_node_t *node, store_key_t *buf) const {
     rassert(index_ <= node->num_pairs);
     if (index_ == node->num_pairs) {
         return NULL;
     } else {
-        return entry_key(get_entry(node, node->pair_offsets[index_]));
+        return entry_full_key(node, get_entry(node, get_pair_offsets(node)[index_]), buf);
     }
 }
 
@@ -1542,7 +2046,7 @@ const void *live_iter_t::get_value(const leaf_node_t *node) const {
     if (index_ == node->num_pairs) {
         return NULL;
     } else {
-        return entry_value(get_entry(node, node->pair_offsets[index_]));
+        return entry_value(node, get_entry(node, get_pair_offsets(node)[index_]));
     }
 }
 
@@ -1556,7 +2060,7 @@ const void *live_iter_t::get_value(const leaf_node_t *node) const {
 live_iter_t iter_for_inclusive_lower_bound(const leaf_node_t *node, const btree_key_t *key) {
     int index;
     find_key(node, key, &index);
-    while (index < node->num_pairs && !entry_is_live(get_entry(node, node->pair_offsets[index]))) {
+    while (index < node->num_pairs && !entry_is_live(get_entry(node, get_pair_offsets(node)[index]))) {
         ++index;
     }
     return live_iter_t(index);
@@ -1565,7 +2069,7 @@ live_iter_t iter_for_inclusive_lower_bound(const leaf_node_t *node, const btree_
 // Returns an iterator that starts at the smallest key.
 live_iter_t iter_for_whole_leaf(const leaf_node_t *node) {
     int index = 0;
-    while (index < node->num_pairs && !entry_is_live(get_entry(node, node->pair_offsets[index]))) {
+    while (index < node->num_pairs && !entry_is_live(get_entry(node, get_pair_offsets(node)[index]))) {
         ++index;
     }
     return live_iter_t(index);
@@ -9,6 +9,8 @@
 
 template <class> class value_sizer_t;
 struct btree_key_t;
+struct store_key_t;
+class key_prefix_index_t;
 class repli_timestamp_t;
 
 // TODO: Could key_modification_proof_t not go in this file?
@@ -81,6 +83,14 @@ struct leaf_node_t {
     uint16_t pair_offsets[];
 };
 
+// The magic of a prefix-compressed leaf node holding the same kind
+// of values as leaf nodes with magic `leaf_magic`.  Any leaf node may
+// get converted to its compressed form when it's modified.
+block_magic_t compressed_leaf_magic(block_magic_t leaf_magic);
+
+// Returns true if `magic` is `leaf_magic` or its compressed form.
+bool matches_leaf_magic(block_magic_t magic, block_magic_t leaf_magic);
+
 
 
 
@@ -126,6 +136,15 @@ bool find_key(const leaf_node_t *node, const btree_key_t *key, int *index_out);
 
 bool lookup(value_sizer_t<void> *sizer, const leaf_node_t *node, const btree_key_t *key, void *value_out);
 
+// Builds a key prefix index over the node's entries, for use with the functions below.
+key_prefix_index_t *make_key_prefix_index(const leaf_node_t *node);
+
+// Like the functions above, but they use `prefix_index` (which must have been built
+// from `node`) to narrow down the search.
+bool find_key(const leaf_node_t *node, const key_prefix_index_t *prefix_index, const btree_key_t *key, int *index_out);
+
+bool lookup(value_sizer_t<void> *sizer, const leaf_node_t *node, const key_prefix_index_t *prefix_index, const btree_key_t *key, void *value_out);
+
 void insert(value_sizer_t<void> *sizer, leaf_node_t *node, const btree_key_t *key, const void *value, repli_timestamp_t tstamp, UNUSED key_modification_proof_t km_proof);
 
 void remove(value_sizer_t<void> *sizer, leaf_node_t *node, const btree_key_t *key, repli_timestamp_t tstamp, key_modification_proof_t km_proof);
@@ -158,7 +177,9 @@ void dump_entries_since_time(value_sizer_t<void> *sizer, const leaf_node_t *node
 class live_iter_t {
 public:
     bool step(const leaf_node_t *node);
-    const btree_key_t *get_key(const leaf_node_t *node) const;
+    // Returns the key, which is either stored in the node or, if the
+    // node is prefix-compressed, reconstructed in `*buf`.
+    const btree_key_t *get_key(const leaf_node_t *node, store_key_t *buf) const;
     const void *get_value(const leaf_node_t *node) const;
 
 private:
@@ -3,6 +3,7 @@
 
 #include "btree/leaf_node.hpp"
 #include "btree/internal_node.hpp"
+#include "btree/key_prefix_index.hpp"
 #include "buffer_cache/buffer_cache.hpp"
 
 const block_magic_t btree_superblock_t::expected_magic = { { 's', 'u', 'p', 'e' } };
@@ -20,7 +21,7 @@ void print(const node_t *node) {
 }
 
 bool is_underfull(value_sizer_t<void> *sizer, const node_t *node) {
-    if (node->magic == sizer->btree_leaf_magic()) {
+    if (leaf::matches_leaf_magic(node->magic, sizer->btree_leaf_magic())) {
         return leaf::is_underfull(sizer, reinterpret_cast<const leaf_node_t *>(node));
     } else {
         rassert(is_internal(node));
@@ -29,7 +30,7 @@ bool is_underfull(value_sizer_t<void> *sizer, const node_t *node) {
 }
 
 bool is_mergable(value_sizer_t<void> *sizer, const node_t *node, const node_t *sibling, const internal_node_t *parent) {
-    if (sizer->btree_leaf_magic() == node->magic) {
+    if (leaf::matches_leaf_magic(node->magic, sizer->btree_leaf_magic())) {
         return leaf::is_mergable(sizer, reinterpret_cast<const leaf_node_t *>(node), reinterpret_cast<const leaf_node_t *>(sibling));
     } else {
         rassert(is_internal(node));
@@ -67,7 +68,7 @@ bool level(value_sizer_t<void> *sizer, int nodecmp_node_with_sib, buf_lock_t *no
 
 void validate(DEBUG_VAR value_sizer_t<void> *sizer, DEBUG_VAR const node_t *node) {
 #ifndef NDEBUG
-    if (node->magic == sizer->btree_leaf_magic()) {
+    if (leaf::matches_leaf_magic(node->magic, sizer->btree_leaf_magic())) {
         leaf::validate(sizer, reinterpret_cast<const leaf_node_t *>(node));
     } else if (node->magic == internal_node_t::expected_magic) {
         internal_node::validate(sizer->block_size(), reinterpret_cast<const internal_node_t *>(node));
@@ -77,4 +78,30 @@ void validate(DEBUG_VAR value_sizer_t<void> *sizer, DEBUG_VAR const node_t *node
 #endif
 }
 
+const key_prefix_index_t *get_key_prefix_index(buf_lock_t *buf) {
+    // Key prefix indexes are the only derived data that we attach to btree nodes.
+    const key_prefix_index_t *index = static_cast<key_prefix_index_t *>(buf->get_derived_data());
+    if (index != NULL) {
+        return index;
+    }
+
+    const node_t *node = reinterpret_cast<const node_t *>(buf->get_data_read());
+    if (is_internal(node)) {
+        const internal_node_t *internal = reinterpret_cast<const internal_node_t *>(node);
+        if (internal->npairs - 1 < KEY_PREFIX_INDEX_MIN_KEYS) {
+            return NULL;
+        }
+        buf->set_derived_data(internal_node::make_key_prefix_index(internal));
+    } else {
+        const leaf_node_t *leaf = reinterpret_cast<const leaf_node_t *>(node);
+        if (leaf->num_pairs < KEY_PREFIX_INDEX_MIN_KEYS) {
+            return NULL;
+        }
+        buf->set_derived_data(leaf::make_key_prefix_index(leaf));
+    }
+
+    // This is NULL if the cache didn't keep the index.
+    return static_cast<key_prefix_index_t *>(buf->get_derived_data());
+}
+
 }  // namespace node
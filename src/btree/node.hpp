@@ -17,6 +17,8 @@
 template <class Value>
 class value_sizer_t;
 
+class key_prefix_index_t;
+
 
 // Class to hold common use case.
 template <>
@@ -49,6 +51,13 @@ struct btree_superblock_t {
 
     char metainfo_blob[METAINFO_BLOB_MAXREFLEN];
 
+    // Maps secondary index ids to their superblocks (see
+    // btree/secondary_operations.hpp).  Superblocks from before we had
+    // secondary indexes have zeroes here, which is an empty blob.
+    static const int SINDEX_BLOB_MAXREFLEN = 1500;
+
+    char sindex_blob[SINDEX_BLOB_MAXREFLEN];
+
     static const block_magic_t expected_magic;
 };
 
@@ -106,6 +115,14 @@ bool level(value_sizer_t<void> *sizer, int nodecmp_node_with_sib, buf_lock_t *no
 
 void validate(value_sizer_t<void> *sizer, const node_t *node);
 
+// Returns the key prefix index of the node held by `buf`, building it and attaching it
+// to the cached block if it doesn't have one yet.  Returns NULL if the node is too small
+// to be worth indexing, or if `buf` views an outdated version of the block.  The index
+// is destroyed whenever the cached block is modified, which a copy-on-write writer can
+// do while `buf` is still held, so use it right away and call this again after anything
+// that might block.
+const key_prefix_index_t *get_key_prefix_index(buf_lock_t *buf);
+
 }  // namespace node
 
 inline void keycpy(btree_key_t *dest, const btree_key_t *src) {
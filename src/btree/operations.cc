@@ -8,12 +8,14 @@
 #include "btree/slice.hpp"
 #include "buffer_cache/blob.hpp"
 
-real_superblock_t::real_superblock_t(buf_lock_t *sb_buf) {
+real_superblock_t::real_superblock_t(buf_lock_t *sb_buf) : release_deferred_(false) {
     sb_buf_.swap(*sb_buf);
 }
 
 void real_superblock_t::release() {
-    sb_buf_.release_if_acquired();
+    if (!release_deferred_) {
+        sb_buf_.release_if_acquired();
+    }
 }
 
 block_id_t real_superblock_t::get_root_block_id() const {
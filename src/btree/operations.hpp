@@ -47,6 +47,11 @@ public:
     void release();
     buf_lock_t *get() { return &sb_buf_; }
 
+    /* While release is deferred, `release()` does nothing and the superblock
+    stays locked until release is no longer deferred and `release()` is called
+    again, or until the `real_superblock_t` is destroyed. */
+    void set_release_deferred(bool deferred) { release_deferred_ = deferred; }
+
     block_id_t get_root_block_id() const;
     void set_root_block_id(const block_id_t new_root_block);
 
@@ -58,6 +63,7 @@ public:
 
 private:
     buf_lock_t sb_buf_;
+    bool release_deferred_;
 };
 
 /* This is for nested btrees, where the "superblock" is really more like a super value.
@@ -184,6 +190,23 @@ class fake_key_modification_callback_t : public key_modification_callback_t<Valu
 };
 
 
+/* find_keyvalue_locations_for_read() hands the values it finds to one of these. */
+template <class Value>
+class multi_keyvalue_read_callback_t {
+public:
+    // Called once for each of the keys, in order, while the leaf node that the
+    // key belongs in is still held, so the value's blobs can be read through
+    // the transaction.  `value` is NULL if the key is not in the tree.
+    virtual void on_keyvalue(size_t key_index, const Value *value) = 0;
+
+    multi_keyvalue_read_callback_t() { }
+protected:
+    virtual ~multi_keyvalue_read_callback_t() { }
+private:
+    DISABLE_COPYING(multi_keyvalue_read_callback_t);
+};
+
+
 /* This iterator encapsulates most of the metainfo data layout. Unfortunately,
  * functions set_superblock_metainfo and delete_superblock_metainfo also know a
  * lot about the data layout, so if it's changed, these functions must be
@@ -2,6 +2,7 @@
 #include "btree/operations.hpp"
 
 #include "btree/internal_node.hpp"
+#include "btree/key_prefix_index.hpp"
 #include "btree/leaf_node.hpp"
 #include "btree/node.hpp"
 #include "btree/slice.hpp"
@@ -104,7 +105,13 @@ void find_keyvalue_location_for_read(transaction_t *txn, superblock_t *superbloc
 #endif  // NDEBUG
 
     while (node::is_internal(reinterpret_cast<const node_t *>(buf.get_data_read()))) {
-        node_id = internal_node::lookup(reinterpret_cast<const internal_node_t *>(buf.get_data_read()), key);
+        const internal_node_t *node = reinterpret_cast<const internal_node_t *>(buf.get_data_read());
+        const key_prefix_index_t *prefix_index = node::get_key_prefix_index(&buf);
+        if (prefix_index) {
+            node_id = internal_node::lookup(node, prefix_index, key);
+        } else {
+            node_id = internal_node::lookup(node, key);
+        }
         rassert(node_id != NULL_BLOCK_ID && node_id != SUPERBLOCK_ID);
 
         {
@@ -120,14 +127,112 @@ void find_keyvalue_location_for_read(transaction_t *txn, superblock_t *superbloc
 
     // Got down to the leaf, now probe it.
     const leaf_node_t *leaf = reinterpret_cast<const leaf_node_t *>(buf.get_data_read());
+    const key_prefix_index_t *prefix_index = node::get_key_prefix_index(&buf);
     scoped_malloc_t<Value> value(sizer.max_possible_size());
-    if (leaf::lookup(&sizer, leaf, key, value.get())) {
+    bool found;
+    if (prefix_index) {
+        found = leaf::lookup(&sizer, leaf, prefix_index, key, value.get());
+    } else {
+        found = leaf::lookup(&sizer, leaf, key, value.get());
+    }
+    if (found) {
         keyvalue_location_out->buf.swap(buf);
         keyvalue_location_out->there_originally_was_value = true;
         keyvalue_location_out->value.swap(value);
     }
 }
 
+// Looks up keys[beg], ..., keys[end - 1] in the subtree whose root is held by buf.
+template <class Value>
+void find_keyvalues_in_subtree_for_read(value_sizer_t<Value> *sizer, transaction_t *txn, buf_lock_t *buf, const std::vector<store_key_t> &keys, size_t beg, size_t end, multi_keyvalue_read_callback_t<Value> *cb) {
+#ifndef NDEBUG
+    node::validate(sizer, reinterpret_cast<const node_t *>(buf->get_data_read()));
+#endif  // NDEBUG
+
+    if (node::is_internal(reinterpret_cast<const node_t *>(buf->get_data_read()))) {
+        const internal_node_t *node = reinterpret_cast<const internal_node_t *>(buf->get_data_read());
+
+        size_t i = beg;
+        while (i < end) {
+            // Descending into the last child blocked, so the index may be gone.
+            const key_prefix_index_t *prefix_index = node::get_key_prefix_index(buf);
+            int index;
+            if (prefix_index) {
+                index = internal_node::get_offset_index(node, prefix_index, keys[i].btree_key());
+            } else {
+                index = internal_node::get_offset_index(node, keys[i].btree_key());
+            }
+            const btree_internal_pair *pair = internal_node::get_pair_by_index(node, index);
+
+            // Less than or equal takes the left-hand branch, so the child gets all
+            // the keys up to and including its pair's key.  The last pair's key is
+            // special and stands for infinity.
+            size_t j = i + 1;
+            if (index == node->npairs - 1) {
+                j = end;
+            } else {
+                while (j < end && sized_strcmp(keys[j].contents(), keys[j].size(), pair->key.contents, pair->key.size) <= 0) {
+                    ++j;
+                }
+            }
+
+            rassert(pair->lnode != NULL_BLOCK_ID && pair->lnode != SUPERBLOCK_ID);
+            buf_lock_t child(txn, pair->lnode, rwi_read);
+            child.set_eviction_priority(incr_priority(buf->get_eviction_priority()));
+            find_keyvalues_in_subtree_for_read(sizer, txn, &child, keys, i, j, cb);
+
+            i = j;
+        }
+    } else {
+        const leaf_node_t *leaf = reinterpret_cast<const leaf_node_t *>(buf->get_data_read());
+        scoped_malloc_t<Value> value(sizer->max_possible_size());
+
+        for (size_t i = beg; i < end; ++i) {
+            // `cb` might have blocked.
+            const key_prefix_index_t *prefix_index = node::get_key_prefix_index(buf);
+            bool found;
+            if (prefix_index) {
+                found = leaf::lookup(sizer, leaf, prefix_index, keys[i].btree_key(), value.get());
+            } else {
+                found = leaf::lookup(sizer, leaf, keys[i].btree_key(), value.get());
+            }
+            cb->on_keyvalue(i, found ? value.get() : NULL);
+        }
+    }
+}
+
+/* Looks up several keys at once.  `keys` must be sorted.  Rather than walking
+down from the root once for every key, this descends the tree once, acquiring
+each node that some of the keys lead to exactly once, and hands the values to
+`cb`. */
+template <class Value>
+void find_keyvalue_locations_for_read(transaction_t *txn, superblock_t *superblock, const std::vector<store_key_t> &keys, multi_keyvalue_read_callback_t<Value> *cb, eviction_priority_t root_eviction_priority, btree_stats_t *stats) {
+    for (size_t i = 0; i < keys.size(); ++i) {
+        rassert(i == 0 || keys[i - 1] <= keys[i], "keys must be sorted");
+        stats->pm_keys_read.record();
+    }
+    value_sizer_t<Value> sizer(txn->get_cache()->get_block_size());
+
+    block_id_t node_id = superblock->get_root_block_id();
+    rassert(node_id != SUPERBLOCK_ID);
+
+    if (node_id == NULL_BLOCK_ID || keys.empty()) {
+        // There is no root, so the tree is empty.
+        superblock->release();
+        for (size_t i = 0; i < keys.size(); ++i) {
+            cb->on_keyvalue(i, NULL);
+        }
+        return;
+    }
+
+    buf_lock_t buf(txn, node_id, rwi_read);
+    buf.set_eviction_priority(root_eviction_priority);
+
+    superblock->release();
+
+    find_keyvalues_in_subtree_for_read(&sizer, txn, &buf, keys, 0, keys.size(), cb);
+}
+
 template <class Value>
 void apply_keyvalue_change(transaction_t *txn, keyvalue_location_t<Value> *kv_loc, const btree_key_t *key, repli_timestamp_t tstamp, bool expired, key_modification_callback_t<Value> *km_callback, eviction_priority_t *root_eviction_priority) {
     value_sizer_t<Value> sizer(txn->get_cache()->get_block_size());
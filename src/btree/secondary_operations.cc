@@ -0,0 +1,110 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#include "btree/secondary_operations.hpp"
+
+#include "btree/erase_range.hpp"
+#include "btree/internal_node.hpp"
+#include "btree/leaf_node.hpp"
+#include "buffer_cache/blob.hpp"
+#include "buffer_cache/buffer_cache.hpp"
+#include "containers/archive/buffer_group_stream.hpp"
+#include "containers/archive/vector_stream.hpp"
+
+void get_secondary_indexes(transaction_t *txn, buf_lock_t *superblock, secondary_index_map_t *sindexes_out) {
+    const btree_superblock_t *data = static_cast<const btree_superblock_t *>(superblock->get_data_read());
+
+    // The const cast is okay because we access the data with rwi_read
+    // and don't write to the blob.
+    blob_t blob(const_cast<char *>(data->sindex_blob), btree_superblock_t::SINDEX_BLOB_MAXREFLEN);
+
+    sindexes_out->clear();
+    if (blob.valuesize() == 0) {
+        return;
+    }
+
+    blob_acq_t acq;
+    buffer_group_t group;
+    blob.expose_all(txn, rwi_read, &group, &acq);
+
+    buffer_group_read_stream_t read_stream(const_view(&group));
+    int res = deserialize(&read_stream, sindexes_out);
+    guarantee_err(res == 0, "corrupted secondary index map in the superblock");
+}
+
+void set_secondary_indexes(transaction_t *txn, buf_lock_t *superblock, const secondary_index_map_t &sindexes) {
+    btree_superblock_t *data = static_cast<btree_superblock_t *>(superblock->get_data_major_write());
+
+    blob_t blob(data->sindex_blob, btree_superblock_t::SINDEX_BLOB_MAXREFLEN);
+    blob.clear(txn);
+
+    write_message_t msg;
+    msg << sindexes;
+    vector_stream_t stream;
+    DEBUG_VAR int res = send_write_message(&stream, &msg);
+    rassert(!res);
+
+    blob.append_region(txn, stream.vector().size());
+
+    blob_acq_t acq;
+    buffer_group_t write_group;
+    blob.expose_all(txn, rwi_write, &write_group, &acq);
+
+    buffer_group_t group_cpy;
+    group_cpy.add_buffer(stream.vector().size(), stream.vector().data());
+
+    buffer_group_copy_data(&write_group, const_view(&group_cpy));
+}
+
+block_id_t create_secondary_index_superblock(transaction_t *txn) {
+    buf_lock_t sb_buf(txn);
+
+    btree_superblock_t *sb = reinterpret_cast<btree_superblock_t *>(sb_buf.get_data_major_write());
+    bzero(sb, txn->get_cache()->get_block_size().value());
+
+    // The blobs have been properly zeroed.
+
+    sb->magic = btree_superblock_t::expected_magic;
+    sb->root_block = NULL_BLOCK_ID;
+    sb->stat_block = NULL_BLOCK_ID;
+
+    return sb_buf.get_block_id();
+}
+
+void delete_subtree(transaction_t *txn, value_sizer_t<void> *sizer, value_deleter_t *deleter, block_id_t block_id) {
+    buf_lock_t node_buf(txn, block_id, rwi_write);
+    const node_t *node = static_cast<const node_t *>(node_buf.get_data_read());
+
+    if (node::is_internal(node)) {
+        const internal_node_t *internal = reinterpret_cast<const internal_node_t *>(node);
+        for (int i = 0; i < internal->npairs; ++i) {
+            delete_subtree(txn, sizer, deleter, internal_node::get_pair_by_index(internal, i)->lnode);
+        }
+    } else {
+        // The deleter writes to the values' blob refs, so we need write access.
+        leaf_node_t *leaf = static_cast<leaf_node_t *>(node_buf.get_data_major_write());
+        for (leaf::live_iter_t iter = leaf::iter_for_whole_leaf(leaf); /* no test */; iter.step(leaf)) {
+            store_key_t key_buf;
+            if (!iter.get_key(leaf, &key_buf)) {
+                break;
+            }
+            deleter->delete_value(txn, const_cast<void *>(iter.get_value(leaf)));
+        }
+    }
+
+    node_buf.mark_deleted();
+}
+
+void delete_secondary_index(transaction_t *txn, value_sizer_t<void> *sizer, value_deleter_t *deleter, block_id_t superblock) {
+    buf_lock_t sb_buf(txn, superblock, rwi_write);
+    const btree_superblock_t *sb = static_cast<const btree_superblock_t *>(sb_buf.get_data_read());
+
+    if (sb->root_block != NULL_BLOCK_ID) {
+        delete_subtree(txn, sizer, deleter, sb->root_block);
+    }
+
+    if (sb->stat_block != NULL_BLOCK_ID) {
+        buf_lock_t stat_buf(txn, sb->stat_block, rwi_write);
+        stat_buf.mark_deleted();
+    }
+
+    sb_buf.mark_deleted();
+}
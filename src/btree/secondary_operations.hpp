@@ -0,0 +1,51 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#ifndef BTREE_SECONDARY_OPERATIONS_HPP_
+#define BTREE_SECONDARY_OPERATIONS_HPP_
+
+#include <map>
+#include <string>
+
+#include "btree/node.hpp"
+#include "buffer_cache/types.hpp"
+#include "containers/archive/stl_types.hpp"
+#include "rpc/serialize_macros.hpp"
+
+class value_deleter_t;
+
+/* A secondary index is a btree of its own that lives in the same cache as the
+primary btree. It has its own superblock, in the `btree_superblock_t` format, so
+`real_superblock_t` and all of the usual btree operations work on it, and the
+primary btree's superblock maps the index ids to those superblocks in its
+`sindex_blob`. What goes in an index, and what its id means, is entirely up to
+the protocol. */
+
+struct secondary_index_t {
+    secondary_index_t() : superblock(NULL_BLOCK_ID), ready(false) { }
+
+    /* The index's superblock. */
+    block_id_t superblock;
+
+    /* Whether the index has been filled in from the rows that were already
+    there when it was created. Writes keep an index up to date from the moment
+    it's created, but the filling in happens afterwards, a chunk at a time, so
+    that it doesn't hold up everything else. */
+    bool ready;
+
+    RDB_MAKE_ME_SERIALIZABLE_2(superblock, ready);
+};
+
+typedef std::map<std::string, secondary_index_t> secondary_index_map_t;
+
+/* `superblock` is the primary btree's superblock. */
+void get_secondary_indexes(transaction_t *txn, buf_lock_t *superblock, secondary_index_map_t *sindexes_out);
+
+void set_secondary_indexes(transaction_t *txn, buf_lock_t *superblock, const secondary_index_map_t &sindexes);
+
+/* Allocates the superblock of a new, empty index. */
+block_id_t create_secondary_index_superblock(transaction_t *txn);
+
+/* Frees every block of an index, superblock included, after calling `deleter`
+on each of its values. */
+void delete_secondary_index(transaction_t *txn, value_sizer_t<void> *sizer, value_deleter_t *deleter, block_id_t superblock);
+
+#endif  // BTREE_SECONDARY_OPERATIONS_HPP_
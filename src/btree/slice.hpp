@@ -20,10 +20,14 @@ public:
           pm_keys_read(secs_to_ticks(1)),
           pm_keys_set(secs_to_ticks(1)),
           pm_keys_expired(secs_to_ticks(1)),
+          pm_keys_reclaimed(),
+          pm_bytes_reclaimed(),
           pm_keys_membership(&btree_collection,
               &pm_keys_read, "keys_read",
               &pm_keys_set, "keys_set",
               &pm_keys_expired, "keys_expired",
+              &pm_keys_reclaimed, "keys_reclaimed",
+              &pm_bytes_reclaimed, "bytes_reclaimed",
               NULLPTR)
     { }
 
@@ -33,6 +37,10 @@ public:
         pm_keys_read,
         pm_keys_set,
         pm_keys_expired;
+    // Expired keys deleted by a background sweep, and their key and value bytes.
+    perfmon_counter_t
+        pm_keys_reclaimed,
+        pm_bytes_reclaimed;
     perfmon_multi_membership_t pm_keys_membership;
 };
 
@@ -49,5 +49,44 @@ private:
     DISABLE_COPYING(refcount_superblock_t);
 };
 
+/* Passes everything through to `sub_superblock` but never releases it, so that
+the superblock stays locked across several btree operations. Whoever owns
+`sub_superblock` releases it once they're all done. */
+class unreleasing_superblock_t : public superblock_t {
+public:
+    explicit unreleasing_superblock_t(superblock_t *sb) : sub_superblock(sb) { }
+
+    void release() { }
+
+    block_id_t get_root_block_id() const {
+        return sub_superblock->get_root_block_id();
+    }
+
+    void set_root_block_id(const block_id_t new_root_block) {
+        sub_superblock->set_root_block_id(new_root_block);
+    }
+
+    block_id_t get_stat_block_id() const {
+        return sub_superblock->get_stat_block_id();
+    }
+
+    void set_stat_block_id(block_id_t new_stat_block) {
+        sub_superblock->set_stat_block_id(new_stat_block);
+    }
+
+    void set_eviction_priority(eviction_priority_t eviction_priority) {
+        sub_superblock->set_eviction_priority(eviction_priority);
+    }
+
+    eviction_priority_t get_eviction_priority() {
+        return sub_superblock->get_eviction_priority();
+    }
+
+private:
+    superblock_t *sub_superblock;
+
+    DISABLE_COPYING(unreleasing_superblock_t);
+};
+
 
 #endif  // BTREE_SUPERBLOCK_HPP_
@@ -193,6 +193,15 @@ int64_t ref_value_offset(const char *ref, int maxreflen) {
     return is_small(ref, maxreflen) ? 0 : big_offset(ref, maxreflen);
 }
 
+bool inline_value(const char *ref, int maxreflen, const char **data_out, int64_t *size_out) {
+    if (!is_small(ref, maxreflen)) {
+        return false;
+    }
+    *data_out = ref + big_size_offset(maxreflen);
+    *size_out = small_size(ref, maxreflen);
+    return true;
+}
+
 int64_t stepsize(block_size_t block_size, int levels) {
     rassert(levels > 0);
     int64_t step = leaf_size(block_size);
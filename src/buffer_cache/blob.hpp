@@ -123,6 +123,11 @@ const char *leaf_node_data(const void *buf);
 
 // Returns the internal offset of the ref value, which is especially useful when it's not inlined.
 int64_t ref_value_offset(const char *ref, int maxreflen);
+
+// If the value is small enough to be stored in the ref itself, points
+// *data_out at it, sets *size_out, and returns true.  Such a value can
+// be read without acquiring any blocks.
+bool inline_value(const char *ref, int maxreflen, const char **data_out, int64_t *size_out);
 extern block_magic_t internal_node_magic;
 extern block_magic_t leaf_node_magic;
 
@@ -8,6 +8,17 @@
 
 #define NEVER_FLUSH -1
 
+/* Which page replacement algorithm the cache uses to choose bufs to evict (see
+buffer_cache/mirrored/page_repl.hpp). */
+enum page_repl_policy_t {
+    // Evict a random evictable buf. Cheap, but one big scan flushes the working set.
+    page_repl_policy_random,
+    // Scan-resistant 2Q with a CLOCK-managed protected queue.
+    page_repl_policy_2q
+};
+
+ARCHIVE_PRIM_MAKE_RANGED_SERIALIZABLE(page_repl_policy_t, int8_t, page_repl_policy_random, page_repl_policy_2q);
+
 /* Configuration for the cache (it can all change from run to run) */
 
 struct mirrored_cache_config_t {
@@ -22,6 +33,7 @@ struct mirrored_cache_config_t {
         max_concurrent_flushes = DEFAULT_MAX_CONCURRENT_FLUSHES;
         io_priority_reads = CACHE_READS_IO_PRIORITY;
         io_priority_writes = CACHE_WRITES_IO_PRIORITY;
+        page_repl_policy = page_repl_policy_random;
     }
 
     // Max amount of memory that will be used for the cache, in bytes.
@@ -60,6 +72,9 @@ struct mirrored_cache_config_t {
     int io_priority_reads;
     int io_priority_writes;
 
+    // The page replacement algorithm to use.
+    page_repl_policy_t page_repl_policy;
+
     void rdb_serialize(write_message_t &msg /* NOLINT */) const {
         msg << max_size;
         msg << wait_for_flush;
@@ -70,6 +85,7 @@ struct mirrored_cache_config_t {
         msg << max_concurrent_flushes;
         msg << io_priority_reads;
         msg << io_priority_writes;
+        msg << page_repl_policy;
     }
 
     archive_result_t rdb_deserialize(read_stream_t *s) {
@@ -91,6 +107,8 @@ struct mirrored_cache_config_t {
         res = deserialize(s, &io_priority_reads);
         if (res) { return res; }
         res = deserialize(s, &io_priority_writes);
+        if (res) { return res; }
+        res = deserialize(s, &page_repl_policy);
         return res;
     }
 };
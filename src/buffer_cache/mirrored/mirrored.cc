@@ -206,7 +206,7 @@ mc_inner_buf_t::mc_inner_buf_t(mc_cache_t *_cache, block_id_t _block_id, file_ac
     ++_cache->stats->pm_n_blocks_in_memory;
     refcount++; // Make the refcount nonzero so this block won't be considered safe to unload.
 
-    _cache->page_repl.make_space();
+    _cache->page_repl->make_space();
     _cache->maybe_unregister_read_ahead_callback();
 
     refcount--;
@@ -234,7 +234,7 @@ mc_inner_buf_t::mc_inner_buf_t(mc_cache_t *_cache, block_id_t _block_id, void *_
 
     ++_cache->stats->pm_n_blocks_in_memory;
     refcount++; // Make the refcount nonzero so this block won't be considered safe to unload.
-    _cache->page_repl.make_space();
+    _cache->page_repl->make_space();
     _cache->maybe_unregister_read_ahead_callback();
     refcount--;
 
@@ -316,7 +316,7 @@ mc_inner_buf_t::mc_inner_buf_t(mc_cache_t *_cache, block_id_t _block_id, version
     ++_cache->stats->pm_n_blocks_in_memory;
     ++refcount; // Make the refcount nonzero so this block won't be considered safe to unload.
 
-    _cache->page_repl.make_space();
+    _cache->page_repl->make_space();
     _cache->maybe_unregister_read_ahead_callback();
 
     --refcount;
@@ -530,6 +530,9 @@ mc_buf_lock_t::mc_buf_lock_t(mc_transaction_t *transaction,
         // scattered around everywhere (eg: here). consolidate it, perhaps in mc_buf_lock_t.
         rassert(!inner_buf->do_delete || snapshotted);
 
+        // Let the page replacement policy know this buf is being reused.
+        inner_buf->touch_in_page_repl();
+
         // ensures we're using the top version
         if (!inner_buf->data.has() && !inner_buf->do_delete &&
             // if we're accessing a snapshot rather than the top version, no need to load it here
@@ -818,6 +821,24 @@ void mc_buf_lock_t::set_eviction_priority(eviction_priority_t val) {
     inner_buf->eviction_priority = val;
 }
 
+buf_derived_data_t *mc_buf_lock_t::get_derived_data() const {
+    assert_thread();
+    if (!inner_buf->data.equals(data)) {
+        // We are looking at a snapshot or at a copy-on-write version of the block.
+        return NULL;
+    }
+    return inner_buf->derived_data.get();
+}
+
+void mc_buf_lock_t::set_derived_data(buf_derived_data_t *derived_data) {
+    assert_thread();
+    scoped_ptr_t<buf_derived_data_t> holder(derived_data);
+    if (inner_buf->data.equals(data)) {
+        inner_buf->derived_data.reset();
+        inner_buf->derived_data.init(holder.release());
+    }
+}
+
 void mc_buf_lock_t::apply_patch(buf_patch_t *_patch) {
     assert_thread();
     rassert(!inner_buf->safe_to_unload()); // If this assertion fails, it probably means that you're trying to access a buf you don't own.
@@ -831,6 +852,7 @@ void mc_buf_lock_t::apply_patch(buf_patch_t *_patch) {
     scoped_ptr_t<buf_patch_t> patch(_patch);
 
     patch->apply_to_buf(reinterpret_cast<char *>(data), inner_buf->cache->get_block_size());
+    inner_buf->derived_data.reset();
     inner_buf->writeback_buf().set_dirty();
     // Invalidate the token
     inner_buf->data_token.reset();
@@ -872,6 +894,8 @@ void *mc_buf_lock_t::get_data_major_write() {
 
     // Invalidate the token
     inner_buf->data_token.reset();
+    // The caller is about to change the block behind our back.
+    inner_buf->derived_data.reset();
     ensure_flush();
 
     return data;
@@ -913,6 +937,7 @@ void mc_buf_lock_t::mark_deleted() {
 
     rassert(!inner_buf->data.has());
     data = NULL;
+    inner_buf->derived_data.reset();
 
     inner_buf->do_delete = true;
     ensure_flush(); // Disable patch log system for the buffer
@@ -1186,6 +1211,7 @@ mc_transaction_t::~mc_transaction_t() {
         }
 
         cache->on_transaction_commit(this);
+        coro_wait_reason_tag_t wait_reason(coro_wait_reason_disk);
         sync_callback.wait();
 
     } else {
@@ -1301,10 +1327,6 @@ mc_cache_t::mc_cache_t(serializer_t *_serializer,
     dynamic_config(*_dynamic_config),
     serializer(_serializer),
     stats(new mc_cache_stats_t(perfmon_parent)),
-    page_repl(
-        // Launch page replacement if the user-specified maximum number of blocks is reached
-        dynamic_config.max_size / _serializer->get_block_size().ser_value(),
-        this),
     writeback(
         this,
         dynamic_config.wait_for_flush,
@@ -1323,6 +1345,12 @@ mc_cache_t::mc_cache_t(serializer_t *_serializer,
     read_ahead_registered(false),
     next_snapshot_version(mc_inner_buf_t::faux_version_id+1) {
 
+    make_page_repl(dynamic_config.page_repl_policy,
+                   // Launch page replacement if the user-specified maximum number of blocks is reached
+                   dynamic_config.max_size / _serializer->get_block_size().ser_value(),
+                   this,
+                   &page_repl);
+
     {
         on_thread_t thread_switcher(serializer->home_thread());
         reads_io_account.init(serializer->make_io_account(dynamic_config.io_priority_reads));
@@ -1397,7 +1425,7 @@ mc_cache_t::~mc_cache_t() {
     patch_disk_storage.reset();
 
     /* Delete all the buffers */
-    while (evictable_t *buf = page_repl.get_first_buf()) {
+    while (evictable_t *buf = page_repl->get_first_buf()) {
         // TODO(rntz) check that buf is actually a mc_inner_buf_t
         delete buf;
     }
@@ -1542,7 +1570,7 @@ bool mc_cache_t::can_read_ahead_block_be_accepted(block_id_t block_id) {
 
 void mc_cache_t::maybe_unregister_read_ahead_callback() {
     // Unregister when 90 % of the cache are filled up.
-    if (read_ahead_registered && page_repl.is_full(dynamic_config.max_size / serializer->get_block_size().ser_value() / 10 + 1)) {
+    if (read_ahead_registered && page_repl->is_full(dynamic_config.max_size / serializer->get_block_size().ser_value() / 10 + 1)) {
         read_ahead_registered = false;
         // unregister_read_ahead_cb requires a coro context, but we might not be in any
         coro_t::spawn_now_dangerously(boost::bind(&serializer_t::unregister_read_ahead_cb, serializer, this));
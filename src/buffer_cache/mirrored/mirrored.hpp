@@ -27,8 +27,7 @@
 
 #include "buffer_cache/mirrored/writeback.hpp"
 
-#include "buffer_cache/mirrored/page_repl_random.hpp"
-typedef page_repl_random_t page_repl_t;
+#include "buffer_cache/mirrored/page_repl.hpp"
 
 #include "buffer_cache/mirrored/free_list.hpp"
 
@@ -48,6 +47,7 @@ class mc_inner_buf_t : public evictable_t,
     friend class writeback_t;
     friend class writeback_t::local_buf_t;
     friend class page_repl_random_t;
+    friend class page_repl_2q_t;
     friend class array_map_t;
     friend class patch_disk_storage_t;
 
@@ -141,6 +141,10 @@ private:
     // snapshot types' implementations are internal and deferred to mirrored.cc
     intrusive_list_t<buf_snapshot_t> snapshots;
 
+    // Derived data computed from the current version of `data`, or empty.  This
+    // is reset whenever `data` gets modified.
+    scoped_ptr_t<buf_derived_data_t> derived_data;
+
     DISABLE_COPYING(mc_inner_buf_t);
 };
 
@@ -200,6 +204,15 @@ public:
     repli_timestamp_t get_recency() const;
     void touch_recency(repli_timestamp_t timestamp);
 
+    // Returns the data attached to the block with `set_derived_data()`, or NULL
+    // if there is none or if this lock doesn't view the current version of the
+    // block.
+    buf_derived_data_t *get_derived_data() const;
+    // Attaches data computed from `get_data_read()` to the cached block and takes
+    // ownership of it.  If this lock views an outdated version of the block, the
+    // data is destroyed right away instead.
+    void set_derived_data(buf_derived_data_t *derived_data);
+
 private:
     friend class mc_cache_t;
     friend class mc_transaction_t;
@@ -320,6 +333,7 @@ class mc_cache_t : public home_thread_mixin_t, public serializer_read_ahead_call
     friend class writeback_t;
     friend class writeback_t::local_buf_t;
     friend class page_repl_random_t;
+    friend class page_repl_2q_t;
     friend class evictable_t;
     friend class array_map_t;
     friend class patch_disk_storage_t;
@@ -400,7 +414,7 @@ private:
     scoped_ptr_t<file_account_t> writes_io_account;
 
     array_map_t page_map;
-    page_repl_t page_repl;
+    scoped_ptr_t<page_repl_t> page_repl;
     writeback_t writeback;
     array_free_list_t free_list;
 
@@ -0,0 +1,64 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#include "buffer_cache/mirrored/page_repl.hpp"
+
+#include "buffer_cache/mirrored/mirrored.hpp"
+#include "buffer_cache/mirrored/page_repl_2q.hpp"
+#include "buffer_cache/mirrored/page_repl_random.hpp"
+
+evictable_t::evictable_t(mc_cache_t *_cache, bool loaded)
+    : eviction_priority(DEFAULT_EVICTION_PRIORITY), cache(_cache), in_page_repl_(false),
+      page_repl_index(static_cast<unsigned int>(-1)), page_repl_queue(0), page_repl_referenced(false)
+{
+    cache->assert_thread();
+    if (loaded) {
+        insert_into_page_repl();
+    }
+}
+
+evictable_t::~evictable_t() {
+    cache->assert_thread();
+
+    // It's the subclass destructor's responsibility to run
+    //
+    //     if (in_page_repl()) { remove_from_page_repl(); }
+    rassert(!in_page_repl());
+}
+
+bool evictable_t::in_page_repl() {
+    return in_page_repl_;
+}
+
+void evictable_t::insert_into_page_repl() {
+    cache->assert_thread();
+    rassert(!in_page_repl_);
+    cache->page_repl->insert(this);
+    in_page_repl_ = true;
+}
+
+void evictable_t::remove_from_page_repl() {
+    cache->assert_thread();
+    rassert(in_page_repl_);
+    cache->page_repl->remove(this);
+    in_page_repl_ = false;
+}
+
+void evictable_t::touch_in_page_repl() {
+    cache->assert_thread();
+    if (in_page_repl_) {
+        cache->page_repl->touch(this);
+    }
+}
+
+void make_page_repl(page_repl_policy_t policy, unsigned int unload_threshold, mc_cache_t *cache,
+                    scoped_ptr_t<page_repl_t> *out) {
+    switch (policy) {
+    case page_repl_policy_random:
+        out->init(new page_repl_random_t(unload_threshold, cache));
+        break;
+    case page_repl_policy_2q:
+        out->init(new page_repl_2q_t(unload_threshold, cache));
+        break;
+    default:
+        unreachable();
+    }
+}
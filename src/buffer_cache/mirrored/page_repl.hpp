@@ -0,0 +1,104 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#ifndef BUFFER_CACHE_MIRRORED_PAGE_REPL_HPP_
+#define BUFFER_CACHE_MIRRORED_PAGE_REPL_HPP_
+
+#include "buffer_cache/mirrored/config.hpp"
+#include "buffer_cache/types.hpp"
+#include "containers/intrusive_list.hpp"
+#include "containers/scoped.hpp"
+
+// TODO: We should use mlock (or mlockall or related) to make sure the
+// OS doesn't swap out our pages, since we're doing swapping
+// ourselves.
+
+/*
+The page replacement component is pluggable: mc_cache_t owns a page_repl_t, and which
+implementation it gets is chosen by mirrored_cache_config_t::page_repl_policy (see
+make_page_repl()). Every implementation must keep insertion, removal, access notification and
+victim selection O(1) (amortized), since all of them run on the cache's hot path.
+
+An evictable_t carries the bookkeeping state for every policy (an array index for
+page_repl_random_t, list hooks and a reference bit for page_repl_2q_t). That costs a few bytes
+per buf, but it means a buf never has to be allocated differently depending on the policy.
+*/
+
+class mc_cache_t;
+class page_repl_t;
+
+class evictable_t : public intrusive_list_node_t<evictable_t> {
+public:
+    explicit evictable_t(mc_cache_t *cache, bool loaded = true);
+    virtual ~evictable_t();    // removes us from the page repl if necessary; does not call unload()
+
+    // Returns true if this object can be unloaded from the cache.
+    virtual bool safe_to_unload() = 0;
+    // Called when the page_repl_t decides to evict this object. Must relinquish the buf
+    // associated with this object.
+    virtual void unload() = 0;
+
+    bool in_page_repl();
+    void insert_into_page_repl();
+    void remove_from_page_repl(); // does *not* call unload()
+
+    // Tells the page replacement policy that this object was just used again.
+    void touch_in_page_repl();
+
+    /* The eviction priority represents how bad of a choice a buf is for
+     * eviction the buffer cache will (probabalistically) evict blocks of
+     * lower priority first. */
+    eviction_priority_t eviction_priority;
+
+protected:
+    mc_cache_t *cache;
+private:
+    friend class page_repl_random_t;
+    friend class page_repl_2q_t;
+
+    bool in_page_repl_;
+
+    // Used by page_repl_random_t: our position in its dense array.
+    unsigned int page_repl_index;
+
+    // Used by page_repl_2q_t: which of its queues we are in, and whether we have been touched
+    // since we were last looked at by the clock hand.
+    uint8_t page_repl_queue;
+    bool page_repl_referenced;
+};
+
+class page_repl_t {
+public:
+    virtual ~page_repl_t() { }
+
+    // If is_full(space_needed), the next call to make_space(space_needed) probably has to evict something
+    virtual bool is_full(unsigned int space_needed) = 0;
+
+    // make_space tries to make sure that the number of blocks currently in memory is at least
+    // 'space_needed' less than the user-specified memory limit.
+    virtual void make_space(unsigned int space_needed = 0) = 0;
+
+    /* The page replacement component actually serves two roles. In addition to its primary role as
+    a mechanism for kicking out buffers when memory runs low, it also has the job of keeping track
+    of all of the buffers in memory in such a way that the cache can quickly request a pointer to
+    the next buffer in memory. This is used during the cache's destructor. The rationale is that any
+    reasonable implementation of a page replacement system will need to keep track of all of the
+    buffers in memory anyway, so the cache can depend on the page replacement system's buffer list
+    rather than keeping a buffer list of its own. */
+    virtual evictable_t *get_first_buf() = 0;
+
+    // The number of evictables currently tracked.
+    virtual unsigned int size() = 0;
+
+protected:
+    friend class evictable_t;
+
+    // Called by evictable_t; these never evict anything.
+    virtual void insert(evictable_t *evictable) = 0;
+    virtual void remove(evictable_t *evictable) = 0;
+    virtual void touch(evictable_t *evictable) = 0;
+};
+
+// Constructs the page replacement implementation selected by `policy`.
+void make_page_repl(page_repl_policy_t policy, unsigned int unload_threshold, mc_cache_t *cache,
+                    scoped_ptr_t<page_repl_t> *out);
+
+#endif // BUFFER_CACHE_MIRRORED_PAGE_REPL_HPP_
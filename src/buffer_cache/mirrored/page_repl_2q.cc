@@ -0,0 +1,127 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#include "buffer_cache/mirrored/page_repl_2q.hpp"
+
+#include "buffer_cache/mirrored/mirrored.hpp"
+#include "config/args.hpp"
+#include "perfmon/perfmon.hpp"
+
+page_repl_2q_t::page_repl_2q_t(unsigned int _unload_threshold, cache_t *_cache)
+    : unload_threshold(_unload_threshold),
+      probation_target(static_cast<unsigned int>(_unload_threshold * PAGE_REPL_2Q_PROBATION_FRACTION)),
+      cache(_cache) {
+    if (probation_target == 0) {
+        probation_target = 1;
+    }
+}
+
+page_repl_2q_t::~page_repl_2q_t() {
+    rassert(probation.empty());
+    rassert(protected_bufs.empty());
+}
+
+bool page_repl_2q_t::is_full(unsigned int space_needed) {
+    cache->assert_thread();
+    return size() + space_needed > unload_threshold;
+}
+
+void page_repl_2q_t::make_space(unsigned int space_needed) {
+    cache->assert_thread();
+    unsigned int target;
+    if (space_needed > unload_threshold) {
+        target = unload_threshold;
+    } else {
+        target = unload_threshold - space_needed;
+    }
+
+    while (size() > target) {
+        evictable_t *block_to_unload = choose_victim();
+        if (!block_to_unload) {
+            // Everything we looked at was dirty or in use; try again on the next call.
+            break;
+        }
+
+        // Remove it from the page repl and call its callback. Need to remove it from the repl first
+        // because its callback could delete it.
+        block_to_unload->remove_from_page_repl();
+        block_to_unload->unload();
+        ++cache->stats->pm_n_blocks_evicted;
+    }
+}
+
+evictable_t *page_repl_2q_t::choose_victim() {
+    for (int steps = 0; steps < PAGE_REPL_2Q_MAX_STEPS; ++steps) {
+        if (!probation.empty() && (probation.size() >= probation_target || protected_bufs.empty())) {
+            evictable_t *block = probation.head();
+            probation.remove(block);
+
+            // Bufs that were reused while on probation, and interior btree nodes (which get a
+            // better-than-default eviction priority), are hot: promote them.
+            if (block->page_repl_referenced || block->eviction_priority < DEFAULT_EVICTION_PRIORITY) {
+                block->page_repl_referenced = false;
+                block->page_repl_queue = protected_queue;
+                protected_bufs.push_back(block);
+                continue;
+            }
+
+            probation.push_back(block);
+            if (block->safe_to_unload()) {
+                return block;
+            }
+        } else if (!protected_bufs.empty()) {
+            // Advance the clock hand.
+            evictable_t *block = protected_bufs.head();
+            protected_bufs.remove(block);
+            protected_bufs.push_back(block);
+
+            if (block->page_repl_referenced) {
+                block->page_repl_referenced = false;
+            } else if (block->safe_to_unload()) {
+                return block;
+            }
+        } else {
+            break;
+        }
+    }
+    return NULL;
+}
+
+evictable_t *page_repl_2q_t::get_first_buf() {
+    cache->assert_thread();
+    if (!probation.empty()) {
+        return probation.head();
+    }
+    return protected_bufs.head();
+}
+
+unsigned int page_repl_2q_t::size() {
+    return probation.size() + protected_bufs.size();
+}
+
+void page_repl_2q_t::insert(evictable_t *evictable) {
+    cache->assert_thread();
+    evictable->page_repl_queue = probation_queue;
+    evictable->page_repl_referenced = false;
+    probation.push_back(evictable);
+}
+
+void page_repl_2q_t::remove(evictable_t *evictable) {
+    cache->assert_thread();
+    queue_of(evictable)->remove(evictable);
+    evictable->page_repl_queue = 0;
+    evictable->page_repl_referenced = false;
+}
+
+void page_repl_2q_t::touch(evictable_t *evictable) {
+    evictable->page_repl_referenced = true;
+}
+
+intrusive_list_t<evictable_t> *page_repl_2q_t::queue_of(evictable_t *evictable) {
+    switch (evictable->page_repl_queue) {
+    case probation_queue:
+        return &probation;
+    case protected_queue:
+        return &protected_bufs;
+    default:
+        unreachable("evictable_t is not in a page_repl_2q_t queue");
+    }
+}
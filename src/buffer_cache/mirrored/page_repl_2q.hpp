@@ -0,0 +1,65 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#ifndef BUFFER_CACHE_MIRRORED_PAGE_REPL_2Q_HPP_
+#define BUFFER_CACHE_MIRRORED_PAGE_REPL_2Q_HPP_
+
+#include "buffer_cache/mirrored/page_repl.hpp"
+#include "containers/intrusive_list.hpp"
+
+/*
+A scan-resistant variant of the 2Q page replacement algorithm.
+
+Bufs enter the cache on a probationary FIFO queue. A buf that is touched again while it is on
+probation gets promoted to the protected queue when it reaches the front of the probationary
+queue; a buf that was never touched again is evicted from there. As long as the probationary
+queue is larger than PAGE_REPL_2Q_PROBATION_FRACTION of the cache, victims come from it, so a
+large range scan or backfill (which touches each block once) only churns the probationary queue
+and leaves the hot working set in the protected queue alone.
+
+The protected queue is managed with the CLOCK algorithm: the list head is the clock hand, a
+touched buf gets its reference bit cleared and is moved to the tail, and the first untouched buf
+that is safe to unload is evicted.
+
+Unlike textbook 2Q we keep no ghost queue of recently evicted block ids; a buf has to prove itself
+by being reused while it is still in memory. Touching is a single store, and choosing a victim
+looks at no more than PAGE_REPL_2Q_MAX_STEPS bufs, so every operation is O(1).
+*/
+
+class page_repl_2q_t : public page_repl_t {
+    typedef mc_cache_t cache_t;
+
+public:
+    page_repl_2q_t(unsigned int _unload_threshold, cache_t *_cache);
+    ~page_repl_2q_t();
+
+    bool is_full(unsigned int space_needed);
+
+    void make_space(unsigned int space_needed = 0);
+
+    evictable_t *get_first_buf();
+
+    unsigned int size();
+
+private:
+    enum queue_t { probation_queue = 1, protected_queue = 2 };
+
+    void insert(evictable_t *evictable);
+    void remove(evictable_t *evictable);
+    void touch(evictable_t *evictable);
+
+    // Returns a buf that is safe to unload, or NULL if none was found within
+    // PAGE_REPL_2Q_MAX_STEPS steps.
+    evictable_t *choose_victim();
+
+    intrusive_list_t<evictable_t> *queue_of(evictable_t *evictable);
+
+    unsigned int unload_threshold;
+    unsigned int probation_target;
+    cache_t *cache;
+
+    intrusive_list_t<evictable_t> probation;
+    intrusive_list_t<evictable_t> protected_bufs;
+
+    DISABLE_COPYING(page_repl_2q_t);
+};
+
+#endif // BUFFER_CACHE_MIRRORED_PAGE_REPL_2Q_HPP_
@@ -5,47 +5,29 @@
 #include "logger.hpp"
 #include "perfmon/perfmon.hpp"
 
-evictable_t::evictable_t(mc_cache_t *_cache, bool loaded)
-    : eviction_priority(DEFAULT_EVICTION_PRIORITY), cache(_cache), page_repl_index(static_cast<unsigned int>(-1))
-{
+void page_repl_random_t::insert(evictable_t *evictable) {
     cache->assert_thread();
-    if (loaded) {
-        insert_into_page_repl();
-    }
-}
-
-evictable_t::~evictable_t() {
-    cache->assert_thread();
-
-    // It's the subclass destructor's responsibility to run
-    //
-    //     if (in_page_repl()) { remove_from_page_repl(); }
-    rassert(!in_page_repl());
-}
-
-bool evictable_t::in_page_repl() {
-    return page_repl_index != (unsigned) -1;
+    evictable->page_repl_index = array.size();
+    array.set(evictable->page_repl_index, evictable);
 }
 
-void evictable_t::insert_into_page_repl() {
+void page_repl_random_t::remove(evictable_t *evictable) {
     cache->assert_thread();
-    page_repl_index = cache->page_repl.array.size();
-    cache->page_repl.array.set(page_repl_index, this);
-}
-
-void evictable_t::remove_from_page_repl() {
-    cache->assert_thread();
-    unsigned int last_index = cache->page_repl.array.size() - 1;
+    unsigned int last_index = array.size() - 1;
 
-    if (page_repl_index == last_index) {
-        cache->page_repl.array.set(page_repl_index, NULL);
+    if (evictable->page_repl_index == last_index) {
+        array.set(evictable->page_repl_index, NULL);
     } else {
-        evictable_t *replacement = cache->page_repl.array.get(last_index);
-        replacement->page_repl_index = page_repl_index;
-        cache->page_repl.array.set(page_repl_index, replacement);
-        cache->page_repl.array.set(last_index, NULL);
+        evictable_t *replacement = array.get(last_index);
+        replacement->page_repl_index = evictable->page_repl_index;
+        array.set(evictable->page_repl_index, replacement);
+        array.set(last_index, NULL);
     }
-    page_repl_index = static_cast<unsigned int>(-1);
+    evictable->page_repl_index = static_cast<unsigned int>(-1);
+}
+
+void page_repl_random_t::touch(UNUSED evictable_t *evictable) {
+    // Random replacement does not care about recency.
 }
 
 page_repl_random_t::page_repl_random_t(unsigned int _unload_threshold, cache_t *_cache)
@@ -124,3 +106,7 @@ evictable_t *page_repl_random_t::get_first_buf() {
     if (array.size() == 0) return NULL;
     return array.get(0);
 }
+
+unsigned int page_repl_random_t::size() {
+    return array.size();
+}
@@ -53,7 +53,7 @@ struct mc_cache_stats_t {
 
     perfmon_sampler_t pm_patches_size_ratio;
 
-    // used in buffer_cache/mirrored/page_repl_random.cc
+    // used by the page_repl_t implementations in buffer_cache/mirrored/
     perfmon_counter_t pm_n_blocks_evicted;
 
     /* This is for exposing the block size */
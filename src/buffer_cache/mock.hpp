@@ -75,6 +75,15 @@ public:
         // Mock cache does not implement eviction priorities
     }
 
+    buf_derived_data_t *get_derived_data() const {
+        // Mock cache does not keep derived data
+        return NULL;
+    }
+
+    void set_derived_data(buf_derived_data_t *derived_data) {
+        delete derived_data;
+    }
+
 
 private:
     friend class mock_transaction_t;
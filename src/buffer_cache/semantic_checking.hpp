@@ -87,6 +87,14 @@ public:
     void set_eviction_priority(eviction_priority_t val) {
         internal_buf_lock->set_eviction_priority(val);
     }
+
+    buf_derived_data_t *get_derived_data() const {
+        return internal_buf_lock->get_derived_data();
+    }
+
+    void set_derived_data(buf_derived_data_t *derived_data) {
+        internal_buf_lock->set_derived_data(derived_data);
+    }
 };
 
 /* Transaction */
@@ -75,6 +75,15 @@ protected:
     virtual ~get_subtree_recencies_callback_t() { }
 };
 
+/* In-memory data that is computed from the contents of a block, such as a search
+index over a btree node.  A buf lock can attach it to the cached copy of its block, so
+that later readers of the same block don't have to recompute it.  The cache destroys it
+when the block gets modified or evicted; it is never written to disk. */
+class buf_derived_data_t {
+public:
+    virtual ~buf_derived_data_t() { }
+};
+
 template <class T> class scoped_malloc_t;
 
 // HEY: This is kind of fsck-specific, maybe it belongs somewhere else.
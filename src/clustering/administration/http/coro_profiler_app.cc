@@ -0,0 +1,77 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#include "clustering/administration/http/coro_profiler_app.hpp"
+
+#include <algorithm>
+#include <string>
+
+#include "errors.hpp"
+#include <boost/bind.hpp>
+
+#include "arch/runtime/coro_profiler.hpp"
+#include "arch/runtime/runtime.hpp"
+#include "concurrency/pmap.hpp"
+#include "containers/scoped.hpp"
+
+static void get_profile_on_thread(int thread, coro_thread_profile_t *profiles) {
+    on_thread_t thread_switcher(thread);
+    get_coro_thread_profile(&profiles[thread]);
+}
+
+static void append_folded_line(const std::string &stack, ticks_t ticks, std::string *out) {
+    int64_t usecs = ticks / 1000;
+    if (usecs > 0) {
+        *out += strprintf("%s %" PRIi64 "\n", stack.c_str(), usecs);
+    }
+}
+
+static void append_folded_profile(const std::string &stack, const coro_profile_t &profile, std::string *out) {
+    append_folded_line(stack + ";running", profile.running, out);
+    append_folded_line(stack + ";runnable", profile.runnable, out);
+    for (int i = 0; i < coro_wait_reason_count; ++i) {
+        append_folded_line(stack + ";blocked;" + coro_wait_reason_name(static_cast<coro_wait_reason_t>(i)),
+                           profile.blocked_by_reason[i], out);
+    }
+}
+
+static std::string render_folded_stacks() {
+    scoped_array_t<coro_thread_profile_t> profiles(get_num_threads());
+    pmap(get_num_threads(), boost::bind(&get_profile_on_thread, _1, profiles.data()));
+
+    std::string out;
+    for (int thread = 0; thread < get_num_threads(); ++thread) {
+        const std::map<std::string, coro_profile_t> &by_type = profiles[thread].by_type;
+        for (std::map<std::string, coro_profile_t>::const_iterator it = by_type.begin(); it != by_type.end(); ++it) {
+            // ';' separates frames in the folded format, and type names can't
+            // contain newlines anyway.
+            std::string type = it->first;
+            std::replace(type.begin(), type.end(), ';', ',');
+            append_folded_profile(strprintf("thread_%d;", thread) + type, it->second, &out);
+        }
+    }
+    return out;
+}
+
+http_res_t coro_profiler_http_app_t::handle(const http_req_t &req) {
+    std::string resource = req.resource.as_string();
+
+    if (resource == "/" || resource == "") {
+        if (req.method != GET) {
+            return http_res_t(HTTP_METHOD_NOT_ALLOWED);
+        }
+        return http_res_t(HTTP_OK, "text/plain", render_folded_stacks());
+    }
+
+    if (resource != "/enable" && resource != "/disable" && resource != "/reset") {
+        return http_res_t(HTTP_NOT_FOUND);
+    }
+    if (req.method != POST) {
+        return http_res_t(HTTP_METHOD_NOT_ALLOWED);
+    }
+
+    if (resource == "/reset") {
+        reset_coro_profiler();
+    } else {
+        set_coro_profiler_enabled(resource == "/enable");
+    }
+    return http_res_t(HTTP_OK);
+}
@@ -0,0 +1,23 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#ifndef CLUSTERING_ADMINISTRATION_HTTP_CORO_PROFILER_APP_HPP_
+#define CLUSTERING_ADMINISTRATION_HTTP_CORO_PROFILER_APP_HPP_
+
+#include "http/http.hpp"
+
+/* Controls the coroutine profiler (see `arch/runtime/coro_profiler.hpp`) and
+dumps what it recorded on this server.
+
+`GET /` returns one line per (thread, coroutine type, state) in the "folded
+stacks" format that flame graph tools take, weighted by microseconds:
+    thread_3;<coroutine type>;blocked;disk 1234
+`POST /enable`, `POST /disable`, and `POST /reset` do what they say. */
+class coro_profiler_http_app_t : public http_app_t {
+public:
+    coro_profiler_http_app_t() { }
+    http_res_t handle(const http_req_t &);
+
+private:
+    DISABLE_COPYING(coro_profiler_http_app_t);
+};
+
+#endif /* CLUSTERING_ADMINISTRATION_HTTP_CORO_PROFILER_APP_HPP_ */
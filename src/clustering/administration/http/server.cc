@@ -2,6 +2,7 @@
 #include "clustering/administration/http/server.hpp"
 
 #include "clustering/administration/http/cyanide.hpp"
+#include "clustering/administration/http/coro_profiler_app.hpp"
 #include "clustering/administration/http/directory_app.hpp"
 #include "clustering/administration/http/distribution_app.hpp"
 #include "clustering/administration/http/issues_app.hpp"
@@ -196,6 +197,7 @@ administrative_http_server_manager_t::administrative_http_server_manager_t(
     progress_app.init(new progress_app_t(_directory_metadata, mbox_manager));
     distribution_app.init(new distribution_app_t(metadata_field(&cluster_semilattice_metadata_t::memcached_namespaces, _semilattice_metadata), _namespace_repo,
                                                  metadata_field(&cluster_semilattice_metadata_t::rdb_namespaces, _semilattice_metadata), _rdb_namespace_repo));
+    coro_profiler_app.init(new coro_profiler_http_app_t);
 
 #ifndef NDEBUG
     cyanide_app.init(new cyanide_http_app_t);
@@ -211,6 +213,7 @@ administrative_http_server_manager_t::administrative_http_server_manager_t(
     ajax_routes["distribution"] = distribution_app.get();
     ajax_routes["semilattice"] = semilattice_app.get();
     ajax_routes["reql"] = reql_app;
+    ajax_routes["coro_profiler"] = coro_profiler_app.get();
     DEBUG_ONLY_CODE(ajax_routes["cyanide"] = cyanide_app.get());
 
     std::map<std::string, http_json_app_t *> default_views;
@@ -191,9 +191,16 @@ service_address_ports_t get_service_address_ports(const po::variables_map& vm) {
         reql_port += port_offset;
     }
 
-    return service_address_ports_t(
+    service_address_ports_t ports(
         get_local_addresses(vm), cluster_port, cluster_client_port,
         http_admin_is_disabled, http_port, reql_port, port_offset);
+
+    ports.cluster_link_options.compress = vm.count("compress-cluster-traffic") > 0;
+    ports.cluster_link_options.coalesce = vm.count("no-cluster-coalescing") == 0;
+    if (vm.count("compress-cluster-traffic-to") > 0) {
+        ports.compressed_cluster_hosts = vm["compress-cluster-traffic-to"].as<std::vector<std::string> >();
+    }
+    return ports;
 }
 
 void run_rethinkdb_create(const std::string &filepath, const name_string_t &machine_name, const io_backend_t io_backend, bool *result_out) {
@@ -529,21 +536,25 @@ po::options_description get_network_options() {
         DEBUG_ONLY(("client-port", po::value<int>()->default_value(port_defaults::client_port), "port to use when connecting to other nodes (for development)"))
         ("driver-port", po::value<int>()->default_value(port_defaults::reql_port), "port for rethinkdb protocol for client drivers")
         ("join,j", po::value<std::vector<host_and_port_t> >()->composing(), "host:port of a node that we will connect to")
-        ("port-offset,o", po::value<int>()->default_value(port_defaults::port_offset), "all ports used locally will have this value added");
+        ("port-offset,o", po::value<int>()->default_value(port_defaults::port_offset), "all ports used locally will have this value added")
+        ("compress-cluster-traffic", "compress the traffic on all connections to other nodes")
+        ("compress-cluster-traffic-to", po::value<std::vector<std::string> >()->composing(), "host of a node the connection to which should be compressed, e.g. one in another datacenter; may be given more than once")
+        ("no-cluster-coalescing", "write each message to other nodes to the network on its own, even when messages are piling up");
     return desc;
 }
 
 po::options_description get_disk_options() {
     po::options_description desc("Disk I/O options");
     desc.add_options()
-        ("io-backend", po::value<std::string>()->default_value("pool"), "event backend to use: native or pool.");
+        ("io-backend", po::value<std::string>()->default_value("pool"), "event backend to use: native, uring or pool.");
     return desc;
 }
 
 po::options_description get_cpu_options() {
     po::options_description desc("CPU options");
     desc.add_options()
-        ("cores,c", po::value<int>()->default_value(get_cpu_count()), "the number of cores to utilize");
+        ("cores,c", po::value<int>()->default_value(get_cpu_count()), "the number of cores to utilize")
+        ("work-stealing", po::value<bool>()->zero_tokens(), "let idle cores take request parsing and type checking off of busy ones");
     return desc;
 }
 
@@ -665,6 +676,12 @@ MUST_USE bool pull_io_backend_option(const po::variables_map& vm, io_backend_t *
         *out = aio_native;
 #else
         return false;
+#endif
+    } else if (io_backend == "uring") {
+#ifdef URINGSUPPORT
+        *out = aio_uring;
+#else
+        return false;
 #endif
     } else {
         return false;
@@ -848,7 +865,8 @@ int main_rethinkdb_serve(int argc, char *argv[]) {
                                    address_ports,
                                    io_backend,
                                    &result, web_path),
-                       num_workers);
+                       num_workers,
+                       vm.count("work-stealing") > 0);
 
     remove_pid_file(vm);
 
@@ -1144,7 +1162,8 @@ int main_rethinkdb_porcelain(int argc, char *argv[]) {
                                        &result,
                                        web_path,
                                        new_directory),
-                           num_workers);
+                           num_workers,
+                           vm.count("work-stealing") > 0);
 
         remove_pid_file(vm);
 
@@ -203,7 +203,9 @@ bool run_json_import(extproc::spawner_t::info_t *spawner_info,
                                       NULL,
                                       semilattice_manager_cluster.get_root_view(),
                                       &directory_read_manager,
-                                      machine_id);
+                                      machine_id,
+                                      NULL,
+                                      std::string());
 
     namespace_repo_t<rdb_protocol_t> rdb_namespace_repo(&mailbox_manager,
         directory_read_manager.get_root_view()->subview(
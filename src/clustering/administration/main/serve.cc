@@ -78,6 +78,15 @@ bool do_serve(
         logINF("Our machine ID is %s", uuid_to_str(machine_id).c_str());
 #endif
 
+        cluster_link_policy_t cluster_link_policy(address_ports.cluster_link_options);
+        for (size_t i = 0; i < address_ports.compressed_cluster_hosts.size(); ++i) {
+            const std::set<ip_address_t> ips = ip_address_t::from_hostname(address_ports.compressed_cluster_hosts[i]);
+            for (std::set<ip_address_t>::const_iterator it = ips.begin(); it != ips.end(); ++it) {
+                cluster_link_policy.set_options_for_address(*it,
+                    cluster_link_options_t(true, address_ports.cluster_link_options.coalesce));
+            }
+        }
+
         connectivity_cluster_t connectivity_cluster;
         message_multiplexer_t message_multiplexer(&connectivity_cluster);
 
@@ -128,7 +137,8 @@ bool do_serve(
                                                                address_ports.port,
                                                                &message_multiplexer_run,
                                                                address_ports.client_port,
-                                                               &heartbeat_manager);
+                                                               &heartbeat_manager,
+                                                               cluster_link_policy);
 
         const std::string addresses_string = address_ports.get_addresses_string();
         logINF("Listening on addresses (add more using '--bind'): %s.\n", addresses_string.c_str());
@@ -194,7 +204,9 @@ bool do_serve(
                                           NULL,
                                           semilattice_manager_cluster.get_root_view(),
                                           &directory_read_manager,
-                                          machine_id);
+                                          machine_id,
+                                          i_am_a_server ? io_backender : NULL,
+                                          filepath);
 
         namespace_repo_t<rdb_protocol_t> rdb_namespace_repo(&mailbox_manager,
             directory_read_manager.get_root_view()->subview(
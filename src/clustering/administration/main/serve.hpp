@@ -4,11 +4,13 @@
 
 #include <set>
 #include <string>
+#include <vector>
 
 #include "clustering/administration/metadata.hpp"
 #include "clustering/administration/persist.hpp"
 #include "extproc/spawner.hpp"
 #include "arch/address.hpp"
+#include "rpc/connectivity/cluster.hpp"
 
 #define MAX_PORT 65536
 
@@ -60,6 +62,12 @@ struct service_address_ports_t {
     int http_port;
     int reql_port;
     int port_offset;
+
+    /* How we use intracluster connections. The links to the machines in
+    `compressed_cluster_hosts` are compressed whatever `cluster_link_options`
+    says; the host names get looked up in `serve()`. */
+    cluster_link_options_t cluster_link_options;
+    std::vector<std::string> compressed_cluster_hosts;
 };
 
 /* This has been factored out from `command_line.hpp` because it takes a very
@@ -56,8 +56,11 @@ public:
     vclock_t<std::string> primary_key; //TODO this should actually never be changed...
     vclock_t<database_id_t> database;
     vclock_t<int64_t> cache_size;
+    /* The attributes that have secondary indexes. The indexes themselves live
+    in the stores. */
+    vclock_t<std::set<std::string> > sindexes;
 
-    RDB_MAKE_ME_SERIALIZABLE_12(blueprint, primary_datacenter, replica_affinities, ack_expectations, shards, name, port, primary_pinnings, secondary_pinnings, primary_key, database, cache_size);
+    RDB_MAKE_ME_SERIALIZABLE_13(blueprint, primary_datacenter, replica_affinities, ack_expectations, shards, name, port, primary_pinnings, secondary_pinnings, primary_key, database, cache_size, sindexes);
 };
 
 template <class protocol_t>
@@ -84,6 +87,8 @@ void debug_print(append_only_printf_buffer_t *buf, const namespace_semilattice_m
     debug_print(buf, m.primary_key);
     buf->appendf(", database=");
     debug_print(buf, m.database);
+    buf->appendf(", sindexes=");
+    debug_print(buf, m.sindexes);
     buf->appendf("}");
 }
 
@@ -118,14 +123,15 @@ namespace_semilattice_metadata_t<protocol_t> new_namespace(
     ns.secondary_pinnings = make_vclock(secondary_pinnings, machine);
 
     ns.cache_size = make_vclock(cache_size, machine);
+    ns.sindexes = make_vclock(std::set<std::string>(), machine);
     return ns;
 }
 
 template<class protocol_t>
-RDB_MAKE_SEMILATTICE_JOINABLE_12(namespace_semilattice_metadata_t<protocol_t>, blueprint, primary_datacenter, replica_affinities, ack_expectations, shards, name, port, primary_pinnings, secondary_pinnings, primary_key, database, cache_size);
+RDB_MAKE_SEMILATTICE_JOINABLE_13(namespace_semilattice_metadata_t<protocol_t>, blueprint, primary_datacenter, replica_affinities, ack_expectations, shards, name, port, primary_pinnings, secondary_pinnings, primary_key, database, cache_size, sindexes);
 
 template<class protocol_t>
-RDB_MAKE_EQUALITY_COMPARABLE_12(namespace_semilattice_metadata_t<protocol_t>, blueprint, primary_datacenter, replica_affinities, ack_expectations, shards, name, port, primary_pinnings, secondary_pinnings, primary_key, database, cache_size);
+RDB_MAKE_EQUALITY_COMPARABLE_13(namespace_semilattice_metadata_t<protocol_t>, blueprint, primary_datacenter, replica_affinities, ack_expectations, shards, name, port, primary_pinnings, secondary_pinnings, primary_key, database, cache_size, sindexes);
 
 //json adapter concept for namespace_semilattice_metadata_t
 template <class protocol_t>
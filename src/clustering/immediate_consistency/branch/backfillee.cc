@@ -1,6 +1,8 @@
 // Copyright 2010-2012 RethinkDB, all rights reserved.
 #include "clustering/immediate_consistency/branch/backfillee.hpp"
 
+#include <vector>
+
 #include "clustering/immediate_consistency/branch/history.hpp"
 #include "concurrency/coro_pool.hpp"
 #include "concurrency/cross_thread_signal.hpp"
@@ -17,26 +19,26 @@ struct backfill_queue_entry_t {
     // constructor (and assignment operator, presumably) is completely asinine.
     backfill_queue_entry_t() { }
     backfill_queue_entry_t(bool _is_not_last_backfill_chunk,
-                           const typename protocol_t::backfill_chunk_t &_chunk,
+                           const std::vector<typename protocol_t::backfill_chunk_t> &_chunks,
                            fifo_enforcer_write_token_t _write_token)
         : is_not_last_backfill_chunk(_is_not_last_backfill_chunk),
-          chunk(_chunk),
+          chunks(_chunks),
           write_token(_write_token) { }
 
     bool is_not_last_backfill_chunk;
-    typename protocol_t::backfill_chunk_t chunk;
+    std::vector<typename protocol_t::backfill_chunk_t> chunks;
     fifo_enforcer_write_token_t write_token;
 };
 
 template <class protocol_t>
 void push_chunk_on_queue(fifo_enforcer_queue_t<backfill_queue_entry_t<protocol_t> > *queue,
-                         typename protocol_t::backfill_chunk_t chunk, fifo_enforcer_write_token_t token) {
-    queue->push(token, backfill_queue_entry_t<protocol_t>(true, chunk, token));
+                         const std::vector<typename protocol_t::backfill_chunk_t> &chunks, fifo_enforcer_write_token_t token) {
+    queue->push(token, backfill_queue_entry_t<protocol_t>(true, chunks, token));
 }
 
 template <class protocol_t>
 void push_finish_on_queue(fifo_enforcer_queue_t<backfill_queue_entry_t<protocol_t> > *queue, fifo_enforcer_write_token_t token) {
-    queue->push(token, backfill_queue_entry_t<protocol_t>(false, typename protocol_t::backfill_chunk_t(), token));
+    queue->push(token, backfill_queue_entry_t<protocol_t>(false, std::vector<typename protocol_t::backfill_chunk_t>(), token));
 }
 
 
@@ -54,19 +56,19 @@ public:
         done_message_arrived(false), num_outstanding_chunks(0)
     { }
 
-    void apply_backfill_chunk(fifo_enforcer_write_token_t chunk_token, const typename protocol_t::backfill_chunk_t& chunk, signal_t *interruptor) {
+    void apply_backfill_chunks(fifo_enforcer_write_token_t chunk_token, const std::vector<typename protocol_t::backfill_chunk_t> &chunks, signal_t *interruptor) {
         object_buffer_t<fifo_enforcer_sink_t::exit_write_t> write_token;
         svs->new_write_token(&write_token);
         chunk_queue->finish_write(chunk_token);
 
-        svs->receive_backfill(chunk, &write_token, interruptor);
+        svs->receive_backfill(chunks, &write_token, interruptor);
     }
 
     void coro_pool_callback(backfill_queue_entry_t<protocol_t> chunk, signal_t *interruptor) {
         assert_thread();
         try {
             if (chunk.is_not_last_backfill_chunk) {
-                /* This is an actual backfill chunk */
+                /* This is an actual batch of backfill chunks */
 
                 /* Before letting the next thing go, increment
                    `num_outstanding_chunks` and acquire a write token. The
@@ -76,8 +78,8 @@ public:
                    superblock in the correct order. */
                 num_outstanding_chunks++;
 
-                // We acquire the write token in apply_backfill_chunk.
-                apply_backfill_chunk(chunk.write_token, chunk.chunk, interruptor);
+                // We acquire the write token in apply_backfill_chunks.
+                apply_backfill_chunks(chunk.write_token, chunk.chunks, interruptor);
 
                 /* Allow the backfiller to send us more data */
                 int chunks_to_send_out = 0;
@@ -86,11 +88,10 @@ public:
                      * modifying unacked chunks, otherwise another callback may
                      * decided to send out an allocation as well. */
                     ASSERT_NO_CORO_WAITING;
-                    ++unacked_chunks;
-                    guarantee(unacked_chunks <= ALLOCATION_CHUNK);
-                    if (unacked_chunks == ALLOCATION_CHUNK) {
+                    unacked_chunks += chunk.chunks.size();
+                    if (unacked_chunks >= ALLOCATION_CHUNK) {
+                        chunks_to_send_out = unacked_chunks;
                         unacked_chunks = 0;
-                        chunks_to_send_out = ALLOCATION_CHUNK;
                     }
                 }
                 if (chunks_to_send_out != 0) {
@@ -199,9 +200,9 @@ void backfillee(
             boost::bind(&push_finish_on_queue<protocol_t>, &chunk_queue, _1),
             mailbox_callback_mode_inline);
 
-        /* The backfiller will send individual chunks of the backfill to
+        /* The backfiller will send batches of chunks of the backfill to
         `chunk_mailbox`. */
-        mailbox_t<void(backfill_chunk_t, fifo_enforcer_write_token_t)> chunk_mailbox(
+        mailbox_t<void(std::vector<backfill_chunk_t>, fifo_enforcer_write_token_t)> chunk_mailbox(
             mailbox_manager, boost::bind(&push_chunk_on_queue<protocol_t>, &chunk_queue, _1, _2), mailbox_callback_mode_inline);
 
         /* The backfiller will register for allocations on the allocation
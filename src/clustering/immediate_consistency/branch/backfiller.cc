@@ -4,10 +4,11 @@
 #include "btree/parallel_traversal.hpp"
 #include "clustering/immediate_consistency/branch/history.hpp"
 #include "concurrency/fifo_enforcer.hpp"
-#include "concurrency/semaphore.hpp"
 #include "rpc/semilattice/view.hpp"
 #include "stl_utils.hpp"
 
+/* The backfillee hands out credit for this many chunks up front, and for more
+as it applies them. */
 #define MAX_CHUNKS_OUT 5000
 
 inline state_timestamp_t get_earliest_timestamp_of_version_range(const version_range_t &vr) {
@@ -85,60 +86,12 @@ bool backfiller_t<protocol_t>::confirm_and_send_metainfo(typename store_view_t<p
     return true;
 }
 
-template <class protocol_t>
-void do_send_chunk(mailbox_manager_t *mbox_manager,
-                   mailbox_addr_t<void(typename protocol_t::backfill_chunk_t, fifo_enforcer_write_token_t)> chunk_addr,
-                   const typename protocol_t::backfill_chunk_t &chunk,
-                   fifo_enforcer_source_t *fifo_src,
-                   semaphore_t *chunk_semaphore,
-                   signal_t *interruptor) THROWS_ONLY(interrupted_exc_t) {
-    chunk_semaphore->co_lock_interruptible(interruptor);
-    send(mbox_manager, chunk_addr, chunk, fifo_src->enter_write());
-}
-
-template <class protocol_t>
-class backfiller_send_backfill_callback_t : public send_backfill_callback_t<protocol_t> {
-public:
-    backfiller_send_backfill_callback_t(const region_map_t<protocol_t, version_range_t> *start_point,
-                                        mailbox_addr_t<void(region_map_t<protocol_t, version_range_t>, branch_history_t<protocol_t>)> end_point_cont,
-                                        mailbox_manager_t *mailbox_manager,
-                                        mailbox_addr_t<void(typename protocol_t::backfill_chunk_t, fifo_enforcer_write_token_t)> chunk_cont,
-                                        fifo_enforcer_source_t *fifo_src,
-                                        semaphore_t *chunk_semaphore,
-                                        backfiller_t<protocol_t> *backfiller)
-        : start_point_(start_point),
-          end_point_cont_(end_point_cont),
-          mailbox_manager_(mailbox_manager),
-          chunk_cont_(chunk_cont),
-          fifo_src_(fifo_src),
-          chunk_semaphore_(chunk_semaphore),
-          backfiller_(backfiller) { }
-
-    bool should_backfill_impl(const typename store_view_t<protocol_t>::metainfo_t &metainfo) {
-        return backfiller_->confirm_and_send_metainfo(metainfo, *start_point_, end_point_cont_);
-    }
-
-    void send_chunk(const typename protocol_t::backfill_chunk_t &chunk, signal_t *interruptor) THROWS_ONLY(interrupted_exc_t) {
-        do_send_chunk<protocol_t>(mailbox_manager_, chunk_cont_, chunk, fifo_src_, chunk_semaphore_, interruptor);
-    }
-private:
-    const region_map_t<protocol_t, version_range_t> *start_point_;
-    mailbox_addr_t<void(region_map_t<protocol_t, version_range_t>, branch_history_t<protocol_t>)> end_point_cont_;
-    mailbox_manager_t *mailbox_manager_;
-    mailbox_addr_t<void(typename protocol_t::backfill_chunk_t, fifo_enforcer_write_token_t)> chunk_cont_;
-    fifo_enforcer_source_t *fifo_src_;
-    semaphore_t *chunk_semaphore_;
-    backfiller_t<protocol_t> *backfiller_;
-
-    DISABLE_COPYING(backfiller_send_backfill_callback_t);
-};
-
 template <class protocol_t>
 void backfiller_t<protocol_t>::on_backfill(backfill_session_id_t session_id,
                                            const region_map_t<protocol_t, version_range_t> &start_point,
                                            const branch_history_t<protocol_t> &start_point_associated_branch_history,
                                            mailbox_addr_t<void(region_map_t<protocol_t, version_range_t>, branch_history_t<protocol_t>)> end_point_cont,
-                                           mailbox_addr_t<void(typename protocol_t::backfill_chunk_t, fifo_enforcer_write_token_t)> chunk_cont,
+                                           mailbox_addr_t<void(std::vector<typename protocol_t::backfill_chunk_t>, fifo_enforcer_write_token_t)> chunk_cont,
                                            mailbox_addr_t<void(fifo_enforcer_write_token_t)> done_cont,
                                            mailbox_addr_t<void(mailbox_addr_t<void(int)>)> allocation_registration_box,
                                            auto_drainer_t::lock_t keepalive) {
@@ -190,7 +143,8 @@ void backfiller_t<protocol_t>::on_backfill(backfill_session_id_t session_id,
                      &send_backfill_token,
                      &interrupted);
 
-        /* Send a confirmation */
+        /* Send the last few chunks, and then a confirmation */
+        send_backfill_cb.send_pending_chunks();
         send(mailbox_manager, done_cont, fifo_src.enter_write());
 
     } catch (interrupted_exc_t) {
@@ -4,9 +4,14 @@
 
 #include <map>
 #include <utility>
+#include <vector>
 
 #include "clustering/immediate_consistency/branch/history.hpp"
 #include "clustering/immediate_consistency/branch/metadata.hpp"
+#include "concurrency/semaphore.hpp"
+
+/* The backfiller sends at most this many chunks per message. */
+#define MAX_CHUNKS_PER_MESSAGE 100
 
 template <class> class backfiller_send_backfill_callback_t;
 template <class> class semilattice_read_view_t;
@@ -38,7 +43,7 @@ private:
             const region_map_t<protocol_t, version_range_t> &start_point,
             const branch_history_t<protocol_t> &start_point_associated_branch_history,
             mailbox_addr_t<void(region_map_t<protocol_t, version_range_t>, branch_history_t<protocol_t>)> end_point_cont,
-            mailbox_addr_t<void(typename protocol_t::backfill_chunk_t, fifo_enforcer_write_token_t)> chunk_cont,
+            mailbox_addr_t<void(std::vector<typename protocol_t::backfill_chunk_t>, fifo_enforcer_write_token_t)> chunk_cont,
             mailbox_addr_t<void(fifo_enforcer_write_token_t)> done_cont,
             mailbox_addr_t<void(mailbox_addr_t<void(int)>)> allocation_registration_box,
             auto_drainer_t::lock_t keepalive);
@@ -65,4 +70,66 @@ private:
     DISABLE_COPYING(backfiller_t);
 };
 
+/* Sends the chunks of one backfill session to the backfillee, a message at a
+time, taking one unit of `chunk_semaphore` per chunk. The backfillee gives
+units back as it applies the chunks. */
+template <class protocol_t>
+class backfiller_send_backfill_callback_t : public send_backfill_callback_t<protocol_t> {
+public:
+    backfiller_send_backfill_callback_t(const region_map_t<protocol_t, version_range_t> *start_point,
+                                        mailbox_addr_t<void(region_map_t<protocol_t, version_range_t>, branch_history_t<protocol_t>)> end_point_cont,
+                                        mailbox_manager_t *mailbox_manager,
+                                        mailbox_addr_t<void(std::vector<typename protocol_t::backfill_chunk_t>, fifo_enforcer_write_token_t)> chunk_cont,
+                                        fifo_enforcer_source_t *fifo_src,
+                                        semaphore_t *chunk_semaphore,
+                                        backfiller_t<protocol_t> *backfiller)
+        : start_point_(start_point),
+          end_point_cont_(end_point_cont),
+          mailbox_manager_(mailbox_manager),
+          chunk_cont_(chunk_cont),
+          fifo_src_(fifo_src),
+          chunk_semaphore_(chunk_semaphore),
+          backfiller_(backfiller) { }
+
+    bool should_backfill_impl(const typename store_view_t<protocol_t>::metainfo_t &metainfo) {
+        return backfiller_->confirm_and_send_metainfo(metainfo, *start_point_, end_point_cont_);
+    }
+
+    /* The traversal calls this from several coroutines at once. Chunks wait
+    in `pending_chunks_` until there are enough of them to fill a message. */
+    void send_chunk(const typename protocol_t::backfill_chunk_t &chunk, signal_t *interruptor) THROWS_ONLY(interrupted_exc_t) {
+        if (!chunk_semaphore_->try_lock()) {
+            /* We're out of credit, and the backfillee can only give us more
+            once it has applied what we've sent, so send everything before
+            waiting. */
+            send_pending_chunks();
+            chunk_semaphore_->co_lock_interruptible(interruptor);
+        }
+        pending_chunks_.push_back(chunk);
+        if (pending_chunks_.size() >= MAX_CHUNKS_PER_MESSAGE) {
+            send_pending_chunks();
+        }
+    }
+
+    /* Sends whatever chunks haven't gone out yet. */
+    void send_pending_chunks() {
+        if (!pending_chunks_.empty()) {
+            std::vector<typename protocol_t::backfill_chunk_t> chunks;
+            chunks.swap(pending_chunks_);
+            send(mailbox_manager_, chunk_cont_, chunks, fifo_src_->enter_write());
+        }
+    }
+private:
+    const region_map_t<protocol_t, version_range_t> *start_point_;
+    mailbox_addr_t<void(region_map_t<protocol_t, version_range_t>, branch_history_t<protocol_t>)> end_point_cont_;
+    mailbox_manager_t *mailbox_manager_;
+    mailbox_addr_t<void(std::vector<typename protocol_t::backfill_chunk_t>, fifo_enforcer_write_token_t)> chunk_cont_;
+    fifo_enforcer_source_t *fifo_src_;
+    semaphore_t *chunk_semaphore_;
+    backfiller_t<protocol_t> *backfiller_;
+    std::vector<typename protocol_t::backfill_chunk_t> pending_chunks_;
+
+    DISABLE_COPYING(backfiller_send_backfill_callback_t);
+};
+
 #endif /* CLUSTERING_IMMEDIATE_CONSISTENCY_BRANCH_BACKFILLER_HPP_ */
@@ -15,6 +15,11 @@
 #include "rpc/semilattice/view/field.hpp"
 #include "rpc/semilattice/view/member.hpp"
 
+/* `MAX_WRITE_BATCH_SIZE` is the most writes that go to a mirror in one
+message. The mirror's flow control counts the writes in a batch, not the
+batch. */
+#define MAX_WRITE_BATCH_SIZE 64
+
 template <class protocol_t>
 const int broadcaster_t<protocol_t>::MAX_OUTSTANDING_WRITES =
     listener_t<protocol_t>::MAX_OUTSTANDING_WRITES_FROM_BROADCASTER;
@@ -206,6 +211,7 @@ class broadcaster_t<protocol_t>::dispatchee_t : public intrusive_list_node_t<dis
 public:
     dispatchee_t(broadcaster_t *c, listener_business_card_t<protocol_t> d) THROWS_NOTHING :
         write_mailbox(d.write_mailbox), is_readable(false),
+        write_batch_send_scheduled(false),
         queue_count(),
         queue_count_membership(&c->broadcaster_collection, &queue_count, uuid_to_str(d.write_mailbox.get_peer().get_uuid()) + "_broadcast_queue_count"),
         background_write_queue(&queue_count),
@@ -237,9 +243,7 @@ public:
 
         for (typename std::list<boost::shared_ptr<incomplete_write_t> >::iterator it = controller->incomplete_writes.begin();
                 it != controller->incomplete_writes.end(); it++) {
-
-            coro_t::spawn_sometime(boost::bind(&broadcaster_t::background_write, controller,
-                                               this, auto_drainer_t::lock_t(&drainer), incomplete_write_ref_t(*it), order_source.check_in("dispatchee_t"), fifo_source.enter_write()));
+            controller->add_write_to_batch(this, auto_drainer_t::lock_t(&drainer), incomplete_write_ref_t(*it), order_source.check_in("dispatchee_t"), &acq);
         }
     }
 
@@ -272,22 +276,26 @@ private:
     /* `upgrade()` and `downgrade()` are mailbox callbacks. */
     void upgrade(typename listener_business_card_t<protocol_t>::writeread_mailbox_t::address_t wrm,
                  typename listener_business_card_t<protocol_t>::read_mailbox_t::address_t rm,
-                 auto_drainer_t::lock_t)
+                 auto_drainer_t::lock_t keepalive)
             THROWS_NOTHING {
         mutex_assertion_t::acq_t acq(&controller->mutex);
         ASSERT_FINITE_CORO_WAITING;
         guarantee(!is_readable);
+        /* The writes already in the batch were meant to go out as plain
+        writes. */
+        controller->send_write_batch(this, keepalive, &acq);
         is_readable = true;
         writeread_mailbox = wrm;
         read_mailbox = rm;
         controller->readable_dispatchees.push_back(this);
     }
 
-    void downgrade(mailbox_addr_t<void()> ack_addr, auto_drainer_t::lock_t) THROWS_NOTHING {
+    void downgrade(mailbox_addr_t<void()> ack_addr, auto_drainer_t::lock_t keepalive) THROWS_NOTHING {
         {
             mutex_assertion_t::acq_t acq(&controller->mutex);
             ASSERT_FINITE_CORO_WAITING;
             guarantee(is_readable);
+            controller->send_write_batch(this, keepalive, &acq);
             is_readable = false;
             controller->readable_dispatchees.remove(this);
         }
@@ -302,6 +310,12 @@ public:
     typename listener_business_card_t<protocol_t>::writeread_mailbox_t::address_t writeread_mailbox;
     typename listener_business_card_t<protocol_t>::read_mailbox_t::address_t read_mailbox;
 
+    /* The writes that will go out in the next batch, and the order token of
+    the last of them. */
+    std::vector<incomplete_write_ref_t> write_batch;
+    order_token_t write_batch_order_token;
+    bool write_batch_send_scheduled;
+
     /* This is used to enforce that operations are performed on the
        destination machine in the same order that we send them, even if the
        network layer reorders the messages. */
@@ -338,7 +352,7 @@ template<class protocol_t>
 void listener_write(
         mailbox_manager_t *mailbox_manager,
         const typename listener_business_card_t<protocol_t>::write_mailbox_t::address_t &write_mailbox,
-        const typename protocol_t::write_t &w, transition_timestamp_t ts,
+        const listener_write_batch_t<protocol_t> &batch,
         order_token_t order_token, fifo_enforcer_write_token_t token,
         signal_t *interruptor)
         THROWS_ONLY(interrupted_exc_t)
@@ -350,7 +364,7 @@ void listener_write(
         mailbox_callback_mode_inline);
 
     send(mailbox_manager, write_mailbox,
-         w, ts, order_token, token, ack_mailbox.get_address());
+         batch, order_token, token, ack_mailbox.get_address());
 
     wait_interruptible(&ack_cond, interruptor);
 }
@@ -365,19 +379,19 @@ template<class protocol_t>
 void listener_writeread(
         mailbox_manager_t *mailbox_manager,
         const typename listener_business_card_t<protocol_t>::writeread_mailbox_t::address_t &writeread_mailbox,
-        const typename protocol_t::write_t &w, typename protocol_t::write_response_t *response, transition_timestamp_t ts,
+        const listener_write_batch_t<protocol_t> &batch, std::vector<typename protocol_t::write_response_t> *responses,
         order_token_t order_token, fifo_enforcer_write_token_t token,
         signal_t *interruptor)
         THROWS_ONLY(interrupted_exc_t)
 {
     cond_t resp_cond;
-    mailbox_t<void(typename protocol_t::write_response_t)> resp_mailbox(
+    mailbox_t<void(std::vector<typename protocol_t::write_response_t>)> resp_mailbox(
         mailbox_manager,
-        boost::bind(&store_listener_response<typename protocol_t::write_response_t>, response, _1, &resp_cond),
+        boost::bind(&store_listener_response<std::vector<typename protocol_t::write_response_t> >, responses, _1, &resp_cond),
         mailbox_callback_mode_inline);
 
     send(mailbox_manager, writeread_mailbox,
-         w, ts, order_token, token, resp_mailbox.get_address());
+         batch, order_token, token, resp_mailbox.get_address());
 
     wait_interruptible(&resp_cond, interruptor);
 }
@@ -419,6 +433,8 @@ void broadcaster_t<protocol_t>::read(const typename protocol_t::read_t &read, ty
         lock->end();
 
         pick_a_readable_dispatchee(&reader, &mutex_acq, &reader_lock);
+        /* The read has to come after the writes before it. */
+        send_write_batch(reader, reader_lock, &mutex_acq);
         timestamp = current_timestamp;
         order_token = order_checkpoint.check_through(order_token);
 
@@ -482,18 +498,10 @@ void broadcaster_t<protocol_t>::spawn_write(const typename protocol_t::write_t &
     and grab order tokens */
     for (typename std::map<dispatchee_t *, auto_drainer_t::lock_t>::iterator it = dispatchees.begin();
             it != dispatchees.end(); it++) {
-        /* Once we call `enter_write()`, we have committed to sending
-        the write to every dispatchee. In particular, it's important
-        that we don't check `interruptor` until the write is on its way
-        to every dispatchee. */
-        fifo_enforcer_write_token_t fifo_enforcer_token = it->first->fifo_source.enter_write();
-        if (it->first->is_readable) {
-            it->first->background_write_queue.push(boost::bind(&broadcaster_t::background_writeread, this,
-                it->first, it->second, write_ref, order_token, fifo_enforcer_token));
-        } else {
-            it->first->background_write_queue.push(boost::bind(&broadcaster_t::background_write, this,
-                it->first, it->second, write_ref, order_token, fifo_enforcer_token));
-        }
+        /* Once the write is in a batch, we have committed to sending it to
+        every dispatchee. In particular, it's important that we don't check
+        `interruptor` until the write is on its way to every dispatchee. */
+        add_write_to_batch(it->first, it->second, write_ref, order_token, &mutex_acq);
     }
 }
 
@@ -517,10 +525,69 @@ void broadcaster_t<protocol_t>::pick_a_readable_dispatchee(dispatchee_t **dispat
 }
 
 template<class protocol_t>
-void broadcaster_t<protocol_t>::background_write(dispatchee_t *mirror, auto_drainer_t::lock_t mirror_lock, incomplete_write_ref_t write_ref, order_token_t order_token, fifo_enforcer_write_token_t token) THROWS_NOTHING {
+void broadcaster_t<protocol_t>::add_write_to_batch(dispatchee_t *mirror, auto_drainer_t::lock_t mirror_lock, const incomplete_write_ref_t &write_ref, order_token_t order_token, mutex_assertion_t::acq_t *proof) THROWS_NOTHING {
+    ASSERT_FINITE_CORO_WAITING;
+    proof->assert_is_holding(&mutex);
+
+    mirror->write_batch.push_back(write_ref);
+    mirror->write_batch_order_token = order_token;
+
+    if (mirror->write_batch.size() >= MAX_WRITE_BATCH_SIZE) {
+        send_write_batch(mirror, mirror_lock, proof);
+    } else if (!mirror->write_batch_send_scheduled) {
+        mirror->write_batch_send_scheduled = true;
+        coro_t::spawn_sometime(boost::bind(&broadcaster_t::send_write_batch_soon, this, mirror, mirror_lock));
+    }
+}
+
+template<class protocol_t>
+void broadcaster_t<protocol_t>::send_write_batch(dispatchee_t *mirror, auto_drainer_t::lock_t mirror_lock, mutex_assertion_t::acq_t *proof) THROWS_NOTHING {
+    ASSERT_FINITE_CORO_WAITING;
+    proof->assert_is_holding(&mutex);
+
+    if (mirror->write_batch.empty()) {
+        return;
+    }
+
+    std::vector<incomplete_write_ref_t> write_refs;
+    write_refs.swap(mirror->write_batch);
+
+    fifo_enforcer_write_token_t fifo_enforcer_token = mirror->fifo_source.enter_write();
+    if (mirror->is_readable) {
+        mirror->background_write_queue.push(boost::bind(&broadcaster_t::background_writeread, this,
+            mirror, mirror_lock, write_refs, mirror->write_batch_order_token, fifo_enforcer_token));
+    } else {
+        mirror->background_write_queue.push(boost::bind(&broadcaster_t::background_write, this,
+            mirror, mirror_lock, write_refs, mirror->write_batch_order_token, fifo_enforcer_token));
+    }
+}
+
+template<class protocol_t>
+void broadcaster_t<protocol_t>::send_write_batch_soon(dispatchee_t *mirror, auto_drainer_t::lock_t mirror_lock) THROWS_NOTHING {
+    mutex_assertion_t::acq_t mutex_acq(&mutex);
+    ASSERT_FINITE_CORO_WAITING;
+    mirror->write_batch_send_scheduled = false;
+    send_write_batch(mirror, mirror_lock, &mutex_acq);
+}
+
+template<class protocol_t>
+listener_write_batch_t<protocol_t> broadcaster_t<protocol_t>::make_write_batch(std::vector<incomplete_write_ref_t> *write_refs) {
+    listener_write_batch_t<protocol_t> batch;
+    batch.writes.reserve(write_refs->size());
+    batch.timestamps.reserve(write_refs->size());
+    for (size_t i = 0; i < write_refs->size(); ++i) {
+        batch.writes.push_back((*write_refs)[i].get()->write);
+        batch.timestamps.push_back((*write_refs)[i].get()->timestamp);
+    }
+    return batch;
+}
+
+template<class protocol_t>
+void broadcaster_t<protocol_t>::background_write(dispatchee_t *mirror, auto_drainer_t::lock_t mirror_lock, std::vector<incomplete_write_ref_t> write_refs, order_token_t order_token, fifo_enforcer_write_token_t token) THROWS_NOTHING {
+    listener_write_batch_t<protocol_t> batch = make_write_batch(&write_refs);
     try {
         listener_write<protocol_t>(mailbox_manager, mirror->write_mailbox,
-                                   write_ref.get()->write, write_ref.get()->timestamp, order_token, token,
+                                   batch, order_token, token,
                                    mirror_lock.get_drain_signal());
     } catch (interrupted_exc_t) {
         return;
@@ -528,15 +595,19 @@ void broadcaster_t<protocol_t>::background_write(dispatchee_t *mirror, auto_drai
 }
 
 template<class protocol_t>
-void broadcaster_t<protocol_t>::background_writeread(dispatchee_t *mirror, auto_drainer_t::lock_t mirror_lock, incomplete_write_ref_t write_ref, order_token_t order_token, fifo_enforcer_write_token_t token) THROWS_NOTHING {
+void broadcaster_t<protocol_t>::background_writeread(dispatchee_t *mirror, auto_drainer_t::lock_t mirror_lock, std::vector<incomplete_write_ref_t> write_refs, order_token_t order_token, fifo_enforcer_write_token_t token) THROWS_NOTHING {
+    listener_write_batch_t<protocol_t> batch = make_write_batch(&write_refs);
     try {
-        typename protocol_t::write_response_t resp;
+        std::vector<typename protocol_t::write_response_t> responses;
         listener_writeread<protocol_t>(mailbox_manager, mirror->writeread_mailbox,
-                                       write_ref.get()->write, &resp, write_ref.get()->timestamp, order_token, token,
+                                       batch, &responses, order_token, token,
                                        mirror_lock.get_drain_signal());
+        guarantee(responses.size() == write_refs.size());
 
-        if (write_ref.get()->callback) {
-            write_ref.get()->callback->on_response(mirror->get_peer(), resp);
+        for (size_t i = 0; i < write_refs.size(); ++i) {
+            if (write_refs[i].get()->callback) {
+                write_refs[i].get()->callback->on_response(mirror->get_peer(), responses[i]);
+            }
         }
     } catch (interrupted_exc_t) {
         return;
@@ -4,6 +4,7 @@
 
 #include <list>
 #include <map>
+#include <vector>
 
 #include "utils.hpp"
 #include <boost/shared_ptr.hpp>
@@ -95,8 +96,21 @@ private:
     machine.) */
     void pick_a_readable_dispatchee(dispatchee_t **dispatchee_out, mutex_assertion_t::acq_t *proof, auto_drainer_t::lock_t *lock_out) THROWS_ONLY(cannot_perform_query_exc_t);
 
-    void background_write(dispatchee_t *mirror, auto_drainer_t::lock_t mirror_lock, incomplete_write_ref_t write_ref, order_token_t order_token, fifo_enforcer_write_token_t token) THROWS_NOTHING;
-    void background_writeread(dispatchee_t *mirror, auto_drainer_t::lock_t mirror_lock, incomplete_write_ref_t write_ref, order_token_t order_token, fifo_enforcer_write_token_t token) THROWS_NOTHING;
+    /* Writes go out to each mirror in batches, so that a burst of small writes
+    costs one message and one transaction on the mirror rather than one each.
+    `add_write_to_batch()` adds a write to the mirror's next batch. The batch
+    goes out when it's full, or else once the thread gets back around to
+    `send_write_batch_soon()`, so whatever else arrives in the meantime gets in
+    too. Anything that sends the mirror something else must call
+    `send_write_batch()` first, so the mirror gets everything in order. You
+    must hold `mutex` and pass in `proof` of the mutex acquisition. */
+    void add_write_to_batch(dispatchee_t *mirror, auto_drainer_t::lock_t mirror_lock, const incomplete_write_ref_t &write_ref, order_token_t order_token, mutex_assertion_t::acq_t *proof) THROWS_NOTHING;
+    void send_write_batch(dispatchee_t *mirror, auto_drainer_t::lock_t mirror_lock, mutex_assertion_t::acq_t *proof) THROWS_NOTHING;
+    void send_write_batch_soon(dispatchee_t *mirror, auto_drainer_t::lock_t mirror_lock) THROWS_NOTHING;
+
+    static listener_write_batch_t<protocol_t> make_write_batch(std::vector<incomplete_write_ref_t> *write_refs);
+    void background_write(dispatchee_t *mirror, auto_drainer_t::lock_t mirror_lock, std::vector<incomplete_write_ref_t> write_refs, order_token_t order_token, fifo_enforcer_write_token_t token) THROWS_NOTHING;
+    void background_writeread(dispatchee_t *mirror, auto_drainer_t::lock_t mirror_lock, std::vector<incomplete_write_ref_t> write_refs, order_token_t order_token, fifo_enforcer_write_token_t token) THROWS_NOTHING;
     void end_write(boost::shared_ptr<incomplete_write_t> write) THROWS_NOTHING;
 
     /* This function sanity-checks `incomplete_writes`, `current_timestamp`,
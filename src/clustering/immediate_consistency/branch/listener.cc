@@ -15,12 +15,13 @@ when draining the write queue after completing a backfill. */
 #define WRITE_QUEUE_CORO_POOL_SIZE 1000
 
 /* When we have caught up to the master to within
-`WRITE_QUEUE_SEMAPHORE_LONG_TERM_CAPACITY` elements, then we consider ourselves
-to be up-to-date. */
+`WRITE_QUEUE_SEMAPHORE_LONG_TERM_CAPACITY` writes, then we consider ourselves
+to be up-to-date. The write queue holds batches of writes, but the semaphore
+and this limit count the writes in them. */
 #define WRITE_QUEUE_SEMAPHORE_LONG_TERM_CAPACITY 5
 
-/* When we are draining the write queue, we allow new objects to be added to the
-write queue at (this rate) * (the rate at which objects are being popped). If
+/* When we are draining the write queue, we allow new writes to be added to the
+write queue at (this rate) * (the rate at which writes are being popped). If
 this number is high, then the backfill will take longer but the cluster will
 serve queries at a high rate during the backfill. If this number is low, then
 the backfill will be faster but the cluster will only serve queries slowly
@@ -72,12 +73,13 @@ listener_t<protocol_t>::listener_t(io_backender_t *io_backender,
     write_queue_(io_backender, "backfill-serialization-" + uuid_to_str(uuid_), &perfmon_collection_),
     write_queue_semaphore_(SEMAPHORE_NO_LIMIT,
         WRITE_QUEUE_SEMAPHORE_TRICKLE_FRACTION),
+    writes_in_write_queue_(0),
     enforce_max_outstanding_writes_from_broadcaster_(MAX_OUTSTANDING_WRITES_FROM_BROADCASTER),
     write_mailbox_(mailbox_manager_,
-        boost::bind(&listener_t::on_write, this, _1, _2, _3, _4, _5),
+        boost::bind(&listener_t::on_write, this, _1, _2, _3, _4),
         mailbox_callback_mode_inline),
     writeread_mailbox_(mailbox_manager_,
-        boost::bind(&listener_t::on_writeread, this, _1, _2, _3, _4, _5),
+        boost::bind(&listener_t::on_writeread, this, _1, _2, _3, _4),
         mailbox_callback_mode_inline),
     read_mailbox_(mailbox_manager_,
         boost::bind(&listener_t::on_read, this, _1, _2, _3, _4, _5),
@@ -218,7 +220,7 @@ listener_t<protocol_t>::listener_t(io_backender_t *io_backender,
             WRITE_QUEUE_CORO_POOL_SIZE, &write_queue_, write_queue_coro_pool_callback_.get()));
     write_queue_semaphore_.set_capacity(WRITE_QUEUE_SEMAPHORE_LONG_TERM_CAPACITY);
 
-    if (write_queue_.size() <= WRITE_QUEUE_SEMAPHORE_LONG_TERM_CAPACITY) {
+    if (writes_in_write_queue_ <= WRITE_QUEUE_SEMAPHORE_LONG_TERM_CAPACITY) {
         write_queue_has_drained_.pulse_if_not_already_pulsed();
     }
 
@@ -245,12 +247,13 @@ listener_t<protocol_t>::listener_t(io_backender_t *io_backender,
     write_queue_(io_backender, "backfill-serialization-" + uuid_to_str(uuid_), &perfmon_collection_),
     write_queue_semaphore_(WRITE_QUEUE_SEMAPHORE_LONG_TERM_CAPACITY,
         WRITE_QUEUE_SEMAPHORE_TRICKLE_FRACTION),
+    writes_in_write_queue_(0),
     enforce_max_outstanding_writes_from_broadcaster_(MAX_OUTSTANDING_WRITES_FROM_BROADCASTER),
     write_mailbox_(mailbox_manager_,
-        boost::bind(&listener_t::on_write, this, _1, _2, _3, _4, _5),
+        boost::bind(&listener_t::on_write, this, _1, _2, _3, _4),
         mailbox_callback_mode_inline),
     writeread_mailbox_(mailbox_manager_,
-        boost::bind(&listener_t::on_writeread, this, _1, _2, _3, _4, _5),
+        boost::bind(&listener_t::on_writeread, this, _1, _2, _3, _4),
         mailbox_callback_mode_inline),
     read_mailbox_(mailbox_manager_,
         boost::bind(&listener_t::on_read, this, _1, _2, _3, _4, _5),
@@ -391,25 +394,37 @@ void listener_t<protocol_t>::try_start_receiving_writes(
     }
 }
 
+#ifndef NDEBUG
+template <class protocol_t>
+void assert_batch_is_sane(const listener_write_batch_t<protocol_t> &batch, const typename protocol_t::region_t &region) {
+    rassert(!batch.writes.empty());
+    rassert(batch.writes.size() == batch.timestamps.size());
+    for (size_t i = 0; i < batch.writes.size(); ++i) {
+        rassert(region_is_superset(region, batch.writes[i].get_region()));
+        rassert(!region_is_empty(batch.writes[i].get_region()));
+        rassert(i == 0 || batch.timestamps[i - 1].timestamp_after() == batch.timestamps[i].timestamp_before());
+    }
+}
+#endif
+
 template <class protocol_t>
-void listener_t<protocol_t>::on_write(const typename protocol_t::write_t &write,
-        transition_timestamp_t transition_timestamp,
+void listener_t<protocol_t>::on_write(const listener_write_batch_t<protocol_t> &batch,
         order_token_t order_token,
         fifo_enforcer_write_token_t fifo_token,
         mailbox_addr_t<void()> ack_addr) THROWS_NOTHING {
-    rassert(region_is_superset(our_branch_region_, write.get_region()));
-    rassert(!region_is_empty(write.get_region()));
+#ifndef NDEBUG
+    assert_batch_is_sane<protocol_t>(batch, our_branch_region_);
+#endif
     order_token.assert_write_mode();
 
     coro_t::spawn_sometime(boost::bind(
         &listener_t<protocol_t>::enqueue_write, this,
-        write, transition_timestamp, order_token, fifo_token, ack_addr,
+        batch, order_token, fifo_token, ack_addr,
         auto_drainer_t::lock_t(&drainer_)));
 }
 
 template <class protocol_t>
-void listener_t<protocol_t>::enqueue_write(const typename protocol_t::write_t &write,
-        transition_timestamp_t transition_timestamp,
+void listener_t<protocol_t>::enqueue_write(const listener_write_batch_t<protocol_t> &batch,
         order_token_t order_token,
         fifo_enforcer_write_token_t fifo_token,
         mailbox_addr_t<void()> ack_addr,
@@ -417,12 +432,13 @@ void listener_t<protocol_t>::enqueue_write(const typename protocol_t::write_t &w
     try {
         /* Make sure that the broadcaster isn't sending us too many concurrent
         writes */
-        semaphore_assertion_t::acq_t sem_acq(&enforce_max_outstanding_writes_from_broadcaster_);
+        semaphore_assertion_t::acq_t sem_acq(&enforce_max_outstanding_writes_from_broadcaster_, batch.writes.size());
 
         fifo_enforcer_sink_t::exit_write_t fifo_exit(&write_queue_entrance_sink_, fifo_token);
         wait_interruptible(&fifo_exit, keepalive.get_drain_signal());
-        write_queue_semaphore_.co_lock_interruptible(keepalive.get_drain_signal());
-        write_queue_.push(write_queue_entry_t(write, transition_timestamp, order_token, fifo_token));
+        write_queue_semaphore_.co_lock_interruptible(keepalive.get_drain_signal(), batch.writes.size());
+        writes_in_write_queue_ += batch.writes.size();
+        write_queue_.push(write_queue_entry_t(batch, order_token, fifo_token));
 
         /* Release the semaphore before sending the response, because the
         broadcaster can send us a new write as soon as we send the ack */
@@ -438,72 +454,90 @@ template <class protocol_t>
 void listener_t<protocol_t>::perform_enqueued_write(const write_queue_entry_t &qe,
         state_timestamp_t backfill_end_timestamp,
         signal_t *interruptor) THROWS_ONLY(interrupted_exc_t) {
-    write_queue_semaphore_.unlock();
-    if (write_queue_.size() <= WRITE_QUEUE_SEMAPHORE_LONG_TERM_CAPACITY) {
+    write_queue_semaphore_.unlock(qe.batch.writes.size());
+    writes_in_write_queue_ -= qe.batch.writes.size();
+    if (writes_in_write_queue_ <= WRITE_QUEUE_SEMAPHORE_LONG_TERM_CAPACITY) {
         write_queue_has_drained_.pulse_if_not_already_pulsed();
     }
 
+    /* The backfill already covers the writes before `backfill_end_timestamp`.
+    Because the writes in a batch are in timestamp order, those are a prefix of
+    the batch. */
+    const listener_write_batch_t<protocol_t> &batch = qe.batch;
+    size_t first = 0;
+    while (first < batch.timestamps.size() && batch.timestamps[first].timestamp_before() < backfill_end_timestamp) {
+        ++first;
+    }
+
     object_buffer_t<fifo_enforcer_sink_t::exit_write_t> write_token;
     {
         fifo_enforcer_sink_t::exit_write_t fifo_exit(&store_entrance_sink_, qe.fifo_token);
-        if (qe.transition_timestamp.timestamp_before() < backfill_end_timestamp) {
+        if (first == batch.timestamps.size()) {
             return;
         }
         wait_interruptible(&fifo_exit, interruptor);
-        advance_current_timestamp_and_pulse_waiters(qe.transition_timestamp);
+        for (size_t i = first; i < batch.timestamps.size(); ++i) {
+            advance_current_timestamp_and_pulse_waiters(batch.timestamps[i]);
+        }
         svs_->new_write_token(&write_token);
     }
 
 #ifndef NDEBUG
-        version_leq_metainfo_checker_callback_t<protocol_t> metainfo_checker_callback(qe.transition_timestamp.timestamp_before());
+        version_leq_metainfo_checker_callback_t<protocol_t> metainfo_checker_callback(batch.timestamps[first].timestamp_before());
         metainfo_checker_t<protocol_t> metainfo_checker(&metainfo_checker_callback, svs_->get_region());
 #endif
 
-    typename protocol_t::write_response_t response;
+    std::vector<typename protocol_t::write_t> writes;
+    writes.reserve(batch.writes.size() - first);
+    for (size_t i = first; i < batch.writes.size(); ++i) {
+        writes.push_back(batch.writes[i].shard(region_intersection(batch.writes[i].get_region(), svs_->get_region())));
+    }
+    std::vector<transition_timestamp_t> timestamps(batch.timestamps.begin() + first, batch.timestamps.end());
+
+    std::vector<typename protocol_t::write_response_t> responses;
 
-    svs_->write(
+    svs_->write_batch(
         DEBUG_ONLY(metainfo_checker, )
         region_map_t<protocol_t, binary_blob_t>(svs_->get_region(),
-            binary_blob_t(version_range_t(version_t(branch_id_, qe.transition_timestamp.timestamp_after())))),
-        qe.write.shard(region_intersection(qe.write.get_region(), svs_->get_region())),
-        &response,
-        qe.transition_timestamp,
+            binary_blob_t(version_range_t(version_t(branch_id_, timestamps.back().timestamp_after())))),
+        writes,
+        timestamps,
+        &responses,
         qe.order_token,
         &write_token,
         interruptor);
 }
 
 template <class protocol_t>
-void listener_t<protocol_t>::on_writeread(const typename protocol_t::write_t &write,
-        transition_timestamp_t transition_timestamp,
+void listener_t<protocol_t>::on_writeread(const listener_write_batch_t<protocol_t> &batch,
         order_token_t order_token,
         fifo_enforcer_write_token_t fifo_token,
-        mailbox_addr_t<void(typename protocol_t::write_response_t)> ack_addr)
+        mailbox_addr_t<void(std::vector<typename protocol_t::write_response_t>)> ack_addr)
         THROWS_NOTHING
 {
-    rassert(region_is_superset(our_branch_region_, write.get_region()));
-    rassert(!region_is_empty(write.get_region()));
-    rassert(region_is_superset(svs_->get_region(), write.get_region()));
+#ifndef NDEBUG
+    assert_batch_is_sane<protocol_t>(batch, our_branch_region_);
+    assert_batch_is_sane<protocol_t>(batch, svs_->get_region());
+#endif
     order_token.assert_write_mode();
 
     coro_t::spawn_sometime(boost::bind(
         &listener_t<protocol_t>::perform_writeread, this,
-        write, transition_timestamp, order_token, fifo_token, ack_addr,
+        batch, order_token, fifo_token, ack_addr,
         auto_drainer_t::lock_t(&drainer_)));
 }
 
 template <class protocol_t>
-void listener_t<protocol_t>::perform_writeread(const typename protocol_t::write_t &write,
-        transition_timestamp_t transition_timestamp,
+void listener_t<protocol_t>::perform_writeread(const listener_write_batch_t<protocol_t> &batch,
         order_token_t order_token,
         fifo_enforcer_write_token_t fifo_token,
-        mailbox_addr_t<void(typename protocol_t::write_response_t)> ack_addr,
+        mailbox_addr_t<void(std::vector<typename protocol_t::write_response_t>)> ack_addr,
         auto_drainer_t::lock_t keepalive)
         THROWS_NOTHING
 {
     try {
         /* Make sure the broadcaster isn't sending us too many writes */
-        semaphore_assertion_t::acq_t sem_acq(&enforce_max_outstanding_writes_from_broadcaster_);
+        semaphore_assertion_t::acq_t sem_acq(&enforce_max_outstanding_writes_from_broadcaster_, batch.writes.size());
 
         object_buffer_t<fifo_enforcer_sink_t::exit_write_t> write_token;
         {
@@ -516,38 +550,38 @@ void listener_t<protocol_t>::perform_writeread(const typename protocol_t::write_
             fifo_enforcer_sink_t::exit_write_t fifo_exit_2(&store_entrance_sink_, fifo_token);
             wait_interruptible(&fifo_exit_2, keepalive.get_drain_signal());
 
-            advance_current_timestamp_and_pulse_waiters(transition_timestamp);
+            for (size_t i = 0; i < batch.timestamps.size(); ++i) {
+                advance_current_timestamp_and_pulse_waiters(batch.timestamps[i]);
+            }
 
             svs_->new_write_token(&write_token);
         }
 
+#ifndef NDEBUG
         // Make sure we can serve the entire operation without masking it.
         // (We shouldn't have been signed up for writereads if we couldn't.)
-        rassert(region_is_superset(svs_->get_region(), write.get_region()));
-
+        assert_batch_is_sane<protocol_t>(batch, svs_->get_region());
 
-#ifndef NDEBUG
-        version_leq_metainfo_checker_callback_t<protocol_t> metainfo_checker_callback(transition_timestamp.timestamp_before());
+        version_leq_metainfo_checker_callback_t<protocol_t> metainfo_checker_callback(batch.timestamps.front().timestamp_before());
         metainfo_checker_t<protocol_t> metainfo_checker(&metainfo_checker_callback, svs_->get_region());
 #endif
 
-        // Perform the operation
-        cond_t non_interruptor;
-        typename protocol_t::write_response_t response;
-        svs_->write(DEBUG_ONLY(metainfo_checker, )
-                    region_map_t<protocol_t, binary_blob_t>(svs_->get_region(),
-                                                            binary_blob_t(version_range_t(version_t(branch_id_, transition_timestamp.timestamp_after())))),
-                    write,
-                    &response,
-                    transition_timestamp,
-                    order_token,
-                    &write_token,
-                    keepalive.get_drain_signal());
+        // Perform the operations
+        std::vector<typename protocol_t::write_response_t> responses;
+        svs_->write_batch(DEBUG_ONLY(metainfo_checker, )
+                          region_map_t<protocol_t, binary_blob_t>(svs_->get_region(),
+                                                                  binary_blob_t(version_range_t(version_t(branch_id_, batch.timestamps.back().timestamp_after())))),
+                          batch.writes,
+                          batch.timestamps,
+                          &responses,
+                          order_token,
+                          &write_token,
+                          keepalive.get_drain_signal());
 
         /* Release the semaphore before sending the response, because the
         broadcaster can send us a new write as soon as we send the ack */
         sem_acq.reset();
-        send(mailbox_manager_, ack_addr, response);
+        send(mailbox_manager_, ack_addr, responses);
 
     } catch (interrupted_exc_t) {
         /* pass */
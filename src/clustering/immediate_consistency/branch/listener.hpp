@@ -124,15 +124,14 @@ private:
     class write_queue_entry_t {
     public:
         write_queue_entry_t() { }
-        write_queue_entry_t(const typename protocol_t::write_t &w, transition_timestamp_t tt, order_token_t _order_token, fifo_enforcer_write_token_t ft) :
-            write(w), transition_timestamp(tt), order_token(_order_token), fifo_token(ft) { }
-        typename protocol_t::write_t write;
-        transition_timestamp_t transition_timestamp;
+        write_queue_entry_t(const listener_write_batch_t<protocol_t> &b, order_token_t _order_token, fifo_enforcer_write_token_t ft) :
+            batch(b), order_token(_order_token), fifo_token(ft) { }
+        listener_write_batch_t<protocol_t> batch;
         order_token_t order_token;
         fifo_enforcer_write_token_t fifo_token;
 
         // This is serializable because this gets written to a disk backed queue.
-        RDB_MAKE_ME_SERIALIZABLE_4(write, order_token, transition_timestamp, fifo_token);
+        RDB_MAKE_ME_SERIALIZABLE_3(batch, order_token, fifo_token);
     };
 
     // TODO: This boost optional boost optional crap is ... crap.  This isn't Haskell, this is *real* programming, people.
@@ -151,15 +150,13 @@ private:
             signal_t *interruptor)
         THROWS_ONLY(interrupted_exc_t, broadcaster_lost_exc_t);
 
-    void on_write(const typename protocol_t::write_t &write,
-            transition_timestamp_t transition_timestamp,
+    void on_write(const listener_write_batch_t<protocol_t> &batch,
             order_token_t order_token,
             fifo_enforcer_write_token_t fifo_token,
             mailbox_addr_t<void()> ack_addr)
         THROWS_NOTHING;
 
-    void enqueue_write(const typename protocol_t::write_t &write,
-            transition_timestamp_t transition_timestamp,
+    void enqueue_write(const listener_write_batch_t<protocol_t> &batch,
             order_token_t order_token,
             fifo_enforcer_write_token_t fifo_token,
             mailbox_addr_t<void()> ack_addr,
@@ -172,18 +169,16 @@ private:
     /* See the note at the place where `writeread_mailbox` is declared for an
     explanation of why `on_writeread()` and `on_read()` are here. */
 
-    void on_writeread(const typename protocol_t::write_t &write,
-            transition_timestamp_t transition_timestamp,
+    void on_writeread(const listener_write_batch_t<protocol_t> &batch,
             order_token_t order_token,
             fifo_enforcer_write_token_t fifo_token,
-            mailbox_addr_t<void(typename protocol_t::write_response_t)> ack_addr)
+            mailbox_addr_t<void(std::vector<typename protocol_t::write_response_t>)> ack_addr)
         THROWS_NOTHING;
 
-    void perform_writeread(const typename protocol_t::write_t &write,
-            transition_timestamp_t transition_timestamp,
+    void perform_writeread(const listener_write_batch_t<protocol_t> &batch,
             order_token_t order_token,
             fifo_enforcer_write_token_t fifo_token,
-            mailbox_addr_t<void(typename protocol_t::write_response_t)> ack_addr,
+            mailbox_addr_t<void(std::vector<typename protocol_t::write_response_t>)> ack_addr,
             auto_drainer_t::lock_t keepalive)
         THROWS_NOTHING;
 
@@ -237,6 +232,8 @@ private:
     fifo_enforcer_sink_t write_queue_entrance_sink_;
     scoped_ptr_t<boost_function_callback_t<write_queue_entry_t> > write_queue_coro_pool_callback_;
     adjustable_semaphore_t write_queue_semaphore_;
+    /* How many writes there are in the batches in `write_queue_`. */
+    int writes_in_write_queue_;
     cond_t write_queue_has_drained_;
 
     /* Destroying `write_queue_coro_pool` will stop any invocations of
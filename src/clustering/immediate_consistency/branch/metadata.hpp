@@ -4,6 +4,7 @@
 
 #include <map>
 #include <utility>
+#include <vector>
 
 #include "clustering/generic/registration_metadata.hpp"
 #include "clustering/generic/resource.hpp"
@@ -11,6 +12,7 @@
 #include "concurrency/fifo_checker.hpp"
 #include "concurrency/fifo_enforcer.hpp"
 #include "concurrency/promise.hpp"
+#include "containers/archive/stl_types.hpp"
 #include "containers/printf_buffer.hpp"
 #include "containers/uuid.hpp"
 #include "protocol_api.hpp"
@@ -20,6 +22,19 @@
 
 template <class> class listener_intro_t;
 
+/* The `broadcaster_t` sends writes to each `listener_t` in batches, one message
+per batch, and the `listener_t` applies each batch in a single transaction. The
+writes are in order and have consecutive timestamps. */
+
+template<class protocol_t>
+class listener_write_batch_t {
+public:
+    std::vector<typename protocol_t::write_t> writes;
+    std::vector<transition_timestamp_t> timestamps;
+
+    RDB_MAKE_ME_SERIALIZABLE_2(writes, timestamps);
+};
+
 /* Every `listener_t` constructs a `listener_business_card_t` and sends it to
 the `broadcaster_t`. */
 
@@ -30,17 +45,15 @@ public:
     /* These are the types of mailboxes that the master uses to communicate with
     the mirrors. */
 
-    typedef mailbox_t<void(typename protocol_t::write_t,
-                           transition_timestamp_t,
+    typedef mailbox_t<void(listener_write_batch_t<protocol_t>,
                            order_token_t,
                            fifo_enforcer_write_token_t,
                            mailbox_addr_t<void()>)> write_mailbox_t;
 
-    typedef mailbox_t<void(typename protocol_t::write_t,
-                           transition_timestamp_t,
+    typedef mailbox_t<void(listener_write_batch_t<protocol_t>,
                            order_token_t,
                            fifo_enforcer_write_token_t,
-                           mailbox_addr_t<void(typename protocol_t::write_response_t)>)> writeread_mailbox_t;
+                           mailbox_addr_t<void(std::vector<typename protocol_t::write_response_t>)>)> writeread_mailbox_t;
 
     typedef mailbox_t<void(typename protocol_t::read_t,
                            state_timestamp_t,
@@ -94,7 +107,9 @@ public:
 
 
 /* `backfiller_business_card_t` represents a thing that is willing to serve
-backfills over the network. It appears in the directory. */
+backfills over the network. It appears in the directory. The backfiller sends
+chunks in batches, each with one fifo token, and the backfillee applies each
+batch in one go. */
 
 typedef uuid_t backfill_session_id_t;
 
@@ -109,7 +124,7 @@ struct backfiller_business_card_t {
             region_map_t<protocol_t, version_range_t>,
             branch_history_t<protocol_t>
             ) >,
-        mailbox_addr_t<void(typename protocol_t::backfill_chunk_t, fifo_enforcer_write_token_t)>,
+        mailbox_addr_t<void(std::vector<typename protocol_t::backfill_chunk_t>, fifo_enforcer_write_token_t)>,
         mailbox_t<void(fifo_enforcer_write_token_t)>::address_t,
         mailbox_t<void(mailbox_addr_t<void(int)>)>::address_t
         )> backfill_mailbox_t;
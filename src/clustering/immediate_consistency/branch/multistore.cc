@@ -222,7 +222,10 @@ template <class protocol_t>
 void multistore_ptr_t<protocol_t>::switch_read_tokens(object_buffer_t<fifo_enforcer_sink_t::exit_read_t> *external_token, signal_t *interruptor, order_token_t *order_token_ref, scoped_array_t<switch_read_token_t> *internal_out) {
     object_buffer_t<fifo_enforcer_sink_t::exit_read_t>::destruction_sentinel_t destroyer(external_token);
 
-    wait_interruptible(external_token->get(), interruptor);
+    {
+        coro_wait_reason_tag_t wait_reason(coro_wait_reason_fifo_enforcer);
+        wait_interruptible(external_token->get(), interruptor);
+    }
 
     *order_token_ref = external_checkpoint_.get()->check_through(*order_token_ref);
 
@@ -239,7 +242,10 @@ template <class protocol_t>
 void multistore_ptr_t<protocol_t>::switch_write_tokens(object_buffer_t<fifo_enforcer_sink_t::exit_write_t> *external_token, signal_t *interruptor, order_token_t *order_token_ref, scoped_array_t<fifo_enforcer_write_token_t> *internal_out) {
     object_buffer_t<fifo_enforcer_sink_t::exit_write_t>::destruction_sentinel_t destroyer(external_token);
 
-    wait_interruptible(external_token->get(), interruptor);
+    {
+        coro_wait_reason_tag_t wait_reason(coro_wait_reason_fifo_enforcer);
+        wait_interruptible(external_token->get(), interruptor);
+    }
 
     *order_token_ref = external_checkpoint_.get()->check_through(*order_token_ref);
 
@@ -52,7 +52,10 @@ void master_access_t<protocol_t>::read(
         boost::bind(&promise_t<boost::variant<typename protocol_t::read_response_t, std::string> >::pulse, &result_or_failure, _1),
         mailbox_callback_mode_inline);
 
-    wait_interruptible(token, interruptor);
+    {
+        coro_wait_reason_tag_t wait_reason(coro_wait_reason_fifo_enforcer);
+        wait_interruptible(token, interruptor);
+    }
     fifo_enforcer_read_token_t token_for_master = source_for_master.enter_read();
     typename multi_throttling_client_t<
             typename master_business_card_t<protocol_t>::request_t,
@@ -106,7 +109,10 @@ void master_access_t<protocol_t>::write(
         boost::bind(&promise_t<boost::variant<typename protocol_t::write_response_t, std::string> >::pulse, &result_or_failure, _1),
         mailbox_callback_mode_inline);
 
-    wait_interruptible(token, interruptor);
+    {
+        coro_wait_reason_tag_t wait_reason(coro_wait_reason_fifo_enforcer);
+        wait_interruptible(token, interruptor);
+    }
     fifo_enforcer_write_token_t token_for_master = source_for_master.enter_write();
     typename multi_throttling_client_t<
             typename master_business_card_t<protocol_t>::request_t,
@@ -93,6 +93,12 @@ void cluster_namespace_interface_t<protocol_t>::dispatch_immediate_op(
     {
         region_map_t<protocol_t, std::set<relationship_t *> > submap = relationships.mask(op.get_region());
         for (typename region_map_t<protocol_t, std::set<relationship_t *> >::iterator it = submap.begin(); it != submap.end(); it++) {
+            /* An operation's region can be a hull around what it actually
+               touches (e.g. a multi-key read), so a shard inside it may have
+               nothing to do. */
+            if (region_is_empty(op.shard(it->first).get_region())) {
+                continue;
+            }
             relationship_t *chosen_relationship = NULL;
             for (typename std::set<relationship_t *>::const_iterator jt = it->second.begin(); jt != it->second.end(); jt++) {
                 if ((*jt)->master_access) {
@@ -193,6 +199,10 @@ cluster_namespace_interface_t<protocol_t>::dispatch_outdated_read(const typename
     {
         region_map_t<protocol_t, std::set<relationship_t *> > submap = relationships.mask(op.get_region());
         for (typename region_map_t<protocol_t, std::set<relationship_t *> >::iterator it = submap.begin(); it != submap.end(); it++) {
+            /* See `dispatch_immediate_op()`. */
+            if (region_is_empty(op.shard(it->first).get_region())) {
+                continue;
+            }
             std::vector<relationship_t *> potential_relationships;
             relationship_t *chosen_relationship = NULL;
             for (typename std::set<relationship_t *>::const_iterator jt = it->second.begin(); jt != it->second.end(); jt++) {
@@ -27,6 +27,7 @@ void mutex_t::acq_t::reset(mutex_t *l, bool eager) {
 void co_lock_mutex(mutex_t *mutex) {
     if (mutex->locked) {
         mutex->waiters.push_back(coro_t::self());
+        coro_wait_reason_tag_t wait_reason(coro_wait_reason_mutex);
         coro_t::wait();
     } else {
         mutex->locked = true;
@@ -140,15 +140,15 @@ private:
 
 struct semaphore_assertion_t : public home_thread_mixin_debug_only_t {
     struct acq_t {
-        acq_t() : parent(NULL) { }
-        explicit acq_t(semaphore_assertion_t *p) : parent(p) {
+        acq_t() : parent(NULL), count(0) { }
+        explicit acq_t(semaphore_assertion_t *p, int _count = 1) : parent(p), count(_count) {
             parent->assert_thread();
-            rassert(parent->capacity > 0);
-            parent->capacity--;
+            rassert(parent->capacity >= count);
+            parent->capacity -= count;
         }
         void reset() {
             parent->assert_thread();
-            parent->capacity++;
+            parent->capacity += count;
             parent = NULL;
         }
         ~acq_t() {
@@ -158,6 +158,7 @@ struct semaphore_assertion_t : public home_thread_mixin_debug_only_t {
         }
     private:
         semaphore_assertion_t *parent;
+        int count;
         DISABLE_COPYING(acq_t);
     };
     explicit semaphore_assertion_t(int cap) : capacity(cap) { }
@@ -216,7 +217,7 @@ private:
 struct semaphore_assertion_t {
     struct acq_t {
         acq_t() { }
-        explicit acq_t(semaphore_assertion_t *) { }
+        explicit acq_t(semaphore_assertion_t *, int = 1) { }
         void reset() { }
         ~acq_t() { }
     private:
@@ -55,6 +55,15 @@ void semaphore_t::co_lock_interruptible(signal_t *interruptor) {
     }
 }
 
+bool semaphore_t::try_lock(int count) {
+    rassert(!in_callback);
+    if (!waiters.empty() || (current + count > capacity && capacity != SEMAPHORE_NO_LIMIT)) {
+        return false;
+    }
+    current += count;
+    return true;
+}
+
 void semaphore_t::unlock(int count) {
     rassert(!in_callback);
     rassert(current >= count);
@@ -108,12 +117,12 @@ void adjustable_semaphore_t::co_lock(int count) {
     coro_t::yield();
 }
 
-void adjustable_semaphore_t::co_lock_interruptible(signal_t *interruptor) {
+void adjustable_semaphore_t::co_lock_interruptible(signal_t *interruptor, int count) {
     rassert(!in_callback);
     struct : public semaphore_available_callback_t, public cond_t {
         void on_semaphore_available() { pulse(); }
     } cb;
-    lock(&cb, 1);
+    lock(&cb, count);
 
     try {
         wait_interruptible(&cb, interruptor);
@@ -162,6 +171,9 @@ bool adjustable_semaphore_t::try_lock(int count) {
     if (current + count > capacity && capacity != SEMAPHORE_NO_LIMIT) {
         if (trickle_points >= count) {
             trickle_points -= count;
+        } else if (count > capacity && capacity > 0 && current == 0) {
+            /* A request for more than the whole capacity would never fit, so it
+            gets the semaphore to itself instead. */
         } else {
             return false;
         }
@@ -44,6 +44,10 @@ public:
 
     void co_lock_interruptible(signal_t *interruptor);
 
+    /* Takes the semaphore if that can be done without waiting; otherwise
+    returns false without queueing up for it. */
+    bool try_lock(int count = 1);
+
     void unlock(int count = 1);
     void lock_now(int count = 1);
 };
@@ -52,7 +56,9 @@ public:
 capacity at runtime. If you call `set_capacity()` and the new capacity is less
 than the current number of objects that hold the semaphore, then new objects
 will be allowed to enter at `trickle_fraction` of the rate that the objects are
-leaving until the number of objects drops to the desired capacity. */
+leaving until the number of objects drops to the desired capacity. A request
+for more than the whole capacity is let in once nothing else holds the
+semaphore. */
 
 class adjustable_semaphore_t {
     struct lock_request_t : public intrusive_list_node_t<lock_request_t> {
@@ -81,7 +87,7 @@ public:
     void lock(semaphore_available_callback_t *cb, int count = 1);
 
     void co_lock(int count = 1);
-    void co_lock_interruptible(signal_t *interruptor);
+    void co_lock_interruptible(signal_t *interruptor, int count = 1);
 
     void unlock(int count = 1);
 
@@ -25,6 +25,11 @@
 // queue of IO requests is higher than this depth
 #define TARGET_IO_QUEUE_DEPTH                     64
 
+// If io_uring turns our operations away while it has none of ours in flight,
+// so that no completion will come along to wake us up, we try again after
+// this many milliseconds.
+#define URING_SUBMIT_RETRY_MS                     1
+
 // Defines the maximum size of the batch of IO events to process on
 // each loop iteration. A larger number will increase throughput but
 // decrease concurrency
@@ -54,19 +59,28 @@
 #define CACHE_READS_IO_PRIORITY                   512
 #define CACHE_WRITES_IO_PRIORITY                  64
 
-// Garbage Colletion uses its own two IO accounts.
-// There is one low-priority account that is meant to guarantee
-// (performance-wise) unintrusive garbage collection.
-// If the garbage ratio keeps growing,
-// GC starts using the high priority account instead, which
+// Garbage Colletion uses its own IO accounts, one per priority level.
+// The low-priority account is meant to guarantee (performance-wise)
+// unintrusive garbage collection. The GC rate controller moves GC to
+// a higher priority account while foreground writes are fast, and back
+// down when their latency goes over the target. If the garbage ratio
+// keeps growing, GC doesn't drop below the medium account, which
 // might have a negative influence on database performance
 // under i/o heavy workloads but guarantees that the database
 // doesn't grow indefinitely.
 //
 // This is a one-per-serializer/file priority.
 #define GC_IO_PRIORITY_NICE                       8
+#define GC_IO_PRIORITY_MEDIUM                     CACHE_WRITES_IO_PRIORITY
 #define GC_IO_PRIORITY_HIGH                       (4 * CACHE_WRITES_IO_PRIORITY)
 
+// The foreground write latency (from submitting a data block write to its
+// completion) above which the GC rate controller lowers GC's priority.
+#define GC_FOREGROUND_WRITE_LATENCY_TARGET_MICROS 10000
+// How much weight the latest foreground write gets in the moving average of
+// foreground write latencies.
+#define GC_FOREGROUND_WRITE_LATENCY_EWMA_WEIGHT   0.05
+
 // Size of the buffer used to perform IO operations (in bytes).
 #define IO_BUFFER_SIZE                            (4 * KILOBYTE)
 
@@ -150,9 +164,22 @@
 // then the page replacement algorithm will on average be unable to evict pages from the cache.
 #define PAGE_REPL_NUM_TRIES                       10
 
+// The 2Q page replacement policy keeps newly loaded blocks in a probationary queue until they
+// are used a second time. This is the fraction of the cache that the probationary queue may
+// fill before blocks are evicted from it rather than from the protected queue.
+#define PAGE_REPL_2Q_PROBATION_FRACTION           0.25
+
+// How many blocks the 2Q page replacement policy looks at (promoting, rotating, or clearing
+// their reference bits) while choosing one victim before it gives up.
+#define PAGE_REPL_2Q_MAX_STEPS                    64
+
 // How large can the key be, in bytes?  This value needs to fit in a byte.
 #define MAX_KEY_SIZE                              250
 
+// Btree nodes with fewer keys than this are searched with a plain binary search; larger
+// ones get an in-memory key prefix index the first time they're read.
+#define KEY_PREFIX_INDEX_MIN_KEYS                 16
+
 // Any values of this size or less will be directly stored in btree leaf nodes.
 // Values greater than this size will be stored in overflow blocks. This value
 // needs to fit in a byte.
@@ -171,6 +198,15 @@
 // The number of concurrent queries when loading memcached operations from a file.
 #define MAX_CONCURRENT_QUEURIES_ON_IMPORT         1000
 
+// With work stealing on, requests and responses at least this large are parsed,
+// type-checked, and serialized inside an `on_any_thread_t`. Smaller ones aren't
+// worth the two thread hops.
+#define STEALABLE_REQUEST_MIN_SIZE                (4 * KILOBYTE)
+
+// How many requests a client connection can have running at once before we
+// stop reading more of them off the connection.
+#define MAX_IN_FLIGHT_REQUESTS_PER_CONNECTION     64
+
 // How many timestamps we store in a leaf node.  We store the
 // NUM_LEAF_NODE_EARLIER_TIMES+1 most-recent timestamps.
 #define NUM_LEAF_NODE_EARLIER_TIMES               4
@@ -218,6 +254,10 @@
 #define GC_YOUNG_EXTENT_MAX_SIZE                  50
 // What's the definition of a "young" extent in microseconds?
 #define GC_YOUNG_EXTENT_TIMELIMIT_MICROS          50000
+// How often GC recomputes the cost-benefit scores of the extents it
+// might collect. The scores depend on the extents' ages, so they are
+// computed against a snapshot of the clock that only moves this often.
+#define GC_SCORE_REFRESH_INTERVAL_MICROS          1000000
 
 // If the size of the LBA on a given disk exceeds LBA_MIN_SIZE_FOR_GC, then the fraction of the
 // entries that are live and not garbage should be at least LBA_MIN_UNGARBAGE_FRACTION.
@@ -235,6 +275,10 @@
 // doesn't return memory to the OS. If it's set too low, startup will take a longer time.
 #define LBA_READ_BUFFER_SIZE                      GIGABYTE
 
+// How many threads apply the LBA extents to the in-memory index at startup, in parallel with
+// the reads. Each shard is applied in order, so more threads than shards wouldn't help.
+#define LBA_REPLAY_THREAD_COUNT                   LBA_SHARD_FACTOR
+
 // How many different places in each file we should be writing to at once, not counting the
 // metablock or LBA
 #define MAX_ACTIVE_DATA_EXTENTS                   64
@@ -247,6 +291,50 @@
 
 #define MAX_COROS_PER_THREAD                      10000
 
+// How much memory ReQL's orderby can use for buffering rows before it starts
+// spilling sorted runs to disk.
+#define ORDERBY_MEMORY_BUDGET                     (64 * MEGABYTE)
+
+// How much memory a table scan can hold in rows, counting both the chunk it's
+// handing out and the one it's reading ahead.
+#define RGET_STREAM_MEMORY_BUDGET                 (8 * MEGABYTE)
+
+// How many rows a JavaScript mapping or filter sends to its JS worker in one
+// round-trip.
+#define JS_CALL_BATCH_SIZE                        1000
+
+// How many compiled JavaScript functions each connection's handle on a JS
+// worker process keeps around for reuse.
+#define JS_MAX_CACHED_FUNCTIONS                   1000
+
+// How many freed cJSON nodes each thread keeps around to reuse before it starts
+// giving them back to malloc.
+#define CJSON_MAX_FREE_NODES_PER_THREAD           16384
+
+// How often each memcached store's background sweep wakes up, how many keys it
+// looks at each time, and the cache priority its reads and writes get (the
+// backfill gets 10, regular queries 100).
+#define EXPIRY_SWEEP_INTERVAL_MS                  1000
+#define EXPIRY_SWEEP_KEYS_PER_STEP                1000
+#define EXPIRY_SWEEP_CACHE_PRIORITY               5
+
+// The sweep only deletes values that expired at least this many seconds ago,
+// so that a value doesn't disappear early on a machine whose clock runs fast.
+#define EXPIRY_SWEEP_GRACE_PERIOD_SECS            60
+
+// How many rows a new secondary index gets filled in with per write
+// transaction.
+#define SINDEX_FILL_ROWS_PER_STEP                 100
+
+// How many bytes of messages may pile up for an intracluster connection while
+// it's busy writing before senders have to wait for it.
+#define CLUSTER_COALESCE_MAX_BYTES                MEGABYTE
+
+// Frames on compressed intracluster connections get compressed if their
+// contents are at least this big, and at most this big (which is also the
+// biggest compressed frame we'll accept).
+#define CLUSTER_COMPRESS_MIN_BYTES                256
+#define CLUSTER_COMPRESS_MAX_BYTES                (64 * MEGABYTE)
 
 // Size of a cache line (used in cache_line_padded_t).
 #define CACHE_LINE_SIZE                           64
@@ -54,6 +54,11 @@ public:
     void remove(entry_t *);
     T pop();
     void update(int);
+    /* \brief rebuild() restores the heap order after a change that may have
+     * affected the order of every element, such as a change to what Less
+     * compares by.
+     */
+    void rebuild();
 public:
     void validate();
 
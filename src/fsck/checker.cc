@@ -896,7 +896,7 @@ private:
 };
 
 bool construct_sizer_from_magic(block_size_t bs, block_magic_t magic, scoped_ptr_t< value_sizer_t<void> > *sizer) {
-    if (magic == value_sizer_t<memcached_value_t>::leaf_magic()) {
+    if (leaf::matches_leaf_magic(magic, value_sizer_t<memcached_value_t>::leaf_magic())) {
         sizer->init(new value_sizer_t<memcached_value_t>(bs));
         return true;
     } else {
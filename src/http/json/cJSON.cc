@@ -31,8 +31,14 @@
 #include <float.h>
 #include <limits.h>
 #include <ctype.h>
+#include <stdint.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 #include "http/json/cJSON.hpp"
+#include "config/args.hpp"
 #include "errors.hpp"
+#include "thread_local.hpp"
 
 #ifdef __clang__
 #pragma clang diagnostic ignored "-Wunreachable-code"
@@ -75,10 +81,45 @@ static char* cJSON_strdup(const char* str)
 //        cJSON_free         = (hooks->free_fn)?hooks->free_fn:free;
 //}
 
+/* Nodes are all the same size and queries make and throw away a lot of them,
+   so each thread keeps the nodes it frees (linked through `next`) and hands
+   them out again instead of going back to malloc. Any thread can free a node
+   that another one allocated, since each node is its own malloc block. Under
+   valgrind we always go to malloc, so that it can still see leaks and use
+   after free. */
+TLS_with_init(cJSON *, cjson_free_nodes, NULL)
+TLS_with_init(int, cjson_num_free_nodes, 0)
+
+static cJSON *cJSON_Alloc_Node()
+{
+#ifndef VALGRIND
+        cJSON *node = TLS_get_cjson_free_nodes();
+        if (node) {
+                TLS_set_cjson_free_nodes(node->next);
+                TLS_set_cjson_num_free_nodes(TLS_get_cjson_num_free_nodes() - 1);
+                return node;
+        }
+#endif
+        return (cJSON*)cJSON_malloc(sizeof(cJSON));
+}
+
+static void cJSON_Free_Node(cJSON *node)
+{
+#ifndef VALGRIND
+        if (TLS_get_cjson_num_free_nodes() < CJSON_MAX_FREE_NODES_PER_THREAD) {
+                node->next = TLS_get_cjson_free_nodes();
+                TLS_set_cjson_free_nodes(node);
+                TLS_set_cjson_num_free_nodes(TLS_get_cjson_num_free_nodes() + 1);
+                return;
+        }
+#endif
+        cJSON_free(node);
+}
+
 /* Internal constructor. */
 static cJSON *cJSON_New_Item()
 {
-        cJSON* node = (cJSON*)cJSON_malloc(sizeof(cJSON));
+        cJSON* node = cJSON_Alloc_Node();
         if (node) memset(node,0,sizeof(cJSON));
         return node;
 }
@@ -93,7 +134,7 @@ void cJSON_Delete(cJSON *c)
                 if (!(c->type&cJSON_IsReference) && c->child) cJSON_Delete(c->child);
                 if (!(c->type&cJSON_IsReference) && c->valuestring) cJSON_free(c->valuestring);
                 if (c->string) cJSON_free(c->string);
-                cJSON_free(c);
+                cJSON_Free_Node(c);
                 c=next;
         }
 }
@@ -251,8 +292,9 @@ static char *print_object(cJSON *item,int depth,int fmt);
 /* Utility to jump whitespace and cr/lf */
 static const char *skip(const char *in) {while (in && *in && (unsigned char)*in<=32) in++; return in;}
 
-/* Parse an object - create a new root, and populate. */
-cJSON *cJSON_Parse(const char *value)
+/* Parse an object - create a new root, and populate. This is the original
+   byte-at-a-time parser; cJSON_Parse() falls back on it. */
+cJSON *cJSON_ParseBytewise(const char *value)
 {
         cJSON *c=cJSON_New_Item();
         ep=0;
@@ -262,9 +304,8 @@ cJSON *cJSON_Parse(const char *value)
         return c;
 }
 
-/* Render a cJSON item/entity/structure to text. */
-char *cJSON_Print(cJSON *item)                                {return print_value(item,0,1);}
-char *cJSON_PrintUnformatted(cJSON *item)        {return print_value(item,0,0);}
+/* The original printer, which renders each value into its own string. */
+char *cJSON_PrintBytewise(cJSON *item,int fmt)        {return print_value(item,0,fmt);}
 
 /* Parser core - when encountering text, process appropriately. */
 static const char *parse_value(cJSON *item,const char *value)
@@ -473,6 +514,476 @@ static char *print_object(cJSON *item,int depth,int fmt)
         return out;
 }
 
+/* The parser behind cJSON_Parse() works in two passes, like simdjson. The
+   first finds the "tokens" of the document 64 bytes at a time with SSE2:
+   structural characters and quotes that aren't inside strings, and the first
+   byte of each bare number/true/false/null. The second walks that list to
+   build the tree, so it never looks at whitespace or at the inside of a string
+   (apart from a memchr for backslashes) byte by byte.
+
+   It builds exactly the tree that cJSON_ParseBytewise() would: it uses the
+   same number and escape parsing, and whenever the document is anything but
+   plain well-formed JSON it gives up and lets cJSON_ParseBytewise() have it,
+   which also sets the error pointer the same way. */
+
+struct json_block_masks_t {
+        uint64_t quote, backslash, op, space;
+};
+
+/* Finds the interesting bytes of the 64 at `block`; bit i is byte i. */
+static void classify_json_block(const char *block, json_block_masks_t *m)
+{
+#ifdef __SSE2__
+        const __m128i quote = _mm_set1_epi8('"'), backslash = _mm_set1_epi8('\\');
+        const __m128i lbrace = _mm_set1_epi8('{'), rbrace = _mm_set1_epi8('}');
+        const __m128i lbracket = _mm_set1_epi8('['), rbracket = _mm_set1_epi8(']');
+        const __m128i colon = _mm_set1_epi8(':'), comma = _mm_set1_epi8(',');
+        const __m128i space = _mm_set1_epi8(32);
+        m->quote = m->backslash = m->op = m->space = 0;
+        for (int i = 0; i < 4; ++i) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + 16 * i));
+                __m128i op = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, lbrace), _mm_cmpeq_epi8(v, rbrace)),
+                                                       _mm_or_si128(_mm_cmpeq_epi8(v, lbracket), _mm_cmpeq_epi8(v, rbracket))),
+                                          _mm_or_si128(_mm_cmpeq_epi8(v, colon), _mm_cmpeq_epi8(v, comma)));
+                /* skip() treats every byte up to 32 as whitespace; max_epu8 makes that an unsigned compare. */
+                __m128i white = _mm_cmpeq_epi8(_mm_max_epu8(v, space), space);
+                m->quote |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, quote)))) << (16 * i);
+                m->backslash |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, backslash)))) << (16 * i);
+                m->op |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(op))) << (16 * i);
+                m->space |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(white))) << (16 * i);
+        }
+#else
+        m->quote = m->backslash = m->op = m->space = 0;
+        for (int i = 0; i < 64; ++i) {
+                unsigned char c = block[i];
+                uint64_t bit = static_cast<uint64_t>(1) << i;
+                if (c == '"') m->quote |= bit;
+                else if (c == '\\') m->backslash |= bit;
+                else if (c == '{' || c == '}' || c == '[' || c == ']' || c == ':' || c == ',') m->op |= bit;
+                else if (c <= 32) m->space |= bit;
+        }
+#endif
+}
+
+/* The bytes that follow an odd number of backslashes, i.e. the escaped ones.
+   `prev_odd` carries a trailing odd run over into the next block. */
+static uint64_t find_escaped_bytes(uint64_t backslash, uint64_t *prev_odd)
+{
+        const uint64_t even_bits = 0x5555555555555555ULL;
+        const uint64_t odd_bits = ~even_bits;
+        uint64_t start_edges = backslash & ~(backslash << 1);
+        uint64_t even_start_mask = even_bits ^ *prev_odd;
+        uint64_t even_starts = start_edges & even_start_mask;
+        uint64_t odd_starts = start_edges & ~even_start_mask;
+        uint64_t even_carries = backslash + even_starts;
+        uint64_t odd_carries = backslash + odd_starts;
+        bool ends_odd = odd_carries < backslash;
+        odd_carries |= *prev_odd;
+        *prev_odd = ends_odd ? 1 : 0;
+        uint64_t even_carry_ends = even_carries & ~backslash;
+        uint64_t odd_carry_ends = odd_carries & ~backslash;
+        return (even_carry_ends & odd_bits) | (odd_carry_ends & even_bits);
+}
+
+/* Bit i is the parity of bits 0 through i. */
+static uint64_t prefix_xor(uint64_t x)
+{
+        x ^= x << 1; x ^= x << 2; x ^= x << 4;
+        x ^= x << 8; x ^= x << 16; x ^= x << 32;
+        return x;
+}
+
+/* Writes the offsets of the tokens of the `len` bytes at `buf` to `out`,
+   which must have room for `len + CJSON_TOKEN_SLACK` of them, and returns how
+   many there are. */
+#define CJSON_TOKEN_SLACK 8
+
+static size_t index_json_tokens(const char *buf, size_t len, uint32_t *out)
+{
+        uint64_t prev_odd = 0, prev_in_string = 0, prev_scalar = 0;
+        size_t count = 0;
+        for (size_t base = 0; base < len; base += 64) {
+                char tail[64];
+                const char *block = buf + base;
+                if (len - base < 64) {
+                        /* Pad the last block with whitespace rather than read past the end. */
+                        memset(tail, ' ', sizeof(tail));
+                        memcpy(tail, block, len - base);
+                        block = tail;
+                }
+                json_block_masks_t m;
+                classify_json_block(block, &m);
+
+                uint64_t quote = m.quote & ~find_escaped_bytes(m.backslash, &prev_odd);
+                /* Set from each opening quote up to (not including) its closing quote. */
+                uint64_t in_string = prefix_xor(quote) ^ prev_in_string;
+                prev_in_string = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+
+                uint64_t scalar = ~(m.op | m.space | quote) & ~in_string;
+                uint64_t scalar_start = scalar & ~((scalar << 1) | prev_scalar);
+                prev_scalar = scalar >> 63;
+
+                uint64_t tokens = (m.op & ~in_string) | quote | scalar_start;
+                /* Eight at a time with no branches in between, like simdjson;
+                   the ones past the real count get overwritten by the next
+                   block or ignored. */
+                uint32_t *ptr = out + count;
+                count += __builtin_popcountll(tokens);
+                while (tokens) {
+                        for (int i = 0; i < 8; ++i) {
+                                *ptr++ = base + __builtin_ctzll(tokens | (static_cast<uint64_t>(1) << 63));
+                                tokens &= tokens - 1;
+                        }
+                }
+        }
+        return count;
+}
+
+struct json_token_parser_t {
+        const char *buf;
+        const uint32_t *tokens;
+        size_t count, next;
+
+        bool done() const { return next == count; }
+        const char *peek() const { return buf + tokens[next]; }
+        const char *take() { return buf + tokens[next++]; }
+};
+
+static bool parse_value_indexed(cJSON *item,json_token_parser_t *p);
+
+/* Most numbers are plain integers, for which parse_number()'s pow() call
+   multiplies by exactly 1; this gets the same double without it. */
+static const char *parse_number_indexed(cJSON *item,const char *num)
+{
+        const char *ptr=num;
+        double n=0,sign=1;
+        if (*ptr=='-') sign=-1,ptr++;
+        if (*ptr=='0') ptr++;
+        if (*ptr>='1' && *ptr<='9') do n=(n*10.0)+(*ptr++ -'0'); while (*ptr>='0' && *ptr<='9');
+        if (*ptr=='.' || *ptr=='e' || *ptr=='E') return parse_number(item,num);
+
+        n=sign*n;
+        item->valuedouble=n;
+        item->valueint=(int)n;
+        item->type=cJSON_Number;
+        return ptr;
+}
+
+/* Reads the four hex digits at `hex`, which parse_string() reads with
+   sscanf("%4x"). Anything else (which sscanf would read differently, or which
+   runs into the closing quote) is left to parse_string() itself. */
+static bool parse_hex4(const char *hex,const char *close,unsigned *out)
+{
+        if (close-hex<4) return false;
+        unsigned value=0;
+        for (int i=0;i<4;i++)
+        {
+                char c=hex[i];
+                value<<=4;
+                if (c>='0' && c<='9') value|=c-'0';
+                else if (c>='a' && c<='f') value|=c-'a'+10;
+                else if (c>='A' && c<='F') value|=c-'A'+10;
+                else return false;
+        }
+        *out=value;
+        return true;
+}
+
+/* Writes `uc` as UTF-8 the way parse_string() does, and returns the end. */
+static char *encode_utf8(unsigned uc,char *ptr2)
+{
+        int len=4;if (uc<0x80) len=1;else if (uc<0x800) len=2;else if (uc<0x10000) len=3;
+        ptr2+=len;
+        switch (len) {
+                case 4: *--ptr2 =((uc | 0x80) & 0xBF); uc >>= 6;
+                case 3: *--ptr2 =((uc | 0x80) & 0xBF); uc >>= 6;
+                case 2: *--ptr2 =((uc | 0x80) & 0xBF); uc >>= 6;
+                case 1: *--ptr2 =(uc | firstByteMark[len]); break;
+                default: unreachable();
+        }
+        return ptr2+len;
+}
+
+/* `open` is the opening quote, and its closing quote is the next token. */
+static bool parse_string_indexed(cJSON *item,json_token_parser_t *p,const char *open)
+{
+        if (p->done()) return false;
+        const char *close=p->take();
+        if (*close!='\"') return false;
+        size_t len=close-open-1;
+        /* Escapes only ever make the string shorter. */
+        char *out=(char*)cJSON_malloc(len+1);
+        if (!out) return false;
+        item->valuestring=out;
+        item->type=cJSON_String;
+
+        const char *ptr=open+1;
+        char *ptr2=out;
+        for (;;)
+        {
+                const char *backslash=(const char*)memchr(ptr,'\\',close-ptr);
+                const char *run_end=backslash ? backslash : close;
+                memcpy(ptr2,ptr,run_end-ptr);ptr2+=run_end-ptr;
+                if (!backslash) break;
+                ptr=backslash+1;
+                switch (*ptr)
+                {
+                        case 'b': *ptr2++='\b';        break;
+                        case 'f': *ptr2++='\f';        break;
+                        case 'n': *ptr2++='\n';        break;
+                        case 'r': *ptr2++='\r';        break;
+                        case 't': *ptr2++='\t';        break;
+                        case 'u': {
+                                unsigned uc,uc2;
+                                if (!parse_hex4(ptr+1,close,&uc)) return false;
+                                ptr+=4;
+                                if ((uc>=0xDC00 && uc<=0xDFFF) || uc==0)        break;
+                                if (uc>=0xD800 && uc<=0xDBFF)
+                                {
+                                        if (ptr+2>=close || ptr[1]!='\\' || ptr[2]!='u')        break;
+                                        if (!parse_hex4(ptr+3,close,&uc2)) return false;
+                                        ptr+=6;
+                                        if (uc2<0xDC00 || uc2>0xDFFF)        break;
+                                        uc=0x10000 | ((uc&0x3FF)<<10) | (uc2&0x3FF);
+                                }
+                                ptr2=encode_utf8(uc,ptr2);
+                        } break;
+                        default: *ptr2++=*ptr; break;
+                }
+                ptr++;
+        }
+        *ptr2=0;
+        return true;
+}
+
+static bool parse_array_indexed(cJSON *item,json_token_parser_t *p)
+{
+        item->type=cJSON_Array;
+        if (p->done()) return false;
+        if (*p->peek()==']') {p->next++;return true;}        /* empty array. */
+
+        cJSON *child=0;
+        for (;;)
+        {
+                cJSON *new_item=cJSON_New_Item();
+                if (!new_item) return false;
+                if (child) {child->next=new_item;new_item->prev=child;} else item->child=new_item;
+                child=new_item;
+                if (!parse_value_indexed(child,p) || p->done()) return false;
+                char c=*p->take();
+                if (c==']') return true;
+                if (c!=',') return false;
+        }
+}
+
+static bool parse_object_indexed(cJSON *item,json_token_parser_t *p)
+{
+        item->type=cJSON_Object;
+        if (p->done()) return false;
+        if (*p->peek()=='}') {p->next++;return true;}        /* empty object. */
+
+        cJSON *child=0;
+        for (;;)
+        {
+                cJSON *new_item=cJSON_New_Item();
+                if (!new_item) return false;
+                if (child) {child->next=new_item;new_item->prev=child;} else item->child=new_item;
+                child=new_item;
+                if (p->done()) return false;
+                const char *key=p->take();
+                if (*key!='\"' || !parse_string_indexed(child,p,key)) return false;
+                child->string=child->valuestring;child->valuestring=0;
+                if (p->done() || *p->take()!=':') return false;
+                if (!parse_value_indexed(child,p) || p->done()) return false;
+                char c=*p->take();
+                if (c=='}') return true;
+                if (c!=',') return false;
+        }
+}
+
+static bool parse_value_indexed(cJSON *item,json_token_parser_t *p)
+{
+        if (p->done()) return false;
+        const char *value=p->take(),*end;
+        switch (*value)
+        {
+                case '\"': return parse_string_indexed(item,p,value);
+                case '[': return parse_array_indexed(item,p);
+                case '{': return parse_object_indexed(item,p);
+                default: break;
+        }
+        if (!strncmp(value,"null",4))        { item->type=cJSON_NULL; end=value+4; }
+        else if (!strncmp(value,"false",5))        { item->type=cJSON_False; end=value+5; }
+        else if (!strncmp(value,"true",4))        { item->type=cJSON_True; item->valueint=1; end=value+4; }
+        else if (*value=='-' || (*value>='0' && *value<='9'))        { end=parse_number_indexed(item,value); }
+        else return false;
+
+        /* Whatever follows the value has to be the next token, or the byte
+           parser would have choked on it (e.g. "truex" or "1.2.3"). */
+        end=skip(end);
+        return p->done() ? *end==0 : end==p->peek();
+}
+
+/* Documents with up to this many tokens are indexed on the stack. */
+#define CJSON_STACK_TOKENS 256
+
+cJSON *cJSON_Parse(const char *value)
+{
+        if (!value) return cJSON_ParseBytewise(value);
+        size_t len=strlen(value);
+        /* Indexing costs more than it saves on a document that's smaller than
+           one block, and offsets are 32 bits. */
+        if (len<64 || len>UINT32_MAX) return cJSON_ParseBytewise(value);
+
+        uint32_t stack_tokens[CJSON_STACK_TOKENS+CJSON_TOKEN_SLACK];
+        uint32_t *tokens=len<=CJSON_STACK_TOKENS ? stack_tokens : (uint32_t*)malloc((len+CJSON_TOKEN_SLACK)*sizeof(uint32_t));
+        if (!tokens) return cJSON_ParseBytewise(value);
+
+        json_token_parser_t p;
+        p.buf=value;p.tokens=tokens;p.next=0;
+        p.count=index_json_tokens(value,len,tokens);
+
+        ep=0;
+        cJSON *c=cJSON_New_Item();
+        bool ok=c && parse_value_indexed(c,&p);
+        if (tokens!=stack_tokens) free(tokens);
+        if (ok) return c;
+
+        if (c) cJSON_Delete(c);
+        return cJSON_ParseBytewise(value);
+}
+
+/* The printer behind cJSON_Print() renders the whole tree into one growing
+   buffer, instead of rendering each value into its own string and copying
+   those into their parents' strings. Its output is the same as
+   cJSON_PrintBytewise()'s. */
+
+struct json_print_buffer_t {
+        char *data;
+        size_t size, capacity;
+        bool failed;
+
+        bool reserve(size_t more) {
+                if (size+more<=capacity) return true;
+                size_t new_capacity=capacity*2;
+                if (new_capacity<size+more) new_capacity=size+more;
+                char *new_data=(char*)realloc(data,new_capacity);
+                if (!new_data) {failed=true;return false;}
+                data=new_data;capacity=new_capacity;
+                return true;
+        }
+        void append(const char *s,size_t n) {if (reserve(n)) {memcpy(data+size,s,n);size+=n;}}
+        void push(char c) {if (reserve(1)) data[size++]=c;}
+        void repeat(char c,int n) {if (n>0 && reserve(n)) {memset(data+size,c,n);size+=n;}}
+};
+
+static void print_number_buffered(const cJSON *item,json_print_buffer_t *out)
+{
+        double d=item->valuedouble;
+        guarantee(isfinite(d));
+        char digits[64];
+        if (fabs(((double)item->valueint)-d)<=DBL_EPSILON && d<=INT_MAX && d>=INT_MIN)
+        {
+                /* The same as "%d", without going through printf. */
+                int64_t v=item->valueint;
+                bool negative=v<0;
+                if (negative) v=-v;
+                char *end=digits+sizeof(digits),*ptr=end;
+                do {*--ptr='0'+v%10;v/=10;} while (v);
+                if (negative) *--ptr='-';
+                out->append(ptr,end-ptr);
+        }
+        else
+        {
+                int n=snprintf(digits,sizeof(digits),"%.32g",d);
+                out->append(digits,n);
+        }
+}
+
+static void print_string_buffered(const char *str,json_print_buffer_t *out)
+{
+        if (!str) return;
+        out->push('\"');
+        const char *run=str;
+        for (const char *ptr=str;*ptr;ptr++)
+        {
+                unsigned char token=*ptr;
+                if (token>31 && token!='\"' && token!='\\') continue;
+                out->append(run,ptr-run);
+                run=ptr+1;
+                switch (token)
+                {
+                        case '\\':        out->append("\\\\",2);        break;
+                        case '\"':        out->append("\\\"",2);        break;
+                        case '\b':        out->append("\\b",2);        break;
+                        case '\f':        out->append("\\f",2);        break;
+                        case '\n':        out->append("\\n",2);        break;
+                        case '\r':        out->append("\\r",2);        break;
+                        case '\t':        out->append("\\t",2);        break;
+                        default: {
+                                char escape[8];
+                                snprintf(escape,sizeof(escape),"\\u%04x",token);
+                                out->append(escape,6);
+                        } break;
+                }
+        }
+        out->append(run,strlen(run));
+        out->push('\"');
+}
+
+static bool print_value_buffered(const cJSON *item,int depth,int fmt,json_print_buffer_t *out)
+{
+        switch ((item->type)&255)
+        {
+                case cJSON_NULL:        out->append("null",4);        return true;
+                case cJSON_False:        out->append("false",5);        return true;
+                case cJSON_True:        out->append("true",4);        return true;
+                case cJSON_Number:        print_number_buffered(item,out);        return true;
+                case cJSON_String:        print_string_buffered(item->valuestring,out);        return true;
+                case cJSON_Array:
+                        out->push('[');
+                        for (const cJSON *child=item->child;child;child=child->next)
+                        {
+                                if (!print_value_buffered(child,depth+1,fmt,out)) return false;
+                                if (child->next) {out->push(',');if (fmt) out->push(' ');}
+                        }
+                        out->push(']');
+                        return true;
+                case cJSON_Object:
+                        depth++;
+                        out->push('{');if (fmt) out->push('\n');
+                        for (const cJSON *child=item->child;child;child=child->next)
+                        {
+                                if (fmt) out->repeat('\t',depth);
+                                print_string_buffered(child->string,out);
+                                out->push(':');if (fmt) out->push('\t');
+                                if (!print_value_buffered(child,depth,fmt,out)) return false;
+                                if (child->next) out->push(',');
+                                if (fmt) out->push('\n');
+                        }
+                        if (fmt) out->repeat('\t',depth-1);
+                        out->push('}');
+                        return true;
+                default: return false;
+        }
+}
+
+static char *print_buffered(cJSON *item,int fmt)
+{
+        if (!item) return 0;
+        json_print_buffer_t out;
+        out.data=0;out.size=0;out.capacity=0;out.failed=false;
+        out.reserve(256);
+        if (!print_value_buffered(item,0,fmt,&out) || out.failed) {free(out.data);return 0;}
+        out.push(0);
+        if (out.failed) {free(out.data);return 0;}
+        return out.data;
+}
+
+/* Render a cJSON item/entity/structure to text. */
+char *cJSON_Print(cJSON *item)                                {return print_buffered(item,1);}
+char *cJSON_PrintUnformatted(cJSON *item)        {return print_buffered(item,0);}
+
 /* Get Array size/item / object item. */
 int    cJSON_GetArraySize(const cJSON *array)                                        {cJSON *c=array->child;int i=0;while(c)i++,c=c->next;return i;}
 cJSON *cJSON_GetArrayItem(cJSON *array,int item)                                {cJSON *c=array->child;  while (c && item>0) item--,c=c->next; return c;}
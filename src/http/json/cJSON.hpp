@@ -69,6 +69,11 @@ extern cJSON *cJSON_Parse(const char *value);
 extern char  *cJSON_Print(cJSON *item);
 /* Render a cJSON entity to text for transfer/storage without any formatting. Free the char* when finished. */
 extern char  *cJSON_PrintUnformatted(cJSON *item);
+/* The original parser and printer, which go a byte (and a malloc) at a time.
+   They give the same results as cJSON_Parse() and cJSON_Print(); they're
+   kept as the fallback for unusual input and to test and benchmark against. */
+extern cJSON *cJSON_ParseBytewise(const char *value);
+extern char  *cJSON_PrintBytewise(cJSON *item,int fmt);
 /* Delete a cJSON entity and all subentities. */
 extern void   cJSON_Delete(cJSON *c);
 
@@ -28,3 +28,29 @@ get_result_t memcached_get(const store_key_t &store_key, btree_slice_t *slice, e
     return get_result_t(dp, value->mcflags(), 0);
 }
 
+class multi_get_callback_t : public multi_keyvalue_read_callback_t<memcached_value_t> {
+public:
+    multi_get_callback_t(const std::vector<store_key_t> *_keys, exptime_t _effective_time, transaction_t *_txn, multi_get_result_t *_result)
+        : keys(_keys), effective_time(_effective_time), txn(_txn), result(_result) { }
+
+    void on_keyvalue(size_t key_index, const memcached_value_t *value) {
+        rassert(key_index == result->results.size());
+        result->results.push_back(std::make_pair((*keys)[key_index], get_result_t()));
+
+        if (value && !value->expired(effective_time)) {
+            result->results.back().second = get_result_t(value_to_data_buffer(value, txn), value->mcflags(), 0);
+        }
+    }
+
+private:
+    const std::vector<store_key_t> *keys;
+    exptime_t effective_time;
+    transaction_t *txn;
+    multi_get_result_t *result;
+};
+
+void memcached_multi_get(const std::vector<store_key_t> &keys, btree_slice_t *slice, exptime_t effective_time, transaction_t *txn, superblock_t *superblock, multi_get_result_t *result_out) {
+    result_out->results.reserve(keys.size());
+    multi_get_callback_t callback(&keys, effective_time, txn, result_out);
+    find_keyvalue_locations_for_read(txn, superblock, keys, &callback, slice->root_eviction_priority, &slice->stats);
+}
@@ -10,4 +10,7 @@ class superblock_t;
 
 get_result_t memcached_get(const store_key_t &key, btree_slice_t *slice, exptime_t effective_time, transaction_t *txn, superblock_t *superblock);
 
+// `keys` must be sorted.
+void memcached_multi_get(const std::vector<store_key_t> &keys, btree_slice_t *slice, exptime_t effective_time, transaction_t *txn, superblock_t *superblock, multi_get_result_t *result_out);
+
 #endif // MEMCACHED_MEMCACHED_BTREE_GET_HPP_
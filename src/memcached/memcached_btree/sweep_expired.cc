@@ -0,0 +1,69 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#include "memcached/memcached_btree/sweep_expired.hpp"
+
+#include "btree/depth_first_traversal.hpp"
+#include "btree/operations.hpp"
+#include "buffer_cache/blob.hpp"
+#include "memcached/memcached_btree/node.hpp"
+#include "memcached/memcached_btree/value.hpp"
+
+class find_expired_keys_callback_t : public depth_first_traversal_callback_t {
+public:
+    find_expired_keys_callback_t(int _max_keys, exptime_t _effective_time, std::vector<store_key_t> *_expired_out)
+        : max_keys(_max_keys), effective_time(_effective_time), expired_out(_expired_out), keys_seen(0) { }
+
+    bool handle_pair(const btree_key_t *key, const void *value) {
+        if (static_cast<const memcached_value_t *>(value)->expired(effective_time)) {
+            expired_out->push_back(store_key_t(key));
+        }
+        ++keys_seen;
+        if (keys_seen == max_keys) {
+            last_key.assign(key);
+            return false;
+        }
+        return true;
+    }
+
+    const int max_keys;
+    const exptime_t effective_time;
+    std::vector<store_key_t> *const expired_out;
+    int keys_seen;
+    store_key_t last_key;
+};
+
+bool memcached_find_expired_keys(btree_slice_t *slice, store_key_t *start, int max_keys, exptime_t effective_time,
+                                 transaction_t *txn, superblock_t *superblock, std::vector<store_key_t> *expired_out) {
+    rassert(max_keys > 0);
+    find_expired_keys_callback_t callback(max_keys, effective_time, expired_out);
+    key_range_t range(key_range_t::closed, *start, key_range_t::none, store_key_t());
+    if (!btree_depth_first_traversal(slice, txn, superblock, range, &callback)) {
+        *start = callback.last_key;
+        if (start->increment()) {
+            return false;
+        }
+    }
+    *start = store_key_t::min();
+    return true;
+}
+
+bool memcached_delete_if_expired(const store_key_t &key, btree_slice_t *slice, exptime_t effective_time,
+                                 transaction_t *txn, superblock_t *superblock) {
+    keyvalue_location_t<memcached_value_t> kv_location;
+    find_keyvalue_location_for_write(txn, superblock, key.btree_key(), &kv_location, &slice->root_eviction_priority, &slice->stats);
+
+    if (!kv_location.value.has() || !kv_location.value->expired(effective_time)) {
+        return false;
+    }
+
+    {
+        blob_t blob(kv_location.value->value_ref(), blob::btree_maxreflen);
+        slice->stats.pm_bytes_reclaimed += key.size() + blob.valuesize();
+        blob.clear(txn);
+    }
+    kv_location.value.reset();
+
+    null_key_modification_callback_t<memcached_value_t> null_cb;
+    apply_keyvalue_change(txn, &kv_location, key.btree_key(), kv_location.buf.get_recency(), false, &null_cb, &slice->root_eviction_priority);
+    ++slice->stats.pm_keys_reclaimed;
+    return true;
+}
@@ -0,0 +1,31 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#ifndef MEMCACHED_MEMCACHED_BTREE_SWEEP_EXPIRED_HPP_
+#define MEMCACHED_MEMCACHED_BTREE_SWEEP_EXPIRED_HPP_
+
+#include <vector>
+
+#include "btree/keys.hpp"
+#include "btree/slice.hpp"
+#include "memcached/queries.hpp"
+
+class superblock_t;
+
+/* Looks at up to `max_keys` keys, starting with `*start`, and appends the ones
+whose values had expired by `effective_time` to `expired_out`. Sets `*start` to
+where the next call should pick up. Returns true if it got to the end of the
+btree, in which case `*start` goes back to the beginning. */
+bool memcached_find_expired_keys(btree_slice_t *slice, store_key_t *start, int max_keys, exptime_t effective_time,
+                                 transaction_t *txn, superblock_t *superblock, std::vector<store_key_t> *expired_out);
+
+/* Deletes `key` if its value had expired by `effective_time`, counting it and
+its bytes in the slice's reclaimed stats. Returns false if the key is gone or
+has been set again since it was found to be expired.
+
+Unlike the lazy expiration in `run_memcached_modify_oper()`, which erases the
+key without a trace, this leaves a deletion entry behind so that backfills pass
+the deletion on. The entry gets the leaf's recency as its timestamp: no newer
+than the store's current timestamp, and no older than the expired value's. */
+bool memcached_delete_if_expired(const store_key_t &key, btree_slice_t *slice, exptime_t effective_time,
+                                 transaction_t *txn, superblock_t *superblock);
+
+#endif  // MEMCACHED_MEMCACHED_BTREE_SWEEP_EXPIRED_HPP_
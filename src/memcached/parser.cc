@@ -9,6 +9,7 @@
 #include <stdarg.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <set>
 #include <stdexcept>
 #include <vector>
@@ -302,6 +303,46 @@ void do_one_get(txt_memcached_handler_t *rh, bool with_cas, get_t *gets, int i,
     }
 }
 
+class key_with_get_result_less_t {
+public:
+    bool operator()(const std::pair<store_key_t, get_result_t> &x, const store_key_t &y) {
+        return x.first < y;
+    }
+};
+
+/* Fetches all of the keys with a single read, which walks down the btree once
+rather than once per key. */
+void do_multi_get(txt_memcached_handler_t *rh, std::vector<get_t> *gets, order_token_t token) {
+    std::vector<store_key_t> keys;
+    keys.reserve(gets->size());
+    for (size_t i = 0; i < gets->size(); ++i) {
+        keys.push_back((*gets)[i].key);
+    }
+
+    try {
+        multi_get_query_t multi_get_query(keys);
+        memcached_protocol_t::read_t read(multi_get_query, time(NULL));
+        memcached_protocol_t::read_response_t response;
+        rh->nsi->read(read, &response, token, rh->interruptor);
+        const multi_get_result_t &result = boost::get<multi_get_result_t>(response.result);
+
+        for (size_t i = 0; i < gets->size(); ++i) {
+            std::vector<std::pair<store_key_t, get_result_t> >::const_iterator it =
+                std::lower_bound(result.results.begin(), result.results.end(), (*gets)[i].key, key_with_get_result_less_t());
+            guarantee(it != result.results.end() && it->first == (*gets)[i].key);
+            (*gets)[i].res = it->second;
+            (*gets)[i].ok = true;
+        }
+    } catch (cannot_perform_query_exc_t e) {
+        for (size_t i = 0; i < gets->size(); ++i) {
+            (*gets)[i].error_message = e.what();
+            (*gets)[i].ok = false;
+        }
+    } catch (interrupted_exc_t) {
+        /* do nothing */
+    }
+}
+
 void do_get(txt_memcached_handler_t *rh, pipeliner_t *pipeliner, bool with_cas, int argc, char **argv, order_token_t token) {
     // We should already be spawned within a coroutine.
     pipeliner_acq_t pipeliner_acq(pipeliner);
@@ -337,8 +378,13 @@ void do_get(txt_memcached_handler_t *rh, pipeliner_t *pipeliner, bool with_cas,
 
     block_pm_duration get_timer(&rh->stats->pm_cmd_get);
 
-    /* Now that we're sure they're all valid, send off the requests */
-    pmap(gets.size(), boost::bind(&do_one_get, rh, with_cas, gets.data(), _1, token));
+    /* Now that we're sure they're all valid, send off the requests. "gets" has to
+    generate a CAS for every key, which is a write, so it still goes key by key. */
+    if (with_cas || gets.size() == 1) {
+        pmap(gets.size(), boost::bind(&do_one_get, rh, with_cas, gets.data(), _1, token));
+    } else {
+        do_multi_get(rh, &gets, token);
+    }
 
     if (rh->interruptor->is_pulsed()) {
         pipeliner_acq.begin_write();
@@ -5,11 +5,14 @@
 #include <boost/variant.hpp>
 #include <boost/bind.hpp>
 
+#include "arch/runtime/coroutines.hpp"
+#include "arch/timing.hpp"
 #include "btree/operations.hpp"
 #include "btree/parallel_traversal.hpp"
 #include "btree/slice.hpp"
 #include "btree/superblock.hpp"
 #include "concurrency/access.hpp"
+#include "config/args.hpp"
 #include "concurrency/pmap.hpp"
 #include "concurrency/wait_any.hpp"
 #include "containers/archive/boost_types.hpp"
@@ -24,6 +27,7 @@
 #include "memcached/memcached_btree/incr_decr.hpp"
 #include "memcached/memcached_btree/rget.hpp"
 #include "memcached/memcached_btree/set.hpp"
+#include "memcached/memcached_btree/sweep_expired.hpp"
 #include "memcached/queries.hpp"
 #include "stl_utils.hpp"
 #include "serializer/config.hpp"
@@ -77,9 +81,11 @@ archive_result_t deserialize(read_stream_t *s, intrusive_ptr_t<data_buffer_t> *b
 }
 
 RDB_IMPL_SERIALIZABLE_1(get_query_t, key);
+RDB_IMPL_SERIALIZABLE_1(multi_get_query_t, keys);
 RDB_IMPL_SERIALIZABLE_2(rget_query_t, region, maximum);
 RDB_IMPL_SERIALIZABLE_3(distribution_get_query_t, max_depth, result_limit, region);
 RDB_IMPL_SERIALIZABLE_3(get_result_t, value, flags, cas);
+RDB_IMPL_SERIALIZABLE_1(multi_get_result_t, results);
 RDB_IMPL_SERIALIZABLE_3(key_with_data_buffer_t, key, mcflags, value_provider);
 RDB_IMPL_SERIALIZABLE_2(rget_result_t, pairs, truncated);
 RDB_IMPL_SERIALIZABLE_2(distribution_result_t, region, key_counts);
@@ -107,6 +113,11 @@ region_t monokey_region(const store_key_t &k) {
     return region_t(h, h + 1, key_range_t(key_range_t::closed, k, key_range_t::closed, k));
 }
 
+multi_get_query_t::multi_get_query_t(const std::vector<store_key_t> &_keys) : keys(_keys) {
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+}
+
 /* `read_t::get_region()` */
 
 /* Wrap all our local types in anonymous namespaces so the linker doesn't
@@ -123,6 +134,14 @@ struct read_get_region_visitor_t : public boost::static_visitor<region_t> {
     region_t operator()(distribution_get_query_t dst_get) {
         return dst_get.region;
     }
+    region_t operator()(const multi_get_query_t &multi_get) {
+        // The keys are sorted, so this covers all of them.
+        if (multi_get.keys.empty()) {
+            // A shard of a multi-key read can end up with none of the keys.
+            return region_t::empty();
+        }
+        return region_t(key_range_t(key_range_t::closed, multi_get.keys.front(), key_range_t::closed, multi_get.keys.back()));
+    }
 };
 
 }   /* anonymous namespace */
@@ -157,6 +176,15 @@ struct read_shard_visitor_t : public boost::static_visitor<read_t> {
         distribution_get.region = region;
         return read_t(distribution_get, effective_time);
     }
+    read_t operator()(const multi_get_query_t &multi_get) {
+        multi_get_query_t sharded;
+        for (std::vector<store_key_t>::const_iterator it = multi_get.keys.begin(); it != multi_get.keys.end(); ++it) {
+            if (region_is_superset(region, monokey_region(*it))) {
+                sharded.keys.push_back(*it);
+            }
+        }
+        return read_t(sharded, effective_time);
+    }
 };
 
 }   /* anonymous namespace */
@@ -181,6 +209,13 @@ public:
     }
 };
 
+class key_with_get_result_less_t {
+public:
+    bool operator()(const std::pair<store_key_t, get_result_t> &x, const std::pair<store_key_t, get_result_t> &y) {
+        return x.first < y.first;
+    }
+};
+
 class distribution_result_less_t {
 public:
     bool operator()(const distribution_result_t& x, const distribution_result_t& y) {
@@ -242,6 +277,21 @@ struct read_unshard_visitor_t : public boost::static_visitor<read_response_t> {
         return read_response_t(result);
     }
 
+    read_response_t operator()(DEBUG_VAR const multi_get_query_t &multi_get) {
+        multi_get_result_t result;
+        for (size_t i = 0; i < count; ++i) {
+            const multi_get_result_t *bit = boost::get<multi_get_result_t>(&bits[i].result);
+            guarantee(bit);
+            result.results.insert(result.results.end(), bit->results.begin(), bit->results.end());
+        }
+
+        // Each key went to exactly one shard, so we just need to put them back in order.
+        std::sort(result.results.begin(), result.results.end(), key_with_get_result_less_t());
+        rassert(result.results.size() == multi_get.keys.size());
+
+        return read_response_t(result);
+    }
+
     read_response_t operator()(distribution_get_query_t dget) {
         // TODO: do this without copying so much and/or without dynamic memory
         // Sort results by region
@@ -443,12 +493,58 @@ store_t::store_t(serializer_t *serializer,
                  bool create,
                  perfmon_collection_t *parent_perfmon_collection,
                  context_t *ctx) :
-    btree_store_t<memcached_protocol_t>(serializer, perfmon_name, cache_size, create, parent_perfmon_collection, ctx) { }
+    btree_store_t<memcached_protocol_t>(serializer, perfmon_name, cache_size, create, parent_perfmon_collection, ctx),
+    sweep_cursor(store_key_t::min()) {
+    get_btree()->cache()->create_cache_account(EXPIRY_SWEEP_CACHE_PRIORITY, &sweep_account);
+    coro_t::spawn_sometime(boost::bind(&store_t::sweep_expired_values, this, auto_drainer_t::lock_t(&drainer)));
+}
 
 store_t::~store_t() {
     assert_thread();
 }
 
+void store_t::sweep_expired_values(auto_drainer_t::lock_t keepalive) {
+    try {
+        for (;;) {
+            nap(EXPIRY_SWEEP_INTERVAL_MS, keepalive.get_drain_signal());
+            sweep_expired_values_step(keepalive.get_drain_signal());
+        }
+    } catch (const interrupted_exc_t &) {
+        // The store is being destroyed.
+    }
+}
+
+void store_t::sweep_expired_values_step(signal_t *interruptor) THROWS_ONLY(interrupted_exc_t) {
+    assert_thread();
+
+    const exptime_t effective_time = time(NULL) - EXPIRY_SWEEP_GRACE_PERIOD_SECS;
+    std::vector<store_key_t> expired_keys;
+    {
+        object_buffer_t<fifo_enforcer_sink_t::exit_read_t> token;
+        new_read_token(&token);
+        scoped_ptr_t<transaction_t> txn;
+        scoped_ptr_t<real_superblock_t> superblock;
+        acquire_superblock_for_read(rwi_read, &token, &txn, &superblock, interruptor, false);
+        txn->set_account(sweep_account.get());
+        memcached_find_expired_keys(get_btree(), &sweep_cursor, EXPIRY_SWEEP_KEYS_PER_STEP, effective_time,
+                                    txn.get(), superblock.get(), &expired_keys);
+    }
+
+    /* Each key gets a write transaction of its own, so that the sweep never
+    holds up queries for long. Passing `repli_timestamp_t::invalid` leaves the
+    recency of the blocks alone; the deletion entries get their timestamps from
+    the leaves. */
+    for (std::vector<store_key_t>::iterator it = expired_keys.begin(); it != expired_keys.end(); ++it) {
+        object_buffer_t<fifo_enforcer_sink_t::exit_write_t> token;
+        new_write_token(&token);
+        scoped_ptr_t<transaction_t> txn;
+        scoped_ptr_t<real_superblock_t> superblock;
+        acquire_superblock_for_write(rwi_write, repli_timestamp_t::invalid, 1, &token, &txn, &superblock, interruptor);
+        txn->set_account(sweep_account.get());
+        memcached_delete_if_expired(*it, get_btree(), effective_time, txn.get(), superblock.get());
+    }
+}
+
 namespace {
 
 struct read_visitor_t : public boost::static_visitor<read_response_t> {
@@ -482,6 +578,12 @@ struct read_visitor_t : public boost::static_visitor<read_response_t> {
         return read_response_t(dstr);
     }
 
+    read_response_t operator()(const multi_get_query_t& multi_get) {
+        multi_get_result_t result;
+        memcached_multi_get(multi_get.keys, btree, effective_time, txn, superblock, &result);
+        return read_response_t(result);
+    }
+
     read_visitor_t(btree_slice_t *_btree,
                    transaction_t *_txn,
                    superblock_t *_superblock,
@@ -504,7 +606,7 @@ void store_t::protocol_read(const read_t &read,
                             read_response_t *response,
                             btree_slice_t *btree,
                             transaction_t *txn,
-                            superblock_t *superblock,
+                            real_superblock_t *superblock,
                             UNUSED signal_t *interruptor) {
     read_visitor_t v(btree, txn, superblock, read.effective_time);
     *response = boost::apply_visitor(v, read.query);
@@ -565,7 +667,7 @@ void store_t::protocol_write(const write_t &write,
                              transition_timestamp_t timestamp,
                              btree_slice_t *btree,
                              transaction_t *txn,
-                             superblock_t *superblock,
+                             real_superblock_t *superblock,
                              UNUSED signal_t *interruptor) {
     // TODO: should this be calling to_repli_timestamp on a transition_timestamp_t?  Does this not use the timestamp-before, when we'd want the timestamp-after?
     write_visitor_t v(btree, txn, superblock, write.proposed_cas, write.effective_time, timestamp.to_repli_timestamp());
@@ -620,7 +722,7 @@ static void call_memcached_backfill(int i, btree_slice_t *btree, const std::vect
 // TODO: Figure out wtf does the backfill filtering, figure out wtf constricts delete range operations to hit only a certain hash-interval, figure out what filters keys.
 void store_t::protocol_send_backfill(const region_map_t<memcached_protocol_t, state_timestamp_t> &start_point,
                                      chunk_fun_callback_t<memcached_protocol_t> *chunk_fun_cb,
-                                     superblock_t *superblock,
+                                     real_superblock_t *superblock,
                                      btree_slice_t *btree,
                                      transaction_t *txn,
                                      backfill_progress_t *progress,
@@ -689,7 +791,7 @@ private:
 
 void store_t::protocol_receive_backfill(btree_slice_t *btree,
                                         transaction_t *txn,
-                                        superblock_t *superblock,
+                                        real_superblock_t *superblock,
                                         signal_t *interruptor,
                                         const backfill_chunk_t &chunk) {
     boost::apply_visitor(receive_backfill_visitor_t(btree, txn, superblock, interruptor), chunk.val);
@@ -718,7 +820,7 @@ private:
 void store_t::protocol_reset_data(const region_t& subregion,
                                   btree_slice_t *btree,
                                   transaction_t *txn,
-                                  superblock_t *superblock) {
+                                  real_superblock_t *superblock) {
     hash_key_tester_t key_tester(subregion.beg, subregion.end);
     memcached_erase_range(btree, &key_tester, subregion.inner, txn, superblock);
 }
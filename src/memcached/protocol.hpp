@@ -11,6 +11,7 @@
 #include "backfill_progress.hpp"
 #include "btree/btree_store.hpp"
 #include "buffer_cache/types.hpp"
+#include "concurrency/auto_drainer.hpp"
 #include "containers/archive/stl_types.hpp"
 #include "memcached/memcached_btree/backfill.hpp"
 #include "memcached/queries.hpp"
@@ -32,9 +33,11 @@ write_message_t &operator<<(write_message_t &msg, const rget_result_t &iter);
 archive_result_t deserialize(read_stream_t *s, rget_result_t *iter);
 
 RDB_DECLARE_SERIALIZABLE(get_query_t);
+RDB_DECLARE_SERIALIZABLE(multi_get_query_t);
 RDB_DECLARE_SERIALIZABLE(rget_query_t);
 RDB_DECLARE_SERIALIZABLE(distribution_get_query_t);
 RDB_DECLARE_SERIALIZABLE(get_result_t);
+RDB_DECLARE_SERIALIZABLE(multi_get_result_t);
 RDB_DECLARE_SERIALIZABLE(key_with_data_buffer_t);
 RDB_DECLARE_SERIALIZABLE(rget_result_t);
 RDB_DECLARE_SERIALIZABLE(distribution_result_t);
@@ -58,7 +61,7 @@ public:
     struct context_t { };
 
     struct read_response_t {
-        typedef boost::variant<get_result_t, rget_result_t, distribution_result_t> result_t;
+        typedef boost::variant<get_result_t, rget_result_t, distribution_result_t, multi_get_result_t> result_t;
 
         read_response_t() { }
         read_response_t(const read_response_t& r) : result(r.result) { }
@@ -68,7 +71,7 @@ public:
     };
 
     struct read_t {
-        typedef boost::variant<get_query_t, rget_query_t, distribution_get_query_t> query_t;
+        typedef boost::variant<get_query_t, rget_query_t, distribution_get_query_t, multi_get_query_t> query_t;
 
         region_t get_region() const THROWS_NOTHING;
         read_t shard(const region_t &region) const THROWS_NOTHING;
@@ -172,7 +175,7 @@ public:
                            read_response_t *response,
                            btree_slice_t *btree,
                            transaction_t *txn,
-                           superblock_t *superblock,
+                           real_superblock_t *superblock,
                            signal_t *interruptor);
 
         void protocol_write(const write_t &write,
@@ -180,12 +183,12 @@ public:
                             transition_timestamp_t timestamp,
                             btree_slice_t *btree,
                             transaction_t *txn,
-                            superblock_t *superblock,
+                            real_superblock_t *superblock,
                             signal_t *interruptor);
 
         void protocol_send_backfill(const region_map_t<memcached_protocol_t, state_timestamp_t> &start_point,
                                     chunk_fun_callback_t<memcached_protocol_t> *chunk_fun_cb,
-                                    superblock_t *superblock,
+                                    real_superblock_t *superblock,
                                     btree_slice_t *btree,
                                     transaction_t *txn,
                                     backfill_progress_t *progress,
@@ -194,14 +197,26 @@ public:
 
         void protocol_receive_backfill(btree_slice_t *btree,
                                        transaction_t *txn,
-                                       superblock_t *superblock,
+                                       real_superblock_t *superblock,
                                        signal_t *interruptor,
                                        const backfill_chunk_t &chunk);
 
         void protocol_reset_data(const region_t& subregion,
                                  btree_slice_t *btree,
                                  transaction_t *txn,
-                                 superblock_t *superblock);
+                                 real_superblock_t *superblock);
+
+        /* Expired values are normally only removed when a query runs into
+        them. This sweep goes over the btree in the background, a few keys at a
+        time and at a low cache priority, and deletes the expired values that
+        nothing has touched since. */
+        void sweep_expired_values(auto_drainer_t::lock_t keepalive);
+        void sweep_expired_values_step(signal_t *interruptor) THROWS_ONLY(interrupted_exc_t);
+
+        store_key_t sweep_cursor;
+        scoped_ptr_t<cache_account_t> sweep_account;
+
+        auto_drainer_t drainer;
     };
 
 };
@@ -52,6 +52,21 @@ struct get_result_t {
     cas_t cas;
 };
 
+/* `get` with several keys */
+
+struct multi_get_query_t {
+    // Sorted, without duplicates.
+    std::vector<store_key_t> keys;
+
+    multi_get_query_t() { }
+    explicit multi_get_query_t(const std::vector<store_key_t> &_keys);
+};
+
+struct multi_get_result_t {
+    // One result for each key of the query, in the same order.
+    std::vector<std::pair<store_key_t, get_result_t> > results;
+};
+
 /* `rget` */
 
 struct rget_query_t {
@@ -393,6 +393,49 @@ void dummy_protocol_t::store_t::write(DEBUG_ONLY(const metainfo_checker_t<dummy_
     if (rng.randint(2) == 0) nap(rng.randint(10));
 }
 
+void dummy_protocol_t::store_t::write_batch(DEBUG_ONLY(const metainfo_checker_t<dummy_protocol_t>& metainfo_checker, )
+                                            const metainfo_t& new_metainfo,
+                                            const std::vector<dummy_protocol_t::write_t> &writes,
+                                            const std::vector<transition_timestamp_t> &write_timestamps,
+                                            std::vector<dummy_protocol_t::write_response_t> *responses,
+                                            order_token_t order_token,
+                                            object_buffer_t<fifo_enforcer_sink_t::exit_write_t> *token,
+                                            signal_t *interruptor) THROWS_ONLY(interrupted_exc_t) {
+
+    rassert(region_is_superset(get_region(), metainfo_checker.get_domain()));
+    rassert(region_is_superset(get_region(), new_metainfo.get_domain()));
+    guarantee(!writes.empty());
+    guarantee(writes.size() == write_timestamps.size());
+
+    {
+        object_buffer_t<fifo_enforcer_sink_t::exit_write_t>::destruction_sentinel_t destroyer(token);
+
+        wait_interruptible(token->get(), interruptor);
+
+        order_sink.check_out(order_token);
+
+        rassert(metainfo_checker.get_domain() == metainfo.mask(metainfo_checker.get_domain()).get_domain());
+#ifndef NDEBUG
+        metainfo_checker.check_metainfo(metainfo.mask(metainfo_checker.get_domain()));
+#endif
+
+        if (rng.randint(2) == 0) nap(rng.randint(10));
+        responses->resize(writes.size());
+        for (size_t i = 0; i < writes.size(); ++i) {
+            rassert(region_is_superset(get_region(), writes[i].get_region()));
+            for (std::map<std::string, std::string>::const_iterator it = writes[i].values.begin();
+                    it != writes[i].values.end(); it++) {
+                (*responses)[i].old_values[(*it).first] = values[(*it).first];
+                values[(*it).first] = (*it).second;
+                timestamps[(*it).first] = write_timestamps[i].timestamp_after();
+            }
+        }
+
+        metainfo.update(new_metainfo);
+    }
+    if (rng.randint(2) == 0) nap(rng.randint(10));
+}
+
 bool dummy_protocol_t::store_t::send_backfill(const region_map_t<dummy_protocol_t, state_timestamp_t> &start_point,
                                               send_backfill_callback_t<dummy_protocol_t> *send_backfill_cb,
                                               traversal_progress_combiner_t *progress,
@@ -441,14 +484,17 @@ bool dummy_protocol_t::store_t::send_backfill(const region_map_t<dummy_protocol_
     }
 }
 
-void dummy_protocol_t::store_t::receive_backfill(const dummy_protocol_t::backfill_chunk_t &chunk, object_buffer_t<fifo_enforcer_sink_t::exit_write_t> *token, signal_t *interruptor) THROWS_ONLY(interrupted_exc_t) {
+void dummy_protocol_t::store_t::receive_backfill(const std::vector<dummy_protocol_t::backfill_chunk_t> &chunks, object_buffer_t<fifo_enforcer_sink_t::exit_write_t> *token, signal_t *interruptor) THROWS_ONLY(interrupted_exc_t) {
     object_buffer_t<fifo_enforcer_sink_t::exit_write_t>::destruction_sentinel_t destroyer(token);
 
-    rassert(get_region().keys.count(chunk.key) != 0);
+    guarantee(!chunks.empty());
 
     if (rng.randint(2) == 0) nap(rng.randint(10), interruptor);
-    values[chunk.key] = chunk.value;
-    timestamps[chunk.key] = chunk.timestamp;
+    for (std::vector<dummy_protocol_t::backfill_chunk_t>::const_iterator it = chunks.begin(); it != chunks.end(); ++it) {
+        rassert(get_region().keys.count(it->key) != 0);
+        values[it->key] = it->value;
+        timestamps[it->key] = it->timestamp;
+    }
     if (rng.randint(2) == 0) nap(rng.randint(10), interruptor);
 }
 
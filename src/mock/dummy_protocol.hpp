@@ -141,13 +141,22 @@ public:
                    object_buffer_t<fifo_enforcer_sink_t::exit_write_t> *token,
                    signal_t *interruptor) THROWS_ONLY(interrupted_exc_t);
 
+        void write_batch(DEBUG_ONLY(const metainfo_checker_t<dummy_protocol_t>& metainfo_checker, )
+                         const metainfo_t& new_metainfo,
+                         const std::vector<dummy_protocol_t::write_t> &writes,
+                         const std::vector<transition_timestamp_t> &write_timestamps,
+                         std::vector<dummy_protocol_t::write_response_t> *responses,
+                         order_token_t order_token,
+                         object_buffer_t<fifo_enforcer_sink_t::exit_write_t> *token,
+                         signal_t *interruptor) THROWS_ONLY(interrupted_exc_t);
+
         bool send_backfill(const region_map_t<dummy_protocol_t, state_timestamp_t> &start_point,
                            send_backfill_callback_t<dummy_protocol_t> *send_backfill_cb,
                            traversal_progress_combiner_t *progress,
                            object_buffer_t<fifo_enforcer_sink_t::exit_read_t> *token,
                            signal_t *interruptor) THROWS_ONLY(interrupted_exc_t);
 
-        void receive_backfill(const dummy_protocol_t::backfill_chunk_t &chunk,
+        void receive_backfill(const std::vector<dummy_protocol_t::backfill_chunk_t> &chunks,
                               object_buffer_t<fifo_enforcer_sink_t::exit_write_t> *token,
                               signal_t *interruptor) THROWS_ONLY(interrupted_exc_t);
 
@@ -8,12 +8,16 @@
 
 #include "errors.hpp"
 #include <boost/function.hpp>
+#include <boost/shared_ptr.hpp>
 #include <boost/ptr_container/ptr_map.hpp>
 #include <boost/ptr_container/ptr_vector.hpp>
 
 #include "arch/arch.hpp"
 #include "concurrency/auto_drainer.hpp"
 #include "concurrency/cross_thread_signal.hpp"
+#include "concurrency/mutex.hpp"
+#include "concurrency/semaphore.hpp"
+#include "config/args.hpp"
 #include "containers/archive/archive.hpp"
 #include "http/http.hpp"
 
@@ -101,7 +105,24 @@ public:
     int get_port() const;
 private:
 
+    /* What the requests on a connection share in CORO_UNORDERED mode. */
+    struct unordered_conn_t {
+        unordered_conn_t(tcp_conn_t *_conn, context_t *_ctx, signal_t *_closer)
+            : conn(_conn), ctx(_ctx), closer(_closer), in_flight(MAX_IN_FLIGHT_REQUESTS_PER_CONNECTION) { }
+        tcp_conn_t *conn;
+        context_t *ctx;
+        signal_t *closer;
+        /* Responses go out one at a time, in whatever order they're ready. */
+        mutex_t send_mutex;
+        semaphore_t in_flight;
+    };
+
     void handle_conn(const scoped_ptr_t<tcp_conn_descriptor_t> &nconn, auto_drainer_t::lock_t);
+    void handle_conn_unordered(tcp_conn_t *conn, context_t *ctx, signal_t *closer);
+    void handle_request_unordered(boost::shared_ptr<request_t> request, unordered_conn_t *uconn, auto_drainer_t::lock_t keepalive);
+    /* Returns false, with the response to send back in `*forced_response`, if
+    the request can't be parsed. */
+    bool read_request(tcp_conn_t *conn, request_t *request, response_t *forced_response, signal_t *closer) THROWS_ONLY(tcp_conn_read_closed_exc_t);
     void send(const response_t &, tcp_conn_t *conn, signal_t *closer) THROWS_ONLY(tcp_conn_write_closed_exc_t);
 
     // For HTTP server
@@ -11,6 +11,7 @@
 #include <boost/lexical_cast.hpp>
 
 #include "arch/arch.hpp"
+#include "config/args.hpp"
 #include "concurrency/cross_thread_signal.hpp"
 #include "db_thread_info.hpp"
 
@@ -71,33 +72,18 @@ void protob_server_t<request_t, response_t, context_t>::handle_conn(const scoped
         return;
     }
 
-    //TODO figure out how to do this with less copying
+    if (cb_mode == CORO_UNORDERED) {
+        handle_conn_unordered(conn.get(), &ctx, &ct_keepalive);
+        return;
+    }
+
     for (;;) {
         request_t request;
-        bool force_response = false;
         response_t forced_response;
-        std::string err;
+        bool force_response;
         try {
-            int32_t size;
-            conn->read(&size, sizeof(int32_t), &ct_keepalive);
-            if (size < 0) {
-                err = strprintf("Negative protobuf size (%d).", size);
-                forced_response = on_unparsable_query(0, err);
-                force_response = true;
-            } else {
-                scoped_array_t<char> data(size);
-                conn->read(data.data(), size, &ct_keepalive);
-
-                bool res = request.ParseFromArray(data.data(), size);
-                if (!res) {
-                    err = "Client is buggy (failed to deserialize protobuf).";
-                    forced_response = on_unparsable_query(&request, err);
-                    force_response = true;
-                }
-            }
+            force_response = !read_request(conn.get(), &request, &forced_response, &ct_keepalive);
         } catch (tcp_conn_read_closed_exc_t &) {
-            //TODO need to figure out what blocks us up here in non inline cb
-            //mode
             return;
         }
 
@@ -118,27 +104,117 @@ void protob_server_t<request_t, response_t, context_t>::handle_conn(const scoped
                     crash("unimplemented");
                     break;
                 case CORO_UNORDERED:
-                    crash("unimplemented");
-                    break;
                 default:
                     crash("unreachable");
                     break;
             }
         } catch (tcp_conn_write_closed_exc_t &) {
-            //TODO need to figure out what blocks us up here in non inline cb
-            //mode
             return;
         }
     }
 }
 
+template <class request_t, class response_t, class context_t>
+void protob_server_t<request_t, response_t, context_t>::handle_conn_unordered(tcp_conn_t *conn, context_t *ctx, signal_t *closer) {
+    unordered_conn_t uconn(conn, ctx, closer);
+
+    /* All of the connection's requests share an interruptor, which goes off
+    when the client hangs up, when we shut down, or when we stop reading
+    requests. */
+    linux_event_watcher_t::watch_t conn_interrupted(conn->get_event_watcher(), poll_event_rdhup);
+    cond_t stopped_reading;
+    wait_any_t interruptor(&conn_interrupted, shutdown_signal(), &stopped_reading);
+    ctx->interruptor = &interruptor;
+
+    /* The order matters: once we stop reading, we interrupt the requests that
+    are still running and then wait for them. */
+    auto_drainer_t requests_drainer;
+    pulse_on_destruct_t pulse_stopped_reading(&stopped_reading);
+
+    for (;;) {
+        boost::shared_ptr<request_t> request(new request_t());
+        response_t forced_response;
+        bool force_response;
+        try {
+            force_response = !read_request(conn, request.get(), &forced_response, closer);
+        } catch (tcp_conn_read_closed_exc_t &) {
+            return;
+        }
+
+        if (force_response) {
+            try {
+                mutex_t::acq_t send_acq(&uconn.send_mutex);
+                send(forced_response, conn, closer);
+            } catch (tcp_conn_write_closed_exc_t &) {
+                return;
+            }
+            continue;
+        }
+
+        /* We don't read more requests while there are too many in flight, so
+        clients that send them faster than we answer them get pushed back on by
+        TCP. */
+        uconn.in_flight.co_lock();
+        coro_t::spawn_sometime(boost::bind(&protob_server_t<request_t, response_t, context_t>::handle_request_unordered,
+                                           this, request, &uconn, auto_drainer_t::lock_t(&requests_drainer)));
+    }
+}
+
+template <class request_t, class response_t, class context_t>
+void protob_server_t<request_t, response_t, context_t>::handle_request_unordered(boost::shared_ptr<request_t> request,
+                                                                                  unordered_conn_t *uconn,
+                                                                                  UNUSED auto_drainer_t::lock_t keepalive) {
+    response_t response = f(request.get(), uconn->ctx);
+    try {
+        mutex_t::acq_t send_acq(&uconn->send_mutex);
+        send(response, uconn->conn, uconn->closer);
+    } catch (const tcp_conn_write_closed_exc_t &) {
+        // The read loop finds out about it too, and cleans up.
+    }
+    uconn->in_flight.unlock();
+}
+
+template <class request_t, class response_t, class context_t>
+bool protob_server_t<request_t, response_t, context_t>::read_request(tcp_conn_t *conn, request_t *request, response_t *forced_response, signal_t *closer) THROWS_ONLY(tcp_conn_read_closed_exc_t) {
+    //TODO figure out how to do this with less copying
+    int32_t size;
+    conn->read(&size, sizeof(int32_t), closer);
+    if (size < 0) {
+        std::string err = strprintf("Negative protobuf size (%d).", size);
+        *forced_response = on_unparsable_query(0, err);
+        return false;
+    }
+
+    scoped_array_t<char> data(size);
+    conn->read(data.data(), size, closer);
+
+    bool res;
+    if (size >= STEALABLE_REQUEST_MIN_SIZE) {
+        on_any_thread_t rethreader;
+        res = request->ParseFromArray(data.data(), size);
+    } else {
+        res = request->ParseFromArray(data.data(), size);
+    }
+    if (!res) {
+        std::string err = "Client is buggy (failed to deserialize protobuf).";
+        *forced_response = on_unparsable_query(request, err);
+        return false;
+    }
+    return true;
+}
+
 template <class request_t, class response_t, class context_t>
 void protob_server_t<request_t, response_t, context_t>::send(const response_t &res, tcp_conn_t *conn, signal_t *closer) THROWS_ONLY(tcp_conn_write_closed_exc_t) {
     int size = res.ByteSize();
     conn->write(&size, sizeof(res.ByteSize()), closer);
     scoped_array_t<char> data(size);
 
-    res.SerializeToArray(data.data(), size);
+    if (size >= STEALABLE_REQUEST_MIN_SIZE) {
+        on_any_thread_t rethreader;
+        res.SerializeToArray(data.data(), size);
+    } else {
+        res.SerializeToArray(data.data(), size);
+    }
     conn->write(data.data(), size, closer);
 }
 
@@ -192,7 +268,9 @@ http_res_t protob_server_t<request_t, response_t, context_t>::handle(const http_
 
         response_t response;
         switch (cb_mode) {
-        case INLINE: {
+        case INLINE:
+        case CORO_UNORDERED: {
+            // Each HTTP request already has a coroutine of its own.
             boost::shared_ptr<typename http_conn_cache_t<context_t>::http_conn_t> conn =
                 http_conn_cache.find(conn_id);
             if (!parseSucceeded) {
@@ -207,7 +285,6 @@ http_res_t protob_server_t<request_t, response_t, context_t>::handle(const http_
             }
         } break;
         case CORO_ORDERED:
-        case CORO_UNORDERED:
             crash("unimplemented");
         default:
             crash("unreachable");
@@ -366,6 +366,26 @@ public:
             signal_t *interruptor)
             THROWS_ONLY(interrupted_exc_t) = 0;
 
+    /* Performs several writes with consecutive timestamps as if by one call to
+    `write()` each, but in a single transaction. Nothing else touches the store
+    in between them. `new_metainfo` is the metainfo after the last write.
+    [Precondition] !writes.empty()
+    [Precondition] writes.size() == timestamps.size()
+    [Precondition] timestamps[i].timestamp_after() == timestamps[i + 1].timestamp_before()
+    [Precondition] Each write satisfies the preconditions of `write()`.
+    [Postcondition] responses->size() == writes.size()
+    [May block] */
+    virtual void write_batch(
+            DEBUG_ONLY(const metainfo_checker_t<protocol_t>& metainfo_expecter, )
+            const metainfo_t& new_metainfo,
+            const std::vector<typename protocol_t::write_t> &writes,
+            const std::vector<transition_timestamp_t> &timestamps,
+            std::vector<typename protocol_t::write_response_t> *responses,
+            order_token_t order_token,
+            object_buffer_t<fifo_enforcer_sink_t::exit_write_t> *token,
+            signal_t *interruptor)
+            THROWS_ONLY(interrupted_exc_t) = 0;
+
     /* Expresses the changes that have happened since `start_point` as a
     series of `backfill_chunk_t` objects.
     [Precondition] start_point.get_domain() <= view->get_region()
@@ -382,13 +402,15 @@ public:
             THROWS_ONLY(interrupted_exc_t) = 0;
 
 
-    /* Applies a backfill data chunk sent by `send_backfill()`. If
-    `interrupted_exc_t` is thrown, the state of the database is undefined
-    except that doing a second backfill must put it into a valid state.
+    /* Applies backfill data chunks sent by `send_backfill()`, in order and all
+    under the one token. If `interrupted_exc_t` is thrown, the state of the
+    database is undefined except that doing a second backfill must put it into
+    a valid state.
+    [Precondition] !chunks.empty()
     [May block]
     */
     virtual void receive_backfill(
-            const typename protocol_t::backfill_chunk_t &chunk,
+            const std::vector<typename protocol_t::backfill_chunk_t> &chunks,
             object_buffer_t<fifo_enforcer_sink_t::exit_write_t> *token,
             signal_t *interruptor)
             THROWS_ONLY(interrupted_exc_t) = 0;
@@ -522,6 +544,23 @@ public:
         store_view->write(DEBUG_ONLY(metainfo_checker, ) new_metainfo, write, response, timestamp, order_token, token, interruptor);
     }
 
+    void write_batch(
+            DEBUG_ONLY(const metainfo_checker_t<protocol_t>& metainfo_checker, )
+            const metainfo_t& new_metainfo,
+            const std::vector<typename protocol_t::write_t> &writes,
+            const std::vector<transition_timestamp_t> &timestamps,
+            std::vector<typename protocol_t::write_response_t> *responses,
+            order_token_t order_token,
+            object_buffer_t<fifo_enforcer_sink_t::exit_write_t> *token,
+            signal_t *interruptor)
+            THROWS_ONLY(interrupted_exc_t) {
+        home_thread_mixin_t::assert_thread();
+        rassert(region_is_superset(get_region(), metainfo_checker.get_domain()));
+        rassert(region_is_superset(get_region(), new_metainfo.get_domain()));
+
+        store_view->write_batch(DEBUG_ONLY(metainfo_checker, ) new_metainfo, writes, timestamps, responses, order_token, token, interruptor);
+    }
+
     // TODO: Make this take protocol_t::progress_t again (or maybe a
     // progress_receiver_t type that you define).
     bool send_backfill(
@@ -538,12 +577,12 @@ public:
     }
 
     void receive_backfill(
-            const typename protocol_t::backfill_chunk_t &chunk,
+            const std::vector<typename protocol_t::backfill_chunk_t> &chunks,
             object_buffer_t<fifo_enforcer_sink_t::exit_write_t> *token,
             signal_t *interruptor)
             THROWS_ONLY(interrupted_exc_t) {
         home_thread_mixin_t::assert_thread();
-        store_view->receive_backfill(chunk, token, interruptor);
+        store_view->receive_backfill(chunks, token, interruptor);
     }
 
     void reset_data(
@@ -0,0 +1,423 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#include "rdb_protocol/binary_json.hpp"
+
+#include <ctype.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "rdb_protocol/rdb_protocol_json.hpp"
+
+namespace {
+
+/* The sizes of the fixed parts of the encoding. */
+const int64_t tag_size = 1;
+const int64_t uint32_size = sizeof(uint32_t);
+const int64_t double_size = sizeof(double);
+/* An array or object's tag, byte count, and element count. */
+const int64_t container_header_size = tag_size + 2 * uint32_size;
+
+/* Orders keys the way the offset table of an object is sorted. */
+int key_casecmp(const char *x, size_t x_size, const char *y, size_t y_size) {
+    size_t n = std::min(x_size, y_size);
+    for (size_t i = 0; i < n; ++i) {
+        int cx = tolower(static_cast<unsigned char>(x[i]));
+        int cy = tolower(static_cast<unsigned char>(y[i]));
+        if (cx != cy) {
+            return cx - cy;
+        }
+    }
+    return x_size < y_size ? -1 : (x_size > y_size ? 1 : 0);
+}
+
+void append_uint8(uint8_t x, std::string *out) {
+    out->push_back(static_cast<char>(x));
+}
+
+void append_uint32(uint32_t x, std::string *out) {
+    out->append(reinterpret_cast<const char *>(&x), sizeof(x));
+}
+
+void write_uint32(uint32_t x, size_t pos, std::string *out) {
+    rassert(pos + sizeof(x) <= out->size());
+    memcpy(&(*out)[pos], &x, sizeof(x));
+}
+
+struct sorted_field_t {
+    const char *key;
+    size_t key_size;
+    size_t index;
+    uint32_t offset;
+
+    bool operator<(const sorted_field_t &other) const {
+        int res = key_casecmp(key, key_size, other.key, other.key_size);
+        return res != 0 ? res < 0 : index < other.index;
+    }
+};
+
+void encode_value(const cJSON *json, std::string *out) {
+    const size_t start = out->size();
+    switch (json->type) {
+    case cJSON_NULL:
+        append_uint8(binary_json_null, out);
+        break;
+    case cJSON_False:
+        append_uint8(binary_json_false, out);
+        break;
+    case cJSON_True:
+        append_uint8(binary_json_true, out);
+        break;
+    case cJSON_Number:
+        append_uint8(binary_json_number, out);
+        out->append(reinterpret_cast<const char *>(&json->valuedouble), sizeof(json->valuedouble));
+        break;
+    case cJSON_String: {
+        guarantee(json->valuestring);
+        size_t size = strlen(json->valuestring);
+        append_uint8(binary_json_string, out);
+        append_uint32(size, out);
+        out->append(json->valuestring, size);
+    } break;
+    case cJSON_Array:
+    case cJSON_Object: {
+        const bool is_object = json->type == cJSON_Object;
+        size_t count = 0;
+        for (const cJSON *item = json->child; item; item = item->next) {
+            ++count;
+        }
+
+        append_uint8(is_object ? binary_json_object : binary_json_array, out);
+        append_uint32(0, out);  // The byte count, filled in below.
+        append_uint32(count, out);
+        const size_t table = out->size();
+        out->resize(table + count * uint32_size);
+
+        std::vector<sorted_field_t> fields;
+        if (is_object) {
+            fields.reserve(count);
+        }
+        size_t index = 0;
+        for (const cJSON *item = json->child; item; item = item->next, ++index) {
+            const uint32_t item_offset = out->size() - start;
+            if (is_object) {
+                guarantee(item->string);
+                sorted_field_t field;
+                field.key = item->string;
+                field.key_size = strlen(item->string);
+                field.index = index;
+                field.offset = item_offset;
+                fields.push_back(field);
+                append_uint32(field.key_size, out);
+                out->append(field.key, field.key_size);
+            } else {
+                write_uint32(item_offset, table + index * uint32_size, out);
+            }
+            encode_value(item, out);
+        }
+
+        if (is_object) {
+            std::sort(fields.begin(), fields.end());
+            for (size_t i = 0; i < fields.size(); ++i) {
+                write_uint32(fields[i].offset, table + i * uint32_size, out);
+            }
+        }
+        write_uint32(out->size() - (start + tag_size + uint32_size), start + tag_size, out);
+    } break;
+    default:
+        crash("Unreachable");
+    }
+}
+
+}  // namespace
+
+void binary_json_encode(const cJSON *json, std::string *out) {
+    append_uint8(BINARY_JSON_MAGIC, out);
+    encode_value(json, out);
+}
+
+/* binary_json_source_t */
+
+binary_json_source_t::binary_json_source_t() : size_(0) { }
+
+binary_json_source_t::binary_json_source_t(const const_buffer_group_t *group) : size_(0) {
+    reset(group);
+}
+
+binary_json_source_t::binary_json_source_t(const char *data, int64_t size) : size_(0) {
+    reset(data, size);
+}
+
+void binary_json_source_t::reset(const const_buffer_group_t *group) {
+    buffers.clear();
+    starts.clear();
+    size_ = 0;
+    for (size_t i = 0; i < group->num_buffers(); ++i) {
+        const_buffer_group_t::buffer_t buffer = group->get_buffer(i);
+        add_buffer(static_cast<const char *>(buffer.data), buffer.size);
+    }
+}
+
+void binary_json_source_t::reset(const char *data, int64_t size) {
+    buffers.clear();
+    starts.clear();
+    size_ = 0;
+    add_buffer(data, size);
+}
+
+void binary_json_source_t::add_buffer(const char *data, int64_t size) {
+    if (size > 0) {
+        buffers.push_back(data);
+        starts.push_back(size_);
+        size_ += size;
+    }
+}
+
+bool binary_json_source_t::is_binary_json() const {
+    return size_ > 0 && read_uint8(0) == BINARY_JSON_MAGIC;
+}
+
+const char *binary_json_source_t::bytes(int64_t offset, int64_t n, std::vector<char> *scratch) const {
+    guarantee(offset >= 0 && n >= 0 && offset + n <= size_, "binary json document is corrupt");
+    if (n == 0) {
+        return NULL;
+    }
+
+    // The last buffer that starts at or before `offset`.
+    size_t i = std::upper_bound(starts.begin(), starts.end(), offset) - starts.begin() - 1;
+    const int64_t buffer_end = i + 1 < starts.size() ? starts[i + 1] : size_;
+    if (offset + n <= buffer_end) {
+        return buffers[i] + (offset - starts[i]);
+    }
+
+    scratch->resize(n);
+    int64_t copied = 0;
+    while (copied < n) {
+        const int64_t end = i + 1 < starts.size() ? starts[i + 1] : size_;
+        const int64_t from = offset + copied - starts[i];
+        const int64_t chunk = std::min(n - copied, end - (offset + copied));
+        memcpy(&(*scratch)[copied], buffers[i] + from, chunk);
+        copied += chunk;
+        ++i;
+    }
+    return &(*scratch)[0];
+}
+
+uint8_t binary_json_source_t::read_uint8(int64_t offset) const {
+    std::vector<char> scratch;
+    return *reinterpret_cast<const uint8_t *>(bytes(offset, 1, &scratch));
+}
+
+uint32_t binary_json_source_t::read_uint32(int64_t offset) const {
+    std::vector<char> scratch;
+    uint32_t res;
+    memcpy(&res, bytes(offset, sizeof(res), &scratch), sizeof(res));
+    return res;
+}
+
+double binary_json_source_t::read_double(int64_t offset) const {
+    std::vector<char> scratch;
+    double res;
+    memcpy(&res, bytes(offset, sizeof(res), &scratch), sizeof(res));
+    return res;
+}
+
+/* binary_json_t */
+
+binary_json_t binary_json_t::root(const binary_json_source_t *source) {
+    guarantee(source->is_binary_json());
+    return binary_json_t(source, tag_size);
+}
+
+int binary_json_t::type() const {
+    switch (tag()) {
+    case binary_json_null: return cJSON_NULL;
+    case binary_json_false: return cJSON_False;
+    case binary_json_true: return cJSON_True;
+    case binary_json_number: return cJSON_Number;
+    case binary_json_string: return cJSON_String;
+    case binary_json_array: return cJSON_Array;
+    case binary_json_object: return cJSON_Object;
+    default:
+        crash("binary json document is corrupt");
+    }
+}
+
+double binary_json_t::number() const {
+    rassert(tag() == binary_json_number);
+    return source->read_double(offset + tag_size);
+}
+
+std::string binary_json_t::str() const {
+    rassert(tag() == binary_json_string);
+    const uint32_t size = source->read_uint32(offset + tag_size);
+    std::vector<char> scratch;
+    const char *data = source->bytes(offset + tag_size + uint32_size, size, &scratch);
+    return std::string(data, size);
+}
+
+int binary_json_t::compare_str(const char *data, size_t size) const {
+    rassert(tag() == binary_json_string);
+    const uint32_t our_size = source->read_uint32(offset + tag_size);
+    std::vector<char> scratch;
+    const char *ours = source->bytes(offset + tag_size + uint32_size, our_size, &scratch);
+    int res = memcmp(ours, data, std::min<size_t>(our_size, size));
+    if (res != 0) {
+        return res;
+    }
+    return our_size < size ? -1 : (our_size > size ? 1 : 0);
+}
+
+size_t binary_json_t::size() const {
+    rassert(tag() == binary_json_array || tag() == binary_json_object);
+    return source->read_uint32(offset + tag_size + uint32_size);
+}
+
+binary_json_t binary_json_t::array_item(size_t index) const {
+    rassert(tag() == binary_json_array);
+    rassert(index < size());
+    return binary_json_t(source, offset + source->read_uint32(offset + container_header_size + index * uint32_size));
+}
+
+bool binary_json_t::get_field(const std::string &name, binary_json_t *out, std::string *key_out) const {
+    rassert(tag() == binary_json_object);
+    const int64_t table = offset + container_header_size;
+
+    // Find the first key that isn't less than `name`.
+    size_t lo = 0, hi = size();
+    std::vector<char> scratch;
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+        const int64_t field_offset = offset + source->read_uint32(table + mid * uint32_size);
+        const uint32_t key_size = source->read_uint32(field_offset);
+        const char *key = source->bytes(field_offset + uint32_size, key_size, &scratch);
+        if (key_casecmp(key, key_size, name.data(), name.size()) < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo == size()) {
+        return false;
+    }
+
+    const int64_t field_offset = offset + source->read_uint32(table + lo * uint32_size);
+    const uint32_t key_size = source->read_uint32(field_offset);
+    const char *key = source->bytes(field_offset + uint32_size, key_size, &scratch);
+    if (key_casecmp(key, key_size, name.data(), name.size()) != 0) {
+        return false;
+    }
+    *out = binary_json_t(source, field_offset + uint32_size + key_size);
+    if (key_out) {
+        key_out->assign(key, key_size);
+    }
+    return true;
+}
+
+int64_t binary_json_t::value_size() const {
+    switch (tag()) {
+    case binary_json_null:
+    case binary_json_false:
+    case binary_json_true:
+        return tag_size;
+    case binary_json_number:
+        return tag_size + double_size;
+    case binary_json_string:
+        return tag_size + uint32_size + source->read_uint32(offset + tag_size);
+    case binary_json_array:
+    case binary_json_object:
+        return tag_size + uint32_size + source->read_uint32(offset + tag_size);
+    default:
+        crash("binary json document is corrupt");
+    }
+}
+
+/* Makes a cJSON string out of bytes that aren't NUL-terminated. */
+static char *strndup_for_cjson(const char *data, size_t size) {
+    char *res = static_cast<char *>(malloc(size + 1));
+    memcpy(res, data, size);
+    res[size] = '\0';
+    return res;
+}
+
+cJSON *binary_json_t::to_cjson() const {
+    std::vector<char> scratch;
+    cJSON *res = cJSON_CreateBlank();
+    res->type = type();
+    switch (tag()) {
+    case binary_json_null:
+    case binary_json_false:
+    case binary_json_true:
+        break;
+    case binary_json_number:
+        res->valuedouble = number();
+        res->valueint = static_cast<int>(res->valuedouble);
+        break;
+    case binary_json_string: {
+        const uint32_t size = source->read_uint32(offset + tag_size);
+        res->valuestring = strndup_for_cjson(source->bytes(offset + tag_size + uint32_size, size, &scratch), size);
+    } break;
+    case binary_json_array:
+    case binary_json_object: {
+        const bool is_object = tag() == binary_json_object;
+        const size_t count = size();
+        // The elements follow the offset table in their original order.
+        int64_t item_offset = offset + container_header_size + count * uint32_size;
+        cJSON *last = NULL;
+        for (size_t i = 0; i < count; ++i) {
+            char *key = NULL;
+            if (is_object) {
+                const uint32_t key_size = source->read_uint32(item_offset);
+                key = strndup_for_cjson(source->bytes(item_offset + uint32_size, key_size, &scratch), key_size);
+                item_offset += uint32_size + key_size;
+            }
+            binary_json_t item(source, item_offset);
+            item_offset += item.value_size();
+
+            // Link the items up directly; cJSON_AddItemToArray() walks the
+            // whole list every time.
+            cJSON *child = item.to_cjson();
+            child->string = key;
+            if (last) {
+                last->next = child;
+                child->prev = last;
+            } else {
+                res->child = child;
+            }
+            last = child;
+        }
+    } break;
+    default:
+        crash("binary json document is corrupt");
+    }
+    return res;
+}
+
+int binary_json_t::compare(cJSON *other) const {
+    const int our_type = type();
+    if (our_type == other->type) {
+        switch (our_type) {
+        case cJSON_NULL:
+        case cJSON_False:
+        case cJSON_True:
+            return 0;
+        case cJSON_Number: {
+            const double ours = number();
+            return ours < other->valuedouble ? -1 : (ours > other->valuedouble ? 1 : 0);
+        }
+        case cJSON_String:
+            return compare_str(other->valuestring, strlen(other->valuestring));
+        default:
+            break;
+        }
+        // Arrays and objects are rare enough in comparisons that we just
+        // decode them.
+        scoped_cJSON_t ours(to_cjson());
+        return query_language::json_cmp(ours.get(), other);
+    }
+
+    // Values of different types are ordered by their types alone.
+    cJSON ours;
+    memset(&ours, 0, sizeof(ours));
+    ours.type = our_type;
+    return query_language::json_cmp(&ours, other);
+}
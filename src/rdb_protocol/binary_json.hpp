@@ -0,0 +1,138 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#ifndef RDB_PROTOCOL_BINARY_JSON_HPP_
+#define RDB_PROTOCOL_BINARY_JSON_HPP_
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "errors.hpp"
+#include "containers/buffer_group.hpp"
+#include "http/json.hpp"
+
+/* The format that the rdb protocol stores documents in. Unlike the serialized
+cJSON that we used to store, it can be read in place: finding a field of an
+object or an element of an array takes a binary search or a table lookup
+instead of a parse of the whole document, so filters and projections don't have
+to build a cJSON tree for every row they look at.
+
+A document is the byte `BINARY_JSON_MAGIC` followed by a value. A value is a
+one-byte tag (a `binary_json_tag_t`) followed by:
+ - null, false, true: nothing.
+ - number: the double, 8 bytes.
+ - string: a uint32_t length, then that many bytes (no terminating NUL).
+ - array: a uint32_t byte count of everything after it, a uint32_t element
+   count n, n uint32_t offsets of the elements relative to the array's tag, and
+   then the elements.
+ - object: like an array, except that each element is a field: a uint32_t key
+   length, the key bytes, and then the field's value. The fields themselves are
+   stored in their original order, but the offset table is sorted by key, case
+   insensitively (ties broken by the original order), which is how
+   `cJSON_GetObjectItem()` matches keys.
+
+Integers and doubles are in host byte order, like the rest of our archives. The
+old format starts with a little-endian cJSON type, whose first byte is small, so
+`BINARY_JSON_MAGIC` tells the two apart. */
+
+#define BINARY_JSON_MAGIC 0xB1
+
+enum binary_json_tag_t {
+    binary_json_null = 0,
+    binary_json_false,
+    binary_json_true,
+    binary_json_number,
+    binary_json_string,
+    binary_json_array,
+    binary_json_object
+};
+
+/* Appends the document encoding `json` to `out`. */
+void binary_json_encode(const cJSON *json, std::string *out);
+
+/* Random access to the bytes of an encoded document, which is usually spread
+over the buffers of a `blob_t`. Reads that fall within a single buffer don't
+copy anything. */
+class binary_json_source_t {
+public:
+    /* The buffers must stay alive as long as the source does. */
+    binary_json_source_t();
+    explicit binary_json_source_t(const const_buffer_group_t *group);
+    binary_json_source_t(const char *data, int64_t size);
+
+    /* Points the source at other bytes. A source that is reused this way for
+    many documents doesn't allocate anything once it has seen the one with the
+    most buffers. */
+    void reset(const const_buffer_group_t *group);
+    void reset(const char *data, int64_t size);
+
+    int64_t size() const { return size_; }
+
+    /* True if the bytes are a binary json document, rather than something in
+    the old format. */
+    bool is_binary_json() const;
+
+    /* Returns a pointer to the `n` bytes at `offset`. If they are split across
+    buffers, they are copied into `*scratch` first. */
+    const char *bytes(int64_t offset, int64_t n, std::vector<char> *scratch) const;
+
+    uint8_t read_uint8(int64_t offset) const;
+    uint32_t read_uint32(int64_t offset) const;
+    double read_double(int64_t offset) const;
+
+private:
+    void add_buffer(const char *data, int64_t size);
+
+    /* `starts[i]` is the offset of the first byte of `buffers[i]`. */
+    std::vector<const char *> buffers;
+    std::vector<int64_t> starts;
+    int64_t size_;
+
+    DISABLE_COPYING(binary_json_source_t);
+};
+
+/* A value in an encoded document. It's a cheap handle; copy it around freely,
+but not past the lifetime of its source. */
+class binary_json_t {
+public:
+    binary_json_t() : source(NULL), offset(0) { }
+    binary_json_t(const binary_json_source_t *_source, int64_t _offset)
+        : source(_source), offset(_offset) { }
+
+    /* The document's top level value. */
+    static binary_json_t root(const binary_json_source_t *source);
+
+    /* The cJSON type that this decodes to, e.g. `cJSON_Object`. */
+    int type() const;
+
+    double number() const;
+    std::string str() const;
+
+    /* Compares the string to `size` bytes at `data` like `strcmp()` would. */
+    int compare_str(const char *data, size_t size) const;
+
+    /* The number of elements of an array or fields of an object. */
+    size_t size() const;
+
+    binary_json_t array_item(size_t index) const;
+
+    /* Looks up a field of an object the way `cJSON_GetObjectItem()` does. If
+    `key_out` isn't NULL, it gets the field's key as it is spelled in the
+    object. */
+    bool get_field(const std::string &name, binary_json_t *out, std::string *key_out = NULL) const;
+
+    /* Decodes the value into a new cJSON tree. */
+    cJSON *to_cjson() const;
+
+    /* Compares the value to `other` like `query_language::json_cmp()`. */
+    int compare(cJSON *other) const;
+
+private:
+    uint8_t tag() const { return source->read_uint8(offset); }
+    int64_t value_size() const;
+
+    const binary_json_source_t *source;
+    int64_t offset;
+};
+
+#endif  // RDB_PROTOCOL_BINARY_JSON_HPP_
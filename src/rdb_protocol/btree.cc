@@ -11,12 +11,16 @@
 #include "btree/erase_range.hpp"
 #include "btree/get_distribution.hpp"
 #include "btree/operations.hpp"
+#include "btree/superblock.hpp"
 #include "buffer_cache/blob.hpp"
+#include "config/args.hpp"
 #include "containers/archive/buffer_group_stream.hpp"
-#include "containers/archive/vector_stream.hpp"
 #include "containers/scoped.hpp"
+#include "rdb_protocol/binary_json.hpp"
 #include "rdb_protocol/btree.hpp"
 #include "rdb_protocol/environment.hpp"
+#include "rdb_protocol/in_place_transform.hpp"
+#include "rdb_protocol/proto_utils.hpp"
 #include "rdb_protocol/query_language.hpp"
 #include "rdb_protocol/transform_visitors.hpp"
 
@@ -84,21 +88,32 @@ block_magic_t value_sizer_t<rdb_value_t>::btree_leaf_magic() const {
 
 block_size_t value_sizer_t<rdb_value_t>::block_size() const { return block_size_; }
 
-boost::shared_ptr<scoped_cJSON_t> get_data(const rdb_value_t *value, transaction_t *txn) {
-    blob_t blob(const_cast<rdb_value_t *>(value)->value_ref(), blob::btree_maxreflen);
+/* Decodes a value that has been exposed into `buffer_group`. Values written
+before we switched to binary json are in the old serialized cJSON format, so we
+still read those. */
+boost::shared_ptr<scoped_cJSON_t> get_data(const const_buffer_group_t *buffer_group) {
+    binary_json_source_t source(buffer_group);
+    if (source.is_binary_json()) {
+        return boost::shared_ptr<scoped_cJSON_t>(new scoped_cJSON_t(binary_json_t::root(&source).to_cjson()));
+    }
 
     boost::shared_ptr<scoped_cJSON_t> data;
-
-    blob_acq_t acq_group;
-    buffer_group_t buffer_group;
-    blob.expose_all(txn, rwi_read, &buffer_group, &acq_group);
-    buffer_group_read_stream_t read_stream(const_view(&buffer_group));
+    buffer_group_read_stream_t read_stream(buffer_group);
     int res = deserialize(&read_stream, &data);
     guarantee_err(res == 0, "corruption detected... this should probably be an exception\n");
 
     return data;
 }
 
+boost::shared_ptr<scoped_cJSON_t> get_data(const rdb_value_t *value, transaction_t *txn) {
+    blob_t blob(const_cast<rdb_value_t *>(value)->value_ref(), blob::btree_maxreflen);
+
+    blob_acq_t acq_group;
+    buffer_group_t buffer_group;
+    blob.expose_all(txn, rwi_read, &buffer_group, &acq_group);
+    return get_data(const_view(&buffer_group));
+}
+
 bool btree_value_fits(block_size_t bs, int data_length, const rdb_value_t *value) {
     return blob::ref_fits(bs, data_length, value->value_ref(), blob::btree_maxreflen);
 }
@@ -114,6 +129,34 @@ void rdb_get(const store_key_t &store_key, btree_slice_t *slice, transaction_t *
     }
 }
 
+class rdb_multi_get_callback_t : public multi_keyvalue_read_callback_t<rdb_value_t> {
+public:
+    rdb_multi_get_callback_t(const std::vector<store_key_t> *_keys, transaction_t *_txn, multi_point_read_response_t *_response)
+        : keys(_keys), txn(_txn), response(_response) { }
+
+    void on_keyvalue(size_t key_index, const rdb_value_t *value) {
+        rassert(key_index == response->data.size());
+        boost::shared_ptr<scoped_cJSON_t> data;
+        if (!value) {
+            data.reset(new scoped_cJSON_t(cJSON_CreateNull()));
+        } else {
+            data = get_data(value, txn);
+        }
+        response->data.push_back(std::make_pair((*keys)[key_index], data));
+    }
+
+private:
+    const std::vector<store_key_t> *keys;
+    transaction_t *txn;
+    multi_point_read_response_t *response;
+};
+
+void rdb_multi_get(const std::vector<store_key_t> &keys, btree_slice_t *slice, transaction_t *txn, superblock_t *superblock, multi_point_read_response_t *response) {
+    response->data.reserve(keys.size());
+    rdb_multi_get_callback_t callback(&keys, txn, response);
+    find_keyvalue_locations_for_read(txn, superblock, keys, &callback, slice->root_eviction_priority, &slice->stats);
+}
+
 void kv_location_delete(keyvalue_location_t<rdb_value_t> *kv_location, const store_key_t &key,
                         btree_slice_t *slice, repli_timestamp_t timestamp, transaction_t *txn) {
     guarantee(kv_location->value.has());
@@ -131,19 +174,12 @@ void kv_location_set(keyvalue_location_t<rdb_value_t> *kv_location, const store_
     scoped_malloc_t<rdb_value_t> new_value(MAX_RDB_VALUE_SIZE);
     bzero(new_value.get(), MAX_RDB_VALUE_SIZE);
 
-    //TODO unnecessary copies they must go away.
-    write_message_t wm;
-    wm << data;
-    vector_stream_t stream;
-    int res = send_write_message(&stream, &wm);
-    guarantee_err(res == 0, "Serialization for json data failed... this shouldn't happen.\n");
+    std::string encoded;
+    binary_json_encode(data->get(), &encoded);
 
     blob_t blob(new_value->value_ref(), blob::btree_maxreflen);
-
-    //TODO more copies, good lord
-    blob.append_region(txn, stream.vector().size());
-    std::string sered_data(stream.vector().begin(), stream.vector().end());
-    blob.write_from_string(sered_data, txn, 0);
+    blob.append_region(txn, encoded.size());
+    blob.write_from_string(encoded, txn, 0);
 
     // Actually update the leaf, if needed.
     kv_location->value.reinterpret_swap(new_value);
@@ -152,17 +188,145 @@ void kv_location_set(keyvalue_location_t<rdb_value_t> *kv_location, const store_
     //                                                                  ^^^^^ That means the key isn't expired.
 }
 
+/* Secondary index keys are the indexed attribute, printed the way we print
+primary keys and cut down to `MAX_SINDEX_SECONDARY_SIZE`, then a NUL, then the
+row's primary key, which keeps the keys of rows with the same attribute apart.
+Printed attributes never contain a NUL, so a key sorts with its attribute
+first. A primary key too long to fit is cut short and followed by its hash.
+
+Rows that a RANGE over the attribute would fail on go in the index too, with
+an empty attribute, so that they all sort before the rest. Reads look for them
+there, and fail the way a scan would. */
+std::string sindex_secondary_part(const std::string &printed_attr) {
+    return printed_attr.substr(0, MAX_SINDEX_SECONDARY_SIZE);
+}
+
+store_key_t sindex_key(const std::string &id, const store_key_t &primary_key, cJSON *row) {
+    std::string key;
+    if (range_row_error(row, id).empty()) {
+        key = sindex_secondary_part(cJSON_print_lexicographic(cJSON_GetObjectItem(row, id.c_str())));
+    }
+    key.push_back('\0');
+
+    std::string pk(reinterpret_cast<const char *>(primary_key.contents()), primary_key.size());
+    const size_t room = MAX_KEY_SIZE - key.size();
+    if (pk.size() <= room) {
+        key += pk;
+    } else {
+        const size_t hash_size = 16;
+        key += pk.substr(0, room - hash_size);
+        key += strprintf("%016" PRIx64, hash_region_hasher(primary_key.contents(), primary_key.size()));
+    }
+    rassert(key.size() <= MAX_KEY_SIZE);
+
+    return store_key_t(key);
+}
+
+/* Where the rows without a usable attribute are in an index. */
+key_range_t sindex_invalid_key_range() {
+    return key_range_t(key_range_t::closed, store_key_t(std::string(1, '\0')),
+                       key_range_t::open, store_key_t(std::string(1, '\x01')));
+}
+
+key_range_t sindex_key_range(const boost::optional<store_key_t> &lower, const boost::optional<store_key_t> &upper) {
+    /* Printed attributes are never empty, so this is past the invalid rows. */
+    store_key_t left(std::string(1, '\x01'));
+    if (lower) {
+        left = store_key_t(sindex_secondary_part(key_to_unescaped_str(*lower)));
+    }
+    if (!upper) {
+        return key_range_t(key_range_t::closed, left, key_range_t::none, store_key_t());
+    }
+    /* Every key whose attribute part is at most `upper`'s is less than this. */
+    std::string right = sindex_secondary_part(key_to_unescaped_str(*upper));
+    right.push_back('\x01');
+    return key_range_t(key_range_t::closed, left, key_range_t::open, store_key_t(right));
+}
+
+/* Each index counts the rows it has in `sindex_invalid_key_range()` in its
+superblock's metainfo. Indexes without any have no count at all. */
+const char *const SINDEX_INVALID_ROWS_METAINFO_KEY = "invalid_rows";
+
+int64_t get_sindex_invalid_rows(transaction_t *txn, buf_lock_t *sindex_superblock) {
+    std::vector<char> key(SINDEX_INVALID_ROWS_METAINFO_KEY, SINDEX_INVALID_ROWS_METAINFO_KEY + strlen(SINDEX_INVALID_ROWS_METAINFO_KEY));
+    std::vector<char> value;
+    if (!get_superblock_metainfo(txn, sindex_superblock, key, &value)) {
+        return 0;
+    }
+    int64_t count;
+    guarantee(value.size() == sizeof(count), "corrupted invalid row count in a secondary index superblock");
+    memcpy(&count, value.data(), sizeof(count));
+    return count;
+}
+
+void add_sindex_invalid_rows(transaction_t *txn, buf_lock_t *sindex_superblock, int64_t delta) {
+    int64_t count = get_sindex_invalid_rows(txn, sindex_superblock) + delta;
+    guarantee(count >= 0);
+    std::vector<char> key(SINDEX_INVALID_ROWS_METAINFO_KEY, SINDEX_INVALID_ROWS_METAINFO_KEY + strlen(SINDEX_INVALID_ROWS_METAINFO_KEY));
+    if (count == 0) {
+        delete_superblock_metainfo(txn, sindex_superblock, key);
+    } else {
+        const char *data = reinterpret_cast<const char *>(&count);
+        set_superblock_metainfo(txn, sindex_superblock, key, std::vector<char>(data, data + sizeof(count)));
+    }
+}
+
+/* Moves `primary_key`'s entry in each of the indexes from where `old_row` put
+it to where `new_row` puts it. Either row may be NULL, for an insertion or a
+deletion. */
+void rdb_update_sindexes(const secondary_index_map_t &sindexes, const store_key_t &primary_key,
+                         cJSON *old_row, boost::shared_ptr<scoped_cJSON_t> new_row,
+                         btree_slice_t *slice, repli_timestamp_t timestamp, transaction_t *txn) {
+    for (secondary_index_map_t::const_iterator it = sindexes.begin(); it != sindexes.end(); ++it) {
+        buf_lock_t sindex_buf(txn, it->second.superblock, rwi_write);
+        real_superblock_t sindex_superblock(&sindex_buf);
+        unreleasing_superblock_t superblock(&sindex_superblock);
+        int64_t invalid_rows_delta = 0;
+
+        if (old_row) {
+            store_key_t old_key = sindex_key(it->first, primary_key, old_row);
+            keyvalue_location_t<rdb_value_t> kv_location;
+            find_keyvalue_location_for_write(txn, &superblock, old_key.btree_key(), &kv_location,
+                                             &slice->root_eviction_priority, &slice->stats);
+            if (kv_location.value.has()) {
+                kv_location_delete(&kv_location, old_key, slice, timestamp, txn);
+                if (sindex_invalid_key_range().contains_key(old_key)) {
+                    --invalid_rows_delta;
+                }
+            }
+        }
+
+        if (new_row) {
+            store_key_t new_key = sindex_key(it->first, primary_key, new_row->get());
+            keyvalue_location_t<rdb_value_t> kv_location;
+            find_keyvalue_location_for_write(txn, &superblock, new_key.btree_key(), &kv_location,
+                                             &slice->root_eviction_priority, &slice->stats);
+            // Filling an index in can get to a row that a write already put there.
+            if (!kv_location.value.has() && sindex_invalid_key_range().contains_key(new_key)) {
+                ++invalid_rows_delta;
+            }
+            kv_location_set(&kv_location, new_key, new_row, slice, timestamp, txn);
+        }
+
+        if (invalid_rows_delta != 0) {
+            add_sindex_invalid_rows(txn, &sindex_buf, invalid_rows_delta);
+        }
+    }
+}
+
 void rdb_modify(const std::string &primary_key, const store_key_t &key, point_modify_ns::op_t op,
                 query_language::runtime_environment_t *env, const scopes_t &scopes, const backtrace_t &backtrace,
                 const Mapping &mapping,
                 btree_slice_t *slice, repli_timestamp_t timestamp,
-                transaction_t *txn, superblock_t *superblock, point_modify_response_t *response) {
+                transaction_t *txn, superblock_t *superblock, const secondary_index_map_t &sindexes,
+                point_modify_response_t *response) {
     try {
         keyvalue_location_t<rdb_value_t> kv_location;
         find_keyvalue_location_for_write(txn, superblock, key.btree_key(), &kv_location,
                                          &slice->root_eviction_priority, &slice->stats);
         boost::shared_ptr<scoped_cJSON_t> lhs;
-        if (!kv_location.value.has()) {
+        const bool kv_had_value = kv_location.value.has();
+        if (!kv_had_value) {
             lhs.reset(new scoped_cJSON_t(cJSON_CreateNull()));
         } else {
             lhs = get_data(kv_location.value.get(), txn);
@@ -182,9 +346,11 @@ void rdb_modify(const std::string &primary_key, const store_key_t &key, point_mo
         case point_modify_ns::MODIFIED: {
             guarantee(new_row);
             kv_location_set(&kv_location, key, new_row, slice, timestamp, txn);
+            rdb_update_sindexes(sindexes, key, kv_had_value ? lhs->get() : NULL, new_row, slice, timestamp, txn);
         } break;
         case point_modify_ns::DELETED: {
             kv_location_delete(&kv_location, key, slice, timestamp, txn);
+            rdb_update_sindexes(sindexes, key, lhs->get(), boost::shared_ptr<scoped_cJSON_t>(), slice, timestamp, txn);
         } break;
         case point_modify_ns::SKIPPED: break;
         case point_modify_ns::NOP: break;
@@ -200,13 +366,19 @@ void rdb_modify(const std::string &primary_key, const store_key_t &key, point_mo
 
 void rdb_set(const store_key_t &key, boost::shared_ptr<scoped_cJSON_t> data, bool overwrite,
              btree_slice_t *slice, repli_timestamp_t timestamp,
-             transaction_t *txn, superblock_t *superblock, point_write_response_t *response) {
+             transaction_t *txn, superblock_t *superblock, const secondary_index_map_t &sindexes,
+             point_write_response_t *response) {
     //block_size_t block_size = slice->cache()->get_block_size();
     keyvalue_location_t<rdb_value_t> kv_location;
     find_keyvalue_location_for_write(txn, superblock, key.btree_key(), &kv_location, &slice->root_eviction_priority, &slice->stats);
     bool had_value = kv_location.value.has();
     if (overwrite || !had_value) {
+        boost::shared_ptr<scoped_cJSON_t> old_data;
+        if (had_value && !sindexes.empty()) {
+            old_data = get_data(kv_location.value.get(), txn);
+        }
         kv_location_set(&kv_location, key, data, slice, timestamp, txn);
+        rdb_update_sindexes(sindexes, key, old_data ? old_data->get() : NULL, data, slice, timestamp, txn);
     }
     response->result = (had_value ? DUPLICATE : STORED);
 }
@@ -251,14 +423,31 @@ void rdb_backfill(btree_slice_t *slice, const key_range_t& key_range,
 }
 
 void rdb_delete(const store_key_t &key, btree_slice_t *slice, repli_timestamp_t timestamp,
-                transaction_t *txn, superblock_t *superblock, point_delete_response_t *response) {
+                transaction_t *txn, superblock_t *superblock, const secondary_index_map_t &sindexes,
+                point_delete_response_t *response) {
     keyvalue_location_t<rdb_value_t> kv_location;
     find_keyvalue_location_for_write(txn, superblock, key.btree_key(), &kv_location, &slice->root_eviction_priority, &slice->stats);
     bool exists = kv_location.value.has();
-    if (exists) kv_location_delete(&kv_location, key, slice, timestamp, txn);
+    if (exists) {
+        boost::shared_ptr<scoped_cJSON_t> old_data;
+        if (!sindexes.empty()) {
+            old_data = get_data(kv_location.value.get(), txn);
+        }
+        kv_location_delete(&kv_location, key, slice, timestamp, txn);
+        if (old_data) {
+            rdb_update_sindexes(sindexes, key, old_data->get(), boost::shared_ptr<scoped_cJSON_t>(), slice, timestamp, txn);
+        }
+    }
     response->result = (exists ? DELETED : MISSING);
 }
 
+struct rdb_value_deleter_t : public value_deleter_t {
+    void delete_value(transaction_t *_txn, void *_value) {
+        blob_t blob(static_cast<rdb_value_t *>(_value)->value_ref(), blob::btree_maxreflen);
+        blob.clear(_txn);
+    }
+};
+
 void rdb_erase_range(btree_slice_t *slice, key_tester_t *tester,
                        bool left_key_supplied, const store_key_t& left_key_exclusive,
                        bool right_key_supplied, const store_key_t& right_key_inclusive,
@@ -267,12 +456,7 @@ void rdb_erase_range(btree_slice_t *slice, key_tester_t *tester,
     value_sizer_t<rdb_value_t> rdb_sizer(slice->cache()->get_block_size());
     value_sizer_t<void> *sizer = &rdb_sizer;
 
-    struct : public value_deleter_t {
-        void delete_value(transaction_t *_txn, void *_value) {
-            blob_t blob(static_cast<rdb_value_t *>(_value)->value_ref(), blob::btree_maxreflen);
-            blob.clear(_txn);
-        }
-    } deleter;
+    rdb_value_deleter_t deleter;
 
     btree_erase_range_generic(sizer, slice, tester, &deleter,
         left_key_supplied ? left_key_exclusive.btree_key() : NULL,
@@ -280,9 +464,39 @@ void rdb_erase_range(btree_slice_t *slice, key_tester_t *tester,
         txn, superblock);
 }
 
+/* Takes the rows that are about to be erased out of the secondary indexes. */
+class sindex_erase_range_callback_t : public depth_first_traversal_callback_t {
+public:
+    sindex_erase_range_callback_t(key_tester_t *_tester, const secondary_index_map_t *_sindexes,
+                                  btree_slice_t *_slice, transaction_t *_txn)
+        : tester(_tester), sindexes(_sindexes), slice(_slice), txn(_txn) { }
+
+    bool handle_pair(const btree_key_t *key, const void *value) {
+        if (tester->key_should_be_erased(key)) {
+            boost::shared_ptr<scoped_cJSON_t> row = get_data(static_cast<const rdb_value_t *>(value), txn);
+            rdb_update_sindexes(*sindexes, store_key_t(key), row->get(), boost::shared_ptr<scoped_cJSON_t>(),
+                                slice, repli_timestamp_t::distant_past, txn);
+        }
+        return true;
+    }
+
+private:
+    key_tester_t *tester;
+    const secondary_index_map_t *sindexes;
+    btree_slice_t *slice;
+    transaction_t *txn;
+};
+
 void rdb_erase_range(btree_slice_t *slice, key_tester_t *tester,
                        const key_range_t &keys,
-                       transaction_t *txn, superblock_t *superblock) {
+                       transaction_t *txn, superblock_t *superblock,
+                       const secondary_index_map_t &sindexes) {
+    if (!sindexes.empty()) {
+        unreleasing_superblock_t unreleasing(superblock);
+        sindex_erase_range_callback_t callback(tester, &sindexes, slice, txn);
+        btree_depth_first_traversal(slice, txn, &unreleasing, keys, &callback);
+    }
+
     store_key_t left_exclusive(keys.left);
     store_key_t right_inclusive(keys.right.key);
 
@@ -294,28 +508,207 @@ void rdb_erase_range(btree_slice_t *slice, key_tester_t *tester,
     rdb_erase_range(slice, tester, left_key_supplied, left_exclusive, right_key_supplied, right_inclusive, txn, superblock);
 }
 
-size_t estimate_rget_response_size(const boost::shared_ptr<scoped_cJSON_t> &/*json*/) {
-    // TODO: don't be stupid, be a smarty, come and join the nazy
-    // party (json size estimation will be much easier once we switch
-    // to bson -- fuck it for now).
-    return 250;
+/* Puts the rows of the primary btree in an index, up to `max_rows` of them,
+and remembers where it stopped. */
+class sindex_fill_callback_t : public depth_first_traversal_callback_t {
+public:
+    sindex_fill_callback_t(const secondary_index_map_t *_sindexes, int _max_rows, btree_slice_t *_slice, transaction_t *_txn)
+        : sindexes(_sindexes), rows_left(_max_rows), slice(_slice), txn(_txn) { }
+
+    bool handle_pair(const btree_key_t *key, const void *value) {
+        if (rows_left == 0) {
+            stopped_at = store_key_t(key);
+            return false;
+        }
+        --rows_left;
+        boost::shared_ptr<scoped_cJSON_t> row = get_data(static_cast<const rdb_value_t *>(value), txn);
+        rdb_update_sindexes(*sindexes, store_key_t(key), NULL, row,
+                            slice, repli_timestamp_t::distant_past, txn);
+        return true;
+    }
+
+    store_key_t stopped_at;
+
+private:
+    const secondary_index_map_t *sindexes;
+    int rows_left;
+    btree_slice_t *slice;
+    transaction_t *txn;
+};
+
+bool rdb_sindex_create(const std::string &id, UNUSED btree_slice_t *slice, transaction_t *txn,
+                       real_superblock_t *superblock) {
+    secondary_index_map_t sindexes;
+    get_secondary_indexes(txn, superblock->get(), &sindexes);
+    if (sindexes.find(id) != sindexes.end()) {
+        return false;
+    }
+
+    secondary_index_t sindex;
+    sindex.superblock = create_secondary_index_superblock(txn);
+    sindexes[id] = sindex;
+    set_secondary_indexes(txn, superblock->get(), sindexes);
+    return true;
 }
 
+bool rdb_sindex_fill_step(const std::string &id, block_id_t *sindex_superblock, store_key_t *cursor, int max_rows,
+                          btree_slice_t *slice, transaction_t *txn, real_superblock_t *superblock) {
+    secondary_index_map_t sindexes;
+    get_secondary_indexes(txn, superblock->get(), &sindexes);
+    secondary_index_map_t::iterator it = sindexes.find(id);
+    if (it == sindexes.end() || it->second.ready) {
+        return false;
+    }
+    if (*sindex_superblock == NULL_BLOCK_ID) {
+        *sindex_superblock = it->second.superblock;
+    } else if (*sindex_superblock != it->second.superblock) {
+        /* The index was dropped and created again, and whoever created it
+        again is filling it in. */
+        return false;
+    }
+
+    secondary_index_map_t filling;
+    filling[id] = it->second;
+    sindex_fill_callback_t callback(&filling, max_rows, slice, txn);
+    {
+        unreleasing_superblock_t unreleasing(superblock);
+        key_range_t rest(key_range_t::closed, *cursor, key_range_t::none, store_key_t());
+        if (!btree_depth_first_traversal(slice, txn, &unreleasing, rest, &callback)) {
+            *cursor = callback.stopped_at;
+            return true;
+        }
+    }
+
+    it->second.ready = true;
+    set_secondary_indexes(txn, superblock->get(), sindexes);
+    return false;
+}
+
+bool rdb_sindex_drop(const std::string &id, btree_slice_t *slice, transaction_t *txn,
+                     real_superblock_t *superblock) {
+    secondary_index_map_t sindexes;
+    get_secondary_indexes(txn, superblock->get(), &sindexes);
+    secondary_index_map_t::iterator it = sindexes.find(id);
+    if (it == sindexes.end()) {
+        return false;
+    }
+
+    const block_id_t sindex_superblock = it->second.superblock;
+    sindexes.erase(it);
+    set_secondary_indexes(txn, superblock->get(), sindexes);
+
+    value_sizer_t<rdb_value_t> sizer(slice->cache()->get_block_size());
+    rdb_value_deleter_t deleter;
+    delete_secondary_index(txn, &sizer, &deleter, sindex_superblock);
+    return true;
+}
+
+size_t estimate_rget_response_size(const boost::shared_ptr<scoped_cJSON_t> &json) {
+    return query_language::json_memory_size(json->get());
+}
+
+/* Whether a row that we found in a secondary index really belongs in the
+read. Index keys only have a prefix of the attribute, and the index covers the
+whole store rather than just the region we're reading. */
+bool sindex_row_matches(const binary_json_t &row, const rdb_protocol_t::sindex_rangespec_t &sindex,
+                        const rdb_protocol_t::region_t &region) {
+    binary_json_t attr, pk;
+    if (row.type() != cJSON_Object || !row.get_field(sindex.id, &attr) || !row.get_field(sindex.primary_key, &pk)) {
+        return false;
+    }
+    if (attr.type() != cJSON_Number && attr.type() != cJSON_String) {
+        return false;
+    }
+
+    scoped_cJSON_t attr_json(attr.to_cjson());
+    std::string printed = cJSON_print_lexicographic(attr_json.get());
+    const uint8_t *printed_data = reinterpret_cast<const uint8_t *>(printed.data());
+    if (sindex.lower && sized_strcmp(printed_data, printed.size(), sindex.lower->contents(), sindex.lower->size()) < 0) {
+        return false;
+    }
+    if (sindex.upper && sized_strcmp(printed_data, printed.size(), sindex.upper->contents(), sindex.upper->size()) > 0) {
+        return false;
+    }
+
+    scoped_cJSON_t pk_json(pk.to_cjson());
+    store_key_t key(cJSON_print_lexicographic(pk_json.get()));
+    uint64_t hash = hash_region_hasher(key.contents(), key.size());
+    return region.beg <= hash && hash < region.end && region.inner.contains_key(key);
+}
+
+/* Looks for a row in `region` that an index only has because it doesn't have
+a usable attribute, and keeps what's wrong with it in `error`. */
+class sindex_invalid_row_callback_t : public depth_first_traversal_callback_t {
+public:
+    sindex_invalid_row_callback_t(const rdb_protocol_t::sindex_rangespec_t &_sindex,
+                                  const rdb_protocol_t::region_t &_region, transaction_t *_txn)
+        : sindex(_sindex), region(_region), txn(_txn) { }
+
+    bool handle_pair(UNUSED const btree_key_t *key, const void *value) {
+        boost::shared_ptr<scoped_cJSON_t> row = get_data(static_cast<const rdb_value_t *>(value), txn);
+        cJSON *pk = row->GetObjectItem(sindex.primary_key.c_str());
+        guarantee(pk);
+        store_key_t primary_key(cJSON_print_lexicographic(pk));
+        uint64_t hash = hash_region_hasher(primary_key.contents(), primary_key.size());
+        if (region.beg <= hash && hash < region.end && region.inner.contains_key(primary_key)) {
+            error = range_row_error(row->get(), sindex.id);
+            return false;
+        }
+        return true;
+    }
+
+    std::string error;
+
+private:
+    const rdb_protocol_t::sindex_rangespec_t &sindex;
+    const rdb_protocol_t::region_t &region;
+    transaction_t *txn;
+};
+
 class rdb_rget_depth_first_traversal_callback_t : public depth_first_traversal_callback_t {
 public:
+    /* `sindex` and `region` are only needed for reads through a secondary
+    index, which have to check each row with `sindex_row_matches()`. */
     rdb_rget_depth_first_traversal_callback_t(transaction_t *txn, query_language::runtime_environment_t *_env,
                                               const rdb_protocol_details::transform_t &_transform,
                                               boost::optional<rdb_protocol_details::terminal_t> _terminal,
-                                              const key_range_t &range,
-                                              rget_read_response_t *_response)
-        : bad_init(false), transaction(txn), response(_response), cumulative_size(0),
-          env(_env), transform(_transform), terminal(_terminal)
+                                              const key_range_t &range, size_t _max_chunk_size,
+                                              rget_read_response_t *_response,
+                                              const rdb_protocol_t::sindex_rangespec_t *_sindex = NULL,
+                                              const rdb_protocol_t::region_t *_region = NULL)
+        : bad_init(false), transaction(txn), response(_response), cumulative_size(0), max_chunk_size(_max_chunk_size),
+          env(_env), transform(_transform), terminal(_terminal),
+          counting(terminal && boost::get<rdb_protocol_details::Length>(&terminal->variant)),
+          batching(false), sindex(_sindex), region(_region)
     {
+        for (rdb_protocol_details::transform_t::iterator it = transform.begin(); it != transform.end(); ++it) {
+            if (query_language::is_batched_transform(*it)) {
+                batching = true;
+            }
+        }
+
+        /* The leading filters and mappings that can run on the stored value
+        without decoding it. */
+        for (rdb_protocol_details::transform_t::iterator it = transform.begin(); it != transform.end(); ++it) {
+            in_place_transform_t *in_place = in_place_transform_t::compile(*it);
+            if (!in_place) {
+                break;
+            }
+            in_place_transforms.push_back(boost::shared_ptr<in_place_transform_t>(in_place));
+            if (!in_place->is_filter()) {
+                // A mapping's output is a cJSON value, so it ends the prefix.
+                break;
+            }
+        }
+
         try {
             response->last_considered_key = range.left;
 
             if (terminal) {
                 boost::apply_visitor(query_language::terminal_initializer_visitor_t(&response->result, env, terminal->scopes, terminal->backtrace), terminal->variant);
+                if (const Builtin_GroupedMapReduce *gmr = boost::get<Builtin_GroupedMapReduce>(&terminal->variant)) {
+                    groups.init(new query_language::grouped_map_reduce_t(*gmr, env, terminal->scopes, terminal->backtrace));
+                }
             }
         } catch (const query_language::runtime_exc_t &e) {
             /* Evaluation threw so we're not going to be accepting any more requests. */
@@ -332,16 +725,91 @@ public:
                 response->last_considered_key = store_key;
             }
 
+            /* Small values live in the leaf, which we hold for as long as
+            we're looking at its pairs, so we read them right there. Rows that
+            the in place filters drop then never cost us an allocation. */
             const rdb_value_t *rdb_value = reinterpret_cast<const rdb_value_t *>(value);
+            const char *inline_data;
+            int64_t inline_size;
+            blob_acq_t acq_group;
+            buffer_group_t buffer_group;
+            const bool is_inline = blob::inline_value(rdb_value->value_ref(), blob::btree_maxreflen, &inline_data, &inline_size);
+            if (is_inline) {
+                source.reset(inline_data, inline_size);
+            } else {
+                blob_t blob(const_cast<rdb_value_t *>(rdb_value)->value_ref(), blob::btree_maxreflen);
+                blob.expose_all(transaction, rwi_read, &buffer_group, &acq_group);
+                source.reset(const_view(&buffer_group));
+            }
+
+            if (sindex) {
+                // Index entries are always written in binary json.
+                guarantee(source.is_binary_json());
+                if (!sindex_row_matches(binary_json_t::root(&source), *sindex, *region)) {
+                    return true;
+                }
+            }
 
             json_list_t data;
-            data.push_back(get_data(rdb_value, transaction));
 
-            //Apply transforms to the data
+            //Run what we can of the transforms on the stored value
             typedef rdb_protocol_details::transform_t::iterator tit_t;
-            for (tit_t it  = transform.begin();
-                       it != transform.end();
-                       ++it) {
+            tit_t it = transform.begin();
+            if (source.is_binary_json()) {
+                binary_json_t row = binary_json_t::root(&source);
+                for (size_t i = 0; i < in_place_transforms.size(); ++i) {
+                    const in_place_transform_t &in_place = *in_place_transforms[i];
+                    if (in_place.is_filter()) {
+                        in_place_transform_t::filter_result_t res = in_place.apply_filter(row);
+                        if (res == in_place_transform_t::filter_drop) {
+                            return true;
+                        } else if (res == in_place_transform_t::filter_give_up) {
+                            break;
+                        }
+                    } else {
+                        boost::shared_ptr<scoped_cJSON_t> mapped;
+                        if (in_place.apply_mapping(row, &mapped)) {
+                            data.push_back(mapped);
+                            ++it;
+                        }
+                        break;
+                    }
+                    ++it;
+                }
+            }
+            if (data.empty()) {
+                if (it == transform.end() && counting) {
+                    // Counting doesn't look at the row, so don't decode it.
+                    rget_read_response_t::length_t *length = boost::get<rget_read_response_t::length_t>(&response->result);
+                    guarantee(length);
+                    ++length->length;
+                    return true;
+                }
+                if (source.is_binary_json()) {
+                    data.push_back(boost::shared_ptr<scoped_cJSON_t>(new scoped_cJSON_t(binary_json_t::root(&source).to_cjson())));
+                } else {
+                    if (is_inline) {
+                        buffer_group.add_buffer(inline_size, inline_data);
+                    }
+                    data.push_back(get_data(const_view(&buffer_group)));
+                }
+            }
+
+            if (batching) {
+                /* The rest of the transforms wait until we have a batch of rows
+                to send to the JS worker. */
+                size_t next_transform = std::distance(transform.begin(), it);
+                for (json_list_t::iterator jt = data.begin(); jt != data.end(); ++jt) {
+                    pending.push_back(pending_row_t(store_key, *jt, next_transform));
+                }
+                if (pending.size() < JS_CALL_BATCH_SIZE) {
+                    return true;
+                }
+                return flush_pending();
+            }
+
+            //Apply the rest of the transforms to the data
+            for (; it != transform.end(); ++it) {
                 json_list_t tmp;
 
                 for (json_list_t::iterator jt  = data.begin();
@@ -353,49 +821,212 @@ public:
                 data.splice(data.begin(), tmp);
             }
 
-            if (!terminal) {
-                typedef rget_read_response_t::stream_t stream_t;
-                stream_t *stream = boost::get<stream_t>(&response->result);
-                guarantee(stream);
-                for (json_list_t::iterator it =  data.begin();
-                                           it != data.end();
-                                           ++it) {
-                    stream->push_back(std::make_pair(key, *it));
-                    cumulative_size += estimate_rget_response_size(*it);
-                }
-
-                return cumulative_size < rget_max_chunk_size;
-            } else {
-                for (json_list_t::iterator jt  = data.begin();
-                                           jt != data.end();
-                                           ++jt) {
-                    boost::apply_visitor(query_language::terminal_visitor_t(*jt, env, terminal->scopes, terminal->backtrace, &response->result), terminal->variant);
-                }
-                return true;
-            }
+            return emit(store_key, data);
         } catch (const query_language::runtime_exc_t &e) {
             /* Evaluation threw so we're not going to be accepting any more requests. */
             response->result = e;
             return false;
         }
     }
+
+    /* Adds the rows that the row at `key` turned into to the response. Returns
+    false once the response is big enough. */
+    bool emit(const store_key_t &key, const json_list_t &data) {
+        if (!terminal) {
+            typedef rget_read_response_t::stream_t stream_t;
+            stream_t *stream = boost::get<stream_t>(&response->result);
+            guarantee(stream);
+            for (json_list_t::const_iterator it =  data.begin();
+                                             it != data.end();
+                                             ++it) {
+                stream->push_back(std::make_pair(key, *it));
+                cumulative_size += estimate_rget_response_size(*it);
+            }
+
+            return cumulative_size < max_chunk_size;
+        } else if (groups.has()) {
+            for (json_list_t::const_iterator jt  = data.begin();
+                                             jt != data.end();
+                                             ++jt) {
+                groups->add_row(*jt);
+            }
+            return true;
+        } else {
+            for (json_list_t::const_iterator jt  = data.begin();
+                                             jt != data.end();
+                                             ++jt) {
+                boost::apply_visitor(query_language::terminal_visitor_t(*jt, env, terminal->scopes, terminal->backtrace, &response->result), terminal->variant);
+            }
+            return true;
+        }
+    }
+
+    /* Runs the pending rows through the rest of their transforms, one
+    transform at a time so that JavaScript ones see the whole batch, and then
+    emits them in key order. */
+    bool flush_pending() {
+        std::vector<pending_row_t> rows;
+        rows.swap(pending);
+
+        size_t index = 0;
+        for (rdb_protocol_details::transform_t::iterator it = transform.begin(); it != transform.end(); ++it, ++index) {
+            /* Rows that an in place filter let through skip the transforms
+            before `next_transform`. */
+            std::vector<boost::shared_ptr<scoped_cJSON_t> > in;
+            for (size_t i = 0; i < rows.size(); ++i) {
+                if (rows[i].next_transform == index) {
+                    in.push_back(rows[i].json);
+                }
+            }
+            if (in.empty()) {
+                continue;
+            }
+
+            std::vector<json_list_t> out;
+            query_language::transform_rows(*it, in, env, &out);
+
+            std::vector<pending_row_t> next_rows;
+            size_t j = 0;
+            for (size_t i = 0; i < rows.size(); ++i) {
+                if (rows[i].next_transform != index) {
+                    next_rows.push_back(rows[i]);
+                    continue;
+                }
+                for (json_list_t::iterator jt = out[j].begin(); jt != out[j].end(); ++jt) {
+                    next_rows.push_back(pending_row_t(rows[i].key, *jt, index + 1));
+                }
+                ++j;
+            }
+            rows.swap(next_rows);
+        }
+
+        for (size_t begin = 0; begin < rows.size();) {
+            json_list_t data;
+            size_t end = begin;
+            while (end < rows.size() && rows[end].key == rows[begin].key) {
+                data.push_back(rows[end].json);
+                ++end;
+            }
+            if (!emit(rows[begin].key, data)) {
+                /* We considered rows past this one, but they didn't make it
+                into the response, so the next read has to start over from
+                here. */
+                response->last_considered_key = rows[begin].key;
+                return false;
+            }
+            begin = end;
+        }
+        return true;
+    }
+
+    /* Hands the grouped map-reduce's groups, if there is one, over to the
+    response. */
+    void finish() {
+        if (!pending.empty()) {
+            try {
+                flush_pending();
+            } catch (const query_language::runtime_exc_t &e) {
+                response->result = e;
+                return;
+            }
+        }
+        if (groups.has()) {
+            if (rget_read_response_t::groups_t *out = boost::get<rget_read_response_t::groups_t>(&response->result)) {
+                groups->finish(out);
+            }
+        }
+    }
+
     bool bad_init;
     transaction_t *transaction;
     rget_read_response_t *response;
     size_t cumulative_size;
+    size_t max_chunk_size;
     query_language::runtime_environment_t *env;
     rdb_protocol_details::transform_t transform;
+    std::vector<boost::shared_ptr<in_place_transform_t> > in_place_transforms;
     boost::optional<rdb_protocol_details::terminal_t> terminal;
+    bool counting;
+    scoped_ptr_t<query_language::grouped_map_reduce_t> groups;
+
+    /* With JavaScript transforms, rows wait here for the rest of their
+    transforms until there are enough of them to be worth a round-trip to the
+    JS worker. */
+    struct pending_row_t {
+        pending_row_t(const store_key_t &_key, const boost::shared_ptr<scoped_cJSON_t> &_json, size_t _next_transform)
+            : key(_key), json(_json), next_transform(_next_transform) { }
+        store_key_t key;
+        boost::shared_ptr<scoped_cJSON_t> json;
+        size_t next_transform;
+    };
+    bool batching;
+    std::vector<pending_row_t> pending;
+
+    const rdb_protocol_t::sindex_rangespec_t *sindex;
+    const rdb_protocol_t::region_t *region;
+
+    /* Reused for every row, so that it only allocates for the first few. */
+    binary_json_source_t source;
 };
 
 void rdb_rget_slice(btree_slice_t *slice, const key_range_t &range,
                     transaction_t *txn, superblock_t *superblock,
                     query_language::runtime_environment_t *env, const rdb_protocol_details::transform_t &transform,
-                    boost::optional<rdb_protocol_details::terminal_t> terminal, rget_read_response_t *response) {
-    rdb_rget_depth_first_traversal_callback_t callback(txn, env, transform, terminal, range, response);
+                    boost::optional<rdb_protocol_details::terminal_t> terminal,
+                    size_t max_chunk_size, rget_read_response_t *response) {
+    rdb_rget_depth_first_traversal_callback_t callback(txn, env, transform, terminal, range, max_chunk_size, response);
     btree_depth_first_traversal(slice, txn, superblock, range, &callback);
+    callback.finish();
+
+    if (callback.cumulative_size >= max_chunk_size) {
+        response->truncated = true;
+    } else {
+        response->truncated = false;
+    }
+}
+
+void rdb_rget_secondary_slice(btree_slice_t *slice, const rdb_protocol_t::sindex_rangespec_t &sindex,
+                              const rdb_protocol_t::region_t &region,
+                              transaction_t *txn, real_superblock_t *superblock,
+                              query_language::runtime_environment_t *env, const rdb_protocol_details::transform_t &transform,
+                              boost::optional<rdb_protocol_details::terminal_t> terminal,
+                              size_t max_chunk_size, rget_read_response_t *response) {
+    secondary_index_map_t sindexes;
+    get_secondary_indexes(txn, superblock->get(), &sindexes);
+    superblock->release();
+
+    secondary_index_map_t::const_iterator it = sindexes.find(sindex.id);
+    if (it == sindexes.end() || !it->second.ready) {
+        /* The index is in the metadata but hasn't made it here yet, or it's
+        still being filled in. */
+        response->last_considered_key = sindex.range.left;
+        response->truncated = false;
+        response->result = query_language::runtime_exc_t(strprintf("Index on `%s` is not ready yet.", sindex.id.c_str()),
+                                                         query_language::backtrace_t());
+        return;
+    }
+
+    buf_lock_t sindex_buf(txn, it->second.superblock, rwi_read);
+    real_superblock_t sindex_superblock(&sindex_buf);
+
+    /* A scan would fail on these rows, so we do too. */
+    if (get_sindex_invalid_rows(txn, &sindex_buf) > 0) {
+        unreleasing_superblock_t unreleasing(&sindex_superblock);
+        sindex_invalid_row_callback_t invalid(sindex, region, txn);
+        btree_depth_first_traversal(slice, txn, &unreleasing, sindex_invalid_key_range(), &invalid);
+        if (!invalid.error.empty()) {
+            response->last_considered_key = sindex.range.left;
+            response->truncated = false;
+            response->result = query_language::runtime_exc_t(invalid.error, sindex.backtrace);
+            return;
+        }
+    }
+
+    rdb_rget_depth_first_traversal_callback_t callback(txn, env, transform, terminal, sindex.range, max_chunk_size, response, &sindex, &region);
+    btree_depth_first_traversal(slice, txn, &sindex_superblock, sindex.range, &callback);
+    callback.finish();
 
-    if (callback.cumulative_size >= rget_max_chunk_size) {
+    if (callback.cumulative_size >= max_chunk_size) {
         response->truncated = true;
     } else {
         response->truncated = false;
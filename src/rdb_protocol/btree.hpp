@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "backfill_progress.hpp"
+#include "btree/secondary_operations.hpp"
 #include "rdb_protocol/protocol.hpp"
 
 class key_tester_t;
@@ -20,6 +21,9 @@ typedef rdb_protocol_t::read_response_t read_response_t;
 typedef rdb_protocol_t::point_read_t point_read_t;
 typedef rdb_protocol_t::point_read_response_t point_read_response_t;
 
+typedef rdb_protocol_t::multi_point_read_t multi_point_read_t;
+typedef rdb_protocol_t::multi_point_read_response_t multi_point_read_response_t;
+
 typedef rdb_protocol_t::rget_read_t rget_read_t;
 typedef rdb_protocol_t::rget_read_response_t rget_read_response_t;
 
@@ -44,7 +48,9 @@ namespace query_language {
 
 class parallel_traversal_progress_t;
 
-static const size_t rget_max_chunk_size = MEGABYTE;
+/* Secondary index keys start with at most this much of the indexed attribute,
+which leaves room for the primary key that follows it. */
+static const int MAX_SINDEX_SECONDARY_SIZE = 100;
 
 bool btree_value_fits(block_size_t bs, int data_length, const rdb_value_t *value);
 
@@ -78,15 +84,25 @@ private:
 
 void rdb_get(const store_key_t &key, btree_slice_t *slice, transaction_t *txn, superblock_t *superblock, point_read_response_t *response);
 
+/* Reads all of `keys` (which must be sorted) in one pass over the tree. */
+void rdb_multi_get(const std::vector<store_key_t> &keys, btree_slice_t *slice, transaction_t *txn, superblock_t *superblock, multi_point_read_response_t *response);
+
+/* The writes keep every index in `sindexes` up to date. If there are any, the
+caller must hold on to the primary superblock until the write is done (see
+`unreleasing_superblock_t`), because the index superblocks are locked after the
+primary btree's leaf. */
+
 void rdb_modify(const std::string &primary_key, const store_key_t &key, const point_modify_ns::op_t op,
                 query_language::runtime_environment_t *env, const scopes_t &scopes, const backtrace_t &backtrace,
                 const Mapping &mapping,
                 btree_slice_t *slice, repli_timestamp_t timestamp,
-                transaction_t *txn, superblock_t *superblock, point_modify_response_t *response);
+                transaction_t *txn, superblock_t *superblock, const secondary_index_map_t &sindexes,
+                point_modify_response_t *response);
 
 void rdb_set(const store_key_t &key, boost::shared_ptr<scoped_cJSON_t> data, bool overwrite,
              btree_slice_t *slice, repli_timestamp_t timestamp,
-             transaction_t *txn, superblock_t *superblock, point_write_response_t *response);
+             transaction_t *txn, superblock_t *superblock, const secondary_index_map_t &sindexes,
+             point_write_response_t *response);
 
 
 class rdb_backfill_callback_t {
@@ -106,13 +122,47 @@ void rdb_backfill(btree_slice_t *slice, const key_range_t& key_range,
         THROWS_ONLY(interrupted_exc_t);
 
 
-void rdb_delete(const store_key_t &key, btree_slice_t *slice, repli_timestamp_t timestamp, transaction_t *txn, superblock_t *superblock, point_delete_response_t *response);
+void rdb_delete(const store_key_t &key, btree_slice_t *slice, repli_timestamp_t timestamp,
+                transaction_t *txn, superblock_t *superblock, const secondary_index_map_t &sindexes,
+                point_delete_response_t *response);
 
 void rdb_erase_range(btree_slice_t *slice, key_tester_t *tester,
                                  const key_range_t &keys,
-                                 transaction_t *txn, superblock_t *superblock);
+                                 transaction_t *txn, superblock_t *superblock,
+                                 const secondary_index_map_t &sindexes);
+
+/* SECONDARY INDEXES */
+
+/* The part of an index that holds the rows whose attribute prints between
+`lower` and `upper`, plus some rows around the edges that only share a prefix
+with the bounds; readers have to check the rows they find. */
+key_range_t sindex_key_range(const boost::optional<store_key_t> &lower, const boost::optional<store_key_t> &upper);
+
+/* How many rows the index whose superblock is `sindex_superblock` has without a
+usable attribute. Reads through the index only look for them when there are
+some, because a scan would fail on them. */
+int64_t get_sindex_invalid_rows(transaction_t *txn, buf_lock_t *sindex_superblock);
+
+/* Create the index on the attribute `id`. Returns false if there already was
+one. The index isn't ready until `rdb_sindex_fill_step()` has put the rows that
+are already in the btree in it. */
+bool rdb_sindex_create(const std::string &id, btree_slice_t *slice, transaction_t *txn,
+                       real_superblock_t *superblock);
+
+/* Puts up to `max_rows` more rows, starting from `*cursor`, in the index on
+`id`, and marks the index as ready once it has them all. Returns true if there
+is more to do. `*sindex_superblock` starts out as `NULL_BLOCK_ID`, and keeps
+track of which index we're filling in, in case it gets dropped and created
+again in between steps. */
+bool rdb_sindex_fill_step(const std::string &id, block_id_t *sindex_superblock, store_key_t *cursor, int max_rows,
+                          btree_slice_t *slice, transaction_t *txn, real_superblock_t *superblock);
+
+/* Returns false if there was no such index. */
+bool rdb_sindex_drop(const std::string &id, btree_slice_t *slice, transaction_t *txn,
+                     real_superblock_t *superblock);
 
 /* RGETS */
+/* How many bytes `json` counts for against an rget's `max_chunk_size`. */
 size_t estimate_rget_response_size(const boost::shared_ptr<scoped_cJSON_t> &json);
 
 struct rget_response_t {
@@ -123,7 +173,18 @@ struct rget_response_t {
 void rdb_rget_slice(btree_slice_t *slice, const key_range_t &range,
                     transaction_t *txn, superblock_t *superblock,
                     query_language::runtime_environment_t *env, const rdb_protocol_details::transform_t &transform,
-                    boost::optional<rdb_protocol_details::terminal_t> terminal, rget_read_response_t *response);
+                    boost::optional<rdb_protocol_details::terminal_t> terminal,
+                    size_t max_chunk_size, rget_read_response_t *response);
+
+/* Reads `sindex.range` of the index on `sindex.id`, skipping the rows that
+don't match `sindex` or that aren't in `region`. The primary superblock is only
+needed to find the index, and is released right away. */
+void rdb_rget_secondary_slice(btree_slice_t *slice, const rdb_protocol_t::sindex_rangespec_t &sindex,
+                              const rdb_protocol_t::region_t &region,
+                              transaction_t *txn, real_superblock_t *superblock,
+                              query_language::runtime_environment_t *env, const rdb_protocol_details::transform_t &transform,
+                              boost::optional<rdb_protocol_details::terminal_t> terminal,
+                    size_t max_chunk_size, rget_read_response_t *response);
 
 void rdb_distribution_get(btree_slice_t *slice, int max_depth, const store_key_t &left_key,
                           transaction_t *txn, superblock_t *superblock, distribution_read_response_t *response);
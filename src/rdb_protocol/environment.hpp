@@ -3,6 +3,7 @@
 #define RDB_PROTOCOL_ENVIRONMENT_HPP_
 
 #include <map>
+#include <string>
 
 #include "clustering/administration/database_metadata.hpp"
 #include "clustering/administration/metadata.hpp"
@@ -25,6 +26,8 @@ public:
         boost::shared_ptr<semilattice_readwrite_view_t<cluster_semilattice_metadata_t> >
             _semilattice_metadata,
         directory_read_manager_t<cluster_directory_metadata_t> *_directory_read_manager,
+        io_backender_t *_io_backender,
+        const std::string &_spill_path,
         boost::shared_ptr<js::runner_t> _js_runner,
         signal_t *_interruptor,
         uuid_t _this_machine)
@@ -34,6 +37,8 @@ public:
           databases_semilattice_metadata(_databases_semilattice_metadata),
           semilattice_metadata(_semilattice_metadata),
           directory_read_manager(_directory_read_manager),
+          io_backender(_io_backender),
+          spill_path(_spill_path),
           js_runner(_js_runner),
           interruptor(_interruptor),
           this_machine(_this_machine) {
@@ -58,6 +63,7 @@ public:
           databases_semilattice_metadata(_databases_semilattice_metadata),
           semilattice_metadata(_semilattice_metadata),
           directory_read_manager(NULL),
+          io_backender(NULL),
           js_runner(_js_runner),
           interruptor(_interruptor),
           this_machine(_this_machine) {
@@ -75,6 +81,10 @@ public:
         semilattice_metadata;
     directory_read_manager_t<cluster_directory_metadata_t> *directory_read_manager;
 
+    // Where big sorts spill to.  `io_backender` is `NULL` if they can't.
+    io_backender_t *io_backender;
+    std::string spill_path;
+
 private:
     // Ideally this would be a scoped_ptr_t<js::runner_t>. We used to copy
     // `runtime_environment_t` to capture scope, which is why this is a
@@ -0,0 +1,401 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#include "rdb_protocol/in_place_transform.hpp"
+
+#include <math.h>
+
+#include "rdb_protocol/rdb_protocol_json.hpp"
+
+/* A value that an `in_place_term_t` evaluates to: either a part of the row, or
+a cJSON value that the term owns. */
+struct in_place_value_t {
+    in_place_value_t() : json(NULL) { }
+    explicit in_place_value_t(const binary_json_t &_binary) : json(NULL), binary(_binary) { }
+    explicit in_place_value_t(cJSON *_json) : json(_json) { }
+
+    int type() const { return json ? json->type : binary.type(); }
+
+    cJSON *json;
+    binary_json_t binary;
+};
+
+/* Compares like the `COMPARE` builtin does. */
+static int compare_values(const in_place_value_t &x, const in_place_value_t &y) {
+    if (x.json && y.json) {
+        return query_language::json_cmp(x.json, y.json);
+    } else if (y.json) {
+        return x.binary.compare(y.json);
+    } else if (x.json) {
+        return -y.binary.compare(x.json);
+    } else {
+        scoped_cJSON_t decoded(y.binary.to_cjson());
+        return x.binary.compare(decoded.get());
+    }
+}
+
+class in_place_term_t {
+public:
+    enum kind_t {
+        term_constant,
+        term_row,
+        term_getattr,
+        term_hasattr,
+        term_pickattrs,
+        term_not,
+        term_all,
+        term_any,
+        term_compare
+    };
+
+    /* Returns an empty pointer if `term` can't be evaluated in place. `arg` is
+    the name that the predicate or mapping gives the row. */
+    static boost::shared_ptr<in_place_term_t> compile(const Term &term, const std::string &arg);
+
+    /* Returns false if evaluating the term would throw. */
+    bool eval(const binary_json_t &row, in_place_value_t *out) const;
+
+    /* Like `eval()`, but builds a new cJSON value, which lets `PICKATTRS` be
+    evaluated too. */
+    bool eval_mapping(const binary_json_t &row, cJSON **out) const;
+
+private:
+    explicit in_place_term_t(kind_t _kind) : kind(_kind) { }
+
+    static boost::shared_ptr<in_place_term_t> make_constant(cJSON *json);
+    static boost::shared_ptr<in_place_term_t> compile_call(const Term::Call &call, const std::string &arg);
+
+    bool eval_object(const binary_json_t &row, binary_json_t *out) const;
+    bool eval_bool(const binary_json_t &row, size_t i, bool *out) const;
+
+    kind_t kind;
+
+    /* For `term_constant`, and the results of the terms that evaluate to
+    booleans. */
+    scoped_cJSON_t value;
+    scoped_cJSON_t true_value, false_value;
+
+    /* For `term_getattr` and `term_hasattr`, `attrs[0]` is the attribute; for
+    `term_pickattrs` it's all of them. */
+    std::vector<std::string> attrs;
+    Builtin::Comparison comparison;
+    std::vector<boost::shared_ptr<in_place_term_t> > args;
+
+    DISABLE_COPYING(in_place_term_t);
+};
+
+boost::shared_ptr<in_place_term_t> in_place_term_t::make_constant(cJSON *json) {
+    boost::shared_ptr<in_place_term_t> res(new in_place_term_t(term_constant));
+    res->value.reset(json);
+    return res;
+}
+
+boost::shared_ptr<in_place_term_t> in_place_term_t::compile(const Term &term, const std::string &arg) {
+    switch (term.type()) {
+    case Term::JSON_NULL:
+        return make_constant(cJSON_CreateNull());
+    case Term::BOOL:
+        return make_constant(cJSON_CreateBool(term.valuebool()));
+    case Term::NUMBER:
+        if (!isfinite(term.number())) {
+            return boost::shared_ptr<in_place_term_t>();
+        }
+        return make_constant(cJSON_CreateNumber(term.number()));
+    case Term::STRING:
+        return make_constant(cJSON_CreateString(term.valuestring().c_str()));
+    case Term::JSON: {
+        cJSON *json = cJSON_Parse(term.jsonstring().c_str());
+        if (!json) {
+            return boost::shared_ptr<in_place_term_t>();
+        }
+        return make_constant(json);
+    }
+    case Term::VAR:
+        if (term.var() != arg) {
+            return boost::shared_ptr<in_place_term_t>();
+        }
+        return boost::shared_ptr<in_place_term_t>(new in_place_term_t(term_row));
+    case Term::IMPLICIT_VAR:
+        return boost::shared_ptr<in_place_term_t>(new in_place_term_t(term_row));
+    case Term::CALL:
+        return compile_call(term.call(), arg);
+    case Term::LET:
+    case Term::IF:
+    case Term::ERROR:
+    case Term::ARRAY:
+    case Term::OBJECT:
+    case Term::GETBYKEY:
+    case Term::TABLE:
+    case Term::JAVASCRIPT:
+    default:
+        return boost::shared_ptr<in_place_term_t>();
+    }
+}
+
+boost::shared_ptr<in_place_term_t> in_place_term_t::compile_call(const Term::Call &call, const std::string &arg) {
+    const Builtin &builtin = call.builtin();
+    boost::shared_ptr<in_place_term_t> res;
+    switch (builtin.type()) {
+    case Builtin::GETATTR:
+    case Builtin::IMPLICIT_GETATTR:
+        res.reset(new in_place_term_t(term_getattr));
+        res->attrs.push_back(builtin.attr());
+        break;
+    case Builtin::HASATTR:
+    case Builtin::IMPLICIT_HASATTR:
+        res.reset(new in_place_term_t(term_hasattr));
+        res->attrs.push_back(builtin.attr());
+        break;
+    case Builtin::PICKATTRS:
+    case Builtin::IMPLICIT_PICKATTRS:
+        res.reset(new in_place_term_t(term_pickattrs));
+        res->attrs.assign(builtin.attrs().begin(), builtin.attrs().end());
+        break;
+    case Builtin::NOT:
+        res.reset(new in_place_term_t(term_not));
+        break;
+    case Builtin::ALL:
+        res.reset(new in_place_term_t(term_all));
+        break;
+    case Builtin::ANY:
+        res.reset(new in_place_term_t(term_any));
+        break;
+    case Builtin::COMPARE:
+        res.reset(new in_place_term_t(term_compare));
+        res->comparison = builtin.comparison();
+        break;
+    case Builtin::MAPMERGE:
+    case Builtin::ARRAYAPPEND:
+    case Builtin::SLICE:
+    case Builtin::ADD:
+    case Builtin::SUBTRACT:
+    case Builtin::MULTIPLY:
+    case Builtin::DIVIDE:
+    case Builtin::MODULO:
+    case Builtin::FILTER:
+    case Builtin::MAP:
+    case Builtin::CONCATMAP:
+    case Builtin::ORDERBY:
+    case Builtin::DISTINCT:
+    case Builtin::LENGTH:
+    case Builtin::UNION:
+    case Builtin::NTH:
+    case Builtin::STREAMTOARRAY:
+    case Builtin::ARRAYTOSTREAM:
+    case Builtin::REDUCE:
+    case Builtin::GROUPEDMAPREDUCE:
+    case Builtin::RANGE:
+    case Builtin::IMPLICIT_WITHOUT:
+    case Builtin::WITHOUT:
+    default:
+        return res;
+    }
+
+    // The implicit versions work on the row, which is the implicit variable in
+    // both predicates and mappings.
+    if (builtin.type() == Builtin::IMPLICIT_GETATTR ||
+        builtin.type() == Builtin::IMPLICIT_HASATTR ||
+        builtin.type() == Builtin::IMPLICIT_PICKATTRS) {
+        res->args.push_back(boost::shared_ptr<in_place_term_t>(new in_place_term_t(term_row)));
+    } else {
+        for (int i = 0; i < call.args_size(); ++i) {
+            boost::shared_ptr<in_place_term_t> compiled_arg = compile(call.args(i), arg);
+            if (!compiled_arg) {
+                return compiled_arg;
+            }
+            res->args.push_back(compiled_arg);
+        }
+    }
+    if (res->args.empty() && res->kind != term_all && res->kind != term_any) {
+        return boost::shared_ptr<in_place_term_t>();
+    }
+
+    res->true_value.reset(cJSON_CreateTrue());
+    res->false_value.reset(cJSON_CreateFalse());
+    return res;
+}
+
+/* Evaluates `args[0]`, which has to be a part of the row that is an object. */
+bool in_place_term_t::eval_object(const binary_json_t &row, binary_json_t *out) const {
+    in_place_value_t object;
+    if (!args[0]->eval(row, &object) || object.json || object.type() != cJSON_Object) {
+        return false;
+    }
+    *out = object.binary;
+    return true;
+}
+
+bool in_place_term_t::eval_bool(const binary_json_t &row, size_t i, bool *out) const {
+    in_place_value_t res;
+    if (!args[i]->eval(row, &res)) {
+        return false;
+    }
+    if (res.type() != cJSON_True && res.type() != cJSON_False) {
+        return false;
+    }
+    *out = res.type() == cJSON_True;
+    return true;
+}
+
+bool in_place_term_t::eval(const binary_json_t &row, in_place_value_t *out) const {
+    switch (kind) {
+    case term_constant:
+        *out = in_place_value_t(value.get());
+        return true;
+    case term_row:
+        *out = in_place_value_t(row);
+        return true;
+    case term_getattr: {
+        binary_json_t object, field;
+        if (!eval_object(row, &object) || !object.get_field(attrs[0], &field)) {
+            return false;
+        }
+        *out = in_place_value_t(field);
+        return true;
+    }
+    case term_hasattr: {
+        binary_json_t object, field;
+        if (!eval_object(row, &object)) {
+            return false;
+        }
+        *out = in_place_value_t(object.get_field(attrs[0], &field) ? true_value.get() : false_value.get());
+        return true;
+    }
+    case term_pickattrs:
+        // Only mappings produce new objects; see `eval_mapping()`.
+        return false;
+    case term_not: {
+        bool res;
+        if (!eval_bool(row, 0, &res)) {
+            return false;
+        }
+        *out = in_place_value_t(res ? false_value.get() : true_value.get());
+        return true;
+    }
+    case term_all:
+    case term_any: {
+        // Like the builtins, stop at the first argument that decides it.
+        const bool short_circuit = kind == term_any;
+        bool res = !short_circuit;
+        for (size_t i = 0; i < args.size(); ++i) {
+            bool arg_value;
+            if (!eval_bool(row, i, &arg_value)) {
+                return false;
+            }
+            if (arg_value == short_circuit) {
+                res = short_circuit;
+                break;
+            }
+        }
+        *out = in_place_value_t(res ? true_value.get() : false_value.get());
+        return true;
+    }
+    case term_compare: {
+        in_place_value_t lhs;
+        if (!args[0]->eval(row, &lhs)) {
+            return false;
+        }
+        // Like the builtin, `COMPARE` chains: each argument is compared to the
+        // one before it, stopping at the first comparison that fails.
+        bool res = true;
+        for (size_t i = 1; i < args.size() && res; ++i) {
+            in_place_value_t rhs;
+            if (!args[i]->eval(row, &rhs)) {
+                return false;
+            }
+            const int cmp = compare_values(lhs, rhs);
+            switch (comparison) {
+            case Builtin_Comparison_EQ: res = (cmp == 0); break;
+            case Builtin_Comparison_NE: res = (cmp != 0); break;
+            case Builtin_Comparison_LT: res = (cmp < 0); break;
+            case Builtin_Comparison_LE: res = (cmp <= 0); break;
+            case Builtin_Comparison_GT: res = (cmp > 0); break;
+            case Builtin_Comparison_GE: res = (cmp >= 0); break;
+            default: return false;
+            }
+            lhs = rhs;
+        }
+        *out = in_place_value_t(res ? true_value.get() : false_value.get());
+        return true;
+    }
+    default:
+        unreachable();
+    }
+}
+
+bool in_place_term_t::eval_mapping(const binary_json_t &row, cJSON **out) const {
+    if (kind != term_pickattrs) {
+        in_place_value_t res;
+        if (!eval(row, &res)) {
+            return false;
+        }
+        *out = res.json ? cJSON_DeepCopy(res.json) : res.binary.to_cjson();
+        return true;
+    }
+
+    binary_json_t object;
+    if (!eval_object(row, &object)) {
+        return false;
+    }
+    scoped_cJSON_t res(cJSON_CreateObject());
+    for (size_t i = 0; i < attrs.size(); ++i) {
+        binary_json_t field;
+        std::string key;
+        if (!object.get_field(attrs[i], &field, &key)) {
+            return false;
+        }
+        res.AddItemToObject(key.c_str(), field.to_cjson());
+    }
+    *out = res.release();
+    return true;
+}
+
+/* in_place_transform_t */
+
+class in_place_compile_visitor_t : public boost::static_visitor<void> {
+public:
+    in_place_compile_visitor_t() : filter(false) { }
+
+    void operator()(const Builtin_Filter &f) {
+        filter = true;
+        body = in_place_term_t::compile(f.predicate().body(), f.predicate().arg());
+    }
+    void operator()(const Mapping &m) {
+        body = in_place_term_t::compile(m.body(), m.arg());
+    }
+    void operator()(const Builtin_ConcatMap &) { }
+    void operator()(const Builtin_Range &) { }
+
+    bool filter;
+    boost::shared_ptr<in_place_term_t> body;
+};
+
+in_place_transform_t *in_place_transform_t::compile(const rdb_protocol_details::transform_atom_t &atom) {
+    in_place_compile_visitor_t visitor;
+    boost::apply_visitor(visitor, atom.variant);
+    if (!visitor.body) {
+        return NULL;
+    }
+    return new in_place_transform_t(visitor.filter, visitor.body);
+}
+
+in_place_transform_t::filter_result_t in_place_transform_t::apply_filter(const binary_json_t &row) const {
+    rassert(filter);
+    in_place_value_t res;
+    if (!body->eval(row, &res)) {
+        return filter_give_up;
+    }
+    switch (res.type()) {
+    case cJSON_True: return filter_keep;
+    case cJSON_False: return filter_drop;
+    default: return filter_give_up;
+    }
+}
+
+bool in_place_transform_t::apply_mapping(const binary_json_t &row, boost::shared_ptr<scoped_cJSON_t> *out) const {
+    rassert(!filter);
+    cJSON *mapped;
+    if (!body->eval_mapping(row, &mapped)) {
+        return false;
+    }
+    out->reset(new scoped_cJSON_t(mapped));
+    return true;
+}
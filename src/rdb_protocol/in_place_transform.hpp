@@ -0,0 +1,56 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#ifndef RDB_PROTOCOL_IN_PLACE_TRANSFORM_HPP_
+#define RDB_PROTOCOL_IN_PLACE_TRANSFORM_HPP_
+
+#include <string>
+#include <vector>
+
+#include "errors.hpp"
+#include <boost/shared_ptr.hpp>
+
+#include "rdb_protocol/binary_json.hpp"
+#include "rdb_protocol/protocol.hpp"
+
+/* Filters and maps that only look at a few attributes of the row can be run
+directly on the row's `binary_json_t`, without decoding it into cJSON. This
+covers predicates and mappings built out of literals, attribute lookups on the
+row (`GETATTR`, `HASATTR`, `PICKATTRS` and their implicit versions), `COMPARE`,
+`NOT`, `ALL` and `ANY`, which is what most filters look like.
+
+Anything that would throw (a missing attribute, a non-boolean predicate, and so
+on) makes the in-place evaluation give up instead, and the caller then runs the
+transform the usual way on the decoded row, which throws the proper error. */
+
+class in_place_term_t;
+
+class in_place_transform_t {
+public:
+    /* Returns NULL if `atom` can't be evaluated in place. */
+    static in_place_transform_t *compile(const rdb_protocol_details::transform_atom_t &atom);
+
+    enum filter_result_t {
+        filter_keep,
+        filter_drop,
+        filter_give_up
+    };
+
+    bool is_filter() const { return filter; }
+
+    /* For a filter: whether the predicate holds for `row`. */
+    filter_result_t apply_filter(const binary_json_t &row) const;
+
+    /* For a mapping: sets `*out` to the mapped row and returns true, or returns
+    false if it gave up. */
+    bool apply_mapping(const binary_json_t &row, boost::shared_ptr<scoped_cJSON_t> *out) const;
+
+private:
+    in_place_transform_t(bool _filter, const boost::shared_ptr<in_place_term_t> &_body)
+        : filter(_filter), body(_body) { }
+
+    bool filter;
+    boost::shared_ptr<in_place_term_t> body;
+
+    DISABLE_COPYING(in_place_transform_t);
+};
+
+#endif  // RDB_PROTOCOL_IN_PLACE_TRANSFORM_HPP_
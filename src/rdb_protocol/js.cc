@@ -5,6 +5,7 @@
 #include "utils.hpp"
 #include <boost/optional.hpp>
 
+#include "config/args.hpp"
 #include "containers/scoped.hpp"
 #include "rdb_protocol/jsimpl.hpp"
 #include "rdb_protocol/rdb_protocol_json.hpp"
@@ -31,6 +32,22 @@ static void append_caught_error(std::string *errmsg, const v8::TryCatch &try_cat
     errmsg->append(buf.data(), len);
 }
 
+// Turns a function's argument names and body into the source of a function
+// expression, "(function(args){body})".
+static std::string function_source(const std::vector<std::string> &args, const std::string &body) {
+    std::string src = "(function(";
+    for (size_t i = 0; i < args.size(); ++i) {
+        if (i != 0) {
+            src += ',';
+        }
+        src += args[i];
+    }
+    src += "){";
+    src += body;
+    src += "})";
+    return src;
+}
+
 // ---------- scoped_id_t ----------
 scoped_id_t::~scoped_id_t() {
     if (!empty()) reset();
@@ -119,6 +136,11 @@ runner_t::~runner_t() {
 }
 
 void runner_t::begin(extproc::pool_t *pool) {
+    // If we were interrupted, our ids referred to the old worker's values.
+    used_ids_.clear();
+    compiled_.clear();
+    compiled_order_.clear();
+
     // TODO(rntz): might eventually want to handle external process failure
     int res = extproc::job_handle_t::begin(pool, job_t());
     guarantee(0 == res);
@@ -207,62 +229,12 @@ struct compile_task_t : auto_task_t<compile_task_t> {
     std::string src_;
     RDB_MAKE_ME_SERIALIZABLE_2(args_, src_);
 
-    void mkFuncSrc(scoped_array_t<char> *buf) {
-        static const char
-            *beg = "(function(",
-            *med = "){",
-            *end = "})";
-        static const ssize_t
-            begsz = strlen(beg),
-            medsz = strlen(med),
-            endsz = strlen(end);
-
-        size_t nargs = args_.size();
-
-        ssize_t size = begsz + medsz + endsz + src_.size();
-        for (size_t i = 0; i < nargs; ++i) {
-            // + (i > 0) accounts for the preceding comma on extra arguments
-            // beyond the first
-            size += args_[i].size() + (i > 0);
-        }
-
-        buf->init(size);
-
-        char *p = buf->data();
-        memcpy(p, beg, begsz);
-        p += begsz;
-
-        for (size_t i = 0; i < nargs; ++i) {
-            if (i != 0) {
-                *p++ = ',';
-            }
-            const std::string &s = args_[i];
-            memcpy(p, s.data(), s.size());
-            p += s.size();
-        }
-
-        memcpy(p, med, medsz);
-        p += medsz;
-
-        memcpy(p, src_.data(), src_.size());
-        p += src_.size();
-
-        memcpy(p, end, endsz);
-        guarantee(p - buf->data() == size - endsz,
-                "\np - buf->data() = %td\nsize = %zd\nendsz = %zd",
-                p - buf->data(),
-                size,
-                endsz);
-    }
-
-    v8::Handle<v8::Function> mkFunc(std::string *errmsg) {
+    v8::Handle<v8::Function> mkFunc(const std::string &srcstr, std::string *errmsg) {
         v8::Handle<v8::Function> result; // initially empty
 
         // Compile & run script to get a function.
-        scoped_array_t<char> srcbuf;
-        mkFuncSrc(&srcbuf);
         // TODO(rntz): use an "external resource" to avoid copy?
-        v8::Handle<v8::String> src = v8::String::New(srcbuf.data(), srcbuf.size());
+        v8::Handle<v8::String> src = v8::String::New(srcstr.data(), srcstr.size());
 
         v8::TryCatch try_catch;
 
@@ -294,7 +266,7 @@ struct compile_task_t : auto_task_t<compile_task_t> {
 
         v8::HandleScope handle_scope;
         // Evaluate the function definition.
-        v8::Handle<v8::Function> func = mkFunc(errmsg);
+        v8::Handle<v8::Function> func = mkFunc(function_source(args_, src_), errmsg);
         if (!func.IsEmpty()) {
             result = env->rememberValue(func);
         }
@@ -312,6 +284,22 @@ id_t runner_t::compile(
     std::string *errmsg,
     const req_config_t *config)
 {
+    std::string key = function_source(args, source);
+    compiled_t::iterator it = compiled_.find(key);
+    if (it != compiled_.end()) {
+        compiled_order_.splice(compiled_order_.end(), compiled_order_, it->second.second);
+        return it->second.first;
+    }
+
+    if (compiled_.size() >= JS_MAX_CACHED_FUNCTIONS) {
+        // Make room by forgetting the function we used longest ago.
+        compiled_t::iterator lru = compiled_.find(compiled_order_.front());
+        guarantee(lru != compiled_.end());
+        release_id(lru->second.first);
+        compiled_.erase(lru);
+        compiled_order_.pop_front();
+    }
+
     id_result_t result;
 
     {
@@ -324,6 +312,10 @@ id_t runner_t::compile(
     //TODO: shouldn't we do something if the visitor returns INVALID_ID?
     id_t id = boost::apply_visitor(v, result);
     note_id(id);
+    if (id != INVALID_ID) {
+        compiled_order_.push_back(key);
+        compiled_.insert(std::make_pair(key, std::make_pair(id, --compiled_order_.end())));
+    }
     return id;
 }
 
@@ -418,4 +410,104 @@ boost::shared_ptr<scoped_cJSON_t> runner_t::call(
     return boost::apply_visitor(v, result);
 }
 
+// ----- call_many() -----
+struct call_many_task_t : auto_task_t<call_many_task_t> {
+    call_many_task_t() {}
+    call_many_task_t(id_t id,
+                     const std::vector<boost::shared_ptr<scoped_cJSON_t> > &rows,
+                     const std::vector<boost::shared_ptr<scoped_cJSON_t> > &args,
+                     uint64_t row_arg)
+        : func_id_(id), rows_(rows), args_(args), row_arg_(row_arg)
+    {
+        guarantee(row_arg_ < args_.size());
+    }
+
+    id_t func_id_;
+    std::vector<boost::shared_ptr<scoped_cJSON_t> > rows_;
+    std::vector<boost::shared_ptr<scoped_cJSON_t> > args_;
+    uint64_t row_arg_;
+    RDB_MAKE_ME_SERIALIZABLE_4(func_id_, rows_, args_, row_arg_);
+
+    void run(env_t *env) {
+        bool ok = true;
+        std::vector<boost::shared_ptr<scoped_cJSON_t> > results;
+        std::string errmsg;
+
+        v8::HandleScope handle_scope;
+        v8::Handle<v8::Function> func = v8::Handle<v8::Function>::Cast(env->findValue(func_id_));
+        guarantee(!func.IsEmpty());
+
+        // The arguments other than the row are the same for every call, so we
+        // only convert them once.
+        size_t nargs = args_.size();
+        scoped_array_t<v8::Handle<v8::Value> > handles(nargs);
+        for (size_t i = 0; i < nargs; ++i) {
+            if (i != row_arg_) {
+                handles[i] = fromJSON(*args_[i]->get());
+                guarantee(!handles[i].IsEmpty());
+            }
+        }
+
+        for (size_t i = 0; i < rows_.size(); ++i) {
+            // Without a scope per row we'd hold on to every row's handles
+            // until the end of the batch.
+            v8::HandleScope row_scope;
+            v8::TryCatch try_catch;
+
+            const cJSON &row = *rows_[i]->get();
+            handles[row_arg_] = fromJSON(row);
+            guarantee(!handles[row_arg_].IsEmpty());
+            v8::Handle<v8::Object> obj = row.type == cJSON_Object ? fromJSON(row)->ToObject()
+                                                                  : v8::Object::New();
+            guarantee(!obj.IsEmpty());
+
+            v8::Handle<v8::Value> value = func->Call(obj, nargs, handles.data());
+            if (value.IsEmpty()) {
+                errmsg = "calling function failed";
+                append_caught_error(&errmsg, try_catch);
+                ok = false;
+                break;
+            }
+
+            boost::shared_ptr<scoped_cJSON_t> json = toJSON(value, &errmsg);
+            if (!json) {
+                ok = false;
+                break;
+            }
+            results.push_back(json);
+        }
+
+        write_message_t msg;
+        msg << ok;
+        msg << results;
+        msg << errmsg;
+        int sendres = send_write_message(env->control(), &msg);
+        guarantee(0 == sendres);
+    }
+};
+
+bool runner_t::call_many(
+    id_t func_id,
+    const std::vector<boost::shared_ptr<scoped_cJSON_t> > &rows,
+    const std::vector<boost::shared_ptr<scoped_cJSON_t> > &args,
+    size_t row_arg,
+    std::vector<boost::shared_ptr<scoped_cJSON_t> > *results_out,
+    std::string *errmsg,
+    const req_config_t *config)
+{
+    bool ok;
+
+    {
+        run_task_t run(this, config, call_many_task_t(func_id, rows, args, row_arg));
+        int res = deserialize(&run, &ok);
+        guarantee(ARCHIVE_SUCCESS == res);
+        res = deserialize(&run, results_out);
+        guarantee(ARCHIVE_SUCCESS == res);
+        res = deserialize(&run, errmsg);
+        guarantee(ARCHIVE_SUCCESS == res);
+    }
+
+    return ok;
+}
+
 } // namespace js
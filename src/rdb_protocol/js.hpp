@@ -2,6 +2,7 @@
 #ifndef RDB_PROTOCOL_JS_HPP_
 #define RDB_PROTOCOL_JS_HPP_
 
+#include <list>
 #include <map>
 #include <set>
 #include <string>
@@ -95,7 +96,12 @@ class runner_t : private extproc::job_handle_t {
     static const req_config_t *default_req_config();
 
     // Returns INVALID_ID on error.
-    // Returned id may only be used in `call`.
+    // Returned id may only be used in `call` and `call_many`.
+    //
+    // Compiled functions are cached here by their source, so compiling the
+    // same function again is cheap. Once there are JS_MAX_CACHED_FUNCTIONS of
+    // them, compiling a new one releases the one used longest ago, so use the
+    // id right away rather than holding on to it.
     MUST_USE id_t compile(
         // Argument names
         const std::vector<std::string> &args,
@@ -118,6 +124,20 @@ class runner_t : private extproc::job_handle_t {
         std::string *errmsg,
         const req_config_t *config = NULL);
 
+    // Calls a previously compiled function once for each of `rows`, in a
+    // single round-trip to the worker. For each call, the row is put into
+    // `args` at position `row_arg` and, if it's a JSON object, is also the
+    // receiver object. Returns false if one of the calls failed, in which case
+    // `results_out` only holds the results of the calls before it.
+    MUST_USE bool call_many(
+        id_t func_id,
+        const std::vector<boost::shared_ptr<scoped_cJSON_t> > &rows,
+        const std::vector<boost::shared_ptr<scoped_cJSON_t> > &args,
+        size_t row_arg,
+        std::vector<boost::shared_ptr<scoped_cJSON_t> > *results_out,
+        std::string *errmsg,
+        const req_config_t *config = NULL);
+
     // TODO (rntz): a way to send streams over to javascript.
     // TODO (rntz): a way to get streams back from javascript.
 
@@ -160,6 +180,13 @@ class runner_t : private extproc::job_handle_t {
     // Used only for assertions and guarantees.
     bool running_task_;
     std::set<id_t> used_ids_;
+
+    // The functions we've compiled, by their source, and their sources in the
+    // order we last used them, least recently used first.
+    typedef std::list<std::string> compiled_order_t;
+    typedef std::map<std::string, std::pair<id_t, compiled_order_t::iterator> > compiled_t;
+    compiled_t compiled_;
+    compiled_order_t compiled_order_;
 };
 
 } // namespace js
@@ -6,6 +6,7 @@
 
 #include "concurrency/cross_thread_watchable.hpp"
 #include "concurrency/watchable.hpp"
+#include "config/args.hpp"
 #include "rdb_protocol/stream_cache.hpp"
 #include "rpc/semilattice/view/field.hpp"
 
@@ -13,7 +14,7 @@ query_server_t::query_server_t(const std::set<ip_address_t> &local_addresses,
                                int port,
                                rdb_protocol_t::context_t *_ctx) :
     server(local_addresses, port, boost::bind(&query_server_t::handle, this, _1, _2),
-           &on_unparsable_query, INLINE),
+           &on_unparsable_query, CORO_UNORDERED),
     ctx(_ctx), parser_id(generate_uuid()), thread_counters(0)
 { }
 
@@ -40,7 +41,27 @@ Response on_unparsable_query(Query *q, std::string msg) {
     return res;
 }
 
+token_lock_t::token_lock_t(query_server_t::context_t *_ctx, int64_t _token) : ctx(_ctx), token(_token) {
+    boost::shared_ptr<mutex_t> &mutex_ref = ctx->token_mutexes[token];
+    if (!mutex_ref) {
+        mutex_ref.reset(new mutex_t());
+    }
+    mutex = mutex_ref;
+    acq.reset(mutex.get());
+}
+
+token_lock_t::~token_lock_t() {
+    acq.reset();
+    mutex.reset();
+    std::map<int64_t, boost::shared_ptr<mutex_t> >::iterator it = ctx->token_mutexes.find(token);
+    guarantee(it != ctx->token_mutexes.end());
+    if (it->second.unique()) {
+        ctx->token_mutexes.erase(it);
+    }
+}
+
 Response query_server_t::handle(Query *q, context_t *query_context) {
+    token_lock_t token_lock(query_context, q->token());
     stream_cache_t *stream_cache = &query_context->stream_cache;
     signal_t *interruptor = query_context->interruptor;
     guarantee(interruptor);
@@ -53,9 +74,20 @@ Response query_server_t::handle(Query *q, context_t *query_context) {
     bool is_deterministic;
 
     try {
-        query_language::check_query_type(
-            q, &type_environment, &is_deterministic, root_backtrace);
-        boost::shared_ptr<js::runner_t> js_runner = boost::make_shared<js::runner_t>();
+        if (q->ByteSize() >= STEALABLE_REQUEST_MIN_SIZE) {
+            // Type checking only looks at the query and `type_environment`.
+            on_any_thread_t rethreader;
+            query_language::check_query_type(
+                q, &type_environment, &is_deterministic, root_backtrace);
+        } else {
+            query_language::check_query_type(
+                q, &type_environment, &is_deterministic, root_backtrace);
+        }
+        // Queries share their connection's JS worker, unless another query on
+        // the connection is still using it.
+        boost::shared_ptr<js::runner_t> js_runner = query_context->js_runner.unique()
+            ? query_context->js_runner
+            : boost::make_shared<js::runner_t>();
         int thread = get_thread_id();
         query_language::runtime_environment_t runtime_environment(
             ctx->pool_group, ctx->ns_repo,
@@ -63,6 +95,7 @@ Response query_server_t::handle(Query *q, context_t *query_context) {
             ctx->cross_thread_database_watchables[thread]->get_watchable(),
             ctx->semilattice_metadata,
             ctx->directory_read_manager,
+            ctx->io_backender, ctx->spill_path,
             js_runner, interruptor, ctx->machine_id);
         //[execute_query] will set the status code unless it throws
         execute_query(q, &runtime_environment, &res, scopes_t(),
@@ -9,6 +9,7 @@
 #include "clustering/administration/metadata.hpp"
 #include "clustering/administration/namespace_interface_repository.hpp"
 #include "clustering/administration/namespace_metadata.hpp"
+#include "concurrency/mutex.hpp"
 #include "extproc/pool.hpp"
 #include "protob/protob.hpp"
 #include "protocol_api.hpp"
@@ -24,9 +25,17 @@ public:
     int get_port() const;
 
     struct context_t {
-        context_t() : interruptor(0) { }
+        context_t() : interruptor(0), js_runner(new js::runner_t()) { }
         stream_cache_t stream_cache;
         signal_t *interruptor;
+        /* Every query on the connection uses the same JS worker, so it doesn't
+        have to acquire one per query and the functions it's already compiled
+        stay compiled. */
+        boost::shared_ptr<js::runner_t> js_runner;
+        /* A connection's queries run concurrently, except that the ones with
+        the same token (a query and the CONTINUEs and STOPs for its stream) run
+        one at a time, in the order they arrived. */
+        std::map<int64_t, boost::shared_ptr<mutex_t> > token_mutexes;
     };
 private:
     Response handle(Query *q, context_t *query_context);
@@ -40,4 +49,20 @@ private:
 
 Response on_unparsable_query(Query *q, std::string msg);
 
+/* Holds the lock for a token on a connection, and forgets about the lock once
+nobody's waiting for it. */
+class token_lock_t {
+public:
+    token_lock_t(query_server_t::context_t *_ctx, int64_t _token);
+    ~token_lock_t();
+
+private:
+    query_server_t::context_t *ctx;
+    int64_t token;
+    boost::shared_ptr<mutex_t> mutex;
+    mutex_t::acq_t acq;
+
+    DISABLE_COPYING(token_lock_t);
+};
+
 #endif /* RDB_PROTOCOL_PB_SERVER_HPP_ */
@@ -16,3 +16,21 @@ std::string cJSON_print_primary(cJSON *json, const query_language::backtrace_t &
     return s;
 }
 
+
+std::string range_row_error(cJSON *row, const std::string &attrname) {
+    if (row->type != cJSON_Object) {
+        return strprintf("Got non-object in RANGE query: %s.", cJSON_print_std_string(row).c_str());
+    }
+    cJSON *val = cJSON_GetObjectItem(row, attrname.c_str());
+    if (!val) {
+        return strprintf("Object %s has no attribute %s.", cJSON_print_std_string(row).c_str(), attrname.c_str());
+    }
+    if (val->type != cJSON_Number && val->type != cJSON_String) {
+        return strprintf("Primary key must be a number or string, not %s.", cJSON_print_std_string(val).c_str());
+    }
+    if (cJSON_print_lexicographic(val).size() > MAX_KEY_SIZE) {
+        return strprintf("Primary key too long (max %d characters): %s",
+                         MAX_KEY_SIZE-1, cJSON_print_std_string(val).c_str());
+    }
+    return std::string();
+}
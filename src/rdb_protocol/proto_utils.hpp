@@ -11,6 +11,11 @@
 
 std::string cJSON_print_primary(cJSON *json, const query_language::backtrace_t &backtrace);
 
+/* What's wrong with `row` for a RANGE over its attribute `attrname`, or an
+empty string if `cJSON_print_primary()` will take the attribute. Reads through
+a secondary index and scans use this to fail on the same rows. */
+std::string range_row_error(cJSON *row, const std::string &attrname);
+
 #ifndef NDEBUG
 #define guarantee_debug_throw_release(cond, backtrace) guarantee(cond)
 #else
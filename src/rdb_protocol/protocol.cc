@@ -4,6 +4,7 @@
 #include <boost/function.hpp>
 #include <boost/make_shared.hpp>
 
+#include "arch/runtime/coroutines.hpp"
 #include "btree/erase_range.hpp"
 #include "btree/parallel_traversal.hpp"
 #include "btree/slice.hpp"
@@ -17,6 +18,7 @@
 #include "rdb_protocol/btree.hpp"
 #include "rdb_protocol/protocol.hpp"
 #include "rdb_protocol/query_language.hpp"
+#include "rdb_protocol/transform_visitors.hpp"
 #include "rpc/semilattice/view/field.hpp"
 #include "rpc/semilattice/watchable.hpp"
 #include "serializer/config.hpp"
@@ -34,6 +36,9 @@ typedef rdb_protocol_t::read_response_t read_response_t;
 typedef rdb_protocol_t::point_read_t point_read_t;
 typedef rdb_protocol_t::point_read_response_t point_read_response_t;
 
+typedef rdb_protocol_t::multi_point_read_t multi_point_read_t;
+typedef rdb_protocol_t::multi_point_read_response_t multi_point_read_response_t;
+
 typedef rdb_protocol_t::rget_read_t rget_read_t;
 typedef rdb_protocol_t::rget_read_response_t rget_read_response_t;
 
@@ -52,6 +57,12 @@ typedef rdb_protocol_t::point_modify_response_t point_modify_response_t;
 typedef rdb_protocol_t::point_delete_t point_delete_t;
 typedef rdb_protocol_t::point_delete_response_t point_delete_response_t;
 
+typedef rdb_protocol_t::sindex_create_t sindex_create_t;
+typedef rdb_protocol_t::sindex_create_response_t sindex_create_response_t;
+
+typedef rdb_protocol_t::sindex_drop_t sindex_drop_t;
+typedef rdb_protocol_t::sindex_drop_response_t sindex_drop_response_t;
+
 typedef rdb_protocol_t::backfill_chunk_t backfill_chunk_t;
 
 typedef rdb_protocol_t::backfill_progress_t backfill_progress_t;
@@ -78,21 +89,26 @@ rdb_protocol_t::context_t::context_t()
     cross_thread_namespace_watchables(get_num_threads()),
     cross_thread_database_watchables(get_num_threads()),
     directory_read_manager(NULL),
-    signals(get_num_threads())
+    signals(get_num_threads()),
+    io_backender(NULL)
 { }
 
 rdb_protocol_t::context_t::context_t(extproc::pool_group_t *_pool_group,
           namespace_repo_t<rdb_protocol_t> *_ns_repo,
           boost::shared_ptr<semilattice_readwrite_view_t<cluster_semilattice_metadata_t> > _semilattice_metadata,
           directory_read_manager_t<cluster_directory_metadata_t> *_directory_read_manager,
-          machine_id_t _machine_id)
+          machine_id_t _machine_id,
+          io_backender_t *_io_backender,
+          const std::string &_spill_path)
     : pool_group(_pool_group), ns_repo(_ns_repo),
       cross_thread_namespace_watchables(get_num_threads()),
       cross_thread_database_watchables(get_num_threads()),
       semilattice_metadata(_semilattice_metadata),
       directory_read_manager(_directory_read_manager),
       signals(get_num_threads()),
-      machine_id(_machine_id)
+      machine_id(_machine_id),
+      io_backender(_io_backender),
+      spill_path(_spill_path)
 {
     for (int thread = 0; thread < get_num_threads(); ++thread) {
         cross_thread_namespace_watchables[thread].init(new cross_thread_watchable_variable_t<cow_ptr_t<namespaces_semilattice_metadata_t<rdb_protocol_t> > >(
@@ -117,6 +133,18 @@ region_t rdb_protocol_t::monokey_region(const store_key_t &k) {
     return region_t(h, h + 1, key_range_t(key_range_t::closed, k, key_range_t::closed, k));
 }
 
+rdb_protocol_t::multi_point_read_t::multi_point_read_t(const std::vector<store_key_t> &_keys) : keys(_keys) {
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+}
+
+rdb_protocol_t::sindex_rangespec_t::sindex_rangespec_t(const std::string &_id, const std::string &_primary_key,
+                                                       const boost::optional<store_key_t> &_lower,
+                                                       const boost::optional<store_key_t> &_upper,
+                                                       const query_language::backtrace_t &_backtrace)
+    : id(_id), primary_key(_primary_key), lower(_lower), upper(_upper),
+      range(sindex_key_range(_lower, _upper)), backtrace(_backtrace) { }
+
 namespace {
 
 /* read_t::get_region implementation */
@@ -125,6 +153,15 @@ struct r_get_region_visitor : public boost::static_visitor<region_t> {
         return rdb_protocol_t::monokey_region(pr.key);
     }
 
+    region_t operator()(const multi_point_read_t &mpr) const {
+        // The keys are sorted, so this is the smallest key range that covers all of them.
+        if (mpr.keys.empty()) {
+            // A shard of a multi-key read can end up with none of the keys.
+            return region_t::empty();
+        }
+        return region_t(key_range_t(key_range_t::closed, mpr.keys.front(), key_range_t::closed, mpr.keys.back()));
+    }
+
     region_t operator()(const rget_read_t &rg) const {
         return rg.region;
     }
@@ -154,6 +191,16 @@ struct r_shard_visitor : public boost::static_visitor<read_t> {
         return read_t(pr);
     }
 
+    read_t operator()(const multi_point_read_t &mpr) const {
+        multi_point_read_t _mpr;
+        for (std::vector<store_key_t>::const_iterator it = mpr.keys.begin(); it != mpr.keys.end(); ++it) {
+            if (region_is_superset(region, rdb_protocol_t::monokey_region(*it))) {
+                _mpr.keys.push_back(*it);
+            }
+        }
+        return read_t(_mpr);
+    }
+
     read_t operator()(const rget_read_t &rg) const {
         rassert(region_is_superset(rg.region, region));
         rget_read_t _rg(rg);
@@ -186,6 +233,11 @@ bool read_response_cmp(const read_response_t &l, const read_response_t &r) {
     return lr->key_range < rr->key_range;
 }
 
+bool rget_data_cmp(const std::pair<store_key_t, boost::shared_ptr<scoped_cJSON_t> >& a,
+                   const std::pair<store_key_t, boost::shared_ptr<scoped_cJSON_t> >& b) {
+    return a.first < b.first;
+}
+
 /* A visitor to handle this unsharding process for us. */
 
 class distribution_read_response_less_t {
@@ -238,12 +290,23 @@ public:
         *response_out = responses[0];
     }
 
+    void operator()(const multi_point_read_t &) {
+        response_out->response = multi_point_read_response_t();
+        multi_point_read_response_t &res = boost::get<multi_point_read_response_t>(response_out->response);
+        for (size_t i = 0; i < count; ++i) {
+            const multi_point_read_response_t *shard_res = boost::get<multi_point_read_response_t>(&responses[i].response);
+            guarantee(shard_res);
+            res.data.insert(res.data.end(), shard_res->data.begin(), shard_res->data.end());
+        }
+        std::sort(res.data.begin(), res.data.end(), rget_data_cmp);
+    }
+
     void operator()(const rget_read_t &rg) {
         response_out->response = rget_read_response_t();
         rget_read_response_t &rg_response = boost::get<rget_read_response_t>(response_out->response);
         rg_response.truncated = false;
         rg_response.key_range = read_t(rg).get_region().inner;
-        rg_response.last_considered_key = read_t(rg).get_region().inner.left;
+        rg_response.last_considered_key = rg.sindex ? rg.sindex->range.left : read_t(rg).get_region().inner.left;
 
         try {
             /* First check to see if any of the responses we're unsharding threw. */
@@ -287,28 +350,28 @@ public:
 
                     rg_response.truncated = rg_response.truncated || _rr->truncated;
                 }
+
+                /* Each shard's rows are in key order; keep them that way, so
+                that reading a table gives its rows in primary key order. */
+                std::stable_sort(res_stream->begin(), res_stream->end(), rget_data_cmp);
             } else if (const Builtin_GroupedMapReduce *gmr = boost::get<Builtin_GroupedMapReduce>(&rg.terminal->variant)) {
                 //GroupedMapreduce
-                rg_response.result = groups_t();
-                groups_t *res_groups = boost::get<groups_t>(&rg_response.result);
+                /* Each shard has already reduced its own rows, so all that's
+                left is to merge their partial groups. */
+                query_language::grouped_map_reduce_t groups(*gmr, &env, rg.terminal->scopes, rg.terminal->backtrace);
                 for (size_t i = 0; i < count; ++i) {
                     const rget_read_response_t *_rr = boost::get<rget_read_response_t>(&responses[i].response);
                     guarantee(_rr);
 
-                    const groups_t *groups = boost::get<groups_t>(&(_rr->result));
+                    const groups_t *shard_groups = boost::get<groups_t>(&(_rr->result));
+                    guarantee(shard_groups);
 
-                    for (groups_t::const_iterator j = groups->begin(); j != groups->end(); ++j) {
-                        Term base = gmr->reduction().base(),
-                             body = gmr->reduction().body();
-
-                        scopes_t scopes_copy = rg.terminal->scopes;
-                        query_language::new_val_scope_t inner_scope(&scopes_copy.scope);
-                        scopes_copy.scope.put_in_scope(gmr->reduction().var1(),
-                            res_groups->insert(std::make_pair(j->first, eval_term_as_json(&base, &env, rg.terminal->scopes, rg.terminal->backtrace.with("reduction").with("base")))).first->second);
-                        scopes_copy.scope.put_in_scope(gmr->reduction().var2(), j->second);
-                        (*res_groups)[j->first] = eval_term_as_json(&body, &env, scopes_copy, rg.terminal->backtrace.with("reduction").with("body"));
+                    for (groups_t::const_iterator j = shard_groups->begin(); j != shard_groups->end(); ++j) {
+                        groups.add_partial(j->first, j->second);
                     }
                 }
+                rg_response.result = groups_t();
+                groups.finish(boost::get<groups_t>(&rg_response.result));
             } else if (const Reduction *r = boost::get<Reduction>(&rg.terminal->variant)) {
                 //Normal Mapreduce
                 rg_response.result = atom_t();
@@ -436,11 +499,6 @@ void read_t::unshard(read_response_t *responses, size_t count, read_response_t *
     boost::apply_visitor(v, read);
 }
 
-bool rget_data_cmp(const std::pair<store_key_t, boost::shared_ptr<scoped_cJSON_t> >& a,
-                   const std::pair<store_key_t, boost::shared_ptr<scoped_cJSON_t> >& b) {
-    return a.first < b.first;
-}
-
 /* write_t::get_region() implementation */
 
 namespace {
@@ -457,6 +515,14 @@ struct w_get_region_visitor : public boost::static_visitor<region_t> {
     region_t operator()(const point_delete_t &pd) const {
         return rdb_protocol_t::monokey_region(pd.key);
     }
+
+    region_t operator()(const sindex_create_t &c) const {
+        return c.region;
+    }
+
+    region_t operator()(const sindex_drop_t &d) const {
+        return d.region;
+    }
 };
 
 }   /* anonymous namespace */
@@ -486,6 +552,18 @@ struct w_shard_visitor : public boost::static_visitor<write_t> {
         rassert(rdb_protocol_t::monokey_region(pd.key) == region);
         return write_t(pd);
     }
+    write_t operator()(const sindex_create_t &c) const {
+        rassert(region_is_superset(c.region, region));
+        sindex_create_t _c(c);
+        _c.region = region;
+        return write_t(_c);
+    }
+    write_t operator()(const sindex_drop_t &d) const {
+        rassert(region_is_superset(d.region, region));
+        sindex_drop_t _d(d);
+        _d.region = region;
+        return write_t(_d);
+    }
     const region_t &region;
 };
 
@@ -495,9 +573,54 @@ write_t write_t::shard(const region_t &region) const THROWS_NOTHING {
     return boost::apply_visitor(w_shard_visitor(region), write);
 }
 
+/* write_t::unshard implementation */
+
+namespace {
+
+struct w_unshard_visitor_t : public boost::static_visitor<void> {
+    w_unshard_visitor_t(const write_response_t *_responses, size_t _count, write_response_t *_response_out)
+        : responses(_responses), count(_count), response_out(_response_out) { }
+
+    void operator()(const point_write_t &) const { unshard_point(); }
+    void operator()(const point_modify_t &) const { unshard_point(); }
+    void operator()(const point_delete_t &) const { unshard_point(); }
+
+    /* An index is created or dropped if it was anywhere. */
+    void operator()(const sindex_create_t &) const {
+        bool success = false;
+        for (size_t i = 0; i < count; ++i) {
+            const sindex_create_response_t *res = boost::get<sindex_create_response_t>(&responses[i].response);
+            guarantee(res);
+            success = success || res->success;
+        }
+        response_out->response = sindex_create_response_t(success);
+    }
+
+    void operator()(const sindex_drop_t &) const {
+        bool success = false;
+        for (size_t i = 0; i < count; ++i) {
+            const sindex_drop_response_t *res = boost::get<sindex_drop_response_t>(&responses[i].response);
+            guarantee(res);
+            success = success || res->success;
+        }
+        response_out->response = sindex_drop_response_t(success);
+    }
+
+private:
+    void unshard_point() const {
+        guarantee(count == 1);
+        *response_out = responses[0];
+    }
+
+    const write_response_t *responses;
+    size_t count;
+    write_response_t *response_out;
+};
+
+}   /* anonymous namespace */
+
 void write_t::unshard(const write_response_t *responses, size_t count, write_response_t *response, UNUSED context_t *ctx) const THROWS_NOTHING {
-    guarantee(count == 1);
-    *response = responses[0];
+    boost::apply_visitor(w_unshard_visitor_t(responses, count, response), write);
 }
 
 store_t::store_t(serializer_t *serializer,
@@ -508,12 +631,55 @@ store_t::store_t(serializer_t *serializer,
                  context_t *_ctx) :
     btree_store_t<rdb_protocol_t>(serializer, perfmon_name, cache_target, create, parent_perfmon_collection, _ctx),
     ctx(_ctx)
-{ }
+{
+    coro_t::spawn_sometime(boost::bind(&store_t::fill_unready_sindexes, this, auto_drainer_t::lock_t(&drainer)));
+}
 
 store_t::~store_t() {
     assert_thread();
 }
 
+void store_t::fill_unready_sindexes(auto_drainer_t::lock_t keepalive) {
+    secondary_index_map_t sindexes;
+    try {
+        object_buffer_t<fifo_enforcer_sink_t::exit_read_t> token;
+        new_read_token(&token);
+        scoped_ptr_t<transaction_t> txn;
+        scoped_ptr_t<real_superblock_t> superblock;
+        acquire_superblock_for_read(rwi_read, &token, &txn, &superblock, keepalive.get_drain_signal(), false);
+        get_secondary_indexes(txn.get(), superblock->get(), &sindexes);
+    } catch (const interrupted_exc_t &) {
+        // The store is being destroyed.
+        return;
+    }
+
+    for (secondary_index_map_t::iterator it = sindexes.begin(); it != sindexes.end(); ++it) {
+        if (!it->second.ready) {
+            coro_t::spawn_sometime(boost::bind(&store_t::fill_sindex, this, it->first, keepalive));
+        }
+    }
+}
+
+void store_t::fill_sindex(const std::string &id, auto_drainer_t::lock_t keepalive) {
+    block_id_t sindex_superblock = NULL_BLOCK_ID;
+    store_key_t cursor = store_key_t::min();
+    try {
+        bool more = true;
+        while (more) {
+            object_buffer_t<fifo_enforcer_sink_t::exit_write_t> token;
+            new_write_token(&token);
+            scoped_ptr_t<transaction_t> txn;
+            scoped_ptr_t<real_superblock_t> superblock;
+            acquire_superblock_for_write(rwi_write, repli_timestamp_t::invalid, SINDEX_FILL_ROWS_PER_STEP,
+                                         &token, &txn, &superblock, keepalive.get_drain_signal());
+            more = rdb_sindex_fill_step(id, &sindex_superblock, &cursor, SINDEX_FILL_ROWS_PER_STEP,
+                                        get_btree(), txn.get(), superblock.get());
+        }
+    } catch (const interrupted_exc_t &) {
+        // The store is being destroyed; we'll start over when it comes back.
+    }
+}
+
 namespace {
 
 // TODO: get rid of this extra response_t copy on the stack
@@ -524,10 +690,20 @@ struct read_visitor_t : public boost::static_visitor<void> {
         rdb_get(get.key, btree, txn, superblock, &res);
     }
 
+    void operator()(const multi_point_read_t &get) {
+        response->response = multi_point_read_response_t();
+        multi_point_read_response_t &res = boost::get<multi_point_read_response_t>(response->response);
+        rdb_multi_get(get.keys, btree, txn, superblock, &res);
+    }
+
     void operator()(const rget_read_t &rget) {
         response->response = rget_read_response_t();
         rget_read_response_t &res = boost::get<rget_read_response_t>(response->response);
-        rdb_rget_slice(btree, rget.region.inner, txn, superblock, &env, rget.transform, rget.terminal, &res);
+        if (rget.sindex) {
+            rdb_rget_secondary_slice(btree, *rget.sindex, rget.region, txn, superblock, &env, rget.transform, rget.terminal, rget.max_chunk_size, &res);
+        } else {
+            rdb_rget_slice(btree, rget.region.inner, txn, superblock, &env, rget.transform, rget.terminal, rget.max_chunk_size, &res);
+        }
     }
 
     void operator()(const distribution_read_t &dg) {
@@ -554,7 +730,7 @@ struct read_visitor_t : public boost::static_visitor<void> {
 
     read_visitor_t(btree_slice_t *_btree,
                    transaction_t *_txn,
-                   superblock_t *_superblock,
+                   real_superblock_t *_superblock,
                    rdb_protocol_t::context_t *ctx,
                    read_response_t *_response,
                    signal_t *_interruptor) :
@@ -577,7 +753,7 @@ private:
     read_response_t *response;
     btree_slice_t *btree;
     transaction_t *txn;
-    superblock_t *superblock;
+    real_superblock_t *superblock;
     wait_any_t interruptor;
     query_language::runtime_environment_t env;
 };
@@ -588,7 +764,7 @@ void store_t::protocol_read(const read_t &read,
                             read_response_t *response,
                             btree_slice_t *btree,
                             transaction_t *txn,
-                            superblock_t *superblock,
+                            real_superblock_t *superblock,
                             signal_t *interruptor) {
     read_visitor_t v(btree, txn, superblock, ctx, response, interruptor);
     boost::apply_visitor(v, read.read);
@@ -601,24 +777,32 @@ struct write_visitor_t : public boost::static_visitor<void> {
     void operator()(const point_write_t &w) {
         response->response = point_write_response_t();
         point_write_response_t &res = boost::get<point_write_response_t>(response->response);
-        rdb_set(w.key, w.data, w.overwrite, btree, timestamp, txn, superblock, &res);
+        rdb_set(w.key, w.data, w.overwrite, btree, timestamp, txn, point_superblock(), sindexes, &res);
     }
 
     void operator()(const point_modify_t &m) {
         response->response = point_modify_response_t();
         point_modify_response_t &res = boost::get<point_modify_response_t>(response->response);
-        rdb_modify(m.primary_key, m.key, m.op, &env, m.scopes, m.backtrace, m.mapping, btree, timestamp, txn, superblock, &res);
+        rdb_modify(m.primary_key, m.key, m.op, &env, m.scopes, m.backtrace, m.mapping, btree, timestamp, txn, point_superblock(), sindexes, &res);
     }
 
     void operator()(const point_delete_t &d) {
         response->response = point_delete_response_t();
         point_delete_response_t &res = boost::get<point_delete_response_t>(response->response);
-        rdb_delete(d.key, btree, timestamp, txn, superblock, &res);
+        rdb_delete(d.key, btree, timestamp, txn, point_superblock(), sindexes, &res);
+    }
+
+    void operator()(const sindex_create_t &c) {
+        response->response = sindex_create_response_t(rdb_sindex_create(c.id, btree, txn, superblock));
+    }
+
+    void operator()(const sindex_drop_t &d) {
+        response->response = sindex_drop_response_t(rdb_sindex_drop(d.id, btree, txn, superblock));
     }
 
     write_visitor_t(btree_slice_t *_btree,
                     transaction_t *_txn,
-                    superblock_t *_superblock,
+                    real_superblock_t *_superblock,
                     repli_timestamp_t _timestamp,
                     rdb_protocol_t::context_t *ctx,
                     write_response_t *_response,
@@ -627,6 +811,7 @@ struct write_visitor_t : public boost::static_visitor<void> {
         txn(_txn),
         response(_response),
         superblock(_superblock),
+        unreleasing_superblock(_superblock),
         timestamp(_timestamp),
         interruptor(_interruptor, ctx->signals[get_thread_id()].get()),
         env(ctx->pool_group,
@@ -637,13 +822,27 @@ struct write_visitor_t : public boost::static_visitor<void> {
             boost::make_shared<js::runner_t>(),
             &interruptor,
             ctx->machine_id)
-    { }
+    {
+        get_secondary_indexes(txn, superblock->get(), &sindexes);
+    }
 
 private:
+    /* Writes to a table with secondary indexes hold on to the superblock
+    until they've updated the indexes too. */
+    superblock_t *point_superblock() {
+        if (sindexes.empty()) {
+            return superblock;
+        } else {
+            return &unreleasing_superblock;
+        }
+    }
+
     btree_slice_t *btree;
     transaction_t *txn;
     write_response_t *response;
-    superblock_t *superblock;
+    real_superblock_t *superblock;
+    unreleasing_superblock_t unreleasing_superblock;
+    secondary_index_map_t sindexes;
     repli_timestamp_t timestamp;
     wait_any_t interruptor;
     query_language::runtime_environment_t env;
@@ -656,10 +855,16 @@ void store_t::protocol_write(const write_t &write,
                              transition_timestamp_t timestamp,
                              btree_slice_t *btree,
                              transaction_t *txn,
-                             superblock_t *superblock,
+                             real_superblock_t *superblock,
                              signal_t *interruptor) {
     write_visitor_t v(btree, txn, superblock, timestamp.to_repli_timestamp(), ctx, response, interruptor);
     boost::apply_visitor(v, write.write);
+
+    if (const sindex_create_t *c = boost::get<sindex_create_t>(&write.write)) {
+        if (boost::get<sindex_create_response_t>(response->response).success) {
+            coro_t::spawn_sometime(boost::bind(&store_t::fill_sindex, this, c->id, auto_drainer_t::lock_t(&drainer)));
+        }
+    }
 }
 
 namespace {
@@ -676,6 +881,10 @@ struct backfill_chunk_get_region_visitor_t : public boost::static_visitor<region
     region_t operator()(const backfill_chunk_t::key_value_pair_t &kv) {
         return rdb_protocol_t::monokey_region(kv.backfill_atom.key);
     }
+
+    region_t operator()(const backfill_chunk_t::sindexes_t &s) {
+        return s.range;
+    }
 };
 
 }   /* anonymous namespace */
@@ -699,6 +908,10 @@ struct backfill_chunk_get_btree_repli_timestamp_visitor_t : public boost::static
     repli_timestamp_t operator()(const backfill_chunk_t::key_value_pair_t &kv) {
         return kv.backfill_atom.recency;
     }
+
+    repli_timestamp_t operator()(const backfill_chunk_t::sindexes_t &) {
+        return repli_timestamp_t::invalid;
+    }
 };
 
 }   /* anonymous namespace */
@@ -756,12 +969,20 @@ static void call_rdb_backfill(int i, btree_slice_t *btree, const std::vector<std
 
 void store_t::protocol_send_backfill(const region_map_t<rdb_protocol_t, state_timestamp_t> &start_point,
                                      chunk_fun_callback_t<rdb_protocol_t> *chunk_fun_cb,
-                                     superblock_t *superblock,
+                                     real_superblock_t *superblock,
                                      btree_slice_t *btree,
                                      transaction_t *txn,
                                      backfill_progress_t *progress,
                                      signal_t *interruptor)
                                      THROWS_ONLY(interrupted_exc_t) {
+    secondary_index_map_t sindexes;
+    get_secondary_indexes(txn, superblock->get(), &sindexes);
+    std::set<std::string> sindex_ids;
+    for (secondary_index_map_t::iterator it = sindexes.begin(); it != sindexes.end(); ++it) {
+        sindex_ids.insert(it->first);
+    }
+    chunk_fun_cb->send_chunk(backfill_chunk_t::sindexes(start_point.get_domain(), sindex_ids), interruptor);
+
     rdb_backfill_callback_impl_t callback(chunk_fun_cb);
     std::vector<std::pair<region_t, state_timestamp_t> > regions(start_point.begin(), start_point.end());
     refcount_superblock_t refcount_wrapper(superblock, regions.size());
@@ -780,26 +1001,44 @@ namespace {
 struct receive_backfill_visitor_t : public boost::static_visitor<void> {
     receive_backfill_visitor_t(btree_slice_t *_btree,
                                transaction_t *_txn,
-                               superblock_t *_superblock,
-                               signal_t *_interruptor) :
-      btree(_btree), txn(_txn), superblock(_superblock), interruptor(_interruptor) { }
+                               real_superblock_t *_superblock,
+                               signal_t *_interruptor,
+                               std::vector<std::string> *_created_sindexes) :
+      btree(_btree), txn(_txn), superblock(_superblock), unreleasing_superblock(_superblock),
+      interruptor(_interruptor), created_sindexes(_created_sindexes) {
+        get_secondary_indexes(txn, superblock->get(), &sindexes);
+    }
 
-    void operator()(const backfill_chunk_t::delete_key_t& delete_key) const {
+    void operator()(const backfill_chunk_t::delete_key_t& delete_key) {
         point_delete_response_t response;
-        rdb_delete(delete_key.key, btree, delete_key.recency, txn, superblock, &response);
+        rdb_delete(delete_key.key, btree, delete_key.recency, txn, point_superblock(), sindexes, &response);
     }
 
-    void operator()(const backfill_chunk_t::delete_range_t& delete_range) const {
+    void operator()(const backfill_chunk_t::delete_range_t& delete_range) {
         range_key_tester_t tester(delete_range.range);
-        rdb_erase_range(btree, &tester, delete_range.range.inner, txn, superblock);
+        rdb_erase_range(btree, &tester, delete_range.range.inner, txn, superblock, sindexes);
     }
 
-    void operator()(const backfill_chunk_t::key_value_pair_t& kv) const {
+    void operator()(const backfill_chunk_t::key_value_pair_t& kv) {
         const rdb_backfill_atom_t& bf_atom = kv.backfill_atom;
         point_write_response_t response;
         rdb_set(bf_atom.key, bf_atom.value, true,
                 btree, bf_atom.recency,
-                txn, superblock, &response);
+                txn, point_superblock(), sindexes, &response);
+    }
+
+    /* Make our indexes match the backfiller's before any rows arrive. */
+    void operator()(const backfill_chunk_t::sindexes_t& s) {
+        for (secondary_index_map_t::iterator it = sindexes.begin(); it != sindexes.end(); ++it) {
+            if (s.ids.find(it->first) == s.ids.end()) {
+                rdb_sindex_drop(it->first, btree, txn, superblock);
+            }
+        }
+        for (std::set<std::string>::const_iterator it = s.ids.begin(); it != s.ids.end(); ++it) {
+            if (sindexes.find(*it) == sindexes.end() && rdb_sindex_create(*it, btree, txn, superblock)) {
+                created_sindexes->push_back(*it);
+            }
+        }
     }
 
 private:
@@ -817,28 +1056,47 @@ private:
         const region_t& delete_range;
     };
 
+    superblock_t *point_superblock() {
+        if (sindexes.empty()) {
+            return superblock;
+        } else {
+            return &unreleasing_superblock;
+        }
+    }
+
     btree_slice_t *btree;
     transaction_t *txn;
-    superblock_t *superblock;
+    real_superblock_t *superblock;
+    unreleasing_superblock_t unreleasing_superblock;
+    secondary_index_map_t sindexes;
     signal_t *interruptor;  // FIXME: interruptors are not used in btree code, so this one ignored.
+    std::vector<std::string> *created_sindexes;
 };
 
 }   /* anonymous namespace */
 
 void store_t::protocol_receive_backfill(btree_slice_t *btree,
                                         transaction_t *txn,
-                                        superblock_t *superblock,
+                                        real_superblock_t *superblock,
                                         signal_t *interruptor,
                                         const backfill_chunk_t &chunk) {
-    boost::apply_visitor(receive_backfill_visitor_t(btree, txn, superblock, interruptor), chunk.val);
+    std::vector<std::string> created_sindexes;
+    receive_backfill_visitor_t v(btree, txn, superblock, interruptor, &created_sindexes);
+    boost::apply_visitor(v, chunk.val);
+
+    for (std::vector<std::string>::iterator it = created_sindexes.begin(); it != created_sindexes.end(); ++it) {
+        coro_t::spawn_sometime(boost::bind(&store_t::fill_sindex, this, *it, auto_drainer_t::lock_t(&drainer)));
+    }
 }
 
 void store_t::protocol_reset_data(const region_t& subregion,
                                   btree_slice_t *btree,
                                   transaction_t *txn,
-                                  superblock_t *superblock) {
+                                  real_superblock_t *superblock) {
+    secondary_index_map_t sindexes;
+    get_secondary_indexes(txn, superblock->get(), &sindexes);
     always_true_key_tester_t key_tester;
-    rdb_erase_range(btree, &key_tester, subregion.inner, txn, superblock);
+    rdb_erase_range(btree, &key_tester, subregion.inner, txn, superblock, sindexes);
 }
 
 region_t rdb_protocol_t::cpu_sharding_subspace(int subregion_number, int num_cpu_shards) {
@@ -874,6 +1132,9 @@ public:
         rassert(region_is_superset(region, ret.get_region()));
         return ret;
     }
+    rdb_protocol_t::backfill_chunk_t operator()(const rdb_protocol_t::backfill_chunk_t::sindexes_t &s) {
+        return rdb_protocol_t::backfill_chunk_t::sindexes(region_intersection(s.range, region), s.ids);
+    }
 private:
     const rdb_protocol_t::region_t &region;
 
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <list>
 #include <map>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -19,6 +20,7 @@
 #include "buffer_cache/types.hpp"
 #include "clustering/administration/namespace_interface_repository.hpp"
 #include "clustering/administration/namespace_metadata.hpp"
+#include "concurrency/auto_drainer.hpp"
 #include "concurrency/cross_thread_signal.hpp"
 #include "containers/archive/boost_types.hpp"
 #include "containers/archive/stl_types.hpp"
@@ -35,6 +37,7 @@
 
 template <class> class cross_thread_watchable_variable_t;
 class cluster_directory_metadata_t;
+class io_backender_t;
 template <class metadata> class directory_read_manager_t;
 
 using query_language::scopes_t;
@@ -148,7 +151,9 @@ struct rdb_protocol_t {
                   namespace_repo_t<rdb_protocol_t> *_ns_repo,
                   boost::shared_ptr<semilattice_readwrite_view_t<cluster_semilattice_metadata_t> > _semilattice_metadata,
                   directory_read_manager_t<cluster_directory_metadata_t> *_directory_read_manager,
-                  machine_id_t _machine_id);
+                  machine_id_t _machine_id,
+                  io_backender_t *_io_backender,
+                  const std::string &_spill_path);
         ~context_t();
 
         extproc::pool_group_t *pool_group;
@@ -163,6 +168,11 @@ struct rdb_protocol_t {
         cond_t interruptor; //TODO figure out where we're going to want to interrupt this from and put this there instead
         scoped_array_t<scoped_ptr_t<cross_thread_signal_t> > signals;
         machine_id_t machine_id;
+
+        /* Where queries' big sorts spill their runs to. `io_backender` is
+        `NULL` if there's nowhere to put them, e.g. on a proxy. */
+        io_backender_t *io_backender;
+        std::string spill_path;
     };
 
     struct point_read_response_t {
@@ -175,6 +185,14 @@ struct rdb_protocol_t {
         RDB_MAKE_ME_SERIALIZABLE_1(data);
     };
 
+    struct multi_point_read_response_t {
+        // One row for each key of the read, in the same order.  Rows that don't
+        // exist are JSON nulls, as with point_read_response_t.
+        std::vector<std::pair<store_key_t, boost::shared_ptr<scoped_cJSON_t> > > data;
+
+        RDB_MAKE_ME_SERIALIZABLE_1(data);
+    };
+
     struct rget_read_response_t {
         typedef std::vector<std::pair<store_key_t, boost::shared_ptr<scoped_cJSON_t> > > stream_t; //Present if there was no terminal
         typedef std::map<boost::shared_ptr<scoped_cJSON_t>, boost::shared_ptr<scoped_cJSON_t>, shared_scoped_less_t> groups_t; //Present if the terminal was a groupedmapreduce
@@ -223,7 +241,7 @@ struct rdb_protocol_t {
 
     struct read_response_t {
     private:
-        typedef boost::variant<point_read_response_t, rget_read_response_t, distribution_read_response_t> _response_t;
+        typedef boost::variant<point_read_response_t, rget_read_response_t, distribution_read_response_t, multi_point_read_response_t> _response_t;
     public:
         _response_t response;
 
@@ -244,27 +262,68 @@ struct rdb_protocol_t {
         RDB_MAKE_ME_SERIALIZABLE_1(key);
     };
 
+    class multi_point_read_t {
+    public:
+        multi_point_read_t() { }
+        // Sorts the keys and drops duplicates.
+        explicit multi_point_read_t(const std::vector<store_key_t> &_keys);
+
+        // Sorted, without duplicates.
+        std::vector<store_key_t> keys;
+
+        RDB_MAKE_ME_SERIALIZABLE_1(keys);
+    };
+
+    /* Restricts an rget to the rows whose `id` attribute is a number or a string
+    whose primary key printing falls between `lower` and `upper` (both
+    inclusive, and either may be missing), and reads them through the secondary
+    index on that attribute instead of scanning the table. Like a scan, the read
+    fails if any row in the region doesn't have such an attribute. `range` is
+    the part of the index that is left to read; it's in the index's own key
+    space. */
+    struct sindex_rangespec_t {
+        sindex_rangespec_t() { }
+        sindex_rangespec_t(const std::string &_id, const std::string &_primary_key,
+                           const boost::optional<store_key_t> &_lower,
+                           const boost::optional<store_key_t> &_upper,
+                           const backtrace_t &_backtrace);
+
+        std::string id;
+        std::string primary_key;
+        boost::optional<store_key_t> lower, upper;
+        key_range_t range;
+        /* The RANGE's, for when a row doesn't have a usable `id`. */
+        backtrace_t backtrace;
+
+        RDB_MAKE_ME_SERIALIZABLE_6(id, primary_key, lower, upper, range, backtrace);
+    };
+
     class rget_read_t {
     public:
-        rget_read_t() { }
+        /* How much each shard sends back in one chunk, by default. */
+        static const size_t DEFAULT_MAX_CHUNK_SIZE = MEGABYTE;
+
+        rget_read_t() : max_chunk_size(DEFAULT_MAX_CHUNK_SIZE) { }
         explicit rget_read_t(const region_t &_region)
-            : region(_region) { }
+            : region(_region), max_chunk_size(DEFAULT_MAX_CHUNK_SIZE) { }
 
         rget_read_t(const region_t &_region,
                     const rdb_protocol_details::transform_t &_transform)
-            : region(_region), transform(_transform)
+            : region(_region), transform(_transform),
+              max_chunk_size(DEFAULT_MAX_CHUNK_SIZE)
         { }
 
         rget_read_t(const region_t &_region,
                     const boost::optional<rdb_protocol_details::terminal_t> &_terminal)
-            : region(_region), terminal(_terminal)
+            : region(_region), terminal(_terminal),
+              max_chunk_size(DEFAULT_MAX_CHUNK_SIZE)
         { }
 
         rget_read_t(const region_t &_region,
                     const rdb_protocol_details::transform_t &_transform,
                     const boost::optional<rdb_protocol_details::terminal_t> &_terminal)
             : region(_region), transform(_transform),
-              terminal(_terminal)
+              terminal(_terminal), max_chunk_size(DEFAULT_MAX_CHUNK_SIZE)
         { }
 
         region_t region;
@@ -272,7 +331,16 @@ struct rdb_protocol_t {
         rdb_protocol_details::transform_t transform;
         boost::optional<rdb_protocol_details::terminal_t> terminal;
 
-        RDB_MAKE_ME_SERIALIZABLE_3(region, transform, terminal);
+        /* Set if the read goes through a secondary index. Its stream keys
+        are then keys in the index, not primary keys. */
+        boost::optional<sindex_rangespec_t> sindex;
+
+        /* Roughly how many bytes of rows (by `estimate_rget_response_size()`)
+        each shard reads before it stops and sets `truncated`. Streams pick
+        this to match how fast they're being read. */
+        size_t max_chunk_size;
+
+        RDB_MAKE_ME_SERIALIZABLE_5(region, transform, terminal, sindex, max_chunk_size);
     };
 
     class distribution_read_t {
@@ -294,7 +362,7 @@ struct rdb_protocol_t {
 
     struct read_t {
     private:
-        typedef boost::variant<point_read_t, rget_read_t, distribution_read_t> _read_t;
+        typedef boost::variant<point_read_t, rget_read_t, distribution_read_t, multi_point_read_t> _read_t;
     public:
         _read_t read;
 
@@ -346,14 +414,37 @@ struct rdb_protocol_t {
         RDB_MAKE_ME_SERIALIZABLE_2(result, exc);
     };
 
+    struct sindex_create_response_t {
+        // False if the index already existed everywhere.
+        bool success;
+
+        sindex_create_response_t() : success(false) { }
+        explicit sindex_create_response_t(bool _success) : success(_success) { }
+
+        RDB_MAKE_ME_SERIALIZABLE_1(success);
+    };
+
+    struct sindex_drop_response_t {
+        // False if there was no such index anywhere.
+        bool success;
+
+        sindex_drop_response_t() : success(false) { }
+        explicit sindex_drop_response_t(bool _success) : success(_success) { }
+
+        RDB_MAKE_ME_SERIALIZABLE_1(success);
+    };
+
     struct write_response_t {
-        boost::variant<point_write_response_t, point_modify_response_t, point_delete_response_t> response;
+        boost::variant<point_write_response_t, point_modify_response_t, point_delete_response_t,
+                       sindex_create_response_t, sindex_drop_response_t> response;
 
         write_response_t() { }
         write_response_t(const write_response_t& w) : response(w.response) { }
         explicit write_response_t(const point_write_response_t& w) : response(w) { }
         explicit write_response_t(const point_modify_response_t& m) : response(m) { }
         explicit write_response_t(const point_delete_response_t& d) : response(d) { }
+        explicit write_response_t(const sindex_create_response_t& c) : response(c) { }
+        explicit write_response_t(const sindex_drop_response_t& d) : response(d) { }
 
         RDB_MAKE_ME_SERIALIZABLE_1(response);
     };
@@ -398,8 +489,34 @@ struct rdb_protocol_t {
         RDB_MAKE_ME_SERIALIZABLE_1(key);
     };
 
+    /* Creates the secondary index on the attribute `id` in every store of
+    `region`, filling it in from the rows that are already there. */
+    class sindex_create_t {
+    public:
+        sindex_create_t() { }
+        explicit sindex_create_t(const std::string &_id)
+            : id(_id), region(region_t::universe()) { }
+
+        std::string id;
+        region_t region;
+
+        RDB_MAKE_ME_SERIALIZABLE_2(id, region);
+    };
+
+    class sindex_drop_t {
+    public:
+        sindex_drop_t() { }
+        explicit sindex_drop_t(const std::string &_id)
+            : id(_id), region(region_t::universe()) { }
+
+        std::string id;
+        region_t region;
+
+        RDB_MAKE_ME_SERIALIZABLE_2(id, region);
+    };
+
     struct write_t {
-        boost::variant<point_write_t, point_delete_t, point_modify_t> write;
+        boost::variant<point_write_t, point_delete_t, point_modify_t, sindex_create_t, sindex_drop_t> write;
 
         region_t get_region() const THROWS_NOTHING;
         write_t shard(const region_t &region) const THROWS_NOTHING;
@@ -410,6 +527,8 @@ struct rdb_protocol_t {
         explicit write_t(const point_write_t &w) : write(w) { }
         explicit write_t(const point_delete_t &d) : write(d) { }
         explicit write_t(const point_modify_t &m) : write(m) { }
+        explicit write_t(const sindex_create_t &c) : write(c) { }
+        explicit write_t(const sindex_drop_t &d) : write(d) { }
 
         RDB_MAKE_ME_SERIALIZABLE_1(write);
     };
@@ -440,10 +559,22 @@ struct rdb_protocol_t {
 
             RDB_MAKE_ME_SERIALIZABLE_1(backfill_atom);
         };
+        /* The secondary indexes the backfiller has. It comes before any of
+        the rows, so that the backfillee can create the missing indexes and
+        then keep them up to date as the rows come in. */
+        struct sindexes_t {
+            region_t range;
+            std::set<std::string> ids;
+
+            sindexes_t() { }
+            sindexes_t(const region_t &_range, const std::set<std::string> &_ids) : range(_range), ids(_ids) { }
+
+            RDB_MAKE_ME_SERIALIZABLE_2(range, ids);
+        };
 
         backfill_chunk_t() { }
-        explicit backfill_chunk_t(boost::variant<delete_range_t, delete_key_t, key_value_pair_t> _val) : val(_val) { }
-        boost::variant<delete_range_t, delete_key_t, key_value_pair_t> val;
+        explicit backfill_chunk_t(boost::variant<delete_range_t, delete_key_t, key_value_pair_t, sindexes_t> _val) : val(_val) { }
+        boost::variant<delete_range_t, delete_key_t, key_value_pair_t, sindexes_t> val;
 
         static backfill_chunk_t delete_range(const region_t& range) {
             return backfill_chunk_t(delete_range_t(range));
@@ -454,6 +585,9 @@ struct rdb_protocol_t {
         static backfill_chunk_t set_key(const rdb_protocol_details::backfill_atom_t& key) {
             return backfill_chunk_t(key_value_pair_t(key));
         }
+        static backfill_chunk_t sindexes(const region_t& range, const std::set<std::string> &ids) {
+            return backfill_chunk_t(sindexes_t(range, ids));
+        }
 
         region_t get_region() const;
 
@@ -482,7 +616,7 @@ struct rdb_protocol_t {
                            read_response_t *response,
                            btree_slice_t *btree,
                            transaction_t *txn,
-                           superblock_t *superblock,
+                           real_superblock_t *superblock,
                            signal_t *interruptor);
 
         void protocol_write(const write_t &write,
@@ -490,12 +624,12 @@ struct rdb_protocol_t {
                             transition_timestamp_t timestamp,
                             btree_slice_t *btree,
                             transaction_t *txn,
-                            superblock_t *superblock,
+                            real_superblock_t *superblock,
                             signal_t *interruptor);
 
         void protocol_send_backfill(const region_map_t<rdb_protocol_t, state_timestamp_t> &start_point,
                                     chunk_fun_callback_t<rdb_protocol_t> *chunk_fun_cb,
-                                    superblock_t *superblock,
+                                    real_superblock_t *superblock,
                                     btree_slice_t *btree,
                                     transaction_t *txn,
                                     backfill_progress_t *progress,
@@ -504,15 +638,26 @@ struct rdb_protocol_t {
 
         void protocol_receive_backfill(btree_slice_t *btree,
                                        transaction_t *txn,
-                                       superblock_t *superblock,
+                                       real_superblock_t *superblock,
                                        signal_t *interruptor,
                                        const backfill_chunk_t &chunk);
 
         void protocol_reset_data(const region_t& subregion,
                                  btree_slice_t *btree,
                                  transaction_t *txn,
-                                 superblock_t *superblock);
+                                 real_superblock_t *superblock);
+
+        /* New secondary indexes get filled in in the background, a few rows
+        per write transaction, rather than in one transaction that holds up
+        every other write until it has gone over the whole table. Indexes that
+        weren't ready when the store was last shut down pick up from the
+        beginning again. */
+        void fill_sindex(const std::string &id, auto_drainer_t::lock_t keepalive);
+        void fill_unready_sindexes(auto_drainer_t::lock_t keepalive);
+
         context_t *ctx;
+
+        auto_drainer_t drainer;
     };
 
 
@@ -3,12 +3,15 @@
 
 #include <math.h>
 
+#include <algorithm>
+
 #include "errors.hpp"
 #include <boost/make_shared.hpp>
 #include <boost/variant.hpp>
 
 #include "clustering/administration/main/ports.hpp"
 #include "clustering/administration/suggester.hpp"
+#include "config/args.hpp"
 #include "http/json.hpp"
 #include "rdb_protocol/internal_extensions.pb.h"
 #include "rdb_protocol/js.hpp"
@@ -771,17 +774,23 @@ void check_meta_query_type(MetaQuery *t, const backtrace_t &backtrace) {
         check_name_string(t->db_name(), backtrace);
         check_protobuf(!t->has_create_table());
         check_protobuf(!t->has_drop_table());
+        check_protobuf(!t->has_create_index());
+        check_protobuf(!t->has_drop_index());
         break;
     case MetaQuery::DROP_DB:
         check_protobuf(t->has_db_name());
         check_name_string(t->db_name(), backtrace);
         check_protobuf(!t->has_create_table());
         check_protobuf(!t->has_drop_table());
+        check_protobuf(!t->has_create_index());
+        check_protobuf(!t->has_drop_index());
         break;
     case MetaQuery::LIST_DBS:
         check_protobuf(!t->has_db_name());
         check_protobuf(!t->has_create_table());
         check_protobuf(!t->has_drop_table());
+        check_protobuf(!t->has_create_index());
+        check_protobuf(!t->has_drop_index());
         break;
     case MetaQuery::CREATE_TABLE: {
         check_protobuf(!t->has_db_name());
@@ -791,18 +800,40 @@ void check_meta_query_type(MetaQuery *t, const backtrace_t &backtrace) {
         }
         check_table_ref(t->create_table().table_ref(), backtrace.with("table_ref"));
         check_protobuf(!t->has_drop_table());
+        check_protobuf(!t->has_create_index());
+        check_protobuf(!t->has_drop_index());
     } break;
     case MetaQuery::DROP_TABLE:
         check_protobuf(!t->has_db_name());
         check_protobuf(!t->has_create_table());
         check_protobuf(t->has_drop_table());
         check_table_ref(t->drop_table(), backtrace);
+        check_protobuf(!t->has_create_index());
+        check_protobuf(!t->has_drop_index());
+        break;
+    case MetaQuery::CREATE_INDEX:
+        check_protobuf(!t->has_db_name());
+        check_protobuf(!t->has_create_table());
+        check_protobuf(!t->has_drop_table());
+        check_protobuf(t->has_create_index());
+        check_table_ref(t->create_index().table_ref(), backtrace.with("table_ref"));
+        check_protobuf(!t->has_drop_index());
+        break;
+    case MetaQuery::DROP_INDEX:
+        check_protobuf(!t->has_db_name());
+        check_protobuf(!t->has_create_table());
+        check_protobuf(!t->has_drop_table());
+        check_protobuf(!t->has_create_index());
+        check_protobuf(t->has_drop_index());
+        check_table_ref(t->drop_index().table_ref(), backtrace.with("table_ref"));
         break;
     case MetaQuery::LIST_TABLES:
         check_protobuf(t->has_db_name());
         check_name_string(t->db_name(), backtrace);
         check_protobuf(!t->has_create_table());
         check_protobuf(!t->has_drop_table());
+        check_protobuf(!t->has_create_index());
+        check_protobuf(!t->has_drop_index());
         break;
     default: unreachable("Unhandled MetaQuery.");
     }
@@ -903,6 +934,26 @@ void assign_dc_name(const std::string &dc_name_str, const backtrace_t& bt, name_
 }
 
 
+/* Finds the undeleted table that `table_ref` names. */
+metadata_searcher_t<namespace_semilattice_metadata_t<rdb_protocol_t> >::iterator
+meta_find_table(metadata_searcher_t<database_semilattice_metadata_t> *db_searcher,
+                metadata_searcher_t<namespace_semilattice_metadata_t<rdb_protocol_t> > *ns_searcher,
+                const TableRef &table_ref, const backtrace_t &bt) THROWS_ONLY(runtime_exc_t) {
+    name_string_t db_name;
+    assign_db_name(table_ref.db_name(), bt.with("db_name"), &db_name);
+    name_string_t table_name;
+    assign_table_name(table_ref.table_name(), bt.with("table_name"), &table_name);
+
+    uuid_t db_id = meta_get_uuid(*db_searcher, db_name, "FIND_DATABASE " + db_name.str(), bt.with("db_name"));
+    namespace_predicate_t search_predicate(&table_name, &db_id);
+    metadata_search_status_t status;
+    metadata_searcher_t<namespace_semilattice_metadata_t<rdb_protocol_t> >::iterator
+        ns_metadata = ns_searcher->find_uniq(search_predicate, &status);
+    meta_check(status, METADATA_SUCCESS, strprintf("FIND_TABLE %s.%s", db_name.c_str(), table_name.c_str()), bt.with("table_name"));
+    guarantee(!ns_metadata->second.is_deleted());
+    return ns_metadata;
+}
+
 void execute_meta(MetaQuery *m, runtime_environment_t *env, Response *res, const backtrace_t &bt) THROWS_ONLY(interrupted_exc_t, runtime_exc_t, broken_client_exc_t) {
     // This must be performed on the semilattice_metadata's home thread,
     int original_thread = get_thread_id();
@@ -1089,6 +1140,70 @@ void execute_meta(MetaQuery *m, runtime_environment_t *env, Response *res, const
         }
         res->set_status_code(Response::SUCCESS_STREAM);
     } break;
+    case MetaQuery::CREATE_INDEX: {
+        MetaQuery::IndexRef *index_ref = m->mutable_create_index();
+        const std::string &attrname = index_ref->attrname();
+        metadata_searcher_t<namespace_semilattice_metadata_t<rdb_protocol_t> >::iterator
+            ns_metadata = meta_find_table(&db_searcher, &ns_searcher, index_ref->table_ref(), bt.with("table_ref"));
+        namespace_semilattice_metadata_t<rdb_protocol_t> *ns = ns_metadata->second.get_mutable();
+        if (ns->sindexes.in_conflict()) {
+            throw runtime_exc_t("The table's secondary indexes are in conflict.", bt);
+        }
+        if (!ns->primary_key.in_conflict() && ns->primary_key.get() == attrname) {
+            throw runtime_exc_t(strprintf("`%s` is the primary key, so it's already indexed.", attrname.c_str()), bt);
+        }
+        std::set<std::string> sindexes = ns->sindexes.get();
+        if (!sindexes.insert(attrname).second) {
+            throw runtime_exc_t(strprintf("There already is an index on `%s`.", attrname.c_str()), bt);
+        }
+
+        /* Build the index in the stores before we tell anyone about it, so
+        that the queries that use it find it there. */
+        {
+            on_thread_t rethreader_original(original_thread);
+            namespace_repo_t<rdb_protocol_t>::access_t ns_access = eval_table_ref(index_ref->mutable_table_ref(), env, bt.with("table_ref"));
+            try {
+                rdb_protocol_t::write_t write((rdb_protocol_t::sindex_create_t(attrname)));
+                rdb_protocol_t::write_response_t response;
+                ns_access.get_namespace_if()->write(write, &response, order_token_t::ignore, env->interruptor);
+            } catch (const cannot_perform_query_exc_t &e) {
+                throw runtime_exc_t("cannot create index: " + std::string(e.what()), bt);
+            }
+        }
+
+        ns->sindexes = ns->sindexes.make_new_version(sindexes, env->this_machine);
+        env->semilattice_metadata->join(metadata);
+        res->set_status_code(Response::SUCCESS_EMPTY);
+    } break;
+    case MetaQuery::DROP_INDEX: {
+        MetaQuery::IndexRef *index_ref = m->mutable_drop_index();
+        const std::string &attrname = index_ref->attrname();
+        metadata_searcher_t<namespace_semilattice_metadata_t<rdb_protocol_t> >::iterator
+            ns_metadata = meta_find_table(&db_searcher, &ns_searcher, index_ref->table_ref(), bt.with("table_ref"));
+        namespace_semilattice_metadata_t<rdb_protocol_t> *ns = ns_metadata->second.get_mutable();
+        if (ns->sindexes.in_conflict()) {
+            throw runtime_exc_t("The table's secondary indexes are in conflict.", bt);
+        }
+        std::set<std::string> sindexes = ns->sindexes.get();
+        if (sindexes.erase(attrname) == 0) {
+            throw runtime_exc_t(strprintf("There is no index on `%s`.", attrname.c_str()), bt);
+        }
+
+        /* Stop queries from using the index before we take it away. */
+        ns->sindexes = ns->sindexes.make_new_version(sindexes, env->this_machine);
+        env->semilattice_metadata->join(metadata);
+
+        on_thread_t rethreader_original(original_thread);
+        namespace_repo_t<rdb_protocol_t>::access_t ns_access = eval_table_ref(index_ref->mutable_table_ref(), env, bt.with("table_ref"));
+        try {
+            rdb_protocol_t::write_t write((rdb_protocol_t::sindex_drop_t(attrname)));
+            rdb_protocol_t::write_response_t response;
+            ns_access.get_namespace_if()->write(write, &response, order_token_t::ignore, env->interruptor);
+        } catch (const cannot_perform_query_exc_t &e) {
+            throw runtime_exc_t("cannot drop index: " + std::string(e.what()), bt);
+        }
+        res->set_status_code(Response::SUCCESS_EMPTY);
+    } break;
     default: crash("unreachable");
     }
 }
@@ -1124,6 +1239,36 @@ std::string get_primary_key(TableRef *t, runtime_environment_t *env,
     return ns_metadata_it->second.get().primary_key.get();
 }
 
+std::set<std::string> get_sindexes(TableRef *t, runtime_environment_t *env,
+                                   const backtrace_t &bt) {
+    name_string_t db_name;
+    assign_db_name(t->db_name(), bt.with("db_name"), &db_name);
+    name_string_t table_name;
+    assign_table_name(t->table_name(), bt.with("table_name"), &table_name);
+
+    cow_ptr_t<namespaces_semilattice_metadata_t<rdb_protocol_t> > ns_metadata = env->namespaces_semilattice_metadata->get();
+    databases_semilattice_metadata_t db_metadata = env->databases_semilattice_metadata->get();
+
+    cow_ptr_t<namespaces_semilattice_metadata_t<rdb_protocol_t> >::change_t ns_metadata_change(&ns_metadata);
+    metadata_searcher_t<namespace_semilattice_metadata_t<rdb_protocol_t> >
+        ns_searcher(&ns_metadata_change.get()->namespaces);
+    metadata_searcher_t<database_semilattice_metadata_t>
+        db_searcher(&db_metadata.databases);
+
+    uuid_t db_id = meta_get_uuid(db_searcher, db_name, "FIND_DB " + db_name.str(), bt);
+    namespace_predicate_t pred(&table_name, &db_id);
+    metadata_search_status_t status;
+    metadata_searcher_t<namespace_semilattice_metadata_t<rdb_protocol_t> >::iterator
+        ns_metadata_it = ns_searcher.find_uniq(pred, &status);
+    meta_check(status, METADATA_SUCCESS, "FIND_TABLE " + table_name.str(), bt);
+    guarantee(!ns_metadata_it->second.is_deleted());
+    if (ns_metadata_it->second.get().sindexes.in_conflict()) {
+        // We can always fall back on scanning the table.
+        return std::set<std::string>();
+    }
+    return ns_metadata_it->second.get().sindexes.get();
+}
+
 void execute_query(Query *q, runtime_environment_t *env, Response *res, const scopes_t &scopes, const backtrace_t &backtrace, stream_cache_t *stream_cache) THROWS_ONLY(interrupted_exc_t, runtime_exc_t, broken_client_exc_t) {
     guarantee_debug_throw_release(q->token() == res->token(), backtrace);
     switch (q->type()) {
@@ -1261,6 +1406,45 @@ rdb_protocol_t::point_read_response_t read_by_key(namespace_repo_t<rdb_protocol_
     return *p_res;
 }
 
+bool row_key_less(const std::pair<store_key_t, boost::shared_ptr<scoped_cJSON_t> > &a,
+                  const std::pair<store_key_t, boost::shared_ptr<scoped_cJSON_t> > &b) {
+    return a.first < b.first;
+}
+
+/* Looks up every element of the array `keys` with a single read, and returns
+the rows in the same order as the keys (null for rows that don't exist). */
+boost::shared_ptr<scoped_cJSON_t> read_by_keys(namespace_repo_t<rdb_protocol_t>::access_t ns_access, runtime_environment_t *env,
+                                               cJSON *keys, bool use_outdated, const backtrace_t &backtrace) {
+    std::vector<store_key_t> store_keys;
+    for (int i = 0; i < cJSON_GetArraySize(keys); ++i) {
+        store_keys.push_back(store_key_t(cJSON_print_primary(cJSON_GetArrayItem(keys, i), backtrace.with(strprintf("key:%d", i)))));
+    }
+
+    boost::shared_ptr<scoped_cJSON_t> rows(new scoped_cJSON_t(cJSON_CreateArray()));
+    if (store_keys.empty()) {
+        return rows;
+    }
+
+    rdb_protocol_t::read_t read((rdb_protocol_t::multi_point_read_t(store_keys)));
+    rdb_protocol_t::read_response_t res;
+    if (use_outdated) {
+        ns_access.get_namespace_if()->read_outdated(read, &res, env->interruptor);
+    } else {
+        ns_access.get_namespace_if()->read(read, &res, order_token_t::ignore, env->interruptor);
+    }
+    rdb_protocol_t::multi_point_read_response_t *mp_res = boost::get<rdb_protocol_t::multi_point_read_response_t>(&res.response);
+    guarantee(mp_res);
+
+    // The response is sorted by key.
+    for (std::vector<store_key_t>::iterator it = store_keys.begin(); it != store_keys.end(); ++it) {
+        std::vector<std::pair<store_key_t, boost::shared_ptr<scoped_cJSON_t> > >::iterator row =
+            std::lower_bound(mp_res->data.begin(), mp_res->data.end(), std::make_pair(*it, boost::shared_ptr<scoped_cJSON_t>()), row_key_less);
+        guarantee(row != mp_res->data.end() && row->first == *it);
+        rows->AddItemToArray(row->second->DeepCopy());
+    }
+    return rows;
+}
+
 /* Returns number of rows deleted. */
 int point_delete(namespace_repo_t<rdb_protocol_t>::access_t ns_access, cJSON *id, runtime_environment_t *env, const backtrace_t &backtrace) {
     try {
@@ -1738,7 +1922,13 @@ boost::shared_ptr<scoped_cJSON_t> eval_term_as_json(Term *t, runtime_environment
         break;
     case Term::JSON: {
         const char *str = t->jsonstring().c_str();
-        boost::shared_ptr<scoped_cJSON_t> json(new scoped_cJSON_t(cJSON_Parse(str)));
+        boost::shared_ptr<scoped_cJSON_t> json;
+        if (t->jsonstring().size() >= STEALABLE_REQUEST_MIN_SIZE) {
+            on_any_thread_t rethreader;
+            json.reset(new scoped_cJSON_t(cJSON_Parse(str)));
+        } else {
+            json.reset(new scoped_cJSON_t(cJSON_Parse(str)));
+        }
         if (!json->get()) {
             throw runtime_exc_t(strprintf("Malformed JSON: %s", str), backtrace);
         }
@@ -1787,6 +1977,10 @@ boost::shared_ptr<scoped_cJSON_t> eval_term_as_json(Term *t, runtime_environment
             boost::shared_ptr<scoped_cJSON_t> key = eval_term_as_json(t->mutable_get_by_key()->mutable_key(), env, scopes, backtrace.with("key"));
 
             try {
+                if (key->type() == cJSON_Array) {
+                    // Fetch all of the rows at once, rather than making one round trip per key.
+                    return read_by_keys(ns_access, env, key->get(), t->get_by_key().table_ref().use_outdated(), backtrace.with("key"));
+                }
                 rdb_protocol_t::point_read_response_t p_res =
                     read_by_key(ns_access, env, key->get(), t->get_by_key().table_ref().use_outdated(), backtrace);
                 return p_res.data;
@@ -1799,13 +1993,9 @@ boost::shared_ptr<scoped_cJSON_t> eval_term_as_json(Term *t, runtime_environment
         crash("Term::TABLE must be evaluated with eval_stream or eval_view");
 
     case Term::JAVASCRIPT: {
-        // TODO(rntz): optimize map/reduce/filter queries whose
-        // mappings/reductions/predicates are just javascript terms by
-        // streaming arguments to them and streaming results back. Should
-        // wait to do this until it's established it's a bottleneck, but
-        // it's a reasonably good bet that it is. Putting this comment here
-        // not because the changes will need to be made here but because
-        // it's the most logical place to put it.
+        // Mappings and filters that are just a javascript term don't come
+        // through here one row at a time; `transform_rows()` sends them to
+        // `map_js_rdb()` a batch of rows at a time.
 
         // TODO (rntz): implicitly bound argument should become receiver
         // ("this") object on javascript side.
@@ -1817,25 +2007,17 @@ boost::shared_ptr<scoped_cJSON_t> eval_term_as_json(Term *t, runtime_environment
         // TODO(rntz): set up a js::runner_t::req_config_t with an
         // appropriately-chosen timeout.
 
-        // Check whether the function has been compiled already.
-        bool compiled = t->HasExtension(extension::js_id);
-
         // We give all values in scope as arguments.
         // TODO(rntz): this is wasteful double-copying.
-        std::vector<std::string> argnames; // only used if (!compiled)
+        std::vector<std::string> argnames;
         std::vector<boost::shared_ptr<scoped_cJSON_t> > argvals;
-        scopes.scope.dump(compiled ? NULL : &argnames, &argvals);
+        scopes.scope.dump(&argnames, &argvals);
 
-        js::id_t id;
-        if (compiled) {
-            id = t->GetExtension(extension::js_id);
-        } else {
-            // Not compiled yet. Compile it and add the extension.
-            id = js->compile(argnames, t->javascript(), &errmsg);
-            if (js::INVALID_ID == id) {
-                throw runtime_exc_t("failed to compile javascript: " + errmsg, backtrace);
-            }
-            t->SetExtension(extension::js_id, (int32_t) id);
+        // The runner caches compiled functions, so this only goes to the JS
+        // worker the first time it sees the function.
+        js::id_t id = js->compile(argnames, t->javascript(), &errmsg);
+        if (js::INVALID_ID == id) {
+            throw runtime_exc_t("failed to compile javascript: " + errmsg, backtrace);
         }
 
         // Figure out whether to bind "this" to the implicit object.
@@ -2458,8 +2640,13 @@ bool predicate_t::operator()(boost::shared_ptr<scoped_cJSON_t> json) {
 class ordering_t {
 public:
     ordering_t(const google::protobuf::RepeatedPtrField<Builtin::OrderBy> &_order, const backtrace_t &bt)
-        : order(_order), backtrace(bt)
-    { }
+        : backtrace(bt)
+    {
+        // We copy the order out of the query because a lazy sort can outlive it.
+        for (int i = 0; i < _order.size(); ++i) {
+            order.push_back(std::make_pair(_order.Get(i).attr(), _order.Get(i).ascending()));
+        }
+    }
 
     //returns true if x < y according to the ordering
     bool operator()(const boost::shared_ptr<scoped_cJSON_t> &x, const boost::shared_ptr<scoped_cJSON_t> &y) const {
@@ -2472,21 +2659,21 @@ public:
                 strprintf("Orderby encountered a non-object %s.\n", y->Print().c_str()),
                 backtrace);
         }
-        for (int i = 0; i < order.size(); ++i) {
-            const Builtin::OrderBy& cur = order.Get(i);
+        for (size_t i = 0; i < order.size(); ++i) {
+            const std::string &attr = order[i].first;
 
-            cJSON *a = cJSON_GetObjectItem(x->get(), cur.attr().c_str());
-            cJSON *b = cJSON_GetObjectItem(y->get(), cur.attr().c_str());
+            cJSON *a = cJSON_GetObjectItem(x->get(), attr.c_str());
+            cJSON *b = cJSON_GetObjectItem(y->get(), attr.c_str());
 
             if (a == NULL || b == NULL) {
-                std::string str = strprintf("ORDERBY encountered a row missing attr '%s': %s\n", cur.attr().c_str(),
+                std::string str = strprintf("ORDERBY encountered a row missing attr '%s': %s\n", attr.c_str(),
                                             (a == NULL ? x->Print().c_str() : y->Print().c_str()));
                 throw runtime_exc_t(str, backtrace);
             }
 
             int cmp = json_cmp(a, b);
             if (cmp) {
-                return (cmp > 0) ^ cur.ascending();
+                return (cmp > 0) ^ order[i].second;
             }
         }
 
@@ -2494,10 +2681,45 @@ public:
     }
 
 private:
-    const google::protobuf::RepeatedPtrField<Builtin::OrderBy> &order;
+    // (attr, ascending) pairs.
+    std::vector<std::pair<std::string, bool> > order;
     backtrace_t backtrace;
 };
 
+boost::shared_ptr<json_stream_t> sort_stream(boost::shared_ptr<json_stream_t> stream, const ordering_t &o, runtime_environment_t *env) {
+    return boost::shared_ptr<json_stream_t>(
+        new sort_stream_t(stream, o, env->io_backender, env->spill_path, ORDERBY_MEMORY_BUDGET));
+}
+
+/* Tables are read in primary key order, and filtering them keeps that order.
+Returns the table `t` reads from if its rows come out in that order, or `NULL`
+if we can't tell. */
+TableRef *get_table_in_primary_key_order(Term *t) {
+    if (t->type() == Term::TABLE) {
+        return t->mutable_table()->mutable_table_ref();
+    } else if (t->type() == Term::CALL && t->call().builtin().type() == Builtin::FILTER) {
+        return get_table_in_primary_key_order(t->mutable_call()->mutable_args(0));
+    } else {
+        return NULL;
+    }
+}
+
+/* Since primary keys are unique, ordering by ascending primary key is all that
+`order` does if it starts with it. */
+bool orders_by_primary_key(const google::protobuf::RepeatedPtrField<Builtin::OrderBy> &order, const std::string &primary_key) {
+    return order.size() > 0 && order.Get(0).attr() == primary_key && order.Get(0).ascending();
+}
+
+/* Tells a sort that's about to be sliced how far the slice goes, so it can keep
+just the top `stop` rows. */
+void limit_sort(json_stream_t *stream, bool stop_unbounded, int stop) {
+    if (!stop_unbounded) {
+        if (sort_stream_t *sorted = dynamic_cast<sort_stream_t *>(stream)) {
+            sorted->limit_to(stop);
+        }
+    }
+}
+
 /* Renaming map here because otherwise it conflicts with std::map. */
 boost::shared_ptr<scoped_cJSON_t> map_rdb(std::string arg, Term *term, runtime_environment_t *env, const scopes_t &scopes, const backtrace_t &backtrace, boost::shared_ptr<scoped_cJSON_t> val) {
     scopes_t scopes_copy = scopes;
@@ -2510,6 +2732,37 @@ boost::shared_ptr<scoped_cJSON_t> map_rdb(std::string arg, Term *term, runtime_e
     return eval_term_as_json(term, env, scopes_copy, backtrace);
 }
 
+void map_js_rdb(const std::string &arg, Term *term, runtime_environment_t *env, const scopes_t &scopes, const backtrace_t &backtrace,
+                const std::vector<boost::shared_ptr<scoped_cJSON_t> > &vals, std::vector<boost::shared_ptr<scoped_cJSON_t> > *out) {
+    guarantee(term->type() == Term::JAVASCRIPT);
+    out->clear();
+    if (vals.empty()) {
+        return;
+    }
+
+    // We only bind `arg` to find out where the rows go in the function's
+    // arguments; the worker fills each row in itself.
+    scopes_t scopes_copy = scopes;
+    variable_val_scope_t::new_scope_t scope_maker(&scopes_copy.scope, arg, vals[0]);
+
+    std::vector<std::string> argnames;
+    std::vector<boost::shared_ptr<scoped_cJSON_t> > argvals;
+    scopes_copy.scope.dump(&argnames, &argvals);
+    size_t row_arg = std::find(argnames.begin(), argnames.end(), arg) - argnames.begin();
+    guarantee(row_arg < argnames.size());
+
+    boost::shared_ptr<js::runner_t> js = env->get_js_runner();
+    std::string errmsg;
+    js::id_t id = js->compile(argnames, term->javascript(), &errmsg);
+    if (js::INVALID_ID == id) {
+        throw runtime_exc_t("failed to compile javascript: " + errmsg, backtrace);
+    }
+    if (!js->call_many(id, vals, argvals, row_arg, out, &errmsg)) {
+        throw runtime_exc_t("failed to evaluate javascript: " + errmsg, backtrace);
+    }
+    guarantee(out->size() == vals.size());
+}
+
 boost::shared_ptr<scoped_cJSON_t> eval_mapping(Mapping m, runtime_environment_t *env, const scopes_t &scopes, const backtrace_t &backtrace,
                                                boost::shared_ptr<scoped_cJSON_t> val) {
     return map_rdb(m.arg(), m.mutable_body(), env, scopes, backtrace, val);
@@ -2577,11 +2830,15 @@ boost::shared_ptr<json_stream_t> eval_call_as_stream(Term::Call *c, runtime_envi
             break;
         case Builtin::ORDERBY: {
             ordering_t o(c->builtin().order_by(), backtrace.with("order_by"));
+            if (TableRef *table_ref = get_table_in_primary_key_order(c->mutable_args(0))) {
+                std::string pk = get_primary_key(table_ref, env, backtrace.with("arg:0"));
+                if (orders_by_primary_key(c->builtin().order_by(), pk)) {
+                    // The rows already come in this order; there's nothing to sort.
+                    return eval_term_as_stream(c->mutable_args(0), env, scopes, backtrace.with("arg:0"));
+                }
+            }
             boost::shared_ptr<json_stream_t> stream = eval_term_as_stream(c->mutable_args(0), env, scopes, backtrace.with("arg:0"));
-
-            boost::shared_ptr<in_memory_stream_t> sorted_stream(new in_memory_stream_t(stream));
-            sorted_stream->sort(o);
-            return sorted_stream;
+            return sort_stream(stream, o, env);
         }
             break;
         case Builtin::DISTINCT:
@@ -2632,6 +2889,7 @@ boost::shared_ptr<json_stream_t> eval_call_as_stream(Term::Call *c, runtime_envi
                     throw runtime_exc_t("Slice stop cannot be before slice start", backtrace.with("arg:2"));
                 }
 
+                limit_sort(stream.get(), stop_unbounded, stop);
                 return boost::shared_ptr<json_stream_t>(new slice_stream_t(stream, start, stop_unbounded, stop));
             }
         case Builtin::UNION:
@@ -2656,9 +2914,6 @@ boost::shared_ptr<json_stream_t> eval_call_as_stream(Term::Call *c, runtime_envi
             break;
         case Builtin::RANGE:
             {
-                // TODO: ***use an index***
-                boost::shared_ptr<json_stream_t> stream = eval_term_as_stream(c->mutable_args(0), env, scopes, backtrace.with("arg:0"));
-
                 boost::shared_ptr<scoped_cJSON_t> lowerbound, upperbound;
 
                 Builtin::Range *r = c->mutable_builtin()->mutable_range();
@@ -2698,6 +2953,29 @@ boost::shared_ptr<json_stream_t> eval_call_as_stream(Term::Call *c, runtime_envi
                                         key_range_t::closed, store_key_t(cJSON_print_primary(upperbound->get(), backtrace)));
                 }
 
+                /* A range over a whole table can read just the rows it wants
+                through a secondary index, if there is one. */
+                if (c->args(0).type() == Term::TABLE) {
+                    TableRef *table_ref = c->mutable_args(0)->mutable_table()->mutable_table_ref();
+                    std::set<std::string> sindexes = get_sindexes(table_ref, env, backtrace.with("arg:0"));
+                    if (sindexes.find(r->attrname()) != sindexes.end()) {
+                        boost::optional<store_key_t> lower, upper;
+                        if (lowerbound) {
+                            lower = store_key_t(cJSON_print_primary(lowerbound->get(), backtrace));
+                        }
+                        if (upperbound) {
+                            upper = store_key_t(cJSON_print_primary(upperbound->get(), backtrace));
+                        }
+                        std::string pk = get_primary_key(table_ref, env, backtrace.with("arg:0"));
+                        namespace_repo_t<rdb_protocol_t>::access_t ns_access = eval_table_ref(table_ref, env, backtrace.with("arg:0"));
+                        return boost::shared_ptr<json_stream_t>(
+                            new batched_rget_stream_t(ns_access, env->interruptor,
+                                                      rdb_protocol_t::sindex_rangespec_t(r->attrname(), pk, lower, upper, backtrace),
+                                                      100, backtrace.with("arg:0"), table_ref->use_outdated()));
+                    }
+                }
+
+                boost::shared_ptr<json_stream_t> stream = eval_term_as_stream(c->mutable_args(0), env, scopes, backtrace.with("arg:0"));
                 return boost::shared_ptr<json_stream_t>(
                     new range_stream_t(stream, range, r->attrname(), backtrace));
             } break;
@@ -2779,10 +3057,12 @@ view_t eval_call_as_view(Term::Call *c, runtime_environment_t *env, const scopes
             {
                 ordering_t o(c->builtin().order_by(), backtrace.with("order_by"));
                 view_t view = eval_term_as_view(c->mutable_args(0), env, scopes, backtrace.with("arg:0"));
+                if (get_table_in_primary_key_order(c->mutable_args(0)) &&
+                    orders_by_primary_key(c->builtin().order_by(), view.primary_key)) {
+                    return view;
+                }
 
-                boost::shared_ptr<in_memory_stream_t> sorted_stream(new in_memory_stream_t(view.stream));
-                sorted_stream->sort(o);
-                return view_t(view.access, view.primary_key, sorted_stream);
+                return view_t(view.access, view.primary_key, sort_stream(view.stream, o, env));
             }
             break;
         case Builtin::SLICE:
@@ -2824,6 +3104,7 @@ view_t eval_call_as_view(Term::Call *c, runtime_environment_t *env, const scopes
                     throw runtime_exc_t("Slice stop cannot be before slice start", backtrace.with("arg:2"));
                 }
 
+                limit_sort(view.stream.get(), stop_unbounded, stop);
                 return view_t(view.access, view.primary_key, boost::shared_ptr<json_stream_t>(new slice_stream_t(view.stream, start, stop_unbounded, stop)));
             }
             break;
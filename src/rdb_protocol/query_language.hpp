@@ -105,6 +105,11 @@ boost::shared_ptr<scoped_cJSON_t> eval_mapping(Mapping m, runtime_environment_t
 
 boost::shared_ptr<scoped_cJSON_t> map_rdb(std::string arg, Term *term, runtime_environment_t *env, const scopes_t &scopes, const backtrace_t &backtrace, boost::shared_ptr<scoped_cJSON_t> val);
 
+/* Does what `map_rdb()` would for each of `vals`, for a `term` of type
+JAVASCRIPT, but evaluates all of them in one round-trip to the JS worker. */
+void map_js_rdb(const std::string &arg, Term *term, runtime_environment_t *env, const scopes_t &scopes, const backtrace_t &backtrace,
+                const std::vector<boost::shared_ptr<scoped_cJSON_t> > &vals, std::vector<boost::shared_ptr<scoped_cJSON_t> > *out);
+
 boost::shared_ptr<json_stream_t> concatmap(std::string arg, Term *term, runtime_environment_t *env, const scopes_t &scopes, const backtrace_t &backtrace, boost::shared_ptr<scoped_cJSON_t> val);
 
 } //namespace query_language
@@ -2,6 +2,9 @@
 #include <string.h>
 #include <algorithm>
 
+#include "errors.hpp"
+#include <boost/functional/hash.hpp>
+
 #include "rdb_protocol/exceptions.hpp"
 #include "rdb_protocol/rdb_protocol_json.hpp"
 #include "utils.hpp"
@@ -151,6 +154,59 @@ int json_cmp(cJSON *l, cJSON *r) {
     unreachable();
 }
 
+int64_t json_memory_size(const cJSON *json) {
+    int64_t size = sizeof(cJSON);
+    if (json->string) {
+        size += strlen(json->string) + 1;
+    }
+    if (json->valuestring) {
+        size += strlen(json->valuestring) + 1;
+    }
+    for (const cJSON *child = json->child; child; child = child->next) {
+        size += json_memory_size(child);
+    }
+    return size;
+}
+
+size_t json_hash(const cJSON *json) {
+    size_t seed = json->type;
+    switch (json->type) {
+        case cJSON_False:
+        case cJSON_True:
+        case cJSON_NULL:
+            break;
+        case cJSON_Number:
+            // `json_cmp()` says 0 and -0 are equal.
+            boost::hash_combine(seed, json->valuedouble == 0 ? 0.0 : json->valuedouble);
+            break;
+        case cJSON_String:
+            boost::hash_combine(seed, boost::hash_range(json->valuestring, json->valuestring + strlen(json->valuestring)));
+            break;
+        case cJSON_Array:
+            for (const cJSON *item = json->child; item; item = item->next) {
+                boost::hash_combine(seed, json_hash(item));
+            }
+            break;
+        case cJSON_Object:
+            {
+                // `json_cmp()` doesn't care about the order of the fields, so
+                // neither can we.
+                size_t fields = 0;
+                for (const cJSON *item = json->child; item; item = item->next) {
+                    size_t field = boost::hash_range(item->string, item->string + strlen(item->string));
+                    boost::hash_combine(field, json_hash(item));
+                    fields += field;
+                }
+                boost::hash_combine(seed, fields);
+            }
+            break;
+        default:
+            unreachable();
+            break;
+    }
+    return seed;
+}
+
 void require_type(const cJSON *json, int type, const backtrace_t &b) {
     if (json->type != type) {
         throw runtime_exc_t(strprintf("Required type: %s but found %s.",
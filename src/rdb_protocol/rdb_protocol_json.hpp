@@ -30,6 +30,29 @@ private:
     backtrace_t backtrace;
 };
 
+/* Roughly how much memory `json` takes up. Memory budgets (sorting, reading
+ahead in a table scan) are counted with this. */
+int64_t json_memory_size(const cJSON *json);
+
+/* A hash that agrees with `json_cmp()`: values that it says are equal hash the
+same, so it can key hash tables by JSON value. */
+size_t json_hash(const cJSON *json);
+
+class shared_scoped_hash_t {
+public:
+    size_t operator()(const boost::shared_ptr<scoped_cJSON_t> &a) const {
+        return json_hash(a->get());
+    }
+};
+
+class shared_scoped_equal_t {
+public:
+    bool operator()(const boost::shared_ptr<scoped_cJSON_t> &a,
+                    const boost::shared_ptr<scoped_cJSON_t> &b) const {
+        return json_cmp(a->get(), b->get()) == 0;
+    }
+};
+
 void require_type(const cJSON *, int type, const backtrace_t &);
 
 } //namespace query_language
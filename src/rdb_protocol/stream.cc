@@ -1,5 +1,10 @@
 // Copyright 2010-2012 RethinkDB, all rights reserved.
 #include "rdb_protocol/stream.hpp"
+
+#include "clustering/reactor/reactor.hpp"
+#include "config/args.hpp"
+#include "containers/uuid.hpp"
+#include "rdb_protocol/btree.hpp"
 #include "rdb_protocol/environment.hpp"
 #include "rdb_protocol/transform_visitors.hpp"
 
@@ -15,6 +20,12 @@ result_t json_stream_t::apply_terminal(const rdb_protocol_details::terminal_vari
     result_t res;
     boost::apply_visitor(terminal_initializer_visitor_t(&res, env, scopes, backtrace), t);
     boost::shared_ptr<scoped_cJSON_t> json;
+    if (const Builtin_GroupedMapReduce *gmr = boost::get<Builtin_GroupedMapReduce>(&t)) {
+        grouped_map_reduce_t groups(*gmr, env, scopes, backtrace);
+        while ((json = next())) groups.add_row(json);
+        groups.finish(boost::get<rdb_protocol_t::rget_read_response_t::groups_t>(&res));
+        return res;
+    }
     while ((json = next())) boost::apply_visitor(terminal_visitor_t(json, env, scopes, backtrace, &res), t);
     return res;
 }
@@ -41,6 +52,173 @@ boost::shared_ptr<scoped_cJSON_t> in_memory_stream_t::next() {
     }
 }
 
+bool sort_stream_t::entry_less_t::operator()(const entry_t &x, const entry_t &y) const {
+    if (less(x.row, y.row)) {
+        return true;
+    } else if (less(y.row, x.row)) {
+        return false;
+    } else {
+        return x.source < y.source;
+    }
+}
+
+bool sort_stream_t::entry_source_less(const entry_t &x, const entry_t &y) {
+    return x.source < y.source;
+}
+
+sort_stream_t::sort_stream_t(boost::shared_ptr<json_stream_t> _stream, const less_t &_less,
+                             io_backender_t *_io_backender, const std::string &_spill_path,
+                             int64_t _memory_budget)
+    : stream(_stream), less(_less), io_backender(_io_backender), spill_path(_spill_path),
+      memory_budget(_memory_budget), limited(false), limit(0), started(false),
+      buffer_pos(0), buffer_size(0), merge_heap(entry_greater_t(_less))
+{ }
+
+void sort_stream_t::limit_to(size_t n) {
+    guarantee(!started);
+    if (!limited || n < limit) {
+        limited = true;
+        limit = n;
+    }
+}
+
+boost::shared_ptr<scoped_cJSON_t> sort_stream_t::next() {
+    if (!started) {
+        started = true;
+        if (limited) {
+            read_top_k();
+        } else {
+            read_all();
+        }
+    }
+
+    if (runs.empty()) {
+        if (buffer_pos == buffer.size()) {
+            return boost::shared_ptr<scoped_cJSON_t>();
+        }
+        boost::shared_ptr<scoped_cJSON_t> res;
+        res.swap(buffer[buffer_pos++]);
+        return res;
+    }
+
+    if (merge_heap.empty()) {
+        return boost::shared_ptr<scoped_cJSON_t>();
+    }
+    entry_t top = merge_heap.top();
+    merge_heap.pop();
+    refill_from_run(top.source);
+    return top.row;
+}
+
+void sort_stream_t::read_all() {
+    size_t rows = 0;
+    while (boost::shared_ptr<scoped_cJSON_t> json = stream->next()) {
+        ++rows;
+        buffer_size += json_memory_size(json->get());
+        buffer.push_back(json);
+        if (buffer_size > memory_budget && io_backender) {
+            spill_buffer();
+        }
+    }
+
+    if (rows == 1 && runs.empty()) {
+        // We want to do this so that we trigger exceptions consistently.
+        less(buffer.front(), buffer.front());
+    }
+    std::stable_sort(buffer.begin(), buffer.end(), less);
+
+    for (size_t i = 0; i <= runs.size(); ++i) {
+        refill_from_run(i);
+    }
+}
+
+void sort_stream_t::read_top_k() {
+    if (limit == 0) {
+        return;
+    }
+
+    /* A max-heap of the `limit` smallest rows so far. */
+    entry_less_t entry_less(less);
+    std::priority_queue<entry_t, std::vector<entry_t>, entry_less_t> top_k(entry_less);
+    int64_t top_k_size = 0;
+    size_t rows = 0;
+    while (boost::shared_ptr<scoped_cJSON_t> json = stream->next()) {
+        entry_t entry(json, rows++);
+        if (top_k.size() < limit) {
+            top_k_size += json_memory_size(json->get());
+            top_k.push(entry);
+        } else if (entry_less(entry, top_k.top())) {
+            top_k_size -= json_memory_size(top_k.top().row->get());
+            top_k.pop();
+            top_k_size += json_memory_size(json->get());
+            top_k.push(entry);
+        }
+
+        if (top_k_size > memory_budget && io_backender) {
+            /* The limit is too big for the heap to fit in memory, so we sort
+            everything instead, which can spill. The rows that were dropped
+            from the heap can't be among the first `limit`, so we start from
+            the ones in it, in the order they came in so the sort stays
+            stable. */
+            std::vector<entry_t> entries;
+            entries.reserve(top_k.size());
+            while (!top_k.empty()) {
+                entries.push_back(top_k.top());
+                top_k.pop();
+            }
+            std::sort(entries.begin(), entries.end(), entry_source_less);
+            for (size_t i = 0; i < entries.size(); ++i) {
+                buffer.push_back(entries[i].row);
+            }
+            buffer_size = top_k_size;
+            spill_buffer();
+            read_all();
+            return;
+        }
+    }
+
+    if (rows == 1) {
+        // We want to do this so that we trigger exceptions consistently.
+        less(top_k.top().row, top_k.top().row);
+    }
+
+    buffer.resize(top_k.size());
+    for (size_t i = buffer.size(); i > 0; --i) {
+        buffer[i - 1] = top_k.top().row;
+        top_k.pop();
+    }
+}
+
+void sort_stream_t::spill_buffer() {
+    std::stable_sort(buffer.begin(), buffer.end(), less);
+
+    std::string filename = spill_path + "/sort_" + uuid_to_str(generate_uuid());
+    run_t *run = new run_t(io_backender, filename, &spill_stats);
+    runs.push_back(run);
+    for (size_t i = 0; i < buffer.size(); ++i) {
+        run->push(buffer[i]);
+    }
+
+    buffer.clear();
+    buffer_size = 0;
+}
+
+void sort_stream_t::refill_from_run(size_t run) {
+    if (runs.empty()) {
+        return;
+    }
+    if (run == runs.size()) {
+        if (buffer_pos < buffer.size()) {
+            merge_heap.push(entry_t(buffer[buffer_pos], run));
+            buffer[buffer_pos++].reset();
+        }
+    } else if (!runs[run].empty()) {
+        boost::shared_ptr<scoped_cJSON_t> json;
+        runs[run].pop(&json);
+        merge_heap.push(entry_t(json, run));
+    }
+}
+
 transform_stream_t::transform_stream_t(boost::shared_ptr<json_stream_t> _stream,
                                        runtime_environment_t *_env,
                                        const rdb_protocol_details::transform_t &tr) :
@@ -50,32 +228,43 @@ transform_stream_t::transform_stream_t(boost::shared_ptr<json_stream_t> _stream,
 
 boost::shared_ptr<scoped_cJSON_t> transform_stream_t::next() {
     while (data.empty()) {
-        boost::shared_ptr<scoped_cJSON_t> input = stream->next();
-        if (!input) {
-            return boost::shared_ptr<scoped_cJSON_t>();
+        /* JavaScript transforms go to the JS worker a batch of rows at a time,
+        so for those we read a batch of rows before applying anything. */
+        size_t batch_size = 1;
+        for (rdb_protocol_details::transform_t::iterator it = transform.begin(); it != transform.end(); ++it) {
+            if (is_batched_transform(*it)) {
+                batch_size = JS_CALL_BATCH_SIZE;
+                break;
+            }
         }
 
-        json_list_t accumulator;
-        accumulator.push_back(input);
+        std::vector<boost::shared_ptr<scoped_cJSON_t> > accumulator;
+        while (accumulator.size() < batch_size) {
+            boost::shared_ptr<scoped_cJSON_t> input = stream->next();
+            if (!input) {
+                break;
+            }
+            accumulator.push_back(input);
+        }
+        if (accumulator.empty()) {
+            return boost::shared_ptr<scoped_cJSON_t>();
+        }
 
         //Apply transforms to the data
         typedef rdb_protocol_details::transform_t::iterator tit_t;
         for (tit_t it  = transform.begin();
                    it != transform.end();
                    ++it) {
-            json_list_t tmp;
-            for (json_list_t::iterator jt  = accumulator.begin();
-                                       jt != accumulator.end();
-                                       ++jt) {
-                boost::apply_visitor(transform_visitor_t(*jt, &tmp, env, it->scopes, it->backtrace), it->variant);
-            }
+            std::vector<json_list_t> tmp;
+            transform_rows(*it, accumulator, env, &tmp);
 
-            /* Equivalent to `accumulator = tmp`, but without the extra copying */
-            std::swap(accumulator, tmp);
+            accumulator.clear();
+            for (size_t i = 0; i < tmp.size(); ++i) {
+                accumulator.insert(accumulator.end(), tmp[i].begin(), tmp[i].end());
+            }
         }
 
-        /* Equivalent to `data = accumulator`, but without the extra copying */
-        std::swap(data, accumulator);
+        data.insert(data.end(), accumulator.begin(), accumulator.end());
     }
 
     boost::shared_ptr<scoped_cJSON_t> res = data.front();
@@ -92,8 +281,29 @@ batched_rget_stream_t::batched_rget_stream_t(const namespace_repo_t<rdb_protocol
                       signal_t *_interruptor, key_range_t _range,
                       int _batch_size, const backtrace_t &_table_scan_backtrace,
                       bool _use_outdated)
-    : ns_access(_ns_access), interruptor(_interruptor),
-      range(_range), batch_size(_batch_size), index(0),
+    : ns_access(_ns_access), ns_if(ns_access.get_namespace_if()), interruptor(_interruptor),
+      range(_range), batch_size(_batch_size), rows_read(0), bytes_read(0), index(0),
+      finished(false), started(false), use_outdated(_use_outdated),
+      table_scan_backtrace(_table_scan_backtrace)
+{ }
+
+batched_rget_stream_t::batched_rget_stream_t(const namespace_repo_t<rdb_protocol_t>::access_t &_ns_access,
+                      signal_t *_interruptor, const rdb_protocol_t::sindex_rangespec_t &_sindex,
+                      int _batch_size, const backtrace_t &_table_scan_backtrace,
+                      bool _use_outdated)
+    : ns_access(_ns_access), ns_if(ns_access.get_namespace_if()), interruptor(_interruptor),
+      range(key_range_t::universe()), sindex(_sindex), batch_size(_batch_size),
+      rows_read(0), bytes_read(0), index(0),
+      finished(false), started(false), use_outdated(_use_outdated),
+      table_scan_backtrace(_table_scan_backtrace)
+{ }
+
+batched_rget_stream_t::batched_rget_stream_t(namespace_interface_t<rdb_protocol_t> *_ns_if,
+                      signal_t *_interruptor, key_range_t _range,
+                      int _batch_size, const backtrace_t &_table_scan_backtrace,
+                      bool _use_outdated)
+    : ns_if(_ns_if), interruptor(_interruptor),
+      range(_range), batch_size(_batch_size), rows_read(0), bytes_read(0), index(0),
       finished(false), started(false), use_outdated(_use_outdated),
       table_scan_backtrace(_table_scan_backtrace)
 { }
@@ -101,14 +311,30 @@ batched_rget_stream_t::batched_rget_stream_t(const namespace_repo_t<rdb_protocol
 boost::shared_ptr<scoped_cJSON_t> batched_rget_stream_t::next() {
     started = true;
     if (data.empty()) {
-        if (finished) {
-            return boost::shared_ptr<scoped_cJSON_t>();
+        if (prefetch_done.has()) {
+            if (!prefetch_done->is_pulsed()) {
+                /* The consumer got through the last chunk before the next one
+                came back, so it's worth asking for more rows at a time. */
+                if (chunk_size() < max_chunk_size()) {
+                    batch_size *= 2;
+                }
+                wait_interruptible(prefetch_done.get(), interruptor);
+            }
+            prefetch_done.reset();
+            if (prefetch_error) {
+                runtime_exc_t e = *prefetch_error;
+                prefetch_error.reset();
+                throw e;
+            }
+            data.swap(prefetched);
+        } else if (!finished) {
+            read_more(&data, interruptor);
         }
-        read_more();
         if (data.empty()) {
             finished = true;
             return boost::shared_ptr<scoped_cJSON_t>();
         }
+        start_prefetch();
     }
     boost::shared_ptr<scoped_cJSON_t> ret = data.front();
     data.pop_front();
@@ -127,13 +353,14 @@ result_t batched_rget_stream_t::apply_terminal(const rdb_protocol_details::termi
     rdb_protocol_t::rget_read_t rget_read(region);
     rget_read.transform = transform;
     rget_read.terminal = rdb_protocol_details::terminal_t(t, scopes, per_op_backtrace);
+    rget_read.sindex = sindex;
     rdb_protocol_t::read_t read(rget_read);
     try {
         rdb_protocol_t::read_response_t res;
         if (use_outdated) {
-            ns_access.get_namespace_if()->read_outdated(read, &res, interruptor);
+            ns_if->read_outdated(read, &res, interruptor);
         } else {
-            ns_access.get_namespace_if()->read(read, &res, order_token_t::ignore, interruptor);
+            ns_if->read(read, &res, order_token_t::ignore, interruptor);
         }
         rdb_protocol_t::rget_read_response_t *p_res = boost::get<rdb_protocol_t::rget_read_response_t>(&res.response);
         guarantee(p_res);
@@ -149,16 +376,18 @@ result_t batched_rget_stream_t::apply_terminal(const rdb_protocol_details::termi
     }
 }
 
-void batched_rget_stream_t::read_more() {
+void batched_rget_stream_t::read_more(json_list_t *rows_out, signal_t *read_interruptor) {
     rdb_protocol_t::rget_read_t rget_read(rdb_protocol_t::region_t(range), transform);
+    rget_read.sindex = sindex;
+    rget_read.max_chunk_size = chunk_size();
     rdb_protocol_t::read_t read(rget_read);
     try {
-        guarantee(ns_access.get_namespace_if());
+        guarantee(ns_if);
         rdb_protocol_t::read_response_t res;
         if (use_outdated) {
-            ns_access.get_namespace_if()->read_outdated(read, &res, interruptor);
+            ns_if->read_outdated(read, &res, read_interruptor);
         } else {
-            ns_access.get_namespace_if()->read(read, &res, order_token_t::ignore, interruptor);
+            ns_if->read(read, &res, order_token_t::ignore, read_interruptor);
         }
         rdb_protocol_t::rget_read_response_t *p_res = boost::get<rdb_protocol_t::rget_read_response_t>(&res.response);
         guarantee(p_res);
@@ -175,12 +404,17 @@ void batched_rget_stream_t::read_more() {
 
         for (stream_t::iterator i = stream->begin(); i != stream->end(); ++i) {
             guarantee(i->second);
-            data.push_back(i->second);
+            rows_out->push_back(i->second);
+            bytes_read += estimate_rget_response_size(i->second);
         }
+        rows_read += stream->size();
 
-        range.left = p_res->last_considered_key;
+        /* Reads through an index go through the index's keys, so that's
+        where we pick up from. */
+        store_key_t *left = sindex ? &sindex->range.left : &range.left;
+        *left = p_res->last_considered_key;
 
-        if (!range.left.increment()) {
+        if (!left->increment()) {
             finished = true;
         }
     } catch (cannot_perform_query_exc_t e) {
@@ -188,6 +422,60 @@ void batched_rget_stream_t::read_more() {
     }
 }
 
+void batched_rget_stream_t::start_prefetch() {
+    guarantee(!prefetch_done.has());
+    if (finished) {
+        return;
+    }
+    prefetch_done.init(new cond_t);
+    coro_t::spawn_sometime(boost::bind(&batched_rget_stream_t::prefetch, this, auto_drainer_t::lock_t(&drainer)));
+}
+
+void batched_rget_stream_t::prefetch(auto_drainer_t::lock_t keepalive) {
+    try {
+        read_more(&prefetched, keepalive.get_drain_signal());
+    } catch (const runtime_exc_t &e) {
+        prefetch_error = e;
+    } catch (const interrupted_exc_t &) {
+        /* The stream is being destroyed, so nobody is waiting for the rows. */
+        return;
+    }
+    prefetch_done->pulse();
+}
+
+size_t batched_rget_stream_t::chunk_size() {
+    /* Until we've seen some rows, we ask for as much as a plain rget does. */
+    int64_t size = rdb_protocol_t::rget_read_t::DEFAULT_MAX_CHUNK_SIZE;
+    if (rows_read != 0) {
+        size = std::max<int64_t>(size, batch_size * std::max<int64_t>(bytes_read / rows_read, 1));
+    }
+    return std::min<int64_t>(size, max_chunk_size());
+}
+
+size_t batched_rget_stream_t::max_chunk_size() {
+    return std::max<size_t>(RGET_STREAM_MEMORY_BUDGET / (2 * num_shards()), 1);
+}
+
+int batched_rget_stream_t::num_shards() {
+    std::set<rdb_protocol_t::region_t> scheme;
+    try {
+        scheme = ns_if->get_sharding_scheme();
+    } catch (const cannot_perform_query_exc_t &) {
+        /* The read itself will run into this, and report it. */
+        return CLUSTER_CPU_SHARDING_FACTOR;
+    }
+    /* Reads through an index go to every shard. */
+    int n = 0;
+    for (std::set<rdb_protocol_t::region_t>::iterator it = scheme.begin(); it != scheme.end(); ++it) {
+        if (sindex || region_overlaps(*it, rdb_protocol_t::region_t(range))) {
+            ++n;
+        }
+    }
+    /* Each machine splits its part of a read up further, between its hash
+    shards. */
+    return std::max(n, 1) * CLUSTER_CPU_SHARDING_FACTOR;
+}
+
 union_stream_t::union_stream_t(const stream_list_t &_streams)
     : streams(_streams), hd(streams.begin())
 { }
@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <list>
+#include <queue>
 #include <set>
 #include <string>
 #include <vector>
@@ -11,11 +12,16 @@
 #include "errors.hpp"
 #include <boost/enable_shared_from_this.hpp>
 #include <boost/function.hpp>
+#include <boost/ptr_container/ptr_vector.hpp>
 #include <boost/scoped_ptr.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/variant/get.hpp>
 
 #include "clustering/administration/namespace_interface_repository.hpp"
+#include "concurrency/auto_drainer.hpp"
+#include "concurrency/cond_var.hpp"
+#include "containers/disk_backed_queue.hpp"
+#include "perfmon/core.hpp"
 #include "rdb_protocol/exceptions.hpp"
 #include "rdb_protocol/protocol.hpp"
 #include "rdb_protocol/stream_cache.hpp"
@@ -67,6 +73,96 @@ private:
     json_list_t data;
 };
 
+/* Hands out the rows of `stream` sorted by `less`. The sort is stable and
+lazy: nothing is read from `stream` until the first call to `next()`. Rows are
+buffered until they take up about `memory_budget` bytes, and then the buffer is
+sorted and spilled to a temporary file in `spill_path` as a run; `next()` merges
+the runs. If `io_backender` is `NULL` there is nowhere to spill to, and
+everything is sorted in memory. */
+class sort_stream_t : public json_stream_t {
+public:
+    typedef boost::function<bool(const boost::shared_ptr<scoped_cJSON_t> &, const boost::shared_ptr<scoped_cJSON_t> &)> less_t;  // NOLINT
+
+    sort_stream_t(boost::shared_ptr<json_stream_t> _stream, const less_t &_less,
+                  io_backender_t *_io_backender, const std::string &_spill_path,
+                  int64_t _memory_budget);
+
+    /* Promises that no more than `n` rows will be read, so that only the `n`
+    smallest rows have to be kept around. If those don't fit in the memory
+    budget either, the stream sorts everything and spills, as if there were no
+    limit. Must be called before `next()`. */
+    void limit_to(size_t n);
+
+    boost::shared_ptr<scoped_cJSON_t> next();
+
+    /* How many sorted runs have been spilled to disk. */
+    size_t spilled_runs() const { return runs.size(); }
+
+    /* Use default implementation of `add_transformation()` and `apply_terminal()` */
+
+private:
+    typedef disk_backed_queue_t<boost::shared_ptr<scoped_cJSON_t> > run_t;
+
+    /* For the merge, `source` is the run the row came from; for the top-k heap
+    it's the row's position in `stream`. Either way it breaks ties, which is
+    what keeps the sort stable. */
+    struct entry_t {
+        entry_t(const boost::shared_ptr<scoped_cJSON_t> &_row, size_t _source)
+            : row(_row), source(_source) { }
+        boost::shared_ptr<scoped_cJSON_t> row;
+        size_t source;
+    };
+
+    class entry_less_t {
+    public:
+        explicit entry_less_t(const less_t &_less) : less(_less) { }
+        bool operator()(const entry_t &x, const entry_t &y) const;
+    private:
+        less_t less;
+    };
+
+    class entry_greater_t {
+    public:
+        explicit entry_greater_t(const less_t &_less) : less(_less) { }
+        bool operator()(const entry_t &x, const entry_t &y) const {
+            return less(y, x);
+        }
+    private:
+        entry_less_t less;
+    };
+
+    static bool entry_source_less(const entry_t &x, const entry_t &y);
+
+    void read_all();
+    void read_top_k();
+    void spill_buffer();
+    void refill_from_run(size_t run);
+
+    boost::shared_ptr<json_stream_t> stream;
+    less_t less;
+    io_backender_t *io_backender;
+    std::string spill_path;
+    int64_t memory_budget;
+
+    bool limited;
+    size_t limit;
+    bool started;
+
+    /* The rows that haven't been spilled, sorted once `stream` runs out. */
+    std::vector<boost::shared_ptr<scoped_cJSON_t> > buffer;
+    size_t buffer_pos;
+    int64_t buffer_size;
+
+    /* The spilled runs, and a heap holding the next row of each of them. If
+    there are runs, the rows left in `buffer` take part in the merge as one more
+    run, numbered `runs.size()`. */
+    perfmon_collection_t spill_stats;
+    boost::ptr_vector<run_t> runs;
+    std::priority_queue<entry_t, std::vector<entry_t>, entry_greater_t> merge_heap;
+
+    DISABLE_COPYING(sort_stream_t);
+};
+
 class transform_stream_t : public json_stream_t {
 public:
     transform_stream_t(boost::shared_ptr<json_stream_t> stream, runtime_environment_t *env, const rdb_protocol_details::transform_t &tr);
@@ -81,6 +177,14 @@ private:
     json_list_t data;
 };
 
+/* Reads a table (or a range of a secondary index) a chunk at a time. As soon
+as it starts handing out one chunk it asks for the next one, so that the
+cluster round-trip overlaps with whatever the consumer does with the rows.
+Chunks start out as big as a plain rget's, and after that hold at least about
+`_batch_size` rows, which grows when the consumer catches up with the
+read-ahead. Every shard that a read goes to sends back up to a chunk's worth,
+so chunks are bounded so that what all the shards send for the two chunks that
+are in memory at once fits in `RGET_STREAM_MEMORY_BUDGET`. */
 class batched_rget_stream_t : public json_stream_t {
 public:
     batched_rget_stream_t(const namespace_repo_t<rdb_protocol_t>::access_t &_ns_access, 
@@ -88,6 +192,18 @@ public:
                           int _batch_size, const backtrace_t &_table_scan_backtrace,
                           bool _use_outdated);
 
+    /* Reads the rows that `sindex` picks out through its secondary index. */
+    batched_rget_stream_t(const namespace_repo_t<rdb_protocol_t>::access_t &_ns_access,
+                          signal_t *_interruptor, const rdb_protocol_t::sindex_rangespec_t &_sindex,
+                          int _batch_size, const backtrace_t &_table_scan_backtrace,
+                          bool _use_outdated);
+
+    /* Reads straight from `_ns_if`, which must outlive the stream. */
+    batched_rget_stream_t(namespace_interface_t<rdb_protocol_t> *_ns_if,
+                          signal_t *_interruptor, key_range_t _range,
+                          int _batch_size, const backtrace_t &_table_scan_backtrace,
+                          bool _use_outdated);
+
     boost::shared_ptr<scoped_cJSON_t> next();
 
     boost::shared_ptr<json_stream_t> add_transformation(const rdb_protocol_details::transform_variant_t &t, runtime_environment_t *env, const scopes_t &scopes, const backtrace_t &backtrace);
@@ -98,20 +214,49 @@ public:
     };
 
 private:
-    void read_more();
+    /* Reads the next chunk into `rows_out` and moves `range` (or `sindex`)
+    past it. */
+    void read_more(json_list_t *rows_out, signal_t *read_interruptor);
+
+    void start_prefetch();
+    void prefetch(auto_drainer_t::lock_t keepalive);
+
+    /* Roughly how many bytes of rows to ask each shard for. */
+    size_t chunk_size();
+    /* The most that `chunk_size()` can be. */
+    size_t max_chunk_size();
+    /* How many shards a read of `range` (or `sindex`) goes out to. */
+    int num_shards();
 
     rdb_protocol_details::transform_t transform;
     namespace_repo_t<rdb_protocol_t>::access_t ns_access;
+    namespace_interface_t<rdb_protocol_t> *ns_if;
     signal_t *interruptor;
     key_range_t range;
+    boost::optional<rdb_protocol_t::sindex_rangespec_t> sindex;
     int batch_size;
 
+    /* What the rows we've read so far added up to, by
+    `estimate_rget_response_size()`. */
+    int64_t rows_read, bytes_read;
+
     json_list_t data;
     int index;
     bool finished, started;
     bool use_outdated;
 
     backtrace_t table_scan_backtrace;
+
+    /* The read-ahead. `prefetch_done` is set while one is in flight, and is
+    pulsed once `prefetched` or `prefetch_error` is filled in. */
+    scoped_ptr_t<cond_t> prefetch_done;
+    json_list_t prefetched;
+    boost::optional<runtime_exc_t> prefetch_error;
+
+    /* Interrupts the read-ahead when the stream goes away. It reads with
+    this rather than `interruptor`, which only lives as long as the query
+    that's currently reading from the stream. */
+    auto_drainer_t drainer;
 };
 
 class union_stream_t : public json_stream_t {
@@ -214,15 +359,11 @@ public:
         while (boost::shared_ptr<scoped_cJSON_t> json = stream->next()) {
             guarantee(json);
             guarantee(json->get());
-            if (json->type() != cJSON_Object) {
-                throw runtime_exc_t(strprintf("Got non-object in RANGE query: %s.", json->Print().c_str()), backtrace);
+            std::string error = range_row_error(json->get(), attrname);
+            if (!error.empty()) {
+                throw runtime_exc_t(error, backtrace);
             }
-            scoped_cJSON_t val(cJSON_DeepCopy(json->GetObjectItem(attrname.c_str())));
-            if (!val.get()) {
-                throw runtime_exc_t(strprintf("Object %s has no attribute %s.", json->Print().c_str(), attrname.c_str()), backtrace);
-            } else if (val.type() != cJSON_Number && val.type() != cJSON_String) {
-                throw runtime_exc_t(strprintf("Primary key must be a number or string, not %s.", val.Print().c_str()), backtrace);
-            } else if (range.contains_key(store_key_t(cJSON_print_primary(val.get(), backtrace)))) {
+            if (range.contains_key(store_key_t(cJSON_print_lexicographic(json->GetObjectItem(attrname.c_str()))))) {
                 return json;
             }
         }
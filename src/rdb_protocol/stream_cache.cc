@@ -22,25 +22,28 @@ void stream_cache_t::erase(int64_t key) {
 bool stream_cache_t::serve(int64_t key, Response *res, signal_t *interruptor) {
     std::map<int64_t, entry_t>::iterator it = streams.find(key);
     if (it == streams.end()) return false;
-    entry_t *entry = &it->second;
-    entry->last_activity = time(0);
+    it->second.last_activity = time(0);
+    // Other queries on the connection run while we block in `next()`, and
+    // they can evict entries, so we don't hold on to `it`.
+    boost::shared_ptr<query_language::json_stream_t> stream = it->second.stream;
+    int max_chunk_size = it->second.max_chunk_size;
     try {
         int chunk_size = 0;
         // This is a hack.  Some streams have an interruptor that is invalid by
         // the time we reach here, so we just reset it to a good one.
-        entry->stream->reset_interruptor(interruptor);
-        while (boost::shared_ptr<scoped_cJSON_t> json = entry->stream->next()) {
+        stream->reset_interruptor(interruptor);
+        while (boost::shared_ptr<scoped_cJSON_t> json = stream->next()) {
             res->add_response(json->PrintUnformatted());
-            if (entry->max_chunk_size && ++chunk_size >= entry->max_chunk_size) {
+            if (max_chunk_size && ++chunk_size >= max_chunk_size) {
                 res->set_status_code(Response::SUCCESS_PARTIAL);
                 return true;
             }
         }
     } catch (const std::exception &e) {
-        erase(key);
+        streams.erase(key);
         throw;
     }
-    erase(key);
+    streams.erase(key);
     res->set_status_code(Response::SUCCESS_STREAM);
     return true;
 }
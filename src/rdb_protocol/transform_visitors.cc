@@ -62,6 +62,52 @@ void transform_visitor_t::operator()(Builtin_Range range) const {
     }
 }
 
+bool is_batched_transform(const rdb_protocol_details::transform_atom_t &atom) {
+    if (const Mapping *mapping = boost::get<Mapping>(&atom.variant)) {
+        return mapping->body().type() == Term::JAVASCRIPT;
+    } else if (const Builtin_Filter *filter = boost::get<Builtin_Filter>(&atom.variant)) {
+        return filter->predicate().body().type() == Term::JAVASCRIPT;
+    } else {
+        return false;
+    }
+}
+
+void transform_rows(const rdb_protocol_details::transform_atom_t &atom,
+                    const std::vector<boost::shared_ptr<scoped_cJSON_t> > &rows,
+                    runtime_environment_t *env,
+                    std::vector<json_list_t> *out) {
+    out->clear();
+    out->resize(rows.size());
+
+    if (!is_batched_transform(atom)) {
+        for (size_t i = 0; i < rows.size(); ++i) {
+            boost::apply_visitor(transform_visitor_t(rows[i], &(*out)[i], env, atom.scopes, atom.backtrace), atom.variant);
+        }
+        return;
+    }
+
+    std::vector<boost::shared_ptr<scoped_cJSON_t> > results;
+    if (const Mapping *mapping = boost::get<Mapping>(&atom.variant)) {
+        Term body = mapping->body();
+        map_js_rdb(mapping->arg(), &body, env, atom.scopes, atom.backtrace, rows, &results);
+        for (size_t i = 0; i < rows.size(); ++i) {
+            (*out)[i].push_back(results[i]);
+        }
+    } else {
+        const Builtin_Filter *filter = boost::get<Builtin_Filter>(&atom.variant);
+        guarantee(filter);
+        Term body = filter->predicate().body();
+        map_js_rdb(filter->predicate().arg(), &body, env, atom.scopes, atom.backtrace, rows, &results);
+        for (size_t i = 0; i < rows.size(); ++i) {
+            if (results[i]->type() == cJSON_True) {
+                (*out)[i].push_back(rows[i]);
+            } else if (results[i]->type() != cJSON_False) {
+                throw runtime_exc_t("Predicate failed to evaluate to a bool", atom.backtrace);
+            }
+        }
+    }
+}
+
 terminal_initializer_visitor_t::terminal_initializer_visitor_t(rget_read_response_t::result_t *_out,
                                                                query_language::runtime_environment_t *_env,
                                                                const scopes_t &_scopes,
@@ -160,4 +206,48 @@ void terminal_visitor_t::operator()(const WriteQuery_ForEach &w) const {
     }
 }
 
+grouped_map_reduce_t::grouped_map_reduce_t(const Builtin_GroupedMapReduce &_gmr,
+                                           query_language::runtime_environment_t *_env,
+                                           const scopes_t &_scopes,
+                                           const backtrace_t &_backtrace)
+    : gmr(_gmr), env(_env), scopes(_scopes),
+      group_mapping_backtrace(_backtrace.with("group_mapping")),
+      value_mapping_backtrace(_backtrace.with("value_mapping")),
+      base_backtrace(_backtrace.with("reduction").with("base")),
+      body_backtrace(_backtrace.with("reduction").with("body"))
+{ }
+
+void grouped_map_reduce_t::add_row(boost::shared_ptr<scoped_cJSON_t> json) {
+    boost::shared_ptr<scoped_cJSON_t> group = query_language::map_rdb(gmr.group_mapping().arg(), gmr.mutable_group_mapping()->mutable_body(),
+                                                                      env, scopes, group_mapping_backtrace, json);
+    boost::shared_ptr<scoped_cJSON_t> value = query_language::map_rdb(gmr.value_mapping().arg(), gmr.mutable_value_mapping()->mutable_body(),
+                                                                      env, scopes, value_mapping_backtrace, json);
+
+    groups_t::iterator it = groups.find(group);
+    if (it == groups.end()) {
+        it = groups.insert(std::make_pair(group, eval_term_as_json(gmr.mutable_reduction()->mutable_base(), env, scopes, base_backtrace))).first;
+    }
+    reduce(&it->second, value);
+}
+
+void grouped_map_reduce_t::add_partial(boost::shared_ptr<scoped_cJSON_t> group, boost::shared_ptr<scoped_cJSON_t> value) {
+    std::pair<groups_t::iterator, bool> res = groups.insert(std::make_pair(group, value));
+    if (!res.second) {
+        reduce(&res.first->second, value);
+    }
+}
+
+void grouped_map_reduce_t::finish(rget_read_response_t::groups_t *out) {
+    out->insert(groups.begin(), groups.end());
+    groups.clear();
+}
+
+void grouped_map_reduce_t::reduce(boost::shared_ptr<scoped_cJSON_t> *acc, boost::shared_ptr<scoped_cJSON_t> value) {
+    scopes_t scopes_copy = scopes;
+    new_val_scope_t inner_scope(&scopes_copy.scope);
+    scopes_copy.scope.put_in_scope(gmr.reduction().var1(), *acc);
+    scopes_copy.scope.put_in_scope(gmr.reduction().var2(), value);
+    *acc = eval_term_as_json(gmr.mutable_reduction()->mutable_body(), env, scopes_copy, body_backtrace);
+}
+
 } //namespace query_language
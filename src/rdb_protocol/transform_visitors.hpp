@@ -3,9 +3,11 @@
 #define RDB_PROTOCOL_TRANSFORM_VISITORS_HPP_
 
 #include <list>
+#include <vector>
 
 #include "errors.hpp"
 #include <boost/shared_ptr.hpp>
+#include <boost/unordered_map.hpp>
 #include <boost/variant.hpp>
 
 #include "http/json.hpp"
@@ -20,6 +22,10 @@ class runtime_environment_t;
 
 typedef std::list<boost::shared_ptr<scoped_cJSON_t> > json_list_t;
 
+/* The visitors below are applied once per row, so rather than copying the
+scopes and backtrace each time they refer to the caller's, which have to outlive
+them. */
+
 /* A visitor for applying a transformation to a bit of json. */
 class transform_visitor_t : public boost::static_visitor<void> {
 public:
@@ -37,10 +43,22 @@ private:
     boost::shared_ptr<scoped_cJSON_t> json;
     json_list_t *out;
     query_language::runtime_environment_t *env;
-    scopes_t scopes;
-    backtrace_t backtrace;
+    const scopes_t &scopes;
+    const backtrace_t &backtrace;
 };
 
+/* Whether `atom` is a mapping or filter written in JavaScript, which
+`transform_rows()` evaluates a batch of rows at a time. */
+bool is_batched_transform(const rdb_protocol_details::transform_atom_t &atom);
+
+/* Applies `atom` to each of `rows`, putting what row `i` turns into in
+`(*out)[i]`. Batched transforms take one round-trip to the JS worker for all of
+the rows; everything else goes row by row. */
+void transform_rows(const rdb_protocol_details::transform_atom_t &atom,
+                    const std::vector<boost::shared_ptr<scoped_cJSON_t> > &rows,
+                    runtime_environment_t *env,
+                    std::vector<json_list_t> *out);
+
 /* A visitor for setting the result type based on a terminal. */
 class terminal_initializer_visitor_t : public boost::static_visitor<void> {
 public:
@@ -59,8 +77,8 @@ public:
 private:
     rget_read_response_t::result_t *out;
     query_language::runtime_environment_t *env;
-    scopes_t scopes;
-    backtrace_t backtrace;
+    const scopes_t &scopes;
+    const backtrace_t &backtrace;
 };
 
 /* A visitor for applying a terminal to a bit of json. */
@@ -83,11 +101,48 @@ public:
 private:
     boost::shared_ptr<scoped_cJSON_t> json;
     query_language::runtime_environment_t *env;
-    scopes_t scopes;
-    backtrace_t backtrace;
+    const scopes_t &scopes;
+    const backtrace_t &backtrace;
     rget_read_response_t::result_t *out;
 };
 
+/* Runs a grouped map-reduce a row at a time. This is the first phase, which
+each shard runs over its own rows; the coordinator then merges the shards'
+partial groups with `add_partial()`. While the rows come in the groups are kept
+in a hash table, because almost every row lands in a group that's already there
+and hashing the group is much cheaper than the `json_cmp()`s it takes to find
+it in a `groups_t`. `finish()` hands them over as a `groups_t`. */
+class grouped_map_reduce_t {
+public:
+    grouped_map_reduce_t(const Builtin_GroupedMapReduce &_gmr,
+                         query_language::runtime_environment_t *_env,
+                         const scopes_t &_scopes,
+                         const backtrace_t &_backtrace);
+
+    void add_row(boost::shared_ptr<scoped_cJSON_t> json);
+
+    /* Merges in `value`, which has already been reduced over some of the rows
+    in `group`. */
+    void add_partial(boost::shared_ptr<scoped_cJSON_t> group, boost::shared_ptr<scoped_cJSON_t> value);
+
+    void finish(rget_read_response_t::groups_t *out);
+
+private:
+    typedef boost::unordered_map<boost::shared_ptr<scoped_cJSON_t>, boost::shared_ptr<scoped_cJSON_t>,
+                                 shared_scoped_hash_t, shared_scoped_equal_t> groups_t;
+
+    void reduce(boost::shared_ptr<scoped_cJSON_t> *acc, boost::shared_ptr<scoped_cJSON_t> value);
+
+    Builtin_GroupedMapReduce gmr;
+    query_language::runtime_environment_t *env;
+    scopes_t scopes;
+    backtrace_t group_mapping_backtrace, value_mapping_backtrace, base_backtrace, body_backtrace;
+
+    groups_t groups;
+
+    DISABLE_COPYING(grouped_map_reduce_t);
+};
+
 }  // namespace query_language
 
 #endif  // RDB_PROTOCOL_TRANSFORM_VISITORS_HPP_
@@ -10,15 +10,24 @@
 #include "concurrency/cross_thread_signal.hpp"
 #include "concurrency/pmap.hpp"
 #include "concurrency/semaphore.hpp"
+#include "config/args.hpp"
 #include "containers/archive/vector_stream.hpp"
 #include "containers/object_buffer.hpp"
 #include "containers/uuid.hpp"
 #include "logger.hpp"
+#include "rpc/connectivity/compression.hpp"
 #include "utils.hpp"
 
 #define CLUSTER_PROTO_HEADER "RethinkDB " RETHINKDB_VERSION " cluster\n"
 const char *const cluster_proto_header = CLUSTER_PROTO_HEADER;
 
+/* After the handshake, everything sent over an intracluster connection goes in
+frames. A frame starts with two `uint64_t`s: the size of its contents, and the
+size they were compressed to, or 0 if they weren't. Then come the contents,
+compressed or not. The contents are one or more messages, each an `int64_t`
+size followed by that many bytes. */
+#define CLUSTER_FRAME_HEADER_SIZE (2 * sizeof(uint64_t))
+
 void debug_print(append_only_printf_buffer_t *buf, const peer_address_t &address) {
     buf->appendf("peer_address{ips=[");
     const std::set<ip_address_t> *ips = address.all_ips();
@@ -36,10 +45,12 @@ connectivity_cluster_t::run_t::run_t(connectivity_cluster_t *p,
                                      int port,
                                      message_handler_t *mh,
                                      int client_port,
-                                     heartbeat_manager_t *_heartbeat_manager) THROWS_ONLY(address_in_use_exc_t) :
+                                     heartbeat_manager_t *_heartbeat_manager,
+                                     const cluster_link_policy_t &_link_policy) THROWS_ONLY(address_in_use_exc_t) :
     parent(p),
     message_handler(mh),
     heartbeat_manager(_heartbeat_manager),
+    link_policy(_link_policy),
 
     /* Create the socket to use when listening for connections from peers */
     cluster_listener_socket(new tcp_bound_socket_t(local_addresses, port)),
@@ -69,7 +80,7 @@ connectivity_cluster_t::run_t::run_t(connectivity_cluster_t *p,
     `connection_map` on each thread and notifying any listeners that we're now
     connected to ourself. The destructor will remove us from the
     `connection_map` and again notify any listeners. */
-    connection_to_ourself(this, parent->me, NULL, routing_table[parent->me]),
+    connection_to_ourself(this, parent->me, NULL, routing_table[parent->me], cluster_link_options_t()),
 
     listener(new tcp_listener_t(cluster_listener_socket.get(),
                                 boost::bind(&connectivity_cluster_t::run_t::on_new_connection,
@@ -95,12 +106,14 @@ void connectivity_cluster_t::run_t::join(peer_address_t address) THROWS_NOTHING
         auto_drainer_t::lock_t(&drainer)));
 }
 
-connectivity_cluster_t::run_t::connection_entry_t::connection_entry_t(run_t *p, peer_id_t id, tcp_conn_stream_t *c, peer_address_t a) THROWS_NOTHING :
-    conn(c), address(a), session_id(generate_uuid()),
+connectivity_cluster_t::run_t::connection_entry_t::connection_entry_t(run_t *p, peer_id_t id, tcp_conn_stream_t *c, peer_address_t a, cluster_link_options_t o) THROWS_NOTHING :
+    conn(c), address(a), link_options(o), session_id(generate_uuid()),
     pm_collection(),
     pm_bytes_sent(secs_to_ticks(1), true),
+    pm_wire_bytes_sent(secs_to_ticks(1), true),
     pm_collection_membership(&p->parent->connectivity_collection, &pm_collection, uuid_to_str(id.get_uuid())),
     pm_bytes_sent_membership(&pm_collection, &pm_bytes_sent, "bytes_sent"),
+    pm_wire_bytes_sent_membership(&pm_collection, &pm_wire_bytes_sent, "wire_bytes_sent"),
     parent(p), peer(id),
     entries(new one_per_thread_t<entry_installation_t>(this)) {
     if (peer != parent->parent->me && parent->heartbeat_manager != NULL) {
@@ -301,6 +314,84 @@ static bool deserialize_and_check(tcp_conn_stream_t *c, T *p, const char *peer)
     }
 }
 
+/* Appends `message` to `frame`, starting the frame if it's empty. */
+static void append_to_frame(const std::vector<char> &message, std::vector<char> *frame) {
+    if (frame->empty()) {
+        frame->resize(CLUSTER_FRAME_HEADER_SIZE);
+    }
+    const int64_t size = message.size();
+    const char *size_bytes = reinterpret_cast<const char *>(&size);
+    frame->insert(frame->end(), size_bytes, size_bytes + sizeof(size));
+    frame->insert(frame->end(), message.begin(), message.end());
+}
+
+void connectivity_cluster_t::run_t::send_frame(connection_entry_t *connection, std::vector<char> *frame) THROWS_NOTHING {
+    rassert(connection->send_mutex.is_locked());
+    rassert(frame->size() > CLUSTER_FRAME_HEADER_SIZE);
+
+    const uint64_t raw_size = frame->size() - CLUSTER_FRAME_HEADER_SIZE;
+    uint64_t compressed_size = 0;
+    if (connection->link_options.compress &&
+        raw_size >= CLUSTER_COMPRESS_MIN_BYTES && raw_size <= CLUSTER_COMPRESS_MAX_BYTES) {
+        /* If it doesn't come out smaller, `lz_compress()` gives up and we send
+        the frame as it is. */
+        std::vector<char> compressed(CLUSTER_FRAME_HEADER_SIZE + raw_size - 1);
+        compressed_size = lz_compress(frame->data() + CLUSTER_FRAME_HEADER_SIZE, raw_size,
+                                      compressed.data() + CLUSTER_FRAME_HEADER_SIZE, raw_size - 1);
+        if (compressed_size != 0) {
+            compressed.resize(CLUSTER_FRAME_HEADER_SIZE + compressed_size);
+            frame->swap(compressed);
+        }
+    }
+    memcpy(frame->data(), &raw_size, sizeof(raw_size));
+    memcpy(frame->data() + sizeof(raw_size), &compressed_size, sizeof(compressed_size));
+
+    int64_t res = connection->conn->write(frame->data(), frame->size());
+    connection->pm_wire_bytes_sent.record(frame->size());
+    frame->clear();
+    if (res == -1) {
+        /* Close the other half of the connection to make sure that
+           `connectivity_cluster_t::run_t::handle()` notices that something is
+           up */
+        if (connection->conn->is_read_open()) {
+            connection->conn->shutdown_read();
+        }
+    }
+}
+
+/* Reads a frame off `conn` and puts its contents, decompressed, in `contents`. */
+static archive_result_t read_frame(read_stream_t *conn, std::vector<char> *contents) {
+    uint64_t header[2];
+    CT_ASSERT(sizeof(header) == CLUSTER_FRAME_HEADER_SIZE);
+    int64_t res = force_read(conn, header, sizeof(header));
+    if (res == -1) { return ARCHIVE_SOCK_ERROR; }
+    if (res < static_cast<int64_t>(sizeof(header))) { return ARCHIVE_SOCK_EOF; }
+    const uint64_t raw_size = header[0];
+    const uint64_t compressed_size = header[1];
+
+    if (compressed_size == 0) {
+        contents->resize(raw_size);
+        res = force_read(conn, contents->data(), raw_size);
+        if (res == -1) { return ARCHIVE_SOCK_ERROR; }
+        if (res < static_cast<int64_t>(raw_size)) { return ARCHIVE_SOCK_EOF; }
+        return ARCHIVE_SUCCESS;
+    }
+
+    if (raw_size > CLUSTER_COMPRESS_MAX_BYTES || compressed_size >= raw_size) {
+        return ARCHIVE_RANGE_ERROR;
+    }
+    std::vector<char> compressed(compressed_size);
+    res = force_read(conn, compressed.data(), compressed_size);
+    if (res == -1) { return ARCHIVE_SOCK_ERROR; }
+    if (res < static_cast<int64_t>(compressed_size)) { return ARCHIVE_SOCK_EOF; }
+
+    contents->resize(raw_size);
+    if (!lz_decompress(compressed.data(), compressed_size, contents->data(), raw_size)) {
+        return ARCHIVE_RANGE_ERROR;
+    }
+    return ARCHIVE_SUCCESS;
+}
+
 // We log error conditions as follows:
 // - silent: network error; conflict between parallel connections
 // - warning: invalid header
@@ -395,6 +486,21 @@ void connectivity_cluster_t::run_t::handle(
         return;
     }
 
+    /* Agree on how to use the connection. Each side says whether it wants the
+    link compressed, and it is if either of them does; coalescing only affects
+    how we write, so there's nothing to agree on there. */
+    cluster_link_options_t link_options = link_policy.get_options(other_address);
+    {
+        write_message_t msg;
+        msg << link_options.compress;
+        if (send_write_message(conn, &msg))
+            return;             // network error.
+    }
+    bool other_wants_compression;
+    if (deserialize_and_check(conn, &other_wants_compression, peername))
+        return;
+    link_options.compress = link_options.compress || other_wants_compression;
+
     // Just saying that we're still on the rpc listener thread.
     parent->assert_thread();
 
@@ -564,24 +670,43 @@ void connectivity_cluster_t::run_t::handle(
         /* `connection_entry_t` is the public interface of this coroutine. Its
         constructor registers it in the `connectivity_cluster_t`'s connection
         map and notifies any connect listeners. */
-        connection_entry_t conn_structure(this, other_id, conn, other_address);
+        connection_entry_t conn_structure(this, other_id, conn, other_address, link_options);
         heartbeat_keepalive_t keepalive(conn, heartbeat_manager, other_id);
 
         /* Main message-handling loop: read messages off the connection until
         it's closed, which may be due to network events, or the other end
         shutting down, or us shutting down. */
         try {
+            std::vector<char> frame;
             while (true) {
-                /* For now, we use `std::string` for messages on the wire: it's
-                just a length and a byte vector. This is obviously slow and we
-                should change it when we care about performance. */
-                std::string message;
-                if (deserialize_and_check(conn, &message, peername))
+                archive_result_t res = read_frame(conn, &frame);
+                if (res == ARCHIVE_RANGE_ERROR) {
+                    logERR("received a corrupt frame from %s, closing connection", peername);
+                    conn->shutdown_read();
+                }
+                if (res != ARCHIVE_SUCCESS) {
                     break;
+                }
 
-                std::vector<char> vec(message.begin(), message.end());
-                vector_read_stream_t stream(&vec);
-                message_handler->on_message(other_id, &stream); // might raise fake_archive_exc_t
+                for (size_t offset = 0; offset < frame.size();) {
+                    int64_t message_size;
+                    if (frame.size() - offset < sizeof(message_size)) {
+                        message_size = -1;
+                    } else {
+                        memcpy(&message_size, frame.data() + offset, sizeof(message_size));
+                        offset += sizeof(message_size);
+                    }
+                    if (message_size < 0 || static_cast<uint64_t>(message_size) > frame.size() - offset) {
+                        logERR("received a malformed frame from %s, closing connection", peername);
+                        conn->shutdown_read();
+                        throw fake_archive_exc_t();
+                    }
+
+                    std::vector<char> vec(frame.begin() + offset, frame.begin() + offset + message_size);
+                    offset += message_size;
+                    vector_read_stream_t stream(&vec);
+                    message_handler->on_message(other_id, &stream); // might raise fake_archive_exc_t
+                }
             }
         } catch (fake_archive_exc_t) {
             /* The exception broke us out of the loop, and that's what we
@@ -709,25 +834,34 @@ void connectivity_cluster_t::send_message(peer_id_t dest, send_message_write_cal
     } else {
         guarantee(dest != me);
         on_thread_t threader(conn_structure->conn->home_thread());
+        conn_structure->pm_bytes_sent.record(buffer.vector().size());
 
-        /* Acquire the send-mutex so we don't collide with other things trying
-        to send on the same connection. */
-        mutex_t::acq_t acq(&conn_structure->send_mutex);
+        if (conn_structure->link_options.coalesce) {
+            append_to_frame(buffer.vector(), &conn_structure->send_buffer);
 
-        {
-            write_message_t msg;
-            std::string buffer_str(buffer.vector().begin(), buffer.vector().end());
-            msg << buffer_str;
-            int res = send_write_message(conn_structure->conn, &msg);
-            conn_structure->pm_bytes_sent.record(buffer.vector().size());
-            if (res) {
-                /* Close the other half of the connection to make sure that
-                   `connectivity_cluster_t::run_t::handle()` notices that something is
-                   up */
-                if (conn_structure->conn->is_read_open()) {
-                    conn_structure->conn->shutdown_read();
-                }
+            /* If someone is already writing to the connection, they'll write
+            our message out after theirs. We only wait for them if the buffer
+            is getting too big, so that a slow connection pushes back on the
+            senders. */
+            if (conn_structure->send_mutex.is_locked() &&
+                conn_structure->send_buffer.size() < CLUSTER_COALESCE_MAX_BYTES) {
+                return;
+            }
+
+            mutex_t::acq_t acq(&conn_structure->send_mutex);
+            while (!conn_structure->send_buffer.empty()) {
+                std::vector<char> frame;
+                frame.swap(conn_structure->send_buffer);
+                run_t::send_frame(conn_structure, &frame);
             }
+        } else {
+            std::vector<char> frame;
+            append_to_frame(buffer.vector(), &frame);
+
+            /* Acquire the send-mutex so we don't collide with other things trying
+            to send on the same connection. */
+            mutex_t::acq_t acq(&conn_structure->send_mutex);
+            run_t::send_frame(conn_structure, &frame);
         }
     }
 }
@@ -115,6 +115,52 @@ private:
 
 void debug_print(append_only_printf_buffer_t *buf, const peer_address_t &address);
 
+/* `cluster_link_options_t` says how we use the TCP connection to one peer. */
+class cluster_link_options_t {
+public:
+    cluster_link_options_t() : compress(false), coalesce(true) { }
+    cluster_link_options_t(bool _compress, bool _coalesce) : compress(_compress), coalesce(_coalesce) { }
+
+    /* Compress the data sent in both directions. The two ends agree on this
+    during the handshake, and compress if either of them asks to. It's worth
+    the CPU time on links between datacenters, not so much on a LAN. */
+    bool compress;
+
+    /* Write the messages that pile up while the connection is busy as one
+    frame instead of one write apiece. A message never waits for others to join
+    it, so this costs nothing when the connection is idle. */
+    bool coalesce;
+};
+
+/* `cluster_link_policy_t` picks the options for each connection from the
+peer's address: the options for the first of its IPs that has an override, or
+else the default ones. To configure the links to a datacenter, set the same
+override for the address of each of its machines. */
+class cluster_link_policy_t {
+public:
+    cluster_link_policy_t() { }
+    explicit cluster_link_policy_t(const cluster_link_options_t &defaults) : default_options(defaults) { }
+
+    void set_options_for_address(const ip_address_t &address, const cluster_link_options_t &options) {
+        options_by_address[address] = options;
+    }
+
+    cluster_link_options_t get_options(const peer_address_t &peer) const {
+        const std::set<ip_address_t> *ips = peer.all_ips();
+        for (std::set<ip_address_t>::const_iterator it = ips->begin(); it != ips->end(); ++it) {
+            std::map<ip_address_t, cluster_link_options_t>::const_iterator jt = options_by_address.find(*it);
+            if (jt != options_by_address.end()) {
+                return jt->second;
+            }
+        }
+        return default_options;
+    }
+
+private:
+    cluster_link_options_t default_options;
+    std::map<ip_address_t, cluster_link_options_t> options_by_address;
+};
+
 class connectivity_cluster_t :
     public connectivity_service_t,
     public message_service_t,
@@ -128,7 +174,8 @@ public:
               int port,
               message_handler_t *message_handler,
               int client_port,
-              heartbeat_manager_t *_heartbeat_manager) THROWS_ONLY(address_in_use_exc_t);
+              heartbeat_manager_t *_heartbeat_manager,
+              const cluster_link_policy_t &_link_policy = cluster_link_policy_t()) THROWS_ONLY(address_in_use_exc_t);
 
         ~run_t();
 
@@ -145,7 +192,7 @@ public:
         public:
             /* The constructor registers us in every thread's `connection_map`;
             the destructor deregisters us. Both also notify all subscribers. */
-            connection_entry_t(run_t *, peer_id_t, tcp_conn_stream_t *, peer_address_t) THROWS_NOTHING;
+            connection_entry_t(run_t *, peer_id_t, tcp_conn_stream_t *, peer_address_t, cluster_link_options_t) THROWS_NOTHING;
             ~connection_entry_t() THROWS_NOTHING;
 
             /* NULL for our "connection" to ourself */
@@ -159,11 +206,21 @@ public:
             /* Unused for our connection to ourself */
             mutex_t send_mutex;
 
+            /* What we agreed on with the peer during the handshake. */
+            cluster_link_options_t link_options;
+
+            /* If `link_options.coalesce` is set, messages go here, framed,
+            before being written out. Whoever holds `send_mutex` keeps writing
+            out its contents until it's empty, so a sender that finds the mutex
+            taken can leave its message here and go on its way. Unused for our
+            connection to ourself. */
+            std::vector<char> send_buffer;
+
             uuid_t session_id;
 
             perfmon_collection_t pm_collection;
-            perfmon_sampler_t pm_bytes_sent;
-            perfmon_membership_t pm_collection_membership, pm_bytes_sent_membership;
+            perfmon_sampler_t pm_bytes_sent, pm_wire_bytes_sent;
+            perfmon_membership_t pm_collection_membership, pm_bytes_sent_membership, pm_wire_bytes_sent_membership;
 
         private:
             /* We only hold this information so we can deregister ourself */
@@ -208,6 +265,13 @@ public:
 
         void on_new_connection(const scoped_ptr_t<tcp_conn_descriptor_t> &nconn, auto_drainer_t::lock_t lock) THROWS_NOTHING;
 
+        /* Writes `*frame`, which was built by `append_to_frame()`, to the
+        connection, compressing it if the link calls for it, and leaves it
+        empty. The caller must hold `connection->send_mutex`. If the write
+        fails, shuts down the read half of the connection so that `handle()`
+        notices. */
+        static void send_frame(connection_entry_t *connection, std::vector<char> *frame) THROWS_NOTHING;
+
         /* `connectivity_cluster_t::connect_to_peer` is spawned for each known
         ip address of a peer which we want to connect to, all but one should
         fail */
@@ -243,6 +307,9 @@ public:
 
         heartbeat_manager_t *heartbeat_manager;
 
+        /* Consulted during the handshake of each new connection. */
+        const cluster_link_policy_t link_policy;
+
         /* `attempt_table` is a table of all the host:port pairs we're currently
         trying to connect to or have connected to. If we are told to connect to
         an address already in this table, we'll just ignore it. That's important
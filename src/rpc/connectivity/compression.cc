@@ -0,0 +1,197 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#define __STDC_LIMIT_MACROS
+#include "rpc/connectivity/compression.hpp"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <vector>
+
+#include "errors.hpp"
+
+#define LZ_HASH_BITS 12
+
+static inline uint32_t read_uint32(const char *p) {
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static inline uint32_t lz_hash(uint32_t value) {
+    return (value * 2654435761U) >> (32 - LZ_HASH_BITS);
+}
+
+/* Writes the extra bytes of a length whose nibble was 15. */
+static bool write_length(size_t length, char **op, char *oend) {
+    length -= 15;
+    for (;;) {
+        if (*op == oend) {
+            return false;
+        }
+        if (length < 255) {
+            *(*op)++ = static_cast<char>(length);
+            return true;
+        }
+        *(*op)++ = static_cast<char>(255);
+        length -= 255;
+    }
+}
+
+static bool read_length(const uint8_t **ip, const uint8_t *iend, size_t *length) {
+    uint8_t byte;
+    do {
+        if (*ip == iend) {
+            return false;
+        }
+        byte = *(*ip)++;
+        *length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+/* Writes a token, `num_literals` literals from `literals` and, if
+`match_length` is nonzero, the match. */
+static bool write_sequence(const char *literals, size_t num_literals, size_t match_offset, size_t match_length,
+                           char **op, char *oend) {
+    if (*op == oend) {
+        return false;
+    }
+    char *token = (*op)++;
+    uint8_t token_value = (num_literals < 15 ? num_literals : 15) << 4;
+    if (num_literals >= 15 && !write_length(num_literals, op, oend)) {
+        return false;
+    }
+    if (static_cast<size_t>(oend - *op) < num_literals) {
+        return false;
+    }
+    memcpy(*op, literals, num_literals);
+    *op += num_literals;
+
+    if (match_length != 0) {
+        rassert(match_length >= LZ_MIN_MATCH);
+        rassert(match_offset > 0 && match_offset <= LZ_MAX_OFFSET);
+        if (oend - *op < 2) {
+            return false;
+        }
+        *(*op)++ = static_cast<char>(match_offset & 0xff);
+        *(*op)++ = static_cast<char>(match_offset >> 8);
+        size_t length = match_length - LZ_MIN_MATCH;
+        token_value |= (length < 15 ? length : 15);
+        if (length >= 15 && !write_length(length, op, oend)) {
+            return false;
+        }
+    }
+    *token = static_cast<char>(token_value);
+    return true;
+}
+
+size_t lz_compress_bound(size_t src_size) {
+    return src_size + src_size / 255 + 16;
+}
+
+size_t lz_compress(const char *src, size_t src_size, char *dst, size_t dst_capacity) {
+    guarantee(src_size <= UINT32_MAX);
+
+    // Positions of the last four-byte sequence with each hash.
+    std::vector<uint32_t> table(1 << LZ_HASH_BITS, 0);
+
+    const char *const iend = src + src_size;
+    const char *ip = src;
+    const char *anchor = src;
+    char *op = dst;
+    char *const oend = dst + dst_capacity;
+
+    if (src_size >= LZ_MIN_MATCH) {
+        const char *const match_limit = iend - LZ_MIN_MATCH;
+        while (ip <= match_limit) {
+            const uint32_t sequence = read_uint32(ip);
+            const uint32_t hash = lz_hash(sequence);
+            const char *ref = src + table[hash];
+            table[hash] = ip - src;
+
+            if (ref >= ip || ip - ref > LZ_MAX_OFFSET || read_uint32(ref) != sequence) {
+                // Skip ahead faster the longer we go without a match, so that
+                // incompressible data doesn't cost much.
+                ip += 1 + ((ip - anchor) >> 6);
+                continue;
+            }
+
+            size_t match_length = LZ_MIN_MATCH;
+            while (ip + match_length < iend && ref[match_length] == ip[match_length]) {
+                ++match_length;
+            }
+
+            if (!write_sequence(anchor, ip - anchor, ip - ref, match_length, &op, oend)) {
+                return 0;
+            }
+            ip += match_length;
+            anchor = ip;
+        }
+    }
+
+    if (!write_sequence(anchor, iend - anchor, 0, 0, &op, oend)) {
+        return 0;
+    }
+    return op - dst;
+}
+
+bool lz_decompress(const char *src, size_t src_size, char *dst, size_t dst_size) {
+    const uint8_t *ip = reinterpret_cast<const uint8_t *>(src);
+    const uint8_t *const iend = ip + src_size;
+    char *op = dst;
+    char *const oend = dst + dst_size;
+
+    for (;;) {
+        if (ip == iend) {
+            return false;
+        }
+        const uint8_t token = *ip++;
+
+        size_t num_literals = token >> 4;
+        if (num_literals == 15 && !read_length(&ip, iend, &num_literals)) {
+            return false;
+        }
+        if (static_cast<size_t>(iend - ip) < num_literals || static_cast<size_t>(oend - op) < num_literals) {
+            return false;
+        }
+        if (num_literals > 0) {
+            memcpy(op, ip, num_literals);
+        }
+        op += num_literals;
+        ip += num_literals;
+
+        if (ip == iend) {
+            // The last sequence has no match.
+            return op == oend;
+        }
+
+        if (iend - ip < 2) {
+            return false;
+        }
+        const size_t match_offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (match_offset == 0 || match_offset > static_cast<size_t>(op - dst)) {
+            return false;
+        }
+
+        size_t match_length = token & 15;
+        if (match_length == 15 && !read_length(&ip, iend, &match_length)) {
+            return false;
+        }
+        match_length += LZ_MIN_MATCH;
+        if (static_cast<size_t>(oend - op) < match_length) {
+            return false;
+        }
+
+        const char *ref = op - match_offset;
+        if (match_offset >= match_length) {
+            memcpy(op, ref, match_length);
+        } else {
+            // The match overlaps what it's producing, as in runs of one byte.
+            for (size_t i = 0; i < match_length; ++i) {
+                op[i] = ref[i];
+            }
+        }
+        op += match_length;
+    }
+}
@@ -0,0 +1,34 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#ifndef RPC_CONNECTIVITY_COMPRESSION_HPP_
+#define RPC_CONNECTIVITY_COMPRESSION_HPP_
+
+#include <stddef.h>
+
+/* A small LZ77 codec, in the spirit of LZ4: a greedy compressor with a 4-byte
+hash and no entropy coding, so that both directions cost about as much as a
+couple of memcpys. It's meant for intracluster messages, which repeat
+themselves a lot (backfilled B-tree values, rows with the same field names over
+and over), not for squeezing out the last few percent.
+
+The compressed data is a sequence of (literals, match) pairs. Each starts with a
+token byte, whose high nibble is the number of literals and whose low nibble is
+the match length minus LZ_MIN_MATCH; a nibble of 15 means more length bytes
+follow, each adding up to 255. Then come the literals and a two-byte
+little-endian match offset. The last pair has no match and ends the data. */
+
+#define LZ_MIN_MATCH 4
+#define LZ_MAX_OFFSET 65535
+
+/* The most lz_compress() can need for `src_size` bytes of incompressible data. */
+size_t lz_compress_bound(size_t src_size);
+
+/* Compresses `src` into `dst`. Returns the compressed size, or 0 if it wouldn't
+fit in `dst_capacity` bytes. */
+size_t lz_compress(const char *src, size_t src_size, char *dst, size_t dst_capacity);
+
+/* Decompresses `src` into `dst`. Returns false, without reading or writing past
+either buffer, if `src` is corrupt or doesn't decompress to exactly `dst_size`
+bytes. */
+bool lz_decompress(const char *src, size_t src_size, char *dst, size_t dst_size) __attribute__((warn_unused_result));
+
+#endif  // RPC_CONNECTIVITY_COMPRESSION_HPP_
@@ -19,15 +19,21 @@ log_serializer_t. This leads to bugs in a couple of ways:
 Later, rewrite this so that we have a special interface through which to order
 garbage collection. */
 
+/* The priorities of data_block_manager_t::gc_io_accounts. */
+static const int gc_io_priorities[] = { GC_IO_PRIORITY_NICE, GC_IO_PRIORITY_MEDIUM, GC_IO_PRIORITY_HIGH };
+
 data_block_manager_t::data_block_manager_t(const log_serializer_dynamic_config_t *_dynamic_config, extent_manager_t *em, log_serializer_t *_serializer, const log_serializer_on_disk_static_config_t *_static_config, log_serializer_stats_t *_stats)
     : stats(_stats), shutdown_callback(NULL), state(state_unstarted), dynamic_config(_dynamic_config),
       static_config(_static_config), extent_manager(em), serializer(_serializer),
-      next_active_extent(0), gc_state(), gc_stats(stats)
+      // When GC is urgent, it stays on the medium account or above.
+      gc_rate_controller(num_gc_io_accounts, 1, GC_FOREGROUND_WRITE_LATENCY_TARGET_MICROS),
+      gc_score_time(current_microtime()), next_active_extent(0), gc_state(), gc_stats(stats)
 {
     rassert(dynamic_config);
     rassert(static_config);
     rassert(extent_manager);
     rassert(serializer);
+    CT_ASSERT(sizeof(gc_io_priorities) / sizeof(gc_io_priorities[0]) == num_gc_io_accounts);
 }
 
 data_block_manager_t::~data_block_manager_t() {
@@ -76,8 +82,10 @@ void data_block_manager_t::end_reconstruct() {
 void data_block_manager_t::start_existing(file_t *file, metablock_mixin_t *last_metablock) {
     rassert(state == state_unstarted);
     dbfile = file;
-    gc_io_account_nice.init(new file_account_t(file, GC_IO_PRIORITY_NICE));
-    gc_io_account_high.init(new file_account_t(file, GC_IO_PRIORITY_HIGH));
+    for (int i = 0; i < num_gc_io_accounts; ++i) {
+        gc_io_accounts[i].init(new file_account_t(file, gc_io_priorities[i]));
+    }
+    stats->pm_serializer_gc_io_priority += gc_io_priorities[gc_rate_controller.level()];
 
     /* Reconstruct the active data block extents from the metablock. */
     for (unsigned int i = 0; i < MAX_ACTIVE_DATA_EXTENTS; i++) {
@@ -225,6 +233,24 @@ void data_block_manager_t::read(off64_t off_in, void *buf_out, file_account_t *i
     }
 }
 
+/* Times a foreground data block write for the GC rate controller. */
+class dbm_foreground_write_timer_t : public iocallback_t {
+public:
+    dbm_foreground_write_timer_t(data_block_manager_t *_parent, iocallback_t *_callback)
+        : parent(_parent), callback(_callback), start_time(get_ticks()) { }
+
+    void on_io_complete() {
+        parent->on_foreground_write_complete(start_time);
+        callback->on_io_complete();
+        delete this;
+    }
+
+private:
+    data_block_manager_t *parent;
+    iocallback_t *callback;
+    ticks_t start_time;
+};
+
 /*
  Instead of wrapping this into a coroutine, we are still using a callback as we
  want to be able to spawn a lot of writes in parallel. Having to spawn a coroutine
@@ -243,6 +269,13 @@ off64_t data_block_manager_t::write(const void *buf_in, block_id_t block_id, boo
     off64_t offset = gimme_a_new_offset(token_referenced);
 
     ++stats->pm_serializer_data_blocks_written;
+    if (is_gc_io_account(io_account)) {
+        stats->pm_serializer_write_amplification.record_gc_write();
+        stats->pm_serializer_gc_bytes_written.record(static_config->block_size().ser_value());
+    } else {
+        stats->pm_serializer_write_amplification.record_user_write();
+        cb = new dbm_foreground_write_timer_t(this, cb);
+    }
 
     ls_buf_data_t *data = const_cast<ls_buf_data_t *>(reinterpret_cast<const ls_buf_data_t *>(buf_in) - 1);
     data->block_id = block_id;
@@ -302,20 +335,40 @@ void data_block_manager_t::check_and_handle_empty_extent(unsigned int extent_id)
 }
 
 file_account_t *data_block_manager_t::choose_gc_io_account() {
-    // Start going into high priority as soon as the garbage ratio is more than
-    // 2% above the configured goal.
-    // The idea is that we use the nice i/o account whenever possible, except
-    // if it proves insufficient to maintain an acceptable garbage ratio, in
-    // which case we switch over to the high priority account until the situation
-    // has improved.
-
-    // This means that we can end up oscillating between both accounts, which
-    // is probably fine. TODO: Make sure it actually is in practice!
-    if (garbage_ratio() > dynamic_config->gc_high_ratio * 1.02) {
-        return gc_io_account_high.get();
-    } else {
-        return gc_io_account_nice.get();
+    return gc_io_accounts[gc_rate_controller.level()].get();
+}
+
+void data_block_manager_t::adjust_gc_io_account() {
+    // GC is urgent as soon as the garbage ratio is more than 2% above the
+    // configured goal. The rate controller then keeps GC from backing off too
+    // far for the sake of foreground latency, until the situation has improved.
+    const bool urgent = garbage_ratio() > dynamic_config->gc_high_ratio * 1.02;
+
+    const int old_level = gc_rate_controller.level();
+    const int new_level = gc_rate_controller.adjust(urgent);
+    stats->pm_serializer_gc_io_priority += gc_io_priorities[new_level] - gc_io_priorities[old_level];
+}
+
+bool data_block_manager_t::is_gc_io_account(file_account_t *io_account) const {
+    for (int i = 0; i < num_gc_io_accounts; ++i) {
+        if (gc_io_accounts[i].get() == io_account) {
+            return true;
+        }
     }
+    return false;
+}
+
+void data_block_manager_t::on_foreground_write_complete(ticks_t start_time) {
+    gc_rate_controller.record_foreground_write(ticks_to_secs(get_ticks() - start_time) * 1000000);
+}
+
+void data_block_manager_t::refresh_gc_scores() {
+    microtime_t now = current_microtime();
+    if (now - gc_score_time < GC_SCORE_REFRESH_INTERVAL_MICROS) {
+        return;
+    }
+    gc_score_time = now;
+    gc_pq.rebuild();
 }
 
 void data_block_manager_t::mark_garbage(off64_t offset, extent_transaction_t *txn) {
@@ -509,6 +562,7 @@ void data_block_manager_t::run_gc() {
         run_again = false;
         switch (gc_state.step()) {
             case gc_ready: {
+                refresh_gc_scores();
                 if (gc_pq.empty() || !should_we_keep_gcing(*gc_pq.peak())) {
                     return;
                 }
@@ -516,6 +570,7 @@ void data_block_manager_t::run_gc() {
                 ASSERT_NO_CORO_WAITING;
 
                 ++stats->pm_serializer_data_extents_gced;
+                adjust_gc_io_account();
 
                 /* grab the entry */
                 gc_state.current_entry = gc_pq.pop();
@@ -549,6 +604,7 @@ void data_block_manager_t::run_gc() {
                         // Increment the refcount before read_async, because read_async can call
                         // its callback immediately, causing the decrement of the refcount.
                         gc_state.refcount++;
+                        stats->pm_serializer_gc_bytes_read.record(static_config->block_size().ser_value());
                         dbfile->read_async(gc_state.current_entry->extent_ref.offset() + (i * static_config->block_size().ser_value()),
                                            static_config->block_size().ser_value(),
                                            gc_state.gc_blocks + (i * static_config->block_size().ser_value()),
@@ -839,6 +895,15 @@ void gc_entry::destroy() {
     delete this;
 }
 
+double gc_entry::gc_benefit(microtime_t now) const {
+    const double blocks = g_array.size();
+    const double utilization = (blocks - g_array.count()) / blocks;
+    // Extents that were started after the last refresh of the scores count as
+    // brand new. The +1 keeps extents of the same age ordered by utilization.
+    const double age = now > timestamp ? now - timestamp + 1 : 1;
+    return (1 - utilization) * age / (1 + utilization);
+}
+
 #ifndef NDEBUG
 void gc_entry::print() {
     debugf("gc_entry:\n");
@@ -873,7 +938,9 @@ bool data_block_manager_t::do_we_want_to_start_gcing() const {
 
 /* !< is x less than y */
 bool gc_entry_less::operator() (const gc_entry *x, const gc_entry *y) {
-    return x->g_array.count() < y->g_array.count();
+    rassert(x->parent == y->parent);
+    const microtime_t now = x->parent->gc_score_time;
+    return x->gc_benefit(now) < y->gc_benefit(now);
 }
 
 /****************
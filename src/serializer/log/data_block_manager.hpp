@@ -12,6 +12,7 @@
 #include "perfmon/types.hpp"
 #include "serializer/log/config.hpp"
 #include "serializer/log/extent_manager.hpp"
+#include "serializer/log/gc_rate_controller.hpp"
 #include "serializer/types.hpp"
 
 class log_serializer_t;
@@ -20,6 +21,7 @@ class data_block_manager_t;
 
 class gc_entry;
 
+/* Orders extents by how much GC'ing them is worth; see gc_entry::gc_benefit(). */
 struct gc_entry_less {
     bool operator() (const gc_entry *x, const gc_entry *y);
 };
@@ -70,6 +72,12 @@ public:
     void destroy();
     ~gc_entry();
 
+    /* The LFS cost-benefit score (1-u)*age/(1+u), where u is the fraction of
+    the extent that is still live. Reclaiming an extent frees (1-u) of it for
+    the cost of reading the whole extent and writing back u of it, and the older
+    the data, the less likely it is to become garbage by itself soon. */
+    double gc_benefit(microtime_t now) const;
+
 #ifndef NDEBUG
     void print();
 #endif
@@ -85,6 +93,8 @@ private:
 class data_block_manager_t {
     friend class gc_entry;
     friend class dbm_read_ahead_fsm_t;
+    friend class dbm_foreground_write_timer_t;
+    friend struct gc_entry_less;
 
 private:
     struct gc_write_t {
@@ -187,6 +197,16 @@ private:
 
     file_account_t *choose_gc_io_account();
 
+    /* Feeds the GC rate controller and picks the IO account for the next extent. */
+    void adjust_gc_io_account();
+
+    bool is_gc_io_account(file_account_t *io_account) const;
+
+    void on_foreground_write_complete(ticks_t start_time);
+
+    /* Moves gc_score_time forward and re-sorts gc_pq, if it has been a while. */
+    void refresh_gc_scores();
+
     off64_t gimme_a_new_offset(bool token_referenced);
 
     /* Checks whether the extent is empty and if it is, notifies the extent manager and cleans up */
@@ -238,8 +258,15 @@ private:
     log_serializer_t *const serializer;
 
     file_t *dbfile;
-    scoped_ptr_t<file_account_t> gc_io_account_nice;
-    scoped_ptr_t<file_account_t> gc_io_account_high;
+
+    /* One account per GC priority level, from the nicest to the most aggressive. */
+    enum { num_gc_io_accounts = 3 };
+    scoped_ptr_t<file_account_t> gc_io_accounts[num_gc_io_accounts];
+    gc_rate_controller_t gc_rate_controller;
+
+    /* The time that gc_entry_less computes extents' ages against. It only
+    changes in refresh_gc_scores(), so that the order of gc_pq stays valid. */
+    microtime_t gc_score_time;
 
     /* Contains a pointer to every gc_entry, regardless of what its current state is */
     two_level_array_t<gc_entry *, MAX_DATA_EXTENTS, (1 << 12)> entries;
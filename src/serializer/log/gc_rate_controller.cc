@@ -0,0 +1,32 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#include "serializer/log/gc_rate_controller.hpp"
+
+#include <algorithm>
+
+#include "config/args.hpp"
+
+gc_rate_controller_t::gc_rate_controller_t(int _num_levels, int _urgent_level, double _target_latency_micros)
+    : num_levels(_num_levels), urgent_level(_urgent_level), target_latency_micros(_target_latency_micros),
+      level_(0), latency_ewma_micros(0), writes_since_adjust(0) {
+    rassert(num_levels > 0);
+    rassert(urgent_level >= 0 && urgent_level < num_levels);
+}
+
+void gc_rate_controller_t::record_foreground_write(double latency_micros) {
+    latency_ewma_micros += GC_FOREGROUND_WRITE_LATENCY_EWMA_WEIGHT * (latency_micros - latency_ewma_micros);
+    ++writes_since_adjust;
+}
+
+int gc_rate_controller_t::adjust(bool urgent) {
+    if (writes_since_adjust == 0 || latency_ewma_micros < target_latency_micros / 2) {
+        // Nobody is waiting on the disk, or they aren't noticing GC.
+        ++level_;
+    } else if (latency_ewma_micros > target_latency_micros) {
+        --level_;
+    }
+    writes_since_adjust = 0;
+
+    level_ = std::max(level_, urgent ? urgent_level : 0);
+    level_ = std::min(level_, num_levels - 1);
+    return level_;
+}
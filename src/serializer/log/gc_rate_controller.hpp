@@ -0,0 +1,43 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#ifndef SERIALIZER_LOG_GC_RATE_CONTROLLER_HPP_
+#define SERIALIZER_LOG_GC_RATE_CONTROLLER_HPP_
+
+#include "errors.hpp"
+
+/* The data block manager can run GC through one of several IO accounts, each
+with a higher priority than the last. The accounting disk manager gives each
+account a share of the disk bandwidth that is proportional to its priority, so
+the account GC uses caps how much of the bandwidth GC can take away from
+foreground writes.
+
+`gc_rate_controller_t` decides which account to use. It keeps a moving average
+of how long foreground data block writes take, and once per GC'ed extent it
+moves one level down if that is over the target latency, or one level up if it
+is comfortably under it or if there were no foreground writes at all. When GC
+is urgent (the garbage ratio is running away from us) it doesn't go below
+`urgent_level`, so that the file can't grow indefinitely. */
+class gc_rate_controller_t {
+public:
+    gc_rate_controller_t(int num_levels, int urgent_level, double target_latency_micros);
+
+    void record_foreground_write(double latency_micros);
+
+    /* Called before GC'ing each extent. Returns the new level. */
+    int adjust(bool urgent);
+
+    int level() const { return level_; }
+    double foreground_latency_micros() const { return latency_ewma_micros; }
+
+private:
+    const int num_levels;
+    const int urgent_level;
+    const double target_latency_micros;
+
+    int level_;
+    double latency_ewma_micros;
+    int writes_since_adjust;
+
+    DISABLE_COPYING(gc_rate_controller_t);
+};
+
+#endif /* SERIALIZER_LOG_GC_RATE_CONTROLLER_HPP_ */
@@ -53,15 +53,14 @@ void lba_disk_extent_t::read_step_1(read_info_t *info_out, extent_t::read_callba
     data->read(0, sizeof(lba_extent_t) + sizeof(lba_entry_t) * count, info_out->buffer, cb);
 }
 
-void lba_disk_extent_t::read_step_2(read_info_t *info, in_memory_index_t *index) {
-    em->assert_thread();
+void lba_disk_extent_t::read_step_2(read_info_t *info, in_memory_index_t *shard_index) {
     lba_extent_t *extent = reinterpret_cast<lba_extent_t *>(info->buffer);
     rassert(memcmp(extent->header.magic, lba_magic, LBA_MAGIC_SIZE) == 0);
 
     for (int i = 0; i < info->count; i++) {
         lba_entry_t *e = &extent->entries[i];
         if (!lba_entry_t::is_padding(e)) {
-            index->set_block_info(e->block_id, e->recency, e->offset);
+            shard_index->set_block_info(e->block_id / LBA_SHARD_FACTOR, e->recency, e->offset);
         }
     }
 
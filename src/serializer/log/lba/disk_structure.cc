@@ -1,5 +1,7 @@
 // Copyright 2010-2012 RethinkDB, all rights reserved.
 #include "serializer/log/lba/disk_structure.hpp"
+
+#include "arch/io/blocker_pool.hpp"
 #include "containers/scoped.hpp"
 
 lba_disk_structure_t::lba_disk_structure_t(extent_manager_t *_em, file_t *_file)
@@ -8,7 +10,7 @@ lba_disk_structure_t::lba_disk_structure_t(extent_manager_t *_em, file_t *_file)
 }
 
 lba_disk_structure_t::lba_disk_structure_t(extent_manager_t *_em, file_t *_file, lba_shard_metablock_t *metablock)
-    : em(_em), file(_file)
+    : em(_em), file(_file), start_callback(NULL), startup_superblock_loaded(false)
 {
     if (metablock->last_lba_extent_offset != NULL_OFFSET) {
         last_extent = new lba_disk_extent_t(em, file, metablock->last_lba_extent_offset, metablock->last_lba_extent_entries_count);
@@ -39,7 +41,8 @@ lba_disk_structure_t::lba_disk_structure_t(extent_manager_t *_em, file_t *_file,
 }
 
 void lba_disk_structure_t::set_load_callback(load_callback_t *cb) {
-    if (superblock_extent) {
+    // The superblock read might already have completed, if the file did it synchronously.
+    if (superblock_extent && !startup_superblock_loaded) {
         start_callback = cb;
     } else {
         cb->on_lba_load();
@@ -60,7 +63,8 @@ void lba_disk_structure_t::on_extent_read() {
 
     free(startup_superblock_buffer);
 
-    start_callback->on_lba_load();
+    startup_superblock_loaded = true;
+    if (start_callback) start_callback->on_lba_load();
 }
 
 void lba_disk_structure_t::add_entry(block_id_t block_id, repli_timestamp_t recency, flagged_off64_t offset, file_account_t *io_account, extent_transaction_t *txn) {
@@ -161,11 +165,13 @@ struct reader_t
 {
     lba_disk_structure_t *ds;   // The disk structure we are reading from
     in_memory_index_t *index;   // The in-memory-index we are reading into
+    blocker_pool_t *replay_pool;   // Where we apply extents to `index`
     lba_disk_structure_t::read_callback_t *rcb;   // Who to call back when we finish
 
     /* extent_reader_t takes care of reading a single extent. */
     struct extent_reader_t :
-        public extent_t::read_callback_t
+        public extent_t::read_callback_t,
+        public blocker_pool_t::job_t
     {
         reader_t *parent;   // Our reader_t that we were created by
         int index;   // parent->readers[index] = this
@@ -199,15 +205,17 @@ struct reader_t
         void on_extent_read() {   // Called when our extent has been read from disk
             rassert(!have_read);
             have_read = true;
-            if (prev_done) done();
+            if (prev_done) parent->replay_pool->do_job(this);
         }
         void on_prev_done() {   // Called by the previous extent_reader_t when it finishes
             rassert(!prev_done);
             prev_done = true;
-            if (have_read) done();
+            if (have_read) parent->replay_pool->do_job(this);
         }
-        void done() {
+        void run() {   // Called on a thread of the replay pool
             extent->read_step_2(&read_info, parent->index);
+        }
+        void done() {   // Called back on our thread after run()
             parent->active_readers--;
             parent->start_more_readers();
             if (index == static_cast<int>(parent->readers.size()) - 1) {
@@ -226,8 +234,9 @@ struct reader_t
     // reading process so that we stay under LBA_READ_BUFFER_SIZE.
     int active_readers;
 
-    reader_t(lba_disk_structure_t *_ds, in_memory_index_t *_index, lba_disk_structure_t::read_callback_t *cb)
-        : ds(_ds), index(_index), rcb(cb)
+    reader_t(lba_disk_structure_t *_ds, in_memory_index_t *_index, blocker_pool_t *_replay_pool,
+             lba_disk_structure_t::read_callback_t *cb)
+        : ds(_ds), index(_index), replay_pool(_replay_pool), rcb(cb)
     {
         for (lba_disk_extent_t *e = ds->extents_in_superblock.head(); e; e = ds->extents_in_superblock.next(e)) {
             new extent_reader_t(this, e);
@@ -260,8 +269,8 @@ struct reader_t
     }
 };
 
-void lba_disk_structure_t::read(in_memory_index_t *index, read_callback_t *cb) {
-    new reader_t(this, index, cb);
+void lba_disk_structure_t::read(in_memory_index_t *shard_index, blocker_pool_t *replay_pool, read_callback_t *cb) {
+    new reader_t(this, shard_index, replay_pool, cb);
 }
 
 void lba_disk_structure_t::prepare_metablock(lba_shard_metablock_t *mb_out) {
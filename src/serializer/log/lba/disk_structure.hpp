@@ -7,6 +7,7 @@
 #include "serializer/log/lba/disk_format.hpp"
 #include "serializer/log/lba/disk_extent.hpp"
 
+struct blocker_pool_t;
 class lba_load_fsm_t;
 class lba_writer_t;
 
@@ -39,12 +40,14 @@ public:
     void sync(file_account_t *io_account, sync_callback_t *cb);
 
     // If you call read(), then the in_memory_index_t will be populated and then the read_callback_t
-    // will be called when it is done.
+    // will be called when it is done. The index only gets this shard's blocks, indexed by
+    // `block_id / LBA_SHARD_FACTOR`. The extents are applied to it in order, but on the threads
+    // of `replay_pool`, so that the shards can be applied in parallel while we keep reading.
     struct read_callback_t {
         virtual void on_lba_read() = 0;
         virtual ~read_callback_t() {}
     };
-    void read(in_memory_index_t *index, read_callback_t *cb);
+    void read(in_memory_index_t *shard_index, blocker_pool_t *replay_pool, read_callback_t *cb);
 
     void prepare_metablock(lba_shard_metablock_t *mb_out);
 
@@ -65,6 +68,7 @@ private:
     /* Used during the startup process */
     void on_extent_read();
     load_callback_t *start_callback;
+    bool startup_superblock_loaded;
     int startup_superblock_count;
     lba_superblock_t *startup_superblock_buffer;
 
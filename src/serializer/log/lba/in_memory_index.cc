@@ -36,6 +36,22 @@ void in_memory_index_t::set_block_info(block_id_t id, repli_timestamp_t recency,
     timestamps[id] = recency;
 }
 
+void in_memory_index_t::set_end_block_id(block_id_t end) {
+    if (end > blocks.get_size()) {
+        blocks.set_size(end, flagged_off64_t::unused());
+        timestamps.set_size(end, repli_timestamp_t::invalid);
+    }
+}
+
+void in_memory_index_t::copy_from_shard(int shard, in_memory_index_t *shard_index) {
+    block_id_t shard_end = shard_index->end_block_id();
+    rassert(shard_end == 0 || (shard_end - 1) * LBA_SHARD_FACTOR + shard < blocks.get_size());
+    for (block_id_t i = 0; i < shard_end; i++) {
+        blocks[i * LBA_SHARD_FACTOR + shard] = shard_index->blocks[i];
+        timestamps[i * LBA_SHARD_FACTOR + shard] = shard_index->timestamps[i];
+    }
+}
+
 #ifndef NDEBUG
 void in_memory_index_t::print() {
     printf("LBA:\n");
@@ -31,6 +31,17 @@ public:
     void set_block_info(block_id_t id, repli_timestamp_t recency,
                         flagged_off64_t offset);
 
+    // Grows the index so that `end_block_id()` is at least `end`. After that,
+    // `set_block_info()` and `copy_from_shard()` never have to grow the index for IDs
+    // below `end`, so different threads can fill in different IDs at the same time.
+    void set_end_block_id(block_id_t end);
+
+    // Copies everything from `shard_index`, which holds the blocks of LBA shard
+    // `shard` indexed by `block_id / LBA_SHARD_FACTOR` (see
+    // `lba_disk_extent_t::read_step_2()`), into the IDs that belong to that shard.
+    // The index must already be big enough.
+    void copy_from_shard(int shard, in_memory_index_t *shard_index);
+
     bool is_offset_indexed(off64_t offset);
     block_id_t get_block_id(off64_t offset);
 
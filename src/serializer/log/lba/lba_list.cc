@@ -4,6 +4,8 @@
 #include "utils.hpp"
 #include "serializer/log/lba/disk_format.hpp"
 #include "arch/arch.hpp"
+#include "arch/io/blocker_pool.hpp"
+#include "containers/scoped.hpp"
 #include "perfmon/perfmon.hpp"
 #include "serializer/log/stats.hpp"
 
@@ -26,9 +28,17 @@ void lba_list_t::prepare_initial_metablock(metablock_mixin_t *mb) {
     }
 }
 
+/* Starting up goes like this:
+ 1. Load each shard's superblock.
+ 2. Read each shard's extents, applying them to a separate index per shard on the
+    threads of `replay_pool` as they come in. Shards hold disjoint sets of block
+    IDs, so they don't have to wait for each other.
+ 3. Size the real index to fit every shard, and then copy the shards into it, again
+    in parallel. */
 class lba_start_fsm_t :
     private lba_disk_structure_t::load_callback_t,
-    private lba_disk_structure_t::read_callback_t
+    private lba_disk_structure_t::read_callback_t,
+    private thread_message_t
 {
 public:
     int cbs_out;
@@ -41,6 +51,8 @@ public:
         rassert(owner->state == lba_list_t::state_unstarted);
         owner->state = lba_list_t::state_starting_up;
 
+        replay_pool.init(new blocker_pool_t(LBA_REPLAY_THREAD_COUNT, &linux_thread_pool_t::thread->queue));
+
         cbs_out = LBA_SHARD_FACTOR;
         for (int i = 0; i < LBA_SHARD_FACTOR; i++) {
             owner->disk_structures[i] = new lba_disk_structure_t(
@@ -56,7 +68,7 @@ public:
         if (cbs_out == 0) {
             cbs_out = LBA_SHARD_FACTOR;
             for (int i = 0; i < LBA_SHARD_FACTOR; i++) {
-                owner->disk_structures[i]->read(&owner->in_memory_index, this);
+                owner->disk_structures[i]->read(&shard_indexes[i], replay_pool.get(), this);
             }
         }
     }
@@ -65,11 +77,57 @@ public:
         rassert(cbs_out > 0);
         cbs_out--;
         if (cbs_out == 0) {
-            owner->state = lba_list_t::state_ready;
-            if (callback) callback->on_lba_ready();
-            delete this;
+            block_id_t end_block_id = 0;
+            for (int i = 0; i < LBA_SHARD_FACTOR; i++) {
+                block_id_t shard_end = shard_indexes[i].end_block_id();
+                if (shard_end > 0) {
+                    end_block_id = std::max<block_id_t>(end_block_id, (shard_end - 1) * LBA_SHARD_FACTOR + i + 1);
+                }
+            }
+
+            owner->in_memory_index.set_end_block_id(end_block_id);
+            cbs_out = LBA_SHARD_FACTOR;
+            for (int i = 0; i < LBA_SHARD_FACTOR; i++) {
+                copy_jobs[i].parent = this;
+                copy_jobs[i].shard = i;
+                replay_pool->do_job(&copy_jobs[i]);
+            }
         }
     }
+
+private:
+    struct copy_job_t : public blocker_pool_t::job_t {
+        lba_start_fsm_t *parent;
+        int shard;
+
+        void run() {
+            parent->owner->in_memory_index.copy_from_shard(shard, &parent->shard_indexes[shard]);
+        }
+        void done() {
+            parent->on_shard_copied();
+        }
+    };
+
+    void on_shard_copied() {
+        rassert(cbs_out > 0);
+        cbs_out--;
+        if (cbs_out == 0) {
+            // We're inside of a callback from `replay_pool`, so we can't destroy it
+            // until we get back to the event loop.
+            call_later_on_this_thread(this);
+        }
+    }
+
+    void on_thread_switch() {
+        replay_pool.reset();
+        owner->state = lba_list_t::state_ready;
+        if (callback) callback->on_lba_ready();
+        delete this;
+    }
+
+    scoped_ptr_t<blocker_pool_t> replay_pool;
+    in_memory_index_t shard_indexes[LBA_SHARD_FACTOR];
+    copy_job_t copy_jobs[LBA_SHARD_FACTOR];
 };
 
 bool lba_list_t::start_existing(file_t *file, metablock_mixin_t *last_metablock, ready_callback_t *cb) {
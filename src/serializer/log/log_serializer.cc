@@ -81,6 +81,10 @@ log_serializer_stats_t::log_serializer_stats_t(perfmon_collection_t *parent)
       pm_serializer_data_blocks_written(),
       pm_serializer_old_garbage_blocks(),
       pm_serializer_old_total_blocks(),
+      pm_serializer_gc_bytes_read(secs_to_ticks(1)),
+      pm_serializer_gc_bytes_written(secs_to_ticks(1)),
+      pm_serializer_write_amplification(),
+      pm_serializer_gc_io_priority(),
       pm_serializer_lba_gcs(),
       parent_collection_membership(parent, &serializer_collection, "serializer"),
       stats_membership(&serializer_collection,
@@ -99,10 +103,40 @@ log_serializer_stats_t::log_serializer_stats_t(perfmon_collection_t *parent)
           &pm_serializer_data_blocks_written, "serializer_data_blocks_written",
           &pm_serializer_old_garbage_blocks, "serializer_old_garbage_blocks",
           &pm_serializer_old_total_blocks, "serializer_old_total_blocks",
+          &pm_serializer_gc_bytes_read, "serializer_gc_bytes_read_per_sec",
+          &pm_serializer_gc_bytes_written, "serializer_gc_bytes_written_per_sec",
+          &pm_serializer_write_amplification, "serializer_write_amplification",
+          &pm_serializer_gc_io_priority, "serializer_gc_io_priority",
           &pm_serializer_lba_gcs, "serializer_lba_gcs",
           NULLPTR)
 { }
 
+perfmon_write_amplification_t::perfmon_write_amplification_t() {
+    for (int i = 0; i < MAX_THREADS; ++i) {
+        thread_data[i].value = counts_t(0, 0);
+    }
+}
+
+void perfmon_write_amplification_t::get_thread_stat(counts_t *stat) {
+    *stat = thread_data[get_thread_id()].value;
+}
+
+perfmon_write_amplification_t::counts_t perfmon_write_amplification_t::combine_stats(counts_t *stats) {
+    counts_t total(0, 0);
+    for (int i = 0; i < get_num_threads(); ++i) {
+        total.first += stats[i].first;
+        total.second += stats[i].second;
+    }
+    return total;
+}
+
+perfmon_result_t *perfmon_write_amplification_t::output_stat(const counts_t &stat) {
+    if (stat.first == 0) {
+        return new perfmon_result_t("1.000");
+    }
+    return new perfmon_result_t(strprintf("%.3f", static_cast<double>(stat.first + stat.second) / stat.first));
+}
+
 void log_serializer_t::create(serializer_file_opener_t *file_opener, static_config_t static_config) {
     log_serializer_on_disk_static_config_t *on_disk_config = &static_config;
 
@@ -393,6 +427,7 @@ void log_serializer_t::block_read(const intrusive_ptr_t<ls_block_token_pointee_t
         void on_io_complete() { pulse(); }
     } cb;
     block_read(token, buf, io_account, &cb);
+    coro_wait_reason_tag_t wait_reason(coro_wait_reason_disk);
     cb.wait();
 }
 
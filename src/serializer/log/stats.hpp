@@ -2,8 +2,27 @@
 #ifndef SERIALIZER_LOG_STATS_HPP_
 #define SERIALIZER_LOG_STATS_HPP_
 
+#include <utility>
+
 #include "perfmon/perfmon.hpp"
 
+/* Reports how many data blocks were written for each block that the serializer's
+users wrote, i.e. (user writes + GC writes) / user writes, since startup. */
+class perfmon_write_amplification_t : public perfmon_perthread_t<std::pair<int64_t, int64_t> > {
+public:
+    perfmon_write_amplification_t();
+    void record_user_write() { ++thread_data[get_thread_id()].value.first; }
+    void record_gc_write() { ++thread_data[get_thread_id()].value.second; }
+
+private:
+    typedef std::pair<int64_t, int64_t> counts_t;
+    void get_thread_stat(counts_t *);
+    counts_t combine_stats(counts_t *);
+    perfmon_result_t *output_stat(const counts_t &);
+
+    cache_line_padded_t<counts_t> thread_data[MAX_THREADS];
+};
+
 struct log_serializer_stats_t {
     perfmon_collection_t serializer_collection;
     explicit log_serializer_stats_t(perfmon_collection_t *perfmon_collection);
@@ -29,6 +48,10 @@ struct log_serializer_stats_t {
     perfmon_counter_t pm_serializer_data_blocks_written;
     perfmon_counter_t pm_serializer_old_garbage_blocks;
     perfmon_counter_t pm_serializer_old_total_blocks;
+    perfmon_rate_monitor_t pm_serializer_gc_bytes_read;
+    perfmon_rate_monitor_t pm_serializer_gc_bytes_written;
+    perfmon_write_amplification_t pm_serializer_write_amplification;
+    perfmon_counter_t pm_serializer_gc_io_priority;
 
     /* used in serializer/log/lba/lba_list.cc */
     perfmon_counter_t pm_serializer_lba_gcs;
@@ -0,0 +1,119 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#include "rdb_protocol/binary_json.hpp"
+
+#include "rdb_protocol/rdb_protocol_json.hpp"
+#include "unittest/gtest.hpp"
+
+namespace unittest {
+
+const char *documents[] = {
+    "null",
+    "true",
+    "false",
+    "3.25",
+    "\"a string\"",
+    "[]",
+    "{}",
+    "[1, \"two\", [3, [4]], {\"five\": 5}, null]",
+    "{\"id\": 7, \"name\": \"bob\", \"tags\": [\"a\", \"b\"], \"address\": {\"city\": \"Paris\", \"zip\": null}}"
+};
+
+std::string encode(const char *text) {
+    scoped_cJSON_t json(cJSON_Parse(text));
+    EXPECT_TRUE(json.get() != NULL);
+    std::string encoded;
+    binary_json_encode(json.get(), &encoded);
+    return encoded;
+}
+
+TEST(BinaryJsonTest, RoundTrip) {
+    for (size_t i = 0; i < sizeof(documents) / sizeof(documents[0]); ++i) {
+        scoped_cJSON_t json(cJSON_Parse(documents[i]));
+        std::string encoded = encode(documents[i]);
+
+        binary_json_source_t source(encoded.data(), encoded.size());
+        ASSERT_TRUE(source.is_binary_json());
+        binary_json_t root = binary_json_t::root(&source);
+        EXPECT_EQ(json.type(), root.type());
+
+        scoped_cJSON_t decoded(root.to_cjson());
+        EXPECT_EQ(json.PrintUnformatted(), decoded.PrintUnformatted());
+        EXPECT_EQ(0, root.compare(json.get()));
+    }
+}
+
+TEST(BinaryJsonTest, GetField) {
+    std::string encoded = encode("{\"b\": 1, \"Name\": \"first\", \"a\": 2, \"name\": \"second\"}");
+    binary_json_source_t source(encoded.data(), encoded.size());
+    binary_json_t root = binary_json_t::root(&source);
+    EXPECT_EQ(4u, root.size());
+
+    // Keys match case insensitively, and the first match wins, just like
+    // `cJSON_GetObjectItem()`.
+    binary_json_t field;
+    std::string key;
+    ASSERT_TRUE(root.get_field("NAME", &field, &key));
+    EXPECT_EQ("first", field.str());
+    EXPECT_EQ("Name", key);
+
+    ASSERT_TRUE(root.get_field("a", &field));
+    EXPECT_EQ(cJSON_Number, field.type());
+    EXPECT_EQ(2, field.number());
+
+    EXPECT_FALSE(root.get_field("c", &field));
+    EXPECT_FALSE(root.get_field("", &field));
+}
+
+TEST(BinaryJsonTest, SplitBuffers) {
+    std::string encoded = encode(documents[sizeof(documents) / sizeof(documents[0]) - 1]);
+
+    // Spread the document over buffers of a few bytes each, so that most
+    // values straddle a buffer boundary.
+    const_buffer_group_t group;
+    for (size_t i = 0; i < encoded.size(); i += 3) {
+        group.add_buffer(std::min<size_t>(3, encoded.size() - i), encoded.data() + i);
+    }
+    binary_json_source_t source(&group);
+    binary_json_t root = binary_json_t::root(&source);
+
+    binary_json_t address, city;
+    ASSERT_TRUE(root.get_field("address", &address));
+    ASSERT_TRUE(address.get_field("city", &city));
+    EXPECT_EQ("Paris", city.str());
+
+    binary_json_t tags;
+    ASSERT_TRUE(root.get_field("tags", &tags));
+    ASSERT_EQ(2u, tags.size());
+    EXPECT_EQ("b", tags.array_item(1).str());
+
+    scoped_cJSON_t decoded(root.to_cjson());
+    scoped_cJSON_t original(cJSON_Parse(documents[sizeof(documents) / sizeof(documents[0]) - 1]));
+    EXPECT_EQ(original.PrintUnformatted(), decoded.PrintUnformatted());
+}
+
+int sign(int x) {
+    return (0 < x) - (x < 0);
+}
+
+TEST(BinaryJsonTest, Compare) {
+    const char *values[] = {
+        "null", "false", "true", "-1", "0", "2.5", "\"\"", "\"abc\"", "\"abd\"",
+        "[]", "[1]", "[1, 2]", "[2]", "{}", "{\"a\": 1}", "{\"a\": 2}", "{\"b\": 1}"
+    };
+    const size_t num_values = sizeof(values) / sizeof(values[0]);
+
+    for (size_t i = 0; i < num_values; ++i) {
+        std::string encoded = encode(values[i]);
+        binary_json_source_t source(encoded.data(), encoded.size());
+        binary_json_t lhs = binary_json_t::root(&source);
+        scoped_cJSON_t lhs_json(cJSON_Parse(values[i]));
+
+        for (size_t j = 0; j < num_values; ++j) {
+            scoped_cJSON_t rhs(cJSON_Parse(values[j]));
+            EXPECT_EQ(sign(query_language::json_cmp(lhs_json.get(), rhs.get())), sign(lhs.compare(rhs.get())))
+                << values[i] << " vs " << values[j];
+        }
+    }
+}
+
+}  // namespace unittest
@@ -70,9 +70,20 @@ public:
         }
     }
 
+    void check_inline_value() {
+        const char *data;
+        int64_t size;
+        if (blob::inline_value(buf_.data(), buf_.size(), &data, &size)) {
+            ASSERT_EQ(expected_, std::string(data, size));
+        } else {
+            ASSERT_LT(buf_.size() - 1, expected_.size());
+        }
+    }
+
     void check(transaction_t *txn) {
         check_region(txn, 0, expected_.size());
         check_normalization(txn);
+        check_inline_value();
     }
 
     void append(transaction_t *txn, const std::string& x) {
@@ -1,7 +1,9 @@
 // Copyright 2010-2012 RethinkDB, all rights reserved.
 #include "unittest/gtest.hpp"
+#include "arch/timing.hpp"
 #include "clustering/immediate_consistency/branch/backfiller.hpp"
 #include "clustering/immediate_consistency/branch/backfillee.hpp"
+#include "concurrency/wait_any.hpp"
 #include "containers/uuid.hpp"
 #include "rpc/semilattice/view/field.hpp"
 #include "mock/branch_history_manager.hpp"
@@ -164,4 +166,117 @@ TEST(ClusteringBackfill, BackfillTest) {
     mock::run_in_thread_pool(&run_backfill_test);
 }
 
+/* Stands in for the backfillee: records each batch of chunks, and gives the
+credit for it back a little later, once it would have applied them. */
+class credit_returning_receiver_t {
+public:
+    credit_returning_receiver_t(mailbox_manager_t *mailbox_manager, semaphore_t *_credit)
+        : credit(_credit),
+          chunk_mailbox(mailbox_manager, boost::bind(&credit_returning_receiver_t::on_chunks, this, _1, _2, auto_drainer_t::lock_t(&drainer))) { }
+
+    mailbox_addr_t<void(std::vector<dummy_protocol_t::backfill_chunk_t>, fifo_enforcer_write_token_t)> get_address() {
+        return chunk_mailbox.get_address();
+    }
+
+    std::vector<size_t> batch_sizes;
+    std::vector<std::string> keys;
+
+private:
+    void on_chunks(const std::vector<dummy_protocol_t::backfill_chunk_t> &chunks, fifo_enforcer_write_token_t, auto_drainer_t::lock_t keepalive) {
+        batch_sizes.push_back(chunks.size());
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            keys.push_back(chunks[i].key);
+        }
+        try {
+            nap(1, keepalive.get_drain_signal());
+        } catch (const interrupted_exc_t &) {
+            return;
+        }
+        credit->unlock(chunks.size());
+    }
+
+    semaphore_t *credit;
+    auto_drainer_t drainer;
+    mailbox_t<void(std::vector<dummy_protocol_t::backfill_chunk_t>, fifo_enforcer_write_token_t)> chunk_mailbox;
+};
+
+/* One of the coroutines that a parallel traversal sends its chunks from. */
+void send_chunks_concurrently(backfiller_send_backfill_callback_t<dummy_protocol_t> *callback, int sender, int num_chunks,
+                              signal_t *interruptor, int *senders_left, cond_t *senders_done) {
+    try {
+        for (int i = 0; i < num_chunks; ++i) {
+            dummy_protocol_t::backfill_chunk_t chunk;
+            chunk.key = strprintf("%d-%d", sender, i);
+            callback->send_chunk(chunk, interruptor);
+            if (i % 7 == sender) {
+                coro_t::yield();
+            }
+        }
+    } catch (const interrupted_exc_t &) {
+        // The test timed out.
+    }
+    if (--*senders_left == 0) {
+        senders_done->pulse();
+    }
+}
+
+/* `CreditRunsOutMidBatch` sends chunks from several coroutines at once with
+less credit than fits in two messages, so the credit runs out while part of a
+message is still waiting to go out. The backfillee only gives credit back for
+chunks it has received, so the backfiller has to send that part before waiting
+for more. */
+void run_credit_runs_out_mid_batch_test() {
+    static const int num_senders = 4;
+    static const int chunks_per_sender = 500;
+    static const int credit_size = MAX_CHUNKS_PER_MESSAGE * 3 / 2;
+
+    mock::simple_mailbox_cluster_t cluster;
+    semaphore_t credit(credit_size);
+    credit_returning_receiver_t receiver(cluster.get_mailbox_manager(), &credit);
+    fifo_enforcer_source_t fifo_src;
+    backfiller_send_backfill_callback_t<dummy_protocol_t> callback(
+        NULL, mailbox_addr_t<void(region_map_t<dummy_protocol_t, version_range_t>, branch_history_t<dummy_protocol_t>)>(),
+        cluster.get_mailbox_manager(), receiver.get_address(), &fifo_src, &credit, NULL);
+
+    cond_t interruptor;
+    int senders_left = num_senders;
+    cond_t senders_done;
+    for (int sender = 0; sender < num_senders; ++sender) {
+        coro_t::spawn_sometime(boost::bind(&send_chunks_concurrently, &callback, sender, chunks_per_sender,
+                                           &interruptor, &senders_left, &senders_done));
+    }
+
+    {
+        signal_timer_t timeout(10000);
+        wait_any_t waiter(&senders_done, &timeout);
+        waiter.wait_lazily_unordered();
+    }
+    if (!senders_done.is_pulsed()) {
+        ADD_FAILURE() << "the senders ran out of credit and never got any back";
+        interruptor.pulse();
+        senders_done.wait_lazily_unordered();
+        return;
+    }
+    callback.send_pending_chunks();
+
+    const size_t num_chunks = num_senders * chunks_per_sender;
+    for (int i = 0; i < 10000 && receiver.keys.size() < num_chunks; ++i) {
+        nap(1);
+    }
+    ASSERT_EQ(num_chunks, receiver.keys.size());
+    EXPECT_EQ(num_chunks, std::set<std::string>(receiver.keys.begin(), receiver.keys.end()).size());
+
+    bool flushed_early = false;
+    for (size_t i = 0; i < receiver.batch_sizes.size(); ++i) {
+        EXPECT_GE(static_cast<size_t>(MAX_CHUNKS_PER_MESSAGE), receiver.batch_sizes[i]);
+        if (i + 1 < receiver.batch_sizes.size() && receiver.batch_sizes[i] < MAX_CHUNKS_PER_MESSAGE) {
+            flushed_early = true;
+        }
+    }
+    EXPECT_TRUE(flushed_early);
+}
+TEST(ClusteringBackfill, CreditRunsOutMidBatch) {
+    mock::run_in_thread_pool(&run_credit_runs_out_mid_batch_test);
+}
+
 }   /* namespace unittest */
@@ -1,6 +1,8 @@
 // Copyright 2010-2012 RethinkDB, all rights reserved.
 #include "unittest/gtest.hpp"
 
+#include <boost/ptr_container/ptr_vector.hpp>
+
 #include "clustering/immediate_consistency/branch/broadcaster.hpp"
 #include "clustering/immediate_consistency/branch/listener.hpp"
 #include "clustering/immediate_consistency/branch/replier.hpp"
@@ -158,6 +160,60 @@ TEST(ClusteringBranch, ReadWrite) {
     run_in_thread_pool_with_broadcaster(&run_read_write_test);
 }
 
+/* The `BatchedWrites` test sends a burst of writes to the same key without
+waiting for any of them, so they reach the mirror in batches. Each write should
+still get its own response, and see the value the write before it left. */
+
+class recording_write_callback_t : public broadcaster_t<dummy_protocol_t>::write_callback_t, public cond_t {
+public:
+    recording_write_callback_t() : num_responses(0) { }
+    void on_response(peer_id_t, const dummy_protocol_t::write_response_t &response) {
+        ++num_responses;
+        old_values = response.old_values;
+    }
+    void on_done() {
+        pulse();
+    }
+    int num_responses;
+    std::map<std::string, std::string> old_values;
+};
+
+void run_batched_writes_test(UNUSED io_backender_t *io_backender,
+                             mock::simple_mailbox_cluster_t *cluster,
+                             branch_history_manager_t<dummy_protocol_t> *branch_history_manager,
+                             UNUSED clone_ptr_t<watchable_t<boost::optional<broadcaster_business_card_t<dummy_protocol_t> > > > broadcaster_metadata_view,
+                             scoped_ptr_t<broadcaster_t<dummy_protocol_t> > *broadcaster,
+                             mock::test_store_t<dummy_protocol_t> *store,
+                             scoped_ptr_t<listener_t<dummy_protocol_t> > *initial_listener,
+                             order_source_t *order_source) {
+    replier_t<dummy_protocol_t> replier(initial_listener->get(), cluster->get_mailbox_manager(), branch_history_manager);
+    mock::let_stuff_happen();
+
+    const int num_writes = 200;
+    boost::ptr_vector<recording_write_callback_t> callbacks;
+    for (int i = 0; i < num_writes; i++) {
+        mock::fake_fifo_enforcement_t enforce;
+        fifo_enforcer_sink_t::exit_write_t exiter(&enforce.sink, enforce.source.enter_write());
+
+        dummy_protocol_t::write_t w;
+        w.values["k"] = strprintf("%d", i);
+        callbacks.push_back(new recording_write_callback_t);
+        cond_t non_interruptor;
+        (*broadcaster)->spawn_write(w, &exiter, order_source->check_in("unittest::run_batched_writes_test(write)"), &callbacks.back(), &non_interruptor);
+    }
+
+    for (int i = 0; i < num_writes; i++) {
+        callbacks[i].wait_lazily_unordered();
+        EXPECT_EQ(1, callbacks[i].num_responses);
+        EXPECT_EQ(i == 0 ? std::string() : strprintf("%d", i - 1), callbacks[i].old_values["k"]);
+    }
+    EXPECT_EQ(strprintf("%d", num_writes - 1), store->store.values["k"]);
+}
+
+TEST(ClusteringBranch, BatchedWrites) {
+    run_in_thread_pool_with_broadcaster(&run_batched_writes_test);
+}
+
 /* The `Backfill` test starts up a node with one mirror, inserts some data, and
 then adds another mirror. */
 
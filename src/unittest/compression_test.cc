@@ -0,0 +1,77 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#include "unittest/gtest.hpp"
+
+#include <string>
+#include <vector>
+
+#include "rpc/connectivity/compression.hpp"
+#include "utils.hpp"
+
+namespace unittest {
+
+std::string compress(const std::string &input) {
+    std::vector<char> output(lz_compress_bound(input.size()));
+    size_t size = lz_compress(input.data(), input.size(), output.data(), output.size());
+    EXPECT_NE(0u, size);
+    return std::string(output.data(), size);
+}
+
+void check_round_trip(const std::string &input) {
+    std::string compressed = compress(input);
+    std::vector<char> output(input.size() + 1);
+    ASSERT_TRUE(lz_decompress(compressed.data(), compressed.size(), output.data(), input.size()));
+    EXPECT_EQ(input, std::string(output.data(), input.size()));
+
+    // The size has to match exactly.
+    EXPECT_FALSE(lz_decompress(compressed.data(), compressed.size(), output.data(), input.size() + 1));
+    if (!input.empty()) {
+        EXPECT_FALSE(lz_decompress(compressed.data(), compressed.size(), output.data(), input.size() - 1));
+    }
+}
+
+TEST(CompressionTest, RoundTrip) {
+    check_round_trip("");
+    check_round_trip("a");
+    check_round_trip("abcabcabcabcabcabcabcabcabcabcabcabc");
+    check_round_trip(std::string(100000, '\0'));
+
+    std::string text;
+    for (int i = 0; i < 2000; ++i) {
+        text += strprintf("{\"id\": %d, \"name\": \"row %d\"}", i, i * 7);
+    }
+    check_round_trip(text);
+
+    std::string noise;
+    for (int i = 0; i < 70000; ++i) {
+        noise += static_cast<char>(randint(256));
+    }
+    check_round_trip(noise);
+}
+
+TEST(CompressionTest, Ratio) {
+    std::string zeroes(4096, '\0');
+    EXPECT_LT(compress(zeroes).size(), 64u);
+
+    // Output that doesn't fit is refused rather than truncated.
+    std::vector<char> output(10);
+    EXPECT_EQ(0u, lz_compress(zeroes.data(), zeroes.size(), output.data(), output.size()));
+}
+
+TEST(CompressionTest, CorruptInput) {
+    std::string input;
+    for (int i = 0; i < 1000; ++i) {
+        input += strprintf("%d,", i % 37);
+    }
+    const std::string compressed = compress(input);
+
+    // Flipped bits or truncated data must never read or write out of bounds.
+    std::vector<char> output(input.size());
+    for (int i = 0; i < 1000; ++i) {
+        std::string corrupt = compressed;
+        corrupt[randint(corrupt.size())] ^= 1 << randint(8);
+        UNUSED bool res = lz_decompress(corrupt.data(), corrupt.size(), output.data(), output.size());
+        res = lz_decompress(compressed.data(), randint(compressed.size()), output.data(), output.size());
+    }
+}
+
+}  // namespace unittest
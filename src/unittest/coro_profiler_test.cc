@@ -0,0 +1,76 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#include "arch/runtime/coro_profiler.hpp"
+
+#include "errors.hpp"
+#include <boost/bind.hpp>
+
+#include "arch/runtime/coroutines.hpp"
+#include "concurrency/cond_var.hpp"
+#include "concurrency/mutex.hpp"
+#include "mock/unittest_utils.hpp"
+#include "unittest/gtest.hpp"
+
+namespace unittest {
+
+TEST(CoroProfilerTest, TypeName) {
+    EXPECT_EQ("foo_t", coro_type_name("static coro_t* coro_t::get_and_init_coro(const Callable&) [with Callable = foo_t]"));
+    EXPECT_EQ("bar_t<int>", coro_type_name("static coro_t* coro_t::get_and_init_coro(const Callable&) [with Callable = bar_t<int>; T = int]"));
+    EXPECT_EQ("no type here", coro_type_name("no type here"));
+}
+
+void hold_mutex(mutex_t *mutex, cond_t *locked, cond_t *release, cond_t *done) {
+    mutex_t::acq_t acq(mutex);
+    locked->pulse();
+    release->wait();
+    acq.reset();
+    done->pulse();
+}
+
+void contend_for_mutex(mutex_t *mutex, cond_t *done) {
+    mutex_t::acq_t acq(mutex);
+    done->pulse();
+}
+
+void run_mutex_wait_test() {
+    set_coro_profiler_enabled(true);
+    reset_coro_profiler();
+
+    mutex_t mutex;
+    cond_t locked, release, holder_done, contender_done;
+    coro_t::spawn_sometime(boost::bind(&hold_mutex, &mutex, &locked, &release, &holder_done));
+    locked.wait();
+    coro_t::spawn_sometime(boost::bind(&contend_for_mutex, &mutex, &contender_done));
+    // The contender runs before we do again, and blocks on the mutex.
+    coro_t::yield();
+    ASSERT_FALSE(contender_done.is_pulsed());
+    release.pulse();
+    holder_done.wait();
+    contender_done.wait();
+
+    coro_thread_profile_t profile;
+    get_coro_thread_profile(&profile);
+    set_coro_profiler_enabled(false);
+
+    // The contender was blocked on the mutex, and the holder on `release`,
+    // and each of them was resumed afterwards, as were we.
+    EXPECT_GT(profile.total.blocked_by_reason[coro_wait_reason_mutex], 0u);
+    EXPECT_GT(profile.total.blocked_by_reason[coro_wait_reason_other], 0u);
+    EXPECT_GE(profile.total.blocked, profile.total.blocked_by_reason[coro_wait_reason_mutex]
+                                     + profile.total.blocked_by_reason[coro_wait_reason_other]);
+    EXPECT_GE(profile.total.resumes, 3);
+    EXPECT_FALSE(profile.by_type.empty());
+
+    // Nothing is recorded while the profiler is off, and resetting throws away
+    // what was recorded.
+    reset_coro_profiler();
+    coro_t::yield();
+    get_coro_thread_profile(&profile);
+    EXPECT_EQ(0, profile.total.resumes);
+    EXPECT_EQ(0u, profile.total.blocked);
+}
+
+TEST(CoroProfilerTest, MutexWait) {
+    mock::run_in_thread_pool(&run_mutex_wait_test);
+}
+
+}  // namespace unittest
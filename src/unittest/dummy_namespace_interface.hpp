@@ -29,6 +29,9 @@ public:
               DEBUG_VAR state_timestamp_t expected_timestamp,
               order_token_t order_token,
               signal_t *interruptor) THROWS_ONLY(interrupted_exc_t) {
+        // `listener_t::read()` makes the same assertion.
+        rassert(!region_is_empty(read.get_region()));
+
         object_buffer_t<fifo_enforcer_sink_t::exit_read_t> read_token;
         store->new_read_token(&read_token);
 
@@ -43,6 +46,8 @@ public:
     void read_outdated(const typename protocol_t::read_t &read,
                        typename protocol_t::read_response_t *response,
                        signal_t *interruptor) THROWS_ONLY(interrupted_exc_t) {
+        rassert(!region_is_empty(read.get_region()));
+
         object_buffer_t<fifo_enforcer_sink_t::exit_read_t> read_token;
         store->new_read_token(&read_token);
 
@@ -144,6 +149,10 @@ public:
             typename protocol_t::region_t ixn = region_intersection(shards[i].region, read.get_region());
             if (!region_is_empty(ixn)) {
                 typename protocol_t::read_t subread = read.shard(ixn);
+                if (region_is_empty(subread.get_region())) {
+                    // The shard is inside the read's region but has none of its keys.
+                    continue;
+                }
                 typename protocol_t::read_response_t subresponse;
                 shards[i].timestamper->read(subread, &subresponse, tok, interruptor);
                 responses.push_back(subresponse);
@@ -161,6 +170,9 @@ public:
             typename protocol_t::region_t ixn = region_intersection(shards[i].region, read.get_region());
             if (!region_is_empty(ixn)) {
                 typename protocol_t::read_t subread = read.shard(ixn);
+                if (region_is_empty(subread.get_region())) {
+                    continue;
+                }
                 typename protocol_t::read_response_t subresponse;
                 shards[i].performer->read_outdated(subread, &subresponse, interruptor);
                 responses.push_back(subresponse);
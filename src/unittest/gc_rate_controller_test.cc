@@ -0,0 +1,55 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#include "serializer/log/gc_rate_controller.hpp"
+
+#include "unittest/gtest.hpp"
+
+namespace unittest {
+
+TEST(GcRateControllerTest, SpeedsUpWhenIdle) {
+    gc_rate_controller_t controller(3, 1, 10000);
+    EXPECT_EQ(0, controller.level());
+    EXPECT_EQ(1, controller.adjust(false));
+    EXPECT_EQ(2, controller.adjust(false));
+    EXPECT_EQ(2, controller.adjust(false));
+}
+
+TEST(GcRateControllerTest, BacksOffWhenForegroundIsSlow) {
+    gc_rate_controller_t controller(3, 1, 10000);
+    controller.adjust(false);
+    controller.adjust(false);
+    ASSERT_EQ(2, controller.level());
+
+    for (int i = 0; i < 200; ++i) {
+        controller.record_foreground_write(50000);
+    }
+    EXPECT_GT(controller.foreground_latency_micros(), 10000);
+    EXPECT_EQ(1, controller.adjust(false));
+    controller.record_foreground_write(50000);
+    EXPECT_EQ(0, controller.adjust(false));
+
+    // Urgent GC doesn't go below the urgent level, however slow writes are.
+    controller.record_foreground_write(50000);
+    EXPECT_EQ(1, controller.adjust(true));
+    controller.record_foreground_write(50000);
+    EXPECT_EQ(1, controller.adjust(true));
+}
+
+TEST(GcRateControllerTest, HoldsNearTarget) {
+    gc_rate_controller_t controller(3, 1, 10000);
+    controller.adjust(false);
+    ASSERT_EQ(1, controller.level());
+
+    // Between half the target and the target, the level stays put.
+    for (int i = 0; i < 200; ++i) {
+        controller.record_foreground_write(7500);
+    }
+    EXPECT_EQ(1, controller.adjust(false));
+
+    // Fast writes let GC speed up again.
+    for (int i = 0; i < 200; ++i) {
+        controller.record_foreground_write(100);
+    }
+    EXPECT_EQ(2, controller.adjust(false));
+}
+
+}  // namespace unittest
@@ -1,12 +1,16 @@
 // Copyright 2010-2012 RethinkDB, all rights reserved.
 #include "unittest/gtest.hpp"
 
+#include <string>
+#include <vector>
+
 #include "http/json.hpp"
 #include "rdb_protocol/rdb_protocol_json.hpp"
 #include "utils.hpp"
 #include "http/json/json_adapter.hpp"
 
 using query_language::json_cmp;
+using query_language::json_hash;
 
 int sign(int x) {
     return (0 < x) - (x < 0);
@@ -134,4 +138,98 @@ namespace unittest {
             }
         }
     }
+
+    TEST(JSON, HashAgreesWithCompare) {
+        const char *equal_pairs[][2] = {
+            { "0", "-0" },
+            { "1.5", "1.5" },
+            { "\"abc\"", "\"abc\"" },
+            { "[1, \"a\", null]", "[1, \"a\", null]" },
+            { "{\"a\": 1, \"b\": [true]}", "{\"b\": [true], \"a\": 1}" }
+        };
+        for (size_t i = 0; i < sizeof(equal_pairs) / sizeof(equal_pairs[0]); ++i) {
+            scoped_cJSON_t l(cJSON_Parse(equal_pairs[i][0])), r(cJSON_Parse(equal_pairs[i][1]));
+            ASSERT_EQ(0, json_cmp(l.get(), r.get()));
+            EXPECT_EQ(json_hash(l.get()), json_hash(r.get()));
+        }
+
+        // Not required, but a hash that lumped these together would be useless.
+        scoped_cJSON_t one(cJSON_Parse("1")), two(cJSON_Parse("2")), str(cJSON_Parse("\"1\""));
+        EXPECT_NE(json_hash(one.get()), json_hash(two.get()));
+        EXPECT_NE(json_hash(one.get()), json_hash(str.get()));
+    }
+
+    TEST(JSON, ReusedNodes) {
+        // Freed nodes get handed out again, and must come back blank.
+        const char *doc = "{\"a\": [1, \"two\", {\"b\": null}], \"c\": true}";
+        for (int i = 0; i < 100; ++i) {
+            scoped_cJSON_t parsed(cJSON_Parse(doc));
+            ASSERT_TRUE(parsed.get());
+            scoped_cJSON_t fresh(cJSON_CreateObject());
+            cJSON_AddItemToObject(fresh.get(), "x", cJSON_CreateArray());
+            EXPECT_EQ("{\"x\":[]}", cJSON_print_unformatted_std_string(fresh.get()));
+            scoped_cJSON_t reparsed(cJSON_Parse(cJSON_print_unformatted_std_string(parsed.get()).c_str()));
+            EXPECT_EQ(0, json_cmp(parsed.get(), reparsed.get()));
+        }
+    }
+
+    /* Whether `x` and `y` are the same tree, down to the last field. */
+    bool same_tree(const cJSON *x, const cJSON *y) {
+        if (!x || !y) {
+            return x == y;
+        }
+        return x->type == y->type && x->valueint == y->valueint
+            && x->valuedouble == y->valuedouble
+            && (x->valuestring ? y->valuestring && strcmp(x->valuestring, y->valuestring) == 0 : !y->valuestring)
+            && (x->string ? y->string && strcmp(x->string, y->string) == 0 : !y->string)
+            && same_tree(x->child, y->child) && same_tree(x->next, y->next);
+    }
+
+    TEST(JSON, IndexedParserMatchesBytewise) {
+        std::vector<std::string> docs;
+        docs.push_back("{\"a\": [1, -2.5e3, \"two\", {\"b\": null}], \"c\": true, \"d\": false}");
+        docs.push_back("  \"\\\"quoted\\\" and \\\\ and \\u00e9 and \\ud83d\\ude00\"  ");
+        docs.push_back("[]");
+        docs.push_back("{}");
+        docs.push_back("\n\t[ 1 ,\n 2 ]\n");
+        // Malformed, so these go through the fallback, and must fail (or not) the same way.
+        docs.push_back("[1, 2");
+        docs.push_back("[truex]");
+        docs.push_back("[1.2.3]");
+        docs.push_back("{\"a\" 1}");
+        docs.push_back("\"unterminated");
+        docs.push_back("12 trailing junk");
+        docs.push_back("");
+
+        // Runs of backslashes that straddle the 64-byte blocks the index is built in.
+        for (int pad = 50; pad < 70; ++pad) {
+            for (int slashes = 1; slashes <= 4; ++slashes) {
+                std::string doc = "[\"" + std::string(pad, 'x') + std::string(slashes, '\\') + "\\\"\", 1]";
+                docs.push_back(doc);
+            }
+        }
+
+        for (size_t i = 0; i < docs.size(); ++i) {
+            // Short documents skip the index, so pad them out.
+            std::string doc = docs[i] + std::string(64, ' ');
+            scoped_cJSON_t indexed(cJSON_Parse(doc.c_str()));
+            const char *indexed_error = cJSON_GetErrorPtr();
+            scoped_cJSON_t bytewise(cJSON_ParseBytewise(doc.c_str()));
+            EXPECT_TRUE(same_tree(indexed.get(), bytewise.get())) << doc;
+            EXPECT_EQ(indexed_error, cJSON_GetErrorPtr()) << doc;
+        }
+    }
+
+    TEST(JSON, BufferedPrinterMatchesBytewise) {
+        scoped_cJSON_t json(cJSON_Parse("{\"a\": [1, 2.5, 1e300, \"\\u0001\\n\\\"\"], \"b\": {}, \"c\": {\"d\": [[], {}]}, \"e\": -2147483648}"));
+        ASSERT_TRUE(json.get());
+        for (int fmt = 0; fmt < 2; ++fmt) {
+            char *buffered = fmt ? cJSON_Print(json.get()) : cJSON_PrintUnformatted(json.get());
+            char *bytewise = cJSON_PrintBytewise(json.get(), fmt);
+            ASSERT_TRUE(buffered && bytewise);
+            EXPECT_STREQ(bytewise, buffered);
+            free(buffered);
+            free(bytewise);
+        }
+    }
 } //namespace unittest
@@ -4,6 +4,7 @@
 
 #include "mock/unittest_utils.hpp"
 
+#include "config/args.hpp"
 #include "containers/archive/archive.hpp"
 #include "extproc/job.hpp"
 #include "extproc/pool.hpp"
@@ -59,3 +60,76 @@ void run_timeout_test(js::runner_t *runner) {
 }
 
 TEST(JSProc, Timeout) { main_jsproc_test(run_timeout_test); }
+
+void run_compile_cache_test(js::runner_t *runner) {
+    std::vector<std::string> args(1, "x");
+
+    std::string errmsg;
+    id_t id = runner->compile(args, "return x + 1;", &errmsg);
+    ASSERT_NE(js::INVALID_ID, id);
+
+    // The same function again is the same compiled function.
+    EXPECT_EQ(id, runner->compile(args, "return x + 1;", &errmsg));
+    EXPECT_NE(id, runner->compile(args, "return x + 2;", &errmsg));
+}
+
+TEST(JSProc, CompileCache) { main_jsproc_test(run_compile_cache_test); }
+
+void run_compile_cache_eviction_test(js::runner_t *runner) {
+    std::vector<std::string> args;
+
+    std::string errmsg;
+    id_t hot = runner->compile(args, "return 0;", &errmsg);
+    ASSERT_NE(js::INVALID_ID, hot);
+    id_t cold = runner->compile(args, "return 1;", &errmsg);
+    ASSERT_NE(js::INVALID_ID, cold);
+
+    // Fill the cache up and then some, using `hot` all along.
+    for (int i = 2; i < JS_MAX_CACHED_FUNCTIONS + 2; ++i) {
+        ASSERT_NE(js::INVALID_ID, runner->compile(args, strprintf("return %d;", i), &errmsg));
+        ASSERT_EQ(hot, runner->compile(args, "return 0;", &errmsg));
+    }
+
+    // `cold` was the one used longest ago, so it had to make room.
+    EXPECT_NE(cold, runner->compile(args, "return 1;", &errmsg));
+}
+
+TEST(JSProc, CompileCacheEviction) { main_jsproc_test(run_compile_cache_eviction_test); }
+
+void run_call_many_test(js::runner_t *runner) {
+    std::vector<std::string> argnames;
+    argnames.push_back("row");
+    argnames.push_back("k");
+
+    std::string errmsg;
+    id_t id = runner->compile(argnames, "return this.a === undefined ? row * k : this.a * k;", &errmsg);
+    ASSERT_NE(js::INVALID_ID, id);
+
+    std::vector<boost::shared_ptr<scoped_cJSON_t> > rows;
+    for (int i = 0; i < 100; ++i) {
+        rows.push_back(boost::shared_ptr<scoped_cJSON_t>(new scoped_cJSON_t(cJSON_CreateNumber(i))));
+    }
+    // Objects are also the receiver.
+    rows.push_back(boost::shared_ptr<scoped_cJSON_t>(new scoped_cJSON_t(cJSON_Parse("{\"a\": 1000}"))));
+
+    std::vector<boost::shared_ptr<scoped_cJSON_t> > args;
+    args.push_back(boost::shared_ptr<scoped_cJSON_t>(new scoped_cJSON_t(cJSON_CreateNull())));
+    args.push_back(boost::shared_ptr<scoped_cJSON_t>(new scoped_cJSON_t(cJSON_CreateNumber(3))));
+
+    std::vector<boost::shared_ptr<scoped_cJSON_t> > results;
+    ASSERT_TRUE(runner->call_many(id, rows, args, 0, &results, &errmsg));
+    ASSERT_EQ(rows.size(), results.size());
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(i * 3, results[i]->get()->valueint);
+    }
+    EXPECT_EQ(3000, results[100]->get()->valueint);
+
+    // A call that throws stops the batch.
+    id_t throws = runner->compile(argnames, "if (row == 5) { throw 'five'; } return row;", &errmsg);
+    ASSERT_NE(js::INVALID_ID, throws);
+    EXPECT_FALSE(runner->call_many(throws, rows, args, 0, &results, &errmsg));
+    EXPECT_EQ(5u, results.size());
+    EXPECT_NE(std::string(), errmsg);
+}
+
+TEST(JSProc, CallMany) { main_jsproc_test(run_call_many_test); }
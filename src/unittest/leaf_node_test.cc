@@ -1,6 +1,7 @@
 // Copyright 2010-2012 RethinkDB, all rights reserved.
 #include <map>
 
+#include "btree/key_prefix_index.hpp"
 #include "btree/leaf_node.hpp"
 #include "btree/node.hpp"
 #include "containers/scoped.hpp"
@@ -223,6 +224,10 @@ public:
         return leaf::is_full(&sizer_, node(), key.btree_key(), value_buf.data());
     }
 
+    bool IsCompressed() {
+        return node()->magic == leaf::compressed_leaf_magic(sizer_.btree_leaf_magic());
+    }
+
     bool ShouldHave(const store_key_t& key) {
         return kv_.end() != kv_.find(key);
     }
@@ -295,6 +300,26 @@ public:
             printf("\n");
         }
         ASSERT_TRUE(receptor.map() == kv_);
+
+        VerifyPrefixIndex();
+    }
+
+    // Checks that searching with a key prefix index gives the same results as the plain
+    // binary search, for the keys we have and for some keys next to them.
+    void VerifyPrefixIndex() {
+        scoped_ptr_t<key_prefix_index_t> prefix_index(leaf::make_key_prefix_index(node()));
+        for (std::map<store_key_t, std::string>::const_iterator p = kv_.begin(), q = kv_.end(); p != q; ++p) {
+            store_key_t keys[3] = { p->first, p->first, p->first };
+            keys[1].increment();
+            keys[2].decrement();
+            for (int i = 0; i < 3; ++i) {
+                int index, indexed_index;
+                bool found = leaf::find_key(node(), keys[i].btree_key(), &index);
+                bool indexed_found = leaf::find_key(node(), prefix_index.get(), keys[i].btree_key(), &indexed_index);
+                ASSERT_EQ(found, indexed_found);
+                ASSERT_EQ(index, indexed_index);
+            }
+        }
     }
 
 public:
@@ -613,6 +638,25 @@ TEST(LeafNodeTest, Splitting) {
     left.Split(&right);
 }
 
+TEST(LeafNodeTest, PrefixIndexSharedPrefix) {
+    // The keys share a prefix that is longer than the index's fixed-width prefixes, and
+    // some of them tie on the part after it.
+    LeafNodeTracker tracker;
+    for (int i = 0; i < 100; ++i) {
+        tracker.Insert(store_key_t(strprintf("user:000123:session:%d", i % 10 == 0 ? i * 1000000 : i)), "v");
+    }
+
+    scoped_ptr_t<key_prefix_index_t> prefix_index(leaf::make_key_prefix_index(tracker.node()));
+    const char *absent[] = { "", "a", "user:", "user:000123", "user:000123:session:", "user:000124", "z" };
+    for (size_t i = 0; i < sizeof(absent) / sizeof(absent[0]); ++i) {
+        store_key_t key(absent[i]);
+        int index, indexed_index;
+        ASSERT_FALSE(leaf::find_key(tracker.node(), key.btree_key(), &index));
+        ASSERT_FALSE(leaf::find_key(tracker.node(), prefix_index.get(), key.btree_key(), &indexed_index));
+        ASSERT_EQ(index, indexed_index);
+    }
+}
+
 TEST(LeafNodeTest, Fullness) {
     LeafNodeTracker node;
     int i;
@@ -623,4 +667,124 @@ TEST(LeafNodeTest, Fullness) {
     ASSERT_TRUE(node.IsFull(store_key_t(strprintf("a%d", i)), strprintf("A%d", i)));
 }
 
+TEST(LeafNodeTest, CompressedMagic) {
+    block_magic_t magic = { { 's', 'h', 'L', 'F' } };
+    block_magic_t other = { { 's', 'h', 'L', 'f' } };
+    block_magic_t compressed = leaf::compressed_leaf_magic(magic);
+
+    ASSERT_TRUE(compressed != magic);
+    ASSERT_TRUE(leaf::matches_leaf_magic(magic, magic));
+    ASSERT_TRUE(leaf::matches_leaf_magic(compressed, magic));
+    ASSERT_FALSE(leaf::matches_leaf_magic(other, magic));
+    ASSERT_FALSE(leaf::matches_leaf_magic(leaf::compressed_leaf_magic(other), magic));
+}
+
+// Fills the tracker with keys that share a long prefix, returning how many fit.
+int InsertSessionKeys(LeafNodeTracker *tracker, int user) {
+    int i = 0;
+    while (tracker->Insert(store_key_t(strprintf("user:%05d:session:%04d", user, i)), "v")) {
+        ++i;
+    }
+    return i;
+}
+
+TEST(LeafNodeTest, PrefixCompression) {
+    LeafNodeTracker tracker;
+    ASSERT_FALSE(tracker.IsCompressed());
+
+    int count = InsertSessionKeys(&tracker, 12345);
+    ASSERT_TRUE(tracker.IsCompressed());
+
+    // Each entry would cost 2 bytes of pair offset, 24 bytes of key,
+    // and 2 bytes of value if we stored the keys in full.
+    ASSERT_GT(count, 2 * (4072 / 28));
+
+    // Keys that don't start with the prefix still fit, once we've made
+    // some room.
+    for (int i = 0; i < 20; ++i) {
+        tracker.Remove(store_key_t(strprintf("user:12345:session:%04d", i)));
+    }
+    ASSERT_TRUE(tracker.Insert(store_key_t("user:12346"), "w"));
+    ASSERT_TRUE(tracker.Insert(store_key_t("a"), "x"));
+    ASSERT_TRUE(tracker.Insert(store_key_t(""), "y"));
+}
+
+TEST(LeafNodeTest, CompressedInsertRemove) {
+    LeafNodeTracker tracker;
+
+    rng_t rng;
+    for (int i = 0; i < 5000; ++i) {
+        store_key_t key(strprintf("shared:prefix:%d", rng.randint(300)));
+        if (rng.randint(2) == 1) {
+            tracker.Insert(key, strprintf("%d", i));
+        } else if (tracker.ShouldHave(key)) {
+            tracker.Remove(key);
+        }
+    }
+    ASSERT_TRUE(tracker.IsCompressed());
+}
+
+TEST(LeafNodeTest, CompressedSplitting) {
+    LeafNodeTracker left;
+    InsertSessionKeys(&left, 1);
+    ASSERT_TRUE(left.IsCompressed());
+
+    LeafNodeTracker right;
+    left.Split(&right);
+    ASSERT_TRUE(left.IsCompressed());
+    ASSERT_TRUE(right.IsCompressed());
+
+    ASSERT_TRUE(left.Insert(store_key_t("user:00001:session:0000x"), "v"));
+    ASSERT_TRUE(right.Insert(store_key_t("user:00001:session:9999"), "v"));
+    ASSERT_TRUE(right.Insert(store_key_t("zzz"), "v"));
+}
+
+TEST(LeafNodeTest, CompressedMerging) {
+    LeafNodeTracker left;
+    LeafNodeTracker right;
+
+    for (int i = 0; i < 50; ++i) {
+        left.Insert(store_key_t(strprintf("user:00001:session:%04d", i)), "L");
+        right.Insert(store_key_t(strprintf("user:00002:session:%04d", i)), "R");
+    }
+    ASSERT_TRUE(left.IsCompressed());
+    ASSERT_TRUE(right.IsCompressed());
+
+    // The nodes have different prefixes.
+    ASSERT_TRUE(leaf::is_mergable(&right.sizer_, left.node(), right.node()));
+    right.Merge(&left);
+    ASSERT_TRUE(right.IsCompressed());
+}
+
+TEST(LeafNodeTest, MixedEncodingMerging) {
+    LeafNodeTracker left;
+    LeafNodeTracker right;
+
+    for (int i = 0; i < 50; ++i) {
+        left.Insert(store_key_t(strprintf("a%d", i)), "A");
+        right.Insert(store_key_t(strprintf("user:00002:session:%04d", i)), "R");
+    }
+    ASSERT_FALSE(left.IsCompressed());
+    ASSERT_TRUE(right.IsCompressed());
+
+    ASSERT_TRUE(leaf::is_mergable(&right.sizer_, left.node(), right.node()));
+    right.Merge(&left);
+}
+
+TEST(LeafNodeTest, MixedEncodingLeveling) {
+    LeafNodeTracker left;
+    LeafNodeTracker right;
+
+    InsertSessionKeys(&left, 1);
+    ASSERT_TRUE(left.IsCompressed());
+
+    right.Insert(store_key_t("z0"), "Z0");
+    ASSERT_FALSE(right.IsCompressed());
+
+    bool could_level;
+    right.Level(1, &left, &could_level);
+    ASSERT_TRUE(could_level);
+    ASSERT_TRUE(right.IsCompressed());
+}
+
 }  // namespace unittest
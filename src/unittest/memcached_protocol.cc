@@ -2,7 +2,9 @@
 #include "errors.hpp"
 #include <boost/make_shared.hpp>
 
+#include "arch/timing.hpp"
 #include "buffer_cache/buffer_cache.hpp"
+#include "config/args.hpp"
 #include "containers/iterators.hpp"
 #include "memcached/protocol.hpp"
 #include "serializer/config.hpp"
@@ -18,7 +20,8 @@ void run_with_namespace_interface(boost::function<void(namespace_interface_t<mem
 
     /* Pick shards */
     std::vector< hash_region_t<key_range_t> > shards;
-    shards.push_back(hash_region_t<key_range_t>(key_range_t(key_range_t::none,   store_key_t(),  key_range_t::open, store_key_t("n"))));
+    shards.push_back(hash_region_t<key_range_t>(key_range_t(key_range_t::none,   store_key_t(),  key_range_t::open, store_key_t("g"))));
+    shards.push_back(hash_region_t<key_range_t>(key_range_t(key_range_t::closed, store_key_t("g"), key_range_t::open, store_key_t("n"))));
     shards.push_back(hash_region_t<key_range_t>(key_range_t(key_range_t::closed, store_key_t("n"), key_range_t::none, store_key_t() )));
 
     mock::temp_file_t temp_file("/tmp/rdb_unittest.XXXXXX");
@@ -139,5 +142,145 @@ TEST(MemcachedProtocol, GetSet) {
     run_in_thread_pool_with_namespace_interface(&run_get_set_test);
 }
 
+/* `MultiGet` tests that a multi-key get finds keys on every shard and reports
+the ones that are missing */
+void run_multi_get_test(namespace_interface_t<memcached_protocol_t> *nsi, order_source_t *order_source) {
+    const char *present[] = { "a", "m", "x" };
+    for (size_t i = 0; i < sizeof(present) / sizeof(present[0]); ++i) {
+        sarc_mutation_t set;
+        set.key = store_key_t(present[i]);
+        set.data = data_buffer_t::create(1);
+        set.data->buf()[0] = present[i][0];
+        set.flags = 0;
+        set.exptime = 0;
+        set.add_policy = add_policy_yes;
+        set.replace_policy = replace_policy_yes;
+        memcached_protocol_t::write_t write(set, time(NULL), 12345);
+
+        cond_t interruptor;
+        memcached_protocol_t::write_response_t result;
+        nsi->write(write, &result, order_source->check_in("unittest::run_multi_get_test(memcached_protocol.cc-A)"), &interruptor);
+    }
+
+    std::vector<store_key_t> keys;
+    keys.push_back(store_key_t("x"));
+    keys.push_back(store_key_t("b"));
+    keys.push_back(store_key_t("a"));
+    keys.push_back(store_key_t("m"));
+    keys.push_back(store_key_t("a"));
+    memcached_protocol_t::read_t read(multi_get_query_t(keys), time(NULL));
+
+    cond_t interruptor;
+    memcached_protocol_t::read_response_t result;
+    nsi->read(read, &result, order_source->check_in("unittest::run_multi_get_test(memcached_protocol.cc-B)").with_read_mode(), &interruptor);
+
+    if (multi_get_result_t *maybe_multi_get_result = boost::get<multi_get_result_t>(&result.result)) {
+        // The results come back sorted by key, without duplicates.
+        ASSERT_EQ(4u, maybe_multi_get_result->results.size());
+        const char *expected[] = { "a", "b", "m", "x" };
+        for (size_t i = 0; i < 4; ++i) {
+            const std::pair<store_key_t, get_result_t> &r = maybe_multi_get_result->results[i];
+            EXPECT_EQ(std::string(expected[i]), key_to_unescaped_str(r.first));
+            if (expected[i][0] == 'b') {
+                EXPECT_TRUE(r.second.value.get() == NULL);
+            } else {
+                ASSERT_TRUE(r.second.value.get() != NULL);
+                EXPECT_EQ(expected[i][0], r.second.value->buf()[0]);
+            }
+        }
+    } else {
+        ADD_FAILURE() << "got wrong type of result back";
+    }
+}
+TEST(MemcachedProtocol, MultiGet) {
+    run_in_thread_pool_with_namespace_interface(&run_multi_get_test);
+}
+
+/* `MultiGetSkipsShards` tests a multi-key get whose keys are on the first and
+last shards only. The middle shard is inside the keys' region but must not get
+a read. */
+void run_multi_get_skips_shards_test(namespace_interface_t<memcached_protocol_t> *nsi, order_source_t *order_source) {
+    {
+        sarc_mutation_t set;
+        set.key = store_key_t("x");
+        set.data = data_buffer_t::create(1);
+        set.data->buf()[0] = 'x';
+        set.flags = 0;
+        set.exptime = 0;
+        set.add_policy = add_policy_yes;
+        set.replace_policy = replace_policy_yes;
+        memcached_protocol_t::write_t write(set, time(NULL), 12345);
+
+        cond_t interruptor;
+        memcached_protocol_t::write_response_t result;
+        nsi->write(write, &result, order_source->check_in("unittest::run_multi_get_skips_shards_test(memcached_protocol.cc-A)"), &interruptor);
+    }
+
+    std::vector<store_key_t> keys;
+    keys.push_back(store_key_t("a"));
+    keys.push_back(store_key_t("x"));
+    memcached_protocol_t::read_t read(multi_get_query_t(keys), time(NULL));
+
+    cond_t interruptor;
+    memcached_protocol_t::read_response_t result;
+    nsi->read(read, &result, order_source->check_in("unittest::run_multi_get_skips_shards_test(memcached_protocol.cc-B)").with_read_mode(), &interruptor);
+
+    if (multi_get_result_t *maybe_multi_get_result = boost::get<multi_get_result_t>(&result.result)) {
+        ASSERT_EQ(2u, maybe_multi_get_result->results.size());
+        EXPECT_EQ("a", key_to_unescaped_str(maybe_multi_get_result->results[0].first));
+        EXPECT_TRUE(maybe_multi_get_result->results[0].second.value.get() == NULL);
+        EXPECT_EQ("x", key_to_unescaped_str(maybe_multi_get_result->results[1].first));
+        ASSERT_TRUE(maybe_multi_get_result->results[1].second.value.get() != NULL);
+        EXPECT_EQ('x', maybe_multi_get_result->results[1].second.value->buf()[0]);
+    } else {
+        ADD_FAILURE() << "got wrong type of result back";
+    }
+}
+TEST(MemcachedProtocol, MultiGetSkipsShards) {
+    run_in_thread_pool_with_namespace_interface(&run_multi_get_skips_shards_test);
+}
+
+/* `SweepExpired` tests that the background sweep deletes expired values, even
+though no query ever touches them */
+void run_sweep_expired_test(namespace_interface_t<memcached_protocol_t> *nsi, order_source_t *order_source) {
+    const char *keys[] = { "a", "x" };
+    for (size_t i = 0; i < sizeof(keys) / sizeof(keys[0]); ++i) {
+        sarc_mutation_t set;
+        set.key = store_key_t(keys[i]);
+        set.data = data_buffer_t::create(1);
+        set.data->buf()[0] = keys[i][0];
+        set.flags = 0;
+        // "a" expired a long time ago; "x" never expires.
+        set.exptime = keys[i][0] == 'a' ? 1 : 0;
+        set.add_policy = add_policy_yes;
+        set.replace_policy = replace_policy_yes;
+        memcached_protocol_t::write_t write(set, time(NULL), 12345);
+
+        cond_t interruptor;
+        memcached_protocol_t::write_response_t result;
+        nsi->write(write, &result, order_source->check_in("unittest::run_sweep_expired_test(memcached_protocol.cc-A)"), &interruptor);
+    }
+
+    nap(EXPIRY_SWEEP_INTERVAL_MS * 3);
+
+    // With an effective time of 0 nothing counts as expired, so only values
+    // that are really gone are missing from the results.
+    rget_query_t rget(hash_region_t<key_range_t>::universe(), 1000);
+    memcached_protocol_t::read_t read(rget, 0);
+
+    cond_t interruptor;
+    memcached_protocol_t::read_response_t result;
+    nsi->read(read, &result, order_source->check_in("unittest::run_sweep_expired_test(memcached_protocol.cc-B)").with_read_mode(), &interruptor);
+    if (rget_result_t *maybe_rget_result = boost::get<rget_result_t>(&result.result)) {
+        ASSERT_EQ(1u, maybe_rget_result->pairs.size());
+        EXPECT_EQ(std::string("x"), key_to_unescaped_str(maybe_rget_result->pairs[0].key));
+    } else {
+        ADD_FAILURE() << "got wrong type of result back";
+    }
+}
+TEST(MemcachedProtocol, SweepExpired) {
+    run_in_thread_pool_with_namespace_interface(&run_sweep_expired_test);
+}
+
 }   /* namespace unittest */
 
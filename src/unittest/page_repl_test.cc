@@ -0,0 +1,120 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#include <vector>
+
+#include "buffer_cache/buffer_cache.hpp"
+#include "errors.hpp"
+#include "mock/unittest_utils.hpp"
+#include "serializer/translator.hpp"
+#include "unittest/gtest.hpp"
+#include "unittest/server_test_helper.hpp"
+
+namespace unittest {
+
+/* Runs the same mixed workload (repeated point reads of a small hot set, interleaved with
+sequential scans over a much larger cold set) against a small cache with each page replacement
+policy, and compares the hit rate of the point reads. */
+class page_repl_tester_t : public server_test_helper_t {
+public:
+    page_repl_tester_t() : random_hit_rate(0), twoq_hit_rate(0) { }
+
+    double random_hit_rate;
+    double twoq_hit_rate;
+
+protected:
+    static const int num_hot_blocks = 32;
+    static const int num_cold_blocks = 1024;
+    static const int cache_size_in_blocks = 128;
+    static const int num_rounds = 64;
+    static const int point_reads_per_round = 64;
+    static const int scan_blocks_per_round = 128;
+
+    void run_tests(UNUSED cache_t *cache) {
+        // We set up our own caches in run_serializer_tests.
+    }
+
+    void run_serializer_tests() {
+        mirrored_cache_static_config_t cache_static_cfg;
+        cache_t::create(this->serializer, &cache_static_cfg);
+
+        {
+            mirrored_cache_config_t cache_cfg;
+            cache_cfg.max_size = GIGABYTE;
+            cache_t cache(this->serializer, &cache_cfg, &get_global_perfmon_collection());
+            create_blocks(&cache);
+            // The cache's destructor flushes everything, so all of the blocks are clean (and
+            // evictable) when we reopen the cache below.
+        }
+
+        random_hit_rate = run_trace(page_repl_policy_random);
+        twoq_hit_rate = run_trace(page_repl_policy_2q);
+    }
+
+private:
+    void create_blocks(cache_t *cache) {
+        order_source_t order_source;
+        const int total = num_hot_blocks + num_cold_blocks;
+        while (static_cast<int>(hot_blocks.size() + cold_blocks.size()) < total) {
+            transaction_t txn(cache, rwi_write, 0, repli_timestamp_t::distant_past,
+                              order_source.check_in("page_repl_tester_t::create_blocks"));
+            for (int i = 0; i < 64 && static_cast<int>(hot_blocks.size() + cold_blocks.size()) < total; ++i) {
+                buf_lock_t buf(&txn);
+                change_value(&buf, init_value);
+                if (static_cast<int>(hot_blocks.size()) < num_hot_blocks) {
+                    hot_blocks.push_back(buf.get_block_id());
+                } else {
+                    cold_blocks.push_back(buf.get_block_id());
+                }
+            }
+        }
+    }
+
+    // Returns the fraction of point reads that found their block already in the cache.
+    double run_trace(page_repl_policy_t policy) {
+        mirrored_cache_config_t cache_cfg;
+        cache_cfg.max_size = cache_size_in_blocks * this->serializer->get_block_size().ser_value();
+        cache_cfg.page_repl_policy = policy;
+        cache_t cache(this->serializer, &cache_cfg, &get_global_perfmon_collection());
+
+        srandom(0);
+        int hits = 0, point_reads = 0;
+        int scan_position = 0;
+        order_source_t order_source;
+        for (int round = 0; round < num_rounds; ++round) {
+            transaction_t txn(&cache, rwi_read, 0, repli_timestamp_t::invalid,
+                              order_source.check_in("page_repl_tester_t::run_trace").with_read_mode());
+
+            for (int i = 0; i < point_reads_per_round; ++i) {
+                block_id_t block_id = hot_blocks[randint(num_hot_blocks)];
+                // Skip the first round, which warms up the cache.
+                if (round > 0) {
+                    hits += cache.contains_block(block_id) ? 1 : 0;
+                    ++point_reads;
+                }
+                buf_lock_t buf(&txn, block_id, rwi_read);
+                EXPECT_EQ(static_cast<uint32_t>(init_value), get_value(&buf));
+            }
+
+            for (int i = 0; i < scan_blocks_per_round; ++i) {
+                buf_lock_t buf(&txn, cold_blocks[scan_position], rwi_read);
+                scan_position = (scan_position + 1) % num_cold_blocks;
+            }
+        }
+
+        return static_cast<double>(hits) / point_reads;
+    }
+
+    std::vector<block_id_t> hot_blocks;
+    std::vector<block_id_t> cold_blocks;
+};
+
+TEST(PageReplTest, ScanResistance) {
+    page_repl_tester_t tester;
+    tester.run();
+
+    // The scans alone are as large as the cache, so the random policy keeps throwing hot blocks
+    // out. 2Q keeps the hot blocks in its protected queue.
+    EXPECT_GT(tester.twoq_hit_rate, tester.random_hit_rate);
+    EXPECT_GT(tester.twoq_hit_rate, 0.9);
+}
+
+}  // namespace unittest
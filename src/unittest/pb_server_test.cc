@@ -0,0 +1,113 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "errors.hpp"
+#include <boost/bind.hpp>
+
+#include "arch/timing.hpp"
+#include "concurrency/cond_var.hpp"
+#include "concurrency/wait_any.hpp"
+#include "mock/unittest_utils.hpp"
+#include "rdb_protocol/pb_server.hpp"
+#include "unittest/gtest.hpp"
+
+namespace unittest {
+
+static const int queries_per_token = 5;
+
+/* Answers a query with its sequence number. The first query for token 1 holds
+on to token 1's lock until the last query for token 2 has run. */
+Response handle_ordering_query(cond_t *token_two_done, Query *q, query_server_t::context_t *ctx) {
+    token_lock_t token_lock(ctx, q->token());
+    int seq = static_cast<int>(q->read_query().term().number());
+
+    if (q->token() == 1 && seq == 0) {
+        // So that a server that runs queries one at a time fails instead of hanging.
+        signal_timer_t timeout(10000);
+        wait_any_t waiter(token_two_done, &timeout);
+        waiter.wait_lazily_unordered();
+    } else if (q->token() == 2 && seq == queries_per_token - 1) {
+        token_two_done->pulse();
+    }
+
+    Response res;
+    res.set_status_code(Response::SUCCESS_JSON);
+    res.set_token(q->token());
+    res.add_response(strprintf("%d", seq));
+    return res;
+}
+
+void send_ordering_query(tcp_conn_t *conn, int64_t token, int seq, signal_t *closer) {
+    Query q;
+    q.set_type(seq == 0 ? Query::READ : Query::CONTINUE);
+    q.set_token(token);
+    Term *term = q.mutable_read_query()->mutable_term();
+    term->set_type(Term::NUMBER);
+    term->set_number(seq);
+
+    std::string data = q.SerializeAsString();
+    int32_t size = data.size();
+    conn->write(&size, sizeof(size), closer);
+    conn->write(data.data(), data.size(), closer);
+}
+
+Response recv_ordering_response(tcp_conn_t *conn, signal_t *closer) {
+    int32_t size;
+    conn->read(&size, sizeof(size), closer);
+    scoped_array_t<char> data(size);
+    conn->read(data.data(), size, closer);
+
+    Response res;
+    EXPECT_TRUE(res.ParseFromArray(data.data(), size));
+    return res;
+}
+
+void run_token_ordering_test() {
+    int port = mock::randport();
+    std::set<ip_address_t> addresses = mock::get_unittest_addresses();
+
+    cond_t token_two_done;
+    protob_server_t<Query, Response, query_server_t::context_t> server(
+        addresses, port, boost::bind(&handle_ordering_query, &token_two_done, _1, _2),
+        &on_unparsable_query, CORO_UNORDERED);
+
+    cond_t non_interruptor;
+    tcp_conn_t conn(*addresses.begin(), port, &non_interruptor);
+    int32_t magic_number = protob_server_t<Query, Response, query_server_t::context_t>::magic_number;
+    conn.write(&magic_number, sizeof(magic_number), &non_interruptor);
+
+    // The two tokens' queries go out interleaved.
+    for (int seq = 0; seq < queries_per_token; ++seq) {
+        send_ordering_query(&conn, 1, seq, &non_interruptor);
+        send_ordering_query(&conn, 2, seq, &non_interruptor);
+    }
+
+    std::map<int64_t, std::vector<std::string> > responses;
+    for (int i = 0; i < 2 * queries_per_token; ++i) {
+        Response res = recv_ordering_response(&conn, &non_interruptor);
+        ASSERT_EQ(Response::SUCCESS_JSON, res.status_code());
+        ASSERT_EQ(1, res.response_size());
+        if (i == 0) {
+            // Token 1 being held up doesn't hold up token 2.
+            EXPECT_EQ(2, res.token());
+        }
+        responses[res.token()].push_back(res.response(0));
+    }
+
+    // Each token's responses come back in the order its queries were sent.
+    for (int64_t token = 1; token <= 2; ++token) {
+        ASSERT_EQ(static_cast<size_t>(queries_per_token), responses[token].size());
+        for (int seq = 0; seq < queries_per_token; ++seq) {
+            EXPECT_EQ(strprintf("%d", seq), responses[token][seq]);
+        }
+    }
+}
+
+TEST(PBServerTest, TokenOrdering) {
+    mock::run_in_thread_pool(&run_token_ordering_test);
+}
+
+}   /* namespace unittest */
@@ -1,27 +1,43 @@
 // Copyright 2010-2012 RethinkDB, all rights reserved.
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
 #include "errors.hpp"
 #include <boost/make_shared.hpp>
 
+#include "arch/timing.hpp"
+#include "backfill_progress.hpp"
 #include "buffer_cache/buffer_cache.hpp"
+#include "clustering/administration/metadata.hpp"
+#include "clustering/reactor/reactor.hpp"
 #include "containers/iterators.hpp"
 #include "memcached/protocol.hpp"
 #include "rdb_protocol/protocol.hpp"
+#include "rdb_protocol/stream.hpp"
 #include "serializer/config.hpp"
 #include "serializer/translator.hpp"
 #include "unittest/gtest.hpp"
+#include "unittest/dummy_metadata_controller.hpp"
 #include "unittest/dummy_namespace_interface.hpp"
 
 namespace unittest {
 namespace {
 
+std::vector<rdb_protocol_t::region_t> unittest_shards() {
+    std::vector<rdb_protocol_t::region_t> shards;
+    shards.push_back(rdb_protocol_t::region_t(key_range_t(key_range_t::none,   store_key_t(),  key_range_t::open, store_key_t("n"))));
+    shards.push_back(rdb_protocol_t::region_t(key_range_t(key_range_t::closed, store_key_t("n"), key_range_t::none, store_key_t() )));
+    return shards;
+}
+
 void run_with_namespace_interface(boost::function<void(namespace_interface_t<rdb_protocol_t> *, order_source_t *)> fun) {
 
     order_source_t order_source;
 
     /* Pick shards */
-    std::vector<rdb_protocol_t::region_t> shards;
-    shards.push_back(rdb_protocol_t::region_t(key_range_t(key_range_t::none,   store_key_t(),  key_range_t::open, store_key_t("n"))));
-    shards.push_back(rdb_protocol_t::region_t(key_range_t(key_range_t::closed, store_key_t("n"), key_range_t::none, store_key_t() )));
+    std::vector<rdb_protocol_t::region_t> shards = unittest_shards();
 
     boost::ptr_vector<mock::temp_file_t> temp_files;
     for (size_t i = 0; i < shards.size(); ++i) {
@@ -42,7 +58,10 @@ void run_with_namespace_interface(boost::function<void(namespace_interface_t<rdb
     }
 
     boost::ptr_vector<rdb_protocol_t::store_t> underlying_stores;
-    rdb_protocol_t::context_t ctx;
+    /* Reads and writes set up their query environments from the context's
+    metadata watchables, which the default context doesn't have. */
+    dummy_semilattice_controller_t<cluster_semilattice_metadata_t> semilattice_controller((cluster_semilattice_metadata_t()));
+    rdb_protocol_t::context_t ctx(NULL, NULL, semilattice_controller.get_view(), NULL, generate_uuid(), NULL, "");
 
     for (size_t i = 0; i < shards.size(); ++i) {
         underlying_stores.push_back(new rdb_protocol_t::store_t(serializers[i].get(), temp_files[i].name(), GIGABYTE, true, &get_global_perfmon_collection(), &ctx));
@@ -111,5 +130,495 @@ void run_get_set_test(namespace_interface_t<rdb_protocol_t> *nsi, order_source_t
 //    run_in_thread_pool_with_namespace_interface(&run_get_set_test);
 //}
 
-}   /* namespace unittest */
+/* Passes reads and writes on to another namespace interface, and keeps track
+of the table scans that go through it. */
+class rget_recording_namespace_interface_t : public namespace_interface_t<rdb_protocol_t> {
+public:
+    explicit rget_recording_namespace_interface_t(namespace_interface_t<rdb_protocol_t> *_inner)
+        : fail_on_rget(-1), shrink_chunks_to(0), inner(_inner) { }
+
+    void read(const rdb_protocol_t::read_t &read, rdb_protocol_t::read_response_t *response, order_token_t tok, signal_t *interruptor) THROWS_ONLY(interrupted_exc_t, cannot_perform_query_exc_t) {
+        rdb_protocol_t::read_t recorded = record(read);
+        inner->read(recorded, response, tok, interruptor);
+    }
+    void read_outdated(const rdb_protocol_t::read_t &read, rdb_protocol_t::read_response_t *response, signal_t *interruptor) THROWS_ONLY(interrupted_exc_t, cannot_perform_query_exc_t) {
+        rdb_protocol_t::read_t recorded = record(read);
+        inner->read_outdated(recorded, response, interruptor);
+    }
+    void write(const rdb_protocol_t::write_t &write, rdb_protocol_t::write_response_t *response, order_token_t tok, signal_t *interruptor) THROWS_ONLY(interrupted_exc_t, cannot_perform_query_exc_t) {
+        inner->write(write, response, tok, interruptor);
+    }
+
+    std::set<rdb_protocol_t::region_t> get_sharding_scheme() THROWS_ONLY(cannot_perform_query_exc_t) {
+        std::vector<rdb_protocol_t::region_t> shards = unittest_shards();
+        return std::set<rdb_protocol_t::region_t>(shards.begin(), shards.end());
+    }
+
+    /* The `max_chunk_size` of every table scan, in the order they came in. */
+    std::vector<size_t> chunk_sizes;
+    /* The table scan with this index fails. */
+    int fail_on_rget;
+    /* If nonzero, table scans ask for no more than this, so that even a small
+    table takes several chunks. */
+    size_t shrink_chunks_to;
+
+private:
+    rdb_protocol_t::read_t record(const rdb_protocol_t::read_t &read) {
+        rdb_protocol_t::read_t recorded = read;
+        if (rdb_protocol_t::rget_read_t *rget = boost::get<rdb_protocol_t::rget_read_t>(&recorded.read)) {
+            chunk_sizes.push_back(rget->max_chunk_size);
+            if (static_cast<int>(chunk_sizes.size()) - 1 == fail_on_rget) {
+                throw cannot_perform_query_exc_t("the test made this read fail");
+            }
+            if (shrink_chunks_to != 0) {
+                rget->max_chunk_size = std::min(rget->max_chunk_size, shrink_chunks_to);
+            }
+        }
+        return recorded;
+    }
+
+    namespace_interface_t<rdb_protocol_t> *inner;
+};
+
+static const int num_stream_test_rows = 200;
+
+/* Half the rows go to each shard, and the keys sort in the same order as the
+rows' ids. */
+store_key_t stream_test_key(int id) {
+    return store_key_t(strprintf("%c%04d", id < num_stream_test_rows / 2 ? 'a' : 'z', id));
+}
+
+void write_stream_test_rows(namespace_interface_t<rdb_protocol_t> *nsi, order_source_t *osource) {
+    for (int id = 0; id < num_stream_test_rows; ++id) {
+        boost::shared_ptr<scoped_cJSON_t> row(new scoped_cJSON_t(cJSON_CreateObject()));
+        row->AddItemToObject("id", cJSON_CreateNumber(id));
+        row->AddItemToObject("padding", cJSON_CreateString(std::string(1000, 'x').c_str()));
+
+        rdb_protocol_t::write_t write(rdb_protocol_t::point_write_t(stream_test_key(id), row));
+        rdb_protocol_t::write_response_t response;
+        cond_t interruptor;
+        nsi->write(write, &response, osource->check_in("unittest::write_stream_test_rows"), &interruptor);
+    }
+}
+
+/* `RgetStreamPrefetch` reads a table a few rows at a time, and checks that the
+next chunk is asked for before the consumer gets through the current one, and
+that the rows still come out in order. */
+void run_rget_stream_prefetch_test(namespace_interface_t<rdb_protocol_t> *nsi, order_source_t *osource) {
+    write_stream_test_rows(nsi, osource);
+
+    rget_recording_namespace_interface_t recorder(nsi);
+    recorder.shrink_chunks_to = 8 * KILOBYTE;
+
+    cond_t interruptor;
+    boost::shared_ptr<query_language::json_stream_t> stream(
+        new query_language::batched_rget_stream_t(&recorder, &interruptor, key_range_t::universe(), 10,
+                                                  query_language::backtrace_t(), false));
+
+    boost::shared_ptr<scoped_cJSON_t> row = stream->next();
+    ASSERT_TRUE(row);
+    EXPECT_EQ(0, cJSON_GetObjectItem(row->get(), "id")->valueint);
+    // Let the read-ahead get going.
+    coro_t::yield();
+    EXPECT_EQ(2u, recorder.chunk_sizes.size());
+
+    int rows = 1;
+    while ((row = stream->next())) {
+        EXPECT_EQ(rows, cJSON_GetObjectItem(row->get(), "id")->valueint);
+        ++rows;
+    }
+    EXPECT_EQ(num_stream_test_rows, rows);
+    EXPECT_LT(2u, recorder.chunk_sizes.size());
+}
+TEST(RDBProtocol, RgetStreamPrefetch) {
+    run_in_thread_pool_with_namespace_interface(&run_rget_stream_prefetch_test);
+}
+
+/* `RgetStreamPrefetchError` makes the read-ahead fail, and checks that the
+consumer gets every row of the chunk before it and then the error. */
+void run_rget_stream_prefetch_error_test(namespace_interface_t<rdb_protocol_t> *nsi, order_source_t *osource) {
+    write_stream_test_rows(nsi, osource);
+
+    rget_recording_namespace_interface_t recorder(nsi);
+    recorder.shrink_chunks_to = 8 * KILOBYTE;
+    recorder.fail_on_rget = 1;
+
+    cond_t interruptor;
+    boost::shared_ptr<query_language::json_stream_t> stream(
+        new query_language::batched_rget_stream_t(&recorder, &interruptor, key_range_t::universe(), 10,
+                                                  query_language::backtrace_t(), false));
+
+    int rows = 0;
+    try {
+        while (boost::shared_ptr<scoped_cJSON_t> row = stream->next()) {
+            EXPECT_EQ(rows, cJSON_GetObjectItem(row->get(), "id")->valueint);
+            ++rows;
+        }
+        ADD_FAILURE() << "the stream ended without reporting the failed read";
+    } catch (const query_language::runtime_exc_t &e) {
+        EXPECT_NE(std::string::npos, e.what().find("the test made this read fail"));
+    }
+    EXPECT_LT(0, rows);
+    EXPECT_GT(num_stream_test_rows, rows);
+    EXPECT_EQ(2u, recorder.chunk_sizes.size());
+}
+TEST(RDBProtocol, RgetStreamPrefetchError) {
+    run_in_thread_pool_with_namespace_interface(&run_rget_stream_prefetch_error_test);
+}
+
+/* `RgetStreamChunkSize` checks that chunks start out as big as a plain rget's
+and never get so big that all the shards together could send back more than
+the stream's memory budget. */
+void run_rget_stream_chunk_size_test(namespace_interface_t<rdb_protocol_t> *nsi, order_source_t *osource) {
+    write_stream_test_rows(nsi, osource);
+
+    // Reads of the whole table go to both shards, and reads of the first few
+    // rows go to one.
+    const key_range_t ranges[] = { key_range_t::universe(),
+                                   key_range_t(key_range_t::closed, stream_test_key(0), key_range_t::closed, stream_test_key(10)) };
+    const size_t num_shards[] = { 2, 1 };
+
+    for (size_t i = 0; i < sizeof(ranges) / sizeof(ranges[0]); ++i) {
+        rget_recording_namespace_interface_t recorder(nsi);
+        recorder.shrink_chunks_to = 8 * KILOBYTE;
+
+        // A batch size this big would ask for far more than the budget.
+        cond_t interruptor;
+        boost::shared_ptr<query_language::json_stream_t> stream(
+            new query_language::batched_rget_stream_t(&recorder, &interruptor, ranges[i], 1000000,
+                                                      query_language::backtrace_t(), false));
+        while (stream->next()) { }
+
+        const size_t bound = RGET_STREAM_MEMORY_BUDGET / (2 * num_shards[i] * CLUSTER_CPU_SHARDING_FACTOR);
+        ASSERT_LT(0u, recorder.chunk_sizes.size());
+        EXPECT_EQ(std::min<size_t>(rdb_protocol_t::rget_read_t::DEFAULT_MAX_CHUNK_SIZE, bound), recorder.chunk_sizes[0]);
+        for (size_t j = 0; j < recorder.chunk_sizes.size(); ++j) {
+            EXPECT_GE(bound, recorder.chunk_sizes[j]);
+        }
+    }
+}
+TEST(RDBProtocol, RgetStreamChunkSize) {
+    run_in_thread_pool_with_namespace_interface(&run_rget_stream_chunk_size_test);
+}
+
+/* SECONDARY INDEXES */
+
+/* Rows look like {"id": "row<n>", "color": <color>}, without a color if
+`color` is NULL. The indexes are on "color". */
+std::string sindex_test_id(int id) {
+    return strprintf("row%04d", id);
+}
+
+store_key_t sindex_test_key(int id) {
+    scoped_cJSON_t pk(cJSON_CreateString(sindex_test_id(id).c_str()));
+    return store_key_t(cJSON_print_lexicographic(pk.get()));
+}
+
+rdb_protocol_t::write_response_t sindex_test_write(namespace_interface_t<rdb_protocol_t> *nsi, order_source_t *osource,
+                                                   const rdb_protocol_t::write_t &write) {
+    rdb_protocol_t::write_response_t response;
+    cond_t interruptor;
+    nsi->write(write, &response, osource->check_in("unittest::sindex_test_write"), &interruptor);
+    return response;
+}
+
+void sindex_test_set(namespace_interface_t<rdb_protocol_t> *nsi, order_source_t *osource, int id, const char *color) {
+    boost::shared_ptr<scoped_cJSON_t> row(new scoped_cJSON_t(cJSON_CreateObject()));
+    row->AddItemToObject("id", cJSON_CreateString(sindex_test_id(id).c_str()));
+    if (color) {
+        row->AddItemToObject("color", cJSON_CreateString(color));
+    }
+    sindex_test_write(nsi, osource, rdb_protocol_t::write_t(rdb_protocol_t::point_write_t(sindex_test_key(id), row)));
+}
+
+/* Sets the row's color with an UPDATE, the way a query would. */
+void sindex_test_update(namespace_interface_t<rdb_protocol_t> *nsi, order_source_t *osource, int id, const char *color) {
+    Mapping mapping;
+    mapping.set_arg("row");
+    Term *body = mapping.mutable_body();
+    body->set_type(Term::OBJECT);
+    VarTermTuple *attr = body->add_object();
+    attr->set_var("color");
+    attr->mutable_term()->set_type(Term::STRING);
+    attr->mutable_term()->set_valuestring(color);
+
+    rdb_protocol_t::write_response_t response = sindex_test_write(nsi, osource,
+        rdb_protocol_t::write_t(rdb_protocol_t::point_modify_t("id", sindex_test_key(id), point_modify_ns::UPDATE,
+                                                               query_language::scopes_t(), query_language::backtrace_t(), mapping)));
+    EXPECT_EQ(point_modify_ns::MODIFIED, boost::get<rdb_protocol_t::point_modify_response_t>(response.response).result);
+}
+
+void sindex_test_delete(namespace_interface_t<rdb_protocol_t> *nsi, order_source_t *osource, int id) {
+    sindex_test_write(nsi, osource, rdb_protocol_t::write_t(rdb_protocol_t::point_delete_t(sindex_test_key(id))));
+}
+
+bool sindex_test_create(namespace_interface_t<rdb_protocol_t> *nsi, order_source_t *osource) {
+    rdb_protocol_t::write_response_t response = sindex_test_write(nsi, osource, rdb_protocol_t::write_t(rdb_protocol_t::sindex_create_t("color")));
+    return boost::get<rdb_protocol_t::sindex_create_response_t>(response.response).success;
+}
+
+bool sindex_test_drop(namespace_interface_t<rdb_protocol_t> *nsi, order_source_t *osource) {
+    rdb_protocol_t::write_response_t response = sindex_test_write(nsi, osource, rdb_protocol_t::write_t(rdb_protocol_t::sindex_drop_t("color")));
+    return boost::get<rdb_protocol_t::sindex_drop_response_t>(response.response).success;
+}
+
+/* Reads the ids of the rows whose color is `color` through the index, or of
+every row if `color` is NULL. If the read fails, returns the error instead. */
+std::string sindex_test_read(namespace_interface_t<rdb_protocol_t> *nsi, order_source_t *osource, const char *color, std::set<int> *ids_out) {
+    boost::optional<store_key_t> bound;
+    if (color) {
+        scoped_cJSON_t color_json(cJSON_CreateString(color));
+        bound = store_key_t(cJSON_print_lexicographic(color_json.get()));
+    }
+    rdb_protocol_t::rget_read_t rget(rdb_protocol_t::region_t::universe());
+    rget.sindex = rdb_protocol_t::sindex_rangespec_t("color", "id", bound, bound, query_language::backtrace_t());
+
+    rdb_protocol_t::read_response_t response;
+    cond_t interruptor;
+    nsi->read(rdb_protocol_t::read_t(rget), &response, osource->check_in("unittest::sindex_test_read").with_read_mode(), &interruptor);
+
+    const rdb_protocol_t::rget_read_response_t &rget_response = boost::get<rdb_protocol_t::rget_read_response_t>(response.response);
+    if (const query_language::runtime_exc_t *e = boost::get<query_language::runtime_exc_t>(&rget_response.result)) {
+        return e->what();
+    }
+    EXPECT_FALSE(rget_response.truncated);
+    const rdb_protocol_t::rget_read_response_t::stream_t &stream = boost::get<rdb_protocol_t::rget_read_response_t::stream_t>(rget_response.result);
+    ids_out->clear();
+    for (size_t i = 0; i < stream.size(); ++i) {
+        cJSON *row_color = stream[i].second->GetObjectItem("color");
+        if (color) {
+            EXPECT_TRUE(row_color && row_color->type == cJSON_String && std::string(color) == row_color->valuestring);
+        }
+        std::string id = stream[i].second->GetObjectItem("id")->valuestring;
+        EXPECT_TRUE(ids_out->insert(atoi(id.c_str() + strlen("row"))).second) << "row " << id << " came back twice";
+    }
+    return std::string();
+}
+
+/* Checks that the rows with each color are the ones in `expected`. */
+void sindex_test_check(namespace_interface_t<rdb_protocol_t> *nsi, order_source_t *osource, const std::map<int, std::string> &expected) {
+    std::map<std::string, std::set<int> > ids_by_color;
+    for (std::map<int, std::string>::const_iterator it = expected.begin(); it != expected.end(); ++it) {
+        ids_by_color[it->second].insert(it->first);
+    }
+
+    std::set<int> ids;
+    ASSERT_EQ("", sindex_test_read(nsi, osource, NULL, &ids));
+    EXPECT_EQ(expected.size(), ids.size());
+    for (std::map<std::string, std::set<int> >::iterator it = ids_by_color.begin(); it != ids_by_color.end(); ++it) {
+        ASSERT_EQ("", sindex_test_read(nsi, osource, it->first.c_str(), &ids));
+        EXPECT_TRUE(it->second == ids) << "wrong rows for " << it->first;
+    }
+}
+
+/* New indexes get filled in in the background. */
+void sindex_test_wait_until_ready(namespace_interface_t<rdb_protocol_t> *nsi, order_source_t *osource) {
+    for (int i = 0; i < 1000; ++i) {
+        std::set<int> ids;
+        if (sindex_test_read(nsi, osource, NULL, &ids).find("not ready") == std::string::npos) {
+            return;
+        }
+        nap(10);
+    }
+    ADD_FAILURE() << "the index never got filled in";
+}
+
+const char *const sindex_test_colors[] = { "red", "green", "blue" };
+
+/* `SindexCreateFillDrop` creates an index on a table that already has more
+rows than get filled in at a time, reads them all back through it and then
+drops it. */
+void run_sindex_create_fill_drop_test(namespace_interface_t<rdb_protocol_t> *nsi, order_source_t *osource) {
+    std::map<int, std::string> expected;
+    for (int id = 0; id < 3 * SINDEX_FILL_ROWS_PER_STEP + 10; ++id) {
+        expected[id] = sindex_test_colors[id % 3];
+        sindex_test_set(nsi, osource, id, expected[id].c_str());
+    }
+
+    EXPECT_TRUE(sindex_test_create(nsi, osource));
+    EXPECT_FALSE(sindex_test_create(nsi, osource));
+    sindex_test_wait_until_ready(nsi, osource);
+    sindex_test_check(nsi, osource, expected);
+
+    EXPECT_TRUE(sindex_test_drop(nsi, osource));
+    EXPECT_FALSE(sindex_test_drop(nsi, osource));
+    std::set<int> ids;
+    EXPECT_NE(std::string::npos, sindex_test_read(nsi, osource, NULL, &ids).find("not ready"));
+
+    // Writes don't trip over the index being gone.
+    sindex_test_set(nsi, osource, 0, "blue");
+}
+TEST(RDBProtocol, SindexCreateFillDrop) {
+    run_in_thread_pool_with_namespace_interface(&run_sindex_create_fill_drop_test);
+}
+
+/* `SindexLockstep` checks that sets, updates and deletes keep an index up to
+date, including the rows that don't have the indexed attribute. */
+void run_sindex_lockstep_test(namespace_interface_t<rdb_protocol_t> *nsi, order_source_t *osource) {
+    EXPECT_TRUE(sindex_test_create(nsi, osource));
+    sindex_test_wait_until_ready(nsi, osource);
+
+    std::map<int, std::string> expected;
+    for (int id = 0; id < 30; ++id) {
+        expected[id] = sindex_test_colors[id % 3];
+        sindex_test_set(nsi, osource, id, expected[id].c_str());
+    }
+    sindex_test_check(nsi, osource, expected);
+
+    for (int id = 0; id < 10; ++id) {
+        expected[id] = "purple";
+        sindex_test_set(nsi, osource, id, "purple");
+    }
+    for (int id = 10; id < 20; ++id) {
+        expected[id] = "orange";
+        sindex_test_update(nsi, osource, id, "orange");
+    }
+    for (int id = 20; id < 25; ++id) {
+        expected.erase(id);
+        sindex_test_delete(nsi, osource, id);
+    }
+    sindex_test_check(nsi, osource, expected);
+
+    // Like a scan, reads fail while any row lacks the attribute.
+    sindex_test_set(nsi, osource, 100, NULL);
+    sindex_test_set(nsi, osource, 101, NULL);
+    std::set<int> ids;
+    EXPECT_NE(std::string::npos, sindex_test_read(nsi, osource, "purple", &ids).find("no attribute color"));
+    sindex_test_update(nsi, osource, 100, "purple");
+    EXPECT_NE(std::string::npos, sindex_test_read(nsi, osource, "purple", &ids).find("no attribute color"));
+    sindex_test_delete(nsi, osource, 101);
+    expected[100] = "purple";
+    sindex_test_check(nsi, osource, expected);
+}
+TEST(RDBProtocol, SindexLockstep) {
+    run_in_thread_pool_with_namespace_interface(&run_sindex_lockstep_test);
+}
+
+/* A table in a store of its own, for the tests that need to get at the store
+as well as the namespace interface. */
+class sindex_test_table_t {
+public:
+    sindex_test_table_t(io_backender_t *io_backender, rdb_protocol_t::context_t *ctx, order_source_t *order_source)
+        : temp_file("/tmp/rdb_unittest.XXXXXX") {
+        filepath_file_opener_t file_opener(temp_file.name(), io_backender);
+        standard_serializer_t::create(&file_opener, standard_serializer_t::static_config_t());
+        serializer.init(new standard_serializer_t(standard_serializer_t::dynamic_config_t(),
+                                                  &file_opener,
+                                                  &get_global_perfmon_collection()));
+        store.init(new rdb_protocol_t::store_t(serializer.get(), temp_file.name(), GIGABYTE, true, &get_global_perfmon_collection(), ctx));
 
+        store_view_t<rdb_protocol_t> *store_view = store.get();
+        nsi.init(new dummy_namespace_interface_t<rdb_protocol_t>(std::vector<rdb_protocol_t::region_t>(1, rdb_protocol_t::region_t::universe()),
+                                                                 &store_view, order_source));
+    }
+
+    /* Applies `chunks` the way a backfillee would. */
+    void receive_backfill(const std::vector<rdb_protocol_t::backfill_chunk_t> &chunks) {
+        object_buffer_t<fifo_enforcer_sink_t::exit_write_t> token;
+        store->new_write_token(&token);
+        cond_t interruptor;
+        store->receive_backfill(chunks, &token, &interruptor);
+    }
+
+    mock::temp_file_t temp_file;
+    scoped_ptr_t<serializer_t> serializer;
+    scoped_ptr_t<rdb_protocol_t::store_t> store;
+    scoped_ptr_t<dummy_namespace_interface_t<rdb_protocol_t> > nsi;
+};
+
+void run_with_sindex_test_tables(boost::function<void(sindex_test_table_t *, sindex_test_table_t *, order_source_t *)> fun) {
+    order_source_t order_source;
+
+    scoped_ptr_t<io_backender_t> io_backender;
+    make_io_backender(aio_default, &io_backender);
+
+    dummy_semilattice_controller_t<cluster_semilattice_metadata_t> semilattice_controller((cluster_semilattice_metadata_t()));
+    rdb_protocol_t::context_t ctx(NULL, NULL, semilattice_controller.get_view(), NULL, generate_uuid(), NULL, "");
+
+    sindex_test_table_t first(io_backender.get(), &ctx, &order_source);
+    sindex_test_table_t second(io_backender.get(), &ctx, &order_source);
+    fun(&first, &second, &order_source);
+}
+
+/* `SindexEraseRange` erases part of an indexed table, the way a backfill or a
+reset does, and checks that the erased rows are gone from the index too. */
+void run_sindex_erase_range_test(sindex_test_table_t *table, sindex_test_table_t *, order_source_t *osource) {
+    EXPECT_TRUE(sindex_test_create(table->nsi.get(), osource));
+    sindex_test_wait_until_ready(table->nsi.get(), osource);
+
+    std::map<int, std::string> expected;
+    for (int id = 0; id < 100; ++id) {
+        expected[id] = sindex_test_colors[id % 3];
+        sindex_test_set(table->nsi.get(), osource, id, expected[id].c_str());
+    }
+    // One of the erased rows lacks the attribute, so reads only succeed once
+    // the erase has taken it out of the index.
+    sindex_test_set(table->nsi.get(), osource, 50, NULL);
+
+    std::vector<rdb_protocol_t::backfill_chunk_t> chunks;
+    chunks.push_back(rdb_protocol_t::backfill_chunk_t::delete_range(rdb_protocol_t::region_t(
+        key_range_t(key_range_t::closed, sindex_test_key(40), key_range_t::open, sindex_test_key(60)))));
+    table->receive_backfill(chunks);
+    for (int id = 40; id < 60; ++id) {
+        expected.erase(id);
+    }
+    sindex_test_check(table->nsi.get(), osource, expected);
+}
+TEST(RDBProtocol, SindexEraseRange) {
+    mock::run_in_thread_pool(boost::bind(&run_with_sindex_test_tables, &run_sindex_erase_range_test));
+}
+
+class sindex_test_backfill_callback_t : public send_backfill_callback_t<rdb_protocol_t> {
+public:
+    bool should_backfill_impl(const rdb_protocol_t::store_t::metainfo_t &) {
+        return true;
+    }
+    void send_chunk(const rdb_protocol_t::backfill_chunk_t &chunk, signal_t *) THROWS_ONLY(interrupted_exc_t) {
+        chunks.push_back(chunk);
+    }
+
+    std::vector<rdb_protocol_t::backfill_chunk_t> chunks;
+};
+
+/* `SindexBackfill` backfills an indexed table into an empty store, and checks
+that the backfillee ends up with the index and the same rows in it. */
+void run_sindex_backfill_test(sindex_test_table_t *backfiller, sindex_test_table_t *backfillee, order_source_t *osource) {
+    std::map<int, std::string> expected;
+    for (int id = 0; id < 2 * SINDEX_FILL_ROWS_PER_STEP; ++id) {
+        expected[id] = sindex_test_colors[id % 3];
+        sindex_test_set(backfiller->nsi.get(), osource, id, expected[id].c_str());
+    }
+    EXPECT_TRUE(sindex_test_create(backfiller->nsi.get(), osource));
+    sindex_test_wait_until_ready(backfiller->nsi.get(), osource);
+    for (int id = 0; id < 20; ++id) {
+        expected[id] = "purple";
+        sindex_test_update(backfiller->nsi.get(), osource, id, "purple");
+    }
+    for (int id = 20; id < 30; ++id) {
+        expected.erase(id);
+        sindex_test_delete(backfiller->nsi.get(), osource, id);
+    }
+
+    sindex_test_backfill_callback_t callback;
+    {
+        object_buffer_t<fifo_enforcer_sink_t::exit_read_t> token;
+        backfiller->store->new_read_token(&token);
+        traversal_progress_combiner_t progress;
+        cond_t interruptor;
+        EXPECT_TRUE(backfiller->store->send_backfill(
+            region_map_t<rdb_protocol_t, state_timestamp_t>(rdb_protocol_t::region_t::universe(), state_timestamp_t::zero()),
+            &callback, &progress, &token, &interruptor));
+    }
+    ASSERT_LT(0u, callback.chunks.size());
+    // The indexes come before any of the rows.
+    EXPECT_TRUE(boost::get<rdb_protocol_t::backfill_chunk_t::sindexes_t>(&callback.chunks[0].val) != NULL);
+    backfillee->receive_backfill(callback.chunks);
+
+    sindex_test_wait_until_ready(backfillee->nsi.get(), osource);
+    sindex_test_check(backfillee->nsi.get(), osource, expected);
+}
+TEST(RDBProtocol, SindexBackfill) {
+    mock::run_in_thread_pool(boost::bind(&run_with_sindex_test_tables, &run_sindex_backfill_test));
+}
+
+}   /* namespace unittest */
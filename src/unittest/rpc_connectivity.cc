@@ -200,6 +200,54 @@ TEST(RPCConnectivityTest, OrderingMultiThread) {
     mock::run_in_thread_pool(&run_ordering_test, 3);
 }
 
+/* `CompressedLink` tests that messages get through when one end asks for the
+link to be compressed, including when they pile up and get coalesced into
+frames big enough to be worth compressing. */
+
+void run_compressed_link_test() {
+    int port = mock::randport();
+    connectivity_cluster_t c1, c2;
+    recording_test_application_t a1(&c1), a2(&c2);
+    connectivity_cluster_t::run_t cr1(&c1, mock::get_unittest_addresses(), port, &a1, 0, NULL,
+                                      cluster_link_policy_t(cluster_link_options_t(true, true)));
+    connectivity_cluster_t::run_t cr2(&c2, mock::get_unittest_addresses(), port+1, &a2, 0, NULL);
+
+    cr2.join(c1.get_peer_address(c1.get_me()));
+
+    mock::let_stuff_happen();
+
+    /* Each send blocks until its message is written, so sending them one at a
+    time keeps them in order. */
+    for (int i = 0; i < 10; i++) {
+        a1.send(i, c2.get_me());
+        a2.send(i, c1.get_me());
+    }
+
+    /* These get sent while the connection is busy, so they get bundled. */
+    const int num_piled_up = 1000;
+    for (int i = 10; i < 10 + num_piled_up; i++) {
+        coro_t::spawn_now_dangerously(boost::bind(&recording_test_application_t::send, &a1, i, c2.get_me()));
+        coro_t::spawn_now_dangerously(boost::bind(&recording_test_application_t::send, &a2, i, c1.get_me()));
+    }
+
+    mock::let_stuff_happen();
+
+    for (int i = 0; i < 9; i++) {
+        a1.expect_order(i, i+1);
+        a2.expect_order(i, i+1);
+    }
+    for (int i = 10; i < 10 + num_piled_up; i++) {
+        a1.expect(i, c2.get_me());
+        a2.expect(i, c1.get_me());
+    }
+}
+TEST(RPCConnectivityTest, CompressedLink) {
+    mock::run_in_thread_pool(&run_compressed_link_test);
+}
+TEST(RPCConnectivityTest, CompressedLinkMultiThread) {
+    mock::run_in_thread_pool(&run_compressed_link_test, 3);
+}
+
 /* `GetPeersList` confirms that the behavior of `cluster_t::get_peers_list()` is
 correct. */
 
@@ -0,0 +1,64 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#include "concurrency/semaphore.hpp"
+
+#include "errors.hpp"
+#include <boost/bind.hpp>
+
+#include "arch/runtime/coroutines.hpp"
+#include "concurrency/cond_var.hpp"
+#include "mock/unittest_utils.hpp"
+#include "unittest/gtest.hpp"
+
+namespace unittest {
+
+TEST(SemaphoreTest, TryLockUpToCapacity) {
+    semaphore_t semaphore(3);
+    EXPECT_TRUE(semaphore.try_lock());
+    EXPECT_TRUE(semaphore.try_lock(2));
+    EXPECT_FALSE(semaphore.try_lock());
+
+    semaphore.unlock(2);
+    EXPECT_FALSE(semaphore.try_lock(3));
+    EXPECT_TRUE(semaphore.try_lock(2));
+    EXPECT_FALSE(semaphore.try_lock());
+}
+
+TEST(SemaphoreTest, TryLockNoLimit) {
+    semaphore_t semaphore(SEMAPHORE_NO_LIMIT);
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_TRUE(semaphore.try_lock(i));
+    }
+}
+
+void lock_and_pulse(semaphore_t *semaphore, int count, cond_t *locked) {
+    semaphore->co_lock(count);
+    locked->pulse();
+}
+
+/* `try_lock()` doesn't jump the queue: once something is waiting, it fails
+even if there's room for what it asks for, and it doesn't take anything. */
+void run_try_lock_behind_waiter_test() {
+    semaphore_t semaphore(2);
+    EXPECT_TRUE(semaphore.try_lock(2));
+
+    cond_t locked;
+    coro_t::spawn_sometime(boost::bind(&lock_and_pulse, &semaphore, 2, &locked));
+    coro_t::yield();
+    EXPECT_FALSE(locked.is_pulsed());
+
+    semaphore.unlock();
+    EXPECT_FALSE(semaphore.try_lock());
+
+    semaphore.unlock();
+    locked.wait_lazily_unordered();
+    EXPECT_FALSE(semaphore.try_lock());
+
+    semaphore.unlock(2);
+    EXPECT_TRUE(semaphore.try_lock(2));
+}
+
+TEST(SemaphoreTest, TryLockBehindWaiter) {
+    mock::run_in_thread_pool(&run_try_lock_behind_waiter_test);
+}
+
+}  // namespace unittest
@@ -1,4 +1,6 @@
+#include "arch/runtime/runtime.hpp"
 #include "arch/runtime/starter.hpp"
+#include "perfmon/perfmon.hpp"
 #include "serializer/config.hpp"
 #include "unittest/mock_file.hpp"
 #include "unittest/gtest.hpp"
@@ -20,5 +22,132 @@ TEST(SerializerTest, CreateConstructDestroy) {
     run_in_thread_pool(run_CreateConstructDestroy, 4);
 }
 
+repli_timestamp_t replay_test_recency(int round, block_id_t id) {
+    repli_timestamp_t recency;
+    recency.longtime = round * 100000 + id;
+    return recency;
+}
+
+void run_ReplayLBA() {
+    mock_file_opener_t file_opener;
+    standard_serializer_t::static_config_t static_config;
+    // Small extents, so that every LBA shard spans several of them.
+    static_config.extent_size_ = 16 * KILOBYTE;
+    standard_serializer_t::create(&file_opener, static_config);
+
+    const block_id_t num_blocks = 2000;
+    {
+        standard_serializer_t ser(standard_serializer_t::dynamic_config_t(),
+                                  &file_opener,
+                                  &get_global_perfmon_collection());
+        void *buf = ser.malloc();
+        memset(buf, 0, ser.get_block_size().value());
+
+        // The second round overwrites the first, so replaying the LBA out of order
+        // would leave stale entries behind.
+        for (int round = 0; round < 2; ++round) {
+            std::vector<serializer_write_t> writes;
+            for (block_id_t id = 0; id < num_blocks; ++id) {
+                if (round == 1 && id % 7 == 0) {
+                    writes.push_back(serializer_write_t::make_delete(id));
+                } else {
+                    writes.push_back(serializer_write_t::make_update(id, replay_test_recency(round, id), buf));
+                }
+            }
+            do_writes(&ser, writes, DEFAULT_DISK_ACCOUNT);
+        }
+
+        ser.free(buf);
+    }
+
+    standard_serializer_t ser(standard_serializer_t::dynamic_config_t(),
+                              &file_opener,
+                              &get_global_perfmon_collection());
+    ASSERT_EQ(num_blocks, ser.max_block_id());
+    for (block_id_t id = 0; id < num_blocks; ++id) {
+        if (id % 7 == 0) {
+            EXPECT_TRUE(ser.get_delete_bit(id));
+            EXPECT_FALSE(ser.index_read(id).has());
+        } else {
+            EXPECT_FALSE(ser.get_delete_bit(id));
+            EXPECT_TRUE(ser.index_read(id).has());
+            EXPECT_EQ(replay_test_recency(1, id), ser.get_recency(id));
+        }
+    }
+}
+
+TEST(SerializerTest, ReplayLBA) {
+    run_in_thread_pool(run_ReplayLBA, 4);
+}
+
+/* Collects the stats in `collection` from every thread and returns the value of
+the serializer perfmon called `name`. */
+int64_t get_serializer_stat(perfmon_collection_t *collection, const std::string &name) {
+    void *ctx = collection->begin_stats();
+    for (int thread = 0; thread < get_num_threads(); ++thread) {
+        on_thread_t thread_switcher(thread);
+        collection->visit_stats(ctx);
+    }
+    scoped_ptr_t<perfmon_result_t> result(collection->end_stats(ctx));
+
+    perfmon_result_t::iterator serializer = result->get_map()->find("serializer");
+    guarantee(serializer != result->end());
+    perfmon_result_t::iterator stat = serializer->second->get_map()->find(name);
+    guarantee(stat != serializer->second->end());
+    guarantee(stat->second->is_string());
+    return strtoll(stat->second->get_string()->c_str(), NULL, 10);
+}
+
+void run_CollectGarbage() {
+    mock_file_opener_t file_opener;
+    standard_serializer_t::static_config_t static_config;
+    static_config.extent_size_ = 16 * KILOBYTE;
+    standard_serializer_t::create(&file_opener, static_config);
+
+    // Every round overwrites a random half of the blocks, which leaves the
+    // extents from earlier rounds partly garbage, so the GC has to move live
+    // blocks around.
+    const block_id_t num_blocks = 2000;
+    std::vector<int> last_round(num_blocks, 0);
+    {
+        perfmon_collection_t stats;
+        standard_serializer_t ser(standard_serializer_t::dynamic_config_t(),
+                                  &file_opener,
+                                  &stats);
+        void *buf = ser.malloc();
+        memset(buf, 0, ser.get_block_size().value());
+
+        for (int round = 0; round < 8; ++round) {
+            std::vector<serializer_write_t> writes;
+            for (block_id_t id = 0; id < num_blocks; ++id) {
+                if (round == 0 || randint(2) == 0) {
+                    writes.push_back(serializer_write_t::make_update(id, replay_test_recency(round, id), buf));
+                    last_round[id] = round;
+                }
+            }
+            do_writes(&ser, writes, DEFAULT_DISK_ACCOUNT);
+        }
+
+        ser.free(buf);
+
+        // Less than a quarter of the blocks written are still live, which is well
+        // past the GC's high ratio, so it must have collected some extents.
+        EXPECT_LT(0, get_serializer_stat(&stats, "serializer_data_extents_gced"));
+        EXPECT_LT(0, get_serializer_stat(&stats, "serializer_data_extents_reclaimed"));
+    }
+
+    standard_serializer_t ser(standard_serializer_t::dynamic_config_t(),
+                              &file_opener,
+                              &get_global_perfmon_collection());
+    for (block_id_t id = 0; id < num_blocks; ++id) {
+        EXPECT_TRUE(ser.index_read(id).has());
+        EXPECT_EQ(replay_test_recency(last_round[id], id), ser.get_recency(id));
+    }
+}
+
+TEST(SerializerTest, CollectGarbage) {
+    run_in_thread_pool(run_CollectGarbage, 4);
+}
+
 
 }  // namespace unittest
@@ -0,0 +1,123 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#include <stdlib.h>
+
+#include "arch/io/disk.hpp"
+#include "mock/unittest_utils.hpp"
+#include "rdb_protocol/stream.hpp"
+#include "unittest/gtest.hpp"
+
+namespace unittest {
+
+using query_language::in_memory_stream_t;
+using query_language::json_stream_t;
+using query_language::sort_stream_t;
+
+static const int NUM_ROWS = 2000;
+
+/* Rows look like {"key": <something in [0, 50)>, "pos": <position in the input>}. */
+cJSON *make_rows() {
+    cJSON *array = cJSON_CreateArray();
+    for (int i = 0; i < NUM_ROWS; ++i) {
+        cJSON *row = cJSON_CreateObject();
+        cJSON_AddItemToObject(row, "key", cJSON_CreateNumber(random() % 50));
+        cJSON_AddItemToObject(row, "pos", cJSON_CreateNumber(i));
+        cJSON_AddItemToArray(array, row);
+    }
+    return array;
+}
+
+boost::shared_ptr<json_stream_t> stream_rows(const scoped_cJSON_t &rows) {
+    return boost::shared_ptr<json_stream_t>(new in_memory_stream_t(json_array_iterator_t(rows.get())));
+}
+
+double get_number(const boost::shared_ptr<scoped_cJSON_t> &row, const char *attr) {
+    return cJSON_GetObjectItem(row->get(), attr)->valuedouble;
+}
+
+bool key_less(const boost::shared_ptr<scoped_cJSON_t> &x, const boost::shared_ptr<scoped_cJSON_t> &y) {
+    return get_number(x, "key") < get_number(y, "key");
+}
+
+/* Checks that `stream` gives back all the rows, sorted by key, and in input
+order when their keys are equal. */
+void check_sorted(json_stream_t *stream) {
+    boost::shared_ptr<scoped_cJSON_t> prev;
+    int count = 0;
+    while (boost::shared_ptr<scoped_cJSON_t> row = stream->next()) {
+        if (prev) {
+            ASSERT_LE(get_number(prev, "key"), get_number(row, "key"));
+            if (get_number(prev, "key") == get_number(row, "key")) {
+                ASSERT_LT(get_number(prev, "pos"), get_number(row, "pos"));
+            }
+        }
+        prev = row;
+        ++count;
+    }
+    EXPECT_EQ(NUM_ROWS, count);
+}
+
+void run_in_memory_test() {
+    scoped_cJSON_t rows(make_rows());
+    sort_stream_t stream(stream_rows(rows), &key_less, NULL, "", GIGABYTE);
+    check_sorted(&stream);
+}
+
+TEST(SortStream, InMemory) {
+    mock::run_in_thread_pool(&run_in_memory_test);
+}
+
+void run_spilled_test() {
+    scoped_ptr_t<io_backender_t> io_backender;
+    make_io_backender(aio_default, &io_backender);
+
+    // A budget this small spills a run every few hundred rows.
+    scoped_cJSON_t rows(make_rows());
+    sort_stream_t stream(stream_rows(rows), &key_less, io_backender.get(), ".", 64 * KILOBYTE);
+    check_sorted(&stream);
+}
+
+TEST(SortStream, Spilled) {
+    mock::run_in_thread_pool(&run_spilled_test);
+}
+
+void run_top_k_test() {
+    scoped_cJSON_t rows(make_rows());
+
+    sort_stream_t top_k(stream_rows(rows), &key_less, NULL, "", GIGABYTE);
+    top_k.limit_to(100);
+    sort_stream_t everything(stream_rows(rows), &key_less, NULL, "", GIGABYTE);
+    for (int i = 0; i < 100; ++i) {
+        boost::shared_ptr<scoped_cJSON_t> row = top_k.next();
+        ASSERT_TRUE(row);
+        EXPECT_EQ(get_number(everything.next(), "pos"), get_number(row, "pos"));
+    }
+    EXPECT_FALSE(top_k.next());
+}
+
+TEST(SortStream, TopK) {
+    mock::run_in_thread_pool(&run_top_k_test);
+}
+
+void run_top_k_spilled_test() {
+    scoped_ptr_t<io_backender_t> io_backender;
+    make_io_backender(aio_default, &io_backender);
+    scoped_cJSON_t rows(make_rows());
+
+    // Most of the rows are wanted, so they don't fit in the budget either.
+    static const int limit = 3 * NUM_ROWS / 4;
+    sort_stream_t top_k(stream_rows(rows), &key_less, io_backender.get(), ".", 64 * KILOBYTE);
+    top_k.limit_to(limit);
+    sort_stream_t everything(stream_rows(rows), &key_less, NULL, "", GIGABYTE);
+    for (int i = 0; i < limit; ++i) {
+        boost::shared_ptr<scoped_cJSON_t> row = top_k.next();
+        ASSERT_TRUE(row);
+        EXPECT_EQ(get_number(everything.next(), "pos"), get_number(row, "pos"));
+    }
+    EXPECT_LT(0u, top_k.spilled_runs());
+}
+
+TEST(SortStream, TopKSpilled) {
+    mock::run_in_thread_pool(&run_top_k_spilled_test);
+}
+
+}  // namespace unittest
@@ -0,0 +1,89 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#ifdef URINGSUPPORT
+
+#include <errno.h>
+#include <linux/io_uring.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "arch/io/disk.hpp"
+#include "concurrency/cond_var.hpp"
+#include "mock/unittest_utils.hpp"
+#include "unittest/gtest.hpp"
+
+namespace unittest {
+
+/* Containers and old kernels don't let us set up an io_uring. */
+bool kernel_has_io_uring() {
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    int fd = syscall(__NR_io_uring_setup, 1, &params);
+    if (fd < 0) {
+        return false;
+    }
+    close(fd);
+    return true;
+}
+
+struct counting_io_cond_t : public iocallback_t, public cond_t {
+    explicit counting_io_cond_t(int _refcount) : refcount(_refcount) { }
+    void on_io_complete() {
+        refcount--;
+        if (refcount == 0) pulse();
+    }
+    int refcount;
+};
+
+void run_uring_reads_and_writes_test() {
+    // More than fit in the ring at once, so some have to wait for room.
+    static const int num_blocks = 4 * MAX_CONCURRENT_IO_REQUESTS;
+
+    scoped_ptr_t<io_backender_t> io_backender;
+    make_io_backender(aio_uring, &io_backender);
+    mock::temp_file_t temp_file("/tmp/rdb_unittest.XXXXXX");
+    linux_direct_file_t file(temp_file.name(), linux_file_t::mode_read | linux_file_t::mode_write | linux_file_t::mode_create, io_backender.get());
+    file.set_size_at_least(num_blocks * DEVICE_BLOCK_SIZE);
+
+    char *blocks = static_cast<char *>(malloc_aligned(num_blocks * DEVICE_BLOCK_SIZE, DEVICE_BLOCK_SIZE));
+    for (int i = 0; i < num_blocks; ++i) {
+        memset(blocks + i * DEVICE_BLOCK_SIZE, i % 251, DEVICE_BLOCK_SIZE);
+    }
+    {
+        counting_io_cond_t written(num_blocks);
+        for (int i = 0; i < num_blocks; ++i) {
+            file.write_async(i * DEVICE_BLOCK_SIZE, DEVICE_BLOCK_SIZE, blocks + i * DEVICE_BLOCK_SIZE, DEFAULT_DISK_ACCOUNT, &written);
+        }
+        written.wait();
+    }
+
+    char *read_back = static_cast<char *>(malloc_aligned(num_blocks * DEVICE_BLOCK_SIZE, DEVICE_BLOCK_SIZE));
+    memset(read_back, 0xff, num_blocks * DEVICE_BLOCK_SIZE);
+    {
+        // Backwards, so that the reads don't come in the order they were written.
+        counting_io_cond_t read(num_blocks);
+        for (int i = num_blocks - 1; i >= 0; --i) {
+            file.read_async(i * DEVICE_BLOCK_SIZE, DEVICE_BLOCK_SIZE, read_back + i * DEVICE_BLOCK_SIZE, DEFAULT_DISK_ACCOUNT, &read);
+        }
+        read.wait();
+    }
+
+    for (int i = 0; i < num_blocks; ++i) {
+        EXPECT_EQ(0, memcmp(blocks + i * DEVICE_BLOCK_SIZE, read_back + i * DEVICE_BLOCK_SIZE, DEVICE_BLOCK_SIZE)) << "block " << i;
+    }
+
+    free(read_back);
+    free(blocks);
+}
+
+TEST(UringTest, ReadsAndWrites) {
+    if (!kernel_has_io_uring()) {
+        fprintf(stderr, "Skipping: this kernel doesn't let us set up an io_uring (%s).\n", strerror(errno));
+        return;
+    }
+    mock::run_in_thread_pool(&run_uring_reads_and_writes_test);
+}
+
+}  // namespace unittest
+
+#endif  // URINGSUPPORT
@@ -0,0 +1,81 @@
+// Copyright 2010-2012 RethinkDB, all rights reserved.
+#include "errors.hpp"
+#include <boost/bind.hpp>
+
+#include "arch/runtime/coroutines.hpp"
+#include "arch/runtime/runtime.hpp"
+#include "arch/runtime/starter.hpp"
+#include "arch/timing.hpp"
+#include "concurrency/cond_var.hpp"
+#include "unittest/gtest.hpp"
+#include "utils.hpp"
+
+namespace unittest {
+
+struct stealing_test_state_t {
+    stealing_test_state_t() : remaining(0), done(NULL), wrong_thread(false) {
+        for (int i = 0; i < MAX_THREADS; ++i) {
+            ran_on[i] = 0;
+        }
+    }
+
+    int remaining;
+    cond_t *done;
+    bool wrong_thread;
+    int ran_on[MAX_THREADS];
+};
+
+static void busy_wait(ticks_t ticks) {
+    ticks_t end = get_ticks() + ticks;
+    while (get_ticks() < end) { }
+}
+
+static void thread_agnostic_job(stealing_test_state_t *state) {
+    int home = get_thread_id();
+    {
+        on_any_thread_t rethreader;
+        __sync_fetch_and_add(&state->ran_on[get_thread_id()], 1);
+        busy_wait(secs_to_ticks(0.0005));
+    }
+    if (get_thread_id() != home) {
+        state->wrong_thread = true;
+    }
+    if (--state->remaining == 0) {
+        state->done->pulse();
+    }
+}
+
+static void run_skewed_jobs(stealing_test_state_t *state) {
+    const int num_jobs = 200;
+    cond_t done;
+    state->done = &done;
+    state->remaining = num_jobs;
+    for (int i = 0; i < num_jobs; ++i) {
+        coro_t::spawn_sometime(boost::bind(&thread_agnostic_job, state));
+    }
+    done.wait();
+    state->done = NULL;
+}
+
+TEST(WorkStealingTest, JobsReturnHome) {
+    stealing_test_state_t state;
+    ::run_in_thread_pool(boost::bind(&run_skewed_jobs, &state), 4, true);
+    EXPECT_FALSE(state.wrong_thread);
+    int total = 0;
+    for (int i = 0; i < MAX_THREADS; ++i) {
+        total += state.ran_on[i];
+    }
+    EXPECT_EQ(200, total);
+    // The jobs were all spawned on thread 0, and the other threads had
+    // nothing else to do, so they must have taken some of them.
+    EXPECT_LT(state.ran_on[0], total);
+}
+
+TEST(WorkStealingTest, DisabledStaysHome) {
+    stealing_test_state_t state;
+    ::run_in_thread_pool(boost::bind(&run_skewed_jobs, &state), 4, false);
+    EXPECT_FALSE(state.wrong_thread);
+    EXPECT_EQ(200, state.ran_on[0]);
+}
+
+}  // namespace unittest
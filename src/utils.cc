@@ -180,6 +180,13 @@ on_thread_t::~on_thread_t() {
     coro_t::move_to_thread(home_thread());
 }
 
+on_any_thread_t::on_any_thread_t() {
+    coro_t::move_to_any_thread();
+}
+on_any_thread_t::~on_any_thread_t() {
+    coro_t::move_to_thread(home_thread());
+}
+
 microtime_t current_microtime() {
     // This could be done more efficiently, surely.
     struct timeval t;
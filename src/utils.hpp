@@ -262,6 +262,18 @@ public:
     ~on_thread_t();
 };
 
+/* `on_any_thread_t` marks code that doesn't care which thread it runs on: it
+touches nothing that belongs to a particular thread, only its own locals and
+heap objects that nobody else is using. If work stealing is on (see
+`linux_thread_pool_t::work_stealing`), the constructor may let an idle thread
+take the coroutine; the destructor moves it back to the thread it started on.
+Without work stealing, both are no-ops. */
+class on_any_thread_t : public home_thread_mixin_t {
+public:
+    on_any_thread_t();
+    ~on_any_thread_t();
+};
+
 
 template <class InputIterator, class UnaryPredicate>
 bool all_match_predicate(InputIterator begin, InputIterator end, UnaryPredicate f) {
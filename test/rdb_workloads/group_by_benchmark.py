@@ -0,0 +1,80 @@
+#!/usr/bin/python
+# Copyright 2010-2012 RethinkDB, all rights reserved.
+
+# Measures how long a `group_by` over a big table takes as the table is split
+# into more and more shards.
+#
+# Environment variables:
+# HOST: location of server (default = "localhost")
+# PORT: port that server listens for RDB protocol traffic on (default = 28015)
+# HTTP_PORT: port that server listens for HTTP admin traffic on (default = 8080)
+# DB_NAME: database to put the benchmark table in (default = "test")
+
+import os
+import sys
+import time
+from optparse import OptionParser
+
+sys.path.append(os.path.abspath(os.path.join(os.path.dirname(__file__), '..', '..', 'drivers', 'python')))
+sys.path.append(os.path.abspath(os.path.join(os.path.dirname(__file__), '..', 'common')))
+
+import rethinkdb as r
+import http_admin
+
+parser = OptionParser()
+parser.add_option("--rows", type = "int", default = 10000000, help = "number of rows in the table")
+parser.add_option("--groups", type = "int", default = 100, help = "number of distinct groups")
+parser.add_option("--shards", default = "1,2,4,8,16", help = "comma-separated shard counts to time, in order")
+parser.add_option("--repeat", type = "int", default = 3, help = "timed runs per shard count")
+parser.add_option("--table", default = "group_by_benchmark", help = "table to use; it's created and filled if it doesn't exist")
+parser.add_option("--batch-size", type = "int", default = 1000, help = "rows per insert while filling the table")
+(opts, args) = parser.parse_args()
+
+host = os.environ.get('HOST', 'localhost')
+port = int(os.environ.get('PORT', 28015))
+http_port = int(os.environ.get('HTTP_PORT', 8080))
+db_name = os.environ.get('DB_NAME', 'test')
+
+# Ids are zero-padded strings, so that the table's key order is the insertion
+# order and we can pick split points that make equal shards.
+def row_id(i):
+    return "%010d" % i
+
+def row_key(i):
+    return "S" + row_id(i)
+
+r.connect(host, port)
+db = r.db(db_name)
+table = db.table(opts.table)
+
+if opts.table not in db.table_list().run():
+    print "Creating and filling table %s with %d rows..." % (opts.table, opts.rows)
+    db.table_create(opts.table).run()
+    for start in xrange(0, opts.rows, opts.batch_size):
+        rows = [{'id': row_id(i), 'group': i % opts.groups, 'value': i}
+                for i in xrange(start, min(start + opts.batch_size, opts.rows))]
+        table.insert(rows).run()
+    print "Done."
+
+http = http_admin.ClusterAccess([(host, http_port)])
+namespace = http.find_namespace(opts.table)
+
+query = table.group_by('group', r.sum('value'))
+
+for num_shards in [int(n) for n in opts.shards.split(",")]:
+    splits = set(row_key(opts.rows * i // num_shards) for i in xrange(1, num_shards))
+    current = set(namespace.shards)
+    http.change_namespace_shards(namespace, adds = list(splits - current), removes = list(current - splits))
+    http.wait_until_blueprint_satisfied(namespace, print_seconds = False)
+
+    # The first run warms up the cache.
+    query.run()
+
+    times = []
+    for i in xrange(opts.repeat):
+        start = time.time()
+        result = query.run()
+        times.append(time.time() - start)
+        assert len(result) == min(opts.groups, opts.rows)
+
+    print "%d shards: best %.3fs, mean %.3fs" % (num_shards, min(times), sum(times) / len(times))